@@ -5,20 +5,120 @@
  *  History: 
  *  Date        Name        Modification
  *  2021-05-19  Jason Bacon Begin
+ *  2026-10-17  agent       Add --overlap mode for interval-index.c
+ *  2026-10-17  agent       Add --sort mode for chrom-sort.c
  ***************************************************************************/
 
 #include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
 #include <sysexits.h>
+#include <inttypes.h>
 #include "bed.h"
+#include "interval-index.h"
+#include "chrom-sort.h"
+
+int     overlap(const char *features_file, FILE *query_stream, FILE *out);
+int     sort_bed(size_t max_run_bytes, unsigned threads, FILE *in, FILE *out);
 
 int     main(int argc,char *argv[])
 
 {
     bl_bed_t   bed_feature;
     
+    // Report features overlapping each BED record on stdin
+    if ( (argc == 3) && (strcmp(argv[1], "--overlap") == 0) )
+	return overlap(argv[2], stdin, stdout);
+    
+    // Sort stdin by chrom and start in runs of at most max-run-bytes
+    if ( (argc == 4) && (strcmp(argv[1], "--sort") == 0) )
+	return sort_bed(strtoul(argv[2], NULL, 10), strtoul(argv[3], NULL, 10),
+			stdin, stdout);
+    
     bl_bed_skip_header(stdin);
     while ( bl_bed_read(&bed_feature, stdin, BL_BED_FIELD_ALL) != EOF )
 	bl_bed_write(&bed_feature, stdout, BL_BED_FIELD_ALL);
     return EX_OK;
 }
 
+
+/*
+ *  Index the features in features_file and print the names of those
+ *  overlapping each query, in order of start position.
+ */
+
+int     overlap(const char *features_file, FILE *query_stream, FILE *out)
+
+{
+    bl_interval_index_t index;
+    bl_bed_t            feature = BL_BED_INIT, query = BL_BED_INIT;
+    bl_interval_t       *interval;
+    FILE                *features_stream;
+    char                (*names)[BL_BED_NAME_MAX_CHARS + 1] = NULL;
+    size_t              name_count = 0, *hits = NULL, hits_array_size = 0,
+			count, c;
+    
+    if ( (features_stream = fopen(features_file, "r")) == NULL )
+    {
+	fprintf(stderr, "Cannot open %s.\n", features_file);
+	return EX_NOINPUT;
+    }
+    bl_interval_index_init(&index);
+    bl_bed_skip_header(features_stream);
+    while ( bl_bed_read(&feature, features_stream, BL_BED_FIELD_ALL)
+	    == BL_READ_OK )
+    {
+	names = realloc(names, (name_count + 1) * sizeof(*names));
+	strcpy(names[name_count], BL_BED_NAME(&feature));
+	if ( bl_interval_index_add_bed(&index, &feature, name_count++)
+	     != BL_INTERVAL_INDEX_OK )
+	    return EX_DATAERR;
+    }
+    fclose(features_stream);
+    bl_interval_index_build(&index);
+    
+    bl_bed_skip_header(query_stream);
+    while ( bl_bed_read(&query, query_stream, BL_BED_FIELD_ALL)
+	    == BL_READ_OK )
+    {
+	// BED to 1-based, inclusive
+	count = bl_interval_index_query(&index, BL_BED_CHROM(&query),
+		    BL_BED_CHROM_START(&query) + 1, BL_BED_CHROM_END(&query),
+		    &hits, &hits_array_size);
+	fprintf(out, "%s\t%" PRId64 "\t%" PRId64 "\t", BL_BED_CHROM(&query),
+		BL_BED_CHROM_START(&query), BL_BED_CHROM_END(&query));
+	if ( count == 0 )
+	    putc('.', out);
+	for (c = 0; c < count; ++c)
+	{
+	    interval = &BL_INTERVAL_INDEX_INTERVALS_AE(&index, hits[c]);
+	    fprintf(out, "%s%s", c == 0 ? "" : ",",
+		    names[BL_INTERVAL_VALUE(interval)]);
+	}
+	putc('\n', out);
+    }
+    free(hits);
+    free(names);
+    bl_interval_index_free(&index);
+    return EX_OK;
+}
+
+
+/*
+ *  Sort a BED stream with bl_chrom_sort_file().  A small max_run_bytes
+ *  forces multiple temporary runs and a merge.
+ */
+
+int     sort_bed(size_t max_run_bytes, unsigned threads, FILE *in, FILE *out)
+
+{
+    bl_chrom_sort_t sort;
+    int             status;
+    
+    bl_chrom_sort_init(&sort, BL_CHROM_SORT_FORMAT_BED);
+    bl_chrom_sort_set_max_run_bytes(&sort, max_run_bytes);
+    bl_chrom_sort_set_threads(&sort, threads);
+    status = bl_chrom_sort_file(&sort, in, out);
+    bl_chrom_sort_free(&sort);
+    return status == BL_CHROM_SORT_OK ? EX_OK : EX_DATAERR;
+}
@@ -12,3 +12,20 @@ for file in good; do
 	printf "BED test: Failure on $file.bed.\n"
     fi
 done
+
+./bed-test --overlap features.bed < queries.bed > out.txt
+if diff overlap-correct.txt out.txt; then
+    printf "BED test: Interval index overlaps OK.\n"
+else
+    printf "BED test: Interval index overlap failure.\n"
+fi
+rm -f out.txt
+
+# A small run limit forces several temporary runs and a merge
+./bed-test --sort 100 2 < unsorted.bed > out.bed
+if diff sort-correct.bed out.bed; then
+    printf "BED test: External sort OK.\n"
+else
+    printf "BED test: External sort failure.\n"
+fi
+rm -f out.bed
@@ -8,17 +8,78 @@
  ***************************************************************************/
 
 #include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
 #include <sysexits.h>
 #include <biolibc/fasta.h>
+#include <biolibc/fasta-map.h>
+#include <biolibc/fasta-index.h>
 #include <biolibc/biolibc.h>
 
 int     main(int argc,char *argv[])
 
 {
     bl_fasta_t  rec = BL_FASTA_INIT;
+    bl_fastx_reader_t   reader = BL_FASTX_READER_INIT;
+    bl_fasta_map_t      map = BL_FASTA_MAP_INIT;
+    bl_fasta_view_t     view = BL_FASTA_VIEW_INIT;
+    bl_fasta_index_t    index = BL_FASTA_INDEX_INIT;
+    char        window[101];
+    size_t      start;
     
-    while ( bl_fasta_read(&rec, stdin) != BL_READ_EOF )
-	bl_fasta_write(&rec, stdout, 100);
+    if ( (argc == 2) && (strcmp(argv[1], "--buffered") == 0) )
+    {
+	bl_fastx_reader_open(&reader, stdin, 0);
+	while ( bl_fasta_read_buffered(&rec, &reader) != BL_READ_EOF )
+	    bl_fasta_write(&rec, stdout, 100);
+	bl_fastx_reader_close(&reader);
+    }
+    else if ( (argc == 3) && (strcmp(argv[1], "--mapped") == 0) )
+    {
+	if ( bl_fasta_map_open(&map, argv[2]) != BL_FASTA_MAP_OK )
+	{
+	    perror(argv[2]);
+	    return EX_NOINPUT;
+	}
+	// Copy sequence one 100-base window at a time
+	while ( bl_fasta_map_read(&map, &view) == BL_READ_OK )
+	{
+	    printf("%.*s\n", (int)BL_FASTA_VIEW_DESC_LEN(&view),
+		   BL_FASTA_VIEW_DESC(&view));
+	    for (start = 0; start < BL_FASTA_VIEW_SEQ_LEN(&view); start += 100)
+	    {
+		bl_fasta_view_copy(&view, window, start, 100);
+		puts(window);
+	    }
+	}
+	bl_fasta_map_close(&map);
+    }
+    else if ( (argc == 2) && (strcmp(argv[1], "--index") == 0) )
+    {
+	if ( bl_fasta_index_build(&index, stdin) != BL_FASTA_INDEX_OK )
+	    return EX_DATAERR;
+	bl_fasta_index_write(&index, stdout);
+	bl_fasta_index_free(&index);
+    }
+    else if ( (argc == 6) && (strcmp(argv[1], "--fetch") == 0) )
+    {
+	if ( bl_fasta_index_open(&index, argv[2]) != BL_FASTA_INDEX_OK )
+	{
+	    perror(argv[2]);
+	    return EX_NOINPUT;
+	}
+	if ( bl_fasta_index_fetch(&index, &rec, argv[3],
+		strtoll(argv[4], NULL, 10), strtoll(argv[5], NULL, 10))
+		!= BL_READ_OK )
+	    return EX_DATAERR;
+	bl_fasta_write(&rec, stdout, 60);
+	bl_fasta_index_free(&index);
+    }
+    else
+    {
+	while ( bl_fasta_read(&rec, stdin) != BL_READ_EOF )
+	    bl_fasta_write(&rec, stdout, 100);
+    }
     bl_fasta_free(&rec);
     return EX_OK;
 }
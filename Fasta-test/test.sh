@@ -18,4 +18,36 @@ if diff test.fasta out.fasta; then
 else
     printf "Differences found, test failed.\n"
 fi
-rm -f fasta-test out.fasta
+
+printf "\n===\nBuffered read...\n"
+./fasta-test --buffered < test.fasta > out.fasta
+if diff test.fasta out.fasta; then
+    printf "No differences found, test passed.\n"
+else
+    printf "Differences found, test failed.\n"
+fi
+printf "\n===\nMemory-mapped read...\n"
+./fasta-test --mapped test.fasta > out.fasta
+if diff test.fasta out.fasta; then
+    printf "No differences found, test passed.\n"
+else
+    printf "Differences found, test failed.\n"
+fi
+
+printf "\n===\nIndex...\n"
+./fasta-test --index < test.fasta > out.fai
+if diff correct.fai out.fai; then
+    printf "No differences found, test passed.\n"
+else
+    printf "Differences found, test failed.\n"
+fi
+
+printf "\n===\nRegion fetch...\n"
+./fasta-test --fetch multiline.fasta seq2 55 140 > out.fasta
+if diff fetch-correct.fasta out.fasta; then
+    printf "No differences found, test passed.\n"
+else
+    printf "Differences found, test failed.\n"
+fi
+
+rm -f fasta-test out.fasta out.fai multiline.fasta.fai
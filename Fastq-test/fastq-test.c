@@ -10,6 +10,7 @@
 #include <stdio.h>
 #include <sysexits.h>
 #include <stdlib.h>
+#include <string.h>
 
 #include <biolibc/fastq.h>
 #include <biolibc/biolibc.h>
@@ -18,17 +19,26 @@ int     main(int argc,char *argv[])
 
 {
     bl_fastq_t  rec = BL_FASTQ_INIT;
-    int         min_qual;
+    bl_fastx_reader_t   reader = BL_FASTX_READER_INIT;
+    int         min_qual, buffered = 0;
     
+    if ( (argc == 3) && (strcmp(argv[1], "--buffered") == 0) )
+    {
+	buffered = 1;
+	bl_fastx_reader_open(&reader, stdin, 0);
+	++argv;
+	--argc;
+    }
     if ( argc != 2 )
     {
-	fprintf(stderr, "Usage: %s min-qual\n", argv[0]);
+	fprintf(stderr, "Usage: %s [--buffered] min-qual\n", argv[0]);
 	return 1;
     }
     min_qual = atoi(argv[1]);
     
     // Copy with trimming: Run multiple times with different min qual
-    while ( bl_fastq_read(&rec, stdin) != BL_READ_EOF )
+    while ( (buffered ? bl_fastq_read_buffered(&rec, &reader) :
+			bl_fastq_read(&rec, stdin)) != BL_READ_EOF )
     {
 	if ( min_qual >0 )
 	    puts("Raw read:");
@@ -31,4 +31,12 @@ else
     printf "Differences found, test failed.\n"
 fi
 
+printf "\n===\nBuffered read, min qual $min_qual...\n"
+./fastq-test --buffered $min_qual < low-qual.fastq > out.fastq
+if diff low-qual-correct.fastq out.fastq; then
+    printf "No differences found, test passed.\n"
+else
+    printf "Differences found, test failed.\n"
+fi
+
 rm -f fastq-test out.fastq
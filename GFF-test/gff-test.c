@@ -1,31 +1,349 @@
 /***************************************************************************
  *  Description:
- *      Test gff.c functions
+ *      Test gff3.c functions
  *
  *  History: 
  *  Date        Name        Modification
  *  2021-05-19  Jason Bacon Begin
+ *  2026-10-17  agent       Update to gff3.h API, add --upstream
+ *  2026-10-17  agent       Add --upstream-gix
+ *  2026-10-17  agent       Add --attributes, --attributes-scan
+ *  2026-10-17  agent       Add --graph
+ *  2026-10-17  agent       Add --store
+ *  2026-10-17  agent       Add --gix-corrupt
  ***************************************************************************/
 
 #include <stdio.h>
+#include <string.h>
+#include <stdlib.h>
+#include <stdbool.h>
 #include <sysexits.h>
-#include "gff.h"
+#include <limits.h>
+#include <unistd.h>
+#include <sys/stat.h>
+#include "gff3.h"
+#include "gff3-index.h"
+#include "gff3-graph.h"
+#include "gff3-store.h"
+
+int     upstream(const char *gff3_file, int64_t feature_count, int64_t max_nt,
+		 bool persistent);
+int     attributes(const char *gff3_file, gff3_field_mask_t field_mask);
+int     graph(const char *gff3_file);
+int     store(void);
+int     gix_corrupt(const char *gff3_file);
 
 int     main(int argc,char *argv[])
 
 {
-    bl_gff_t    gff_feature;
+    bl_gff3_t   gff_feature;
     FILE        *tmpfile;
     int         ch;
     
-    tmpfile = bl_gff_skip_header(stdin);
+    // Report the feature bl_gff3_index_seek_reverse() finds for each
+    if ( (argc == 5) && (strcmp(argv[1], "--upstream") == 0) )
+	return upstream(argv[4], strtoll(argv[2], NULL, 10),
+			strtoll(argv[3], NULL, 10), false);
+    
+    // Same, using a saved index file, built on first use
+    if ( (argc == 5) && (strcmp(argv[1], "--upstream-gix") == 0) )
+	return upstream(argv[4], strtoll(argv[2], NULL, 10),
+			strtoll(argv[3], NULL, 10), true);
+    
+    // Reject damaged seqid IDs, then replace the index file
+    if ( (argc == 3) && (strcmp(argv[1], "--gix-corrupt") == 0) )
+	return gix_corrupt(argv[2]);
+    
+    // Look up attributes with and without the attribute table
+    if ( (argc == 3) && (strcmp(argv[1], "--attributes") == 0) )
+	return attributes(argv[2], BL_GFF3_FIELD_ALL);
+    if ( (argc == 3) && (strcmp(argv[1], "--attributes-scan") == 0) )
+	return attributes(argv[2],
+			  BL_GFF3_FIELD_ALL & ~BL_GFF3_FIELD_ATTRIBUTE_TABLE);
+    
+    // List the exons of each gene and the gene of each exon
+    if ( (argc == 3) && (strcmp(argv[1], "--graph") == 0) )
+	return graph(argv[2]);
+    
+    // Load stdin into a compact store and write it back
+    if ( (argc == 2) && (strcmp(argv[1], "--store") == 0) )
+	return store();
+    
+    bl_gff3_init(&gff_feature);
+    tmpfile = bl_gff3_skip_header(stdin);
     while ( (ch = getc(tmpfile)) != EOF )
 	putchar(ch);
-    while ( bl_gff_read(&gff_feature, stdin, BL_GFF_FIELD_ALL) != EOF )
+    while ( bl_gff3_read(&gff_feature, stdin, BL_GFF3_FIELD_ALL) != EOF )
+    {
+	fprintf(stderr, "%s %s\n", BL_GFF3_FEATURE_ID(&gff_feature),
+		BL_GFF3_FEATURE_NAME(&gff_feature));
+	bl_gff3_write(&gff_feature, stdout, BL_GFF3_FIELD_ALL);
+    }
+    return EX_OK;
+}
+
+
+/*
+ *  Index every feature in gff3_file, then print the ID of each feature
+ *  and of the feature found by backing up feature_count features or
+ *  max_nt nucleotides from it.  If persistent, load the index with
+ *  bl_gff3_index_open() instead of building it here.
+ */
+
+int     upstream(const char *gff3_file, int64_t feature_count, int64_t max_nt,
+		 bool persistent)
+
+{
+    bl_gff3_index_t gi = BL_GFF3_INDEX_INIT;
+    bl_gff3_t       feature, found;
+    FILE            *stream, *seek_stream;
+    
+    if ( ((stream = fopen(gff3_file, "r")) == NULL) ||
+	 ((seek_stream = fopen(gff3_file, "r")) == NULL) )
+    {
+	fprintf(stderr, "Cannot open %s.\n", gff3_file);
+	return EX_NOINPUT;
+    }
+    bl_gff3_init(&feature);
+    bl_gff3_init(&found);
+    
+    if ( persistent )
+    {
+	if ( bl_gff3_index_open(&gi, gff3_file, NULL) != BL_GFF3_INDEX_OK )
+	    return EX_DATAERR;
+    }
+    else
+    {
+	fclose(bl_gff3_skip_header(stream));
+	while ( bl_gff3_read(&feature, stream, BL_GFF3_FIELD_ALL)
+		== BL_READ_OK )
+	    if ( bl_gff3_index_add(&gi, &feature) != BL_GFF3_INDEX_OK )
+		return EX_DATAERR;
+	rewind(stream);
+    }
+    
+    fclose(bl_gff3_skip_header(stream));
+    while ( bl_gff3_read(&feature, stream, BL_GFF3_FIELD_ALL) == BL_READ_OK )
+    {
+	if ( (bl_gff3_index_seek_reverse(&gi, seek_stream, &feature,
+					 feature_count, max_nt) != 0) ||
+	     (bl_gff3_read(&found, seek_stream, BL_GFF3_FIELD_ALL)
+		!= BL_READ_OK) )
+	    return EX_DATAERR;
+	printf("%s\t%s\n", BL_GFF3_FEATURE_ID(&feature),
+	       BL_GFF3_FEATURE_ID(&found));
+    }
+    
+    bl_gff3_free(&feature);
+    bl_gff3_free(&found);
+    bl_gff3_index_free(&gi);
+    fclose(stream);
+    fclose(seek_stream);
+    return EX_OK;
+}
+
+
+/*
+ *  Print the ID, name, parent, and biotype of each feature in gff3_file,
+ *  the last looked up in place with bl_gff3_find_attribute().
+ */
+
+int     attributes(const char *gff3_file, gff3_field_mask_t field_mask)
+
+{
+    bl_gff3_t   feature;
+    FILE        *stream;
+    const char  *biotype;
+    size_t      len;
+    
+    if ( (stream = fopen(gff3_file, "r")) == NULL )
+    {
+	fprintf(stderr, "Cannot open %s.\n", gff3_file);
+	return EX_NOINPUT;
+    }
+    bl_gff3_init(&feature);
+    fclose(bl_gff3_skip_header(stream));
+    while ( bl_gff3_read(&feature, stream, field_mask) == BL_READ_OK )
+    {
+	if ( (biotype = bl_gff3_find_attribute(&feature, "biotype", &len))
+		== NULL )
+	{
+	    biotype = "-";
+	    len = 1;
+	}
+	printf("%s\t%s\t%s\t%.*s\n",
+	       BL_GFF3_FEATURE_ID(&feature) == NULL ? "-" :
+	       BL_GFF3_FEATURE_ID(&feature), BL_GFF3_FEATURE_NAME(&feature),
+	       BL_GFF3_FEATURE_PARENT(&feature), (int)len, biotype);
+    }
+    bl_gff3_free(&feature);
+    fclose(stream);
+    return EX_OK;
+}
+
+
+/*
+ *  Load the feature hierarchy of gff3_file, then print each gene with
+ *  the positions of its exons, each exon with its gene, and each gene
+ *  with its number of descendants of any type.
+ */
+
+int     graph(const char *gff3_file)
+
+{
+    bl_gff3_graph_t gr = BL_GFF3_GRAPH_INIT;
+    FILE            *stream;
+    size_t          *exons = NULL,
+		    exons_array_size = 0,
+		    count,
+		    node,
+		    gene,
+		    c;
+    
+    if ( (stream = fopen(gff3_file, "r")) == NULL )
+    {
+	fprintf(stderr, "Cannot open %s.\n", gff3_file);
+	return EX_NOINPUT;
+    }
+    fclose(bl_gff3_skip_header(stream));
+    if ( bl_gff3_graph_load(&gr, stream) != BL_GFF3_GRAPH_OK )
+	return EX_DATAERR;
+    fclose(stream);
+    
+    for (node = 0; node < BL_GFF3_GRAPH_COUNT(&gr); ++node)
+    {
+	if ( strcmp(BL_GFF3_GRAPH_TYPE(&gr, node), "gene") != 0 )
+	    continue;
+	count = bl_gff3_graph_descendants(&gr, node, "exon", &exons,
+					  &exons_array_size);
+	printf("%s", BL_GFF3_GRAPH_ID(&gr, node));
+	for (c = 0; c < count; ++c)
+	    printf("\t%" PRId64, BL_GFF3_GRAPH_NODES_AE(&gr, exons[c]).start);
+	putchar('\n');
+    }
+    for (node = 0; node < BL_GFF3_GRAPH_COUNT(&gr); ++node)
+    {
+	if ( strcmp(BL_GFF3_GRAPH_TYPE(&gr, node), "exon") != 0 )
+	    continue;
+	gene = bl_gff3_graph_ancestor(&gr, node, "gene");
+	printf("%" PRId64 "\t%s\n", BL_GFF3_GRAPH_NODES_AE(&gr, node).start,
+	       gene == BL_GFF3_GRAPH_NONE ? "-" : BL_GFF3_GRAPH_ID(&gr, gene));
+    }
+    printf("%s\n", BL_GFF3_GRAPH_ID(&gr, bl_gff3_graph_find(&gr, "CDS:c1")));
+    
+    // Features with several parents must be counted once
+    for (node = 0; node < BL_GFF3_GRAPH_COUNT(&gr); ++node)
+	if ( strcmp(BL_GFF3_GRAPH_TYPE(&gr, node), "gene") == 0 )
+	    printf("%s\t%zu\n", BL_GFF3_GRAPH_ID(&gr, node),
+		   bl_gff3_graph_descendants(&gr, node, NULL, &exons,
+					     &exons_array_size));
+    
+    free(exons);
+    bl_gff3_graph_free(&gr);
+    return EX_OK;
+}
+
+
+/*
+ *  Load the features of a GFF3 file from stdin into a bl_gff3_store_t,
+ *  then write the header and every feature to stdout, and each name
+ *  to stderr, for comparison with the bl_gff3_t round trip above.
+ */
+
+int     store(void)
+
+{
+    bl_gff3_store_t st = BL_GFF3_STORE_INIT;
+    FILE            *header;
+    const char      *name;
+    size_t          len,
+		    c;
+    int             ch;
+    
+    header = bl_gff3_skip_header(stdin);
+    while ( (ch = getc(header)) != EOF )
+	putchar(ch);
+    fclose(header);
+    if ( bl_gff3_store_load(&st, stdin) != BL_GFF3_STORE_OK )
+	return EX_DATAERR;
+    for (c = 0; c < BL_GFF3_STORE_COUNT(&st); ++c)
     {
-	fprintf(stderr, "%s %s\n", BL_GFF_FEATURE_ID(&gff_feature),
-		BL_GFF_FEATURE_NAME(&gff_feature));
-	bl_gff_write(&gff_feature, stdout, BL_GFF_FIELD_ALL);
+	if ( (name = bl_gff3_store_find_attribute(&st, c, "Name", &len))
+		!= NULL )
+	    fprintf(stderr, "%.*s\n", (int)len, name);
+	bl_gff3_store_write(&st, c, stdout);
     }
+    bl_gff3_store_free(&st);
+    return EX_OK;
+}
+
+
+/*
+ *  Build gff3_file.gix, damage its seqid IDs and check that
+ *  bl_gff3_index_map() rejects them.  gff3_file must have at least two
+ *  seqids.  bl_gff3_index_open() must then replace the damaged file with
+ *  a new one, leaving an existing mapping of the old one usable.
+ */
+
+int     gix_corrupt(const char *gff3_file)
+
+{
+    bl_gff3_index_t gi = BL_GFF3_INDEX_INIT,
+		    old = BL_GFF3_INDEX_INIT;
+    bl_gff3_index_file_t    header;
+    char            index_file[PATH_MAX + 1];
+    struct stat     st;
+    ino_t           inode;
+    FILE            *stream;
+    long            seqid_ids_pos;
+    int32_t         id;
+    size_t          c;
+    bool            same;
+    
+    snprintf(index_file, PATH_MAX + 1, "%s.gix", gff3_file);
+    unlink(index_file);
+    if ( bl_gff3_index_open(&gi, gff3_file, NULL) != BL_GFF3_INDEX_OK )
+	return EX_DATAERR;
+    bl_gff3_index_free(&gi);
+    if ( (bl_gff3_index_map(&old, index_file, gff3_file)
+	    != BL_GFF3_INDEX_OK) ||
+	 (stat(index_file, &st) != 0) ||
+	 ((stream = fopen(index_file, "r+")) == NULL) ||
+	 (fread(&header, sizeof(header), 1, stream) != 1) )
+	return EX_DATAERR;
+    inode = st.st_ino;
+    seqid_ids_pos = sizeof(header) + header.count * 4 * sizeof(int64_t);
+    
+    // First feature names a seqid that does not exist
+    id = header.seqid_count;
+    fseek(stream, seqid_ids_pos, SEEK_SET);
+    fwrite(&id, sizeof(id), 1, stream);
+    fflush(stream);
+    printf("seqid out of range: %d\n",
+	   bl_gff3_index_map(&gi, index_file, gff3_file));
+    
+    // Last feature names the first seqid
+    id = 0;
+    fseek(stream, seqid_ids_pos, SEEK_SET);
+    fwrite(&id, sizeof(id), 1, stream);
+    fseek(stream, seqid_ids_pos + (header.count - 1) * sizeof(id), SEEK_SET);
+    fwrite(&id, sizeof(id), 1, stream);
+    fclose(stream);
+    printf("seqid in wrong partition: %d\n",
+	   bl_gff3_index_map(&gi, index_file, gff3_file));
+    
+    printf("rebuild: %d\n", bl_gff3_index_open(&gi, gff3_file, NULL));
+    if ( stat(index_file, &st) != 0 )
+	return EX_DATAERR;
+    printf("new file: %s\n", st.st_ino != inode ? "yes" : "no");
+    same = BL_GFF3_INDEX_COUNT(&old) == BL_GFF3_INDEX_COUNT(&gi);
+    for (c = 0; same && (c < BL_GFF3_INDEX_COUNT(&gi)); ++c)
+	same = BL_GFF3_INDEX_START_AE(&old, c) ==
+	       BL_GFF3_INDEX_START_AE(&gi, c);
+    printf("old mapping usable: %s\n", same ? "yes" : "no");
+    
+    bl_gff3_index_free(&gi);
+    bl_gff3_index_free(&old);
+    unlink(index_file);
     return EX_OK;
 }
@@ -3,7 +3,8 @@
 cd ..
 ./cave-man-install.sh
 cd GFF-test
-cc -I.. -o gff-test gff-test.c -L.. -lbiolibc -L../../local/lib -lxtend
+cc -I.. -o gff-test gff-test.c -L.. -lbiolibc -L../../local/lib -lxtend \
+    -lz -lpthread
 cat << EOM
 
 Terminal output should be:
@@ -28,3 +29,57 @@ for file in good; do
 	printf "GFF3 test: Failure on $file.gff3.\n"
     fi
 done
+
+./gff-test --upstream 2 20000 good.gff3 > out.txt
+./gff-test --upstream 3 3000 unsorted.gff3 >> out.txt
+if cat upstream-correct.txt unsorted-correct.txt | diff - out.txt; then
+    printf "GFF3 test: Index seek reverse OK.\n"
+else
+    printf "GFF3 test: Index seek reverse failure.\n"
+fi
+rm -f out.txt
+
+# First run builds and saves good.gff3.gix, second maps it
+./gff-test --upstream-gix 2 20000 good.gff3 > out.txt
+./gff-test --upstream-gix 2 20000 good.gff3 >> out.txt
+if cat upstream-correct.txt upstream-correct.txt | diff - out.txt; then
+    printf "GFF3 test: Persistent index OK.\n"
+else
+    printf "GFF3 test: Persistent index failure.\n"
+fi
+rm -f out.txt good.gff3.gix
+
+# Index files are checked on load and replaced, not truncated, when stale
+cp unsorted.gff3 corrupt.gff3
+./gff-test --gix-corrupt corrupt.gff3 > out.txt
+if diff gix-corrupt-correct.txt out.txt; then
+    printf "GFF3 test: Damaged index OK.\n"
+else
+    printf "GFF3 test: Damaged index failure.\n"
+fi
+rm -f out.txt corrupt.gff3 corrupt.gff3.gix
+
+./gff-test --attributes attributes.gff3 > out.txt
+./gff-test --attributes-scan attributes.gff3 >> out.txt
+if cat attributes-correct.txt attributes-correct.txt | diff - out.txt; then
+    printf "GFF3 test: Attribute lookup OK.\n"
+else
+    printf "GFF3 test: Attribute lookup failure.\n"
+fi
+rm -f out.txt
+
+./gff-test --graph hierarchy.gff3 > out.txt
+if diff graph-correct.txt out.txt; then
+    printf "GFF3 test: Feature graph OK.\n"
+else
+    printf "GFF3 test: Feature graph failure.\n"
+fi
+rm -f out.txt
+
+./gff-test --store < good.gff3 > out.gff3 2> /dev/null
+if diff good.gff3 out.gff3; then
+    printf "GFF3 test: Compact store OK.\n"
+else
+    printf "GFF3 test: Compact store failure.\n"
+fi
+rm -f out.gff3
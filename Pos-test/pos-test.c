@@ -0,0 +1,475 @@
+/***************************************************************************
+ *  Description:
+ *      Test pos-list.c sorting and set operations, and pos-pack.c
+ *      packing, files and searches.  Small cases print their results.
+ *      Large generated cases are checked against simple reference
+ *      implementations and print ok or FAILED.
+ *
+ *  History:
+ *  Date        Name        Modification
+ *  2026-10-17  agent       Begin
+ *  2026-10-17  agent       Add pos-pack tests
+ ***************************************************************************/
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <sysexits.h>
+#include <inttypes.h>
+#include "pos-list.h"
+#include "pos-pack.h"
+
+typedef size_t (*set_op_t)(bl_pos_list_t *result, const bl_pos_list_t *list1,
+			   const bl_pos_list_t *list2);
+
+void    set_list(bl_pos_list_t *list, const int64_t *positions, size_t count);
+void    random_list(bl_pos_list_t *list, size_t count, int64_t range,
+		    uint64_t *seed);
+void    print_list(const char *label, const bl_pos_list_t *list);
+void    print_op(const char *label, set_op_t op,
+		 const int64_t *p1, size_t c1, const int64_t *p2, size_t c2);
+int     check_sort(const char *label, bl_pos_list_t *list,
+		   bl_pos_list_sort_order_t order);
+int     check_ops(const char *label, size_t count1, size_t count2,
+		  int64_t range, uint64_t *seed);
+bool    naive_contains(const bl_pos_list_t *list, int64_t position);
+int     check_pack(const char *label, size_t count, int64_t range,
+		   uint64_t *seed);
+void    print_read(const char *label, const bl_pos_pack_file_t *header,
+		   const int64_t *firsts, const uint64_t *offsets,
+		   const unsigned char *data);
+
+int     main(int argc,char *argv[])
+
+{
+    bl_pos_list_t   list = BL_POS_LIST_INIT;
+    uint64_t        seed = 1;
+    size_t          c,
+		    sizes[] = { BL_POS_LIST_RADIX_MIN - 1,
+				BL_POS_LIST_RADIX_MIN, 10000, 100000 };
+    char            label[64];
+    int             status = EX_OK;
+    int64_t         dups[] = { 7, -3, 7, 0, -3, 7, 12, 0 },
+		    a[] = { 1, 3, 3, 5, 9 },
+		    b[] = { 3, 3, 3, 4, 9, 10 },
+		    one[] = { 3 },
+		    three[] = { 3, 3, 3 },
+		    many[100];
+
+    // Small cases, results checked by eye in correct.txt
+    set_list(&list, dups, sizeof(dups) / sizeof(*dups));
+    bl_pos_list_radix_sort(&list, BL_POS_LIST_ASCENDING);
+    print_list("sort ascending", &list);
+    bl_pos_list_dedup(&list);
+    print_list("dedup", &list);
+    set_list(&list, dups, sizeof(dups) / sizeof(*dups));
+    bl_pos_list_radix_sort(&list, BL_POS_LIST_DESCENDING);
+    print_list("sort descending", &list);
+    set_list(&list, NULL, 0);
+    bl_pos_list_radix_sort(&list, BL_POS_LIST_ASCENDING);
+    bl_pos_list_dedup(&list);
+    print_list("sort and dedup empty", &list);
+
+    print_op("union", bl_pos_list_union, a, 5, b, 6);
+    print_op("intersect", bl_pos_list_intersect, a, 5, b, 6);
+    print_op("difference a - b", bl_pos_list_difference, a, 5, b, 6);
+    print_op("difference b - a", bl_pos_list_difference, b, 6, a, 5);
+    print_op("union empty", bl_pos_list_union, a, 5, NULL, 0);
+    print_op("intersect empty", bl_pos_list_intersect, NULL, 0, b, 6);
+    print_op("difference empty", bl_pos_list_difference, a, 5, NULL, 0);
+    print_op("difference from empty", bl_pos_list_difference, NULL, 0, b, 6);
+
+    // Unequal sizes take the galloping path
+    for (c = 0; c < 100; ++c)
+	many[c] = c / 2;
+    print_op("intersect gallop", bl_pos_list_intersect, one, 1, many, 100);
+    print_op("intersect gallop swapped", bl_pos_list_intersect,
+	     many, 100, one, 1);
+    // Each copy in one list matches at most one in the other, as in a merge
+    print_op("intersect gallop dups", bl_pos_list_intersect,
+	     three, 3, many, 100);
+    print_op("difference gallop", bl_pos_list_difference, b, 6, many, 100);
+
+    // Large cases, both sides of BL_POS_LIST_RADIX_MIN
+    for (c = 0; c < 4; ++c)
+    {
+	snprintf(label, 64, "sort random %zu", sizes[c]);
+	random_list(&list, sizes[c], 0, &seed);
+	status |= check_sort(label, &list, BL_POS_LIST_ASCENDING);
+	snprintf(label, 64, "sort random %zu descending", sizes[c]);
+	random_list(&list, sizes[c], 0, &seed);
+	status |= check_sort(label, &list, BL_POS_LIST_DESCENDING);
+	snprintf(label, 64, "sort narrow %zu", sizes[c]);
+	random_list(&list, sizes[c], 1000, &seed);
+	status |= check_sort(label, &list, BL_POS_LIST_ASCENDING);
+	snprintf(label, 64, "sort sorted %zu", sizes[c]);
+	status |= check_sort(label, &list, BL_POS_LIST_ASCENDING);
+	snprintf(label, 64, "sort reversed %zu", sizes[c]);
+	status |= check_sort(label, &list, BL_POS_LIST_DESCENDING);
+    }
+    for (c = 0; c < list.count; ++c)
+	list.positions[c] = 42;
+    status |= check_sort("sort constant 100000", &list, BL_POS_LIST_ASCENDING);
+
+    status |= check_ops("ops equal sizes", 5000, 5000, 20000, &seed);
+    status |= check_ops("ops dense", 5000, 5000, 3000, &seed);
+    status |= check_ops("ops small first", 10, 50000, 200000, &seed);
+    status |= check_ops("ops small second", 50000, 10, 200000, &seed);
+    status |= check_ops("ops near ratio", 300, 5000, 20000, &seed);
+    status |= check_ops("ops one empty", 0, 5000, 20000, &seed);
+
+    status |= check_pack("pack narrow", 100000, 200000, &seed);
+    status |= check_pack("pack wide", 10000, 0, &seed);
+    status |= check_pack("pack partial block", 300, 1000, &seed);
+    status |= check_pack("pack one block", 128, 1000, &seed);
+    status |= check_pack("pack empty", 0, 1000, &seed);
+
+    /*
+     *  Hand-built files.  Only the first is valid.  Every other must be
+     *  rejected without reading past the data.
+     */
+    {
+	bl_pos_pack_file_t  header = { BL_POS_PACK_MAGIC, BL_POS_PACK_VERSION,
+				       BL_POS_PACK_BYTE_ORDER, 2, 1, 1 };
+	int64_t         firsts[2] = { 100, 5 };
+	uint64_t        offsets[2] = { 0, 0 };
+	unsigned char   data[BL_POS_PACK_BLOCK_SIZE];
+
+	memset(data, 1, sizeof(data));
+	print_read("read valid", &header, firsts, offsets, data);
+	header.data_len = 2;
+	print_read("read unused bytes", &header, firsts, offsets, data);
+	memset(data, 0x80, sizeof(data));
+	header.data_len = 11;
+	print_read("read long varint", &header, firsts, offsets, data);
+	header.data_len = 1;
+	print_read("read truncated varint", &header, firsts, offsets, data);
+	header.count = 256;
+	header.block_count = 2;
+	header.data_len = 0;
+	print_read("read empty blocks", &header, firsts, offsets, data);
+	memset(data, 1, sizeof(data));
+	header.count = 129;
+	offsets[1] = header.data_len = 127;
+	print_read("read unsorted blocks", &header, firsts, offsets, data);
+	firsts[1] = 227;
+	print_read("read sorted blocks", &header, firsts, offsets, data);
+	offsets[0] = 1;
+	print_read("read bad first offset", &header, firsts, offsets, data);
+	offsets[0] = 0;
+	header.magic[0] = 'X';
+	print_read("read bad magic", &header, firsts, offsets, data);
+    }
+
+    bl_pos_list_free(&list);
+    return status;
+}
+
+
+void    set_list(bl_pos_list_t *list, const int64_t *positions, size_t count)
+
+{
+    bl_pos_list_reserve(list, count);
+    if ( count > 0 )
+	memcpy(list->positions, positions, count * sizeof(*positions));
+    list->count = count;
+}
+
+
+/*
+ *  Fill list with count positions in [-range / 2, range / 2), or any
+ *  int64_t if range is 0, from an LCG so runs are repeatable.
+ */
+
+void    random_list(bl_pos_list_t *list, size_t count, int64_t range,
+		    uint64_t *seed)
+
+{
+    size_t  c;
+
+    bl_pos_list_reserve(list, count);
+    for (c = 0; c < count; ++c)
+    {
+	*seed = *seed * 6364136223846793005ULL + 1442695040888963407ULL;
+	list->positions[c] = range == 0 ? (int64_t)*seed :
+	    (int64_t)((*seed >> 1) % (uint64_t)range) - range / 2;
+    }
+    list->count = count;
+}
+
+
+void    print_list(const char *label, const bl_pos_list_t *list)
+
+{
+    size_t  c;
+
+    printf("%s:", label);
+    for (c = 0; c < list->count; ++c)
+	printf(" %" PRId64, list->positions[c]);
+    putchar('\n');
+}
+
+
+void    print_op(const char *label, set_op_t op,
+		 const int64_t *p1, size_t c1, const int64_t *p2, size_t c2)
+
+{
+    bl_pos_list_t   list1 = BL_POS_LIST_INIT;
+    bl_pos_list_t   list2 = BL_POS_LIST_INIT;
+    bl_pos_list_t   result = BL_POS_LIST_INIT;
+
+    set_list(&list1, p1, c1);
+    set_list(&list2, p2, c2);
+    op(&result, &list1, &list2);
+    print_list(label, &result);
+    bl_pos_list_free(&list1);
+    bl_pos_list_free(&list2);
+    bl_pos_list_free(&result);
+}
+
+
+/*
+ *  Sort list with bl_pos_list_radix_sort() and compare to qsort().
+ *  The list is left sorted for the next test.
+ */
+
+int     check_sort(const char *label, bl_pos_list_t *list,
+		   bl_pos_list_sort_order_t order)
+
+{
+    int64_t *expected;
+    int     ok;
+
+    expected = malloc(list->count * sizeof(*expected) + 1);
+    memcpy(expected, list->positions, list->count * sizeof(*expected));
+    qsort(expected, list->count, sizeof(*expected),
+	  (int (*)(const void *,const void *))(order == BL_POS_LIST_ASCENDING ?
+	  position_cmp_ascending : position_cmp_descending));
+    bl_pos_list_radix_sort(list, order);
+    ok = memcmp(expected, list->positions,
+		list->count * sizeof(*expected)) == 0;
+    printf("%s: %s\n", label, ok ? "ok" : "FAILED");
+    free(expected);
+    return ok ? EX_OK : EX_SOFTWARE;
+}
+
+
+bool    naive_contains(const bl_pos_list_t *list, int64_t position)
+
+{
+    size_t  c;
+
+    for (c = 0; c < list->count; ++c)
+	if ( list->positions[c] == position )
+	    return true;
+    return false;
+}
+
+
+/*
+ *  Check union, intersection and difference of two random sets, and
+ *  contains() and contains_from(), against linear searches.
+ */
+
+int     check_ops(const char *label, size_t count1, size_t count2,
+		  int64_t range, uint64_t *seed)
+
+{
+    bl_pos_list_t   list1 = BL_POS_LIST_INIT;
+    bl_pos_list_t   list2 = BL_POS_LIST_INIT;
+    bl_pos_list_t   result = BL_POS_LIST_INIT;
+    size_t          c, n, cursor = 0;
+    int             ok = 1;
+    int64_t         p;
+
+    random_list(&list1, count1, range, seed);
+    bl_pos_list_radix_sort(&list1, BL_POS_LIST_ASCENDING);
+    bl_pos_list_dedup(&list1);
+    random_list(&list2, count2, range, seed);
+    bl_pos_list_radix_sort(&list2, BL_POS_LIST_ASCENDING);
+    bl_pos_list_dedup(&list2);
+
+    // Every position of either list must be in the union, once, in order
+    bl_pos_list_union(&result, &list1, &list2);
+    for (c = 0, n = 0; c < list1.count; ++c)
+	n += ! naive_contains(&list2, list1.positions[c]);
+    ok &= result.count == n + list2.count;
+    for (c = 1; c < result.count; ++c)
+	ok &= result.positions[c - 1] < result.positions[c];
+    for (c = 0; c < result.count; ++c)
+	ok &= naive_contains(&list1, result.positions[c]) ||
+	      naive_contains(&list2, result.positions[c]);
+
+    bl_pos_list_intersect(&result, &list1, &list2);
+    for (c = 0, n = 0; c < list1.count; ++c)
+	if ( naive_contains(&list2, list1.positions[c]) )
+	    ok &= (n < result.count) &&
+		  (result.positions[n++] == list1.positions[c]);
+    ok &= n == result.count;
+
+    bl_pos_list_difference(&result, &list1, &list2);
+    for (c = 0, n = 0; c < list1.count; ++c)
+	if ( ! naive_contains(&list2, list1.positions[c]) )
+	    ok &= (n < result.count) &&
+		  (result.positions[n++] == list1.positions[c]);
+    ok &= n == result.count;
+
+    // Ascending probes, some hits and some misses
+    for (p = -range / 2 - 1; p <= range / 2 + 1; p += range / 1000 + 1)
+    {
+	ok &= bl_pos_list_contains(&list2, p) == naive_contains(&list2, p);
+	ok &= bl_pos_list_contains_from(&list2, p, &cursor) ==
+	      naive_contains(&list2, p);
+    }
+
+    printf("%s: %s\n", label, ok ? "ok" : "FAILED");
+    bl_pos_list_free(&list1);
+    bl_pos_list_free(&list2);
+    bl_pos_list_free(&result);
+    return ok ? EX_OK : EX_SOFTWARE;
+}
+
+
+/*
+ *  Pack a random sorted list and check to_list(), iteration, skip_to()
+ *  and contains() against it, both before and after a round trip
+ *  through a file.  A truncated copy of the file must be rejected.
+ */
+
+int     check_pack(const char *label, size_t count, int64_t range,
+		   uint64_t *seed)
+
+{
+    bl_pos_list_t   list = BL_POS_LIST_INIT;
+    bl_pos_list_t   unpacked = BL_POS_LIST_INIT;
+    bl_pos_pack_t   pack = BL_POS_PACK_INIT;
+    bl_pos_pack_t   copy = BL_POS_PACK_INIT;
+    bl_pos_pack_iter_t  iter;
+    FILE            *fp, *truncated;
+    size_t          c, cursor, len;
+    int             ok = 1, ch;
+    int64_t         p, target;
+
+    random_list(&list, count, range, seed);
+    bl_pos_list_radix_sort(&list, BL_POS_LIST_ASCENDING);
+    ok &= bl_pos_pack_from_list(&pack, &list) == BL_POS_PACK_OK;
+    ok &= bl_pos_pack_add(&pack, count > 0 ? list.positions[0] - 1 : 0) ==
+	  (count > 0 ? BL_POS_PACK_NOT_SORTED : BL_POS_PACK_OK);
+    if ( count == 0 )
+	bl_pos_pack_free(&pack);
+
+    if ( (fp = tmpfile()) == NULL )
+    {
+	fprintf(stderr, "check_pack(): Cannot create temp file.\n");
+	exit(EX_CANTCREAT);
+    }
+    ok &= bl_pos_pack_write(&pack, fp) == BL_POS_PACK_OK;
+    len = ftell(fp);
+    rewind(fp);
+    ok &= bl_pos_pack_read(&copy, fp) == BL_POS_PACK_OK;
+    ok &= (copy.count == pack.count) && (copy.last == pack.last);
+
+    // Packed lists must be usable for more adds after a read
+    if ( count > 0 )
+    {
+	ok &= bl_pos_pack_add(&copy, pack.last - 1) == BL_POS_PACK_NOT_SORTED;
+	ok &= bl_pos_pack_add(&copy, pack.last) == BL_POS_PACK_OK;
+	ok &= (copy.count == count + 1) && (copy.last == pack.last);
+	bl_pos_pack_free(&copy);
+	rewind(fp);
+	ok &= bl_pos_pack_read(&copy, fp) == BL_POS_PACK_OK;
+    }
+
+    ok &= bl_pos_pack_to_list(&copy, &unpacked) == count;
+    ok &= (unpacked.count == count) && ((count == 0) ||
+	  (memcmp(unpacked.positions, list.positions,
+		  count * sizeof(*list.positions)) == 0));
+    bl_pos_pack_iter_init(&iter, &copy);
+    for (c = 0; bl_pos_pack_iter_next(&iter, &p); ++c)
+	ok &= (c < count) && (p == list.positions[c]);
+    ok &= c == count;
+
+    // Ascending targets, some hits and some misses.  skip_to() consumes
+    // the position it returns, so cursor tracks the iterator.
+    bl_pos_pack_iter_init(&iter, &copy);
+    for (c = 0, cursor = 0; c < 2000; ++c)
+    {
+	if ( count == 0 )
+	    target = c;
+	else
+	{
+	    target = list.positions[count * c / 2000];
+	    target += c % 3 == 0 ? -1 : c % 3 == 1 ? 0 : 1;
+	}
+	while ( (cursor < count) && (list.positions[cursor] < target) )
+	    ++cursor;
+	if ( bl_pos_pack_iter_skip_to(&iter, target, &p) )
+	    ok &= (cursor < count) && (p == list.positions[cursor++]);
+	else
+	    ok &= cursor == count;
+	ok &= bl_pos_pack_contains(&copy, target) ==
+	      bl_pos_list_contains(&list, target);
+    }
+
+    // Every proper prefix of the file must be rejected
+    if ( (truncated = tmpfile()) == NULL )
+    {
+	fprintf(stderr, "check_pack(): Cannot create temp file.\n");
+	exit(EX_CANTCREAT);
+    }
+    rewind(fp);
+    for (c = 0; (c < len - 1) && ((ch = getc(fp)) != EOF); ++c)
+	putc(ch, truncated);
+    rewind(truncated);
+    ok &= bl_pos_pack_read(&copy, truncated) == BL_POS_PACK_BAD_FORMAT;
+    ok &= copy.count == 0;
+
+    printf("%s: %s\n", label, ok ? "ok" : "FAILED");
+    fclose(fp);
+    fclose(truncated);
+    bl_pos_list_free(&list);
+    bl_pos_list_free(&unpacked);
+    bl_pos_pack_free(&pack);
+    bl_pos_pack_free(&copy);
+    return ok ? EX_OK : EX_SOFTWARE;
+}
+
+
+/*
+ *  Write a packed list file from its parts and print the status of
+ *  reading it back, followed by its positions if valid.
+ */
+
+void    print_read(const char *label, const bl_pos_pack_file_t *header,
+		   const int64_t *firsts, const uint64_t *offsets,
+		   const unsigned char *data)
+
+{
+    bl_pos_pack_t   pack = BL_POS_PACK_INIT;
+    bl_pos_list_t   list = BL_POS_LIST_INIT;
+    FILE            *fp;
+    int             status;
+
+    if ( (fp = tmpfile()) == NULL )
+    {
+	fprintf(stderr, "print_read(): Cannot create temp file.\n");
+	exit(EX_CANTCREAT);
+    }
+    fwrite(header, sizeof(*header), 1, fp);
+    fwrite(firsts, sizeof(*firsts), header->block_count, fp);
+    fwrite(offsets, sizeof(*offsets), header->block_count, fp);
+    fwrite(data, 1, header->data_len, fp);
+    rewind(fp);
+    status = bl_pos_pack_read(&pack, fp);
+    printf("%s: %d", label, status);
+    if ( status == BL_POS_PACK_OK )
+    {
+	bl_pos_pack_to_list(&pack, &list);
+	printf(" count %zu last %" PRId64 "\n", list.count, pack.last);
+	bl_pos_pack_free(&pack);
+	bl_pos_list_free(&list);
+    }
+    else
+	putchar('\n');
+    fclose(fp);
+}
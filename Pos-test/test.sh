@@ -0,0 +1,21 @@
+#!/bin/sh -e
+
+if [ $0 != ./test.sh ]; then
+    printf "Must be run as ./test.sh.\n"
+    exit 1
+fi
+
+cd ..
+./cave-man-install.sh
+cd Pos-test
+
+printf "Position list and pack test:\n\n"
+cc -I.. -o pos-test pos-test.c -I../../local/include \
+    -L../../local/lib -Wl,-rpath,../../local/lib -lbiolibc -lxtend
+./pos-test > out.txt
+if diff correct.txt out.txt; then
+    printf "No differences found, test passed.\n"
+    rm -f pos-test out.txt
+else
+    printf "Differences found, test failed.\n"
+fi
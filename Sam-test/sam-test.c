@@ -0,0 +1,546 @@
+/***************************************************************************
+ *  Description:
+ *      Test sam.c functions
+ *
+ *  History: 
+ *  Date        Name        Modification
+ *  2026-10-17  agent       Begin
+ *  2026-10-17  agent       Add --spill mode for sam-buff.c
+ *  2026-10-17  agent       Add --depth-spill mode
+ ***************************************************************************/
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <sysexits.h>
+#include <inttypes.h>
+#include <xtend/string.h>   // strlcpy() on Linux
+#include "sam.h"
+#include "bam.h"
+#include "sam-buff.h"
+#include "vcf.h"
+#include "chrom-split.h"
+#include "chrom-dict.h"
+#include "pileup.h"
+#include "coverage.h"
+
+void    print_alignment(bl_sam_t *alignment, FILE *out);
+int     allele_depths(FILE *sam_stream, FILE *vcf_stream, FILE *out,
+		      size_t spill_max);
+int     chrom_allele_depths(FILE *inputs[], FILE *out, const char *chrom,
+			    void *arg);
+int     pileup(FILE *sam_stream, FILE *out);
+int     coverage(FILE *sam_stream, FILE *out, int format);
+int     spill(FILE *sam_stream, FILE *out, size_t max_alignments);
+
+int     main(int argc,char *argv[])
+
+{
+    bl_sam_t    alignment = BL_SAM_INIT;
+    sam_field_mask_t    mask = BL_SAM_FIELD_ALL;
+    bl_bam_t    bam, bam_out;
+    bl_chrom_dict_t dict = BL_CHROM_DICT_INIT;
+    bl_sam_buff_t   sam_buff;
+    bl_chrom_split_t    split;
+    FILE        *header, *sam_stream = stdin, *vcf_stream, *out = stdout;
+    char        *header_text, *write_file = NULL, *ext;
+    long        header_len;
+    int         arg = 1,
+		bam_input = 0,
+		bam_output = 0,
+		use_dict = 0,
+		span = 0,
+		status = EX_OK;
+    int64_t     offset,
+		ref_pos;
+    
+    // Sweep SAM input along sorted VCF calls, optionally in parallel
+    if ( ((argc == 3) && (strcmp(argv[1], "--depth") == 0)) ||
+	 ((argc == 4) && (strcmp(argv[1], "--depth-threads") == 0)) )
+    {
+	if ( (vcf_stream = fopen(argv[argc - 1], "r")) == NULL )
+	{
+	    fprintf(stderr, "%s: Cannot open %s.\n", argv[0], argv[argc - 1]);
+	    return EX_NOINPUT;
+	}
+	fclose(bl_vcf_skip_header(vcf_stream));
+	fclose(bl_sam_skip_header(sam_stream));
+	if ( argc == 3 )
+	    status = allele_depths(sam_stream, vcf_stream, out, 0);
+	else
+	{
+	    bl_chrom_split_init(&split);
+	    if ( (bl_chrom_split_add_input(&split, vcf_stream, 1)
+		    != BL_CHROM_SPLIT_OK) ||
+		 (bl_chrom_split_add_input(&split, sam_stream, 3)
+		    != BL_CHROM_SPLIT_OK) ||
+		 (bl_chrom_split_run(&split, chrom_allele_depths, NULL, out,
+				     strtoul(argv[2], NULL, 10))
+		    != BL_CHROM_SPLIT_OK) )
+		status = EX_DATAERR;
+	    bl_chrom_split_free(&split);
+	}
+	fclose(vcf_stream);
+	return status;
+    }
+    
+    // Report read bases at every covered position
+    if ( (argc == 2) && (strcmp(argv[1], "--pileup") == 0) )
+    {
+	fclose(bl_sam_skip_header(sam_stream));
+	return pileup(sam_stream, out);
+    }
+    
+    // Report run-length read depth as bedGraph or binary runs
+    if ( (argc == 2) && ((strcmp(argv[1], "--coverage") == 0) ||
+			 (strcmp(argv[1], "--coverage-binary") == 0)) )
+    {
+	fclose(bl_sam_skip_header(sam_stream));
+	return coverage(sam_stream, out, strcmp(argv[1], "--coverage") == 0 ?
+			BL_COVERAGE_FORMAT_BEDGRAPH : BL_COVERAGE_FORMAT_BINARY);
+    }
+    
+    // Allele depths with a spilling buffer too small for the read depth
+    if ( (argc == 4) && (strcmp(argv[1], "--depth-spill") == 0) )
+    {
+	if ( (vcf_stream = fopen(argv[3], "r")) == NULL )
+	{
+	    fprintf(stderr, "%s: Cannot open %s.\n", argv[0], argv[3]);
+	    return EX_NOINPUT;
+	}
+	fclose(bl_vcf_skip_header(vcf_stream));
+	fclose(bl_sam_skip_header(sam_stream));
+	status = allele_depths(sam_stream, vcf_stream, out,
+			       strtoul(argv[2], NULL, 10));
+	fclose(vcf_stream);
+	return status;
+    }
+    
+    // Pass alignments through a buffer too small to hold the window
+    if ( (argc == 3) && (strcmp(argv[1], "--spill") == 0) )
+    {
+	fclose(bl_sam_skip_header(sam_stream));
+	return spill(sam_stream, out, strtoul(argv[2], NULL, 10));
+    }
+    
+    // Report CIGAR reference spans and position mappings
+    if ( (argc > arg) && (strcmp(argv[arg], "--span") == 0) )
+    {
+	span = 1;
+	++arg;
+    }
+    if ( (argc > arg) && (strcmp(argv[arg], "--mask") == 0) )
+    {
+	mask = BL_SAM_FIELD_QNAME | BL_SAM_FIELD_POS | BL_SAM_FIELD_TLEN;
+	++arg;
+    }
+    // Intern RNAMEs and check sort order by chrom ID
+    if ( (argc > arg) && (strcmp(argv[arg], "--dict") == 0) )
+    {
+	use_dict = 1;
+	bl_sam_buff_init(&sam_buff, 0, 1000);
+	++arg;
+    }
+    if ( (argc > arg) && (strcmp(argv[arg], "--bam") == 0) )
+    {
+	bam_input = 1;
+	++arg;
+    }
+    // Exercise in-process BGZF and BAM output
+    if ( (argc > arg + 1) && (strcmp(argv[arg], "--write") == 0) )
+    {
+	write_file = argv[arg + 1];
+	ext = strrchr(write_file, '.');
+	bam_output = (ext != NULL) && (strcmp(ext, ".bam") == 0);
+	arg += 2;
+    }
+    
+    // Exercise in-process decompression of .gz files
+    if ( argc > arg )
+    {
+	if ( bam_input )
+	    sam_stream = fopen(argv[arg], "r");
+	else
+	    sam_stream = bl_sam_fopen(argv[arg], "r", NULL);
+	if ( sam_stream == NULL )
+	{
+	    fprintf(stderr, "%s: Cannot open %s.\n", argv[0], argv[arg]);
+	    return EX_NOINPUT;
+	}
+    }
+    
+    // Native BAM decoder, no samtools
+    if ( bam_input )
+    {
+	if ( bl_bam_open(&bam, sam_stream, 2) != BL_BAM_OK )
+	{
+	    fprintf(stderr, "%s: Invalid BAM input.\n", argv[0]);
+	    return EX_DATAERR;
+	}
+    }
+    else
+    {
+	header = bl_sam_skip_header(sam_stream);
+	if ( use_dict &&
+	     (bl_chrom_dict_load_sam_header(&dict, header) != BL_CHROM_DICT_OK) )
+	{
+	    fprintf(stderr, "%s: Cannot load @SQ lines.\n", argv[0]);
+	    return EX_DATAERR;
+	}
+	rewind(header);
+	if ( bam_output )
+	{
+	    fseek(header, 0L, SEEK_END);
+	    header_len = ftell(header);
+	    rewind(header);
+	    header_text = malloc(header_len + 1);
+	    header_text[fread(header_text, 1, header_len, header)] = '\0';
+	    if ( ((out = fopen(write_file, "w")) == NULL) ||
+		 (bl_bam_open_write(&bam_out, out, header_text, 2)
+		  != BL_BAM_OK) )
+	    {
+		fprintf(stderr, "%s: Cannot create %s.\n", argv[0], write_file);
+		return EX_CANTCREAT;
+	    }
+	    free(header_text);
+	}
+	fclose(header);
+    }
+    if ( (write_file != NULL) && ! bam_output &&
+	 ((out = bl_sam_fopen(write_file, "w", NULL)) == NULL) )
+    {
+	fprintf(stderr, "%s: Cannot create %s.\n", argv[0], write_file);
+	return EX_CANTCREAT;
+    }
+    
+    if ( use_dict )
+	bl_sam_set_chrom_dict(&alignment, &dict);
+    
+    while ( (bam_input ? bl_bam_read(&bam, &alignment, mask) :
+		bl_sam_read(&alignment, sam_stream, mask)) == BL_READ_OK )
+    {
+	if ( use_dict )
+	{
+	    if ( (BL_SAM_RNAME_ID(&alignment) != BL_CHROM_ID_NONE) &&
+		 (strcmp(BL_CHROM_DICT_NAMES_AE(&dict,
+			 BL_SAM_RNAME_ID(&alignment)),
+			 BL_SAM_RNAME(&alignment)) != 0) )
+	    {
+		fprintf(stderr, "%s: Wrong ID %" PRId32 " for %s.\n", argv[0],
+			BL_SAM_RNAME_ID(&alignment), BL_SAM_RNAME(&alignment));
+		return EX_SOFTWARE;
+	    }
+	    // Unmapped reads have no RNAME to order by
+	    if ( bam_output && (BL_SAM_RNAME_ID(&alignment) != BL_CHROM_ID_NONE) )
+		bl_sam_buff_check_order(&sam_buff, &alignment);
+	}
+	
+	/*
+	 *  Pass mapped reads through a 2-deep window of the ring buffer
+	 *  by moving, checking sort order on the way in.  Flush the window
+	 *  ahead of unmapped reads so output order matches input.
+	 */
+	if ( use_dict && ! bam_output )
+	{
+	    if ( BL_SAM_RNAME_ID(&alignment) != BL_CHROM_ID_NONE )
+	    {
+		if ( bl_sam_buff_move_alignment(&sam_buff, &alignment)
+		     != BL_SAM_BUFF_OK )
+		    return EX_DATAERR;
+		if ( BL_SAM_BUFF_BUFFERED_COUNT(&sam_buff) == 2 )
+		{
+		    print_alignment(BL_SAM_BUFF_ALIGNMENTS_AE(&sam_buff, 0), out);
+		    bl_sam_buff_shift(&sam_buff, 1);
+		}
+		continue;
+	    }
+	    while ( BL_SAM_BUFF_BUFFERED_COUNT(&sam_buff) > 0 )
+	    {
+		print_alignment(BL_SAM_BUFF_ALIGNMENTS_AE(&sam_buff, 0), out);
+		bl_sam_buff_shift(&sam_buff, 1);
+	    }
+	}
+	
+	if ( span )
+	{
+	    fprintf(out, "%s\t%" PRId64 "\t%" PRId64 "\tref->query",
+		    BL_SAM_QNAME(&alignment), BL_SAM_POS(&alignment),
+		    BL_SAM_REF_END(&alignment));
+	    for (ref_pos = BL_SAM_POS(&alignment) - 1;
+		 ref_pos <= BL_SAM_REF_END(&alignment) + 1; ++ref_pos)
+		fprintf(out, " %" PRId64,
+			bl_sam_ref_to_query(&alignment, ref_pos));
+	    fprintf(out, "\tquery->ref");
+	    for (offset = 0; offset <= (int64_t)BL_SAM_SEQ_LEN(&alignment);
+		 ++offset)
+		fprintf(out, " %" PRId64,
+			bl_sam_query_to_ref(&alignment, offset));
+	    putc('\n', out);
+	    continue;
+	}
+	
+	if ( bam_output )
+	{
+	    if ( bl_bam_write(&bam_out, &alignment, mask) != BL_WRITE_OK )
+		return EX_IOERR;
+	    continue;
+	}
+	
+	print_alignment(&alignment, out);
+    }
+    if ( use_dict )
+    {
+	while ( BL_SAM_BUFF_BUFFERED_COUNT(&sam_buff) > 0 )
+	{
+	    print_alignment(BL_SAM_BUFF_ALIGNMENTS_AE(&sam_buff, 0), out);
+	    bl_sam_buff_shift(&sam_buff, 1);
+	}
+	bl_sam_buff_free(&sam_buff);
+    }
+    bl_sam_free(&alignment);
+    bl_chrom_dict_free(&dict);
+    if ( bam_input )
+	bl_bam_close(&bam);
+    if ( bam_output )
+    {
+	if ( bl_bam_close(&bam_out) != BL_BAM_OK )
+	    return EX_IOERR;
+	fclose(out);
+    }
+    else if ( (out != stdout) && (bl_sam_fclose(out) != 0) )
+	return EX_IOERR;
+    if ( sam_stream != stdin )
+	bl_sam_fclose(sam_stream);
+    return EX_OK;
+}
+
+
+/*
+ *  Print the 11 mandatory fields as read.  Masked fields are
+ *  printed as stored, i.e. 0 or empty.
+ */
+
+void    print_alignment(bl_sam_t *alignment, FILE *out)
+
+{
+    fprintf(out, "%s\t%u\t%s\t%" PRId64 "\t%u\t", BL_SAM_QNAME(alignment),
+	    BL_SAM_FLAG(alignment), BL_SAM_RNAME(alignment),
+	    BL_SAM_POS(alignment), BL_SAM_MAPQ(alignment));
+    if ( BL_SAM_CIGAR_LEN(alignment) > 0 )
+	fwrite(BL_SAM_CIGAR(alignment), 1, BL_SAM_CIGAR_LEN(alignment), out);
+    fprintf(out, "\t%s\t%" PRId64 "\t%ld\t", BL_SAM_RNEXT(alignment),
+	    BL_SAM_PNEXT(alignment), BL_SAM_TLEN(alignment));
+    if ( BL_SAM_SEQ_LEN(alignment) > 0 )
+	fwrite(BL_SAM_SEQ(alignment), 1, BL_SAM_SEQ_LEN(alignment), out);
+    putc('\t', out);
+    if ( BL_SAM_QUAL_LEN(alignment) > 0 )
+	fwrite(BL_SAM_QUAL(alignment), 1, BL_SAM_QUAL_LEN(alignment), out);
+    putc('\n', out);
+}
+
+
+/*
+ *  Report allele depths and PHRED scores for each VCF call, discarding
+ *  alignments with MAPQ below 10.  Both streams are past their headers.
+ *  If spill_max is not 0, the buffer holds spill_max alignments and
+ *  spills the rest.
+ */
+
+int     allele_depths(FILE *sam_stream, FILE *vcf_stream, FILE *out,
+		      size_t spill_max)
+
+{
+    bl_vcf_t        vcf_call;
+    bl_sam_buff_t   sam_buff;
+    int             status = EX_OK;
+    
+    bl_vcf_init(&vcf_call);
+    if ( spill_max == 0 )
+	bl_sam_buff_init(&sam_buff, 10, 1000);
+    else
+    {
+	bl_sam_buff_init(&sam_buff, 10, spill_max);
+	bl_sam_buff_set_overflow_mode(&sam_buff, BL_SAM_BUFF_OVERFLOW_SPILL);
+    }
+    while ( bl_vcf_read_ss_call(&vcf_call, vcf_stream, BL_VCF_FIELD_ALL)
+	    == BL_READ_OK )
+    {
+	if ( bl_vcf_allele_depths(&vcf_call, &sam_buff, sam_stream)
+	     != BL_READ_OK )
+	{
+	    status = EX_DATAERR;
+	    break;
+	}
+	fprintf(out, "%s\t%" PRId64 "\t%s\t%s\t%u\t%u\t%u\t%s\n",
+		BL_VCF_CHROM(&vcf_call), BL_VCF_POS(&vcf_call),
+		BL_VCF_REF(&vcf_call), BL_VCF_ALT(&vcf_call),
+		BL_VCF_REF_COUNT(&vcf_call), BL_VCF_ALT_COUNT(&vcf_call),
+		BL_VCF_OTHER_COUNT(&vcf_call),
+		BL_VCF_PHRED_COUNT(&vcf_call) > 0 ?
+		(char *)BL_VCF_PHREDS(&vcf_call) : ".");
+    }
+    bl_sam_buff_free(&sam_buff);
+    bl_vcf_free(&vcf_call);
+    return status;
+}
+
+
+/*
+ *  Worker for bl_chrom_split_run(): inputs[0] holds one chromosome of
+ *  VCF calls and inputs[1] the matching SAM alignments.
+ */
+
+int     chrom_allele_depths(FILE *inputs[], FILE *out, const char *chrom,
+			    void *arg)
+
+{
+    return allele_depths(inputs[1], inputs[0], out, 0);
+}
+
+
+/*
+ *  Report depth, bases, quals and deletions at each position covered by
+ *  alignments with MAPQ >= 10.  sam_stream is past its header.
+ */
+
+int     pileup(FILE *sam_stream, FILE *out)
+
+{
+    bl_pileup_t     pileup;
+    bl_sam_buff_t   sam_buff;
+    size_t          c;
+    int             status;
+    
+    bl_sam_buff_init(&sam_buff, 10, 1000);
+    bl_pileup_init(&pileup, &sam_buff, sam_stream);
+    while ( (status = bl_pileup_next(&pileup)) == BL_READ_OK )
+    {
+	fprintf(out, "%s\t%" PRId64 "\t%zu\t%.*s\t",
+		BL_PILEUP_CHROM(&pileup), BL_PILEUP_POS(&pileup),
+		BL_PILEUP_DEPTH(&pileup), (int)BL_PILEUP_DEPTH(&pileup),
+		BL_PILEUP_BASES(&pileup));
+	for (c = 0; c < BL_PILEUP_DEPTH(&pileup); ++c)
+	    putc(BL_PILEUP_QUALS_AE(&pileup, c) == BL_PILEUP_QUAL_NONE ?
+		 '*' : BL_PILEUP_QUALS_AE(&pileup, c), out);
+	fprintf(out, "\t%zu\n", BL_PILEUP_DELETIONS(&pileup));
+    }
+    bl_pileup_free(&pileup);
+    bl_sam_buff_free(&sam_buff);
+    return status == BL_READ_EOF ? EX_OK : EX_DATAERR;
+}
+
+
+/*
+ *  Report depth of alignments with MAPQ >= 10 in the given format.
+ *  Binary runs are converted back to text, to check both paths against
+ *  the same output.  sam_stream is past its header.
+ */
+
+int     coverage(FILE *sam_stream, FILE *out, int format)
+
+{
+    bl_coverage_t       coverage;
+    bl_coverage_run_t   run;
+    bl_sam_t            alignment = BL_SAM_INIT;
+    FILE                *runs_stream;
+    char                chroms[16][BL_SAM_RNAME_MAX_CHARS + 1];
+    int                 status = EX_OK;
+    
+    if ( (runs_stream = format == BL_COVERAGE_FORMAT_BINARY ?
+			tmpfile() : out) == NULL )
+	return EX_CANTCREAT;
+    bl_coverage_init(&coverage, runs_stream, format);
+    while ( bl_sam_read(&alignment, sam_stream, BL_SAM_FIELD_ALL)
+	    == BL_READ_OK )
+    {
+	if ( BL_SAM_MAPQ(&alignment) < 10 )
+	    continue;
+	if ( bl_coverage_add(&coverage, &alignment) != BL_COVERAGE_OK )
+	{
+	    status = EX_DATAERR;
+	    break;
+	}
+	if ( BL_COVERAGE_CHROM_INDEX(&coverage) < 16 )
+	    strlcpy(chroms[BL_COVERAGE_CHROM_INDEX(&coverage)],
+		    BL_SAM_RNAME(&alignment), BL_SAM_RNAME_MAX_CHARS + 1);
+    }
+    if ( bl_coverage_finish(&coverage) != BL_COVERAGE_OK )
+	status = EX_IOERR;
+    bl_coverage_free(&coverage);
+    bl_sam_free(&alignment);
+    
+    if ( format == BL_COVERAGE_FORMAT_BINARY )
+    {
+	rewind(runs_stream);
+	while ( fread(&run, sizeof(run), 1, runs_stream) == 1 )
+	    fprintf(out, "%s\t%" PRId64 "\t%" PRId64 "\t%" PRIu32 "\n",
+		    run.chrom_index < 16 ? chroms[run.chrom_index] : "?",
+		    run.start, run.end, run.depth);
+	fclose(runs_stream);
+    }
+    return status;
+}
+
+
+/*
+ *  Hold a window of 2 * max_alignments + 1 alignments in a SAM buffer
+ *  limited to max_alignments, so the rest go to the spill file.  Printing
+ *  and shifting the oldest pages spilled alignments back in between
+ *  spills, so output must match a run without the buffer.  As in
+ *  --dict mode, the window is flushed ahead of unmapped reads, which
+ *  have no position to check sort order by.
+ */
+
+int     spill(FILE *sam_stream, FILE *out, size_t max_alignments)
+
+{
+    bl_sam_buff_t   sam_buff;
+    bl_sam_t        alignment = BL_SAM_INIT;
+    size_t          window = 2 * max_alignments + 1;
+    int             status = EX_OK;
+    
+    bl_sam_buff_init(&sam_buff, 0, max_alignments);
+    bl_sam_buff_set_overflow_mode(&sam_buff, BL_SAM_BUFF_OVERFLOW_SPILL);
+    while ( bl_sam_read(&alignment, sam_stream, BL_SAM_FIELD_ALL)
+	    == BL_READ_OK )
+    {
+	if ( strcmp(BL_SAM_RNAME(&alignment), "*") == 0 )
+	{
+	    while ( BL_SAM_BUFF_BUFFERED_COUNT(&sam_buff) > 0 )
+	    {
+		print_alignment(BL_SAM_BUFF_ALIGNMENTS_AE(&sam_buff, 0), out);
+		bl_sam_buff_shift(&sam_buff, 1);
+	    }
+	    print_alignment(&alignment, out);
+	    continue;
+	}
+	if ( bl_sam_buff_add_alignment(&sam_buff, &alignment)
+	     != BL_SAM_BUFF_OK )
+	{
+	    status = EX_DATAERR;
+	    break;
+	}
+	if ( BL_SAM_BUFF_BUFFERED_COUNT(&sam_buff) +
+	     BL_SAM_BUFF_SPILL_COUNT(&sam_buff) == window )
+	{
+	    print_alignment(BL_SAM_BUFF_ALIGNMENTS_AE(&sam_buff, 0), out);
+	    bl_sam_buff_shift(&sam_buff, 1);
+	}
+    }
+    while ( BL_SAM_BUFF_BUFFERED_COUNT(&sam_buff) > 0 )
+    {
+	print_alignment(BL_SAM_BUFF_ALIGNMENTS_AE(&sam_buff, 0), out);
+	bl_sam_buff_shift(&sam_buff, 1);
+    }
+    
+    // Make sure the test actually spilled
+    if ( (status == EX_OK) && (max_alignments > 0) &&
+	 (BL_SAM_BUFF_MAX_SPILL_COUNT(&sam_buff) == 0) )
+    {
+	fputs("spill(): Input too small to spill.\n", stderr);
+	status = EX_DATAERR;
+    }
+    bl_sam_buff_free(&sam_buff);
+    bl_sam_free(&alignment);
+    return status;
+}
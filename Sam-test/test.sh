@@ -0,0 +1,156 @@
+#!/bin/sh -e
+
+if [ $0 != ./test.sh ]; then
+    printf "Must be run as ./test.sh.\n"
+    exit 1
+fi
+
+cd ..
+./cave-man-install.sh
+cd Sam-test
+
+printf "SAM test:\n\n"
+cc -I.. -o sam-test sam-test.c -I../../local/include \
+    -L../../local/lib -Wl,-rpath,../../local/lib -lbiolibc -lxtend -lz -lpthread
+./sam-test < test.sam > out.sam
+if diff correct.sam out.sam; then
+    printf "No differences found, test passed.\n"
+else
+    printf "Differences found, test failed.\n"
+fi
+
+printf "\n===\nMasked fields...\n"
+./sam-test --mask < test.sam > out.sam
+if diff mask-correct.sam out.sam; then
+    printf "No differences found, test passed.\n"
+else
+    printf "Differences found, test failed.\n"
+fi
+
+for file in test.sam.gz test-bgzf.sam.gz; do
+    printf "\n===\nCompressed input $file...\n"
+    ./sam-test $file > out.sam
+    if diff correct.sam out.sam; then
+	printf "No differences found, test passed.\n"
+    else
+	printf "Differences found, test failed.\n"
+    fi
+done
+
+printf "\n===\nNative BAM decoder...\n"
+./sam-test --bam test.bam > out.sam
+if diff correct.sam out.sam; then
+    printf "No differences found, test passed.\n"
+else
+    printf "Differences found, test failed.\n"
+fi
+
+printf "\n===\nNative BAM decoder, masked fields...\n"
+./sam-test --mask --bam test.bam > out.sam
+if diff mask-correct.sam out.sam; then
+    printf "No differences found, test passed.\n"
+else
+    printf "Differences found, test failed.\n"
+fi
+
+printf "\n===\nChromosome dictionary and SAM buffer...\n"
+./sam-test --dict < test.sam > out.sam
+if diff correct.sam out.sam; then
+    printf "No differences found, test passed.\n"
+else
+    printf "Differences found, test failed.\n"
+fi
+
+printf "\n===\nChromosome dictionary, BAM input...\n"
+./sam-test --dict --bam test.bam > out.sam
+if diff correct.sam out.sam; then
+    printf "No differences found, test passed.\n"
+else
+    printf "Differences found, test failed.\n"
+fi
+
+printf "\n===\nCIGAR reference spans...\n"
+./sam-test --span < cigar.sam > out.txt
+if diff span-correct.txt out.txt; then
+    printf "No differences found, test passed.\n"
+else
+    printf "Differences found, test failed.\n"
+fi
+
+printf "\n===\nVCF allele depths...\n"
+./sam-test --depth depth.vcf < depth.sam > out.txt
+if diff depth-correct.txt out.txt; then
+    printf "No differences found, test passed.\n"
+else
+    printf "Differences found, test failed.\n"
+fi
+
+printf "\n===\nVCF allele depths, spilled alignments...\n"
+if ./sam-test --depth-spill 1 depth.vcf < depth.sam > out.txt 2> /dev/null; then
+    printf "Spilled alignments not reported, test failed.\n"
+else
+    printf "Overflow reported, test passed.\n"
+fi
+
+printf "\n===\nVCF allele depths, spill mode without spilling...\n"
+./sam-test --depth-spill 1000 depth.vcf < depth.sam > out.txt
+if diff depth-correct.txt out.txt; then
+    printf "No differences found, test passed.\n"
+else
+    printf "Differences found, test failed.\n"
+fi
+
+printf "\n===\nVCF allele depths, parallel by chromosome...\n"
+./sam-test --depth-threads 3 depth.vcf < depth.sam > out.txt
+if diff depth-correct.txt out.txt; then
+    printf "No differences found, test passed.\n"
+else
+    printf "Differences found, test failed.\n"
+fi
+
+printf "\n===\nPileup...\n"
+./sam-test --pileup < depth.sam > out.txt
+if diff pileup-correct.txt out.txt; then
+    printf "No differences found, test passed.\n"
+else
+    printf "Differences found, test failed.\n"
+fi
+
+for format in coverage coverage-binary; do
+    printf "\n===\nRun-length coverage, $format...\n"
+    ./sam-test --$format < depth.sam > out.txt
+    if diff coverage-correct.txt out.txt; then
+	printf "No differences found, test passed.\n"
+    else
+	printf "Differences found, test failed.\n"
+    fi
+done
+
+printf "\n===\nSAM buffer spilling to disk...\n"
+./sam-test < depth.sam > out-nospill.sam
+./sam-test --spill 1 < depth.sam > out.sam
+if diff out-nospill.sam out.sam; then
+    printf "No differences found, test passed.\n"
+else
+    printf "Differences found, test failed.\n"
+fi
+
+printf "\n===\nBGZF output...\n"
+./sam-test --write out.sam.gz < test.sam
+./sam-test out.sam.gz > out.sam
+if diff correct.sam out.sam && gzip -dc out.sam.gz | diff -q correct.sam -; then
+    printf "No differences found, test passed.\n"
+else
+    printf "Differences found, test failed.\n"
+fi
+
+printf "\n===\nNative BAM encoder...\n"
+./sam-test --write out.bam < test.sam
+./sam-test --bam out.bam > out.sam
+if diff correct.sam out.sam; then
+    printf "No differences found, test passed.\n"
+else
+    printf "Differences found, test failed.\n"
+fi
+
+rm -f sam-test out.txt out.sam out-nospill.sam out.sam.gz out.bam
@@ -0,0 +1,23 @@
+    
+/*
+ *  Generated by /usr/local/bin/auto-gen-get-set
+ *
+ *  Accessor macros.  Use these to access structure members from functions
+ *  outside the bl_bam_t class.
+ *
+ *  These generated macros are not expected to be perfect.  Check and edit
+ *  as needed before adding to your code.
+ */
+
+#define BL_BAM_HEADER(ptr)              ((ptr)->header)
+#define BL_BAM_HEADER_AE(ptr,c)         ((ptr)->header[c])
+#define BL_BAM_HEADER_LEN(ptr)          ((ptr)->header_len)
+#define BL_BAM_REF_COUNT(ptr)           ((ptr)->ref_count)
+#define BL_BAM_REF_NAMES(ptr)           ((ptr)->ref_names)
+#define BL_BAM_REF_NAMES_AE(ptr,c)      ((ptr)->ref_names[c])
+#define BL_BAM_REF_LENGTHS(ptr)         ((ptr)->ref_lengths)
+#define BL_BAM_REF_LENGTHS_AE(ptr,c)    ((ptr)->ref_lengths[c])
+#define BL_BAM_RECORD(ptr)              ((ptr)->record)
+#define BL_BAM_RECORD_AE(ptr,c)         ((ptr)->record[c])
+#define BL_BAM_RECORD_ARRAY_SIZE(ptr)   ((ptr)->record_array_size)
+#define BL_BAM_REF_HINT(ptr)            ((ptr)->ref_hint)
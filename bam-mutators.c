@@ -0,0 +1,903 @@
+/***************************************************************************
+ *  This file is automatically generated by gen-get-set.  Be sure to keep
+ *  track of any manual changes.
+ *
+ *  These generated functions are not expected to be perfect.  Check and
+ *  edit as needed before adding to your code.
+ ***************************************************************************/
+
+#include <string.h>
+#include <ctype.h>
+#include <stdbool.h>        // In case of bool
+#include <stdint.h>         // In case of int64_t, etc
+#include <xtend/string.h>   // strlcpy() on Linux
+#include "bam.h"
+
+
+/***************************************************************************
+ *  Library:
+ *      #include <biolibc/bam.h>
+ *      -lbiolibc -lxtend
+ *
+ *  Description:
+ *      Mutator for header member in a bl_bam_t structure.
+ *      Use this function to set header in a bl_bam_t object
+ *      from non-member functions.  This function performs a direct
+ *      assignment for scalar or pointer structure members.  If
+ *      header is a pointer, data previously pointed to should
+ *      be freed before calling this function to avoid memory
+ *      leaks.
+ *
+ *  Arguments:
+ *      bl_bam_ptr      Pointer to the structure to set
+ *      new_header      The new value for header
+ *
+ *  Returns:
+ *      BL_BAM_DATA_OK if the new value is acceptable and assigned
+ *      BL_BAM_DATA_OUT_OF_RANGE otherwise
+ *
+ *  Examples:
+ *      bl_bam_t        bl_bam;
+ *      char *          new_header;
+ *
+ *      if ( bl_bam_set_header(&bl_bam, new_header)
+ *              == BL_BAM_DATA_OK )
+ *      {
+ *      }
+ *
+ *  See also:
+ *      (3)
+ *
+ *  History: 
+ *  Date        Name        Modification
+ *  2026-10-17  gen-get-set Auto-generated from bam.h
+ ***************************************************************************/
+
+int     bl_bam_set_header(
+	    bl_bam_t *bl_bam_ptr,
+	    char *new_header
+	)
+
+{
+    if ( new_header == NULL )
+	return BL_BAM_DATA_OUT_OF_RANGE;
+    else
+    {
+	bl_bam_ptr->header = new_header;
+	return BL_BAM_DATA_OK;
+    }
+}
+
+
+/***************************************************************************
+ *  Library:
+ *      #include <biolibc/bam.h>
+ *      -lbiolibc -lxtend
+ *
+ *  Description:
+ *      Mutator for an array element of header member in a bl_bam_t
+ *      structure. Use this function to set bl_bam_ptr->header[c]
+ *      in a bl_bam_t object from non-member functions.
+ *
+ *  Arguments:
+ *      bl_bam_ptr      Pointer to the structure to set
+ *      c               Subscript to the header array
+ *      new_header_element The new value for header[c]
+ *
+ *  Returns:
+ *      BL_BAM_DATA_OK if the new value is acceptable and assigned
+ *      BL_BAM_DATA_OUT_OF_RANGE otherwise
+ *
+ *  Examples:
+ *      bl_bam_t        bl_bam;
+ *      size_t          c;
+ *      char            new_header_element;
+ *
+ *      if ( bl_bam_set_header_ae(&bl_bam, c, new_header_element)
+ *              == BL_BAM_DATA_OK )
+ *      {
+ *      }
+ *
+ *  See also:
+ *      BL_BAM_SET_HEADER_AE(3)
+ *
+ *  History: 
+ *  Date        Name        Modification
+ *  2026-10-17  gen-get-set Auto-generated from bam.h
+ ***************************************************************************/
+
+int     bl_bam_set_header_ae(
+	    bl_bam_t *bl_bam_ptr,
+	    size_t c,
+	    char new_header_element
+	)
+
+{
+    if ( false )
+	return BL_BAM_DATA_OUT_OF_RANGE;
+    else
+    {
+	bl_bam_ptr->header[c] = new_header_element;
+	return BL_BAM_DATA_OK;
+    }
+}
+
+
+/***************************************************************************
+ *  Library:
+ *      #include <biolibc/bam.h>
+ *      -lbiolibc -lxtend
+ *
+ *  Description:
+ *      Mutator for header member in a bl_bam_t structure.
+ *      Use this function to set header in a bl_bam_t object
+ *      from non-member functions.  This function copies the array pointed to
+ *      by new_header to bl_bam_ptr->header.
+ *
+ *  Arguments:
+ *      bl_bam_ptr      Pointer to the structure to set
+ *      new_header      The new value for header
+ *      array_size      Size of the header array.
+ *
+ *  Returns:
+ *      BL_BAM_DATA_OK if the new value is acceptable and assigned
+ *      BL_BAM_DATA_OUT_OF_RANGE otherwise
+ *
+ *  Examples:
+ *      bl_bam_t        bl_bam;
+ *      char *          new_header;
+ *      size_t          array_size;
+ *
+ *      if ( bl_bam_set_header_cpy(&bl_bam, new_header, array_size)
+ *              == BL_BAM_DATA_OK )
+ *      {
+ *      }
+ *
+ *  See also:
+ *      BL_BAM_SET_HEADER(3)
+ *
+ *  History: 
+ *  Date        Name        Modification
+ *  2026-10-17  gen-get-set Auto-generated from bam.h
+ ***************************************************************************/
+
+int     bl_bam_set_header_cpy(
+	    bl_bam_t *bl_bam_ptr,
+	    char *new_header,
+	    size_t array_size
+	)
+
+{
+    if ( new_header == NULL )
+	return BL_BAM_DATA_OUT_OF_RANGE;
+    else
+    {
+	// FIXME: Assuming char array is a null-terminated string
+	strlcpy(bl_bam_ptr->header, new_header, array_size);
+	return BL_BAM_DATA_OK;
+    }
+}
+
+
+/***************************************************************************
+ *  Library:
+ *      #include <biolibc/bam.h>
+ *      -lbiolibc -lxtend
+ *
+ *  Description:
+ *      Mutator for header_len member in a bl_bam_t structure.
+ *      Use this function to set header_len in a bl_bam_t object
+ *      from non-member functions.  This function performs a direct
+ *      assignment for scalar or pointer structure members.  If
+ *      header_len is a pointer, data previously pointed to should
+ *      be freed before calling this function to avoid memory
+ *      leaks.
+ *
+ *  Arguments:
+ *      bl_bam_ptr      Pointer to the structure to set
+ *      new_header_len  The new value for header_len
+ *
+ *  Returns:
+ *      BL_BAM_DATA_OK if the new value is acceptable and assigned
+ *      BL_BAM_DATA_OUT_OF_RANGE otherwise
+ *
+ *  Examples:
+ *      bl_bam_t        bl_bam;
+ *      size_t          new_header_len;
+ *
+ *      if ( bl_bam_set_header_len(&bl_bam, new_header_len)
+ *              == BL_BAM_DATA_OK )
+ *      {
+ *      }
+ *
+ *  See also:
+ *      (3)
+ *
+ *  History: 
+ *  Date        Name        Modification
+ *  2026-10-17  gen-get-set Auto-generated from bam.h
+ ***************************************************************************/
+
+int     bl_bam_set_header_len(
+	    bl_bam_t *bl_bam_ptr,
+	    size_t new_header_len
+	)
+
+{
+    if ( false )
+	return BL_BAM_DATA_OUT_OF_RANGE;
+    else
+    {
+	bl_bam_ptr->header_len = new_header_len;
+	return BL_BAM_DATA_OK;
+    }
+}
+
+
+/***************************************************************************
+ *  Library:
+ *      #include <biolibc/bam.h>
+ *      -lbiolibc -lxtend
+ *
+ *  Description:
+ *      Mutator for ref_count member in a bl_bam_t structure.
+ *      Use this function to set ref_count in a bl_bam_t object
+ *      from non-member functions.  This function performs a direct
+ *      assignment for scalar or pointer structure members.  If
+ *      ref_count is a pointer, data previously pointed to should
+ *      be freed before calling this function to avoid memory
+ *      leaks.
+ *
+ *  Arguments:
+ *      bl_bam_ptr      Pointer to the structure to set
+ *      new_ref_count   The new value for ref_count
+ *
+ *  Returns:
+ *      BL_BAM_DATA_OK if the new value is acceptable and assigned
+ *      BL_BAM_DATA_OUT_OF_RANGE otherwise
+ *
+ *  Examples:
+ *      bl_bam_t        bl_bam;
+ *      size_t          new_ref_count;
+ *
+ *      if ( bl_bam_set_ref_count(&bl_bam, new_ref_count)
+ *              == BL_BAM_DATA_OK )
+ *      {
+ *      }
+ *
+ *  See also:
+ *      (3)
+ *
+ *  History: 
+ *  Date        Name        Modification
+ *  2026-10-17  gen-get-set Auto-generated from bam.h
+ ***************************************************************************/
+
+int     bl_bam_set_ref_count(
+	    bl_bam_t *bl_bam_ptr,
+	    size_t new_ref_count
+	)
+
+{
+    if ( false )
+	return BL_BAM_DATA_OUT_OF_RANGE;
+    else
+    {
+	bl_bam_ptr->ref_count = new_ref_count;
+	return BL_BAM_DATA_OK;
+    }
+}
+
+
+/***************************************************************************
+ *  Library:
+ *      #include <biolibc/bam.h>
+ *      -lbiolibc -lxtend
+ *
+ *  Description:
+ *      Mutator for ref_names member in a bl_bam_t structure.
+ *      Use this function to set ref_names in a bl_bam_t object
+ *      from non-member functions.  This function performs a direct
+ *      assignment for scalar or pointer structure members.  If
+ *      ref_names is a pointer, data previously pointed to should
+ *      be freed before calling this function to avoid memory
+ *      leaks.
+ *
+ *  Arguments:
+ *      bl_bam_ptr      Pointer to the structure to set
+ *      new_ref_names   The new value for ref_names
+ *
+ *  Returns:
+ *      BL_BAM_DATA_OK if the new value is acceptable and assigned
+ *      BL_BAM_DATA_OUT_OF_RANGE otherwise
+ *
+ *  Examples:
+ *      bl_bam_t        bl_bam;
+ *      char **         new_ref_names;
+ *
+ *      if ( bl_bam_set_ref_names(&bl_bam, new_ref_names)
+ *              == BL_BAM_DATA_OK )
+ *      {
+ *      }
+ *
+ *  See also:
+ *      (3)
+ *
+ *  History: 
+ *  Date        Name        Modification
+ *  2026-10-17  gen-get-set Auto-generated from bam.h
+ ***************************************************************************/
+
+int     bl_bam_set_ref_names(
+	    bl_bam_t *bl_bam_ptr,
+	    char **new_ref_names
+	)
+
+{
+    if ( new_ref_names == NULL )
+	return BL_BAM_DATA_OUT_OF_RANGE;
+    else
+    {
+	bl_bam_ptr->ref_names = new_ref_names;
+	return BL_BAM_DATA_OK;
+    }
+}
+
+
+/***************************************************************************
+ *  Library:
+ *      #include <biolibc/bam.h>
+ *      -lbiolibc -lxtend
+ *
+ *  Description:
+ *      Mutator for an array element of ref_names member in a bl_bam_t
+ *      structure. Use this function to set bl_bam_ptr->ref_names[c]
+ *      in a bl_bam_t object from non-member functions.
+ *
+ *  Arguments:
+ *      bl_bam_ptr      Pointer to the structure to set
+ *      c               Subscript to the ref_names array
+ *      new_ref_names_element The new value for ref_names[c]
+ *
+ *  Returns:
+ *      BL_BAM_DATA_OK if the new value is acceptable and assigned
+ *      BL_BAM_DATA_OUT_OF_RANGE otherwise
+ *
+ *  Examples:
+ *      bl_bam_t        bl_bam;
+ *      size_t          c;
+ *      char *          new_ref_names_element;
+ *
+ *      if ( bl_bam_set_ref_names_ae(&bl_bam, c, new_ref_names_element)
+ *              == BL_BAM_DATA_OK )
+ *      {
+ *      }
+ *
+ *  See also:
+ *      BL_BAM_SET_REF_NAMES_AE(3)
+ *
+ *  History: 
+ *  Date        Name        Modification
+ *  2026-10-17  gen-get-set Auto-generated from bam.h
+ ***************************************************************************/
+
+int     bl_bam_set_ref_names_ae(
+	    bl_bam_t *bl_bam_ptr,
+	    size_t c,
+	    char *new_ref_names_element
+	)
+
+{
+    if ( false )
+	return BL_BAM_DATA_OUT_OF_RANGE;
+    else
+    {
+	bl_bam_ptr->ref_names[c] = new_ref_names_element;
+	return BL_BAM_DATA_OK;
+    }
+}
+
+
+/***************************************************************************
+ *  Library:
+ *      #include <biolibc/bam.h>
+ *      -lbiolibc -lxtend
+ *
+ *  Description:
+ *      Mutator for ref_names member in a bl_bam_t structure.
+ *      Use this function to set ref_names in a bl_bam_t object
+ *      from non-member functions.  This function copies the array pointed to
+ *      by new_ref_names to bl_bam_ptr->ref_names.
+ *
+ *  Arguments:
+ *      bl_bam_ptr      Pointer to the structure to set
+ *      new_ref_names   The new value for ref_names
+ *      array_size      Size of the ref_names array.
+ *
+ *  Returns:
+ *      BL_BAM_DATA_OK if the new value is acceptable and assigned
+ *      BL_BAM_DATA_OUT_OF_RANGE otherwise
+ *
+ *  Examples:
+ *      bl_bam_t        bl_bam;
+ *      char **         new_ref_names;
+ *      size_t          array_size;
+ *
+ *      if ( bl_bam_set_ref_names_cpy(&bl_bam, new_ref_names, array_size)
+ *              == BL_BAM_DATA_OK )
+ *      {
+ *      }
+ *
+ *  See also:
+ *      BL_BAM_SET_REF_NAMES(3)
+ *
+ *  History: 
+ *  Date        Name        Modification
+ *  2026-10-17  gen-get-set Auto-generated from bam.h
+ ***************************************************************************/
+
+int     bl_bam_set_ref_names_cpy(
+	    bl_bam_t *bl_bam_ptr,
+	    char **new_ref_names,
+	    size_t array_size
+	)
+
+{
+    if ( new_ref_names == NULL )
+	return BL_BAM_DATA_OUT_OF_RANGE;
+    else
+    {
+	size_t  c;
+	
+	// FIXME: Assuming all elements should be copied
+	for (c = 0; c < array_size; ++c)
+	    bl_bam_ptr->ref_names[c] = new_ref_names[c];
+	return BL_BAM_DATA_OK;
+    }
+}
+
+
+/***************************************************************************
+ *  Library:
+ *      #include <biolibc/bam.h>
+ *      -lbiolibc -lxtend
+ *
+ *  Description:
+ *      Mutator for ref_lengths member in a bl_bam_t structure.
+ *      Use this function to set ref_lengths in a bl_bam_t object
+ *      from non-member functions.  This function performs a direct
+ *      assignment for scalar or pointer structure members.  If
+ *      ref_lengths is a pointer, data previously pointed to should
+ *      be freed before calling this function to avoid memory
+ *      leaks.
+ *
+ *  Arguments:
+ *      bl_bam_ptr      Pointer to the structure to set
+ *      new_ref_lengths The new value for ref_lengths
+ *
+ *  Returns:
+ *      BL_BAM_DATA_OK if the new value is acceptable and assigned
+ *      BL_BAM_DATA_OUT_OF_RANGE otherwise
+ *
+ *  Examples:
+ *      bl_bam_t        bl_bam;
+ *      int64_t *       new_ref_lengths;
+ *
+ *      if ( bl_bam_set_ref_lengths(&bl_bam, new_ref_lengths)
+ *              == BL_BAM_DATA_OK )
+ *      {
+ *      }
+ *
+ *  See also:
+ *      (3)
+ *
+ *  History: 
+ *  Date        Name        Modification
+ *  2026-10-17  gen-get-set Auto-generated from bam.h
+ ***************************************************************************/
+
+int     bl_bam_set_ref_lengths(
+	    bl_bam_t *bl_bam_ptr,
+	    int64_t *new_ref_lengths
+	)
+
+{
+    if ( new_ref_lengths == NULL )
+	return BL_BAM_DATA_OUT_OF_RANGE;
+    else
+    {
+	bl_bam_ptr->ref_lengths = new_ref_lengths;
+	return BL_BAM_DATA_OK;
+    }
+}
+
+
+/***************************************************************************
+ *  Library:
+ *      #include <biolibc/bam.h>
+ *      -lbiolibc -lxtend
+ *
+ *  Description:
+ *      Mutator for an array element of ref_lengths member in a bl_bam_t
+ *      structure. Use this function to set bl_bam_ptr->ref_lengths[c]
+ *      in a bl_bam_t object from non-member functions.
+ *
+ *  Arguments:
+ *      bl_bam_ptr      Pointer to the structure to set
+ *      c               Subscript to the ref_lengths array
+ *      new_ref_lengths_element The new value for ref_lengths[c]
+ *
+ *  Returns:
+ *      BL_BAM_DATA_OK if the new value is acceptable and assigned
+ *      BL_BAM_DATA_OUT_OF_RANGE otherwise
+ *
+ *  Examples:
+ *      bl_bam_t        bl_bam;
+ *      size_t          c;
+ *      int64_t         new_ref_lengths_element;
+ *
+ *      if ( bl_bam_set_ref_lengths_ae(&bl_bam, c, new_ref_lengths_element)
+ *              == BL_BAM_DATA_OK )
+ *      {
+ *      }
+ *
+ *  See also:
+ *      BL_BAM_SET_REF_LENGTHS_AE(3)
+ *
+ *  History: 
+ *  Date        Name        Modification
+ *  2026-10-17  gen-get-set Auto-generated from bam.h
+ ***************************************************************************/
+
+int     bl_bam_set_ref_lengths_ae(
+	    bl_bam_t *bl_bam_ptr,
+	    size_t c,
+	    int64_t new_ref_lengths_element
+	)
+
+{
+    if ( false )
+	return BL_BAM_DATA_OUT_OF_RANGE;
+    else
+    {
+	bl_bam_ptr->ref_lengths[c] = new_ref_lengths_element;
+	return BL_BAM_DATA_OK;
+    }
+}
+
+
+/***************************************************************************
+ *  Library:
+ *      #include <biolibc/bam.h>
+ *      -lbiolibc -lxtend
+ *
+ *  Description:
+ *      Mutator for ref_lengths member in a bl_bam_t structure.
+ *      Use this function to set ref_lengths in a bl_bam_t object
+ *      from non-member functions.  This function copies the array pointed to
+ *      by new_ref_lengths to bl_bam_ptr->ref_lengths.
+ *
+ *  Arguments:
+ *      bl_bam_ptr      Pointer to the structure to set
+ *      new_ref_lengths The new value for ref_lengths
+ *      array_size      Size of the ref_lengths array.
+ *
+ *  Returns:
+ *      BL_BAM_DATA_OK if the new value is acceptable and assigned
+ *      BL_BAM_DATA_OUT_OF_RANGE otherwise
+ *
+ *  Examples:
+ *      bl_bam_t        bl_bam;
+ *      int64_t *       new_ref_lengths;
+ *      size_t          array_size;
+ *
+ *      if ( bl_bam_set_ref_lengths_cpy(&bl_bam, new_ref_lengths, array_size)
+ *              == BL_BAM_DATA_OK )
+ *      {
+ *      }
+ *
+ *  See also:
+ *      BL_BAM_SET_REF_LENGTHS(3)
+ *
+ *  History: 
+ *  Date        Name        Modification
+ *  2026-10-17  gen-get-set Auto-generated from bam.h
+ ***************************************************************************/
+
+int     bl_bam_set_ref_lengths_cpy(
+	    bl_bam_t *bl_bam_ptr,
+	    int64_t *new_ref_lengths,
+	    size_t array_size
+	)
+
+{
+    if ( new_ref_lengths == NULL )
+	return BL_BAM_DATA_OUT_OF_RANGE;
+    else
+    {
+	size_t  c;
+	
+	// FIXME: Assuming all elements should be copied
+	for (c = 0; c < array_size; ++c)
+	    bl_bam_ptr->ref_lengths[c] = new_ref_lengths[c];
+	return BL_BAM_DATA_OK;
+    }
+}
+
+
+/***************************************************************************
+ *  Library:
+ *      #include <biolibc/bam.h>
+ *      -lbiolibc -lxtend
+ *
+ *  Description:
+ *      Mutator for record member in a bl_bam_t structure.
+ *      Use this function to set record in a bl_bam_t object
+ *      from non-member functions.  This function performs a direct
+ *      assignment for scalar or pointer structure members.  If
+ *      record is a pointer, data previously pointed to should
+ *      be freed before calling this function to avoid memory
+ *      leaks.
+ *
+ *  Arguments:
+ *      bl_bam_ptr      Pointer to the structure to set
+ *      new_record      The new value for record
+ *
+ *  Returns:
+ *      BL_BAM_DATA_OK if the new value is acceptable and assigned
+ *      BL_BAM_DATA_OUT_OF_RANGE otherwise
+ *
+ *  Examples:
+ *      bl_bam_t        bl_bam;
+ *      unsigned char *      new_record;
+ *
+ *      if ( bl_bam_set_record(&bl_bam, new_record)
+ *              == BL_BAM_DATA_OK )
+ *      {
+ *      }
+ *
+ *  See also:
+ *      (3)
+ *
+ *  History: 
+ *  Date        Name        Modification
+ *  2026-10-17  gen-get-set Auto-generated from bam.h
+ ***************************************************************************/
+
+int     bl_bam_set_record(
+	    bl_bam_t *bl_bam_ptr,
+	    unsigned char *new_record
+	)
+
+{
+    if ( new_record == NULL )
+	return BL_BAM_DATA_OUT_OF_RANGE;
+    else
+    {
+	bl_bam_ptr->record = new_record;
+	return BL_BAM_DATA_OK;
+    }
+}
+
+
+/***************************************************************************
+ *  Library:
+ *      #include <biolibc/bam.h>
+ *      -lbiolibc -lxtend
+ *
+ *  Description:
+ *      Mutator for an array element of record member in a bl_bam_t
+ *      structure. Use this function to set bl_bam_ptr->record[c]
+ *      in a bl_bam_t object from non-member functions.
+ *
+ *  Arguments:
+ *      bl_bam_ptr      Pointer to the structure to set
+ *      c               Subscript to the record array
+ *      new_record_element The new value for record[c]
+ *
+ *  Returns:
+ *      BL_BAM_DATA_OK if the new value is acceptable and assigned
+ *      BL_BAM_DATA_OUT_OF_RANGE otherwise
+ *
+ *  Examples:
+ *      bl_bam_t        bl_bam;
+ *      size_t          c;
+ *      unsigned char   new_record_element;
+ *
+ *      if ( bl_bam_set_record_ae(&bl_bam, c, new_record_element)
+ *              == BL_BAM_DATA_OK )
+ *      {
+ *      }
+ *
+ *  See also:
+ *      BL_BAM_SET_RECORD_AE(3)
+ *
+ *  History: 
+ *  Date        Name        Modification
+ *  2026-10-17  gen-get-set Auto-generated from bam.h
+ ***************************************************************************/
+
+int     bl_bam_set_record_ae(
+	    bl_bam_t *bl_bam_ptr,
+	    size_t c,
+	    unsigned char new_record_element
+	)
+
+{
+    if ( false )
+	return BL_BAM_DATA_OUT_OF_RANGE;
+    else
+    {
+	bl_bam_ptr->record[c] = new_record_element;
+	return BL_BAM_DATA_OK;
+    }
+}
+
+
+/***************************************************************************
+ *  Library:
+ *      #include <biolibc/bam.h>
+ *      -lbiolibc -lxtend
+ *
+ *  Description:
+ *      Mutator for record member in a bl_bam_t structure.
+ *      Use this function to set record in a bl_bam_t object
+ *      from non-member functions.  This function copies the array pointed to
+ *      by new_record to bl_bam_ptr->record.
+ *
+ *  Arguments:
+ *      bl_bam_ptr      Pointer to the structure to set
+ *      new_record      The new value for record
+ *      array_size      Size of the record array.
+ *
+ *  Returns:
+ *      BL_BAM_DATA_OK if the new value is acceptable and assigned
+ *      BL_BAM_DATA_OUT_OF_RANGE otherwise
+ *
+ *  Examples:
+ *      bl_bam_t        bl_bam;
+ *      unsigned char *      new_record;
+ *      size_t          array_size;
+ *
+ *      if ( bl_bam_set_record_cpy(&bl_bam, new_record, array_size)
+ *              == BL_BAM_DATA_OK )
+ *      {
+ *      }
+ *
+ *  See also:
+ *      BL_BAM_SET_RECORD(3)
+ *
+ *  History: 
+ *  Date        Name        Modification
+ *  2026-10-17  gen-get-set Auto-generated from bam.h
+ ***************************************************************************/
+
+int     bl_bam_set_record_cpy(
+	    bl_bam_t *bl_bam_ptr,
+	    unsigned char *new_record,
+	    size_t array_size
+	)
+
+{
+    if ( new_record == NULL )
+	return BL_BAM_DATA_OUT_OF_RANGE;
+    else
+    {
+	size_t  c;
+	
+	// FIXME: Assuming all elements should be copied
+	for (c = 0; c < array_size; ++c)
+	    bl_bam_ptr->record[c] = new_record[c];
+	return BL_BAM_DATA_OK;
+    }
+}
+
+
+/***************************************************************************
+ *  Library:
+ *      #include <biolibc/bam.h>
+ *      -lbiolibc -lxtend
+ *
+ *  Description:
+ *      Mutator for record_array_size member in a bl_bam_t structure.
+ *      Use this function to set record_array_size in a bl_bam_t object
+ *      from non-member functions.  This function performs a direct
+ *      assignment for scalar or pointer structure members.  If
+ *      record_array_size is a pointer, data previously pointed to should
+ *      be freed before calling this function to avoid memory
+ *      leaks.
+ *
+ *  Arguments:
+ *      bl_bam_ptr      Pointer to the structure to set
+ *      new_record_array_size The new value for record_array_size
+ *
+ *  Returns:
+ *      BL_BAM_DATA_OK if the new value is acceptable and assigned
+ *      BL_BAM_DATA_OUT_OF_RANGE otherwise
+ *
+ *  Examples:
+ *      bl_bam_t        bl_bam;
+ *      size_t          new_record_array_size;
+ *
+ *      if ( bl_bam_set_record_array_size(&bl_bam, new_record_array_size)
+ *              == BL_BAM_DATA_OK )
+ *      {
+ *      }
+ *
+ *  See also:
+ *      (3)
+ *
+ *  History: 
+ *  Date        Name        Modification
+ *  2026-10-17  gen-get-set Auto-generated from bam.h
+ ***************************************************************************/
+
+int     bl_bam_set_record_array_size(
+	    bl_bam_t *bl_bam_ptr,
+	    size_t new_record_array_size
+	)
+
+{
+    if ( false )
+	return BL_BAM_DATA_OUT_OF_RANGE;
+    else
+    {
+	bl_bam_ptr->record_array_size = new_record_array_size;
+	return BL_BAM_DATA_OK;
+    }
+}
+
+
+/***************************************************************************
+ *  Library:
+ *      #include <biolibc/bam.h>
+ *      -lbiolibc -lxtend
+ *
+ *  Description:
+ *      Mutator for ref_hint member in a bl_bam_t structure.
+ *      Use this function to set ref_hint in a bl_bam_t object
+ *      from non-member functions.  This function performs a direct
+ *      assignment for scalar or pointer structure members.  If
+ *      ref_hint is a pointer, data previously pointed to should
+ *      be freed before calling this function to avoid memory
+ *      leaks.
+ *
+ *  Arguments:
+ *      bl_bam_ptr      Pointer to the structure to set
+ *      new_ref_hint    The new value for ref_hint
+ *
+ *  Returns:
+ *      BL_BAM_DATA_OK if the new value is acceptable and assigned
+ *      BL_BAM_DATA_OUT_OF_RANGE otherwise
+ *
+ *  Examples:
+ *      bl_bam_t        bl_bam;
+ *      size_t          new_ref_hint;
+ *
+ *      if ( bl_bam_set_ref_hint(&bl_bam, new_ref_hint)
+ *              == BL_BAM_DATA_OK )
+ *      {
+ *      }
+ *
+ *  See also:
+ *      (3)
+ *
+ *  History: 
+ *  Date        Name        Modification
+ *  2026-10-17  gen-get-set Auto-generated from bam.h
+ ***************************************************************************/
+
+int     bl_bam_set_ref_hint(
+	    bl_bam_t *bl_bam_ptr,
+	    size_t new_ref_hint
+	)
+
+{
+    if ( false )
+	return BL_BAM_DATA_OUT_OF_RANGE;
+    else
+    {
+	bl_bam_ptr->ref_hint = new_ref_hint;
+	return BL_BAM_DATA_OK;
+    }
+}
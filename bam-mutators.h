@@ -0,0 +1,32 @@
+
+/*
+ *  Generated by /usr/local/bin/auto-gen-get-set
+ *
+ *  Mutator functions for setting with no sanity checking.  Use these to
+ *  set structure members from functions outside the bl_bam_t
+ *  class.  These macros perform no data validation.  Hence, they achieve
+ *  maximum performance where data are guaranteed correct by other means.
+ *  Use the mutator functions (same name as the macro, but lower case)
+ *  for more robust code with a small performance penalty.
+ *
+ *  These generated macros are not expected to be perfect.  Check and edit
+ *  as needed before adding to your code.
+ */
+
+/* temp-bam-mutators.c */
+int bl_bam_set_header(bl_bam_t *bl_bam_ptr, char *new_header);
+int bl_bam_set_header_ae(bl_bam_t *bl_bam_ptr, size_t c, char new_header_element);
+int bl_bam_set_header_cpy(bl_bam_t *bl_bam_ptr, char *new_header, size_t array_size);
+int bl_bam_set_header_len(bl_bam_t *bl_bam_ptr, size_t new_header_len);
+int bl_bam_set_ref_count(bl_bam_t *bl_bam_ptr, size_t new_ref_count);
+int bl_bam_set_ref_names(bl_bam_t *bl_bam_ptr, char **new_ref_names);
+int bl_bam_set_ref_names_ae(bl_bam_t *bl_bam_ptr, size_t c, char *new_ref_names_element);
+int bl_bam_set_ref_names_cpy(bl_bam_t *bl_bam_ptr, char **new_ref_names, size_t array_size);
+int bl_bam_set_ref_lengths(bl_bam_t *bl_bam_ptr, int64_t *new_ref_lengths);
+int bl_bam_set_ref_lengths_ae(bl_bam_t *bl_bam_ptr, size_t c, int64_t new_ref_lengths_element);
+int bl_bam_set_ref_lengths_cpy(bl_bam_t *bl_bam_ptr, int64_t *new_ref_lengths, size_t array_size);
+int bl_bam_set_record(bl_bam_t *bl_bam_ptr, unsigned char *new_record);
+int bl_bam_set_record_ae(bl_bam_t *bl_bam_ptr, size_t c, unsigned char new_record_element);
+int bl_bam_set_record_cpy(bl_bam_t *bl_bam_ptr, unsigned char *new_record, size_t array_size);
+int bl_bam_set_record_array_size(bl_bam_t *bl_bam_ptr, size_t new_record_array_size);
+int bl_bam_set_ref_hint(bl_bam_t *bl_bam_ptr, size_t new_ref_hint);
@@ -0,0 +1,84 @@
+#ifndef _BIOLIBC_BAM_H_
+#define _BIOLIBC_BAM_H_
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+#ifndef _BIOLIBC_H_
+#include "biolibc.h"
+#endif
+
+#ifndef _BIOLIBC_SAM_H_
+#include "sam.h"
+#endif
+
+#ifndef _BIOLIBC_BGZF_H_
+#include "bgzf.h"
+#endif
+
+/*
+ *  Native BAM reader and writer.  Binary records are decoded directly
+ *  into bl_sam_t objects and encoded directly from them, without
+ *  converting to SAM text or running samtools.  Reference IDs are
+ *  resolved using the reference list in the BAM header.
+ */
+
+typedef struct
+{
+    bl_bgzf_t       bgzf;
+    char            *header;            // SAM header text, null-terminated
+    size_t          header_len,
+		    ref_count;
+    char            **ref_names;        // Indexed by BAM reference ID
+    int64_t         *ref_lengths;
+    unsigned char   *record;            // Raw record buffer, reused
+    size_t          record_array_size,
+		    ref_hint;           // Last reference ID looked up
+}   bl_bam_t;
+
+#define BL_BAM_OK                   0
+#define BL_BAM_MALLOC_FAILED        -1
+#define BL_BAM_BAD_DATA             -2
+#define BL_BAM_OPEN_FAILED          -3
+#define BL_BAM_WRITE_FAILED         -4
+
+// Fixed-length part of an alignment record, after block_size
+#define BL_BAM_RECORD_FIXED_BYTES   32
+
+// Decoding tables from the SAM/BAM specification
+#define BL_BAM_CIGAR_OPS            "MIDNSHP=X???????"
+#define BL_BAM_CIGAR_MAX_OPS        65535
+#define BL_BAM_SEQ_CODES            "=ACMGRSVTWYHKDBN"
+
+// Little-endian fields, independent of host byte order and alignment
+#define BL_BAM_LE16(p)  ((uint16_t)((p)[0] | (p)[1] << 8))
+#define BL_BAM_LE32(p)  ((uint32_t)(p)[0] | (uint32_t)(p)[1] << 8 | \
+			 (uint32_t)(p)[2] << 16 | (uint32_t)(p)[3] << 24)
+#define BL_BAM_SET_LE16(p, v) \
+	do { uint16_t bl_v_ = (v); \
+	     (p)[0] = bl_v_ & 0xff; (p)[1] = bl_v_ >> 8; } while (0)
+#define BL_BAM_SET_LE32(p, v) \
+	do { uint32_t bl_v_ = (v); \
+	     (p)[0] = bl_v_ & 0xff; (p)[1] = (bl_v_ >> 8) & 0xff; \
+	     (p)[2] = (bl_v_ >> 16) & 0xff; (p)[3] = bl_v_ >> 24; } while (0)
+
+#include "bam-rvs.h"
+#include "bam-accessors.h"
+#include "bam-mutators.h"
+
+/* bam.c */
+int bl_bam_open(bl_bam_t *bam, FILE *stream, unsigned threads);
+int bl_bam_read(bl_bam_t *bam, bl_sam_t *alignment, sam_field_mask_t field_mask);
+int bl_bam_close(bl_bam_t *bam);
+int bl_bam_open_write(bl_bam_t *bam, FILE *stream, const char *header_text, unsigned threads);
+int bl_bam_write(bl_bam_t *bam, bl_sam_t *alignment, sam_field_mask_t field_mask);
+int32_t bl_bam_ref_id(bl_bam_t *bam, const char *ref_name);
+int bl_bam_reg2bin(int64_t beg, int64_t end);
+unsigned char bl_bam_seq_code(int base);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif // _BIOLIBC_BAM_H_
@@ -27,3 +27,5 @@
 #define BL_BED_BLOCK_STARTS(ptr)        ((ptr)->block_starts)
 #define BL_BED_BLOCK_STARTS_AE(ptr,c)   ((ptr)->block_starts[c])
 #define BL_BED_FIELDS(ptr)              ((ptr)->fields)
+#define BL_BED_CHROM_DICT(ptr)          ((ptr)->chrom_dict)
+#define BL_BED_CHROM_ID(ptr)            ((ptr)->chrom_id)
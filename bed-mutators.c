@@ -1118,3 +1118,49 @@ int     bl_bed_set_fields(
 	return BL_BED_DATA_OK;
     }
 }
+
+
+/***************************************************************************
+ *  Library:
+ *      #include <biolibc/bed.h>
+ *      -lbiolibc -lxtend
+ *
+ *  Description:
+ *      Mutator for chrom_dict member in a bl_bed_t structure.
+ *      Use this function to set chrom_dict in a bl_bed_t object
+ *      from non-member functions.  The dictionary is shared, not
+ *      copied, and chrom_id is updated for the current CHROM.  Pass
+ *      NULL to stop interning names.
+ *
+ *  Arguments:
+ *      bl_bed_ptr      Pointer to the structure to set
+ *      new_chrom_dict  The new value for chrom_dict
+ *
+ *  Returns:
+ *      BL_BED_DATA_OK
+ *
+ *  Examples:
+ *      bl_bed_t        bl_bed;
+ *      bl_chrom_dict_t *new_chrom_dict;
+ *
+ *      if ( bl_bed_set_chrom_dict(&bl_bed, new_chrom_dict)
+ *              == BL_BED_DATA_OK )
+ *      {
+ *      }
+ *
+ *  See also:
+ *      bl_chrom_dict_intern(3)
+ *
+ *  History: 
+ *  Date        Name        Modification
+ *  2026-10-17  agent       Begin
+ ***************************************************************************/
+
+int     bl_bed_set_chrom_dict(bl_bed_t *bl_bed_ptr, bl_chrom_dict_t *new_chrom_dict)
+
+{
+    bl_bed_ptr->chrom_dict = new_chrom_dict;
+    bl_bed_ptr->chrom_id = bl_chrom_dict_intern(new_chrom_dict,
+			    BL_CHROM_ID_NONE, BL_BED_CHROM(bl_bed_ptr));
+    return BL_BED_DATA_OK;
+}
@@ -34,3 +34,4 @@ int bl_bed_set_block_starts(bl_bed_t *bl_bed_ptr, int64_t *new_block_starts);
 int bl_bed_set_block_starts_ae(bl_bed_t *bl_bed_ptr, size_t c, int64_t new_block_starts_element);
 int bl_bed_set_block_starts_cpy(bl_bed_t *bl_bed_ptr, int64_t *new_block_starts, size_t array_size);
 int bl_bed_set_fields(bl_bed_t *bl_bed_ptr, unsigned short new_fields);
+int bl_bed_set_chrom_dict(bl_bed_t *bl_bed_ptr, bl_chrom_dict_t *new_chrom_dict);
@@ -112,6 +112,14 @@ FILE    *bl_bed_skip_header(FILE *bed_stream)
  *      blockStarts must all be present or omitted, so BL_BED_FIELD_BLOCK
  *      masks all three.
  *
+ *      BL_BED_FIELD_CHROM_ID is not part of BL_BED_FIELD_ALL and must be
+ *      requested explicitly.  If set, CHROM is interned in the chromosome
+ *      dictionary set with bl_bed_set_chrom_dict(3) and its ID stored in
+ *      chrom_id, which requires bed_feature to be initialized with
+ *      BL_BED_INIT or bl_bed_init(3) before the first read.  Otherwise,
+ *      the chromosome dictionary is cleared and bed_feature need not be
+ *      initialized.
+ *
  *  Arguments:
  *      bed_feature     Pointer to a bl_bed_t structure
  *      bed_stream      A FILE stream from which to read the line
@@ -126,13 +134,17 @@ FILE    *bl_bed_skip_header(FILE *bed_stream)
  *      bl_bed_read(stdin, &bed_feature, BL_BED_FIELD_ALL);
  *      bl_bed_read(bed_stream, &bed_feature,
  *                       BL_BED_FIELD_NAME|BL_BED_FIELD_SCORE);
+ *      bl_bed_read(bed_stream, &bed_feature,
+ *                       BL_BED_FIELD_ALL|BL_BED_FIELD_CHROM_ID);
  *
  *  See also:
- *      bl_bed_write(3)
+ *      bl_bed_write(3), bl_bed_init(3)
  *
  *  History: 
  *  Date        Name        Modification
  *  2021-04-05  Jason Bacon Begin
+ *  2026-10-17  agent       Set chrom_id from chrom_dict
+ *  2026-10-17  agent       Intern only with BL_BED_FIELD_CHROM_ID
  ***************************************************************************/
 
 int     bl_bed_read(bl_bed_t *bed_feature, FILE *bed_stream,
@@ -163,6 +175,15 @@ int     bl_bed_read(bl_bed_t *bed_feature, FILE *bed_stream,
 	// fputs("bl_bed_read(): Info: Got EOF reading CHROM, as expected.\n", stderr);
 	return BL_READ_EOF;
     }
+    if ( field_mask & BL_BED_FIELD_CHROM_ID )
+	bed_feature->chrom_id = bl_chrom_dict_intern(bed_feature->chrom_dict,
+				    bed_feature->chrom_id, bed_feature->chrom);
+    else
+    {
+	// Don't trust chrom_dict in a bl_bed_t that was never initialized
+	bed_feature->chrom_dict = NULL;
+	bed_feature->chrom_id = BL_CHROM_ID_NONE;
+    }
     
     // Feature start position
     if ( xt_tsv_read_field(bed_stream, chrom_start_str,
@@ -594,6 +615,9 @@ void    bl_bed_check_order(bl_bed_t *bed_feature, char last_chrom[],
  *      of the GFF feature, > 0 if the BED feature is downstream of the GFF
  *      feature.
  *
+ *      If both features share a chromosome dictionary, chromosome order
+ *      is taken from bl_chrom_dict_cmp(3) instead of bl_chrom_name_cmp(3).
+ *
  *      If the features overlap, populate the bl_overlap_t structure
  *      pointed to by overlap.  The structure contains the lengths of the
  *      two features, the start and end positions of the overlapping region,
@@ -621,6 +645,7 @@ void    bl_bed_check_order(bl_bed_t *bed_feature, char last_chrom[],
  *  History: 
  *  Date        Name        Modification
  *  2021-04-09  Jason Bacon Begin
+ *  2026-10-17  agent       Compare chrom IDs when both share a chrom_dict
  ***************************************************************************/
 
 int     bl_bed_gff3_cmp(bl_bed_t *bed_feature, bl_gff3_t *gff3_feature,
@@ -631,8 +656,14 @@ int     bl_bed_gff3_cmp(bl_bed_t *bed_feature, bl_gff3_t *gff3_feature,
     int64_t    bed_start, bed_end, bed_len,
 		gff3_start, gff3_end, gff3_len;
     
-    chrom_cmp = bl_chrom_name_cmp(BL_BED_CHROM(bed_feature),
-					 BL_GFF3_SEQID(gff3_feature));
+    if ( BL_CHROM_IDS_COMPARABLE(bed_feature->chrom_dict, bed_feature->chrom_id,
+	    gff3_feature->chrom_dict, gff3_feature->seqid_id) )
+	chrom_cmp = bl_chrom_dict_cmp(bed_feature->chrom_dict,
+				      bed_feature->chrom_id,
+				      gff3_feature->seqid_id);
+    else
+	chrom_cmp = bl_chrom_name_cmp(BL_BED_CHROM(bed_feature),
+				      BL_GFF3_SEQID(gff3_feature));
     if ( chrom_cmp == 0 )
     {
 	/*
@@ -667,3 +698,52 @@ int     bl_bed_gff3_cmp(bl_bed_t *bed_feature, bl_gff3_t *gff3_feature,
     }
     return chrom_cmp;
 }
+
+
+/***************************************************************************
+ *  Name:
+ *      bl_bed_init() - Initialize a BED object
+ *
+ *  Library:
+ *      #include <biolibc/bed.h>
+ *      -lbiolibc -lxtend
+ *
+ *  Description:
+ *      Initialize all fields of a bl_bed_t object to defaults.  This is
+ *      equivalent to assigning BL_BED_INIT, and one or the other must be
+ *      used before the first call to bl_bed_read(3) with
+ *      BL_BED_FIELD_CHROM_ID, so that the chromosome dictionary pointer is
+ *      valid.
+ *
+ *  Arguments:
+ *      bed_feature     Pointer to a bl_bed_t structure
+ *
+ *  Examples:
+ *      bl_bed_t    bed_feature;
+ *
+ *      bl_bed_init(&bed_feature);
+ *
+ *  See also:
+ *      bl_bed_read(3), bl_bed_set_chrom_dict(3)
+ *
+ *  History: 
+ *  Date        Name        Modification
+ *  2026-10-17  agent       Begin
+ ***************************************************************************/
+
+void    bl_bed_init(bl_bed_t *bed_feature)
+
+{
+    bed_feature->chrom[0] = '\0';
+    bed_feature->chrom_start = bed_feature->chrom_end = 0;
+    bed_feature->name[0] = '\0';
+    bed_feature->score = 0;
+    bed_feature->strand = '.';
+    bed_feature->thick_start = bed_feature->thick_end = 0;
+    bed_feature->item_rgb[0] = '\0';
+    bed_feature->block_count = 0;
+    bed_feature->block_sizes = bed_feature->block_starts = NULL;
+    bed_feature->fields = 0;
+    bed_feature->chrom_dict = NULL;
+    bed_feature->chrom_id = BL_CHROM_ID_NONE;
+}
@@ -9,6 +9,10 @@ extern "C" {
 #include "biolibc.h"
 #endif
 
+#ifndef _BIOLIBC_CHROM_DICT_H_
+#include "chrom-dict.h"
+#endif
+
 #define BL_BED_NAME_MAX_CHARS          256
 #define BL_BED_SCORE_MAX_DIGITS        4   // 0 to 1000
 #define BL_BED_STRAND_MAX_CHARS        2
@@ -18,7 +22,8 @@ extern "C" {
 #define BL_BED_BLOCK_START_MAX_DIGITS  20  // 2^64
 
 #define BL_BED_INIT \
-	{ "", 0, 0, "", 0, '.', 0, 0, "", 0, NULL, NULL, 0 }
+	{ "", 0, 0, "", 0, '.', 0, 0, "", 0, NULL, NULL, 0, NULL, \
+	  BL_CHROM_ID_NONE }
 
 typedef struct
 {
@@ -45,6 +50,10 @@ typedef struct
 
     // Not part of BED spec
     unsigned short  fields;     // aggs:3:9
+    
+    // Optional shared chromosome dictionary, see bl_sam_t
+    bl_chrom_dict_t *chrom_dict;
+    int32_t         chrom_id;
 }   bl_bed_t;
 
 typedef unsigned int            bed_field_mask_t;
@@ -60,6 +69,13 @@ typedef unsigned int            bed_field_mask_t;
 #define BL_BED_FIELD_BLOCK     0x20
 #define BL_BED_FIELD_ALL       0xff
 
+/*
+ *  Not included in BL_BED_FIELD_ALL: intern CHROM in the chromosome
+ *  dictionary set with bl_bed_set_chrom_dict().  Requires BL_BED_INIT
+ *  or bl_bed_init() before the first read.
+ */
+#define BL_BED_FIELD_CHROM_ID  0x100
+
 // After bl_bed_t def for prototypes
 #ifndef _BIOLIBC_GFF3_H_
 #include "gff3.h"
@@ -79,6 +95,7 @@ int bl_bed_read(bl_bed_t *bed_feature, FILE *bed_stream, bed_field_mask_t field_
 int bl_bed_write(bl_bed_t *bed_feature, FILE *bed_stream, bed_field_mask_t field_mask);
 void bl_bed_check_order(bl_bed_t *bed_feature, char last_chrom[], int64_t last_start);
 int bl_bed_gff3_cmp(bl_bed_t *bed_feature, bl_gff3_t *gff3_feature, bl_overlap_t *overlap);
+void bl_bed_init(bl_bed_t *bed_feature);
 
 #ifdef __cplusplus
 }
@@ -0,0 +1,31 @@
+    
+/*
+ *  Generated by /usr/local/bin/auto-gen-get-set
+ *
+ *  Accessor macros.  Use these to access structure members from functions
+ *  outside the bl_bgzf_t class.
+ *
+ *  These generated macros are not expected to be perfect.  Check and edit
+ *  as needed before adding to your code.
+ */
+
+#define BL_BGZF_STREAM(ptr)             ((ptr)->stream)
+#define BL_BGZF_FORMAT(ptr)             ((ptr)->format)
+#define BL_BGZF_WRITING(ptr)            ((ptr)->writing)
+#define BL_BGZF_LEVEL(ptr)              ((ptr)->level)
+#define BL_BGZF_THREADS(ptr)            ((ptr)->threads)
+#define BL_BGZF_BUFF(ptr)               ((ptr)->buff)
+#define BL_BGZF_BUFF_AE(ptr,c)          ((ptr)->buff[c])
+#define BL_BGZF_BUFF_LEN(ptr)           ((ptr)->buff_len)
+#define BL_BGZF_BUFF_POS(ptr)           ((ptr)->buff_pos)
+#define BL_BGZF_STREAM_EOF(ptr)         ((ptr)->stream_eof)
+#define BL_BGZF_BLOCKS(ptr)             ((ptr)->blocks)
+#define BL_BGZF_BLOCK_COUNT(ptr)        ((ptr)->block_count)
+#define BL_BGZF_BLOCKS_LOADED(ptr)      ((ptr)->blocks_loaded)
+#define BL_BGZF_BLOCKS_CLAIMED(ptr)     ((ptr)->blocks_claimed)
+#define BL_BGZF_BLOCKS_CONSUMED(ptr)    ((ptr)->blocks_consumed)
+#define BL_BGZF_BLOCK_POS(ptr)          ((ptr)->block_pos)
+#define BL_BGZF_EOF(ptr)                ((ptr)->eof)
+#define BL_BGZF_SHUTDOWN(ptr)           ((ptr)->shutdown)
+#define BL_BGZF_WRITE_ERROR(ptr)        ((ptr)->write_error)
+#define BL_BGZF_WORKERS(ptr)            ((ptr)->workers)
@@ -0,0 +1,1172 @@
+/***************************************************************************
+ *  This file is automatically generated by gen-get-set.  Be sure to keep
+ *  track of any manual changes.
+ *
+ *  These generated functions are not expected to be perfect.  Check and
+ *  edit as needed before adding to your code.
+ ***************************************************************************/
+
+#include <string.h>
+#include <ctype.h>
+#include <stdbool.h>        // In case of bool
+#include <stdint.h>         // In case of int64_t, etc
+#include <xtend/string.h>   // strlcpy() on Linux
+#include "bgzf.h"
+
+
+/***************************************************************************
+ *  Library:
+ *      #include <biolibc/bgzf.h>
+ *      -lbiolibc -lxtend
+ *
+ *  Description:
+ *      Mutator for stream member in a bl_bgzf_t structure.
+ *      Use this function to set stream in a bl_bgzf_t object
+ *      from non-member functions.  This function performs a direct
+ *      assignment for scalar or pointer structure members.  If
+ *      stream is a pointer, data previously pointed to should
+ *      be freed before calling this function to avoid memory
+ *      leaks.
+ *
+ *  Arguments:
+ *      bl_bgzf_ptr     Pointer to the structure to set
+ *      new_stream      The new value for stream
+ *
+ *  Returns:
+ *      BL_BGZF_DATA_OK if the new value is acceptable and assigned
+ *      BL_BGZF_DATA_OUT_OF_RANGE otherwise
+ *
+ *  Examples:
+ *      bl_bgzf_t       bl_bgzf;
+ *      FILE *          new_stream;
+ *
+ *      if ( bl_bgzf_set_stream(&bl_bgzf, new_stream)
+ *              == BL_BGZF_DATA_OK )
+ *      {
+ *      }
+ *
+ *  See also:
+ *      (3)
+ *
+ *  History: 
+ *  Date        Name        Modification
+ *  2026-10-17  gen-get-set Auto-generated from bgzf.h
+ ***************************************************************************/
+
+int     bl_bgzf_set_stream(
+	    bl_bgzf_t *bl_bgzf_ptr,
+	    FILE *new_stream
+	)
+
+{
+    if ( new_stream == NULL )
+	return BL_BGZF_DATA_OUT_OF_RANGE;
+    else
+    {
+	bl_bgzf_ptr->stream = new_stream;
+	return BL_BGZF_DATA_OK;
+    }
+}
+
+
+/***************************************************************************
+ *  Library:
+ *      #include <biolibc/bgzf.h>
+ *      -lbiolibc -lxtend
+ *
+ *  Description:
+ *      Mutator for format member in a bl_bgzf_t structure.
+ *      Use this function to set format in a bl_bgzf_t object
+ *      from non-member functions.  This function performs a direct
+ *      assignment for scalar or pointer structure members.  If
+ *      format is a pointer, data previously pointed to should
+ *      be freed before calling this function to avoid memory
+ *      leaks.
+ *
+ *  Arguments:
+ *      bl_bgzf_ptr     Pointer to the structure to set
+ *      new_format      The new value for format
+ *
+ *  Returns:
+ *      BL_BGZF_DATA_OK if the new value is acceptable and assigned
+ *      BL_BGZF_DATA_OUT_OF_RANGE otherwise
+ *
+ *  Examples:
+ *      bl_bgzf_t       bl_bgzf;
+ *      int             new_format;
+ *
+ *      if ( bl_bgzf_set_format(&bl_bgzf, new_format)
+ *              == BL_BGZF_DATA_OK )
+ *      {
+ *      }
+ *
+ *  See also:
+ *      (3)
+ *
+ *  History: 
+ *  Date        Name        Modification
+ *  2026-10-17  gen-get-set Auto-generated from bgzf.h
+ ***************************************************************************/
+
+int     bl_bgzf_set_format(
+	    bl_bgzf_t *bl_bgzf_ptr,
+	    int new_format
+	)
+
+{
+    if ( false )
+	return BL_BGZF_DATA_OUT_OF_RANGE;
+    else
+    {
+	bl_bgzf_ptr->format = new_format;
+	return BL_BGZF_DATA_OK;
+    }
+}
+
+
+/***************************************************************************
+ *  Library:
+ *      #include <biolibc/bgzf.h>
+ *      -lbiolibc -lxtend
+ *
+ *  Description:
+ *      Mutator for writing member in a bl_bgzf_t structure.
+ *      Use this function to set writing in a bl_bgzf_t object
+ *      from non-member functions.  This function performs a direct
+ *      assignment for scalar or pointer structure members.  If
+ *      writing is a pointer, data previously pointed to should
+ *      be freed before calling this function to avoid memory
+ *      leaks.
+ *
+ *  Arguments:
+ *      bl_bgzf_ptr     Pointer to the structure to set
+ *      new_writing     The new value for writing
+ *
+ *  Returns:
+ *      BL_BGZF_DATA_OK if the new value is acceptable and assigned
+ *      BL_BGZF_DATA_OUT_OF_RANGE otherwise
+ *
+ *  Examples:
+ *      bl_bgzf_t       bl_bgzf;
+ *      int             new_writing;
+ *
+ *      if ( bl_bgzf_set_writing(&bl_bgzf, new_writing)
+ *              == BL_BGZF_DATA_OK )
+ *      {
+ *      }
+ *
+ *  See also:
+ *      (3)
+ *
+ *  History: 
+ *  Date        Name        Modification
+ *  2026-10-17  gen-get-set Auto-generated from bgzf.h
+ ***************************************************************************/
+
+int     bl_bgzf_set_writing(
+	    bl_bgzf_t *bl_bgzf_ptr,
+	    int new_writing
+	)
+
+{
+    if ( false )
+	return BL_BGZF_DATA_OUT_OF_RANGE;
+    else
+    {
+	bl_bgzf_ptr->writing = new_writing;
+	return BL_BGZF_DATA_OK;
+    }
+}
+
+
+/***************************************************************************
+ *  Library:
+ *      #include <biolibc/bgzf.h>
+ *      -lbiolibc -lxtend
+ *
+ *  Description:
+ *      Mutator for level member in a bl_bgzf_t structure.
+ *      Use this function to set level in a bl_bgzf_t object
+ *      from non-member functions.  This function performs a direct
+ *      assignment for scalar or pointer structure members.  If
+ *      level is a pointer, data previously pointed to should
+ *      be freed before calling this function to avoid memory
+ *      leaks.
+ *
+ *  Arguments:
+ *      bl_bgzf_ptr     Pointer to the structure to set
+ *      new_level       The new value for level
+ *
+ *  Returns:
+ *      BL_BGZF_DATA_OK if the new value is acceptable and assigned
+ *      BL_BGZF_DATA_OUT_OF_RANGE otherwise
+ *
+ *  Examples:
+ *      bl_bgzf_t       bl_bgzf;
+ *      int             new_level;
+ *
+ *      if ( bl_bgzf_set_level(&bl_bgzf, new_level)
+ *              == BL_BGZF_DATA_OK )
+ *      {
+ *      }
+ *
+ *  See also:
+ *      (3)
+ *
+ *  History: 
+ *  Date        Name        Modification
+ *  2026-10-17  gen-get-set Auto-generated from bgzf.h
+ ***************************************************************************/
+
+int     bl_bgzf_set_level(
+	    bl_bgzf_t *bl_bgzf_ptr,
+	    int new_level
+	)
+
+{
+    if ( false )
+	return BL_BGZF_DATA_OUT_OF_RANGE;
+    else
+    {
+	bl_bgzf_ptr->level = new_level;
+	return BL_BGZF_DATA_OK;
+    }
+}
+
+
+/***************************************************************************
+ *  Library:
+ *      #include <biolibc/bgzf.h>
+ *      -lbiolibc -lxtend
+ *
+ *  Description:
+ *      Mutator for threads member in a bl_bgzf_t structure.
+ *      Use this function to set threads in a bl_bgzf_t object
+ *      from non-member functions.  This function performs a direct
+ *      assignment for scalar or pointer structure members.  If
+ *      threads is a pointer, data previously pointed to should
+ *      be freed before calling this function to avoid memory
+ *      leaks.
+ *
+ *  Arguments:
+ *      bl_bgzf_ptr     Pointer to the structure to set
+ *      new_threads     The new value for threads
+ *
+ *  Returns:
+ *      BL_BGZF_DATA_OK if the new value is acceptable and assigned
+ *      BL_BGZF_DATA_OUT_OF_RANGE otherwise
+ *
+ *  Examples:
+ *      bl_bgzf_t       bl_bgzf;
+ *      unsigned        new_threads;
+ *
+ *      if ( bl_bgzf_set_threads(&bl_bgzf, new_threads)
+ *              == BL_BGZF_DATA_OK )
+ *      {
+ *      }
+ *
+ *  See also:
+ *      (3)
+ *
+ *  History: 
+ *  Date        Name        Modification
+ *  2026-10-17  gen-get-set Auto-generated from bgzf.h
+ ***************************************************************************/
+
+int     bl_bgzf_set_threads(
+	    bl_bgzf_t *bl_bgzf_ptr,
+	    unsigned new_threads
+	)
+
+{
+    if ( false )
+	return BL_BGZF_DATA_OUT_OF_RANGE;
+    else
+    {
+	bl_bgzf_ptr->threads = new_threads;
+	return BL_BGZF_DATA_OK;
+    }
+}
+
+
+/***************************************************************************
+ *  Library:
+ *      #include <biolibc/bgzf.h>
+ *      -lbiolibc -lxtend
+ *
+ *  Description:
+ *      Mutator for buff member in a bl_bgzf_t structure.
+ *      Use this function to set buff in a bl_bgzf_t object
+ *      from non-member functions.  This function performs a direct
+ *      assignment for scalar or pointer structure members.  If
+ *      buff is a pointer, data previously pointed to should
+ *      be freed before calling this function to avoid memory
+ *      leaks.
+ *
+ *  Arguments:
+ *      bl_bgzf_ptr     Pointer to the structure to set
+ *      new_buff        The new value for buff
+ *
+ *  Returns:
+ *      BL_BGZF_DATA_OK if the new value is acceptable and assigned
+ *      BL_BGZF_DATA_OUT_OF_RANGE otherwise
+ *
+ *  Examples:
+ *      bl_bgzf_t       bl_bgzf;
+ *      unsigned char *      new_buff;
+ *
+ *      if ( bl_bgzf_set_buff(&bl_bgzf, new_buff)
+ *              == BL_BGZF_DATA_OK )
+ *      {
+ *      }
+ *
+ *  See also:
+ *      (3)
+ *
+ *  History: 
+ *  Date        Name        Modification
+ *  2026-10-17  gen-get-set Auto-generated from bgzf.h
+ ***************************************************************************/
+
+int     bl_bgzf_set_buff(
+	    bl_bgzf_t *bl_bgzf_ptr,
+	    unsigned char *new_buff
+	)
+
+{
+    if ( new_buff == NULL )
+	return BL_BGZF_DATA_OUT_OF_RANGE;
+    else
+    {
+	bl_bgzf_ptr->buff = new_buff;
+	return BL_BGZF_DATA_OK;
+    }
+}
+
+
+/***************************************************************************
+ *  Library:
+ *      #include <biolibc/bgzf.h>
+ *      -lbiolibc -lxtend
+ *
+ *  Description:
+ *      Mutator for an array element of buff member in a bl_bgzf_t
+ *      structure. Use this function to set bl_bgzf_ptr->buff[c]
+ *      in a bl_bgzf_t object from non-member functions.
+ *
+ *  Arguments:
+ *      bl_bgzf_ptr     Pointer to the structure to set
+ *      c               Subscript to the buff array
+ *      new_buff_element The new value for buff[c]
+ *
+ *  Returns:
+ *      BL_BGZF_DATA_OK if the new value is acceptable and assigned
+ *      BL_BGZF_DATA_OUT_OF_RANGE otherwise
+ *
+ *  Examples:
+ *      bl_bgzf_t       bl_bgzf;
+ *      size_t          c;
+ *      unsigned char   new_buff_element;
+ *
+ *      if ( bl_bgzf_set_buff_ae(&bl_bgzf, c, new_buff_element)
+ *              == BL_BGZF_DATA_OK )
+ *      {
+ *      }
+ *
+ *  See also:
+ *      BL_BGZF_SET_BUFF_AE(3)
+ *
+ *  History: 
+ *  Date        Name        Modification
+ *  2026-10-17  gen-get-set Auto-generated from bgzf.h
+ ***************************************************************************/
+
+int     bl_bgzf_set_buff_ae(
+	    bl_bgzf_t *bl_bgzf_ptr,
+	    size_t c,
+	    unsigned char new_buff_element
+	)
+
+{
+    if ( false )
+	return BL_BGZF_DATA_OUT_OF_RANGE;
+    else
+    {
+	bl_bgzf_ptr->buff[c] = new_buff_element;
+	return BL_BGZF_DATA_OK;
+    }
+}
+
+
+/***************************************************************************
+ *  Library:
+ *      #include <biolibc/bgzf.h>
+ *      -lbiolibc -lxtend
+ *
+ *  Description:
+ *      Mutator for buff member in a bl_bgzf_t structure.
+ *      Use this function to set buff in a bl_bgzf_t object
+ *      from non-member functions.  This function copies the array pointed to
+ *      by new_buff to bl_bgzf_ptr->buff.
+ *
+ *  Arguments:
+ *      bl_bgzf_ptr     Pointer to the structure to set
+ *      new_buff        The new value for buff
+ *      array_size      Size of the buff array.
+ *
+ *  Returns:
+ *      BL_BGZF_DATA_OK if the new value is acceptable and assigned
+ *      BL_BGZF_DATA_OUT_OF_RANGE otherwise
+ *
+ *  Examples:
+ *      bl_bgzf_t       bl_bgzf;
+ *      unsigned char *      new_buff;
+ *      size_t          array_size;
+ *
+ *      if ( bl_bgzf_set_buff_cpy(&bl_bgzf, new_buff, array_size)
+ *              == BL_BGZF_DATA_OK )
+ *      {
+ *      }
+ *
+ *  See also:
+ *      BL_BGZF_SET_BUFF(3)
+ *
+ *  History: 
+ *  Date        Name        Modification
+ *  2026-10-17  gen-get-set Auto-generated from bgzf.h
+ ***************************************************************************/
+
+int     bl_bgzf_set_buff_cpy(
+	    bl_bgzf_t *bl_bgzf_ptr,
+	    unsigned char *new_buff,
+	    size_t array_size
+	)
+
+{
+    if ( new_buff == NULL )
+	return BL_BGZF_DATA_OUT_OF_RANGE;
+    else
+    {
+	size_t  c;
+	
+	// FIXME: Assuming all elements should be copied
+	for (c = 0; c < array_size; ++c)
+	    bl_bgzf_ptr->buff[c] = new_buff[c];
+	return BL_BGZF_DATA_OK;
+    }
+}
+
+
+/***************************************************************************
+ *  Library:
+ *      #include <biolibc/bgzf.h>
+ *      -lbiolibc -lxtend
+ *
+ *  Description:
+ *      Mutator for buff_len member in a bl_bgzf_t structure.
+ *      Use this function to set buff_len in a bl_bgzf_t object
+ *      from non-member functions.  This function performs a direct
+ *      assignment for scalar or pointer structure members.  If
+ *      buff_len is a pointer, data previously pointed to should
+ *      be freed before calling this function to avoid memory
+ *      leaks.
+ *
+ *  Arguments:
+ *      bl_bgzf_ptr     Pointer to the structure to set
+ *      new_buff_len    The new value for buff_len
+ *
+ *  Returns:
+ *      BL_BGZF_DATA_OK if the new value is acceptable and assigned
+ *      BL_BGZF_DATA_OUT_OF_RANGE otherwise
+ *
+ *  Examples:
+ *      bl_bgzf_t       bl_bgzf;
+ *      size_t          new_buff_len;
+ *
+ *      if ( bl_bgzf_set_buff_len(&bl_bgzf, new_buff_len)
+ *              == BL_BGZF_DATA_OK )
+ *      {
+ *      }
+ *
+ *  See also:
+ *      (3)
+ *
+ *  History: 
+ *  Date        Name        Modification
+ *  2026-10-17  gen-get-set Auto-generated from bgzf.h
+ ***************************************************************************/
+
+int     bl_bgzf_set_buff_len(
+	    bl_bgzf_t *bl_bgzf_ptr,
+	    size_t new_buff_len
+	)
+
+{
+    if ( false )
+	return BL_BGZF_DATA_OUT_OF_RANGE;
+    else
+    {
+	bl_bgzf_ptr->buff_len = new_buff_len;
+	return BL_BGZF_DATA_OK;
+    }
+}
+
+
+/***************************************************************************
+ *  Library:
+ *      #include <biolibc/bgzf.h>
+ *      -lbiolibc -lxtend
+ *
+ *  Description:
+ *      Mutator for buff_pos member in a bl_bgzf_t structure.
+ *      Use this function to set buff_pos in a bl_bgzf_t object
+ *      from non-member functions.  This function performs a direct
+ *      assignment for scalar or pointer structure members.  If
+ *      buff_pos is a pointer, data previously pointed to should
+ *      be freed before calling this function to avoid memory
+ *      leaks.
+ *
+ *  Arguments:
+ *      bl_bgzf_ptr     Pointer to the structure to set
+ *      new_buff_pos    The new value for buff_pos
+ *
+ *  Returns:
+ *      BL_BGZF_DATA_OK if the new value is acceptable and assigned
+ *      BL_BGZF_DATA_OUT_OF_RANGE otherwise
+ *
+ *  Examples:
+ *      bl_bgzf_t       bl_bgzf;
+ *      size_t          new_buff_pos;
+ *
+ *      if ( bl_bgzf_set_buff_pos(&bl_bgzf, new_buff_pos)
+ *              == BL_BGZF_DATA_OK )
+ *      {
+ *      }
+ *
+ *  See also:
+ *      (3)
+ *
+ *  History: 
+ *  Date        Name        Modification
+ *  2026-10-17  gen-get-set Auto-generated from bgzf.h
+ ***************************************************************************/
+
+int     bl_bgzf_set_buff_pos(
+	    bl_bgzf_t *bl_bgzf_ptr,
+	    size_t new_buff_pos
+	)
+
+{
+    if ( false )
+	return BL_BGZF_DATA_OUT_OF_RANGE;
+    else
+    {
+	bl_bgzf_ptr->buff_pos = new_buff_pos;
+	return BL_BGZF_DATA_OK;
+    }
+}
+
+
+/***************************************************************************
+ *  Library:
+ *      #include <biolibc/bgzf.h>
+ *      -lbiolibc -lxtend
+ *
+ *  Description:
+ *      Mutator for stream_eof member in a bl_bgzf_t structure.
+ *      Use this function to set stream_eof in a bl_bgzf_t object
+ *      from non-member functions.  This function performs a direct
+ *      assignment for scalar or pointer structure members.  If
+ *      stream_eof is a pointer, data previously pointed to should
+ *      be freed before calling this function to avoid memory
+ *      leaks.
+ *
+ *  Arguments:
+ *      bl_bgzf_ptr     Pointer to the structure to set
+ *      new_stream_eof  The new value for stream_eof
+ *
+ *  Returns:
+ *      BL_BGZF_DATA_OK if the new value is acceptable and assigned
+ *      BL_BGZF_DATA_OUT_OF_RANGE otherwise
+ *
+ *  Examples:
+ *      bl_bgzf_t       bl_bgzf;
+ *      int             new_stream_eof;
+ *
+ *      if ( bl_bgzf_set_stream_eof(&bl_bgzf, new_stream_eof)
+ *              == BL_BGZF_DATA_OK )
+ *      {
+ *      }
+ *
+ *  See also:
+ *      (3)
+ *
+ *  History: 
+ *  Date        Name        Modification
+ *  2026-10-17  gen-get-set Auto-generated from bgzf.h
+ ***************************************************************************/
+
+int     bl_bgzf_set_stream_eof(
+	    bl_bgzf_t *bl_bgzf_ptr,
+	    int new_stream_eof
+	)
+
+{
+    if ( false )
+	return BL_BGZF_DATA_OUT_OF_RANGE;
+    else
+    {
+	bl_bgzf_ptr->stream_eof = new_stream_eof;
+	return BL_BGZF_DATA_OK;
+    }
+}
+
+
+/***************************************************************************
+ *  Library:
+ *      #include <biolibc/bgzf.h>
+ *      -lbiolibc -lxtend
+ *
+ *  Description:
+ *      Mutator for blocks member in a bl_bgzf_t structure.
+ *      Use this function to set blocks in a bl_bgzf_t object
+ *      from non-member functions.  This function performs a direct
+ *      assignment for scalar or pointer structure members.  If
+ *      blocks is a pointer, data previously pointed to should
+ *      be freed before calling this function to avoid memory
+ *      leaks.
+ *
+ *  Arguments:
+ *      bl_bgzf_ptr     Pointer to the structure to set
+ *      new_blocks      The new value for blocks
+ *
+ *  Returns:
+ *      BL_BGZF_DATA_OK if the new value is acceptable and assigned
+ *      BL_BGZF_DATA_OUT_OF_RANGE otherwise
+ *
+ *  Examples:
+ *      bl_bgzf_t       bl_bgzf;
+ *      bl_bgzf_block_t *      new_blocks;
+ *
+ *      if ( bl_bgzf_set_blocks(&bl_bgzf, new_blocks)
+ *              == BL_BGZF_DATA_OK )
+ *      {
+ *      }
+ *
+ *  See also:
+ *      (3)
+ *
+ *  History: 
+ *  Date        Name        Modification
+ *  2026-10-17  gen-get-set Auto-generated from bgzf.h
+ ***************************************************************************/
+
+int     bl_bgzf_set_blocks(
+	    bl_bgzf_t *bl_bgzf_ptr,
+	    bl_bgzf_block_t *new_blocks
+	)
+
+{
+    if ( new_blocks == NULL )
+	return BL_BGZF_DATA_OUT_OF_RANGE;
+    else
+    {
+	bl_bgzf_ptr->blocks = new_blocks;
+	return BL_BGZF_DATA_OK;
+    }
+}
+
+
+/***************************************************************************
+ *  Library:
+ *      #include <biolibc/bgzf.h>
+ *      -lbiolibc -lxtend
+ *
+ *  Description:
+ *      Mutator for block_count member in a bl_bgzf_t structure.
+ *      Use this function to set block_count in a bl_bgzf_t object
+ *      from non-member functions.  This function performs a direct
+ *      assignment for scalar or pointer structure members.  If
+ *      block_count is a pointer, data previously pointed to should
+ *      be freed before calling this function to avoid memory
+ *      leaks.
+ *
+ *  Arguments:
+ *      bl_bgzf_ptr     Pointer to the structure to set
+ *      new_block_count The new value for block_count
+ *
+ *  Returns:
+ *      BL_BGZF_DATA_OK if the new value is acceptable and assigned
+ *      BL_BGZF_DATA_OUT_OF_RANGE otherwise
+ *
+ *  Examples:
+ *      bl_bgzf_t       bl_bgzf;
+ *      size_t          new_block_count;
+ *
+ *      if ( bl_bgzf_set_block_count(&bl_bgzf, new_block_count)
+ *              == BL_BGZF_DATA_OK )
+ *      {
+ *      }
+ *
+ *  See also:
+ *      (3)
+ *
+ *  History: 
+ *  Date        Name        Modification
+ *  2026-10-17  gen-get-set Auto-generated from bgzf.h
+ ***************************************************************************/
+
+int     bl_bgzf_set_block_count(
+	    bl_bgzf_t *bl_bgzf_ptr,
+	    size_t new_block_count
+	)
+
+{
+    if ( false )
+	return BL_BGZF_DATA_OUT_OF_RANGE;
+    else
+    {
+	bl_bgzf_ptr->block_count = new_block_count;
+	return BL_BGZF_DATA_OK;
+    }
+}
+
+
+/***************************************************************************
+ *  Library:
+ *      #include <biolibc/bgzf.h>
+ *      -lbiolibc -lxtend
+ *
+ *  Description:
+ *      Mutator for blocks_loaded member in a bl_bgzf_t structure.
+ *      Use this function to set blocks_loaded in a bl_bgzf_t object
+ *      from non-member functions.  This function performs a direct
+ *      assignment for scalar or pointer structure members.  If
+ *      blocks_loaded is a pointer, data previously pointed to should
+ *      be freed before calling this function to avoid memory
+ *      leaks.
+ *
+ *  Arguments:
+ *      bl_bgzf_ptr     Pointer to the structure to set
+ *      new_blocks_loaded The new value for blocks_loaded
+ *
+ *  Returns:
+ *      BL_BGZF_DATA_OK if the new value is acceptable and assigned
+ *      BL_BGZF_DATA_OUT_OF_RANGE otherwise
+ *
+ *  Examples:
+ *      bl_bgzf_t       bl_bgzf;
+ *      size_t          new_blocks_loaded;
+ *
+ *      if ( bl_bgzf_set_blocks_loaded(&bl_bgzf, new_blocks_loaded)
+ *              == BL_BGZF_DATA_OK )
+ *      {
+ *      }
+ *
+ *  See also:
+ *      (3)
+ *
+ *  History: 
+ *  Date        Name        Modification
+ *  2026-10-17  gen-get-set Auto-generated from bgzf.h
+ ***************************************************************************/
+
+int     bl_bgzf_set_blocks_loaded(
+	    bl_bgzf_t *bl_bgzf_ptr,
+	    size_t new_blocks_loaded
+	)
+
+{
+    if ( false )
+	return BL_BGZF_DATA_OUT_OF_RANGE;
+    else
+    {
+	bl_bgzf_ptr->blocks_loaded = new_blocks_loaded;
+	return BL_BGZF_DATA_OK;
+    }
+}
+
+
+/***************************************************************************
+ *  Library:
+ *      #include <biolibc/bgzf.h>
+ *      -lbiolibc -lxtend
+ *
+ *  Description:
+ *      Mutator for blocks_claimed member in a bl_bgzf_t structure.
+ *      Use this function to set blocks_claimed in a bl_bgzf_t object
+ *      from non-member functions.  This function performs a direct
+ *      assignment for scalar or pointer structure members.  If
+ *      blocks_claimed is a pointer, data previously pointed to should
+ *      be freed before calling this function to avoid memory
+ *      leaks.
+ *
+ *  Arguments:
+ *      bl_bgzf_ptr     Pointer to the structure to set
+ *      new_blocks_claimed The new value for blocks_claimed
+ *
+ *  Returns:
+ *      BL_BGZF_DATA_OK if the new value is acceptable and assigned
+ *      BL_BGZF_DATA_OUT_OF_RANGE otherwise
+ *
+ *  Examples:
+ *      bl_bgzf_t       bl_bgzf;
+ *      size_t          new_blocks_claimed;
+ *
+ *      if ( bl_bgzf_set_blocks_claimed(&bl_bgzf, new_blocks_claimed)
+ *              == BL_BGZF_DATA_OK )
+ *      {
+ *      }
+ *
+ *  See also:
+ *      (3)
+ *
+ *  History: 
+ *  Date        Name        Modification
+ *  2026-10-17  gen-get-set Auto-generated from bgzf.h
+ ***************************************************************************/
+
+int     bl_bgzf_set_blocks_claimed(
+	    bl_bgzf_t *bl_bgzf_ptr,
+	    size_t new_blocks_claimed
+	)
+
+{
+    if ( false )
+	return BL_BGZF_DATA_OUT_OF_RANGE;
+    else
+    {
+	bl_bgzf_ptr->blocks_claimed = new_blocks_claimed;
+	return BL_BGZF_DATA_OK;
+    }
+}
+
+
+/***************************************************************************
+ *  Library:
+ *      #include <biolibc/bgzf.h>
+ *      -lbiolibc -lxtend
+ *
+ *  Description:
+ *      Mutator for blocks_consumed member in a bl_bgzf_t structure.
+ *      Use this function to set blocks_consumed in a bl_bgzf_t object
+ *      from non-member functions.  This function performs a direct
+ *      assignment for scalar or pointer structure members.  If
+ *      blocks_consumed is a pointer, data previously pointed to should
+ *      be freed before calling this function to avoid memory
+ *      leaks.
+ *
+ *  Arguments:
+ *      bl_bgzf_ptr     Pointer to the structure to set
+ *      new_blocks_consumed The new value for blocks_consumed
+ *
+ *  Returns:
+ *      BL_BGZF_DATA_OK if the new value is acceptable and assigned
+ *      BL_BGZF_DATA_OUT_OF_RANGE otherwise
+ *
+ *  Examples:
+ *      bl_bgzf_t       bl_bgzf;
+ *      size_t          new_blocks_consumed;
+ *
+ *      if ( bl_bgzf_set_blocks_consumed(&bl_bgzf, new_blocks_consumed)
+ *              == BL_BGZF_DATA_OK )
+ *      {
+ *      }
+ *
+ *  See also:
+ *      (3)
+ *
+ *  History: 
+ *  Date        Name        Modification
+ *  2026-10-17  gen-get-set Auto-generated from bgzf.h
+ ***************************************************************************/
+
+int     bl_bgzf_set_blocks_consumed(
+	    bl_bgzf_t *bl_bgzf_ptr,
+	    size_t new_blocks_consumed
+	)
+
+{
+    if ( false )
+	return BL_BGZF_DATA_OUT_OF_RANGE;
+    else
+    {
+	bl_bgzf_ptr->blocks_consumed = new_blocks_consumed;
+	return BL_BGZF_DATA_OK;
+    }
+}
+
+
+/***************************************************************************
+ *  Library:
+ *      #include <biolibc/bgzf.h>
+ *      -lbiolibc -lxtend
+ *
+ *  Description:
+ *      Mutator for block_pos member in a bl_bgzf_t structure.
+ *      Use this function to set block_pos in a bl_bgzf_t object
+ *      from non-member functions.  This function performs a direct
+ *      assignment for scalar or pointer structure members.  If
+ *      block_pos is a pointer, data previously pointed to should
+ *      be freed before calling this function to avoid memory
+ *      leaks.
+ *
+ *  Arguments:
+ *      bl_bgzf_ptr     Pointer to the structure to set
+ *      new_block_pos   The new value for block_pos
+ *
+ *  Returns:
+ *      BL_BGZF_DATA_OK if the new value is acceptable and assigned
+ *      BL_BGZF_DATA_OUT_OF_RANGE otherwise
+ *
+ *  Examples:
+ *      bl_bgzf_t       bl_bgzf;
+ *      size_t          new_block_pos;
+ *
+ *      if ( bl_bgzf_set_block_pos(&bl_bgzf, new_block_pos)
+ *              == BL_BGZF_DATA_OK )
+ *      {
+ *      }
+ *
+ *  See also:
+ *      (3)
+ *
+ *  History: 
+ *  Date        Name        Modification
+ *  2026-10-17  gen-get-set Auto-generated from bgzf.h
+ ***************************************************************************/
+
+int     bl_bgzf_set_block_pos(
+	    bl_bgzf_t *bl_bgzf_ptr,
+	    size_t new_block_pos
+	)
+
+{
+    if ( false )
+	return BL_BGZF_DATA_OUT_OF_RANGE;
+    else
+    {
+	bl_bgzf_ptr->block_pos = new_block_pos;
+	return BL_BGZF_DATA_OK;
+    }
+}
+
+
+/***************************************************************************
+ *  Library:
+ *      #include <biolibc/bgzf.h>
+ *      -lbiolibc -lxtend
+ *
+ *  Description:
+ *      Mutator for eof member in a bl_bgzf_t structure.
+ *      Use this function to set eof in a bl_bgzf_t object
+ *      from non-member functions.  This function performs a direct
+ *      assignment for scalar or pointer structure members.  If
+ *      eof is a pointer, data previously pointed to should
+ *      be freed before calling this function to avoid memory
+ *      leaks.
+ *
+ *  Arguments:
+ *      bl_bgzf_ptr     Pointer to the structure to set
+ *      new_eof         The new value for eof
+ *
+ *  Returns:
+ *      BL_BGZF_DATA_OK if the new value is acceptable and assigned
+ *      BL_BGZF_DATA_OUT_OF_RANGE otherwise
+ *
+ *  Examples:
+ *      bl_bgzf_t       bl_bgzf;
+ *      int             new_eof;
+ *
+ *      if ( bl_bgzf_set_eof(&bl_bgzf, new_eof)
+ *              == BL_BGZF_DATA_OK )
+ *      {
+ *      }
+ *
+ *  See also:
+ *      (3)
+ *
+ *  History: 
+ *  Date        Name        Modification
+ *  2026-10-17  gen-get-set Auto-generated from bgzf.h
+ ***************************************************************************/
+
+int     bl_bgzf_set_eof(
+	    bl_bgzf_t *bl_bgzf_ptr,
+	    int new_eof
+	)
+
+{
+    if ( false )
+	return BL_BGZF_DATA_OUT_OF_RANGE;
+    else
+    {
+	bl_bgzf_ptr->eof = new_eof;
+	return BL_BGZF_DATA_OK;
+    }
+}
+
+
+/***************************************************************************
+ *  Library:
+ *      #include <biolibc/bgzf.h>
+ *      -lbiolibc -lxtend
+ *
+ *  Description:
+ *      Mutator for shutdown member in a bl_bgzf_t structure.
+ *      Use this function to set shutdown in a bl_bgzf_t object
+ *      from non-member functions.  This function performs a direct
+ *      assignment for scalar or pointer structure members.  If
+ *      shutdown is a pointer, data previously pointed to should
+ *      be freed before calling this function to avoid memory
+ *      leaks.
+ *
+ *  Arguments:
+ *      bl_bgzf_ptr     Pointer to the structure to set
+ *      new_shutdown    The new value for shutdown
+ *
+ *  Returns:
+ *      BL_BGZF_DATA_OK if the new value is acceptable and assigned
+ *      BL_BGZF_DATA_OUT_OF_RANGE otherwise
+ *
+ *  Examples:
+ *      bl_bgzf_t       bl_bgzf;
+ *      int             new_shutdown;
+ *
+ *      if ( bl_bgzf_set_shutdown(&bl_bgzf, new_shutdown)
+ *              == BL_BGZF_DATA_OK )
+ *      {
+ *      }
+ *
+ *  See also:
+ *      (3)
+ *
+ *  History: 
+ *  Date        Name        Modification
+ *  2026-10-17  gen-get-set Auto-generated from bgzf.h
+ ***************************************************************************/
+
+int     bl_bgzf_set_shutdown(
+	    bl_bgzf_t *bl_bgzf_ptr,
+	    int new_shutdown
+	)
+
+{
+    if ( false )
+	return BL_BGZF_DATA_OUT_OF_RANGE;
+    else
+    {
+	bl_bgzf_ptr->shutdown = new_shutdown;
+	return BL_BGZF_DATA_OK;
+    }
+}
+
+
+/***************************************************************************
+ *  Library:
+ *      #include <biolibc/bgzf.h>
+ *      -lbiolibc -lxtend
+ *
+ *  Description:
+ *      Mutator for write_error member in a bl_bgzf_t structure.
+ *      Use this function to set write_error in a bl_bgzf_t object
+ *      from non-member functions.  This function performs a direct
+ *      assignment for scalar or pointer structure members.  If
+ *      write_error is a pointer, data previously pointed to should
+ *      be freed before calling this function to avoid memory
+ *      leaks.
+ *
+ *  Arguments:
+ *      bl_bgzf_ptr     Pointer to the structure to set
+ *      new_write_error The new value for write_error
+ *
+ *  Returns:
+ *      BL_BGZF_DATA_OK if the new value is acceptable and assigned
+ *      BL_BGZF_DATA_OUT_OF_RANGE otherwise
+ *
+ *  Examples:
+ *      bl_bgzf_t       bl_bgzf;
+ *      int             new_write_error;
+ *
+ *      if ( bl_bgzf_set_write_error(&bl_bgzf, new_write_error)
+ *              == BL_BGZF_DATA_OK )
+ *      {
+ *      }
+ *
+ *  See also:
+ *      (3)
+ *
+ *  History: 
+ *  Date        Name        Modification
+ *  2026-10-17  gen-get-set Auto-generated from bgzf.h
+ ***************************************************************************/
+
+int     bl_bgzf_set_write_error(
+	    bl_bgzf_t *bl_bgzf_ptr,
+	    int new_write_error
+	)
+
+{
+    if ( false )
+	return BL_BGZF_DATA_OUT_OF_RANGE;
+    else
+    {
+	bl_bgzf_ptr->write_error = new_write_error;
+	return BL_BGZF_DATA_OK;
+    }
+}
+
+
+/***************************************************************************
+ *  Library:
+ *      #include <biolibc/bgzf.h>
+ *      -lbiolibc -lxtend
+ *
+ *  Description:
+ *      Mutator for workers member in a bl_bgzf_t structure.
+ *      Use this function to set workers in a bl_bgzf_t object
+ *      from non-member functions.  This function performs a direct
+ *      assignment for scalar or pointer structure members.  If
+ *      workers is a pointer, data previously pointed to should
+ *      be freed before calling this function to avoid memory
+ *      leaks.
+ *
+ *  Arguments:
+ *      bl_bgzf_ptr     Pointer to the structure to set
+ *      new_workers     The new value for workers
+ *
+ *  Returns:
+ *      BL_BGZF_DATA_OK if the new value is acceptable and assigned
+ *      BL_BGZF_DATA_OUT_OF_RANGE otherwise
+ *
+ *  Examples:
+ *      bl_bgzf_t       bl_bgzf;
+ *      pthread_t *      new_workers;
+ *
+ *      if ( bl_bgzf_set_workers(&bl_bgzf, new_workers)
+ *              == BL_BGZF_DATA_OK )
+ *      {
+ *      }
+ *
+ *  See also:
+ *      (3)
+ *
+ *  History: 
+ *  Date        Name        Modification
+ *  2026-10-17  gen-get-set Auto-generated from bgzf.h
+ ***************************************************************************/
+
+int     bl_bgzf_set_workers(
+	    bl_bgzf_t *bl_bgzf_ptr,
+	    pthread_t *new_workers
+	)
+
+{
+    if ( new_workers == NULL )
+	return BL_BGZF_DATA_OUT_OF_RANGE;
+    else
+    {
+	bl_bgzf_ptr->workers = new_workers;
+	return BL_BGZF_DATA_OK;
+    }
+}
@@ -0,0 +1,37 @@
+
+/*
+ *  Generated by /usr/local/bin/auto-gen-get-set
+ *
+ *  Mutator functions for setting with no sanity checking.  Use these to
+ *  set structure members from functions outside the bl_bgzf_t
+ *  class.  These macros perform no data validation.  Hence, they achieve
+ *  maximum performance where data are guaranteed correct by other means.
+ *  Use the mutator functions (same name as the macro, but lower case)
+ *  for more robust code with a small performance penalty.
+ *
+ *  These generated macros are not expected to be perfect.  Check and edit
+ *  as needed before adding to your code.
+ */
+
+/* temp-bgzf-mutators.c */
+int bl_bgzf_set_stream(bl_bgzf_t *bl_bgzf_ptr, FILE *new_stream);
+int bl_bgzf_set_format(bl_bgzf_t *bl_bgzf_ptr, int new_format);
+int bl_bgzf_set_writing(bl_bgzf_t *bl_bgzf_ptr, int new_writing);
+int bl_bgzf_set_level(bl_bgzf_t *bl_bgzf_ptr, int new_level);
+int bl_bgzf_set_threads(bl_bgzf_t *bl_bgzf_ptr, unsigned new_threads);
+int bl_bgzf_set_buff(bl_bgzf_t *bl_bgzf_ptr, unsigned char *new_buff);
+int bl_bgzf_set_buff_ae(bl_bgzf_t *bl_bgzf_ptr, size_t c, unsigned char new_buff_element);
+int bl_bgzf_set_buff_cpy(bl_bgzf_t *bl_bgzf_ptr, unsigned char *new_buff, size_t array_size);
+int bl_bgzf_set_buff_len(bl_bgzf_t *bl_bgzf_ptr, size_t new_buff_len);
+int bl_bgzf_set_buff_pos(bl_bgzf_t *bl_bgzf_ptr, size_t new_buff_pos);
+int bl_bgzf_set_stream_eof(bl_bgzf_t *bl_bgzf_ptr, int new_stream_eof);
+int bl_bgzf_set_blocks(bl_bgzf_t *bl_bgzf_ptr, bl_bgzf_block_t *new_blocks);
+int bl_bgzf_set_block_count(bl_bgzf_t *bl_bgzf_ptr, size_t new_block_count);
+int bl_bgzf_set_blocks_loaded(bl_bgzf_t *bl_bgzf_ptr, size_t new_blocks_loaded);
+int bl_bgzf_set_blocks_claimed(bl_bgzf_t *bl_bgzf_ptr, size_t new_blocks_claimed);
+int bl_bgzf_set_blocks_consumed(bl_bgzf_t *bl_bgzf_ptr, size_t new_blocks_consumed);
+int bl_bgzf_set_block_pos(bl_bgzf_t *bl_bgzf_ptr, size_t new_block_pos);
+int bl_bgzf_set_eof(bl_bgzf_t *bl_bgzf_ptr, int new_eof);
+int bl_bgzf_set_shutdown(bl_bgzf_t *bl_bgzf_ptr, int new_shutdown);
+int bl_bgzf_set_write_error(bl_bgzf_t *bl_bgzf_ptr, int new_write_error);
+int bl_bgzf_set_workers(bl_bgzf_t *bl_bgzf_ptr, pthread_t *new_workers);
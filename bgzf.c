@@ -0,0 +1,1237 @@
+#ifdef __linux__
+#define _GNU_SOURCE             // fopencookie()
+#endif
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <stdbool.h>
+#include <errno.h>
+#include <unistd.h>
+#include <sysexits.h>
+#include <xtend/mem.h>
+#include <xtend/math.h>         // XT_MIN()
+#include "bgzf.h"
+
+/***************************************************************************
+ *  Name:
+ *      bl_bgzf_open() - Attach a decompressor to a gzip or BGZF stream
+ *
+ *  Library:
+ *      #include <biolibc/bgzf.h>
+ *      -lbiolibc -lxtend -lz -lpthread
+ *
+ *  Description:
+ *      Prepare a bl_bgzf_t object for reading decompressed data from
+ *      stream with bl_bgzf_read(3).  The format is detected from the
+ *      first bytes of the stream, so pipes and other non-seekable
+ *      streams are supported.
+ *
+ *      BGZF input (as produced by bgzip(1) and used inside BAM files)
+ *      is read in independent blocks of at most 64 KiB, which are
+ *      inflated in parallel by threads worker threads and returned in
+ *      file order.  A threads value of 0 uses one thread per online
+ *      CPU, up to BL_BGZF_AUTO_THREADS_MAX.  Ordinary gzip input,
+ *      including concatenated members, is inflated serially in the
+ *      calling thread and threads is ignored.  Data that are not
+ *      gzip-compressed are passed through unchanged.
+ *
+ *      The stream is not closed by bl_bgzf_close(3).  Use
+ *      bl_bgzf_fopen(3) to get a FILE stream that can be read with
+ *      ordinary stdio functions.
+ *
+ *  Arguments:
+ *      bgzf        Pointer to a bl_bgzf_t object
+ *      stream      FILE stream open for reading
+ *      threads     Number of BGZF worker threads, 0 for automatic
+ *
+ *  Returns:
+ *      BL_BGZF_OK on success
+ *      BL_BGZF_MALLOC_FAILED if memory could not be allocated
+ *      BL_BGZF_THREAD_FAILED if worker threads could not be started
+ *
+ *  Examples:
+ *      bl_bgzf_t   bgzf;
+ *      char        buff[65536];
+ *      ssize_t     bytes;
+ *
+ *      if ( bl_bgzf_open(&bgzf, stdin, 4) == BL_BGZF_OK )
+ *      {
+ *          while ( (bytes = bl_bgzf_read(&bgzf, buff, 65536)) > 0 )
+ *              fwrite(buff, bytes, 1, stdout);
+ *          bl_bgzf_close(&bgzf);
+ *      }
+ *
+ *  See also:
+ *      bl_bgzf_read(3), bl_bgzf_close(3), bl_bgzf_fopen(3)
+ *
+ *  History: 
+ *  Date        Name        Modification
+ *  2026-10-17  agent       Begin
+ ***************************************************************************/
+
+int     bl_bgzf_open(bl_bgzf_t *bgzf, FILE *stream, unsigned threads)
+
+{
+    unsigned char   *h;
+    size_t  c;
+    long    cpus;
+
+    bgzf->stream = stream;
+    bgzf->buff_pos = 0;
+    bgzf->stream_eof = 0;
+    bgzf->blocks = NULL;
+    bgzf->block_count = 0;
+    bgzf->blocks_loaded = 0;
+    bgzf->blocks_consumed = 0;
+    bgzf->block_pos = 0;
+    bgzf->eof = 0;
+    bgzf->shutdown = 0;
+    bgzf->workers = NULL;
+    bgzf->threads = 0;
+    bgzf->writing = 0;
+    bgzf->blocks_claimed = 0;
+    bgzf->write_error = 0;
+
+    if ( (bgzf->buff = xt_malloc(BL_BGZF_BUFF_SIZE,
+				 sizeof(*bgzf->buff))) == NULL )
+	return BL_BGZF_MALLOC_FAILED;
+
+    // Enough to identify a BGZF header, but no more than one block needs
+    h = bgzf->buff;
+    bgzf->buff_len = fread(h, 1, BL_BGZF_HEADER_BYTES, stream);
+    if ( (bgzf->buff_len < 2) || (h[0] != 0x1f) || (h[1] != 0x8b) )
+    {
+	bgzf->format = BL_BGZF_FORMAT_RAW;
+	return BL_BGZF_OK;
+    }
+
+    // FEXTRA with a single 6-byte "BC" subfield holding the block size
+    if ( (bgzf->buff_len == BL_BGZF_HEADER_BYTES) && (h[2] == 8) &&
+	 (h[3] & 4) && (h[10] == 6) && (h[11] == 0) &&
+	 (h[12] == 'B') && (h[13] == 'C') && (h[14] == 2) && (h[15] == 0) )
+	bgzf->format = BL_BGZF_FORMAT_BGZF;
+    else
+    {
+	bgzf->format = BL_BGZF_FORMAT_GZIP;
+	memset(&bgzf->zstream, 0, sizeof(bgzf->zstream));
+	// 15 + 16: Maximum window, expect gzip header and trailer
+	if ( inflateInit2(&bgzf->zstream, 15 + 16) != Z_OK )
+	{
+	    free(bgzf->buff);
+	    return BL_BGZF_MALLOC_FAILED;
+	}
+	bgzf->zstream.next_in = bgzf->buff;
+	bgzf->zstream.avail_in = bgzf->buff_len;
+	return BL_BGZF_OK;
+    }
+
+    if ( threads == 0 )
+    {
+	cpus = sysconf(_SC_NPROCESSORS_ONLN);
+	threads = cpus < 1 ? 1 : XT_MIN(cpus, BL_BGZF_AUTO_THREADS_MAX);
+    }
+    bgzf->block_count = threads * BL_BGZF_BLOCKS_PER_THREAD;
+    bgzf->blocks = xt_malloc(bgzf->block_count, sizeof(*bgzf->blocks));
+    bgzf->workers = xt_malloc(threads, sizeof(*bgzf->workers));
+    if ( (bgzf->blocks == NULL) || (bgzf->workers == NULL) )
+    {
+	free(bgzf->blocks);
+	free(bgzf->workers);
+	free(bgzf->buff);
+	return BL_BGZF_MALLOC_FAILED;
+    }
+    for (c = 0; c < bgzf->block_count; ++c)
+	bgzf->blocks[c].state = BL_BGZF_BLOCK_EMPTY;
+
+    pthread_mutex_init(&bgzf->lock, NULL);
+    pthread_cond_init(&bgzf->block_free, NULL);
+    pthread_cond_init(&bgzf->block_ready, NULL);
+    for (bgzf->threads = 0; bgzf->threads < threads; ++bgzf->threads)
+    {
+	if ( pthread_create(&bgzf->workers[bgzf->threads], NULL,
+			    bl_bgzf_inflate_thread, bgzf) != 0 )
+	{
+	    bl_bgzf_close(bgzf);
+	    return BL_BGZF_THREAD_FAILED;
+	}
+    }
+    return BL_BGZF_OK;
+}
+
+
+/***************************************************************************
+ *  Name:
+ *      bl_bgzf_read() - Read decompressed data from a gzip or BGZF stream
+ *
+ *  Library:
+ *      #include <biolibc/bgzf.h>
+ *      -lbiolibc -lxtend -lz -lpthread
+ *
+ *  Description:
+ *      Read up to count bytes of decompressed data from a stream
+ *      attached with bl_bgzf_open(3), with the same semantics as
+ *      read(2).  Fewer than count bytes are returned only at end of
+ *      input.
+ *
+ *  Arguments:
+ *      bgzf        Pointer to a bl_bgzf_t object
+ *      buff        Buffer to receive decompressed data
+ *      count       Maximum number of bytes to read
+ *
+ *  Returns:
+ *      Number of bytes read, 0 at end of input, or -1 if the input is
+ *      corrupt or truncated, with errno set to EIO
+ *
+ *  See also:
+ *      bl_bgzf_open(3), bl_bgzf_close(3)
+ *
+ *  History: 
+ *  Date        Name        Modification
+ *  2026-10-17  agent       Begin
+ ***************************************************************************/
+
+ssize_t bl_bgzf_read(bl_bgzf_t *bgzf, void *buff, size_t count)
+
+{
+    bl_bgzf_block_t *block;
+    size_t  total, len;
+    int     status;
+    bool    at_eof;
+
+    if ( bgzf->format == BL_BGZF_FORMAT_RAW )
+    {
+	// Bytes consumed by format detection come first
+	len = XT_MIN(bgzf->buff_len - bgzf->buff_pos, count);
+	memcpy(buff, bgzf->buff + bgzf->buff_pos, len);
+	bgzf->buff_pos += len;
+	return len + fread((char *)buff + len, 1, count - len, bgzf->stream);
+    }
+    else if ( bgzf->format == BL_BGZF_FORMAT_GZIP )
+    {
+	bgzf->zstream.next_out = buff;
+	bgzf->zstream.avail_out = count;
+	while ( bgzf->zstream.avail_out > 0 )
+	{
+	    if ( bgzf->zstream.avail_in == 0 )
+	    {
+		if ( ! bgzf->stream_eof )
+		    bgzf->buff_len = fread(bgzf->buff, 1, BL_BGZF_BUFF_SIZE,
+					   bgzf->stream);
+		if ( bgzf->stream_eof || (bgzf->buff_len == 0) )
+		{
+		    bgzf->stream_eof = 1;
+		    // eof is set only between gzip members
+		    if ( ! bgzf->eof )
+		    {
+			errno = EIO;
+			return -1;
+		    }
+		    break;
+		}
+		bgzf->zstream.next_in = bgzf->buff;
+		bgzf->zstream.avail_in = bgzf->buff_len;
+	    }
+	    bgzf->eof = 0;
+	    status = inflate(&bgzf->zstream, Z_NO_FLUSH);
+	    if ( status == Z_STREAM_END )
+	    {
+		// Concatenated members, e.g. from "cat a.gz b.gz"
+		bgzf->eof = 1;
+		inflateReset(&bgzf->zstream);
+	    }
+	    else if ( status != Z_OK )
+	    {
+		errno = EIO;
+		return -1;
+	    }
+	}
+	return count - bgzf->zstream.avail_out;
+    }
+
+    for (total = 0; total < count; )
+    {
+	block = &bgzf->blocks[bgzf->blocks_consumed % bgzf->block_count];
+	pthread_mutex_lock(&bgzf->lock);
+	while ( ! ((bgzf->blocks_consumed < bgzf->blocks_loaded) &&
+		   (block->state == BL_BGZF_BLOCK_DONE)) &&
+		! ((bgzf->blocks_consumed == bgzf->blocks_loaded) &&
+		   bgzf->eof) )
+	    pthread_cond_wait(&bgzf->block_ready, &bgzf->lock);
+	at_eof = (bgzf->blocks_consumed == bgzf->blocks_loaded);
+	pthread_mutex_unlock(&bgzf->lock);
+
+	// Workers do not touch an inflated block until it is released
+	if ( at_eof )
+	    break;
+	if ( block->status != BL_BGZF_OK )
+	{
+	    errno = EIO;
+	    return -1;
+	}
+
+	len = XT_MIN(block->udata_len - bgzf->block_pos, count - total);
+	memcpy((char *)buff + total, block->udata + bgzf->block_pos, len);
+	bgzf->block_pos += len;
+	total += len;
+	if ( bgzf->block_pos == block->udata_len )
+	{
+	    pthread_mutex_lock(&bgzf->lock);
+	    block->state = BL_BGZF_BLOCK_EMPTY;
+	    ++bgzf->blocks_consumed;
+	    pthread_cond_signal(&bgzf->block_free);
+	    pthread_mutex_unlock(&bgzf->lock);
+	    bgzf->block_pos = 0;
+	}
+    }
+    return total;
+}
+
+
+/***************************************************************************
+ *  Name:
+ *      bl_bgzf_close() - Detach a compressor or decompressor from a stream
+ *
+ *  Library:
+ *      #include <biolibc/bgzf.h>
+ *      -lbiolibc -lxtend -lz -lpthread
+ *
+ *  Description:
+ *      Stop worker threads and free all memory allocated by
+ *      bl_bgzf_open(3) or bl_bgzf_open_write(3).  When writing, any
+ *      partially filled block is compressed and written first, followed
+ *      by the BGZF end-of-file marker.  The underlying stream is not
+ *      closed.
+ *
+ *  Arguments:
+ *      bgzf        Pointer to a bl_bgzf_t object
+ *
+ *  Returns:
+ *      BL_BGZF_OK on success
+ *      BL_BGZF_WRITE_FAILED if compressed data could not be written
+ *
+ *  See also:
+ *      bl_bgzf_open(3), bl_bgzf_read(3), bl_bgzf_open_write(3),
+ *      bl_bgzf_write(3)
+ *
+ *  History: 
+ *  Date        Name        Modification
+ *  2026-10-17  agent       Begin
+ *  2026-10-17  agent       Add write mode
+ ***************************************************************************/
+
+int     bl_bgzf_close(bl_bgzf_t *bgzf)
+
+{
+    unsigned    c;
+    int         status = BL_BGZF_OK;
+
+    if ( bgzf->format == BL_BGZF_FORMAT_GZIP )
+	inflateEnd(&bgzf->zstream);
+    else if ( bgzf->format == BL_BGZF_FORMAT_BGZF )
+    {
+	if ( bgzf->writing && (bgzf->block_pos > 0) )
+	    bl_bgzf_flush(bgzf);
+	pthread_mutex_lock(&bgzf->lock);
+	bgzf->shutdown = 1;
+	pthread_cond_broadcast(&bgzf->block_free);
+	pthread_cond_broadcast(&bgzf->block_ready);
+	pthread_mutex_unlock(&bgzf->lock);
+	for (c = 0; c < bgzf->threads; ++c)
+	    pthread_join(bgzf->workers[c], NULL);
+	
+	// Workers have written every block they were handed
+	if ( bgzf->writing && (bgzf->write_error ||
+	     (fwrite(BL_BGZF_EOF_BLOCK, BL_BGZF_EOF_BLOCK_BYTES, 1,
+		     bgzf->stream) != 1)) )
+	    status = BL_BGZF_WRITE_FAILED;
+	pthread_cond_destroy(&bgzf->block_ready);
+	pthread_cond_destroy(&bgzf->block_free);
+	pthread_mutex_destroy(&bgzf->lock);
+	free(bgzf->workers);
+	free(bgzf->blocks);
+	bgzf->workers = NULL;
+	bgzf->blocks = NULL;
+	bgzf->threads = 0;
+    }
+    free(bgzf->buff);
+    bgzf->buff = NULL;
+    bgzf->stream = NULL;
+    return status;
+}
+
+
+/***************************************************************************
+ *  Name:
+ *      bl_bgzf_load_block() - Read one compressed BGZF block
+ *
+ *  Library:
+ *      #include <biolibc/bgzf.h>
+ *      -lbiolibc -lxtend -lz -lpthread
+ *
+ *  Description:
+ *      Read the next compressed block from the stream attached to bgzf
+ *      into block->cdata, using the block size from the BGZF header.
+ *      Called by worker threads with bgzf->lock held, so that blocks
+ *      are read in file order.
+ *
+ *  Arguments:
+ *      bgzf        Pointer to a bl_bgzf_t object
+ *      block       Pointer to an empty bl_bgzf_block_t object
+ *
+ *  Returns:
+ *      BL_BGZF_OK on success
+ *      EOF at the end of the stream
+ *      BL_BGZF_BAD_DATA if the header is invalid or the block is truncated
+ *
+ *  See also:
+ *      bl_bgzf_inflate_block(3), bl_bgzf_inflate_thread(3)
+ *
+ *  History: 
+ *  Date        Name        Modification
+ *  2026-10-17  agent       Begin
+ ***************************************************************************/
+
+int     bl_bgzf_load_block(bl_bgzf_t *bgzf, bl_bgzf_block_t *block)
+
+{
+    unsigned char   *h = block->cdata;
+    size_t  len;
+
+    // Header bytes consumed by format detection come first
+    len = XT_MIN(bgzf->buff_len - bgzf->buff_pos, BL_BGZF_HEADER_BYTES);
+    memcpy(h, bgzf->buff + bgzf->buff_pos, len);
+    bgzf->buff_pos += len;
+    len += fread(h + len, 1, BL_BGZF_HEADER_BYTES - len, bgzf->stream);
+    if ( len == 0 )
+	return EOF;
+
+    if ( (len != BL_BGZF_HEADER_BYTES) || (h[0] != 0x1f) || (h[1] != 0x8b)
+	 || (h[2] != 8) || !(h[3] & 4) || (h[10] != 6) || (h[11] != 0)
+	 || (h[12] != 'B') || (h[13] != 'C') || (h[14] != 2) || (h[15] != 0) )
+	return BL_BGZF_BAD_DATA;
+
+    // BSIZE is the total block size - 1
+    block->cdata_len = (h[16] | (h[17] << 8)) + 1;
+    if ( block->cdata_len < BL_BGZF_HEADER_BYTES + 8 )
+	return BL_BGZF_BAD_DATA;
+    len = block->cdata_len - BL_BGZF_HEADER_BYTES;
+    if ( fread(h + BL_BGZF_HEADER_BYTES, 1, len, bgzf->stream) != len )
+	return BL_BGZF_BAD_DATA;
+    return BL_BGZF_OK;
+}
+
+
+/***************************************************************************
+ *  Name:
+ *      bl_bgzf_inflate_block() - Decompress one BGZF block
+ *
+ *  Library:
+ *      #include <biolibc/bgzf.h>
+ *      -lbiolibc -lxtend -lz -lpthread
+ *
+ *  Description:
+ *      Inflate block->cdata into block->udata and verify the length and
+ *      CRC32 in the gzip trailer.  zstream must have been initialized
+ *      for raw deflate data with inflateInit2(zstream, -15).  Each
+ *      thread uses its own zstream, so blocks can be inflated
+ *      concurrently.
+ *
+ *  Arguments:
+ *      block       Pointer to a loaded bl_bgzf_block_t object
+ *      zstream     Raw inflate stream owned by the calling thread
+ *
+ *  Returns:
+ *      BL_BGZF_OK on success
+ *      BL_BGZF_BAD_DATA if the block is corrupt
+ *
+ *  See also:
+ *      bl_bgzf_load_block(3), bl_bgzf_inflate_thread(3)
+ *
+ *  History: 
+ *  Date        Name        Modification
+ *  2026-10-17  agent       Begin
+ ***************************************************************************/
+
+int     bl_bgzf_inflate_block(bl_bgzf_block_t *block, z_stream *zstream)
+
+{
+    unsigned char   *trailer = block->cdata + block->cdata_len - 8;
+    uint32_t        crc, isize;
+
+    inflateReset(zstream);
+    zstream->next_in = block->cdata + BL_BGZF_HEADER_BYTES;
+    zstream->avail_in = block->cdata_len - BL_BGZF_HEADER_BYTES - 8;
+    zstream->next_out = block->udata;
+    zstream->avail_out = BL_BGZF_BLOCK_MAX_BYTES;
+    if ( inflate(zstream, Z_FINISH) != Z_STREAM_END )
+	return BL_BGZF_BAD_DATA;
+    block->udata_len = BL_BGZF_BLOCK_MAX_BYTES - zstream->avail_out;
+
+    crc = trailer[0] | trailer[1] << 8 | trailer[2] << 16 |
+	  (uint32_t)trailer[3] << 24;
+    isize = trailer[4] | trailer[5] << 8 | trailer[6] << 16 |
+	    (uint32_t)trailer[7] << 24;
+    if ( (isize != block->udata_len) ||
+	 (crc32(0L, block->udata, block->udata_len) != crc) )
+	return BL_BGZF_BAD_DATA;
+    return BL_BGZF_OK;
+}
+
+
+/***************************************************************************
+ *  Name:
+ *      bl_bgzf_inflate_thread() - BGZF worker thread
+ *
+ *  Library:
+ *      #include <biolibc/bgzf.h>
+ *      -lbiolibc -lxtend -lz -lpthread
+ *
+ *  Description:
+ *      Worker thread started by bl_bgzf_open(3).  Each worker repeatedly
+ *      claims the next empty slot in the block ring, reads the next
+ *      compressed block into it with bgzf->lock held, then inflates it
+ *      without the lock so that other workers can proceed.  Workers exit
+ *      at end of input, on corrupt input, or when bl_bgzf_close(3) sets
+ *      bgzf->shutdown.
+ *
+ *  Arguments:
+ *      arg     Pointer to the bl_bgzf_t object
+ *
+ *  Returns:
+ *      NULL
+ *
+ *  See also:
+ *      bl_bgzf_open(3), bl_bgzf_load_block(3), bl_bgzf_inflate_block(3)
+ *
+ *  History: 
+ *  Date        Name        Modification
+ *  2026-10-17  agent       Begin
+ ***************************************************************************/
+
+void    *bl_bgzf_inflate_thread(void *arg)
+
+{
+    bl_bgzf_t       *bgzf = arg;
+    bl_bgzf_block_t *block;
+    z_stream        zstream;
+    int             status;
+
+    memset(&zstream, 0, sizeof(zstream));
+    if ( inflateInit2(&zstream, -15) != Z_OK )
+    {
+	fprintf(stderr, "bl_bgzf_inflate_thread(): Could not allocate zstream.\n");
+	exit(EX_UNAVAILABLE);
+    }
+
+    pthread_mutex_lock(&bgzf->lock);
+    while ( true )
+    {
+	while ( ! bgzf->shutdown && ! bgzf->eof &&
+		(bgzf->blocks[bgzf->blocks_loaded % bgzf->block_count].state
+		 != BL_BGZF_BLOCK_EMPTY) )
+	    pthread_cond_wait(&bgzf->block_free, &bgzf->lock);
+	if ( bgzf->shutdown || bgzf->eof )
+	    break;
+
+	block = &bgzf->blocks[bgzf->blocks_loaded % bgzf->block_count];
+	status = bl_bgzf_load_block(bgzf, block);
+	if ( status != EOF )
+	    ++bgzf->blocks_loaded;
+	if ( status != BL_BGZF_OK )
+	{
+	    // Hand a corrupt block to the reader so it can report it
+	    block->status = status;
+	    block->state = BL_BGZF_BLOCK_DONE;
+	    bgzf->eof = 1;
+	    pthread_cond_broadcast(&bgzf->block_ready);
+	    pthread_cond_broadcast(&bgzf->block_free);
+	    break;
+	}
+	block->state = BL_BGZF_BLOCK_LOADED;
+
+	pthread_mutex_unlock(&bgzf->lock);
+	status = bl_bgzf_inflate_block(block, &zstream);
+	pthread_mutex_lock(&bgzf->lock);
+
+	block->status = status;
+	block->state = BL_BGZF_BLOCK_DONE;
+	pthread_cond_signal(&bgzf->block_ready);
+    }
+    pthread_mutex_unlock(&bgzf->lock);
+    inflateEnd(&zstream);
+    return NULL;
+}
+
+
+/***************************************************************************
+ *  Name:
+ *      bl_bgzf_open_write() - Attach a BGZF compressor to a stream
+ *
+ *  Library:
+ *      #include <biolibc/bgzf.h>
+ *      -lbiolibc -lxtend -lz -lpthread
+ *
+ *  Description:
+ *      Prepare a bl_bgzf_t object for writing BGZF-compressed data to
+ *      stream with bl_bgzf_write(3).  Data are divided into independent
+ *      blocks of BL_BGZF_WRITE_BLOCK_BYTES, which are deflated in
+ *      parallel by threads worker threads and written in order.  A
+ *      threads value of 0 uses one thread per online CPU, up to
+ *      BL_BGZF_AUTO_THREADS_MAX.
+ *
+ *      BGZF output is valid gzip and can be read by gunzip(1) and zcat(1)
+ *      as well as bl_bgzf_open(3), samtools(1), and bgzip(1).
+ *
+ *      bl_bgzf_close(3) must be called to write the final block and
+ *      the end-of-file marker.  It does not close the stream.  Use
+ *      bl_bgzf_fopen_write(3) to get a FILE stream that can be written
+ *      with ordinary stdio functions.
+ *
+ *  Arguments:
+ *      bgzf        Pointer to a bl_bgzf_t object
+ *      stream      FILE stream open for writing
+ *      threads     Number of worker threads, 0 for automatic
+ *      level       zlib compression level 0 to 9, or BL_BGZF_LEVEL_DEFAULT
+ *
+ *  Returns:
+ *      BL_BGZF_OK on success
+ *      BL_BGZF_MALLOC_FAILED if memory could not be allocated
+ *      BL_BGZF_THREAD_FAILED if worker threads could not be started
+ *
+ *  Examples:
+ *      bl_bgzf_t   bgzf;
+ *      char        buff[65536];
+ *      size_t      bytes;
+ *
+ *      if ( bl_bgzf_open_write(&bgzf, stdout, 0,
+ *                              BL_BGZF_LEVEL_DEFAULT) == BL_BGZF_OK )
+ *      {
+ *          while ( (bytes = fread(buff, 1, 65536, stdin)) > 0 )
+ *              bl_bgzf_write(&bgzf, buff, bytes);
+ *          bl_bgzf_close(&bgzf);
+ *      }
+ *
+ *  See also:
+ *      bl_bgzf_write(3), bl_bgzf_close(3), bl_bgzf_fopen_write(3)
+ *
+ *  History: 
+ *  Date        Name        Modification
+ *  2026-10-17  agent       Begin
+ ***************************************************************************/
+
+int     bl_bgzf_open_write(bl_bgzf_t *bgzf, FILE *stream, unsigned threads,
+			   int level)
+
+{
+    size_t  c;
+    long    cpus;
+
+    bgzf->stream = stream;
+    bgzf->format = BL_BGZF_FORMAT_BGZF;
+    bgzf->writing = 1;
+    bgzf->level = level;
+    bgzf->buff = NULL;
+    bgzf->buff_len = 0;
+    bgzf->buff_pos = 0;
+    bgzf->stream_eof = 0;
+    bgzf->blocks_loaded = 0;
+    bgzf->blocks_claimed = 0;
+    bgzf->blocks_consumed = 0;
+    bgzf->block_pos = 0;
+    bgzf->eof = 0;
+    bgzf->shutdown = 0;
+    bgzf->write_error = 0;
+    bgzf->threads = 0;
+
+    if ( threads == 0 )
+    {
+	cpus = sysconf(_SC_NPROCESSORS_ONLN);
+	threads = cpus < 1 ? 1 : XT_MIN(cpus, BL_BGZF_AUTO_THREADS_MAX);
+    }
+    bgzf->block_count = threads * BL_BGZF_BLOCKS_PER_THREAD;
+    bgzf->blocks = xt_malloc(bgzf->block_count, sizeof(*bgzf->blocks));
+    bgzf->workers = xt_malloc(threads, sizeof(*bgzf->workers));
+    if ( (bgzf->blocks == NULL) || (bgzf->workers == NULL) )
+    {
+	free(bgzf->blocks);
+	free(bgzf->workers);
+	return BL_BGZF_MALLOC_FAILED;
+    }
+    for (c = 0; c < bgzf->block_count; ++c)
+	bgzf->blocks[c].state = BL_BGZF_BLOCK_EMPTY;
+
+    pthread_mutex_init(&bgzf->lock, NULL);
+    pthread_cond_init(&bgzf->block_free, NULL);
+    pthread_cond_init(&bgzf->block_ready, NULL);
+    for (bgzf->threads = 0; bgzf->threads < threads; ++bgzf->threads)
+    {
+	if ( pthread_create(&bgzf->workers[bgzf->threads], NULL,
+			    bl_bgzf_deflate_thread, bgzf) != 0 )
+	{
+	    bl_bgzf_close(bgzf);
+	    return BL_BGZF_THREAD_FAILED;
+	}
+    }
+    return BL_BGZF_OK;
+}
+
+
+/***************************************************************************
+ *  Name:
+ *      bl_bgzf_write() - Write data to a BGZF stream
+ *
+ *  Library:
+ *      #include <biolibc/bgzf.h>
+ *      -lbiolibc -lxtend -lz -lpthread
+ *
+ *  Description:
+ *      Copy count bytes into the block ring of a stream attached with
+ *      bl_bgzf_open_write(3), with the same semantics as write(2).
+ *      Each full block is handed to the worker threads for compression,
+ *      so the caller only waits when every block in the ring is busy.
+ *
+ *  Arguments:
+ *      bgzf        Pointer to a bl_bgzf_t object
+ *      buff        Data to compress
+ *      count       Number of bytes in buff
+ *
+ *  Returns:
+ *      count on success, or -1 if a previous block could not be
+ *      written, with errno set to EIO
+ *
+ *  See also:
+ *      bl_bgzf_open_write(3), bl_bgzf_flush(3), bl_bgzf_close(3)
+ *
+ *  History: 
+ *  Date        Name        Modification
+ *  2026-10-17  agent       Begin
+ ***************************************************************************/
+
+ssize_t bl_bgzf_write(bl_bgzf_t *bgzf, const void *buff, size_t count)
+
+{
+    bl_bgzf_block_t *block;
+    size_t  total, len;
+
+    for (total = 0; total < count; total += len)
+    {
+	block = &bgzf->blocks[bgzf->blocks_loaded % bgzf->block_count];
+	if ( bgzf->block_pos == 0 )
+	{
+	    // Wait for a worker to write out the previous use of this slot
+	    pthread_mutex_lock(&bgzf->lock);
+	    while ( (block->state != BL_BGZF_BLOCK_EMPTY) &&
+		    ! bgzf->write_error )
+		pthread_cond_wait(&bgzf->block_free, &bgzf->lock);
+	    pthread_mutex_unlock(&bgzf->lock);
+	}
+	if ( bgzf->write_error )
+	{
+	    errno = EIO;
+	    return -1;
+	}
+
+	len = XT_MIN(BL_BGZF_WRITE_BLOCK_BYTES - bgzf->block_pos,
+		     count - total);
+	memcpy(block->udata + bgzf->block_pos, (char *)buff + total, len);
+	bgzf->block_pos += len;
+	if ( bgzf->block_pos == BL_BGZF_WRITE_BLOCK_BYTES )
+	    bl_bgzf_flush(bgzf);
+    }
+    return total;
+}
+
+
+/***************************************************************************
+ *  Name:
+ *      bl_bgzf_flush() - Hand the current block to the compressor threads
+ *
+ *  Library:
+ *      #include <biolibc/bgzf.h>
+ *      -lbiolibc -lxtend -lz -lpthread
+ *
+ *  Description:
+ *      End the block currently being filled by bl_bgzf_write(3), even if
+ *      it is not full, and queue it for compression.  Flushing at
+ *      record boundaries keeps every record within one block, which
+ *      some indexing schemes rely on.  bl_bgzf_write(3) and
+ *      bl_bgzf_close(3) call this automatically.  It does nothing if
+ *      the current block is empty.
+ *
+ *  Arguments:
+ *      bgzf        Pointer to a bl_bgzf_t object open for writing
+ *
+ *  Returns:
+ *      BL_BGZF_OK, or BL_BGZF_WRITE_FAILED if a previous block could
+ *      not be written
+ *
+ *  See also:
+ *      bl_bgzf_write(3), bl_bgzf_close(3)
+ *
+ *  History: 
+ *  Date        Name        Modification
+ *  2026-10-17  agent       Begin
+ ***************************************************************************/
+
+int     bl_bgzf_flush(bl_bgzf_t *bgzf)
+
+{
+    bl_bgzf_block_t *block;
+
+    if ( bgzf->block_pos == 0 )
+	return bgzf->write_error ? BL_BGZF_WRITE_FAILED : BL_BGZF_OK;
+
+    block = &bgzf->blocks[bgzf->blocks_loaded % bgzf->block_count];
+    pthread_mutex_lock(&bgzf->lock);
+    block->udata_len = bgzf->block_pos;
+    block->state = BL_BGZF_BLOCK_LOADED;
+    ++bgzf->blocks_loaded;
+    pthread_cond_signal(&bgzf->block_ready);
+    pthread_mutex_unlock(&bgzf->lock);
+    bgzf->block_pos = 0;
+    return bgzf->write_error ? BL_BGZF_WRITE_FAILED : BL_BGZF_OK;
+}
+
+
+/***************************************************************************
+ *  Name:
+ *      bl_bgzf_deflate_block() - Compress one BGZF block
+ *
+ *  Library:
+ *      #include <biolibc/bgzf.h>
+ *      -lbiolibc -lxtend -lz -lpthread
+ *
+ *  Description:
+ *      Deflate block->udata into block->cdata, adding the BGZF header
+ *      and gzip trailer.  zstream must have been initialized for raw
+ *      deflate data with deflateInit2(zstream, level, Z_DEFLATED, -15,
+ *      8, Z_DEFAULT_STRATEGY).  Each thread uses its own zstream, so
+ *      blocks can be deflated concurrently.
+ *
+ *  Arguments:
+ *      block       Pointer to a loaded bl_bgzf_block_t object
+ *      zstream     Raw deflate stream owned by the calling thread
+ *
+ *  Returns:
+ *      BL_BGZF_OK on success
+ *      BL_BGZF_BAD_DATA if the compressed block does not fit in 64 KiB
+ *
+ *  See also:
+ *      bl_bgzf_deflate_thread(3), bl_bgzf_inflate_block(3)
+ *
+ *  History: 
+ *  Date        Name        Modification
+ *  2026-10-17  agent       Begin
+ ***************************************************************************/
+
+int     bl_bgzf_deflate_block(bl_bgzf_block_t *block, z_stream *zstream)
+
+{
+    static const unsigned char  header[BL_BGZF_HEADER_BYTES - 2] =
+	{ 0x1f, 0x8b, 8, 4, 0, 0, 0, 0, 0, 0xff, 6, 0, 'B', 'C', 2, 0 };
+    unsigned char   *h = block->cdata, *trailer;
+    uint32_t        crc;
+    size_t          bsize;
+
+    deflateReset(zstream);
+    zstream->next_in = block->udata;
+    zstream->avail_in = block->udata_len;
+    zstream->next_out = h + BL_BGZF_HEADER_BYTES;
+    zstream->avail_out = BL_BGZF_BLOCK_MAX_BYTES - BL_BGZF_HEADER_BYTES - 8;
+    if ( deflate(zstream, Z_FINISH) != Z_STREAM_END )
+	return BL_BGZF_BAD_DATA;
+    block->cdata_len = BL_BGZF_HEADER_BYTES + zstream->total_out + 8;
+
+    memcpy(h, header, sizeof(header));
+    bsize = block->cdata_len - 1;
+    h[16] = bsize & 0xff;
+    h[17] = bsize >> 8;
+
+    crc = crc32(0L, block->udata, block->udata_len);
+    trailer = h + block->cdata_len - 8;
+    trailer[0] = crc & 0xff;
+    trailer[1] = (crc >> 8) & 0xff;
+    trailer[2] = (crc >> 16) & 0xff;
+    trailer[3] = crc >> 24;
+    trailer[4] = block->udata_len & 0xff;
+    trailer[5] = (block->udata_len >> 8) & 0xff;
+    trailer[6] = 0;
+    trailer[7] = 0;
+    return BL_BGZF_OK;
+}
+
+
+/***************************************************************************
+ *  Name:
+ *      bl_bgzf_deflate_thread() - BGZF compressor worker thread
+ *
+ *  Library:
+ *      #include <biolibc/bgzf.h>
+ *      -lbiolibc -lxtend -lz -lpthread
+ *
+ *  Description:
+ *      Worker thread started by bl_bgzf_open_write(3).  Each worker
+ *      repeatedly claims the next block filled by bl_bgzf_write(3),
+ *      deflates it without bgzf->lock held, then writes every
+ *      compressed block at the head of the ring with the lock held,
+ *      so that output stays in order regardless of which worker
+ *      finishes first.  Workers exit when bl_bgzf_close(3) sets
+ *      bgzf->shutdown and no blocks remain.
+ *
+ *  Arguments:
+ *      arg     Pointer to the bl_bgzf_t object
+ *
+ *  Returns:
+ *      NULL
+ *
+ *  See also:
+ *      bl_bgzf_open_write(3), bl_bgzf_deflate_block(3)
+ *
+ *  History: 
+ *  Date        Name        Modification
+ *  2026-10-17  agent       Begin
+ ***************************************************************************/
+
+void    *bl_bgzf_deflate_thread(void *arg)
+
+{
+    bl_bgzf_t       *bgzf = arg;
+    bl_bgzf_block_t *block;
+    z_stream        zstream;
+    int             status;
+
+    memset(&zstream, 0, sizeof(zstream));
+    if ( deflateInit2(&zstream, bgzf->level, Z_DEFLATED, -15, 8,
+		      Z_DEFAULT_STRATEGY) != Z_OK )
+    {
+	fprintf(stderr, "bl_bgzf_deflate_thread(): Could not allocate zstream.\n");
+	exit(EX_UNAVAILABLE);
+    }
+
+    pthread_mutex_lock(&bgzf->lock);
+    while ( true )
+    {
+	while ( ! bgzf->shutdown &&
+		(bgzf->blocks_claimed == bgzf->blocks_loaded) )
+	    pthread_cond_wait(&bgzf->block_ready, &bgzf->lock);
+	if ( bgzf->blocks_claimed == bgzf->blocks_loaded )
+	    break;
+
+	block = &bgzf->blocks[bgzf->blocks_claimed++ % bgzf->block_count];
+	pthread_mutex_unlock(&bgzf->lock);
+	status = bl_bgzf_deflate_block(block, &zstream);
+	pthread_mutex_lock(&bgzf->lock);
+	block->status = status;
+	block->state = BL_BGZF_BLOCK_DONE;
+
+	// Write out finished blocks in order, whichever worker did them
+	block = &bgzf->blocks[bgzf->blocks_consumed % bgzf->block_count];
+	while ( (bgzf->blocks_consumed < bgzf->blocks_claimed) &&
+		(block->state == BL_BGZF_BLOCK_DONE) )
+	{
+	    if ( (block->status != BL_BGZF_OK) ||
+		 (fwrite(block->cdata, block->cdata_len, 1,
+			 bgzf->stream) != 1) )
+		bgzf->write_error = 1;
+	    block->state = BL_BGZF_BLOCK_EMPTY;
+	    ++bgzf->blocks_consumed;
+	    block = &bgzf->blocks[bgzf->blocks_consumed % bgzf->block_count];
+	}
+	pthread_cond_broadcast(&bgzf->block_free);
+    }
+    pthread_mutex_unlock(&bgzf->lock);
+    deflateEnd(&zstream);
+    return NULL;
+}
+
+
+/***************************************************************************
+ *  Name:
+ *      bl_bgzf_fopen() - Open a gzip or BGZF file as a FILE stream
+ *
+ *  Library:
+ *      #include <biolibc/bgzf.h>
+ *      -lbiolibc -lxtend -lz -lpthread
+ *
+ *  Description:
+ *      Open filename for reading and return a FILE stream that delivers
+ *      the decompressed contents, so that existing readers such as
+ *      bl_sam_read(3), bl_vcf_read_ss_call(3) and bl_fasta_read(3) can process
+ *      compressed files without running an external gzip process.
+ *      BGZF files are inflated in parallel by threads worker threads
+ *      (0 for automatic).  See bl_bgzf_open(3) for details.
+ *
+ *      The stream must be closed with fclose(3) or bl_sam_fclose(3),
+ *      which also stops the worker threads.  The stream has no file
+ *      descriptor, so fileno(3) returns -1.
+ *
+ *  Arguments:
+ *      filename    Name of a gzip, BGZF, or uncompressed file
+ *      threads     Number of BGZF worker threads, 0 for automatic
+ *
+ *  Returns:
+ *      A FILE stream open for reading, or NULL if the file could not be
+ *      opened or memory could not be allocated
+ *
+ *  Examples:
+ *      FILE    *vcf_stream;
+ *
+ *      if ( (vcf_stream = bl_bgzf_fopen("calls.vcf.gz", 0)) == NULL )
+ *          exit(EX_NOINPUT);
+ *
+ *  See also:
+ *      bl_bgzf_open(3), bl_sam_fopen(3), fopencookie(3), funopen(3)
+ *
+ *  History: 
+ *  Date        Name        Modification
+ *  2026-10-17  agent       Begin
+ ***************************************************************************/
+
+FILE    *bl_bgzf_fopen(const char *filename, unsigned threads)
+
+{
+    FILE        *stream, *fp;
+    bl_bgzf_t   *bgzf;
+#ifdef __linux__
+    cookie_io_functions_t   io =
+	{ bl_bgzf_cookie_read, NULL, NULL, bl_bgzf_cookie_close };
+#endif
+
+    if ( (stream = fopen(filename, "r")) == NULL )
+	return NULL;
+    if ( (bgzf = xt_malloc(1, sizeof(*bgzf))) == NULL )
+    {
+	fclose(stream);
+	return NULL;
+    }
+    if ( bl_bgzf_open(bgzf, stream, threads) != BL_BGZF_OK )
+    {
+	free(bgzf);
+	fclose(stream);
+	return NULL;
+    }
+
+#ifdef __linux__
+    fp = fopencookie(bgzf, "r", io);
+#else
+    fp = funopen(bgzf, bl_bgzf_cookie_read, NULL, NULL, bl_bgzf_cookie_close);
+#endif
+    if ( fp == NULL )
+    {
+	bl_bgzf_cookie_close(bgzf);
+	return NULL;
+    }
+
+    // One stdio refill per BGZF block
+    setvbuf(fp, NULL, _IOFBF, BL_BGZF_BLOCK_MAX_BYTES);
+    return fp;
+}
+
+
+/***************************************************************************
+ *  Name:
+ *      bl_bgzf_fopen_write() - Create a BGZF file as a FILE stream
+ *
+ *  Library:
+ *      #include <biolibc/bgzf.h>
+ *      -lbiolibc -lxtend -lz -lpthread
+ *
+ *  Description:
+ *      Open filename for writing and return a FILE stream that
+ *      compresses everything written to it into BGZF format, so that
+ *      existing writers such as bl_sam_write(3) and bl_vcf_write_ss_call(3)
+ *      can produce compressed files without running an external gzip
+ *      process.  Blocks are deflated in parallel by threads worker
+ *      threads (0 for automatic).  See bl_bgzf_open_write(3) for details.
+ *
+ *      The stream must be closed with fclose(3) or bl_sam_fclose(3),
+ *      which writes the final block and end-of-file marker and stops
+ *      the worker threads.  The stream has no file descriptor, so
+ *      fileno(3) returns -1.
+ *
+ *  Arguments:
+ *      filename    Name of the file to create
+ *      threads     Number of worker threads, 0 for automatic
+ *
+ *  Returns:
+ *      A FILE stream open for writing, or NULL if the file could not be
+ *      opened or memory could not be allocated
+ *
+ *  Examples:
+ *      FILE    *sam_stream;
+ *
+ *      if ( (sam_stream = bl_bgzf_fopen_write("out.sam.gz", 0)) == NULL )
+ *          exit(EX_CANTCREAT);
+ *
+ *  See also:
+ *      bl_bgzf_open_write(3), bl_bgzf_fopen(3), bl_sam_fopen(3),
+ *      fopencookie(3), funopen(3)
+ *
+ *  History: 
+ *  Date        Name        Modification
+ *  2026-10-17  agent       Begin
+ ***************************************************************************/
+
+FILE    *bl_bgzf_fopen_write(const char *filename, unsigned threads)
+
+{
+    FILE        *stream, *fp;
+    bl_bgzf_t   *bgzf;
+#ifdef __linux__
+    cookie_io_functions_t   io =
+	{ NULL, bl_bgzf_cookie_write, NULL, bl_bgzf_cookie_close };
+#endif
+
+    if ( (stream = fopen(filename, "w")) == NULL )
+	return NULL;
+    if ( (bgzf = xt_malloc(1, sizeof(*bgzf))) == NULL )
+    {
+	fclose(stream);
+	return NULL;
+    }
+    if ( bl_bgzf_open_write(bgzf, stream, threads,
+			    BL_BGZF_LEVEL_DEFAULT) != BL_BGZF_OK )
+    {
+	free(bgzf);
+	fclose(stream);
+	return NULL;
+    }
+
+#ifdef __linux__
+    fp = fopencookie(bgzf, "w", io);
+#else
+    fp = funopen(bgzf, NULL, bl_bgzf_cookie_write, NULL, bl_bgzf_cookie_close);
+#endif
+    if ( fp == NULL )
+    {
+	bl_bgzf_cookie_close(bgzf);
+	return NULL;
+    }
+
+    // One stdio flush per BGZF block
+    setvbuf(fp, NULL, _IOFBF, BL_BGZF_WRITE_BLOCK_BYTES);
+    return fp;
+}
+
+
+/***************************************************************************
+ *  Name:
+ *      bl_bgzf_cookie_read() - stdio read hook for bl_bgzf_fopen(3)
+ *
+ *  Library:
+ *      #include <biolibc/bgzf.h>
+ *      -lbiolibc -lxtend -lz -lpthread
+ *
+ *  Description:
+ *      Read function passed to fopencookie(3) on Linux or funopen(3)
+ *      on BSD and macOS.  Not normally called directly.
+ *
+ *  Arguments:
+ *      cookie      Pointer to the bl_bgzf_t object
+ *      buff        Buffer to receive decompressed data
+ *      count       Maximum number of bytes to read
+ *
+ *  Returns:
+ *      Number of bytes read, 0 at end of input, or -1 on error
+ *
+ *  See also:
+ *      bl_bgzf_fopen(3), bl_bgzf_read(3)
+ *
+ *  History: 
+ *  Date        Name        Modification
+ *  2026-10-17  agent       Begin
+ ***************************************************************************/
+
+#ifdef __linux__
+ssize_t bl_bgzf_cookie_read(void *cookie, char *buff, size_t count)
+#else
+int     bl_bgzf_cookie_read(void *cookie, char *buff, int count)
+#endif
+
+{
+    return bl_bgzf_read(cookie, buff, count);
+}
+
+
+/***************************************************************************
+ *  Name:
+ *      bl_bgzf_cookie_write() - stdio write hook for bl_bgzf_fopen_write(3)
+ *
+ *  Library:
+ *      #include <biolibc/bgzf.h>
+ *      -lbiolibc -lxtend -lz -lpthread
+ *
+ *  Description:
+ *      Write function passed to fopencookie(3) on Linux or funopen(3)
+ *      on BSD and macOS.  Not normally called directly.
+ *
+ *  Arguments:
+ *      cookie      Pointer to the bl_bgzf_t object
+ *      buff        Data to compress
+ *      count       Number of bytes in buff
+ *
+ *  Returns:
+ *      Number of bytes written, or -1 on error
+ *
+ *  See also:
+ *      bl_bgzf_fopen_write(3), bl_bgzf_write(3)
+ *
+ *  History: 
+ *  Date        Name        Modification
+ *  2026-10-17  agent       Begin
+ ***************************************************************************/
+
+#ifdef __linux__
+ssize_t bl_bgzf_cookie_write(void *cookie, const char *buff, size_t count)
+#else
+int     bl_bgzf_cookie_write(void *cookie, const char *buff, int count)
+#endif
+
+{
+    return bl_bgzf_write(cookie, buff, count);
+}
+
+
+/***************************************************************************
+ *  Name:
+ *      bl_bgzf_cookie_close() - stdio close hook for bl_bgzf_fopen(3)
+ *
+ *  Library:
+ *      #include <biolibc/bgzf.h>
+ *      -lbiolibc -lxtend -lz -lpthread
+ *
+ *  Description:
+ *      Close function passed to fopencookie(3) or funopen(3).  Stops
+ *      worker threads, finishes BGZF output if writing, closes the
+ *      underlying file, and frees the bl_bgzf_t object.  Not normally
+ *      called directly.
+ *
+ *  Arguments:
+ *      cookie      Pointer to the bl_bgzf_t object
+ *
+ *  Returns:
+ *      The value returned by fclose(3) on the underlying file, or -1
+ *      if compressed output could not be completed
+ *
+ *  See also:
+ *      bl_bgzf_fopen(3), bl_bgzf_fopen_write(3), bl_bgzf_close(3)
+ *
+ *  History: 
+ *  Date        Name        Modification
+ *  2026-10-17  agent       Begin
+ *  2026-10-17  agent       Report write errors
+ ***************************************************************************/
+
+int     bl_bgzf_cookie_close(void *cookie)
+
+{
+    bl_bgzf_t   *bgzf = cookie;
+    FILE        *stream = bgzf->stream;
+    int         status;
+
+    status = bl_bgzf_close(bgzf);
+    free(bgzf);
+    if ( fclose(stream) != 0 )
+	return EOF;
+    return status == BL_BGZF_OK ? 0 : EOF;
+}
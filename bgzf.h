@@ -0,0 +1,137 @@
+#ifndef _BIOLIBC_BGZF_H_
+#define _BIOLIBC_BGZF_H_
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+#include <pthread.h>
+#include <zlib.h>
+
+#ifndef _BIOLIBC_H_
+#include "biolibc.h"
+#endif
+
+/*
+ *  In-process decompression of gzip and BGZF (blocked gzip) streams,
+ *  and BGZF compression.  BGZF blocks are independent gzip members of at
+ *  most 64 KiB, so they are inflated or deflated in parallel by a pool
+ *  of worker threads while preserving file order.  Plain gzip input is
+ *  inflated serially, and uncompressed input is passed through unchanged.
+ */
+
+// Maximum compressed and uncompressed size of one BGZF block
+#define BL_BGZF_BLOCK_MAX_BYTES     65536
+
+// Fixed gzip header plus the BGZF extra subfield
+#define BL_BGZF_HEADER_BYTES        18
+
+// Uncompressed bytes per output block, leaving room for incompressible data
+#define BL_BGZF_WRITE_BLOCK_BYTES   0xff00
+
+// Empty block marking the end of a BGZF file
+#define BL_BGZF_EOF_BLOCK   "\037\213\010\004\0\0\0\0\0\377\006\0BC\002\0\033\0" \
+			    "\003\0\0\0\0\0\0\0\0\0"
+#define BL_BGZF_EOF_BLOCK_BYTES     28
+
+#define BL_BGZF_LEVEL_DEFAULT       Z_DEFAULT_COMPRESSION
+
+// Input buffer for serial gzip and pass-through
+#define BL_BGZF_BUFF_SIZE           (256 * 1024)
+
+// Blocks in flight per worker thread
+#define BL_BGZF_BLOCKS_PER_THREAD   4
+
+// Limit for threads == 0 (one per online CPU)
+#define BL_BGZF_AUTO_THREADS_MAX    8
+
+// Stream formats
+#define BL_BGZF_FORMAT_RAW          0
+#define BL_BGZF_FORMAT_GZIP         1
+#define BL_BGZF_FORMAT_BGZF         2
+
+// Block states: Empty, awaiting a worker, inflated or deflated
+#define BL_BGZF_BLOCK_EMPTY         0
+#define BL_BGZF_BLOCK_LOADED        1
+#define BL_BGZF_BLOCK_DONE          2
+
+#define BL_BGZF_OK                  0
+#define BL_BGZF_MALLOC_FAILED       -1
+#define BL_BGZF_OPEN_FAILED         -2
+#define BL_BGZF_BAD_DATA            -3
+#define BL_BGZF_THREAD_FAILED       -4
+#define BL_BGZF_WRITE_FAILED        -5
+
+typedef struct
+{
+    unsigned char   cdata[BL_BGZF_BLOCK_MAX_BYTES],
+		    udata[BL_BGZF_BLOCK_MAX_BYTES];
+    size_t          cdata_len,      // Whole compressed block incl. header
+		    udata_len;
+    int             state,
+		    status;         // BL_BGZF_OK or error code
+}   bl_bgzf_block_t;
+
+typedef struct
+{
+    FILE            *stream;
+    int             format,
+		    writing,
+		    level;          // Compression level for writing
+    unsigned        threads;
+    
+    // Serial gzip and pass-through input
+    z_stream        zstream;
+    unsigned char   *buff;
+    size_t          buff_len,
+		    buff_pos;
+    int             stream_eof;
+    
+    // BGZF block ring shared with worker threads
+    bl_bgzf_block_t *blocks;
+    size_t          block_count,
+		    blocks_loaded,      // Total blocks read or filled by caller
+		    blocks_claimed,     // Total blocks taken by deflate workers
+		    blocks_consumed,    // Total blocks returned or written
+		    block_pos;          // Next byte in current block
+    int             eof,
+		    shutdown,
+		    write_error;
+    pthread_t       *workers;
+    pthread_mutex_t lock;
+    pthread_cond_t  block_free,
+		    block_ready;
+}   bl_bgzf_t;
+
+#include "bgzf-rvs.h"
+#include "bgzf-accessors.h"
+#include "bgzf-mutators.h"
+
+/* bgzf.c */
+int bl_bgzf_open(bl_bgzf_t *bgzf, FILE *stream, unsigned threads);
+ssize_t bl_bgzf_read(bl_bgzf_t *bgzf, void *buff, size_t count);
+int bl_bgzf_close(bl_bgzf_t *bgzf);
+int bl_bgzf_load_block(bl_bgzf_t *bgzf, bl_bgzf_block_t *block);
+int bl_bgzf_inflate_block(bl_bgzf_block_t *block, z_stream *zstream);
+void *bl_bgzf_inflate_thread(void *arg);
+int bl_bgzf_open_write(bl_bgzf_t *bgzf, FILE *stream, unsigned threads, int level);
+ssize_t bl_bgzf_write(bl_bgzf_t *bgzf, const void *buff, size_t count);
+int bl_bgzf_flush(bl_bgzf_t *bgzf);
+int bl_bgzf_deflate_block(bl_bgzf_block_t *block, z_stream *zstream);
+void *bl_bgzf_deflate_thread(void *arg);
+FILE *bl_bgzf_fopen(const char *filename, unsigned threads);
+FILE *bl_bgzf_fopen_write(const char *filename, unsigned threads);
+#ifdef __linux__
+ssize_t bl_bgzf_cookie_read(void *cookie, char *buff, size_t count);
+ssize_t bl_bgzf_cookie_write(void *cookie, const char *buff, size_t count);
+#else
+int bl_bgzf_cookie_read(void *cookie, char *buff, int count);
+int bl_bgzf_cookie_write(void *cookie, const char *buff, int count);
+#endif
+int bl_bgzf_cookie_close(void *cookie);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif // _BIOLIBC_BGZF_H_
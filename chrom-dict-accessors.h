@@ -0,0 +1,23 @@
+    
+/*
+ *  Generated by /usr/local/bin/auto-gen-get-set
+ *
+ *  Accessor macros.  Use these to access structure members from functions
+ *  outside the bl_chrom_dict_t class.
+ *
+ *  These generated macros are not expected to be perfect.  Check and edit
+ *  as needed before adding to your code.
+ */
+
+#define BL_CHROM_DICT_ARRAY_SIZE(ptr)   ((ptr)->array_size)
+#define BL_CHROM_DICT_COUNT(ptr)        ((ptr)->count)
+#define BL_CHROM_DICT_NAMES(ptr)        ((ptr)->names)
+#define BL_CHROM_DICT_NAMES_AE(ptr,c)   ((ptr)->names[c])
+#define BL_CHROM_DICT_LENGTHS(ptr)      ((ptr)->lengths)
+#define BL_CHROM_DICT_LENGTHS_AE(ptr,c) ((ptr)->lengths[c])
+#define BL_CHROM_DICT_RANKS(ptr)        ((ptr)->ranks)
+#define BL_CHROM_DICT_RANKS_AE(ptr,c)   ((ptr)->ranks[c])
+#define BL_CHROM_DICT_BUCKETS(ptr)      ((ptr)->buckets)
+#define BL_CHROM_DICT_BUCKETS_AE(ptr,c) ((ptr)->buckets[c])
+#define BL_CHROM_DICT_BUCKET_COUNT(ptr) ((ptr)->bucket_count)
+#define BL_CHROM_DICT_RANKS_VALID(ptr)  ((ptr)->ranks_valid)
@@ -0,0 +1,906 @@
+/***************************************************************************
+ *  This file is automatically generated by gen-get-set.  Be sure to keep
+ *  track of any manual changes.
+ *
+ *  These generated functions are not expected to be perfect.  Check and
+ *  edit as needed before adding to your code.
+ ***************************************************************************/
+
+#include <string.h>
+#include <ctype.h>
+#include <stdbool.h>        // In case of bool
+#include <stdint.h>         // In case of int64_t, etc
+#include <xtend/string.h>   // strlcpy() on Linux
+#include "chrom-dict.h"
+
+
+/***************************************************************************
+ *  Library:
+ *      #include <biolibc/chrom-dict.h>
+ *      -lbiolibc -lxtend
+ *
+ *  Description:
+ *      Mutator for array_size member in a bl_chrom_dict_t structure.
+ *      Use this function to set array_size in a bl_chrom_dict_t object
+ *      from non-member functions.  This function performs a direct
+ *      assignment for scalar or pointer structure members.  If
+ *      array_size is a pointer, data previously pointed to should
+ *      be freed before calling this function to avoid memory
+ *      leaks.
+ *
+ *  Arguments:
+ *      bl_chrom_dict_ptr Pointer to the structure to set
+ *      new_array_size  The new value for array_size
+ *
+ *  Returns:
+ *      BL_CHROM_DICT_DATA_OK if the new value is acceptable and assigned
+ *      BL_CHROM_DICT_DATA_OUT_OF_RANGE otherwise
+ *
+ *  Examples:
+ *      bl_chrom_dict_t bl_chrom_dict;
+ *      size_t          new_array_size;
+ *
+ *      if ( bl_chrom_dict_set_array_size(&bl_chrom_dict, new_array_size)
+ *              == BL_CHROM_DICT_DATA_OK )
+ *      {
+ *      }
+ *
+ *  See also:
+ *      (3)
+ *
+ *  History: 
+ *  Date        Name        Modification
+ *  2026-10-17  gen-get-set Auto-generated from chrom-dict.h
+ ***************************************************************************/
+
+int     bl_chrom_dict_set_array_size(
+	    bl_chrom_dict_t *bl_chrom_dict_ptr,
+	    size_t new_array_size
+	)
+
+{
+    if ( false )
+	return BL_CHROM_DICT_DATA_OUT_OF_RANGE;
+    else
+    {
+	bl_chrom_dict_ptr->array_size = new_array_size;
+	return BL_CHROM_DICT_DATA_OK;
+    }
+}
+
+
+/***************************************************************************
+ *  Library:
+ *      #include <biolibc/chrom-dict.h>
+ *      -lbiolibc -lxtend
+ *
+ *  Description:
+ *      Mutator for count member in a bl_chrom_dict_t structure.
+ *      Use this function to set count in a bl_chrom_dict_t object
+ *      from non-member functions.  This function performs a direct
+ *      assignment for scalar or pointer structure members.  If
+ *      count is a pointer, data previously pointed to should
+ *      be freed before calling this function to avoid memory
+ *      leaks.
+ *
+ *  Arguments:
+ *      bl_chrom_dict_ptr Pointer to the structure to set
+ *      new_count       The new value for count
+ *
+ *  Returns:
+ *      BL_CHROM_DICT_DATA_OK if the new value is acceptable and assigned
+ *      BL_CHROM_DICT_DATA_OUT_OF_RANGE otherwise
+ *
+ *  Examples:
+ *      bl_chrom_dict_t bl_chrom_dict;
+ *      size_t          new_count;
+ *
+ *      if ( bl_chrom_dict_set_count(&bl_chrom_dict, new_count)
+ *              == BL_CHROM_DICT_DATA_OK )
+ *      {
+ *      }
+ *
+ *  See also:
+ *      (3)
+ *
+ *  History: 
+ *  Date        Name        Modification
+ *  2026-10-17  gen-get-set Auto-generated from chrom-dict.h
+ ***************************************************************************/
+
+int     bl_chrom_dict_set_count(
+	    bl_chrom_dict_t *bl_chrom_dict_ptr,
+	    size_t new_count
+	)
+
+{
+    if ( false )
+	return BL_CHROM_DICT_DATA_OUT_OF_RANGE;
+    else
+    {
+	bl_chrom_dict_ptr->count = new_count;
+	return BL_CHROM_DICT_DATA_OK;
+    }
+}
+
+
+/***************************************************************************
+ *  Library:
+ *      #include <biolibc/chrom-dict.h>
+ *      -lbiolibc -lxtend
+ *
+ *  Description:
+ *      Mutator for names member in a bl_chrom_dict_t structure.
+ *      Use this function to set names in a bl_chrom_dict_t object
+ *      from non-member functions.  This function performs a direct
+ *      assignment for scalar or pointer structure members.  If
+ *      names is a pointer, data previously pointed to should
+ *      be freed before calling this function to avoid memory
+ *      leaks.
+ *
+ *  Arguments:
+ *      bl_chrom_dict_ptr Pointer to the structure to set
+ *      new_names       The new value for names
+ *
+ *  Returns:
+ *      BL_CHROM_DICT_DATA_OK if the new value is acceptable and assigned
+ *      BL_CHROM_DICT_DATA_OUT_OF_RANGE otherwise
+ *
+ *  Examples:
+ *      bl_chrom_dict_t bl_chrom_dict;
+ *      char **         new_names;
+ *
+ *      if ( bl_chrom_dict_set_names(&bl_chrom_dict, new_names)
+ *              == BL_CHROM_DICT_DATA_OK )
+ *      {
+ *      }
+ *
+ *  See also:
+ *      (3)
+ *
+ *  History: 
+ *  Date        Name        Modification
+ *  2026-10-17  gen-get-set Auto-generated from chrom-dict.h
+ ***************************************************************************/
+
+int     bl_chrom_dict_set_names(
+	    bl_chrom_dict_t *bl_chrom_dict_ptr,
+	    char **new_names
+	)
+
+{
+    if ( new_names == NULL )
+	return BL_CHROM_DICT_DATA_OUT_OF_RANGE;
+    else
+    {
+	bl_chrom_dict_ptr->names = new_names;
+	return BL_CHROM_DICT_DATA_OK;
+    }
+}
+
+
+/***************************************************************************
+ *  Library:
+ *      #include <biolibc/chrom-dict.h>
+ *      -lbiolibc -lxtend
+ *
+ *  Description:
+ *      Mutator for an array element of names member in a bl_chrom_dict_t
+ *      structure. Use this function to set bl_chrom_dict_ptr->names[c]
+ *      in a bl_chrom_dict_t object from non-member functions.
+ *
+ *  Arguments:
+ *      bl_chrom_dict_ptr Pointer to the structure to set
+ *      c               Subscript to the names array
+ *      new_names_element The new value for names[c]
+ *
+ *  Returns:
+ *      BL_CHROM_DICT_DATA_OK if the new value is acceptable and assigned
+ *      BL_CHROM_DICT_DATA_OUT_OF_RANGE otherwise
+ *
+ *  Examples:
+ *      bl_chrom_dict_t bl_chrom_dict;
+ *      size_t          c;
+ *      char *          new_names_element;
+ *
+ *      if ( bl_chrom_dict_set_names_ae(&bl_chrom_dict, c, new_names_element)
+ *              == BL_CHROM_DICT_DATA_OK )
+ *      {
+ *      }
+ *
+ *  See also:
+ *      BL_CHROM_DICT_SET_NAMES_AE(3)
+ *
+ *  History: 
+ *  Date        Name        Modification
+ *  2026-10-17  gen-get-set Auto-generated from chrom-dict.h
+ ***************************************************************************/
+
+int     bl_chrom_dict_set_names_ae(
+	    bl_chrom_dict_t *bl_chrom_dict_ptr,
+	    size_t c,
+	    char *new_names_element
+	)
+
+{
+    if ( false )
+	return BL_CHROM_DICT_DATA_OUT_OF_RANGE;
+    else
+    {
+	bl_chrom_dict_ptr->names[c] = new_names_element;
+	return BL_CHROM_DICT_DATA_OK;
+    }
+}
+
+
+/***************************************************************************
+ *  Library:
+ *      #include <biolibc/chrom-dict.h>
+ *      -lbiolibc -lxtend
+ *
+ *  Description:
+ *      Mutator for names member in a bl_chrom_dict_t structure.
+ *      Use this function to set names in a bl_chrom_dict_t object
+ *      from non-member functions.  This function copies the array pointed to
+ *      by new_names to bl_chrom_dict_ptr->names.
+ *
+ *  Arguments:
+ *      bl_chrom_dict_ptr Pointer to the structure to set
+ *      new_names       The new value for names
+ *      array_size      Size of the names array.
+ *
+ *  Returns:
+ *      BL_CHROM_DICT_DATA_OK if the new value is acceptable and assigned
+ *      BL_CHROM_DICT_DATA_OUT_OF_RANGE otherwise
+ *
+ *  Examples:
+ *      bl_chrom_dict_t bl_chrom_dict;
+ *      char **         new_names;
+ *      size_t          array_size;
+ *
+ *      if ( bl_chrom_dict_set_names_cpy(&bl_chrom_dict, new_names, array_size)
+ *              == BL_CHROM_DICT_DATA_OK )
+ *      {
+ *      }
+ *
+ *  See also:
+ *      BL_CHROM_DICT_SET_NAMES(3)
+ *
+ *  History: 
+ *  Date        Name        Modification
+ *  2026-10-17  gen-get-set Auto-generated from chrom-dict.h
+ ***************************************************************************/
+
+int     bl_chrom_dict_set_names_cpy(
+	    bl_chrom_dict_t *bl_chrom_dict_ptr,
+	    char **new_names,
+	    size_t array_size
+	)
+
+{
+    if ( new_names == NULL )
+	return BL_CHROM_DICT_DATA_OUT_OF_RANGE;
+    else
+    {
+	size_t  c;
+	
+	// FIXME: Assuming all elements should be copied
+	for (c = 0; c < array_size; ++c)
+	    bl_chrom_dict_ptr->names[c] = new_names[c];
+	return BL_CHROM_DICT_DATA_OK;
+    }
+}
+
+
+/***************************************************************************
+ *  Library:
+ *      #include <biolibc/chrom-dict.h>
+ *      -lbiolibc -lxtend
+ *
+ *  Description:
+ *      Mutator for lengths member in a bl_chrom_dict_t structure.
+ *      Use this function to set lengths in a bl_chrom_dict_t object
+ *      from non-member functions.  This function performs a direct
+ *      assignment for scalar or pointer structure members.  If
+ *      lengths is a pointer, data previously pointed to should
+ *      be freed before calling this function to avoid memory
+ *      leaks.
+ *
+ *  Arguments:
+ *      bl_chrom_dict_ptr Pointer to the structure to set
+ *      new_lengths     The new value for lengths
+ *
+ *  Returns:
+ *      BL_CHROM_DICT_DATA_OK if the new value is acceptable and assigned
+ *      BL_CHROM_DICT_DATA_OUT_OF_RANGE otherwise
+ *
+ *  Examples:
+ *      bl_chrom_dict_t bl_chrom_dict;
+ *      int64_t *       new_lengths;
+ *
+ *      if ( bl_chrom_dict_set_lengths(&bl_chrom_dict, new_lengths)
+ *              == BL_CHROM_DICT_DATA_OK )
+ *      {
+ *      }
+ *
+ *  See also:
+ *      (3)
+ *
+ *  History: 
+ *  Date        Name        Modification
+ *  2026-10-17  gen-get-set Auto-generated from chrom-dict.h
+ ***************************************************************************/
+
+int     bl_chrom_dict_set_lengths(
+	    bl_chrom_dict_t *bl_chrom_dict_ptr,
+	    int64_t *new_lengths
+	)
+
+{
+    if ( new_lengths == NULL )
+	return BL_CHROM_DICT_DATA_OUT_OF_RANGE;
+    else
+    {
+	bl_chrom_dict_ptr->lengths = new_lengths;
+	return BL_CHROM_DICT_DATA_OK;
+    }
+}
+
+
+/***************************************************************************
+ *  Library:
+ *      #include <biolibc/chrom-dict.h>
+ *      -lbiolibc -lxtend
+ *
+ *  Description:
+ *      Mutator for an array element of lengths member in a bl_chrom_dict_t
+ *      structure. Use this function to set bl_chrom_dict_ptr->lengths[c]
+ *      in a bl_chrom_dict_t object from non-member functions.
+ *
+ *  Arguments:
+ *      bl_chrom_dict_ptr Pointer to the structure to set
+ *      c               Subscript to the lengths array
+ *      new_lengths_element The new value for lengths[c]
+ *
+ *  Returns:
+ *      BL_CHROM_DICT_DATA_OK if the new value is acceptable and assigned
+ *      BL_CHROM_DICT_DATA_OUT_OF_RANGE otherwise
+ *
+ *  Examples:
+ *      bl_chrom_dict_t bl_chrom_dict;
+ *      size_t          c;
+ *      int64_t         new_lengths_element;
+ *
+ *      if ( bl_chrom_dict_set_lengths_ae(&bl_chrom_dict, c, new_lengths_element)
+ *              == BL_CHROM_DICT_DATA_OK )
+ *      {
+ *      }
+ *
+ *  See also:
+ *      BL_CHROM_DICT_SET_LENGTHS_AE(3)
+ *
+ *  History: 
+ *  Date        Name        Modification
+ *  2026-10-17  gen-get-set Auto-generated from chrom-dict.h
+ ***************************************************************************/
+
+int     bl_chrom_dict_set_lengths_ae(
+	    bl_chrom_dict_t *bl_chrom_dict_ptr,
+	    size_t c,
+	    int64_t new_lengths_element
+	)
+
+{
+    if ( false )
+	return BL_CHROM_DICT_DATA_OUT_OF_RANGE;
+    else
+    {
+	bl_chrom_dict_ptr->lengths[c] = new_lengths_element;
+	return BL_CHROM_DICT_DATA_OK;
+    }
+}
+
+
+/***************************************************************************
+ *  Library:
+ *      #include <biolibc/chrom-dict.h>
+ *      -lbiolibc -lxtend
+ *
+ *  Description:
+ *      Mutator for lengths member in a bl_chrom_dict_t structure.
+ *      Use this function to set lengths in a bl_chrom_dict_t object
+ *      from non-member functions.  This function copies the array pointed to
+ *      by new_lengths to bl_chrom_dict_ptr->lengths.
+ *
+ *  Arguments:
+ *      bl_chrom_dict_ptr Pointer to the structure to set
+ *      new_lengths     The new value for lengths
+ *      array_size      Size of the lengths array.
+ *
+ *  Returns:
+ *      BL_CHROM_DICT_DATA_OK if the new value is acceptable and assigned
+ *      BL_CHROM_DICT_DATA_OUT_OF_RANGE otherwise
+ *
+ *  Examples:
+ *      bl_chrom_dict_t bl_chrom_dict;
+ *      int64_t *       new_lengths;
+ *      size_t          array_size;
+ *
+ *      if ( bl_chrom_dict_set_lengths_cpy(&bl_chrom_dict, new_lengths, array_size)
+ *              == BL_CHROM_DICT_DATA_OK )
+ *      {
+ *      }
+ *
+ *  See also:
+ *      BL_CHROM_DICT_SET_LENGTHS(3)
+ *
+ *  History: 
+ *  Date        Name        Modification
+ *  2026-10-17  gen-get-set Auto-generated from chrom-dict.h
+ ***************************************************************************/
+
+int     bl_chrom_dict_set_lengths_cpy(
+	    bl_chrom_dict_t *bl_chrom_dict_ptr,
+	    int64_t *new_lengths,
+	    size_t array_size
+	)
+
+{
+    if ( new_lengths == NULL )
+	return BL_CHROM_DICT_DATA_OUT_OF_RANGE;
+    else
+    {
+	size_t  c;
+	
+	// FIXME: Assuming all elements should be copied
+	for (c = 0; c < array_size; ++c)
+	    bl_chrom_dict_ptr->lengths[c] = new_lengths[c];
+	return BL_CHROM_DICT_DATA_OK;
+    }
+}
+
+
+/***************************************************************************
+ *  Library:
+ *      #include <biolibc/chrom-dict.h>
+ *      -lbiolibc -lxtend
+ *
+ *  Description:
+ *      Mutator for ranks member in a bl_chrom_dict_t structure.
+ *      Use this function to set ranks in a bl_chrom_dict_t object
+ *      from non-member functions.  This function performs a direct
+ *      assignment for scalar or pointer structure members.  If
+ *      ranks is a pointer, data previously pointed to should
+ *      be freed before calling this function to avoid memory
+ *      leaks.
+ *
+ *  Arguments:
+ *      bl_chrom_dict_ptr Pointer to the structure to set
+ *      new_ranks       The new value for ranks
+ *
+ *  Returns:
+ *      BL_CHROM_DICT_DATA_OK if the new value is acceptable and assigned
+ *      BL_CHROM_DICT_DATA_OUT_OF_RANGE otherwise
+ *
+ *  Examples:
+ *      bl_chrom_dict_t bl_chrom_dict;
+ *      int32_t *       new_ranks;
+ *
+ *      if ( bl_chrom_dict_set_ranks(&bl_chrom_dict, new_ranks)
+ *              == BL_CHROM_DICT_DATA_OK )
+ *      {
+ *      }
+ *
+ *  See also:
+ *      (3)
+ *
+ *  History: 
+ *  Date        Name        Modification
+ *  2026-10-17  gen-get-set Auto-generated from chrom-dict.h
+ ***************************************************************************/
+
+int     bl_chrom_dict_set_ranks(
+	    bl_chrom_dict_t *bl_chrom_dict_ptr,
+	    int32_t *new_ranks
+	)
+
+{
+    if ( new_ranks == NULL )
+	return BL_CHROM_DICT_DATA_OUT_OF_RANGE;
+    else
+    {
+	bl_chrom_dict_ptr->ranks = new_ranks;
+	return BL_CHROM_DICT_DATA_OK;
+    }
+}
+
+
+/***************************************************************************
+ *  Library:
+ *      #include <biolibc/chrom-dict.h>
+ *      -lbiolibc -lxtend
+ *
+ *  Description:
+ *      Mutator for an array element of ranks member in a bl_chrom_dict_t
+ *      structure. Use this function to set bl_chrom_dict_ptr->ranks[c]
+ *      in a bl_chrom_dict_t object from non-member functions.
+ *
+ *  Arguments:
+ *      bl_chrom_dict_ptr Pointer to the structure to set
+ *      c               Subscript to the ranks array
+ *      new_ranks_element The new value for ranks[c]
+ *
+ *  Returns:
+ *      BL_CHROM_DICT_DATA_OK if the new value is acceptable and assigned
+ *      BL_CHROM_DICT_DATA_OUT_OF_RANGE otherwise
+ *
+ *  Examples:
+ *      bl_chrom_dict_t bl_chrom_dict;
+ *      size_t          c;
+ *      int32_t         new_ranks_element;
+ *
+ *      if ( bl_chrom_dict_set_ranks_ae(&bl_chrom_dict, c, new_ranks_element)
+ *              == BL_CHROM_DICT_DATA_OK )
+ *      {
+ *      }
+ *
+ *  See also:
+ *      BL_CHROM_DICT_SET_RANKS_AE(3)
+ *
+ *  History: 
+ *  Date        Name        Modification
+ *  2026-10-17  gen-get-set Auto-generated from chrom-dict.h
+ ***************************************************************************/
+
+int     bl_chrom_dict_set_ranks_ae(
+	    bl_chrom_dict_t *bl_chrom_dict_ptr,
+	    size_t c,
+	    int32_t new_ranks_element
+	)
+
+{
+    if ( false )
+	return BL_CHROM_DICT_DATA_OUT_OF_RANGE;
+    else
+    {
+	bl_chrom_dict_ptr->ranks[c] = new_ranks_element;
+	return BL_CHROM_DICT_DATA_OK;
+    }
+}
+
+
+/***************************************************************************
+ *  Library:
+ *      #include <biolibc/chrom-dict.h>
+ *      -lbiolibc -lxtend
+ *
+ *  Description:
+ *      Mutator for ranks member in a bl_chrom_dict_t structure.
+ *      Use this function to set ranks in a bl_chrom_dict_t object
+ *      from non-member functions.  This function copies the array pointed to
+ *      by new_ranks to bl_chrom_dict_ptr->ranks.
+ *
+ *  Arguments:
+ *      bl_chrom_dict_ptr Pointer to the structure to set
+ *      new_ranks       The new value for ranks
+ *      array_size      Size of the ranks array.
+ *
+ *  Returns:
+ *      BL_CHROM_DICT_DATA_OK if the new value is acceptable and assigned
+ *      BL_CHROM_DICT_DATA_OUT_OF_RANGE otherwise
+ *
+ *  Examples:
+ *      bl_chrom_dict_t bl_chrom_dict;
+ *      int32_t *       new_ranks;
+ *      size_t          array_size;
+ *
+ *      if ( bl_chrom_dict_set_ranks_cpy(&bl_chrom_dict, new_ranks, array_size)
+ *              == BL_CHROM_DICT_DATA_OK )
+ *      {
+ *      }
+ *
+ *  See also:
+ *      BL_CHROM_DICT_SET_RANKS(3)
+ *
+ *  History: 
+ *  Date        Name        Modification
+ *  2026-10-17  gen-get-set Auto-generated from chrom-dict.h
+ ***************************************************************************/
+
+int     bl_chrom_dict_set_ranks_cpy(
+	    bl_chrom_dict_t *bl_chrom_dict_ptr,
+	    int32_t *new_ranks,
+	    size_t array_size
+	)
+
+{
+    if ( new_ranks == NULL )
+	return BL_CHROM_DICT_DATA_OUT_OF_RANGE;
+    else
+    {
+	size_t  c;
+	
+	// FIXME: Assuming all elements should be copied
+	for (c = 0; c < array_size; ++c)
+	    bl_chrom_dict_ptr->ranks[c] = new_ranks[c];
+	return BL_CHROM_DICT_DATA_OK;
+    }
+}
+
+
+/***************************************************************************
+ *  Library:
+ *      #include <biolibc/chrom-dict.h>
+ *      -lbiolibc -lxtend
+ *
+ *  Description:
+ *      Mutator for buckets member in a bl_chrom_dict_t structure.
+ *      Use this function to set buckets in a bl_chrom_dict_t object
+ *      from non-member functions.  This function performs a direct
+ *      assignment for scalar or pointer structure members.  If
+ *      buckets is a pointer, data previously pointed to should
+ *      be freed before calling this function to avoid memory
+ *      leaks.
+ *
+ *  Arguments:
+ *      bl_chrom_dict_ptr Pointer to the structure to set
+ *      new_buckets     The new value for buckets
+ *
+ *  Returns:
+ *      BL_CHROM_DICT_DATA_OK if the new value is acceptable and assigned
+ *      BL_CHROM_DICT_DATA_OUT_OF_RANGE otherwise
+ *
+ *  Examples:
+ *      bl_chrom_dict_t bl_chrom_dict;
+ *      int32_t *       new_buckets;
+ *
+ *      if ( bl_chrom_dict_set_buckets(&bl_chrom_dict, new_buckets)
+ *              == BL_CHROM_DICT_DATA_OK )
+ *      {
+ *      }
+ *
+ *  See also:
+ *      (3)
+ *
+ *  History: 
+ *  Date        Name        Modification
+ *  2026-10-17  gen-get-set Auto-generated from chrom-dict.h
+ ***************************************************************************/
+
+int     bl_chrom_dict_set_buckets(
+	    bl_chrom_dict_t *bl_chrom_dict_ptr,
+	    int32_t *new_buckets
+	)
+
+{
+    if ( new_buckets == NULL )
+	return BL_CHROM_DICT_DATA_OUT_OF_RANGE;
+    else
+    {
+	bl_chrom_dict_ptr->buckets = new_buckets;
+	return BL_CHROM_DICT_DATA_OK;
+    }
+}
+
+
+/***************************************************************************
+ *  Library:
+ *      #include <biolibc/chrom-dict.h>
+ *      -lbiolibc -lxtend
+ *
+ *  Description:
+ *      Mutator for an array element of buckets member in a bl_chrom_dict_t
+ *      structure. Use this function to set bl_chrom_dict_ptr->buckets[c]
+ *      in a bl_chrom_dict_t object from non-member functions.
+ *
+ *  Arguments:
+ *      bl_chrom_dict_ptr Pointer to the structure to set
+ *      c               Subscript to the buckets array
+ *      new_buckets_element The new value for buckets[c]
+ *
+ *  Returns:
+ *      BL_CHROM_DICT_DATA_OK if the new value is acceptable and assigned
+ *      BL_CHROM_DICT_DATA_OUT_OF_RANGE otherwise
+ *
+ *  Examples:
+ *      bl_chrom_dict_t bl_chrom_dict;
+ *      size_t          c;
+ *      int32_t         new_buckets_element;
+ *
+ *      if ( bl_chrom_dict_set_buckets_ae(&bl_chrom_dict, c, new_buckets_element)
+ *              == BL_CHROM_DICT_DATA_OK )
+ *      {
+ *      }
+ *
+ *  See also:
+ *      BL_CHROM_DICT_SET_BUCKETS_AE(3)
+ *
+ *  History: 
+ *  Date        Name        Modification
+ *  2026-10-17  gen-get-set Auto-generated from chrom-dict.h
+ ***************************************************************************/
+
+int     bl_chrom_dict_set_buckets_ae(
+	    bl_chrom_dict_t *bl_chrom_dict_ptr,
+	    size_t c,
+	    int32_t new_buckets_element
+	)
+
+{
+    if ( false )
+	return BL_CHROM_DICT_DATA_OUT_OF_RANGE;
+    else
+    {
+	bl_chrom_dict_ptr->buckets[c] = new_buckets_element;
+	return BL_CHROM_DICT_DATA_OK;
+    }
+}
+
+
+/***************************************************************************
+ *  Library:
+ *      #include <biolibc/chrom-dict.h>
+ *      -lbiolibc -lxtend
+ *
+ *  Description:
+ *      Mutator for buckets member in a bl_chrom_dict_t structure.
+ *      Use this function to set buckets in a bl_chrom_dict_t object
+ *      from non-member functions.  This function copies the array pointed to
+ *      by new_buckets to bl_chrom_dict_ptr->buckets.
+ *
+ *  Arguments:
+ *      bl_chrom_dict_ptr Pointer to the structure to set
+ *      new_buckets     The new value for buckets
+ *      array_size      Size of the buckets array.
+ *
+ *  Returns:
+ *      BL_CHROM_DICT_DATA_OK if the new value is acceptable and assigned
+ *      BL_CHROM_DICT_DATA_OUT_OF_RANGE otherwise
+ *
+ *  Examples:
+ *      bl_chrom_dict_t bl_chrom_dict;
+ *      int32_t *       new_buckets;
+ *      size_t          array_size;
+ *
+ *      if ( bl_chrom_dict_set_buckets_cpy(&bl_chrom_dict, new_buckets, array_size)
+ *              == BL_CHROM_DICT_DATA_OK )
+ *      {
+ *      }
+ *
+ *  See also:
+ *      BL_CHROM_DICT_SET_BUCKETS(3)
+ *
+ *  History: 
+ *  Date        Name        Modification
+ *  2026-10-17  gen-get-set Auto-generated from chrom-dict.h
+ ***************************************************************************/
+
+int     bl_chrom_dict_set_buckets_cpy(
+	    bl_chrom_dict_t *bl_chrom_dict_ptr,
+	    int32_t *new_buckets,
+	    size_t array_size
+	)
+
+{
+    if ( new_buckets == NULL )
+	return BL_CHROM_DICT_DATA_OUT_OF_RANGE;
+    else
+    {
+	size_t  c;
+	
+	// FIXME: Assuming all elements should be copied
+	for (c = 0; c < array_size; ++c)
+	    bl_chrom_dict_ptr->buckets[c] = new_buckets[c];
+	return BL_CHROM_DICT_DATA_OK;
+    }
+}
+
+
+/***************************************************************************
+ *  Library:
+ *      #include <biolibc/chrom-dict.h>
+ *      -lbiolibc -lxtend
+ *
+ *  Description:
+ *      Mutator for bucket_count member in a bl_chrom_dict_t structure.
+ *      Use this function to set bucket_count in a bl_chrom_dict_t object
+ *      from non-member functions.  This function performs a direct
+ *      assignment for scalar or pointer structure members.  If
+ *      bucket_count is a pointer, data previously pointed to should
+ *      be freed before calling this function to avoid memory
+ *      leaks.
+ *
+ *  Arguments:
+ *      bl_chrom_dict_ptr Pointer to the structure to set
+ *      new_bucket_count The new value for bucket_count
+ *
+ *  Returns:
+ *      BL_CHROM_DICT_DATA_OK if the new value is acceptable and assigned
+ *      BL_CHROM_DICT_DATA_OUT_OF_RANGE otherwise
+ *
+ *  Examples:
+ *      bl_chrom_dict_t bl_chrom_dict;
+ *      size_t          new_bucket_count;
+ *
+ *      if ( bl_chrom_dict_set_bucket_count(&bl_chrom_dict, new_bucket_count)
+ *              == BL_CHROM_DICT_DATA_OK )
+ *      {
+ *      }
+ *
+ *  See also:
+ *      (3)
+ *
+ *  History: 
+ *  Date        Name        Modification
+ *  2026-10-17  gen-get-set Auto-generated from chrom-dict.h
+ ***************************************************************************/
+
+int     bl_chrom_dict_set_bucket_count(
+	    bl_chrom_dict_t *bl_chrom_dict_ptr,
+	    size_t new_bucket_count
+	)
+
+{
+    if ( false )
+	return BL_CHROM_DICT_DATA_OUT_OF_RANGE;
+    else
+    {
+	bl_chrom_dict_ptr->bucket_count = new_bucket_count;
+	return BL_CHROM_DICT_DATA_OK;
+    }
+}
+
+
+/***************************************************************************
+ *  Library:
+ *      #include <biolibc/chrom-dict.h>
+ *      -lbiolibc -lxtend
+ *
+ *  Description:
+ *      Mutator for ranks_valid member in a bl_chrom_dict_t structure.
+ *      Use this function to set ranks_valid in a bl_chrom_dict_t object
+ *      from non-member functions.  This function performs a direct
+ *      assignment for scalar or pointer structure members.  If
+ *      ranks_valid is a pointer, data previously pointed to should
+ *      be freed before calling this function to avoid memory
+ *      leaks.
+ *
+ *  Arguments:
+ *      bl_chrom_dict_ptr Pointer to the structure to set
+ *      new_ranks_valid The new value for ranks_valid
+ *
+ *  Returns:
+ *      BL_CHROM_DICT_DATA_OK if the new value is acceptable and assigned
+ *      BL_CHROM_DICT_DATA_OUT_OF_RANGE otherwise
+ *
+ *  Examples:
+ *      bl_chrom_dict_t bl_chrom_dict;
+ *      int             new_ranks_valid;
+ *
+ *      if ( bl_chrom_dict_set_ranks_valid(&bl_chrom_dict, new_ranks_valid)
+ *              == BL_CHROM_DICT_DATA_OK )
+ *      {
+ *      }
+ *
+ *  See also:
+ *      (3)
+ *
+ *  History: 
+ *  Date        Name        Modification
+ *  2026-10-17  gen-get-set Auto-generated from chrom-dict.h
+ ***************************************************************************/
+
+int     bl_chrom_dict_set_ranks_valid(
+	    bl_chrom_dict_t *bl_chrom_dict_ptr,
+	    int new_ranks_valid
+	)
+
+{
+    if ( false )
+	return BL_CHROM_DICT_DATA_OUT_OF_RANGE;
+    else
+    {
+	bl_chrom_dict_ptr->ranks_valid = new_ranks_valid;
+	return BL_CHROM_DICT_DATA_OK;
+    }
+}
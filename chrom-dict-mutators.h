@@ -0,0 +1,32 @@
+
+/*
+ *  Generated by /usr/local/bin/auto-gen-get-set
+ *
+ *  Mutator functions for setting with no sanity checking.  Use these to
+ *  set structure members from functions outside the bl_chrom_dict_t
+ *  class.  These macros perform no data validation.  Hence, they achieve
+ *  maximum performance where data are guaranteed correct by other means.
+ *  Use the mutator functions (same name as the macro, but lower case)
+ *  for more robust code with a small performance penalty.
+ *
+ *  These generated macros are not expected to be perfect.  Check and edit
+ *  as needed before adding to your code.
+ */
+
+/* temp-chrom-dict-mutators.c */
+int bl_chrom_dict_set_array_size(bl_chrom_dict_t *bl_chrom_dict_ptr, size_t new_array_size);
+int bl_chrom_dict_set_count(bl_chrom_dict_t *bl_chrom_dict_ptr, size_t new_count);
+int bl_chrom_dict_set_names(bl_chrom_dict_t *bl_chrom_dict_ptr, char **new_names);
+int bl_chrom_dict_set_names_ae(bl_chrom_dict_t *bl_chrom_dict_ptr, size_t c, char *new_names_element);
+int bl_chrom_dict_set_names_cpy(bl_chrom_dict_t *bl_chrom_dict_ptr, char **new_names, size_t array_size);
+int bl_chrom_dict_set_lengths(bl_chrom_dict_t *bl_chrom_dict_ptr, int64_t *new_lengths);
+int bl_chrom_dict_set_lengths_ae(bl_chrom_dict_t *bl_chrom_dict_ptr, size_t c, int64_t new_lengths_element);
+int bl_chrom_dict_set_lengths_cpy(bl_chrom_dict_t *bl_chrom_dict_ptr, int64_t *new_lengths, size_t array_size);
+int bl_chrom_dict_set_ranks(bl_chrom_dict_t *bl_chrom_dict_ptr, int32_t *new_ranks);
+int bl_chrom_dict_set_ranks_ae(bl_chrom_dict_t *bl_chrom_dict_ptr, size_t c, int32_t new_ranks_element);
+int bl_chrom_dict_set_ranks_cpy(bl_chrom_dict_t *bl_chrom_dict_ptr, int32_t *new_ranks, size_t array_size);
+int bl_chrom_dict_set_buckets(bl_chrom_dict_t *bl_chrom_dict_ptr, int32_t *new_buckets);
+int bl_chrom_dict_set_buckets_ae(bl_chrom_dict_t *bl_chrom_dict_ptr, size_t c, int32_t new_buckets_element);
+int bl_chrom_dict_set_buckets_cpy(bl_chrom_dict_t *bl_chrom_dict_ptr, int32_t *new_buckets, size_t array_size);
+int bl_chrom_dict_set_bucket_count(bl_chrom_dict_t *bl_chrom_dict_ptr, size_t new_bucket_count);
+int bl_chrom_dict_set_ranks_valid(bl_chrom_dict_t *bl_chrom_dict_ptr, int new_ranks_valid);
@@ -0,0 +1,690 @@
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <sysexits.h>
+#include <xtend/dsv.h>
+#include <xtend/mem.h>
+#include "chrom-dict.h"
+#include "biostring.h"
+
+/***************************************************************************
+ *  Name:
+ *      bl_chrom_dict_init() - Initialize a chromosome dictionary
+ *
+ *  Library:
+ *      #include <biolibc/chrom-dict.h>
+ *      -lbiolibc -lxtend
+ *
+ *  Description:
+ *      Initialize an empty bl_chrom_dict_t object.  This is equivalent
+ *      to assigning BL_CHROM_DICT_INIT.  Memory is allocated as names
+ *      are added by bl_chrom_dict_add(3) or one of the load functions.
+ *
+ *  Arguments:
+ *      dict    Pointer to the bl_chrom_dict_t object to initialize
+ *
+ *  See also:
+ *      bl_chrom_dict_add(3), bl_chrom_dict_free(3)
+ *
+ *  History: 
+ *  Date        Name        Modification
+ *  2026-10-17  agent       Begin
+ ***************************************************************************/
+
+void    bl_chrom_dict_init(bl_chrom_dict_t *dict)
+
+{
+    dict->array_size = dict->count = 0;
+    dict->names = NULL;
+    dict->lengths = NULL;
+    dict->ranks = NULL;
+    dict->buckets = NULL;
+    dict->bucket_count = 0;
+    dict->ranks_valid = 1;
+}
+
+
+/***************************************************************************
+ *  Name:
+ *      bl_chrom_dict_free() - Free memory held by a chromosome dictionary
+ *
+ *  Library:
+ *      #include <biolibc/chrom-dict.h>
+ *      -lbiolibc -lxtend
+ *
+ *  Description:
+ *      Free all names and tables in a bl_chrom_dict_t object and return
+ *      it to the empty state.  Records that point to the dictionary must
+ *      not be compared afterward.
+ *
+ *  Arguments:
+ *      dict    Pointer to the bl_chrom_dict_t object to free
+ *
+ *  See also:
+ *      bl_chrom_dict_init(3)
+ *
+ *  History: 
+ *  Date        Name        Modification
+ *  2026-10-17  agent       Begin
+ ***************************************************************************/
+
+void    bl_chrom_dict_free(bl_chrom_dict_t *dict)
+
+{
+    size_t  c;
+
+    for (c = 0; c < dict->count; ++c)
+	free(dict->names[c]);
+    free(dict->names);
+    free(dict->lengths);
+    free(dict->ranks);
+    free(dict->buckets);
+    bl_chrom_dict_init(dict);
+}
+
+
+/***************************************************************************
+ *  Name:
+ *      bl_chrom_dict_hash() - Hash a chromosome name
+ *
+ *  Library:
+ *      #include <biolibc/chrom-dict.h>
+ *      -lbiolibc -lxtend
+ *
+ *  Description:
+ *      Compute the FNV-1a hash of a null-terminated chromosome name
+ *      for the bl_chrom_dict_t bucket table.  This is used internally
+ *      and is rarely needed by applications.
+ *
+ *  Arguments:
+ *      name    Chromosome name
+ *
+ *  Returns:
+ *      Hash value of name
+ *
+ *  See also:
+ *      bl_chrom_dict_lookup(3)
+ *
+ *  History: 
+ *  Date        Name        Modification
+ *  2026-10-17  agent       Begin
+ ***************************************************************************/
+
+uint32_t    bl_chrom_dict_hash(const char *name)
+
+{
+    uint32_t    hash = 2166136261u;
+
+    while ( *name != '\0' )
+    {
+	hash ^= (unsigned char)*name++;
+	hash *= 16777619u;
+    }
+    return hash;
+}
+
+
+/***************************************************************************
+ *  Name:
+ *      bl_chrom_dict_lookup() - Find the ID of a chromosome name
+ *
+ *  Library:
+ *      #include <biolibc/chrom-dict.h>
+ *      -lbiolibc -lxtend
+ *
+ *  Description:
+ *      Look up name in a bl_chrom_dict_t object without adding it.
+ *
+ *  Arguments:
+ *      dict    Pointer to a bl_chrom_dict_t object
+ *      name    Chromosome name
+ *
+ *  Returns:
+ *      The ID of name, or BL_CHROM_ID_NONE if it is not in dict
+ *
+ *  See also:
+ *      bl_chrom_dict_add(3)
+ *
+ *  History: 
+ *  Date        Name        Modification
+ *  2026-10-17  agent       Begin
+ ***************************************************************************/
+
+int32_t bl_chrom_dict_lookup(bl_chrom_dict_t *dict, const char *name)
+
+{
+    size_t  bucket;
+    int32_t id;
+
+    if ( dict->bucket_count == 0 )
+	return BL_CHROM_ID_NONE;
+
+    // Linear probing: the table is never more than half full
+    bucket = bl_chrom_dict_hash(name) & (dict->bucket_count - 1);
+    while ( (id = dict->buckets[bucket]) != BL_CHROM_ID_NONE )
+    {
+	if ( strcmp(dict->names[id], name) == 0 )
+	    return id;
+	bucket = (bucket + 1) & (dict->bucket_count - 1);
+    }
+    return BL_CHROM_ID_NONE;
+}
+
+
+/***************************************************************************
+ *  Name:
+ *      bl_chrom_dict_add() - Intern a chromosome name
+ *
+ *  Library:
+ *      #include <biolibc/chrom-dict.h>
+ *      -lbiolibc -lxtend
+ *
+ *  Description:
+ *      Return the ID of name in dict, adding it with the next free ID
+ *      if it is not already present.  IDs are assigned in order of first
+ *      appearance, so seeding from a header gives the same IDs as the
+ *      header order.  If length is > 0 and the stored length is unknown,
+ *      the stored length is updated.
+ *
+ *      Adding a new name invalidates the sort ranks, which are recomputed
+ *      by the next bl_chrom_dict_cmp(3) or bl_chrom_dict_sort(3).
+ *
+ *  Arguments:
+ *      dict    Pointer to a bl_chrom_dict_t object
+ *      name    Chromosome name
+ *      length  Sequence length, or 0 if unknown
+ *
+ *  Returns:
+ *      The ID of name (>= 0), or BL_CHROM_DICT_MALLOC_FAILED
+ *
+ *  Examples:
+ *      bl_chrom_dict_t dict = BL_CHROM_DICT_INIT;
+ *      int32_t         id;
+ *
+ *      id = bl_chrom_dict_add(&dict, "chr1", 248956422);
+ *
+ *  See also:
+ *      bl_chrom_dict_lookup(3), bl_chrom_dict_cmp(3)
+ *
+ *  History: 
+ *  Date        Name        Modification
+ *  2026-10-17  agent       Begin
+ ***************************************************************************/
+
+int32_t bl_chrom_dict_add(bl_chrom_dict_t *dict, const char *name,
+			  int64_t length)
+
+{
+    size_t  bucket, c;
+    int32_t id, *buckets;
+
+    if ( (id = bl_chrom_dict_lookup(dict, name)) != BL_CHROM_ID_NONE )
+    {
+	if ( (length > 0) && (dict->lengths[id] == 0) )
+	    dict->lengths[id] = length;
+	return id;
+    }
+
+    if ( dict->count == dict->array_size )
+    {
+	dict->array_size = dict->array_size == 0 ? 64 : dict->array_size * 2;
+	dict->names = xt_realloc(dict->names, dict->array_size,
+				 sizeof(*dict->names));
+	if ( dict->names == NULL )
+	    return BL_CHROM_DICT_MALLOC_FAILED;
+	dict->lengths = xt_realloc(dict->lengths, dict->array_size,
+				   sizeof(*dict->lengths));
+	if ( dict->lengths == NULL )
+	    return BL_CHROM_DICT_MALLOC_FAILED;
+	dict->ranks = xt_realloc(dict->ranks, dict->array_size,
+				 sizeof(*dict->ranks));
+	if ( dict->ranks == NULL )
+	    return BL_CHROM_DICT_MALLOC_FAILED;
+    }
+
+    // Keep the bucket table at most half full
+    if ( (dict->count + 1) * 2 > dict->bucket_count )
+    {
+	buckets = xt_malloc(dict->array_size * 2, sizeof(*buckets));
+	if ( buckets == NULL )
+	    return BL_CHROM_DICT_MALLOC_FAILED;
+	free(dict->buckets);
+	dict->buckets = buckets;
+	dict->bucket_count = dict->array_size * 2;
+	for (c = 0; c < dict->bucket_count; ++c)
+	    dict->buckets[c] = BL_CHROM_ID_NONE;
+	for (id = 0; id < (int32_t)dict->count; ++id)
+	{
+	    bucket = bl_chrom_dict_hash(dict->names[id]) &
+		     (dict->bucket_count - 1);
+	    while ( dict->buckets[bucket] != BL_CHROM_ID_NONE )
+		bucket = (bucket + 1) & (dict->bucket_count - 1);
+	    dict->buckets[bucket] = id;
+	}
+    }
+
+    if ( (dict->names[dict->count] = strdup(name)) == NULL )
+	return BL_CHROM_DICT_MALLOC_FAILED;
+    id = dict->count++;
+    dict->lengths[id] = length;
+    bucket = bl_chrom_dict_hash(name) & (dict->bucket_count - 1);
+    while ( dict->buckets[bucket] != BL_CHROM_ID_NONE )
+	bucket = (bucket + 1) & (dict->bucket_count - 1);
+    dict->buckets[bucket] = id;
+    dict->ranks_valid = 0;
+    return id;
+}
+
+
+
+/***************************************************************************
+ *  Name:
+ *      bl_chrom_dict_intern() - Get the ID of a record's chromosome
+ *
+ *  Library:
+ *      #include <biolibc/chrom-dict.h>
+ *      -lbiolibc -lxtend
+ *
+ *  Description:
+ *      Return the ID to store in a record whose chromosome is name, given
+ *      the ID stored for the previous record.  Sorted input nearly always
+ *      repeats the previous chromosome, so that is checked with a single
+ *      strcmp(3) before the dictionary is searched.  New names are added
+ *      with bl_chrom_dict_add(3).
+ *
+ *      This is used by the SAM, BAM, VCF, BED and GFF3 readers and is
+ *      rarely needed by applications.
+ *
+ *  Arguments:
+ *      dict        Pointer to a bl_chrom_dict_t object, or NULL
+ *      previous_id ID stored in the record before the current read
+ *      name        Chromosome name of the current record
+ *
+ *  Returns:
+ *      The ID of name, or BL_CHROM_ID_NONE if dict is NULL or name is
+ *      empty, "*" or "." (unmapped or masked)
+ *
+ *  See also:
+ *      bl_chrom_dict_add(3), bl_sam_set_chrom_dict(3)
+ *
+ *  History: 
+ *  Date        Name        Modification
+ *  2026-10-17  agent       Begin
+ ***************************************************************************/
+
+int32_t bl_chrom_dict_intern(bl_chrom_dict_t *dict, int32_t previous_id,
+			     const char *name)
+
+{
+    int32_t id;
+    
+    if ( (dict == NULL) || (*name == '\0') ||
+	 (((*name == '*') || (*name == '.')) && (name[1] == '\0')) )
+	return BL_CHROM_ID_NONE;
+    if ( (previous_id >= 0) && (previous_id < (int32_t)dict->count) &&
+	 (strcmp(dict->names[previous_id], name) == 0) )
+	return previous_id;
+    if ( (id = bl_chrom_dict_add(dict, name, 0)) < 0 )
+    {
+	fprintf(stderr, "bl_chrom_dict_intern(): Could not add %s.\n", name);
+	exit(EX_UNAVAILABLE);
+    }
+    return id;
+}
+
+/***************************************************************************
+ *  Name:
+ *      bl_chrom_dict_name_ptr_cmp() - Compare chromosome name pointers
+ *
+ *  Library:
+ *      #include <biolibc/chrom-dict.h>
+ *      -lbiolibc -lxtend
+ *
+ *  Description:
+ *      qsort(3) comparison function for an array of chromosome name
+ *      pointers.  Names are ordered by bl_chrom_name_cmp(3), with ties
+ *      between distinct names (e.g. chr1 and chr01) broken by strcmp(3)
+ *      so that every name gets a distinct rank.
+ *
+ *  Arguments:
+ *      name1, name2    Pointers to chromosome name pointers
+ *
+ *  Returns:
+ *      A value < 0 if *name1 sorts before *name2, > 0 if after,
+ *      0 if the names are identical
+ *
+ *  See also:
+ *      bl_chrom_dict_sort(3), bl_chrom_name_cmp(3)
+ *
+ *  History: 
+ *  Date        Name        Modification
+ *  2026-10-17  agent       Begin
+ ***************************************************************************/
+
+int     bl_chrom_dict_name_ptr_cmp(const char **name1, const char **name2)
+
+{
+    int     status = bl_chrom_name_cmp(*name1, *name2);
+
+    return status != 0 ? status : strcmp(*name1, *name2);
+}
+
+
+/***************************************************************************
+ *  Name:
+ *      bl_chrom_dict_sort() - Compute natural sort ranks of chromosome names
+ *
+ *  Library:
+ *      #include <biolibc/chrom-dict.h>
+ *      -lbiolibc -lxtend
+ *
+ *  Description:
+ *      Set ranks[id] to the position of each name in bl_chrom_name_cmp(3)
+ *      order.  bl_chrom_dict_cmp(3) calls this automatically after new
+ *      names are added, but programs that share a dictionary between
+ *      threads should call it once after seeding, since the lazy update
+ *      modifies the dictionary.
+ *
+ *  Arguments:
+ *      dict    Pointer to a bl_chrom_dict_t object
+ *
+ *  Returns:
+ *      BL_CHROM_DICT_OK or BL_CHROM_DICT_MALLOC_FAILED
+ *
+ *  See also:
+ *      bl_chrom_dict_cmp(3), bl_chrom_dict_name_ptr_cmp(3)
+ *
+ *  History: 
+ *  Date        Name        Modification
+ *  2026-10-17  agent       Begin
+ ***************************************************************************/
+
+int     bl_chrom_dict_sort(bl_chrom_dict_t *dict)
+
+{
+    char    **sorted;
+    size_t  c;
+
+    if ( dict->ranks_valid )
+	return BL_CHROM_DICT_OK;
+
+    if ( (sorted = xt_malloc(dict->count, sizeof(*sorted))) == NULL )
+	return BL_CHROM_DICT_MALLOC_FAILED;
+    memcpy(sorted, dict->names, dict->count * sizeof(*sorted));
+    qsort(sorted, dict->count, sizeof(*sorted),
+	  (int (*)(const void *,const void *))bl_chrom_dict_name_ptr_cmp);
+    for (c = 0; c < dict->count; ++c)
+	dict->ranks[bl_chrom_dict_lookup(dict, sorted[c])] = c;
+    free(sorted);
+    dict->ranks_valid = 1;
+    return BL_CHROM_DICT_OK;
+}
+
+
+/***************************************************************************
+ *  Name:
+ *      bl_chrom_dict_cmp() - Compare two chromosome IDs
+ *
+ *  Library:
+ *      #include <biolibc/chrom-dict.h>
+ *      -lbiolibc -lxtend
+ *
+ *  Description:
+ *      Compare the chromosomes with IDs id1 and id2 in the order defined
+ *      by bl_chrom_name_cmp(3), using the precomputed ranks.  Ranks are
+ *      updated first if names have been added since the last sort.
+ *      That update modifies dict, so this function is not thread-safe
+ *      unless bl_chrom_dict_sort(3) has been called since the last
+ *      name was added.
+ *
+ *  Arguments:
+ *      dict        Pointer to the bl_chrom_dict_t object holding both IDs
+ *      id1, id2    IDs returned by bl_chrom_dict_add(3)
+ *
+ *  Returns:
+ *      A value < 0 if id1 sorts before id2, > 0 if after, 0 if id1 == id2
+ *
+ *  See also:
+ *      bl_chrom_dict_sort(3), bl_chrom_name_cmp(3)
+ *
+ *  History: 
+ *  Date        Name        Modification
+ *  2026-10-17  agent       Begin
+ *  2026-10-17  agent       Document thread safety
+ ***************************************************************************/
+
+int     bl_chrom_dict_cmp(bl_chrom_dict_t *dict, int32_t id1, int32_t id2)
+
+{
+    if ( id1 == id2 )
+	return 0;
+    if ( !dict->ranks_valid &&
+	 (bl_chrom_dict_sort(dict) != BL_CHROM_DICT_OK) )
+    {
+	fprintf(stderr, "bl_chrom_dict_cmp(): Could not allocate sort array.\n");
+	exit(EX_UNAVAILABLE);
+    }
+    return dict->ranks[id1] - dict->ranks[id2];
+}
+
+
+/***************************************************************************
+ *  Name:
+ *      bl_chrom_dict_load_sam_header() - Seed a dictionary from @SQ lines
+ *
+ *  Library:
+ *      #include <biolibc/chrom-dict.h>
+ *      -lbiolibc -lxtend
+ *
+ *  Description:
+ *      Add the SN and LN of every @SQ line in a SAM header to dict, in
+ *      header order.  Reading stops at EOF or the first line not
+ *      beginning with '@', which is left unread, so header_stream may be
+ *      a SAM stream positioned at the start or a header copy returned by
+ *      bl_sam_skip_header(3).
+ *
+ *  Arguments:
+ *      dict            Pointer to a bl_chrom_dict_t object
+ *      header_stream   FILE stream containing SAM header lines
+ *
+ *  Returns:
+ *      BL_CHROM_DICT_OK on success
+ *      BL_CHROM_DICT_BAD_DATA if an @SQ line lacks SN
+ *      BL_CHROM_DICT_MALLOC_FAILED if memory could not be allocated
+ *
+ *  Examples:
+ *      bl_chrom_dict_t dict = BL_CHROM_DICT_INIT;
+ *      bl_sam_t        alignment = BL_SAM_INIT;
+ *
+ *      bl_chrom_dict_load_sam_header(&dict, sam_stream);
+ *      bl_sam_set_chrom_dict(&alignment, &dict);
+ *      while ( bl_sam_read(&alignment, sam_stream, BL_SAM_FIELD_ALL)
+ *              == BL_READ_OK )
+ *
+ *  See also:
+ *      bl_chrom_dict_load_vcf_header(3), bl_chrom_dict_load_fai(3)
+ *
+ *  History: 
+ *  Date        Name        Modification
+ *  2026-10-17  agent       Begin
+ ***************************************************************************/
+
+int     bl_chrom_dict_load_sam_header(bl_chrom_dict_t *dict,
+				      FILE *header_stream)
+
+{
+    char    *line = NULL, *sn, *ln;
+    size_t  line_array_size = 0, len;
+    int     ch, status = BL_CHROM_DICT_OK;
+
+    while ( (ch = getc(header_stream)) == '@' )
+    {
+	xt_dsv_read_field_malloc(header_stream, &line, &line_array_size,
+				 "\n", &len);
+	if ( line == NULL )
+	    return BL_CHROM_DICT_MALLOC_FAILED;
+	if ( strncmp(line, "SQ\t", 3) != 0 )
+	    continue;
+	if ( (sn = strstr(line, "\tSN:")) == NULL )
+	{
+	    status = BL_CHROM_DICT_BAD_DATA;
+	    break;
+	}
+	sn += 4;
+	ln = strstr(line, "\tLN:");
+	sn[strcspn(sn, "\t")] = '\0';
+	if ( bl_chrom_dict_add(dict, sn,
+		ln == NULL ? 0 : strtoll(ln + 4, NULL, 10)) < 0 )
+	{
+	    status = BL_CHROM_DICT_MALLOC_FAILED;
+	    break;
+	}
+    }
+    if ( (status == BL_CHROM_DICT_OK) && (ch != EOF) )
+	ungetc(ch, header_stream);
+    free(line);
+    return status;
+}
+
+
+/***************************************************************************
+ *  Name:
+ *      bl_chrom_dict_load_vcf_header() - Seed a dictionary from ##contig lines
+ *
+ *  Library:
+ *      #include <biolibc/chrom-dict.h>
+ *      -lbiolibc -lxtend
+ *
+ *  Description:
+ *      Add the ID and length of every ##contig line in a VCF header to
+ *      dict, in header order.  Reading stops at EOF or the first line not
+ *      beginning with '#', which is left unread.  header_stream may be
+ *      a VCF stream positioned at the start, in which case the #CHROM
+ *      line is consumed, or a copy of the meta-data returned by
+ *      bl_vcf_skip_meta_data(3) or bl_vcf_skip_header(3).
+ *
+ *  Arguments:
+ *      dict            Pointer to a bl_chrom_dict_t object
+ *      header_stream   FILE stream containing VCF meta-data lines
+ *
+ *  Returns:
+ *      BL_CHROM_DICT_OK on success
+ *      BL_CHROM_DICT_BAD_DATA if a ##contig line lacks ID
+ *      BL_CHROM_DICT_MALLOC_FAILED if memory could not be allocated
+ *
+ *  See also:
+ *      bl_chrom_dict_load_sam_header(3), bl_chrom_dict_load_fai(3)
+ *
+ *  History: 
+ *  Date        Name        Modification
+ *  2026-10-17  agent       Begin
+ ***************************************************************************/
+
+int     bl_chrom_dict_load_vcf_header(bl_chrom_dict_t *dict,
+				      FILE *header_stream)
+
+{
+    char    *line = NULL, *id, *length;
+    size_t  line_array_size = 0, len;
+    int     ch, status = BL_CHROM_DICT_OK;
+
+    while ( (ch = getc(header_stream)) == '#' )
+    {
+	xt_dsv_read_field_malloc(header_stream, &line, &line_array_size,
+				 "\n", &len);
+	if ( line == NULL )
+	    return BL_CHROM_DICT_MALLOC_FAILED;
+	if ( strncmp(line, "#contig=<", 9) != 0 )
+	    continue;
+	if ( (id = strstr(line + 9, "ID=")) == NULL )
+	{
+	    status = BL_CHROM_DICT_BAD_DATA;
+	    break;
+	}
+	id += 3;
+	length = strstr(line + 9, "length=");
+	id[strcspn(id, ",>")] = '\0';
+	if ( bl_chrom_dict_add(dict, id,
+		length == NULL ? 0 : strtoll(length + 7, NULL, 10)) < 0 )
+	{
+	    status = BL_CHROM_DICT_MALLOC_FAILED;
+	    break;
+	}
+    }
+    if ( (status == BL_CHROM_DICT_OK) && (ch != EOF) )
+	ungetc(ch, header_stream);
+    free(line);
+    return status;
+}
+
+
+/***************************************************************************
+ *  Name:
+ *      bl_chrom_dict_load_fai() - Seed a dictionary from a FASTA index
+ *
+ *  Library:
+ *      #include <biolibc/chrom-dict.h>
+ *      -lbiolibc -lxtend
+ *
+ *  Description:
+ *      Add the name and length of every entry in a samtools .fai stream
+ *      to dict, in index order.
+ *
+ *  Arguments:
+ *      dict        Pointer to a bl_chrom_dict_t object
+ *      fai_stream  FILE stream containing a .fai index
+ *
+ *  Returns:
+ *      BL_CHROM_DICT_OK on success
+ *      BL_CHROM_DICT_BAD_DATA if an entry lacks a length
+ *      BL_CHROM_DICT_MALLOC_FAILED if memory could not be allocated
+ *
+ *  See also:
+ *      bl_chrom_dict_load_sam_header(3), bl_fasta_index_load(3)
+ *
+ *  History: 
+ *  Date        Name        Modification
+ *  2026-10-17  agent       Begin
+ ***************************************************************************/
+
+int     bl_chrom_dict_load_fai(bl_chrom_dict_t *dict, FILE *fai_stream)
+
+{
+    char    *name = NULL,
+	    field[BL_POSITION_MAX_DIGITS + 1],
+	    *end;
+    size_t  name_array_size = 0,
+	    len;
+    int64_t length;
+    int     delim,
+	    status = BL_CHROM_DICT_OK;
+
+    while ( (delim = xt_tsv_read_field_malloc(fai_stream, &name,
+			&name_array_size, &len)) != EOF )
+    {
+	if ( name == NULL )
+	    return BL_CHROM_DICT_MALLOC_FAILED;
+	if ( delim != '\t' )
+	{
+	    status = BL_CHROM_DICT_BAD_DATA;
+	    break;
+	}
+	delim = xt_tsv_read_field(fai_stream, field, BL_POSITION_MAX_DIGITS,
+				  &len);
+	length = strtoll(field, &end, 10);
+	if ( (len == 0) || (*end != '\0') )
+	{
+	    status = BL_CHROM_DICT_BAD_DATA;
+	    break;
+	}
+	if ( delim == '\t' )
+	    xt_tsv_skip_rest_of_line(fai_stream);
+	if ( bl_chrom_dict_add(dict, name, length) < 0 )
+	{
+	    status = BL_CHROM_DICT_MALLOC_FAILED;
+	    break;
+	}
+    }
+    free(name);
+    return status;
+}
@@ -0,0 +1,73 @@
+#ifndef _BIOLIBC_CHROM_DICT_H_
+#define _BIOLIBC_CHROM_DICT_H_
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+#ifndef _BIOLIBC_H_
+#include "biolibc.h"
+#endif
+
+/*
+ *  Interned chromosome names shared by SAM, VCF, BED and GFF3 records.
+ *  Each distinct name gets a small integer ID, in order of first
+ *  appearance.  Readers given a dictionary record the ID alongside the
+ *  name, so that equality and sort order checks on every record reduce
+ *  to integer compares instead of strcmp() and bl_chrom_name_cmp().
+ *
+ *  ranks[id] is the position of names[id] in bl_chrom_name_cmp() order.
+ *  It is recomputed lazily after names are added.  Seed the dictionary
+ *  from a SAM header, VCF meta-data or .fai and call bl_chrom_dict_sort()
+ *  before sharing it between threads.
+ */
+
+typedef struct
+{
+    size_t      array_size,
+		count;
+    char        **names;        // Indexed by ID
+    int64_t     *lengths;       // Sequence length, 0 if unknown
+    int32_t     *ranks;         // Natural sort rank, indexed by ID
+    int32_t     *buckets;       // Open addressing hash of IDs, -1 = empty
+    size_t      bucket_count;   // Power of 2, at least twice count
+    int         ranks_valid;    // ranks covers every name
+}   bl_chrom_dict_t;
+
+#define BL_CHROM_DICT_INIT { 0, 0, NULL, NULL, NULL, NULL, 0, 1 }
+
+// IDs are >= 0.  Records with no dictionary or RNAME "*" use BL_CHROM_ID_NONE.
+#define BL_CHROM_ID_NONE                -1
+
+// True if two records' chromosomes can be compared by ID instead of name
+#define BL_CHROM_IDS_COMPARABLE(dict1, id1, dict2, id2) \
+	(((dict1) != NULL) && ((dict1) == (dict2)) && ((id1) >= 0) && ((id2) >= 0))
+
+#define BL_CHROM_DICT_OK                0
+#define BL_CHROM_DICT_MALLOC_FAILED     -2
+#define BL_CHROM_DICT_BAD_DATA          -3
+
+#include "chrom-dict-rvs.h"
+#include "chrom-dict-accessors.h"
+#include "chrom-dict-mutators.h"
+
+/* chrom-dict.c */
+void bl_chrom_dict_init(bl_chrom_dict_t *dict);
+void bl_chrom_dict_free(bl_chrom_dict_t *dict);
+uint32_t bl_chrom_dict_hash(const char *name);
+int32_t bl_chrom_dict_lookup(bl_chrom_dict_t *dict, const char *name);
+int32_t bl_chrom_dict_add(bl_chrom_dict_t *dict, const char *name, int64_t length);
+int32_t bl_chrom_dict_intern(bl_chrom_dict_t *dict, int32_t previous_id, const char *name);
+int bl_chrom_dict_name_ptr_cmp(const char **name1, const char **name2);
+int bl_chrom_dict_sort(bl_chrom_dict_t *dict);
+int bl_chrom_dict_cmp(bl_chrom_dict_t *dict, int32_t id1, int32_t id2);
+int bl_chrom_dict_load_sam_header(bl_chrom_dict_t *dict, FILE *header_stream);
+int bl_chrom_dict_load_vcf_header(bl_chrom_dict_t *dict, FILE *header_stream);
+int bl_chrom_dict_load_fai(bl_chrom_dict_t *dict, FILE *fai_stream);
+
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif // _BIOLIBC_CHROM_DICT_H_
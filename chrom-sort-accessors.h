@@ -0,0 +1,15 @@
+    
+/*
+ *  Generated by /usr/local/bin/auto-gen-get-set
+ *
+ *  Accessor macros.  Use these to access structure members from functions
+ *  outside the bl_chrom_sort_t class.
+ *
+ *  These generated macros are not expected to be perfect.  Check and edit
+ *  as needed before adding to your code.
+ */
+
+#define BL_CHROM_SORT_CHROM_COL(ptr)    ((ptr)->chrom_col)
+#define BL_CHROM_SORT_POS_COL(ptr)      ((ptr)->pos_col)
+#define BL_CHROM_SORT_MAX_RUN_BYTES(ptr) ((ptr)->max_run_bytes)
+#define BL_CHROM_SORT_THREADS(ptr)      ((ptr)->threads)
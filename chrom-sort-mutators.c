@@ -0,0 +1,234 @@
+/***************************************************************************
+ *  This file is automatically generated by gen-get-set.  Be sure to keep
+ *  track of any manual changes.
+ *
+ *  These generated functions are not expected to be perfect.  Check and
+ *  edit as needed before adding to your code.
+ ***************************************************************************/
+
+#include <string.h>
+#include <ctype.h>
+#include <stdbool.h>        // In case of bool
+#include <stdint.h>         // In case of int64_t, etc
+#include <xtend/string.h>   // strlcpy() on Linux
+#include "chrom-sort.h"
+
+
+/***************************************************************************
+ *  Library:
+ *      #include <biolibc/chrom-sort.h>
+ *      -lbiolibc -lxtend
+ *
+ *  Description:
+ *      Mutator for chrom_col member in a bl_chrom_sort_t structure.
+ *      Use this function to set chrom_col in a bl_chrom_sort_t object
+ *      from non-member functions.  This function performs a direct
+ *      assignment for scalar or pointer structure members.  If
+ *      chrom_col is a pointer, data previously pointed to should
+ *      be freed before calling this function to avoid memory
+ *      leaks.
+ *
+ *  Arguments:
+ *      bl_chrom_sort_ptr Pointer to the structure to set
+ *      new_chrom_col   The new value for chrom_col
+ *
+ *  Returns:
+ *      BL_CHROM_SORT_DATA_OK if the new value is acceptable and assigned
+ *      BL_CHROM_SORT_DATA_OUT_OF_RANGE otherwise
+ *
+ *  Examples:
+ *      bl_chrom_sort_t bl_chrom_sort;
+ *      unsigned        new_chrom_col;
+ *
+ *      if ( bl_chrom_sort_set_chrom_col(&bl_chrom_sort, new_chrom_col)
+ *              == BL_CHROM_SORT_DATA_OK )
+ *      {
+ *      }
+ *
+ *  See also:
+ *      (3)
+ *
+ *  History: 
+ *  Date        Name        Modification
+ *  2026-10-17  gen-get-set Auto-generated from chrom-sort.h
+ ***************************************************************************/
+
+int     bl_chrom_sort_set_chrom_col(
+	    bl_chrom_sort_t *bl_chrom_sort_ptr,
+	    unsigned new_chrom_col
+	)
+
+{
+    if ( false )
+	return BL_CHROM_SORT_DATA_OUT_OF_RANGE;
+    else
+    {
+	bl_chrom_sort_ptr->chrom_col = new_chrom_col;
+	return BL_CHROM_SORT_DATA_OK;
+    }
+}
+
+
+/***************************************************************************
+ *  Library:
+ *      #include <biolibc/chrom-sort.h>
+ *      -lbiolibc -lxtend
+ *
+ *  Description:
+ *      Mutator for pos_col member in a bl_chrom_sort_t structure.
+ *      Use this function to set pos_col in a bl_chrom_sort_t object
+ *      from non-member functions.  This function performs a direct
+ *      assignment for scalar or pointer structure members.  If
+ *      pos_col is a pointer, data previously pointed to should
+ *      be freed before calling this function to avoid memory
+ *      leaks.
+ *
+ *  Arguments:
+ *      bl_chrom_sort_ptr Pointer to the structure to set
+ *      new_pos_col     The new value for pos_col
+ *
+ *  Returns:
+ *      BL_CHROM_SORT_DATA_OK if the new value is acceptable and assigned
+ *      BL_CHROM_SORT_DATA_OUT_OF_RANGE otherwise
+ *
+ *  Examples:
+ *      bl_chrom_sort_t bl_chrom_sort;
+ *      unsigned        new_pos_col;
+ *
+ *      if ( bl_chrom_sort_set_pos_col(&bl_chrom_sort, new_pos_col)
+ *              == BL_CHROM_SORT_DATA_OK )
+ *      {
+ *      }
+ *
+ *  See also:
+ *      (3)
+ *
+ *  History: 
+ *  Date        Name        Modification
+ *  2026-10-17  gen-get-set Auto-generated from chrom-sort.h
+ ***************************************************************************/
+
+int     bl_chrom_sort_set_pos_col(
+	    bl_chrom_sort_t *bl_chrom_sort_ptr,
+	    unsigned new_pos_col
+	)
+
+{
+    if ( false )
+	return BL_CHROM_SORT_DATA_OUT_OF_RANGE;
+    else
+    {
+	bl_chrom_sort_ptr->pos_col = new_pos_col;
+	return BL_CHROM_SORT_DATA_OK;
+    }
+}
+
+
+/***************************************************************************
+ *  Library:
+ *      #include <biolibc/chrom-sort.h>
+ *      -lbiolibc -lxtend
+ *
+ *  Description:
+ *      Mutator for max_run_bytes member in a bl_chrom_sort_t structure.
+ *      Use this function to set max_run_bytes in a bl_chrom_sort_t object
+ *      from non-member functions.  This function performs a direct
+ *      assignment for scalar or pointer structure members.  If
+ *      max_run_bytes is a pointer, data previously pointed to should
+ *      be freed before calling this function to avoid memory
+ *      leaks.
+ *
+ *  Arguments:
+ *      bl_chrom_sort_ptr Pointer to the structure to set
+ *      new_max_run_bytes The new value for max_run_bytes
+ *
+ *  Returns:
+ *      BL_CHROM_SORT_DATA_OK if the new value is acceptable and assigned
+ *      BL_CHROM_SORT_DATA_OUT_OF_RANGE otherwise
+ *
+ *  Examples:
+ *      bl_chrom_sort_t bl_chrom_sort;
+ *      size_t          new_max_run_bytes;
+ *
+ *      if ( bl_chrom_sort_set_max_run_bytes(&bl_chrom_sort, new_max_run_bytes)
+ *              == BL_CHROM_SORT_DATA_OK )
+ *      {
+ *      }
+ *
+ *  See also:
+ *      (3)
+ *
+ *  History: 
+ *  Date        Name        Modification
+ *  2026-10-17  gen-get-set Auto-generated from chrom-sort.h
+ ***************************************************************************/
+
+int     bl_chrom_sort_set_max_run_bytes(
+	    bl_chrom_sort_t *bl_chrom_sort_ptr,
+	    size_t new_max_run_bytes
+	)
+
+{
+    if ( false )
+	return BL_CHROM_SORT_DATA_OUT_OF_RANGE;
+    else
+    {
+	bl_chrom_sort_ptr->max_run_bytes = new_max_run_bytes;
+	return BL_CHROM_SORT_DATA_OK;
+    }
+}
+
+
+/***************************************************************************
+ *  Library:
+ *      #include <biolibc/chrom-sort.h>
+ *      -lbiolibc -lxtend
+ *
+ *  Description:
+ *      Mutator for threads member in a bl_chrom_sort_t structure.
+ *      Use this function to set threads in a bl_chrom_sort_t object
+ *      from non-member functions.  This function performs a direct
+ *      assignment for scalar or pointer structure members.  If
+ *      threads is a pointer, data previously pointed to should
+ *      be freed before calling this function to avoid memory
+ *      leaks.
+ *
+ *  Arguments:
+ *      bl_chrom_sort_ptr Pointer to the structure to set
+ *      new_threads     The new value for threads
+ *
+ *  Returns:
+ *      BL_CHROM_SORT_DATA_OK if the new value is acceptable and assigned
+ *      BL_CHROM_SORT_DATA_OUT_OF_RANGE otherwise
+ *
+ *  Examples:
+ *      bl_chrom_sort_t bl_chrom_sort;
+ *      unsigned        new_threads;
+ *
+ *      if ( bl_chrom_sort_set_threads(&bl_chrom_sort, new_threads)
+ *              == BL_CHROM_SORT_DATA_OK )
+ *      {
+ *      }
+ *
+ *  See also:
+ *      (3)
+ *
+ *  History: 
+ *  Date        Name        Modification
+ *  2026-10-17  gen-get-set Auto-generated from chrom-sort.h
+ ***************************************************************************/
+
+int     bl_chrom_sort_set_threads(
+	    bl_chrom_sort_t *bl_chrom_sort_ptr,
+	    unsigned new_threads
+	)
+
+{
+    if ( false )
+	return BL_CHROM_SORT_DATA_OUT_OF_RANGE;
+    else
+    {
+	bl_chrom_sort_ptr->threads = new_threads;
+	return BL_CHROM_SORT_DATA_OK;
+    }
+}
@@ -0,0 +1,20 @@
+
+/*
+ *  Generated by /usr/local/bin/auto-gen-get-set
+ *
+ *  Mutator functions for setting with no sanity checking.  Use these to
+ *  set structure members from functions outside the bl_chrom_sort_t
+ *  class.  These macros perform no data validation.  Hence, they achieve
+ *  maximum performance where data are guaranteed correct by other means.
+ *  Use the mutator functions (same name as the macro, but lower case)
+ *  for more robust code with a small performance penalty.
+ *
+ *  These generated macros are not expected to be perfect.  Check and edit
+ *  as needed before adding to your code.
+ */
+
+/* temp-chrom-sort-mutators.c */
+int bl_chrom_sort_set_chrom_col(bl_chrom_sort_t *bl_chrom_sort_ptr, unsigned new_chrom_col);
+int bl_chrom_sort_set_pos_col(bl_chrom_sort_t *bl_chrom_sort_ptr, unsigned new_pos_col);
+int bl_chrom_sort_set_max_run_bytes(bl_chrom_sort_t *bl_chrom_sort_ptr, size_t new_max_run_bytes);
+int bl_chrom_sort_set_threads(bl_chrom_sort_t *bl_chrom_sort_ptr, unsigned new_threads);
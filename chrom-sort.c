@@ -0,0 +1,892 @@
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <limits.h>
+#include <sysexits.h>
+#include <pthread.h>
+#include <xtend/mem.h>
+#include <xtend/math.h>     // XT_MIN()
+#include "chrom-sort.h"
+
+/***************************************************************************
+ *  Name:
+ *      bl_chrom_sort_init() - Initialize an external chromosome sort
+ *
+ *  Library:
+ *      #include <biolibc/chrom-sort.h>
+ *      -lbiolibc -lxtend -lpthread
+ *
+ *  Description:
+ *      Initialize a bl_chrom_sort_t object for sorting lines of the
+ *      given format by chromosome and position.  The key columns are
+ *      RNAME and POS for BL_CHROM_SORT_FORMAT_SAM, CHROM and POS for
+ *      BL_CHROM_SORT_FORMAT_VCF, chrom and chromStart for
+ *      BL_CHROM_SORT_FORMAT_BED, and seqid and start for
+ *      BL_CHROM_SORT_FORMAT_GFF3.  Other tab-separated formats can be
+ *      sorted by setting the columns with bl_chrom_sort_set_chrom_col(3)
+ *      and bl_chrom_sort_set_pos_col(3).
+ *
+ *      The memory limit and thread count default to
+ *      BL_CHROM_SORT_DEFAULT_RUN_BYTES and BL_CHROM_SORT_DEFAULT_THREADS,
+ *      and may be changed with bl_chrom_sort_set_max_run_bytes(3) and
+ *      bl_chrom_sort_set_threads(3).
+ *
+ *  Arguments:
+ *      sort    Pointer to the bl_chrom_sort_t object to initialize
+ *      format  BL_CHROM_SORT_FORMAT_SAM, _VCF, _BED, or _GFF3
+ *
+ *  See also:
+ *      bl_chrom_sort_file(3), bl_chrom_sort_free(3)
+ *
+ *  History:
+ *  Date        Name        Modification
+ *  2026-10-17  agent       Begin
+ ***************************************************************************/
+
+void    bl_chrom_sort_init(bl_chrom_sort_t *sort, int format)
+
+{
+    switch(format)
+    {
+	case BL_CHROM_SORT_FORMAT_SAM:
+	    sort->chrom_col = 3;
+	    sort->pos_col = 4;
+	    break;
+	case BL_CHROM_SORT_FORMAT_GFF3:
+	    sort->chrom_col = 1;
+	    sort->pos_col = 4;
+	    break;
+	default:    // VCF and BED
+	    sort->chrom_col = 1;
+	    sort->pos_col = 2;
+	    break;
+    }
+    sort->max_run_bytes = BL_CHROM_SORT_DEFAULT_RUN_BYTES;
+    sort->threads = BL_CHROM_SORT_DEFAULT_THREADS;
+    bl_chrom_dict_init(&sort->dict);
+    sort->seq = 0;
+    sort->in_header = true;
+    sort->buff = NULL;
+    sort->buff_len = 0;
+    sort->buff_size = 0;
+    sort->lines = NULL;
+    sort->line_count = 0;
+    sort->line_array_size = 0;
+    sort->runs = NULL;
+    sort->run_count = 0;
+    sort->run_array_size = 0;
+}
+
+
+/***************************************************************************
+ *  Name:
+ *      bl_chrom_sort_free() - Free memory held by a chromosome sort
+ *
+ *  Library:
+ *      #include <biolibc/chrom-sort.h>
+ *      -lbiolibc -lxtend -lpthread
+ *
+ *  Description:
+ *      Free all memory and close any temporary run files held by a
+ *      bl_chrom_sort_t object.  The object must be reinitialized with
+ *      bl_chrom_sort_init(3) before reuse.
+ *
+ *  Arguments:
+ *      sort    Pointer to the bl_chrom_sort_t object
+ *
+ *  See also:
+ *      bl_chrom_sort_init(3)
+ *
+ *  History:
+ *  Date        Name        Modification
+ *  2026-10-17  agent       Begin
+ ***************************************************************************/
+
+void    bl_chrom_sort_free(bl_chrom_sort_t *sort)
+
+{
+    size_t  c;
+
+    for (c = 0; c < sort->run_count; ++c)
+	fclose(sort->runs[c]);
+    free(sort->runs);
+    free(sort->lines);
+    free(sort->buff);
+    bl_chrom_dict_free(&sort->dict);
+    sort->runs = NULL;
+    sort->lines = NULL;
+    sort->buff = NULL;
+    sort->run_count = sort->run_array_size = 0;
+    sort->line_count = sort->line_array_size = 0;
+    sort->buff_len = sort->buff_size = 0;
+}
+
+
+/***************************************************************************
+ *  Name:
+ *      bl_chrom_sort_file() - Sort a SAM, VCF, BED, or GFF3 stream
+ *
+ *  Library:
+ *      #include <biolibc/chrom-sort.h>
+ *      -lbiolibc -lxtend -lpthread
+ *
+ *  Description:
+ *      Sort all lines of in_stream by chromosome, in bl_chrom_name_cmp(3)
+ *      order, and position, and write them to out_stream, replacing a
+ *      separate "sort -k1,1V -k2,2n" pass.  Header lines before the first
+ *      record are copied first.  Memory use is bounded by max_run_bytes;
+ *      larger inputs are sorted in runs that are spilled to temporary
+ *      files and merged.
+ *
+ *      The input may be a pipe.  For compressed input, pass a stream
+ *      from bl_bgzf_fopen(3) or similar.
+ *
+ *  Arguments:
+ *      sort        Pointer to a bl_chrom_sort_t object initialized by
+ *                  bl_chrom_sort_init(3)
+ *      in_stream   Unsorted input
+ *      out_stream  Sorted output
+ *
+ *  Returns:
+ *      BL_CHROM_SORT_OK on success,
+ *      BL_CHROM_SORT_BAD_DATA if a record lacks the key columns,
+ *      BL_CHROM_SORT_MALLOC_FAILED, BL_CHROM_SORT_IO_ERROR, or
+ *      BL_CHROM_SORT_THREAD_FAILED otherwise
+ *
+ *  Examples:
+ *      bl_chrom_sort_t sort;
+ *
+ *      bl_chrom_sort_init(&sort, BL_CHROM_SORT_FORMAT_BED);
+ *      bl_chrom_sort_set_threads(&sort, 8);
+ *      if ( bl_chrom_sort_file(&sort, stdin, stdout) != BL_CHROM_SORT_OK )
+ *          fprintf(stderr, "Sort failed.\n");
+ *      bl_chrom_sort_free(&sort);
+ *
+ *  See also:
+ *      bl_chrom_sort_add_line(3), bl_chrom_sort_merge(3),
+ *      bl_chrom_name_cmp(3)
+ *
+ *  History:
+ *  Date        Name        Modification
+ *  2026-10-17  agent       Begin
+ ***************************************************************************/
+
+int     bl_chrom_sort_file(bl_chrom_sort_t *sort, FILE *in_stream,
+			   FILE *out_stream)
+
+{
+    char    *line = NULL;
+    size_t  line_array_size = 0;
+    ssize_t line_len;
+    int     status = BL_CHROM_SORT_OK;
+
+    while ( (status == BL_CHROM_SORT_OK) &&
+	    ((line_len = getline(&line, &line_array_size, in_stream)) > 0) )
+    {
+	if ( sort->in_header && ((*line == '#') || (*line == '@')) )
+	{
+	    if ( fwrite(line, line_len, 1, out_stream) != 1 )
+		status = BL_CHROM_SORT_IO_ERROR;
+	}
+	else if ( *line != '#' )
+	{
+	    sort->in_header = false;
+	    status = bl_chrom_sort_add_line(sort, line, line_len);
+	}
+    }
+    free(line);
+    if ( ferror(in_stream) )
+	return BL_CHROM_SORT_IO_ERROR;
+    if ( status != BL_CHROM_SORT_OK )
+	return status;
+    return bl_chrom_sort_merge(sort, out_stream);
+}
+
+
+/***************************************************************************
+ *  Name:
+ *      bl_chrom_sort_add_line() - Add a record to a chromosome sort
+ *
+ *  Library:
+ *      #include <biolibc/chrom-sort.h>
+ *      -lbiolibc -lxtend -lpthread
+ *
+ *  Description:
+ *      Add one line, with or without a trailing newline, to the current
+ *      run.  If the run reaches max_run_bytes, it is sorted and written
+ *      to a temporary file with bl_chrom_sort_run(3).  Call
+ *      bl_chrom_sort_merge(3) after the last line.
+ *
+ *      This is used by bl_chrom_sort_file(3) and by applications that
+ *      generate records themselves.  Header lines must not be added.
+ *
+ *  Arguments:
+ *      sort    Pointer to a bl_chrom_sort_t object
+ *      line    Record text
+ *      len     Length of line
+ *
+ *  Returns:
+ *      BL_CHROM_SORT_OK on success, or any error returned by
+ *      bl_chrom_sort_parse_key(3) or bl_chrom_sort_run(3)
+ *
+ *  See also:
+ *      bl_chrom_sort_file(3), bl_chrom_sort_merge(3)
+ *
+ *  History:
+ *  Date        Name        Modification
+ *  2026-10-17  agent       Begin
+ ***************************************************************************/
+
+int     bl_chrom_sort_add_line(bl_chrom_sort_t *sort, const char *line,
+			       size_t len)
+
+{
+    bl_chrom_sort_line_t    *sl;
+    size_t  needed;
+    int     status;
+    FILE    *run;
+
+    if ( (len > 0) && (line[len - 1] == '\n') )
+	--len;
+    needed = len + 1;
+
+    // Spill the current run if this line would exceed the limit
+    if ( (sort->line_count > 0) &&
+	 (sort->buff_len + needed + (sort->line_count + 1) * sizeof(*sl)
+	    > sort->max_run_bytes) )
+    {
+	if ( sort->run_count == sort->run_array_size )
+	{
+	    sort->run_array_size = sort->run_array_size == 0 ? 16 :
+				   sort->run_array_size * 2;
+	    if ( (sort->runs = xt_realloc(sort->runs, sort->run_array_size,
+					  sizeof(*sort->runs))) == NULL )
+		return BL_CHROM_SORT_MALLOC_FAILED;
+	}
+	if ( (run = tmpfile()) == NULL )
+	    return BL_CHROM_SORT_IO_ERROR;
+	sort->runs[sort->run_count++] = run;
+	if ( (status = bl_chrom_sort_run(sort, run, true)) != BL_CHROM_SORT_OK )
+	    return status;
+    }
+
+    if ( sort->line_count == sort->line_array_size )
+    {
+	sort->line_array_size = sort->line_array_size == 0 ?
+	    BL_CHROM_SORT_START_SIZE : sort->line_array_size * 2;
+	if ( (sort->lines = xt_realloc(sort->lines, sort->line_array_size,
+				       sizeof(*sort->lines))) == NULL )
+	    return BL_CHROM_SORT_MALLOC_FAILED;
+    }
+    while ( sort->buff_len + needed > sort->buff_size )
+    {
+	sort->buff_size = sort->buff_size == 0 ?
+	    BL_CHROM_SORT_START_SIZE * 16 : sort->buff_size * 2;
+	if ( (sort->buff = xt_realloc(sort->buff, sort->buff_size,
+				      sizeof(*sort->buff))) == NULL )
+	    return BL_CHROM_SORT_MALLOC_FAILED;
+    }
+
+    sl = &sort->lines[sort->line_count];
+    if ( (status = bl_chrom_sort_parse_key(sort, line, len, &sl->key))
+	    != BL_CHROM_SORT_OK )
+	return status;
+    sl->key.len = needed;
+    sl->offset = sort->buff_len;
+    memcpy(sort->buff + sort->buff_len, line, len);
+    sort->buff[sort->buff_len + len] = '\n';
+    sort->buff_len += needed;
+    ++sort->line_count;
+    return BL_CHROM_SORT_OK;
+}
+
+
+/***************************************************************************
+ *  Name:
+ *      bl_chrom_sort_parse_key() - Extract the sort key of a record
+ *
+ *  Library:
+ *      #include <biolibc/chrom-sort.h>
+ *      -lbiolibc -lxtend -lpthread
+ *
+ *  Description:
+ *      Find the chromosome and position columns of line and fill in
+ *      key.  The chromosome is interned in sort's dictionary, so that
+ *      keys compare by natural sort rank instead of by name.  "*" and "."
+ *      get BL_CHROM_ID_NONE and sort after all chromosomes.
+ *
+ *  Arguments:
+ *      sort    Pointer to a bl_chrom_sort_t object
+ *      line    Record text, not necessarily NUL-terminated
+ *      len     Length of line, not including any newline
+ *      key     Pointer to the key to fill in
+ *
+ *  Returns:
+ *      BL_CHROM_SORT_OK on success, BL_CHROM_SORT_BAD_DATA if the
+ *      columns are missing or the position is not an integer
+ *
+ *  See also:
+ *      bl_chrom_sort_add_line(3), bl_chrom_dict_intern(3)
+ *
+ *  History:
+ *  Date        Name        Modification
+ *  2026-10-17  agent       Begin
+ ***************************************************************************/
+
+int     bl_chrom_sort_parse_key(bl_chrom_sort_t *sort, const char *line,
+				size_t len, bl_chrom_sort_key_t *key)
+
+{
+    char        chrom[BL_CHROM_MAX_CHARS + 1],
+		pos[BL_POSITION_MAX_DIGITS + 1],
+		*end;
+    const char  *p = line,
+		*limit = line + len,
+		*field_end;
+    unsigned    col;
+    size_t      field_len;
+    int32_t     previous_id;
+
+    *chrom = *pos = '\0';
+    for (col = 1; p <= limit; ++col, p = field_end + 1)
+    {
+	for (field_end = p; (field_end < limit) && (*field_end != '\t');
+	     ++field_end)
+	    ;
+	field_len = field_end - p;
+	if ( col == sort->chrom_col )
+	{
+	    if ( field_len > BL_CHROM_MAX_CHARS )
+		return BL_CHROM_SORT_BAD_DATA;
+	    memcpy(chrom, p, field_len);
+	    chrom[field_len] = '\0';
+	}
+	else if ( col == sort->pos_col )
+	{
+	    if ( field_len > BL_POSITION_MAX_DIGITS )
+		return BL_CHROM_SORT_BAD_DATA;
+	    memcpy(pos, p, field_len);
+	    pos[field_len] = '\0';
+	}
+	if ( (col >= sort->chrom_col) && (col >= sort->pos_col) )
+	    break;
+    }
+    if ( (*chrom == '\0') || (*pos == '\0') )
+    {
+	fprintf(stderr, "bl_chrom_sort_parse_key(): Missing key columns: %.*s\n",
+		(int)len, line);
+	return BL_CHROM_SORT_BAD_DATA;
+    }
+
+    key->pos = strtoll(pos, &end, 10);
+    if ( *end != '\0' )
+    {
+	fprintf(stderr, "bl_chrom_sort_parse_key(): Invalid position: %s\n",
+		pos);
+	return BL_CHROM_SORT_BAD_DATA;
+    }
+    previous_id = sort->line_count > 0 ?
+		  sort->lines[sort->line_count - 1].key.chrom_id :
+		  BL_CHROM_ID_NONE;
+    key->chrom_id = bl_chrom_dict_intern(&sort->dict, previous_id, chrom);
+    key->seq = sort->seq++;
+    return BL_CHROM_SORT_OK;
+}
+
+
+/***************************************************************************
+ *  Name:
+ *      bl_chrom_sort_key_cmp() - Compare chromosome sort keys
+ *
+ *  Library:
+ *      #include <biolibc/chrom-sort.h>
+ *      -lbiolibc -lxtend -lpthread
+ *
+ *  Description:
+ *      Compare two keys by chromosome rank, position, and input order.
+ *      Ranks must have been set by bl_chrom_sort_set_ranks(3).
+ *
+ *  Arguments:
+ *      key1, key2  Pointers to bl_chrom_sort_key_t objects
+ *
+ *  Returns:
+ *      A value < 0 if key1 sorts before key2, > 0 if after, 0 if equal
+ *
+ *  See also:
+ *      bl_chrom_sort_line_cmp(3), bl_chrom_sort_set_ranks(3)
+ *
+ *  History:
+ *  Date        Name        Modification
+ *  2026-10-17  agent       Begin
+ ***************************************************************************/
+
+int     bl_chrom_sort_key_cmp(const bl_chrom_sort_key_t *key1,
+			      const bl_chrom_sort_key_t *key2)
+
+{
+    if ( key1->rank != key2->rank )
+	return key1->rank < key2->rank ? -1 : 1;
+    if ( key1->pos != key2->pos )
+	return key1->pos < key2->pos ? -1 : 1;
+    if ( key1->seq != key2->seq )
+	return key1->seq < key2->seq ? -1 : 1;
+    return 0;
+}
+
+
+/***************************************************************************
+ *  Name:
+ *      bl_chrom_sort_line_cmp() - Compare lines of a chromosome sort run
+ *
+ *  Library:
+ *      #include <biolibc/chrom-sort.h>
+ *      -lbiolibc -lxtend -lpthread
+ *
+ *  Description:
+ *      qsort(3) comparison function for bl_chrom_sort_line_t objects,
+ *      comparing their keys with bl_chrom_sort_key_cmp(3).
+ *
+ *  Arguments:
+ *      line1, line2    Pointers to bl_chrom_sort_line_t objects
+ *
+ *  Returns:
+ *      A value < 0 if line1 sorts before line2, > 0 if after, 0 if equal
+ *
+ *  See also:
+ *      bl_chrom_sort_key_cmp(3)
+ *
+ *  History:
+ *  Date        Name        Modification
+ *  2026-10-17  agent       Begin
+ ***************************************************************************/
+
+int     bl_chrom_sort_line_cmp(const bl_chrom_sort_line_t *line1,
+			       const bl_chrom_sort_line_t *line2)
+
+{
+    return bl_chrom_sort_key_cmp(&line1->key, &line2->key);
+}
+
+
+/***************************************************************************
+ *  Name:
+ *      bl_chrom_sort_set_ranks() - Set the chromosome rank of a sort key
+ *
+ *  Library:
+ *      #include <biolibc/chrom-sort.h>
+ *      -lbiolibc -lxtend -lpthread
+ *
+ *  Description:
+ *      Copy the natural sort rank of key's chromosome from sort's
+ *      dictionary into key, so that comparisons need not consult the
+ *      dictionary.  Keys with no chromosome rank last.  The dictionary
+ *      must have been sorted with bl_chrom_dict_sort(3).
+ *
+ *      Ranks change as chromosomes are added, so they are set again
+ *      whenever keys are compared after more input has been read.  The
+ *      relative order of two chromosomes never changes.
+ *
+ *  Arguments:
+ *      sort    Pointer to a bl_chrom_sort_t object
+ *      key     Pointer to the key
+ *
+ *  See also:
+ *      bl_chrom_sort_key_cmp(3), bl_chrom_dict_sort(3)
+ *
+ *  History:
+ *  Date        Name        Modification
+ *  2026-10-17  agent       Begin
+ ***************************************************************************/
+
+void    bl_chrom_sort_set_ranks(bl_chrom_sort_t *sort, bl_chrom_sort_key_t *key)
+
+{
+    key->rank = key->chrom_id == BL_CHROM_ID_NONE ? INT32_MAX :
+		sort->dict.ranks[key->chrom_id];
+}
+
+
+/***************************************************************************
+ *  Name:
+ *      bl_chrom_sort_slice() - Sort one slice of a run
+ *
+ *  Library:
+ *      #include <biolibc/chrom-sort.h>
+ *      -lbiolibc -lxtend -lpthread
+ *
+ *  Description:
+ *      Thread function used by bl_chrom_sort_run(3) to qsort(3) one
+ *      slice of the current run's lines.
+ *
+ *  Arguments:
+ *      arg     Pointer to a bl_chrom_sort_slice_t object
+ *
+ *  Returns:
+ *      NULL
+ *
+ *  See also:
+ *      bl_chrom_sort_run(3)
+ *
+ *  History:
+ *  Date        Name        Modification
+ *  2026-10-17  agent       Begin
+ ***************************************************************************/
+
+void    *bl_chrom_sort_slice(void *arg)
+
+{
+    bl_chrom_sort_slice_t   *slice = arg;
+
+    qsort(slice->lines, slice->count, sizeof(*slice->lines),
+	  (int (*)(const void *,const void *))bl_chrom_sort_line_cmp);
+    return NULL;
+}
+
+
+/***************************************************************************
+ *  Name:
+ *      bl_chrom_sort_run() - Sort and write the current run
+ *
+ *  Library:
+ *      #include <biolibc/chrom-sort.h>
+ *      -lbiolibc -lxtend -lpthread
+ *
+ *  Description:
+ *      Sort the lines collected since the last run and write them to
+ *      out_stream, leaving the buffer empty.  The lines are divided into
+ *      up to sort->threads slices that are sorted concurrently, and the
+ *      slices are merged with a heap as they are written.
+ *
+ *      If run_format is true, each line is preceded by its key so that
+ *      bl_chrom_sort_merge(3) can merge run files without parsing.
+ *      Otherwise plain text is written.
+ *
+ *  Arguments:
+ *      sort        Pointer to a bl_chrom_sort_t object
+ *      out_stream  Temporary run file or final output
+ *      run_format  Write keys as well as lines
+ *
+ *  Returns:
+ *      BL_CHROM_SORT_OK on success, BL_CHROM_SORT_MALLOC_FAILED,
+ *      BL_CHROM_SORT_THREAD_FAILED, or BL_CHROM_SORT_IO_ERROR otherwise
+ *
+ *  See also:
+ *      bl_chrom_sort_add_line(3), bl_chrom_sort_merge(3)
+ *
+ *  History:
+ *  Date        Name        Modification
+ *  2026-10-17  agent       Begin
+ ***************************************************************************/
+
+int     bl_chrom_sort_run(bl_chrom_sort_t *sort, FILE *out_stream,
+			  bool run_format)
+
+{
+    bl_chrom_sort_slice_t   *slices;
+    bl_chrom_sort_head_t    *heap;
+    bl_chrom_sort_line_t    *sl;
+    pthread_t   *tids;
+    size_t      slice_count,
+		per_slice,
+		heap_count,
+		next,
+		c;
+    int         status = BL_CHROM_SORT_OK;
+
+    if ( bl_chrom_dict_sort(&sort->dict) != BL_CHROM_DICT_OK )
+	return BL_CHROM_SORT_MALLOC_FAILED;
+    for (c = 0; c < sort->line_count; ++c)
+	bl_chrom_sort_set_ranks(sort, &sort->lines[c].key);
+
+    slice_count = sort->threads < 1 ? 1 : sort->threads;
+    if ( sort->line_count / slice_count < BL_CHROM_SORT_MIN_SLICE )
+	slice_count = sort->line_count / BL_CHROM_SORT_MIN_SLICE + 1;
+    per_slice = (sort->line_count + slice_count - 1) / slice_count;
+
+    slices = xt_malloc(slice_count, sizeof(*slices));
+    heap = xt_malloc(slice_count, sizeof(*heap));
+    tids = xt_malloc(slice_count, sizeof(*tids));
+    if ( (slices == NULL) || (heap == NULL) || (tids == NULL) )
+    {
+	free(slices);
+	free(heap);
+	free(tids);
+	return BL_CHROM_SORT_MALLOC_FAILED;
+    }
+    for (c = 0; c < slice_count; ++c)
+    {
+	slices[c].lines = sort->lines + c * per_slice;
+	slices[c].count = c * per_slice >= sort->line_count ? 0 :
+			  XT_MIN(per_slice, sort->line_count - c * per_slice);
+    }
+
+    // Sort slices 1..n-1 in new threads and slice 0 in this one
+    for (c = 1; c < slice_count; ++c)
+	if ( pthread_create(&tids[c], NULL, bl_chrom_sort_slice,
+			    &slices[c]) != 0 )
+	    break;
+    bl_chrom_sort_slice(&slices[0]);
+    for (next = 1; next < c; ++next)
+	pthread_join(tids[next], NULL);
+    free(tids);
+    if ( c < slice_count )
+    {
+	free(slices);
+	free(heap);
+	return BL_CHROM_SORT_THREAD_FAILED;
+    }
+
+    // Merge slices: heap holds the next line of each nonempty slice
+    for (c = 0, heap_count = 0; c < slice_count; ++c)
+    {
+	if ( slices[c].count > 0 )
+	{
+	    heap[heap_count].key = slices[c].lines->key;
+	    heap[heap_count++].source = c;
+	}
+    }
+    for (c = heap_count; c-- > 0; )
+	bl_chrom_sort_heap_down(heap, heap_count, c);
+    while ( (heap_count > 0) && (status == BL_CHROM_SORT_OK) )
+    {
+	c = heap[0].source;
+	sl = slices[c].lines;
+	if ( (run_format && (fwrite(&sl->key, sizeof(sl->key), 1, out_stream)
+			     != 1)) ||
+	     (fwrite(sort->buff + sl->offset, sl->key.len, 1, out_stream)
+		!= 1) )
+	    status = BL_CHROM_SORT_IO_ERROR;
+	++slices[c].lines;
+	if ( --slices[c].count > 0 )
+	    heap[0].key = slices[c].lines->key;
+	else
+	    heap[0] = heap[--heap_count];
+	bl_chrom_sort_heap_down(heap, heap_count, 0);
+    }
+    free(slices);
+    free(heap);
+
+    sort->line_count = 0;
+    sort->buff_len = 0;
+    return status;
+}
+
+
+/***************************************************************************
+ *  Name:
+ *      bl_chrom_sort_merge() - Finish a chromosome sort
+ *
+ *  Library:
+ *      #include <biolibc/chrom-sort.h>
+ *      -lbiolibc -lxtend -lpthread
+ *
+ *  Description:
+ *      Write all lines added with bl_chrom_sort_add_line(3) to out_stream
+ *      in sorted order.  If everything fit in one run, it is sorted and
+ *      written directly.  Otherwise the last run is spilled as well and
+ *      all run files are merged, using a heap holding the next line of
+ *      each run, in a single pass.  Run files are closed, which removes
+ *      them.
+ *
+ *  Arguments:
+ *      sort        Pointer to a bl_chrom_sort_t object
+ *      out_stream  Sorted output
+ *
+ *  Returns:
+ *      BL_CHROM_SORT_OK on success, BL_CHROM_SORT_MALLOC_FAILED,
+ *      BL_CHROM_SORT_THREAD_FAILED, or BL_CHROM_SORT_IO_ERROR otherwise
+ *
+ *  See also:
+ *      bl_chrom_sort_file(3), bl_chrom_sort_add_line(3)
+ *
+ *  History:
+ *  Date        Name        Modification
+ *  2026-10-17  agent       Begin
+ ***************************************************************************/
+
+int     bl_chrom_sort_merge(bl_chrom_sort_t *sort, FILE *out_stream)
+
+{
+    bl_chrom_sort_head_t    *heap;
+    char        **lines;
+    size_t      *line_sizes,
+		heap_count,
+		c;
+    int         status = BL_CHROM_SORT_OK;
+    FILE        *run;
+
+    if ( sort->run_count == 0 )
+	return bl_chrom_sort_run(sort, out_stream, false);
+
+    if ( sort->line_count > 0 )
+    {
+	if ( sort->run_count == sort->run_array_size )
+	{
+	    sort->run_array_size *= 2;
+	    if ( (sort->runs = xt_realloc(sort->runs, sort->run_array_size,
+					  sizeof(*sort->runs))) == NULL )
+		return BL_CHROM_SORT_MALLOC_FAILED;
+	}
+	if ( (run = tmpfile()) == NULL )
+	    return BL_CHROM_SORT_IO_ERROR;
+	sort->runs[sort->run_count++] = run;
+	if ( (status = bl_chrom_sort_run(sort, run, true)) != BL_CHROM_SORT_OK )
+	    return status;
+    }
+    if ( bl_chrom_dict_sort(&sort->dict) != BL_CHROM_DICT_OK )
+	return BL_CHROM_SORT_MALLOC_FAILED;
+
+    heap = xt_malloc(sort->run_count, sizeof(*heap));
+    lines = calloc(sort->run_count, sizeof(*lines));
+    line_sizes = calloc(sort->run_count, sizeof(*line_sizes));
+    if ( (heap == NULL) || (lines == NULL) || (line_sizes == NULL) )
+    {
+	free(heap);
+	free(lines);
+	free(line_sizes);
+	return BL_CHROM_SORT_MALLOC_FAILED;
+    }
+
+    // Heap holds the key of the next line of each run, which is in lines[]
+    for (c = 0, heap_count = 0; c < sort->run_count; ++c)
+    {
+	rewind(sort->runs[c]);
+	heap[heap_count].source = c;
+	if ( bl_chrom_sort_read_run(sort, sort->runs[c], &heap[heap_count].key,
+				    &lines[c], &line_sizes[c]) == BL_READ_OK )
+	    ++heap_count;
+    }
+    for (c = heap_count; c-- > 0; )
+	bl_chrom_sort_heap_down(heap, heap_count, c);
+    while ( (heap_count > 0) && (status == BL_CHROM_SORT_OK) )
+    {
+	c = heap[0].source;
+	if ( fwrite(lines[c], heap[0].key.len, 1, out_stream) != 1 )
+	    status = BL_CHROM_SORT_IO_ERROR;
+	if ( bl_chrom_sort_read_run(sort, sort->runs[c], &heap[0].key,
+				    &lines[c], &line_sizes[c]) != BL_READ_OK )
+	    heap[0] = heap[--heap_count];
+	bl_chrom_sort_heap_down(heap, heap_count, 0);
+    }
+
+    for (c = 0; c < sort->run_count; ++c)
+    {
+	if ( ferror(sort->runs[c]) )
+	    status = BL_CHROM_SORT_IO_ERROR;
+	fclose(sort->runs[c]);
+	free(lines[c]);
+    }
+    sort->run_count = 0;
+    free(heap);
+    free(lines);
+    free(line_sizes);
+    return status;
+}
+
+
+/***************************************************************************
+ *  Name:
+ *      bl_chrom_sort_read_run() - Read the next line of a run file
+ *
+ *  Library:
+ *      #include <biolibc/chrom-sort.h>
+ *      -lbiolibc -lxtend -lpthread
+ *
+ *  Description:
+ *      Read the next key and line from a run file written by
+ *      bl_chrom_sort_run(3), extending *line as needed, and set the
+ *      key's chromosome rank.  Used by bl_chrom_sort_merge(3).  Failure
+ *      to extend *line is fatal, since the merge cannot continue without
+ *      the line.
+ *
+ *  Arguments:
+ *      sort            Pointer to a bl_chrom_sort_t object
+ *      run             Run file
+ *      key             Pointer to the key to fill in
+ *      line            Address of a buffer for the line, initially NULL
+ *      line_array_size Address of the allocated size of *line
+ *
+ *  Returns:
+ *      BL_READ_OK on success, BL_READ_EOF at the end of the run,
+ *      BL_READ_TRUNCATED if the run file ends mid-line
+ *
+ *  See also:
+ *      bl_chrom_sort_merge(3)
+ *
+ *  History:
+ *  Date        Name        Modification
+ *  2026-10-17  agent       Begin
+ *  2026-10-17  agent       Exit on allocation failure
+ ***************************************************************************/
+
+int     bl_chrom_sort_read_run(bl_chrom_sort_t *sort, FILE *run,
+			       bl_chrom_sort_key_t *key, char **line,
+			       size_t *line_array_size)
+
+{
+    if ( fread(key, sizeof(*key), 1, run) != 1 )
+	return BL_READ_EOF;
+    if ( key->len > *line_array_size )
+    {
+	*line_array_size = key->len;
+	if ( (*line = xt_realloc(*line, *line_array_size,
+				 sizeof(**line))) == NULL )
+	{
+	    fprintf(stderr, "bl_chrom_sort_read_run(): Could not allocate line.\n");
+	    exit(EX_UNAVAILABLE);
+	}
+    }
+    if ( fread(*line, key->len, 1, run) != 1 )
+	return BL_READ_TRUNCATED;
+    bl_chrom_sort_set_ranks(sort, key);
+    return BL_READ_OK;
+}
+
+
+/***************************************************************************
+ *  Name:
+ *      bl_chrom_sort_heap_down() - Restore the merge heap property
+ *
+ *  Library:
+ *      #include <biolibc/chrom-sort.h>
+ *      -lbiolibc -lxtend -lpthread
+ *
+ *  Description:
+ *      Move heap[c] down the binary min-heap of count entries until
+ *      neither child has a smaller key.  Used by bl_chrom_sort_run(3) and
+ *      bl_chrom_sort_merge(3), where the heap holds the next line of
+ *      each slice or run file.
+ *
+ *  Arguments:
+ *      heap    Array of bl_chrom_sort_head_t
+ *      count   Number of entries in heap
+ *      c       Index of the entry to move
+ *
+ *  See also:
+ *      bl_chrom_sort_key_cmp(3)
+ *
+ *  History:
+ *  Date        Name        Modification
+ *  2026-10-17  agent       Begin
+ ***************************************************************************/
+
+void    bl_chrom_sort_heap_down(bl_chrom_sort_head_t *heap, size_t count,
+				size_t c)
+
+{
+    bl_chrom_sort_head_t    temp;
+    size_t  child;
+
+    while ( (child = 2 * c + 1) < count )
+    {
+	if ( (child + 1 < count) &&
+	     (bl_chrom_sort_key_cmp(&heap[child + 1].key, &heap[child].key) < 0) )
+	    ++child;
+	if ( bl_chrom_sort_key_cmp(&heap[child].key, &heap[c].key) >= 0 )
+	    break;
+	temp = heap[c];
+	heap[c] = heap[child];
+	heap[child] = temp;
+	c = child;
+    }
+}
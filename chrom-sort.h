@@ -0,0 +1,136 @@
+#ifndef _BIOLIBC_CHROM_SORT_H_
+#define _BIOLIBC_CHROM_SORT_H_
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+#ifndef _STDIO_H_
+#include <stdio.h>
+#endif
+
+#ifndef __bool_true_false_are_defined
+#include <stdbool.h>
+#endif
+
+#ifndef _BIOLIBC_H_
+#include "biolibc.h"
+#endif
+
+#ifndef _BIOLIBC_CHROM_DICT_H_
+#include "chrom-dict.h"
+#endif
+
+/*
+ *  External sort of tab-separated SAM, VCF, BED and GFF3 text by
+ *  chromosome, in bl_chrom_name_cmp() order, and position.  Lines are
+ *  collected in a buffer of at most max_run_bytes.  Each full buffer is
+ *  sorted by several threads, each taking one slice of the keys, and
+ *  the slices are merged into a temporary run file.  Runs are then
+ *  merged with a heap.  Input that fits in one buffer never touches
+ *  disk.  Ties keep input order, and records with no chromosome, such
+ *  as unmapped SAM alignments ("*"), go last.
+ *
+ *  Header lines ('#' or '@') before the first record are copied to the
+ *  output unchanged.  Comment lines after the first record, such as
+ *  GFF3 "###" group terminators, have no meaning once records are
+ *  reordered and are dropped.
+ */
+
+#define BL_CHROM_SORT_FORMAT_SAM    0
+#define BL_CHROM_SORT_FORMAT_VCF    1
+#define BL_CHROM_SORT_FORMAT_BED    2
+#define BL_CHROM_SORT_FORMAT_GFF3   3
+
+#define BL_CHROM_SORT_DEFAULT_RUN_BYTES (512 * 1024 * 1024)
+#define BL_CHROM_SORT_DEFAULT_THREADS   4
+#define BL_CHROM_SORT_START_SIZE        65536
+
+// Slices smaller than this are not worth a thread
+#define BL_CHROM_SORT_MIN_SLICE         4096
+
+#define BL_CHROM_SORT_OK                0
+#define BL_CHROM_SORT_MALLOC_FAILED     -1
+#define BL_CHROM_SORT_IO_ERROR          -2
+#define BL_CHROM_SORT_BAD_DATA          -3
+#define BL_CHROM_SORT_THREAD_FAILED     -4
+
+// Sort key of one line.  This much precedes each line in a run file.
+typedef struct
+{
+    int32_t     chrom_id,   // BL_CHROM_ID_NONE sorts last
+		rank;       // Natural sort rank, set before comparing
+    int64_t     pos;
+    uint64_t    seq;        // Input order, for stability
+    size_t      len;        // Of line, including newline
+}   bl_chrom_sort_key_t;
+
+// A line in the run buffer
+typedef struct
+{
+    bl_chrom_sort_key_t key;
+    size_t              offset;
+}   bl_chrom_sort_line_t;
+
+// Heap entry for merging sorted slices or runs
+typedef struct
+{
+    bl_chrom_sort_key_t key;
+    size_t              source;
+}   bl_chrom_sort_head_t;
+
+typedef struct
+{
+    unsigned        chrom_col,  // 1-based columns of sort keys
+		    pos_col;
+    size_t          max_run_bytes;
+    unsigned        threads;
+
+    bl_chrom_dict_t dict;
+    uint64_t        seq;
+    bool            in_header;
+
+    // Current run
+    char            *buff;
+    size_t          buff_len,
+		    buff_size;
+    bl_chrom_sort_line_t    *lines;
+    size_t          line_count,
+		    line_array_size;
+
+    FILE            **runs;
+    size_t          run_count,
+		    run_array_size;
+}   bl_chrom_sort_t;
+
+// Arguments for a slice-sorting thread
+typedef struct
+{
+    bl_chrom_sort_line_t    *lines;
+    size_t                  count;
+}   bl_chrom_sort_slice_t;
+
+#include "chrom-sort-rvs.h"
+#include "chrom-sort-accessors.h"
+#include "chrom-sort-mutators.h"
+
+/* chrom-sort.c */
+void bl_chrom_sort_init(bl_chrom_sort_t *sort, int format);
+void bl_chrom_sort_free(bl_chrom_sort_t *sort);
+int bl_chrom_sort_file(bl_chrom_sort_t *sort, FILE *in_stream, FILE *out_stream);
+int bl_chrom_sort_add_line(bl_chrom_sort_t *sort, const char *line, size_t len);
+int bl_chrom_sort_parse_key(bl_chrom_sort_t *sort, const char *line, size_t len, bl_chrom_sort_key_t *key);
+int bl_chrom_sort_key_cmp(const bl_chrom_sort_key_t *key1, const bl_chrom_sort_key_t *key2);
+int bl_chrom_sort_line_cmp(const bl_chrom_sort_line_t *line1, const bl_chrom_sort_line_t *line2);
+void bl_chrom_sort_set_ranks(bl_chrom_sort_t *sort, bl_chrom_sort_key_t *key);
+void *bl_chrom_sort_slice(void *arg);
+int bl_chrom_sort_run(bl_chrom_sort_t *sort, FILE *out_stream, bool run_format);
+int bl_chrom_sort_merge(bl_chrom_sort_t *sort, FILE *out_stream);
+int bl_chrom_sort_read_run(bl_chrom_sort_t *sort, FILE *run, bl_chrom_sort_key_t *key, char **line, size_t *line_array_size);
+void bl_chrom_sort_heap_down(bl_chrom_sort_head_t *heap, size_t count, size_t c);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif // _BIOLIBC_CHROM_SORT_H_
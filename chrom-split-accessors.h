@@ -0,0 +1,20 @@
+    
+/*
+ *  Generated by /usr/local/bin/auto-gen-get-set
+ *
+ *  Accessor macros.  Use these to access structure members from functions
+ *  outside the bl_chrom_split_t class.
+ *
+ *  These generated macros are not expected to be perfect.  Check and edit
+ *  as needed before adding to your code.
+ */
+
+#define BL_CHROM_SPLIT_INPUT_COUNT(ptr) ((ptr)->input_count)
+#define BL_CHROM_SPLIT_CHROM_ARRAY_SIZE(ptr) ((ptr)->chrom_array_size)
+#define BL_CHROM_SPLIT_STARTS(ptr)      ((ptr)->starts)
+#define BL_CHROM_SPLIT_STARTS_AE(ptr,c) ((ptr)->starts[c])
+#define BL_CHROM_SPLIT_ENDS(ptr)        ((ptr)->ends)
+#define BL_CHROM_SPLIT_ENDS_AE(ptr,c)   ((ptr)->ends[c])
+#define BL_CHROM_SPLIT_NEXT_CHROM(ptr)  ((ptr)->next_chrom)
+#define BL_CHROM_SPLIT_MERGED_COUNT(ptr) ((ptr)->merged_count)
+#define BL_CHROM_SPLIT_MAX_PENDING(ptr) ((ptr)->max_pending)
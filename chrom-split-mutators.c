@@ -0,0 +1,625 @@
+/***************************************************************************
+ *  This file is automatically generated by gen-get-set.  Be sure to keep
+ *  track of any manual changes.
+ *
+ *  These generated functions are not expected to be perfect.  Check and
+ *  edit as needed before adding to your code.
+ ***************************************************************************/
+
+#include <string.h>
+#include <ctype.h>
+#include <stdbool.h>        // In case of bool
+#include <stdint.h>         // In case of int64_t, etc
+#include <xtend/string.h>   // strlcpy() on Linux
+#include "chrom-split.h"
+
+
+/***************************************************************************
+ *  Library:
+ *      #include <biolibc/chrom-split.h>
+ *      -lbiolibc -lxtend
+ *
+ *  Description:
+ *      Mutator for input_count member in a bl_chrom_split_t structure.
+ *      Use this function to set input_count in a bl_chrom_split_t object
+ *      from non-member functions.  This function performs a direct
+ *      assignment for scalar or pointer structure members.  If
+ *      input_count is a pointer, data previously pointed to should
+ *      be freed before calling this function to avoid memory
+ *      leaks.
+ *
+ *  Arguments:
+ *      bl_chrom_split_ptr Pointer to the structure to set
+ *      new_input_count The new value for input_count
+ *
+ *  Returns:
+ *      BL_CHROM_SPLIT_DATA_OK if the new value is acceptable and assigned
+ *      BL_CHROM_SPLIT_DATA_OUT_OF_RANGE otherwise
+ *
+ *  Examples:
+ *      bl_chrom_split_t bl_chrom_split;
+ *      unsigned        new_input_count;
+ *
+ *      if ( bl_chrom_split_set_input_count(&bl_chrom_split, new_input_count)
+ *              == BL_CHROM_SPLIT_DATA_OK )
+ *      {
+ *      }
+ *
+ *  See also:
+ *      (3)
+ *
+ *  History: 
+ *  Date        Name        Modification
+ *  2026-10-17  gen-get-set Auto-generated from chrom-split.h
+ ***************************************************************************/
+
+int     bl_chrom_split_set_input_count(
+	    bl_chrom_split_t *bl_chrom_split_ptr,
+	    unsigned new_input_count
+	)
+
+{
+    if ( false )
+	return BL_CHROM_SPLIT_DATA_OUT_OF_RANGE;
+    else
+    {
+	bl_chrom_split_ptr->input_count = new_input_count;
+	return BL_CHROM_SPLIT_DATA_OK;
+    }
+}
+
+
+/***************************************************************************
+ *  Library:
+ *      #include <biolibc/chrom-split.h>
+ *      -lbiolibc -lxtend
+ *
+ *  Description:
+ *      Mutator for chrom_array_size member in a bl_chrom_split_t structure.
+ *      Use this function to set chrom_array_size in a bl_chrom_split_t object
+ *      from non-member functions.  This function performs a direct
+ *      assignment for scalar or pointer structure members.  If
+ *      chrom_array_size is a pointer, data previously pointed to should
+ *      be freed before calling this function to avoid memory
+ *      leaks.
+ *
+ *  Arguments:
+ *      bl_chrom_split_ptr Pointer to the structure to set
+ *      new_chrom_array_size The new value for chrom_array_size
+ *
+ *  Returns:
+ *      BL_CHROM_SPLIT_DATA_OK if the new value is acceptable and assigned
+ *      BL_CHROM_SPLIT_DATA_OUT_OF_RANGE otherwise
+ *
+ *  Examples:
+ *      bl_chrom_split_t bl_chrom_split;
+ *      size_t          new_chrom_array_size;
+ *
+ *      if ( bl_chrom_split_set_chrom_array_size(&bl_chrom_split, new_chrom_array_size)
+ *              == BL_CHROM_SPLIT_DATA_OK )
+ *      {
+ *      }
+ *
+ *  See also:
+ *      (3)
+ *
+ *  History: 
+ *  Date        Name        Modification
+ *  2026-10-17  gen-get-set Auto-generated from chrom-split.h
+ ***************************************************************************/
+
+int     bl_chrom_split_set_chrom_array_size(
+	    bl_chrom_split_t *bl_chrom_split_ptr,
+	    size_t new_chrom_array_size
+	)
+
+{
+    if ( false )
+	return BL_CHROM_SPLIT_DATA_OUT_OF_RANGE;
+    else
+    {
+	bl_chrom_split_ptr->chrom_array_size = new_chrom_array_size;
+	return BL_CHROM_SPLIT_DATA_OK;
+    }
+}
+
+
+/***************************************************************************
+ *  Library:
+ *      #include <biolibc/chrom-split.h>
+ *      -lbiolibc -lxtend
+ *
+ *  Description:
+ *      Mutator for starts member in a bl_chrom_split_t structure.
+ *      Use this function to set starts in a bl_chrom_split_t object
+ *      from non-member functions.  This function performs a direct
+ *      assignment for scalar or pointer structure members.  If
+ *      starts is a pointer, data previously pointed to should
+ *      be freed before calling this function to avoid memory
+ *      leaks.
+ *
+ *  Arguments:
+ *      bl_chrom_split_ptr Pointer to the structure to set
+ *      new_starts      The new value for starts
+ *
+ *  Returns:
+ *      BL_CHROM_SPLIT_DATA_OK if the new value is acceptable and assigned
+ *      BL_CHROM_SPLIT_DATA_OUT_OF_RANGE otherwise
+ *
+ *  Examples:
+ *      bl_chrom_split_t bl_chrom_split;
+ *      off_t *         new_starts;
+ *
+ *      if ( bl_chrom_split_set_starts(&bl_chrom_split, new_starts)
+ *              == BL_CHROM_SPLIT_DATA_OK )
+ *      {
+ *      }
+ *
+ *  See also:
+ *      (3)
+ *
+ *  History: 
+ *  Date        Name        Modification
+ *  2026-10-17  gen-get-set Auto-generated from chrom-split.h
+ ***************************************************************************/
+
+int     bl_chrom_split_set_starts(
+	    bl_chrom_split_t *bl_chrom_split_ptr,
+	    off_t *new_starts
+	)
+
+{
+    if ( new_starts == NULL )
+	return BL_CHROM_SPLIT_DATA_OUT_OF_RANGE;
+    else
+    {
+	bl_chrom_split_ptr->starts = new_starts;
+	return BL_CHROM_SPLIT_DATA_OK;
+    }
+}
+
+
+/***************************************************************************
+ *  Library:
+ *      #include <biolibc/chrom-split.h>
+ *      -lbiolibc -lxtend
+ *
+ *  Description:
+ *      Mutator for an array element of starts member in a bl_chrom_split_t
+ *      structure. Use this function to set bl_chrom_split_ptr->starts[c]
+ *      in a bl_chrom_split_t object from non-member functions.
+ *
+ *  Arguments:
+ *      bl_chrom_split_ptr Pointer to the structure to set
+ *      c               Subscript to the starts array
+ *      new_starts_element The new value for starts[c]
+ *
+ *  Returns:
+ *      BL_CHROM_SPLIT_DATA_OK if the new value is acceptable and assigned
+ *      BL_CHROM_SPLIT_DATA_OUT_OF_RANGE otherwise
+ *
+ *  Examples:
+ *      bl_chrom_split_t bl_chrom_split;
+ *      size_t          c;
+ *      off_t           new_starts_element;
+ *
+ *      if ( bl_chrom_split_set_starts_ae(&bl_chrom_split, c, new_starts_element)
+ *              == BL_CHROM_SPLIT_DATA_OK )
+ *      {
+ *      }
+ *
+ *  See also:
+ *      BL_CHROM_SPLIT_SET_STARTS_AE(3)
+ *
+ *  History: 
+ *  Date        Name        Modification
+ *  2026-10-17  gen-get-set Auto-generated from chrom-split.h
+ ***************************************************************************/
+
+int     bl_chrom_split_set_starts_ae(
+	    bl_chrom_split_t *bl_chrom_split_ptr,
+	    size_t c,
+	    off_t new_starts_element
+	)
+
+{
+    if ( false )
+	return BL_CHROM_SPLIT_DATA_OUT_OF_RANGE;
+    else
+    {
+	bl_chrom_split_ptr->starts[c] = new_starts_element;
+	return BL_CHROM_SPLIT_DATA_OK;
+    }
+}
+
+
+/***************************************************************************
+ *  Library:
+ *      #include <biolibc/chrom-split.h>
+ *      -lbiolibc -lxtend
+ *
+ *  Description:
+ *      Mutator for starts member in a bl_chrom_split_t structure.
+ *      Use this function to set starts in a bl_chrom_split_t object
+ *      from non-member functions.  This function copies the array pointed to
+ *      by new_starts to bl_chrom_split_ptr->starts.
+ *
+ *  Arguments:
+ *      bl_chrom_split_ptr Pointer to the structure to set
+ *      new_starts      The new value for starts
+ *      array_size      Size of the starts array.
+ *
+ *  Returns:
+ *      BL_CHROM_SPLIT_DATA_OK if the new value is acceptable and assigned
+ *      BL_CHROM_SPLIT_DATA_OUT_OF_RANGE otherwise
+ *
+ *  Examples:
+ *      bl_chrom_split_t bl_chrom_split;
+ *      off_t *         new_starts;
+ *      size_t          array_size;
+ *
+ *      if ( bl_chrom_split_set_starts_cpy(&bl_chrom_split, new_starts, array_size)
+ *              == BL_CHROM_SPLIT_DATA_OK )
+ *      {
+ *      }
+ *
+ *  See also:
+ *      BL_CHROM_SPLIT_SET_STARTS(3)
+ *
+ *  History: 
+ *  Date        Name        Modification
+ *  2026-10-17  gen-get-set Auto-generated from chrom-split.h
+ ***************************************************************************/
+
+int     bl_chrom_split_set_starts_cpy(
+	    bl_chrom_split_t *bl_chrom_split_ptr,
+	    off_t *new_starts,
+	    size_t array_size
+	)
+
+{
+    if ( new_starts == NULL )
+	return BL_CHROM_SPLIT_DATA_OUT_OF_RANGE;
+    else
+    {
+	size_t  c;
+	
+	// FIXME: Assuming all elements should be copied
+	for (c = 0; c < array_size; ++c)
+	    bl_chrom_split_ptr->starts[c] = new_starts[c];
+	return BL_CHROM_SPLIT_DATA_OK;
+    }
+}
+
+
+/***************************************************************************
+ *  Library:
+ *      #include <biolibc/chrom-split.h>
+ *      -lbiolibc -lxtend
+ *
+ *  Description:
+ *      Mutator for ends member in a bl_chrom_split_t structure.
+ *      Use this function to set ends in a bl_chrom_split_t object
+ *      from non-member functions.  This function performs a direct
+ *      assignment for scalar or pointer structure members.  If
+ *      ends is a pointer, data previously pointed to should
+ *      be freed before calling this function to avoid memory
+ *      leaks.
+ *
+ *  Arguments:
+ *      bl_chrom_split_ptr Pointer to the structure to set
+ *      new_ends        The new value for ends
+ *
+ *  Returns:
+ *      BL_CHROM_SPLIT_DATA_OK if the new value is acceptable and assigned
+ *      BL_CHROM_SPLIT_DATA_OUT_OF_RANGE otherwise
+ *
+ *  Examples:
+ *      bl_chrom_split_t bl_chrom_split;
+ *      off_t *         new_ends;
+ *
+ *      if ( bl_chrom_split_set_ends(&bl_chrom_split, new_ends)
+ *              == BL_CHROM_SPLIT_DATA_OK )
+ *      {
+ *      }
+ *
+ *  See also:
+ *      (3)
+ *
+ *  History: 
+ *  Date        Name        Modification
+ *  2026-10-17  gen-get-set Auto-generated from chrom-split.h
+ ***************************************************************************/
+
+int     bl_chrom_split_set_ends(
+	    bl_chrom_split_t *bl_chrom_split_ptr,
+	    off_t *new_ends
+	)
+
+{
+    if ( new_ends == NULL )
+	return BL_CHROM_SPLIT_DATA_OUT_OF_RANGE;
+    else
+    {
+	bl_chrom_split_ptr->ends = new_ends;
+	return BL_CHROM_SPLIT_DATA_OK;
+    }
+}
+
+
+/***************************************************************************
+ *  Library:
+ *      #include <biolibc/chrom-split.h>
+ *      -lbiolibc -lxtend
+ *
+ *  Description:
+ *      Mutator for an array element of ends member in a bl_chrom_split_t
+ *      structure. Use this function to set bl_chrom_split_ptr->ends[c]
+ *      in a bl_chrom_split_t object from non-member functions.
+ *
+ *  Arguments:
+ *      bl_chrom_split_ptr Pointer to the structure to set
+ *      c               Subscript to the ends array
+ *      new_ends_element The new value for ends[c]
+ *
+ *  Returns:
+ *      BL_CHROM_SPLIT_DATA_OK if the new value is acceptable and assigned
+ *      BL_CHROM_SPLIT_DATA_OUT_OF_RANGE otherwise
+ *
+ *  Examples:
+ *      bl_chrom_split_t bl_chrom_split;
+ *      size_t          c;
+ *      off_t           new_ends_element;
+ *
+ *      if ( bl_chrom_split_set_ends_ae(&bl_chrom_split, c, new_ends_element)
+ *              == BL_CHROM_SPLIT_DATA_OK )
+ *      {
+ *      }
+ *
+ *  See also:
+ *      BL_CHROM_SPLIT_SET_ENDS_AE(3)
+ *
+ *  History: 
+ *  Date        Name        Modification
+ *  2026-10-17  gen-get-set Auto-generated from chrom-split.h
+ ***************************************************************************/
+
+int     bl_chrom_split_set_ends_ae(
+	    bl_chrom_split_t *bl_chrom_split_ptr,
+	    size_t c,
+	    off_t new_ends_element
+	)
+
+{
+    if ( false )
+	return BL_CHROM_SPLIT_DATA_OUT_OF_RANGE;
+    else
+    {
+	bl_chrom_split_ptr->ends[c] = new_ends_element;
+	return BL_CHROM_SPLIT_DATA_OK;
+    }
+}
+
+
+/***************************************************************************
+ *  Library:
+ *      #include <biolibc/chrom-split.h>
+ *      -lbiolibc -lxtend
+ *
+ *  Description:
+ *      Mutator for ends member in a bl_chrom_split_t structure.
+ *      Use this function to set ends in a bl_chrom_split_t object
+ *      from non-member functions.  This function copies the array pointed to
+ *      by new_ends to bl_chrom_split_ptr->ends.
+ *
+ *  Arguments:
+ *      bl_chrom_split_ptr Pointer to the structure to set
+ *      new_ends        The new value for ends
+ *      array_size      Size of the ends array.
+ *
+ *  Returns:
+ *      BL_CHROM_SPLIT_DATA_OK if the new value is acceptable and assigned
+ *      BL_CHROM_SPLIT_DATA_OUT_OF_RANGE otherwise
+ *
+ *  Examples:
+ *      bl_chrom_split_t bl_chrom_split;
+ *      off_t *         new_ends;
+ *      size_t          array_size;
+ *
+ *      if ( bl_chrom_split_set_ends_cpy(&bl_chrom_split, new_ends, array_size)
+ *              == BL_CHROM_SPLIT_DATA_OK )
+ *      {
+ *      }
+ *
+ *  See also:
+ *      BL_CHROM_SPLIT_SET_ENDS(3)
+ *
+ *  History: 
+ *  Date        Name        Modification
+ *  2026-10-17  gen-get-set Auto-generated from chrom-split.h
+ ***************************************************************************/
+
+int     bl_chrom_split_set_ends_cpy(
+	    bl_chrom_split_t *bl_chrom_split_ptr,
+	    off_t *new_ends,
+	    size_t array_size
+	)
+
+{
+    if ( new_ends == NULL )
+	return BL_CHROM_SPLIT_DATA_OUT_OF_RANGE;
+    else
+    {
+	size_t  c;
+	
+	// FIXME: Assuming all elements should be copied
+	for (c = 0; c < array_size; ++c)
+	    bl_chrom_split_ptr->ends[c] = new_ends[c];
+	return BL_CHROM_SPLIT_DATA_OK;
+    }
+}
+
+
+/***************************************************************************
+ *  Library:
+ *      #include <biolibc/chrom-split.h>
+ *      -lbiolibc -lxtend
+ *
+ *  Description:
+ *      Mutator for next_chrom member in a bl_chrom_split_t structure.
+ *      Use this function to set next_chrom in a bl_chrom_split_t object
+ *      from non-member functions.  This function performs a direct
+ *      assignment for scalar or pointer structure members.  If
+ *      next_chrom is a pointer, data previously pointed to should
+ *      be freed before calling this function to avoid memory
+ *      leaks.
+ *
+ *  Arguments:
+ *      bl_chrom_split_ptr Pointer to the structure to set
+ *      new_next_chrom  The new value for next_chrom
+ *
+ *  Returns:
+ *      BL_CHROM_SPLIT_DATA_OK if the new value is acceptable and assigned
+ *      BL_CHROM_SPLIT_DATA_OUT_OF_RANGE otherwise
+ *
+ *  Examples:
+ *      bl_chrom_split_t bl_chrom_split;
+ *      size_t          new_next_chrom;
+ *
+ *      if ( bl_chrom_split_set_next_chrom(&bl_chrom_split, new_next_chrom)
+ *              == BL_CHROM_SPLIT_DATA_OK )
+ *      {
+ *      }
+ *
+ *  See also:
+ *      (3)
+ *
+ *  History: 
+ *  Date        Name        Modification
+ *  2026-10-17  gen-get-set Auto-generated from chrom-split.h
+ ***************************************************************************/
+
+int     bl_chrom_split_set_next_chrom(
+	    bl_chrom_split_t *bl_chrom_split_ptr,
+	    size_t new_next_chrom
+	)
+
+{
+    if ( false )
+	return BL_CHROM_SPLIT_DATA_OUT_OF_RANGE;
+    else
+    {
+	bl_chrom_split_ptr->next_chrom = new_next_chrom;
+	return BL_CHROM_SPLIT_DATA_OK;
+    }
+}
+
+
+/***************************************************************************
+ *  Library:
+ *      #include <biolibc/chrom-split.h>
+ *      -lbiolibc -lxtend
+ *
+ *  Description:
+ *      Mutator for merged_count member in a bl_chrom_split_t structure.
+ *      Use this function to set merged_count in a bl_chrom_split_t object
+ *      from non-member functions.  This function performs a direct
+ *      assignment for scalar or pointer structure members.  If
+ *      merged_count is a pointer, data previously pointed to should
+ *      be freed before calling this function to avoid memory
+ *      leaks.
+ *
+ *  Arguments:
+ *      bl_chrom_split_ptr Pointer to the structure to set
+ *      new_merged_count The new value for merged_count
+ *
+ *  Returns:
+ *      BL_CHROM_SPLIT_DATA_OK if the new value is acceptable and assigned
+ *      BL_CHROM_SPLIT_DATA_OUT_OF_RANGE otherwise
+ *
+ *  Examples:
+ *      bl_chrom_split_t bl_chrom_split;
+ *      size_t          new_merged_count;
+ *
+ *      if ( bl_chrom_split_set_merged_count(&bl_chrom_split, new_merged_count)
+ *              == BL_CHROM_SPLIT_DATA_OK )
+ *      {
+ *      }
+ *
+ *  See also:
+ *      (3)
+ *
+ *  History: 
+ *  Date        Name        Modification
+ *  2026-10-17  gen-get-set Auto-generated from chrom-split.h
+ ***************************************************************************/
+
+int     bl_chrom_split_set_merged_count(
+	    bl_chrom_split_t *bl_chrom_split_ptr,
+	    size_t new_merged_count
+	)
+
+{
+    if ( false )
+	return BL_CHROM_SPLIT_DATA_OUT_OF_RANGE;
+    else
+    {
+	bl_chrom_split_ptr->merged_count = new_merged_count;
+	return BL_CHROM_SPLIT_DATA_OK;
+    }
+}
+
+
+/***************************************************************************
+ *  Library:
+ *      #include <biolibc/chrom-split.h>
+ *      -lbiolibc -lxtend
+ *
+ *  Description:
+ *      Mutator for max_pending member in a bl_chrom_split_t structure.
+ *      Use this function to set max_pending in a bl_chrom_split_t object
+ *      from non-member functions.  This function performs a direct
+ *      assignment for scalar or pointer structure members.  If
+ *      max_pending is a pointer, data previously pointed to should
+ *      be freed before calling this function to avoid memory
+ *      leaks.
+ *
+ *  Arguments:
+ *      bl_chrom_split_ptr Pointer to the structure to set
+ *      new_max_pending The new value for max_pending
+ *
+ *  Returns:
+ *      BL_CHROM_SPLIT_DATA_OK if the new value is acceptable and assigned
+ *      BL_CHROM_SPLIT_DATA_OUT_OF_RANGE otherwise
+ *
+ *  Examples:
+ *      bl_chrom_split_t bl_chrom_split;
+ *      size_t          new_max_pending;
+ *
+ *      if ( bl_chrom_split_set_max_pending(&bl_chrom_split, new_max_pending)
+ *              == BL_CHROM_SPLIT_DATA_OK )
+ *      {
+ *      }
+ *
+ *  See also:
+ *      (3)
+ *
+ *  History: 
+ *  Date        Name        Modification
+ *  2026-10-17  gen-get-set Auto-generated from chrom-split.h
+ ***************************************************************************/
+
+int     bl_chrom_split_set_max_pending(
+	    bl_chrom_split_t *bl_chrom_split_ptr,
+	    size_t new_max_pending
+	)
+
+{
+    if ( false )
+	return BL_CHROM_SPLIT_DATA_OUT_OF_RANGE;
+    else
+    {
+	bl_chrom_split_ptr->max_pending = new_max_pending;
+	return BL_CHROM_SPLIT_DATA_OK;
+    }
+}
@@ -0,0 +1,27 @@
+
+/*
+ *  Generated by /usr/local/bin/auto-gen-get-set
+ *
+ *  Mutator functions for setting with no sanity checking.  Use these to
+ *  set structure members from functions outside the bl_chrom_split_t
+ *  class.  These macros perform no data validation.  Hence, they achieve
+ *  maximum performance where data are guaranteed correct by other means.
+ *  Use the mutator functions (same name as the macro, but lower case)
+ *  for more robust code with a small performance penalty.
+ *
+ *  These generated macros are not expected to be perfect.  Check and edit
+ *  as needed before adding to your code.
+ */
+
+/* temp-chrom-split-mutators.c */
+int bl_chrom_split_set_input_count(bl_chrom_split_t *bl_chrom_split_ptr, unsigned new_input_count);
+int bl_chrom_split_set_chrom_array_size(bl_chrom_split_t *bl_chrom_split_ptr, size_t new_chrom_array_size);
+int bl_chrom_split_set_starts(bl_chrom_split_t *bl_chrom_split_ptr, off_t *new_starts);
+int bl_chrom_split_set_starts_ae(bl_chrom_split_t *bl_chrom_split_ptr, size_t c, off_t new_starts_element);
+int bl_chrom_split_set_starts_cpy(bl_chrom_split_t *bl_chrom_split_ptr, off_t *new_starts, size_t array_size);
+int bl_chrom_split_set_ends(bl_chrom_split_t *bl_chrom_split_ptr, off_t *new_ends);
+int bl_chrom_split_set_ends_ae(bl_chrom_split_t *bl_chrom_split_ptr, size_t c, off_t new_ends_element);
+int bl_chrom_split_set_ends_cpy(bl_chrom_split_t *bl_chrom_split_ptr, off_t *new_ends, size_t array_size);
+int bl_chrom_split_set_next_chrom(bl_chrom_split_t *bl_chrom_split_ptr, size_t new_next_chrom);
+int bl_chrom_split_set_merged_count(bl_chrom_split_t *bl_chrom_split_ptr, size_t new_merged_count);
+int bl_chrom_split_set_max_pending(bl_chrom_split_t *bl_chrom_split_ptr, size_t new_max_pending);
@@ -0,0 +1,725 @@
+#ifdef __linux__
+#define _GNU_SOURCE             // fopencookie()
+#endif
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <stdbool.h>
+#include <unistd.h>             // pread(), sysconf()
+#include <sysexits.h>
+#include <sys/stat.h>
+#include <xtend/mem.h>
+#include "chrom-split.h"
+
+/***************************************************************************
+ *  Name:
+ *      bl_chrom_split_init() - Initialize a per-chromosome job splitter
+ *
+ *  Library:
+ *      #include <biolibc/chrom-split.h>
+ *      -lbiolibc -lxtend -lpthread
+ *
+ *  Description:
+ *      Initialize an empty bl_chrom_split_t object.  Add up to
+ *      BL_CHROM_SPLIT_MAX_INPUTS sorted inputs with
+ *      bl_chrom_split_add_input(3), then process all chromosomes in
+ *      parallel with bl_chrom_split_run(3).
+ *
+ *  Arguments:
+ *      split   Pointer to the bl_chrom_split_t object to initialize
+ *
+ *  See also:
+ *      bl_chrom_split_add_input(3), bl_chrom_split_run(3),
+ *      bl_chrom_split_free(3)
+ *
+ *  History: 
+ *  Date        Name        Modification
+ *  2026-10-17  agent       Begin
+ ***************************************************************************/
+
+void    bl_chrom_split_init(bl_chrom_split_t *split)
+
+{
+    unsigned    input;
+
+    bl_chrom_dict_init(&split->dict);
+    split->input_count = 0;
+    for (input = 0; input < BL_CHROM_SPLIT_MAX_INPUTS; ++input)
+    {
+	split->input_fds[input] = -1;
+	split->input_copies[input] = NULL;
+    }
+    split->chrom_array_size = 0;
+    split->starts = NULL;
+    split->ends = NULL;
+    split->func = NULL;
+    split->arg = NULL;
+    split->outputs = NULL;
+    split->statuses = NULL;
+    split->done = NULL;
+    split->next_chrom = 0;
+    split->merged_count = 0;
+    split->max_pending = 0;
+}
+
+
+/***************************************************************************
+ *  Name:
+ *      bl_chrom_split_free() - Free memory held by a job splitter
+ *
+ *  Library:
+ *      #include <biolibc/chrom-split.h>
+ *      -lbiolibc -lxtend -lpthread
+ *
+ *  Description:
+ *      Free the chromosome index of a bl_chrom_split_t object and close
+ *      any temporary copies of its inputs.  The input streams
+ *      themselves are not closed.
+ *
+ *  Arguments:
+ *      split   Pointer to the bl_chrom_split_t object to free
+ *
+ *  See also:
+ *      bl_chrom_split_init(3)
+ *
+ *  History: 
+ *  Date        Name        Modification
+ *  2026-10-17  agent       Begin
+ ***************************************************************************/
+
+void    bl_chrom_split_free(bl_chrom_split_t *split)
+
+{
+    unsigned    input;
+
+    for (input = 0; input < split->input_count; ++input)
+	if ( split->input_copies[input] != NULL )
+	    fclose(split->input_copies[input]);
+    free(split->starts);
+    free(split->ends);
+    bl_chrom_dict_free(&split->dict);
+    bl_chrom_split_init(split);
+}
+
+
+/***************************************************************************
+ *  Name:
+ *      bl_chrom_split_reserve() - Extend the chromosome index
+ *
+ *  Library:
+ *      #include <biolibc/chrom-split.h>
+ *      -lbiolibc -lxtend -lpthread
+ *
+ *  Description:
+ *      Make room in the byte range arrays of split for at least chroms
+ *      chromosomes.  New entries are set to -1 for every input,
+ *      meaning the chromosome is absent.  This is used internally by
+ *      bl_chrom_split_add_input(3) and is rarely useful otherwise.
+ *
+ *  Arguments:
+ *      split   Pointer to a bl_chrom_split_t object
+ *      chroms  Number of chromosomes to make room for
+ *
+ *  Returns:
+ *      BL_CHROM_SPLIT_OK on success
+ *      BL_CHROM_SPLIT_MALLOC_FAILED if memory could not be allocated
+ *
+ *  See also:
+ *      bl_chrom_split_add_input(3)
+ *
+ *  History: 
+ *  Date        Name        Modification
+ *  2026-10-17  agent       Begin
+ ***************************************************************************/
+
+int     bl_chrom_split_reserve(bl_chrom_split_t *split, size_t chroms)
+
+{
+    size_t  new_size, c;
+    off_t   *starts, *ends;
+
+    if ( chroms <= split->chrom_array_size )
+	return BL_CHROM_SPLIT_OK;
+
+    new_size = split->chrom_array_size == 0 ? 32 : split->chrom_array_size;
+    while ( new_size < chroms )
+	new_size *= 2;
+    starts = xt_realloc(split->starts, new_size * BL_CHROM_SPLIT_MAX_INPUTS,
+			sizeof(*split->starts));
+    if ( starts == NULL )
+	return BL_CHROM_SPLIT_MALLOC_FAILED;
+    split->starts = starts;
+    ends = xt_realloc(split->ends, new_size * BL_CHROM_SPLIT_MAX_INPUTS,
+		      sizeof(*split->ends));
+    if ( ends == NULL )
+	return BL_CHROM_SPLIT_MALLOC_FAILED;
+    split->ends = ends;
+
+    for (c = split->chrom_array_size * BL_CHROM_SPLIT_MAX_INPUTS;
+	 c < new_size * BL_CHROM_SPLIT_MAX_INPUTS; ++c)
+	split->starts[c] = split->ends[c] = -1;
+    split->chrom_array_size = new_size;
+    return BL_CHROM_SPLIT_OK;
+}
+
+
+/***************************************************************************
+ *  Name:
+ *      bl_chrom_split_add_input() - Index a sorted input by chromosome
+ *
+ *  Library:
+ *      #include <biolibc/chrom-split.h>
+ *      -lbiolibc -lxtend -lpthread
+ *
+ *  Description:
+ *      Read the rest of a tab-separated stream sorted (or at least
+ *      grouped) by chromosome, recording the byte range of each
+ *      chromosome.  Only the chromosome column is examined, so this is
+ *      much faster than parsing the records.  Skip any header first,
+ *      e.g. with bl_sam_skip_header(3) or bl_vcf_skip_header(3).
+ *      Lines whose chromosome is missing, "*" or "." (such as unmapped
+ *      SAM alignments) are not passed to any worker.
+ *
+ *      If stream is a regular file, workers will read it in place with
+ *      pread(2).  Otherwise, e.g. for a pipe or a bl_bgzf_fopen(3)
+ *      stream, the data are copied to a temporary file while indexing.
+ *      Either way, stream is left at EOF and is not closed.
+ *
+ *      Chromosomes are numbered in order of first appearance, with those
+ *      of the first input first.  This is the order in which output is
+ *      merged by bl_chrom_split_run(3).
+ *
+ *  Arguments:
+ *      split       Pointer to a bl_chrom_split_t object
+ *      stream      Input stream positioned at the first data line
+ *      chrom_col   1-based column holding the chromosome, e.g. 3 for SAM
+ *                  RNAME and 1 for VCF, BED and GFF3
+ *
+ *  Returns:
+ *      BL_CHROM_SPLIT_OK on success
+ *      BL_CHROM_SPLIT_UNSORTED if a chromosome's lines are not contiguous
+ *      BL_CHROM_SPLIT_TOO_MANY_INPUTS if BL_CHROM_SPLIT_MAX_INPUTS
+ *      inputs were already added
+ *      BL_CHROM_SPLIT_IO_ERROR if reading or copying fails
+ *      BL_CHROM_SPLIT_MALLOC_FAILED if memory could not be allocated
+ *
+ *  Examples:
+ *      bl_chrom_split_t    split;
+ *
+ *      bl_chrom_split_init(&split);
+ *      fclose(bl_vcf_skip_header(vcf_stream));
+ *      fclose(bl_sam_skip_header(sam_stream));
+ *      if ( (bl_chrom_split_add_input(&split, vcf_stream, 1)
+ *              != BL_CHROM_SPLIT_OK) ||
+ *           (bl_chrom_split_add_input(&split, sam_stream, 3)
+ *              != BL_CHROM_SPLIT_OK) )
+ *          return EX_DATAERR;
+ *
+ *  See also:
+ *      bl_chrom_split_run(3), bl_chrom_split_init(3)
+ *
+ *  History: 
+ *  Date        Name        Modification
+ *  2026-10-17  agent       Begin
+ ***************************************************************************/
+
+int     bl_chrom_split_add_input(bl_chrom_split_t *split, FILE *stream,
+				 unsigned chrom_col)
+
+{
+    struct stat st;
+    FILE        *copy = NULL;
+    char        *line = NULL,
+		*chrom;
+    size_t      line_array_size = 0,
+		chrom_len;
+    ssize_t     line_len;
+    off_t       offset;
+    int32_t     id,
+		previous_id = BL_CHROM_ID_NONE;
+    unsigned    input,
+		col;
+    int         fd,
+		status = BL_CHROM_SPLIT_OK;
+    char        save;
+
+    if ( split->input_count == BL_CHROM_SPLIT_MAX_INPUTS )
+	return BL_CHROM_SPLIT_TOO_MANY_INPUTS;
+    input = split->input_count;
+
+    fd = fileno(stream);
+    if ( (fd < 0) || (fstat(fd, &st) != 0) || ! S_ISREG(st.st_mode) ||
+	 ((offset = ftello(stream)) == -1) )
+    {
+	// Pipes and decompressing streams cannot be read with pread()
+	if ( (copy = tmpfile()) == NULL )
+	    return BL_CHROM_SPLIT_IO_ERROR;
+	fd = fileno(copy);
+	offset = 0;
+    }
+
+    while ( (line_len = getline(&line, &line_array_size, stream)) > 0 )
+    {
+	if ( (copy != NULL) &&
+	     (fwrite(line, 1, line_len, copy) != (size_t)line_len) )
+	{
+	    status = BL_CHROM_SPLIT_IO_ERROR;
+	    break;
+	}
+
+	for (chrom = line, col = 1; (chrom != NULL) && (col < chrom_col); ++col)
+	    if ( (chrom = strchr(chrom, '\t')) != NULL )
+		++chrom;
+	if ( chrom == NULL )
+	    id = BL_CHROM_ID_NONE;
+	else
+	{
+	    chrom_len = strcspn(chrom, "\t\n");
+	    save = chrom[chrom_len];
+	    chrom[chrom_len] = '\0';
+	    id = bl_chrom_dict_intern(&split->dict, previous_id, chrom);
+	    chrom[chrom_len] = save;
+	}
+
+	if ( id != previous_id )
+	{
+	    if ( previous_id != BL_CHROM_ID_NONE )
+		BL_CHROM_SPLIT_END(split, previous_id, input) = offset;
+	    if ( id != BL_CHROM_ID_NONE )
+	    {
+		if ( (status = bl_chrom_split_reserve(split, id + 1))
+		     != BL_CHROM_SPLIT_OK )
+		    break;
+		if ( BL_CHROM_SPLIT_START(split, id, input) != -1 )
+		{
+		    fprintf(stderr, "bl_chrom_split_add_input(): %s is not contiguous in input %u.\n",
+			    BL_CHROM_DICT_NAMES_AE(&split->dict, id), input + 1);
+		    status = BL_CHROM_SPLIT_UNSORTED;
+		    break;
+		}
+		BL_CHROM_SPLIT_START(split, id, input) = offset;
+	    }
+	    previous_id = id;
+	}
+	offset += line_len;
+    }
+    free(line);
+    if ( (status == BL_CHROM_SPLIT_OK) && (previous_id != BL_CHROM_ID_NONE) )
+	BL_CHROM_SPLIT_END(split, previous_id, input) = offset;
+
+    if ( (status == BL_CHROM_SPLIT_OK) &&
+	 (ferror(stream) || ((copy != NULL) && (fflush(copy) != 0))) )
+	status = BL_CHROM_SPLIT_IO_ERROR;
+    if ( status != BL_CHROM_SPLIT_OK )
+    {
+	if ( copy != NULL )
+	    fclose(copy);
+	return status;
+    }
+
+    split->input_fds[input] = fd;
+    split->input_copies[input] = copy;
+    ++split->input_count;
+    return BL_CHROM_SPLIT_OK;
+}
+
+
+/***************************************************************************
+ *  Name:
+ *      bl_chrom_split_run() - Process chromosomes in parallel
+ *
+ *  Library:
+ *      #include <biolibc/chrom-split.h>
+ *      -lbiolibc -lxtend -lpthread
+ *
+ *  Description:
+ *      Run func once for every chromosome indexed by
+ *      bl_chrom_split_add_input(3), using threads worker threads (0 for
+ *      one per online CPU).  Each call gets a stream per input
+ *      containing only that chromosome's lines, so the existing
+ *      single-threaded sweep logic for sorted input, such as
+ *      bl_vcf_allele_depths(3), can be used unchanged.  func must not
+ *      share mutable state, such as a bl_sam_buff_t or an unsorted
+ *      bl_chrom_dict_t, between calls.
+ *
+ *      Each chromosome's output goes to a temporary file, which is
+ *      appended to out_stream as soon as all earlier chromosomes are
+ *      done, so the output is in the same order as a serial run.
+ *      Workers stay at most BL_CHROM_SPLIT_PENDING_PER_THREAD
+ *      chromosomes per thread ahead of the merge, which bounds the
+ *      number of open temporary files.
+ *
+ *  Arguments:
+ *      split       Pointer to a bl_chrom_split_t object with inputs added
+ *      func        Function to process one chromosome
+ *      arg         Argument passed through to func
+ *      out_stream  Stream to receive merged output
+ *      threads     Number of worker threads, 0 for one per online CPU
+ *
+ *  Returns:
+ *      BL_CHROM_SPLIT_OK if func returned 0 for every chromosome
+ *      The first nonzero func return value, in chromosome order
+ *      BL_CHROM_SPLIT_IO_ERROR if temporary or output files fail
+ *      BL_CHROM_SPLIT_MALLOC_FAILED or BL_CHROM_SPLIT_THREAD_FAILED
+ *
+ *  Examples:
+ *      int     depths(FILE *inputs[], FILE *out, const char *chrom, void *arg)
+ *
+ *      {
+ *          // Allele depth sweep of inputs[0] (VCF) and inputs[1] (SAM)
+ *      }
+ *
+ *      if ( bl_chrom_split_run(&split, depths, NULL, stdout, 0)
+ *           != BL_CHROM_SPLIT_OK )
+ *          return EX_SOFTWARE;
+ *      bl_chrom_split_free(&split);
+ *
+ *  See also:
+ *      bl_chrom_split_add_input(3), bl_chrom_split_thread(3)
+ *
+ *  History: 
+ *  Date        Name        Modification
+ *  2026-10-17  agent       Begin
+ ***************************************************************************/
+
+int     bl_chrom_split_run(bl_chrom_split_t *split,
+	    bl_chrom_split_func_t func, void *arg, FILE *out_stream,
+	    unsigned threads)
+
+{
+    pthread_t   *workers;
+    size_t      chrom_count = BL_CHROM_DICT_COUNT(&split->dict),
+		c,
+		bytes;
+    unsigned    started;
+    long        cpus;
+    char        *buff;
+    int         status = BL_CHROM_SPLIT_OK;
+
+    if ( chrom_count == 0 )
+	return BL_CHROM_SPLIT_OK;
+    if ( threads == 0 )
+    {
+	cpus = sysconf(_SC_NPROCESSORS_ONLN);
+	threads = cpus < 1 ? 1 : cpus;
+    }
+    if ( threads > chrom_count )
+	threads = chrom_count;
+
+    if ( bl_chrom_split_reserve(split, chrom_count) != BL_CHROM_SPLIT_OK )
+	return BL_CHROM_SPLIT_MALLOC_FAILED;
+    split->outputs = xt_malloc(chrom_count, sizeof(*split->outputs));
+    split->statuses = xt_malloc(chrom_count, sizeof(*split->statuses));
+    split->done = xt_malloc(chrom_count, sizeof(*split->done));
+    workers = xt_malloc(threads, sizeof(*workers));
+    buff = xt_malloc(BUFSIZ, 1);
+    if ( (split->outputs == NULL) || (split->statuses == NULL) ||
+	 (split->done == NULL) || (workers == NULL) || (buff == NULL) )
+    {
+	status = BL_CHROM_SPLIT_MALLOC_FAILED;
+	threads = 0;
+    }
+    else
+    {
+	for (c = 0; c < chrom_count; ++c)
+	{
+	    split->outputs[c] = NULL;
+	    split->statuses[c] = BL_CHROM_SPLIT_OK;
+	    split->done[c] = false;
+	}
+    }
+    split->func = func;
+    split->arg = arg;
+    split->next_chrom = 0;
+    split->merged_count = 0;
+    split->max_pending = threads * BL_CHROM_SPLIT_PENDING_PER_THREAD;
+
+    pthread_mutex_init(&split->lock, NULL);
+    pthread_cond_init(&split->chrom_done, NULL);
+    pthread_cond_init(&split->chrom_merged, NULL);
+    for (started = 0; started < threads; ++started)
+	if ( pthread_create(&workers[started], NULL, bl_chrom_split_thread,
+			    split) != 0 )
+	    break;
+    if ( (started == 0) && (status == BL_CHROM_SPLIT_OK) )
+	status = BL_CHROM_SPLIT_THREAD_FAILED;
+
+    // Merge in input order as chromosomes finish
+    for (c = 0; (started > 0) && (c < chrom_count); ++c)
+    {
+	pthread_mutex_lock(&split->lock);
+	while ( ! split->done[c] )
+	    pthread_cond_wait(&split->chrom_done, &split->lock);
+	pthread_mutex_unlock(&split->lock);
+
+	if ( (split->statuses[c] != BL_CHROM_SPLIT_OK) &&
+	     (status == BL_CHROM_SPLIT_OK) )
+	    status = split->statuses[c];
+	if ( split->outputs[c] != NULL )
+	{
+	    rewind(split->outputs[c]);
+	    while ( (bytes = fread(buff, 1, BUFSIZ, split->outputs[c])) > 0 )
+		if ( fwrite(buff, 1, bytes, out_stream) != bytes )
+		    status = BL_CHROM_SPLIT_IO_ERROR;
+	    fclose(split->outputs[c]);
+	    split->outputs[c] = NULL;
+	}
+
+	pthread_mutex_lock(&split->lock);
+	++split->merged_count;
+	pthread_cond_broadcast(&split->chrom_merged);
+	pthread_mutex_unlock(&split->lock);
+    }
+
+    while ( started > 0 )
+	pthread_join(workers[--started], NULL);
+    pthread_cond_destroy(&split->chrom_merged);
+    pthread_cond_destroy(&split->chrom_done);
+    pthread_mutex_destroy(&split->lock);
+
+    free(split->outputs);
+    free(split->statuses);
+    free(split->done);
+    split->outputs = NULL;
+    split->statuses = NULL;
+    split->done = NULL;
+    free(workers);
+    free(buff);
+    if ( (status == BL_CHROM_SPLIT_OK) && (fflush(out_stream) != 0) )
+	status = BL_CHROM_SPLIT_IO_ERROR;
+    return status;
+}
+
+
+/***************************************************************************
+ *  Name:
+ *      bl_chrom_split_thread() - Worker thread for bl_chrom_split_run(3)
+ *
+ *  Library:
+ *      #include <biolibc/chrom-split.h>
+ *      -lbiolibc -lxtend -lpthread
+ *
+ *  Description:
+ *      Claim chromosomes in order, open a range stream on each input
+ *      with bl_chrom_split_range_fopen(3), call the user function with
+ *      output to a temporary file, and hand the result to the merging
+ *      thread.  Not normally called directly.
+ *
+ *  Arguments:
+ *      arg     Pointer to the bl_chrom_split_t object
+ *
+ *  Returns:
+ *      NULL
+ *
+ *  See also:
+ *      bl_chrom_split_run(3)
+ *
+ *  History: 
+ *  Date        Name        Modification
+ *  2026-10-17  agent       Begin
+ ***************************************************************************/
+
+void    *bl_chrom_split_thread(void *arg)
+
+{
+    bl_chrom_split_t    *split = arg;
+    FILE        *inputs[BL_CHROM_SPLIT_MAX_INPUTS],
+		*out;
+    size_t      chrom_count = BL_CHROM_DICT_COUNT(&split->dict),
+		c;
+    off_t       start, end;
+    unsigned    input;
+    int         status;
+
+    for (;;)
+    {
+	pthread_mutex_lock(&split->lock);
+	while ( (split->next_chrom < chrom_count) &&
+		(split->next_chrom - split->merged_count >= split->max_pending) )
+	    pthread_cond_wait(&split->chrom_merged, &split->lock);
+	if ( split->next_chrom == chrom_count )
+	{
+	    pthread_mutex_unlock(&split->lock);
+	    return NULL;
+	}
+	c = split->next_chrom++;
+	pthread_mutex_unlock(&split->lock);
+
+	status = BL_CHROM_SPLIT_OK;
+	if ( (out = tmpfile()) == NULL )
+	    status = BL_CHROM_SPLIT_IO_ERROR;
+	for (input = 0; input < split->input_count; ++input)
+	{
+	    // Chromosomes absent from an input get an empty stream
+	    start = BL_CHROM_SPLIT_START(split, c, input);
+	    end = BL_CHROM_SPLIT_END(split, c, input);
+	    if ( start == -1 )
+		start = end = 0;
+	    inputs[input] = bl_chrom_split_range_fopen(split->input_fds[input],
+						       start, end);
+	    if ( inputs[input] == NULL )
+		status = BL_CHROM_SPLIT_IO_ERROR;
+	}
+
+	if ( status == BL_CHROM_SPLIT_OK )
+	{
+	    status = split->func(inputs, out,
+				 BL_CHROM_DICT_NAMES_AE(&split->dict, c),
+				 split->arg);
+	    if ( (fflush(out) != 0) && (status == BL_CHROM_SPLIT_OK) )
+		status = BL_CHROM_SPLIT_IO_ERROR;
+	}
+	for (input = 0; input < split->input_count; ++input)
+	    if ( inputs[input] != NULL )
+		fclose(inputs[input]);
+
+	pthread_mutex_lock(&split->lock);
+	split->outputs[c] = out;
+	split->statuses[c] = status;
+	split->done[c] = true;
+	pthread_cond_broadcast(&split->chrom_done);
+	pthread_mutex_unlock(&split->lock);
+    }
+}
+
+
+/***************************************************************************
+ *  Name:
+ *      bl_chrom_split_range_fopen() - Open a byte range of a file as a stream
+ *
+ *  Library:
+ *      #include <biolibc/chrom-split.h>
+ *      -lbiolibc -lxtend -lpthread
+ *
+ *  Description:
+ *      Return a read-only FILE stream delivering bytes start through
+ *      end - 1 of the regular file open on fd, followed by EOF.  Data
+ *      are read with pread(2), so any number of range streams on the
+ *      same descriptor can be read concurrently by different threads.
+ *      Closing the stream does not close fd.
+ *
+ *  Arguments:
+ *      fd      Descriptor of a regular file open for reading
+ *      start   Offset of the first byte
+ *      end     Offset just past the last byte
+ *
+ *  Returns:
+ *      A FILE stream open for reading, or NULL on failure
+ *
+ *  See also:
+ *      bl_chrom_split_run(3), fopencookie(3), funopen(3)
+ *
+ *  History: 
+ *  Date        Name        Modification
+ *  2026-10-17  agent       Begin
+ ***************************************************************************/
+
+FILE    *bl_chrom_split_range_fopen(int fd, off_t start, off_t end)
+
+{
+    bl_chrom_split_range_t  *range;
+    FILE                    *fp;
+#ifdef __linux__
+    cookie_io_functions_t   io =
+	{ bl_chrom_split_cookie_read, NULL, NULL, bl_chrom_split_cookie_close };
+#endif
+
+    if ( (range = xt_malloc(1, sizeof(*range))) == NULL )
+	return NULL;
+    range->fd = fd;
+    range->pos = start;
+    range->end = end;
+
+#ifdef __linux__
+    fp = fopencookie(range, "r", io);
+#else
+    fp = funopen(range, bl_chrom_split_cookie_read, NULL, NULL,
+		 bl_chrom_split_cookie_close);
+#endif
+    if ( fp == NULL )
+	free(range);
+    return fp;
+}
+
+
+/***************************************************************************
+ *  Name:
+ *      bl_chrom_split_cookie_read() - stdio read hook for bl_chrom_split_range_fopen(3)
+ *
+ *  Library:
+ *      #include <biolibc/chrom-split.h>
+ *      -lbiolibc -lxtend -lpthread
+ *
+ *  Description:
+ *      Read function passed to fopencookie(3) on Linux or funopen(3)
+ *      on BSD and macOS.  Not normally called directly.
+ *
+ *  Arguments:
+ *      cookie      Pointer to the bl_chrom_split_range_t object
+ *      buff        Buffer to receive data
+ *      count       Maximum number of bytes to read
+ *
+ *  Returns:
+ *      Number of bytes read, 0 at end of range, or -1 on error
+ *
+ *  See also:
+ *      bl_chrom_split_range_fopen(3)
+ *
+ *  History: 
+ *  Date        Name        Modification
+ *  2026-10-17  agent       Begin
+ ***************************************************************************/
+
+#ifdef __linux__
+ssize_t bl_chrom_split_cookie_read(void *cookie, char *buff, size_t count)
+#else
+int     bl_chrom_split_cookie_read(void *cookie, char *buff, int count)
+#endif
+
+{
+    bl_chrom_split_range_t  *range = cookie;
+    ssize_t                 bytes;
+
+    if ( (off_t)count > range->end - range->pos )
+	count = range->end - range->pos;
+    if ( count == 0 )
+	return 0;
+    if ( (bytes = pread(range->fd, buff, count, range->pos)) > 0 )
+	range->pos += bytes;
+    return bytes;
+}
+
+
+/***************************************************************************
+ *  Name:
+ *      bl_chrom_split_cookie_close() - stdio close hook for bl_chrom_split_range_fopen(3)
+ *
+ *  Library:
+ *      #include <biolibc/chrom-split.h>
+ *      -lbiolibc -lxtend -lpthread
+ *
+ *  Description:
+ *      Close function passed to fopencookie(3) on Linux or funopen(3)
+ *      on BSD and macOS.  Frees the range but leaves the descriptor
+ *      open.  Not normally called directly.
+ *
+ *  Arguments:
+ *      cookie      Pointer to the bl_chrom_split_range_t object
+ *
+ *  Returns:
+ *      0
+ *
+ *  See also:
+ *      bl_chrom_split_range_fopen(3)
+ *
+ *  History: 
+ *  Date        Name        Modification
+ *  2026-10-17  agent       Begin
+ ***************************************************************************/
+
+int     bl_chrom_split_cookie_close(void *cookie)
+
+{
+    free(cookie);
+    return 0;
+}
@@ -0,0 +1,122 @@
+#ifndef _BIOLIBC_CHROM_SPLIT_H_
+#define _BIOLIBC_CHROM_SPLIT_H_
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+#include <pthread.h>
+
+#ifndef _SYS_TYPES_H_
+#include <sys/types.h>      // off_t
+#endif
+
+#ifndef __bool_true_false_are_defined
+#include <stdbool.h>
+#endif
+
+#ifndef _BIOLIBC_H_
+#include "biolibc.h"
+#endif
+
+#ifndef _BIOLIBC_CHROM_DICT_H_
+#include "chrom-dict.h"
+#endif
+
+/*
+ *  Per-chromosome parallel processing of sorted, tab-separated inputs
+ *  such as SAM, VCF, BED and GFF3.  Chromosomes are independent, so each
+ *  input is indexed in one sequential pass that records the byte range
+ *  of every chromosome, and a pool of worker threads then runs the
+ *  caller's single-threaded sweep on one chromosome at a time.  Each
+ *  worker reads its ranges with pread(2), so no data is copied unless
+ *  an input is not a regular file, e.g. a pipe or a bl_bgzf_fopen(3)
+ *  stream, in which case it is first copied to a temporary file.
+ *  Output from each chromosome goes to a temporary file and is merged
+ *  to the final output in input order as soon as all earlier
+ *  chromosomes are finished.
+ */
+
+#define BL_CHROM_SPLIT_MAX_INPUTS   4
+
+// Chromosomes in flight or awaiting merge per worker thread
+#define BL_CHROM_SPLIT_PENDING_PER_THREAD   4
+
+#define BL_CHROM_SPLIT_OK               0
+#define BL_CHROM_SPLIT_MALLOC_FAILED    -1
+#define BL_CHROM_SPLIT_IO_ERROR         -2
+#define BL_CHROM_SPLIT_UNSORTED         -3
+#define BL_CHROM_SPLIT_TOO_MANY_INPUTS  -4
+#define BL_CHROM_SPLIT_THREAD_FAILED    -5
+
+/*
+ *  Called by worker threads for each chromosome.  inputs[] holds one
+ *  stream per input, containing only the lines for chrom (possibly
+ *  none).  Anything written to out_stream is merged to the final
+ *  output.  Return 0 on success.
+ */
+typedef int (*bl_chrom_split_func_t)(FILE *inputs[], FILE *out_stream,
+				     const char *chrom, void *arg);
+
+// Cookie for bl_chrom_split_range_fopen()
+typedef struct
+{
+    int     fd;
+    off_t   pos,
+	    end;
+}   bl_chrom_split_range_t;
+
+typedef struct
+{
+    bl_chrom_dict_t dict;       // Chromosomes, in order of first appearance
+    unsigned        input_count;
+    int             input_fds[BL_CHROM_SPLIT_MAX_INPUTS];
+    FILE            *input_copies[BL_CHROM_SPLIT_MAX_INPUTS];
+    size_t          chrom_array_size;
+    off_t           *starts,    // [id * BL_CHROM_SPLIT_MAX_INPUTS + input]
+		    *ends;
+
+    // Shared with worker threads by bl_chrom_split_run()
+    bl_chrom_split_func_t   func;
+    void            *arg;
+    FILE            **outputs;  // Per chromosome, until merged
+    int             *statuses;
+    bool            *done;
+    size_t          next_chrom,
+		    merged_count,
+		    max_pending;
+    pthread_mutex_t lock;
+    pthread_cond_t  chrom_done,
+		    chrom_merged;
+}   bl_chrom_split_t;
+
+// Byte range of a chromosome in an input, -1 if not present
+#define BL_CHROM_SPLIT_START(ptr,id,input) \
+	((ptr)->starts[(id) * BL_CHROM_SPLIT_MAX_INPUTS + (input)])
+#define BL_CHROM_SPLIT_END(ptr,id,input) \
+	((ptr)->ends[(id) * BL_CHROM_SPLIT_MAX_INPUTS + (input)])
+
+#include "chrom-split-rvs.h"
+#include "chrom-split-accessors.h"
+#include "chrom-split-mutators.h"
+
+/* chrom-split.c */
+void bl_chrom_split_init(bl_chrom_split_t *split);
+void bl_chrom_split_free(bl_chrom_split_t *split);
+int bl_chrom_split_reserve(bl_chrom_split_t *split, size_t chroms);
+int bl_chrom_split_add_input(bl_chrom_split_t *split, FILE *stream, unsigned chrom_col);
+int bl_chrom_split_run(bl_chrom_split_t *split, bl_chrom_split_func_t func, void *arg, FILE *out_stream, unsigned threads);
+void *bl_chrom_split_thread(void *arg);
+FILE *bl_chrom_split_range_fopen(int fd, off_t start, off_t end);
+#ifdef __linux__
+ssize_t bl_chrom_split_cookie_read(void *cookie, char *buff, size_t count);
+#else
+int bl_chrom_split_cookie_read(void *cookie, char *buff, int count);
+#endif
+int bl_chrom_split_cookie_close(void *cookie);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif // _BIOLIBC_CHROM_SPLIT_H_
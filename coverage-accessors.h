@@ -0,0 +1,19 @@
+    
+/*
+ *  Generated by /usr/local/bin/auto-gen-get-set
+ *
+ *  Accessor macros.  Use these to access structure members from functions
+ *  outside the bl_coverage_t class.
+ *
+ *  These generated macros are not expected to be perfect.  Check and edit
+ *  as needed before adding to your code.
+ */
+
+#define BL_COVERAGE_OUT_STREAM(ptr)     ((ptr)->out_stream)
+#define BL_COVERAGE_FORMAT(ptr)         ((ptr)->format)
+#define BL_COVERAGE_CHROM(ptr)          ((ptr)->chrom)
+#define BL_COVERAGE_CHROM_AE(ptr,c)     ((ptr)->chrom[c])
+#define BL_COVERAGE_CHROM_INDEX(ptr)    ((ptr)->chrom_index)
+#define BL_COVERAGE_DELTA_ARRAY_SIZE(ptr) ((ptr)->delta_array_size)
+#define BL_COVERAGE_FLUSHED_POS(ptr)    ((ptr)->flushed_pos)
+#define BL_COVERAGE_END_POS(ptr)        ((ptr)->end_pos)
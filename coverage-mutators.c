@@ -0,0 +1,454 @@
+/***************************************************************************
+ *  This file is automatically generated by gen-get-set.  Be sure to keep
+ *  track of any manual changes.
+ *
+ *  These generated functions are not expected to be perfect.  Check and
+ *  edit as needed before adding to your code.
+ ***************************************************************************/
+
+#include <string.h>
+#include <ctype.h>
+#include <stdbool.h>        // In case of bool
+#include <stdint.h>         // In case of int64_t, etc
+#include <xtend/string.h>   // strlcpy() on Linux
+#include "coverage.h"
+
+
+/***************************************************************************
+ *  Library:
+ *      #include <biolibc/coverage.h>
+ *      -lbiolibc -lxtend
+ *
+ *  Description:
+ *      Mutator for out_stream member in a bl_coverage_t structure.
+ *      Use this function to set out_stream in a bl_coverage_t object
+ *      from non-member functions.  This function performs a direct
+ *      assignment for scalar or pointer structure members.  If
+ *      out_stream is a pointer, data previously pointed to should
+ *      be freed before calling this function to avoid memory
+ *      leaks.
+ *
+ *  Arguments:
+ *      bl_coverage_ptr Pointer to the structure to set
+ *      new_out_stream  The new value for out_stream
+ *
+ *  Returns:
+ *      BL_COVERAGE_DATA_OK if the new value is acceptable and assigned
+ *      BL_COVERAGE_DATA_OUT_OF_RANGE otherwise
+ *
+ *  Examples:
+ *      bl_coverage_t   bl_coverage;
+ *      FILE *          new_out_stream;
+ *
+ *      if ( bl_coverage_set_out_stream(&bl_coverage, new_out_stream)
+ *              == BL_COVERAGE_DATA_OK )
+ *      {
+ *      }
+ *
+ *  See also:
+ *      (3)
+ *
+ *  History: 
+ *  Date        Name        Modification
+ *  2026-10-17  gen-get-set Auto-generated from coverage.h
+ ***************************************************************************/
+
+int     bl_coverage_set_out_stream(
+	    bl_coverage_t *bl_coverage_ptr,
+	    FILE *new_out_stream
+	)
+
+{
+    if ( new_out_stream == NULL )
+	return BL_COVERAGE_DATA_OUT_OF_RANGE;
+    else
+    {
+	bl_coverage_ptr->out_stream = new_out_stream;
+	return BL_COVERAGE_DATA_OK;
+    }
+}
+
+
+/***************************************************************************
+ *  Library:
+ *      #include <biolibc/coverage.h>
+ *      -lbiolibc -lxtend
+ *
+ *  Description:
+ *      Mutator for format member in a bl_coverage_t structure.
+ *      Use this function to set format in a bl_coverage_t object
+ *      from non-member functions.  This function performs a direct
+ *      assignment for scalar or pointer structure members.  If
+ *      format is a pointer, data previously pointed to should
+ *      be freed before calling this function to avoid memory
+ *      leaks.
+ *
+ *  Arguments:
+ *      bl_coverage_ptr Pointer to the structure to set
+ *      new_format      The new value for format
+ *
+ *  Returns:
+ *      BL_COVERAGE_DATA_OK if the new value is acceptable and assigned
+ *      BL_COVERAGE_DATA_OUT_OF_RANGE otherwise
+ *
+ *  Examples:
+ *      bl_coverage_t   bl_coverage;
+ *      int             new_format;
+ *
+ *      if ( bl_coverage_set_format(&bl_coverage, new_format)
+ *              == BL_COVERAGE_DATA_OK )
+ *      {
+ *      }
+ *
+ *  See also:
+ *      (3)
+ *
+ *  History: 
+ *  Date        Name        Modification
+ *  2026-10-17  gen-get-set Auto-generated from coverage.h
+ ***************************************************************************/
+
+int     bl_coverage_set_format(
+	    bl_coverage_t *bl_coverage_ptr,
+	    int new_format
+	)
+
+{
+    if ( false )
+	return BL_COVERAGE_DATA_OUT_OF_RANGE;
+    else
+    {
+	bl_coverage_ptr->format = new_format;
+	return BL_COVERAGE_DATA_OK;
+    }
+}
+
+
+/***************************************************************************
+ *  Library:
+ *      #include <biolibc/coverage.h>
+ *      -lbiolibc -lxtend
+ *
+ *  Description:
+ *      Mutator for an array element of chrom member in a bl_coverage_t
+ *      structure. Use this function to set bl_coverage_ptr->chrom[c]
+ *      in a bl_coverage_t object from non-member functions.
+ *
+ *  Arguments:
+ *      bl_coverage_ptr Pointer to the structure to set
+ *      c               Subscript to the chrom array
+ *      new_chrom_element The new value for chrom[c]
+ *
+ *  Returns:
+ *      BL_COVERAGE_DATA_OK if the new value is acceptable and assigned
+ *      BL_COVERAGE_DATA_OUT_OF_RANGE otherwise
+ *
+ *  Examples:
+ *      bl_coverage_t   bl_coverage;
+ *      size_t          c;
+ *      char            new_chrom_element;
+ *
+ *      if ( bl_coverage_set_chrom_ae(&bl_coverage, c, new_chrom_element)
+ *              == BL_COVERAGE_DATA_OK )
+ *      {
+ *      }
+ *
+ *  See also:
+ *      BL_COVERAGE_SET_CHROM_AE(3)
+ *
+ *  History: 
+ *  Date        Name        Modification
+ *  2026-10-17  gen-get-set Auto-generated from coverage.h
+ ***************************************************************************/
+
+int     bl_coverage_set_chrom_ae(
+	    bl_coverage_t *bl_coverage_ptr,
+	    size_t c,
+	    char new_chrom_element
+	)
+
+{
+    if ( false )
+	return BL_COVERAGE_DATA_OUT_OF_RANGE;
+    else
+    {
+	bl_coverage_ptr->chrom[c] = new_chrom_element;
+	return BL_COVERAGE_DATA_OK;
+    }
+}
+
+
+/***************************************************************************
+ *  Library:
+ *      #include <biolibc/coverage.h>
+ *      -lbiolibc -lxtend
+ *
+ *  Description:
+ *      Mutator for chrom member in a bl_coverage_t structure.
+ *      Use this function to set chrom in a bl_coverage_t object
+ *      from non-member functions.  This function copies the array pointed to
+ *      by new_chrom to bl_coverage_ptr->chrom.
+ *
+ *  Arguments:
+ *      bl_coverage_ptr Pointer to the structure to set
+ *      new_chrom       The new value for chrom
+ *      array_size      Size of the chrom array.
+ *
+ *  Returns:
+ *      BL_COVERAGE_DATA_OK if the new value is acceptable and assigned
+ *      BL_COVERAGE_DATA_OUT_OF_RANGE otherwise
+ *
+ *  Examples:
+ *      bl_coverage_t   bl_coverage;
+ *      char *          new_chrom;
+ *      size_t          array_size;
+ *
+ *      if ( bl_coverage_set_chrom_cpy(&bl_coverage, new_chrom, array_size)
+ *              == BL_COVERAGE_DATA_OK )
+ *      {
+ *      }
+ *
+ *  See also:
+ *      BL_COVERAGE_SET_CHROM(3)
+ *
+ *  History: 
+ *  Date        Name        Modification
+ *  2026-10-17  gen-get-set Auto-generated from coverage.h
+ ***************************************************************************/
+
+int     bl_coverage_set_chrom_cpy(
+	    bl_coverage_t *bl_coverage_ptr,
+	    char *new_chrom,
+	    size_t array_size
+	)
+
+{
+    if ( new_chrom == NULL )
+	return BL_COVERAGE_DATA_OUT_OF_RANGE;
+    else
+    {
+	// FIXME: Assuming char array is a null-terminated string
+	strlcpy(bl_coverage_ptr->chrom, new_chrom, array_size);
+	return BL_COVERAGE_DATA_OK;
+    }
+}
+
+
+/***************************************************************************
+ *  Library:
+ *      #include <biolibc/coverage.h>
+ *      -lbiolibc -lxtend
+ *
+ *  Description:
+ *      Mutator for chrom_index member in a bl_coverage_t structure.
+ *      Use this function to set chrom_index in a bl_coverage_t object
+ *      from non-member functions.  This function performs a direct
+ *      assignment for scalar or pointer structure members.  If
+ *      chrom_index is a pointer, data previously pointed to should
+ *      be freed before calling this function to avoid memory
+ *      leaks.
+ *
+ *  Arguments:
+ *      bl_coverage_ptr Pointer to the structure to set
+ *      new_chrom_index The new value for chrom_index
+ *
+ *  Returns:
+ *      BL_COVERAGE_DATA_OK if the new value is acceptable and assigned
+ *      BL_COVERAGE_DATA_OUT_OF_RANGE otherwise
+ *
+ *  Examples:
+ *      bl_coverage_t   bl_coverage;
+ *      int32_t         new_chrom_index;
+ *
+ *      if ( bl_coverage_set_chrom_index(&bl_coverage, new_chrom_index)
+ *              == BL_COVERAGE_DATA_OK )
+ *      {
+ *      }
+ *
+ *  See also:
+ *      (3)
+ *
+ *  History: 
+ *  Date        Name        Modification
+ *  2026-10-17  gen-get-set Auto-generated from coverage.h
+ ***************************************************************************/
+
+int     bl_coverage_set_chrom_index(
+	    bl_coverage_t *bl_coverage_ptr,
+	    int32_t new_chrom_index
+	)
+
+{
+    if ( false )
+	return BL_COVERAGE_DATA_OUT_OF_RANGE;
+    else
+    {
+	bl_coverage_ptr->chrom_index = new_chrom_index;
+	return BL_COVERAGE_DATA_OK;
+    }
+}
+
+
+/***************************************************************************
+ *  Library:
+ *      #include <biolibc/coverage.h>
+ *      -lbiolibc -lxtend
+ *
+ *  Description:
+ *      Mutator for delta_array_size member in a bl_coverage_t structure.
+ *      Use this function to set delta_array_size in a bl_coverage_t object
+ *      from non-member functions.  This function performs a direct
+ *      assignment for scalar or pointer structure members.  If
+ *      delta_array_size is a pointer, data previously pointed to should
+ *      be freed before calling this function to avoid memory
+ *      leaks.
+ *
+ *  Arguments:
+ *      bl_coverage_ptr Pointer to the structure to set
+ *      new_delta_array_size The new value for delta_array_size
+ *
+ *  Returns:
+ *      BL_COVERAGE_DATA_OK if the new value is acceptable and assigned
+ *      BL_COVERAGE_DATA_OUT_OF_RANGE otherwise
+ *
+ *  Examples:
+ *      bl_coverage_t   bl_coverage;
+ *      size_t          new_delta_array_size;
+ *
+ *      if ( bl_coverage_set_delta_array_size(&bl_coverage, new_delta_array_size)
+ *              == BL_COVERAGE_DATA_OK )
+ *      {
+ *      }
+ *
+ *  See also:
+ *      (3)
+ *
+ *  History: 
+ *  Date        Name        Modification
+ *  2026-10-17  gen-get-set Auto-generated from coverage.h
+ ***************************************************************************/
+
+int     bl_coverage_set_delta_array_size(
+	    bl_coverage_t *bl_coverage_ptr,
+	    size_t new_delta_array_size
+	)
+
+{
+    if ( false )
+	return BL_COVERAGE_DATA_OUT_OF_RANGE;
+    else
+    {
+	bl_coverage_ptr->delta_array_size = new_delta_array_size;
+	return BL_COVERAGE_DATA_OK;
+    }
+}
+
+
+/***************************************************************************
+ *  Library:
+ *      #include <biolibc/coverage.h>
+ *      -lbiolibc -lxtend
+ *
+ *  Description:
+ *      Mutator for flushed_pos member in a bl_coverage_t structure.
+ *      Use this function to set flushed_pos in a bl_coverage_t object
+ *      from non-member functions.  This function performs a direct
+ *      assignment for scalar or pointer structure members.  If
+ *      flushed_pos is a pointer, data previously pointed to should
+ *      be freed before calling this function to avoid memory
+ *      leaks.
+ *
+ *  Arguments:
+ *      bl_coverage_ptr Pointer to the structure to set
+ *      new_flushed_pos The new value for flushed_pos
+ *
+ *  Returns:
+ *      BL_COVERAGE_DATA_OK if the new value is acceptable and assigned
+ *      BL_COVERAGE_DATA_OUT_OF_RANGE otherwise
+ *
+ *  Examples:
+ *      bl_coverage_t   bl_coverage;
+ *      int64_t         new_flushed_pos;
+ *
+ *      if ( bl_coverage_set_flushed_pos(&bl_coverage, new_flushed_pos)
+ *              == BL_COVERAGE_DATA_OK )
+ *      {
+ *      }
+ *
+ *  See also:
+ *      (3)
+ *
+ *  History: 
+ *  Date        Name        Modification
+ *  2026-10-17  gen-get-set Auto-generated from coverage.h
+ ***************************************************************************/
+
+int     bl_coverage_set_flushed_pos(
+	    bl_coverage_t *bl_coverage_ptr,
+	    int64_t new_flushed_pos
+	)
+
+{
+    if ( false )
+	return BL_COVERAGE_DATA_OUT_OF_RANGE;
+    else
+    {
+	bl_coverage_ptr->flushed_pos = new_flushed_pos;
+	return BL_COVERAGE_DATA_OK;
+    }
+}
+
+
+/***************************************************************************
+ *  Library:
+ *      #include <biolibc/coverage.h>
+ *      -lbiolibc -lxtend
+ *
+ *  Description:
+ *      Mutator for end_pos member in a bl_coverage_t structure.
+ *      Use this function to set end_pos in a bl_coverage_t object
+ *      from non-member functions.  This function performs a direct
+ *      assignment for scalar or pointer structure members.  If
+ *      end_pos is a pointer, data previously pointed to should
+ *      be freed before calling this function to avoid memory
+ *      leaks.
+ *
+ *  Arguments:
+ *      bl_coverage_ptr Pointer to the structure to set
+ *      new_end_pos     The new value for end_pos
+ *
+ *  Returns:
+ *      BL_COVERAGE_DATA_OK if the new value is acceptable and assigned
+ *      BL_COVERAGE_DATA_OUT_OF_RANGE otherwise
+ *
+ *  Examples:
+ *      bl_coverage_t   bl_coverage;
+ *      int64_t         new_end_pos;
+ *
+ *      if ( bl_coverage_set_end_pos(&bl_coverage, new_end_pos)
+ *              == BL_COVERAGE_DATA_OK )
+ *      {
+ *      }
+ *
+ *  See also:
+ *      (3)
+ *
+ *  History: 
+ *  Date        Name        Modification
+ *  2026-10-17  gen-get-set Auto-generated from coverage.h
+ ***************************************************************************/
+
+int     bl_coverage_set_end_pos(
+	    bl_coverage_t *bl_coverage_ptr,
+	    int64_t new_end_pos
+	)
+
+{
+    if ( false )
+	return BL_COVERAGE_DATA_OUT_OF_RANGE;
+    else
+    {
+	bl_coverage_ptr->end_pos = new_end_pos;
+	return BL_COVERAGE_DATA_OK;
+    }
+}
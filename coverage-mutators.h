@@ -0,0 +1,24 @@
+
+/*
+ *  Generated by /usr/local/bin/auto-gen-get-set
+ *
+ *  Mutator functions for setting with no sanity checking.  Use these to
+ *  set structure members from functions outside the bl_coverage_t
+ *  class.  These macros perform no data validation.  Hence, they achieve
+ *  maximum performance where data are guaranteed correct by other means.
+ *  Use the mutator functions (same name as the macro, but lower case)
+ *  for more robust code with a small performance penalty.
+ *
+ *  These generated macros are not expected to be perfect.  Check and edit
+ *  as needed before adding to your code.
+ */
+
+/* temp-coverage-mutators.c */
+int bl_coverage_set_out_stream(bl_coverage_t *bl_coverage_ptr, FILE *new_out_stream);
+int bl_coverage_set_format(bl_coverage_t *bl_coverage_ptr, int new_format);
+int bl_coverage_set_chrom_ae(bl_coverage_t *bl_coverage_ptr, size_t c, char new_chrom_element);
+int bl_coverage_set_chrom_cpy(bl_coverage_t *bl_coverage_ptr, char *new_chrom, size_t array_size);
+int bl_coverage_set_chrom_index(bl_coverage_t *bl_coverage_ptr, int32_t new_chrom_index);
+int bl_coverage_set_delta_array_size(bl_coverage_t *bl_coverage_ptr, size_t new_delta_array_size);
+int bl_coverage_set_flushed_pos(bl_coverage_t *bl_coverage_ptr, int64_t new_flushed_pos);
+int bl_coverage_set_end_pos(bl_coverage_t *bl_coverage_ptr, int64_t new_end_pos);
@@ -0,0 +1,467 @@
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <sysexits.h>
+#include <inttypes.h>
+#include <xtend/string.h>   // strlcpy() on Linux
+#include "coverage.h"
+
+/***************************************************************************
+ *  Name:
+ *      bl_coverage_init() - Initialize a read depth accumulator
+ *
+ *  Library:
+ *      #include <biolibc/coverage.h>
+ *      -lbiolibc -lxtend
+ *
+ *  Description:
+ *      Initialize a bl_coverage_t object to compute read depth from
+ *      alignments sorted by chrom and position, fed to it by
+ *      bl_coverage_add(3).  Runs of positions with equal, non-zero depth
+ *      are written to out_stream as they are completed.
+ *
+ *      With BL_COVERAGE_FORMAT_BEDGRAPH, each run is written by
+ *      bl_bed_write(3) as a bedGraph line: chrom, 0-based start,
+ *      exclusive end and depth.  With BL_COVERAGE_FORMAT_BINARY, each
+ *      run is written as one bl_coverage_run_t structure, in host byte
+ *      order, with the chromosome given as its index in order of
+ *      appearance.
+ *
+ *  Arguments:
+ *      coverage    Pointer to the bl_coverage_t object to initialize
+ *      out_stream  FILE stream to receive runs
+ *      format      BL_COVERAGE_FORMAT_BEDGRAPH or BL_COVERAGE_FORMAT_BINARY
+ *
+ *  Examples:
+ *      bl_coverage_t   coverage;
+ *      bl_sam_t        alignment = BL_SAM_INIT;
+ *
+ *      bl_coverage_init(&coverage, stdout, BL_COVERAGE_FORMAT_BEDGRAPH);
+ *      while ( bl_sam_read(&alignment, sam_stream, BL_SAM_FIELD_ALL)
+ *              == BL_READ_OK )
+ *          if ( bl_coverage_add(&coverage, &alignment) != BL_COVERAGE_OK )
+ *              break;
+ *      bl_coverage_finish(&coverage);
+ *      bl_coverage_free(&coverage);
+ *
+ *  See also:
+ *      bl_coverage_add(3), bl_coverage_finish(3), bl_coverage_free(3)
+ *
+ *  History:
+ *  Date        Name        Modification
+ *  2026-10-17  agent       Begin
+ ***************************************************************************/
+
+void    bl_coverage_init(bl_coverage_t *coverage, FILE *out_stream, int format)
+
+{
+    coverage->out_stream = out_stream;
+    coverage->format = format;
+    *coverage->chrom = '\0';
+    coverage->chrom_index = -1;
+    coverage->delta_array_size = BL_COVERAGE_DELTA_START_SIZE;
+    coverage->deltas = calloc(coverage->delta_array_size,
+			      sizeof(*coverage->deltas));
+    if ( coverage->deltas == NULL )
+    {
+	fprintf(stderr, "bl_coverage_init(): Could not allocate deltas.\n");
+	exit(EX_UNAVAILABLE);
+    }
+    coverage->flushed_pos = 0;
+    coverage->end_pos = 0;
+    coverage->run_start = 0;
+    coverage->run_depth = 0;
+    bl_bed_init(&coverage->bed);
+    coverage->bed.fields = 4;
+}
+
+
+/***************************************************************************
+ *  Name:
+ *      bl_coverage_free() - Free memory held by a read depth accumulator
+ *
+ *  Library:
+ *      #include <biolibc/coverage.h>
+ *      -lbiolibc -lxtend
+ *
+ *  Description:
+ *      Free the difference array of a bl_coverage_t object.  Runs not
+ *      yet written are discarded, so call bl_coverage_finish(3) first.
+ *
+ *  Arguments:
+ *      coverage    Pointer to the bl_coverage_t object
+ *
+ *  See also:
+ *      bl_coverage_init(3), bl_coverage_finish(3)
+ *
+ *  History:
+ *  Date        Name        Modification
+ *  2026-10-17  agent       Begin
+ ***************************************************************************/
+
+void    bl_coverage_free(bl_coverage_t *coverage)
+
+{
+    free(coverage->deltas);
+    coverage->deltas = NULL;
+    coverage->delta_array_size = 0;
+}
+
+
+/***************************************************************************
+ *  Name:
+ *      bl_coverage_add() - Add an alignment to a read depth accumulator
+ *
+ *  Library:
+ *      #include <biolibc/coverage.h>
+ *      -lbiolibc -lxtend
+ *
+ *  Description:
+ *      Add the aligned blocks of an alignment to a bl_coverage_t object.
+ *      Positions aligned to read bases (CIGAR M, = and X) and deletions
+ *      (D) are counted, while skipped regions (N) split the alignment
+ *      into separate blocks.  Unmapped alignments are ignored.  Filtering
+ *      by MAPQ, FLAG, etc. is left to the caller.
+ *
+ *      Alignments must be sorted by position within each chromosome.
+ *      All positions before the start of alignment are final, so their
+ *      runs are written first.  A change of RNAME completes the previous
+ *      chromosome as with bl_coverage_finish(3).
+ *
+ *  Arguments:
+ *      coverage    Pointer to a bl_coverage_t object
+ *      alignment   Alignment with CIGAR parsed by bl_sam_read(3) or
+ *                  bl_sam_parse_cigar(3)
+ *
+ *  Returns:
+ *      BL_COVERAGE_OK on success
+ *      BL_COVERAGE_UNSORTED if alignment starts before a previous one
+ *      BL_COVERAGE_WRITE_FAILED if a run could not be written
+ *
+ *  See also:
+ *      bl_coverage_init(3), bl_coverage_finish(3)
+ *
+ *  History:
+ *  Date        Name        Modification
+ *  2026-10-17  agent       Begin
+ ***************************************************************************/
+
+int     bl_coverage_add(bl_coverage_t *coverage, bl_sam_t *alignment)
+
+{
+    int64_t     ref_pos,
+		block_start;
+    size_t      c;
+    unsigned    op;
+    int         status;
+
+    if ( (BL_SAM_FLAG(alignment) & BL_SAM_FLAG_UNMAP) ||
+	 (BL_SAM_REF_END(alignment) < BL_SAM_POS(alignment)) )
+	return BL_COVERAGE_OK;
+
+    if ( strcmp(coverage->chrom, BL_SAM_RNAME(alignment)) != 0 )
+    {
+	if ( (status = bl_coverage_finish(coverage)) != BL_COVERAGE_OK )
+	    return status;
+	strlcpy(coverage->chrom, BL_SAM_RNAME(alignment),
+		BL_SAM_RNAME_MAX_CHARS + 1);
+	strlcpy(coverage->bed.chrom, BL_SAM_RNAME(alignment),
+		BL_CHROM_MAX_CHARS + 1);
+	++coverage->chrom_index;
+	coverage->flushed_pos = coverage->end_pos = BL_SAM_POS(alignment);
+    }
+    else if ( BL_SAM_POS(alignment) < coverage->flushed_pos )
+    {
+	fprintf(stderr, "bl_coverage_add(): Alignments out of order at %s:%"
+		PRId64 ".\n", BL_SAM_RNAME(alignment), BL_SAM_POS(alignment));
+	return BL_COVERAGE_UNSORTED;
+    }
+    else if ( (status = bl_coverage_flush(coverage, BL_SAM_POS(alignment)))
+	      != BL_COVERAGE_OK )
+	return status;
+
+    if ( BL_SAM_CIGAR_OP_COUNT(alignment) == 0 )
+    {
+	bl_coverage_add_block(coverage, BL_SAM_POS(alignment),
+			      BL_SAM_REF_END(alignment));
+	return BL_COVERAGE_OK;
+    }
+
+    ref_pos = block_start = BL_SAM_POS(alignment);
+    for (c = 0; c < BL_SAM_CIGAR_OP_COUNT(alignment); ++c)
+    {
+	op = BL_SAM_CIGAR_OP(BL_SAM_CIGAR_OPS_AE(alignment, c));
+	if ( op == BL_SAM_CIGAR_REF_SKIP )
+	{
+	    if ( ref_pos > block_start )
+		bl_coverage_add_block(coverage, block_start, ref_pos - 1);
+	    ref_pos += BL_SAM_CIGAR_OP_LEN(BL_SAM_CIGAR_OPS_AE(alignment, c));
+	    block_start = ref_pos;
+	}
+	else if ( BL_SAM_CIGAR_CONSUMES_REF(op) )
+	    ref_pos += BL_SAM_CIGAR_OP_LEN(BL_SAM_CIGAR_OPS_AE(alignment, c));
+    }
+    if ( ref_pos > block_start )
+	bl_coverage_add_block(coverage, block_start, ref_pos - 1);
+    return BL_COVERAGE_OK;
+}
+
+
+/***************************************************************************
+ *  Name:
+ *      bl_coverage_add_block() - Add a covered interval to a read depth accumulator
+ *
+ *  Library:
+ *      #include <biolibc/coverage.h>
+ *      -lbiolibc -lxtend
+ *
+ *  Description:
+ *      Record one more read covering positions start through end on the
+ *      current chromosome, by incrementing the difference array at start
+ *      and decrementing it after end.  start must not precede the start
+ *      of the last alignment added.  This is used internally by
+ *      bl_coverage_add(3).
+ *
+ *  Arguments:
+ *      coverage    Pointer to a bl_coverage_t object
+ *      start       First covered position, 1-based
+ *      end         Last covered position, 1-based
+ *
+ *  See also:
+ *      bl_coverage_add(3), bl_coverage_reserve(3)
+ *
+ *  History:
+ *  Date        Name        Modification
+ *  2026-10-17  agent       Begin
+ ***************************************************************************/
+
+void    bl_coverage_add_block(bl_coverage_t *coverage, int64_t start,
+			      int64_t end)
+
+{
+    size_t  mask;
+
+    bl_coverage_reserve(coverage, end + 2 - coverage->flushed_pos);
+    mask = coverage->delta_array_size - 1;
+    ++coverage->deltas[start & mask];
+    --coverage->deltas[(end + 1) & mask];
+    if ( end + 2 > coverage->end_pos )
+	coverage->end_pos = end + 2;
+}
+
+
+/***************************************************************************
+ *  Name:
+ *      bl_coverage_reserve() - Grow the difference array of a read depth accumulator
+ *
+ *  Library:
+ *      #include <biolibc/coverage.h>
+ *      -lbiolibc -lxtend
+ *
+ *  Description:
+ *      Make sure the ring buffer of depth changes can hold span positions
+ *      from the first unwritten position, doubling its size as needed
+ *      and moving pending changes to their new slots.  This is used
+ *      internally by bl_coverage_add_block(3).
+ *
+ *  Arguments:
+ *      coverage    Pointer to a bl_coverage_t object
+ *      span        Number of positions needed
+ *
+ *  See also:
+ *      bl_coverage_add_block(3)
+ *
+ *  History:
+ *  Date        Name        Modification
+ *  2026-10-17  agent       Begin
+ ***************************************************************************/
+
+void    bl_coverage_reserve(bl_coverage_t *coverage, int64_t span)
+
+{
+    int32_t *deltas;
+    size_t  old_mask,
+	    new_size,
+	    new_mask;
+    int64_t pos;
+
+    if ( (size_t)span <= coverage->delta_array_size )
+	return;
+
+    for (new_size = coverage->delta_array_size; new_size < (size_t)span;
+	 new_size *= 2)
+	;
+    if ( (deltas = calloc(new_size, sizeof(*deltas))) == NULL )
+    {
+	fprintf(stderr, "bl_coverage_reserve(): Could not allocate deltas.\n");
+	exit(EX_UNAVAILABLE);
+    }
+    old_mask = coverage->delta_array_size - 1;
+    new_mask = new_size - 1;
+    for (pos = coverage->flushed_pos; pos < coverage->end_pos; ++pos)
+	deltas[pos & new_mask] = coverage->deltas[pos & old_mask];
+    free(coverage->deltas);
+    coverage->deltas = deltas;
+    coverage->delta_array_size = new_size;
+}
+
+
+/***************************************************************************
+ *  Name:
+ *      bl_coverage_flush() - Write completed depth runs
+ *
+ *  Library:
+ *      #include <biolibc/coverage.h>
+ *      -lbiolibc -lxtend
+ *
+ *  Description:
+ *      Sum the difference array of a bl_coverage_t object up to
+ *      position limit, writing each run of equal depth that ends before
+ *      limit.  Only positions where depth changes cost more than a
+ *      single test, and uncovered gaps past the last pending change are
+ *      skipped entirely.  This is used internally by bl_coverage_add(3)
+ *      and bl_coverage_finish(3).
+ *
+ *  Arguments:
+ *      coverage    Pointer to a bl_coverage_t object
+ *      limit       First position that may still change, 1-based
+ *
+ *  Returns:
+ *      BL_COVERAGE_OK on success
+ *      BL_COVERAGE_WRITE_FAILED if a run could not be written
+ *
+ *  See also:
+ *      bl_coverage_add(3), bl_coverage_write_run(3)
+ *
+ *  History:
+ *  Date        Name        Modification
+ *  2026-10-17  agent       Begin
+ ***************************************************************************/
+
+int     bl_coverage_flush(bl_coverage_t *coverage, int64_t limit)
+
+{
+    int32_t *delta;
+    size_t  mask = coverage->delta_array_size - 1;
+    int64_t pos,
+	    stop;
+    int     status;
+
+    stop = limit < coverage->end_pos ? limit : coverage->end_pos;
+    for (pos = coverage->flushed_pos; pos < stop; ++pos)
+    {
+	delta = &coverage->deltas[pos & mask];
+	if ( *delta != 0 )
+	{
+	    if ( coverage->run_depth > 0 )
+	    {
+		status = bl_coverage_write_run(coverage, coverage->run_start - 1,
+					       pos - 1, coverage->run_depth);
+		if ( status != BL_COVERAGE_OK )
+		    return status;
+	    }
+	    coverage->run_start = pos;
+	    coverage->run_depth += *delta;
+	    *delta = 0;
+	}
+    }
+    if ( limit > coverage->flushed_pos )
+	coverage->flushed_pos = limit;
+    return BL_COVERAGE_OK;
+}
+
+
+/***************************************************************************
+ *  Name:
+ *      bl_coverage_write_run() - Write one run of equal depth
+ *
+ *  Library:
+ *      #include <biolibc/coverage.h>
+ *      -lbiolibc -lxtend
+ *
+ *  Description:
+ *      Write a run of positions with equal depth on the current
+ *      chromosome of a bl_coverage_t object, in the format given to
+ *      bl_coverage_init(3).  This is used internally by
+ *      bl_coverage_flush(3).
+ *
+ *  Arguments:
+ *      coverage    Pointer to a bl_coverage_t object
+ *      start       First position of run, 0-based
+ *      end         End of run, exclusive
+ *      depth       Number of reads covering each position in the run
+ *
+ *  Returns:
+ *      BL_COVERAGE_OK on success
+ *      BL_COVERAGE_WRITE_FAILED otherwise
+ *
+ *  See also:
+ *      bl_coverage_init(3), bl_bed_write(3)
+ *
+ *  History:
+ *  Date        Name        Modification
+ *  2026-10-17  agent       Begin
+ ***************************************************************************/
+
+int     bl_coverage_write_run(bl_coverage_t *coverage, int64_t start,
+			      int64_t end, uint32_t depth)
+
+{
+    bl_coverage_run_t   run;
+
+    if ( coverage->format == BL_COVERAGE_FORMAT_BINARY )
+    {
+	run.start = start;
+	run.end = end;
+	run.chrom_index = coverage->chrom_index;
+	run.depth = depth;
+	if ( fwrite(&run, sizeof(run), 1, coverage->out_stream) != 1 )
+	    return BL_COVERAGE_WRITE_FAILED;
+    }
+    else
+    {
+	coverage->bed.chrom_start = start;
+	coverage->bed.chrom_end = end;
+	snprintf(coverage->bed.name, BL_BED_NAME_MAX_CHARS + 1, "%" PRIu32,
+		 depth);
+	if ( (bl_bed_write(&coverage->bed, coverage->out_stream,
+			   BL_BED_FIELD_NAME) != BL_WRITE_OK) ||
+	     ferror(coverage->out_stream) )
+	    return BL_COVERAGE_WRITE_FAILED;
+    }
+    return BL_COVERAGE_OK;
+}
+
+
+/***************************************************************************
+ *  Name:
+ *      bl_coverage_finish() - Write all remaining depth runs
+ *
+ *  Library:
+ *      #include <biolibc/coverage.h>
+ *      -lbiolibc -lxtend
+ *
+ *  Description:
+ *      Write all runs of the current chromosome of a bl_coverage_t
+ *      object.  Call this after the last alignment has been added.
+ *
+ *  Arguments:
+ *      coverage    Pointer to a bl_coverage_t object
+ *
+ *  Returns:
+ *      BL_COVERAGE_OK on success
+ *      BL_COVERAGE_WRITE_FAILED if a run could not be written
+ *
+ *  See also:
+ *      bl_coverage_add(3), bl_coverage_free(3)
+ *
+ *  History:
+ *  Date        Name        Modification
+ *  2026-10-17  agent       Begin
+ ***************************************************************************/
+
+int     bl_coverage_finish(bl_coverage_t *coverage)
+
+{
+    return bl_coverage_flush(coverage, coverage->end_pos);
+}
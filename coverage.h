@@ -0,0 +1,86 @@
+#ifndef _BIOLIBC_COVERAGE_H_
+#define _BIOLIBC_COVERAGE_H_
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+#ifndef _BIOLIBC_H_
+#include "biolibc.h"
+#endif
+
+#ifndef _BIOLIBC_SAM_H_
+#include "sam.h"
+#endif
+
+#ifndef _BIOLIBC_BED_H_
+#include "bed.h"
+#endif
+
+/*
+ *  Streaming read depth over sorted alignments.  Each aligned block adds
+ *  +1 at its first position and -1 after its last to a difference array,
+ *  and the running sum is emitted as runs of equal depth once no later
+ *  alignment can reach them.  The array is a ring buffer covering only
+ *  positions from the start of the newest alignment to the end of the
+ *  longest one still open, so memory is bounded by alignment span, not
+ *  chromosome length.
+ */
+
+#define BL_COVERAGE_FORMAT_BEDGRAPH 0   // Text, via bl_bed_write()
+#define BL_COVERAGE_FORMAT_BINARY   1   // bl_coverage_run_t records
+
+// Must be a power of 2
+#define BL_COVERAGE_DELTA_START_SIZE    1024
+
+#define BL_COVERAGE_OK              0
+#define BL_COVERAGE_UNSORTED        -1
+#define BL_COVERAGE_WRITE_FAILED    -2
+
+// Binary output record, in host byte order
+typedef struct
+{
+    int64_t     start,          // 0-based, as in bedGraph
+		end;            // Exclusive
+    int32_t     chrom_index;    // Order of appearance in input, from 0
+    uint32_t    depth;
+}   bl_coverage_run_t;
+
+typedef struct
+{
+    FILE        *out_stream;
+    int         format;
+    char        chrom[BL_SAM_RNAME_MAX_CHARS + 1];
+    int32_t     chrom_index;
+
+    // Ring buffer of depth changes, indexed by position & (size - 1)
+    int32_t     *deltas;
+    size_t      delta_array_size;
+    int64_t     flushed_pos,    // Positions before this have been emitted
+		end_pos;        // Positions from this on have no changes
+
+    // Run being extended
+    int64_t     run_start;
+    uint32_t    run_depth;
+    bl_bed_t    bed;            // Record for bedGraph output
+}   bl_coverage_t;
+
+#include "coverage-rvs.h"
+#include "coverage-accessors.h"
+#include "coverage-mutators.h"
+
+/* coverage.c */
+void bl_coverage_init(bl_coverage_t *coverage, FILE *out_stream, int format);
+void bl_coverage_free(bl_coverage_t *coverage);
+int bl_coverage_add(bl_coverage_t *coverage, bl_sam_t *alignment);
+void bl_coverage_add_block(bl_coverage_t *coverage, int64_t start, int64_t end);
+void bl_coverage_reserve(bl_coverage_t *coverage, int64_t span);
+int bl_coverage_flush(bl_coverage_t *coverage, int64_t limit);
+int bl_coverage_write_run(bl_coverage_t *coverage, int64_t start, int64_t end, uint32_t depth);
+int bl_coverage_finish(bl_coverage_t *coverage);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif // _BIOLIBC_COVERAGE_H_
@@ -0,0 +1,24 @@
+    
+/*
+ *  Generated by /usr/local/bin/auto-gen-get-set
+ *
+ *  Accessor macros.  Use these to access structure members from functions
+ *  outside the bl_fasta_index_t class.
+ *
+ *  These generated macros are not expected to be perfect.  Check and edit
+ *  as needed before adding to your code.
+ */
+
+#define BL_FASTA_INDEX_ARRAY_SIZE(ptr)  ((ptr)->array_size)
+#define BL_FASTA_INDEX_COUNT(ptr)       ((ptr)->count)
+#define BL_FASTA_INDEX_NAMES(ptr)       ((ptr)->names)
+#define BL_FASTA_INDEX_NAMES_AE(ptr,c)  ((ptr)->names[c])
+#define BL_FASTA_INDEX_LENGTHS(ptr)     ((ptr)->lengths)
+#define BL_FASTA_INDEX_LENGTHS_AE(ptr,c) ((ptr)->lengths[c])
+#define BL_FASTA_INDEX_OFFSETS(ptr)     ((ptr)->offsets)
+#define BL_FASTA_INDEX_OFFSETS_AE(ptr,c) ((ptr)->offsets[c])
+#define BL_FASTA_INDEX_LINE_BASES(ptr)  ((ptr)->line_bases)
+#define BL_FASTA_INDEX_LINE_BASES_AE(ptr,c) ((ptr)->line_bases[c])
+#define BL_FASTA_INDEX_LINE_BYTES(ptr)  ((ptr)->line_bytes)
+#define BL_FASTA_INDEX_LINE_BYTES_AE(ptr,c) ((ptr)->line_bytes[c])
+#define BL_FASTA_INDEX_FASTA_FD(ptr)    ((ptr)->fasta_fd)
@@ -0,0 +1,1019 @@
+/***************************************************************************
+ *  This file is automatically generated by gen-get-set.  Be sure to keep
+ *  track of any manual changes.
+ *
+ *  These generated functions are not expected to be perfect.  Check and
+ *  edit as needed before adding to your code.
+ ***************************************************************************/
+
+#include <string.h>
+#include <ctype.h>
+#include <stdbool.h>        // In case of bool
+#include <stdint.h>         // In case of int64_t, etc
+#include <xtend/string.h>   // strlcpy() on Linux
+#include "fasta-index.h"
+
+
+/***************************************************************************
+ *  Library:
+ *      #include <biolibc/fasta-index.h>
+ *      -lbiolibc -lxtend
+ *
+ *  Description:
+ *      Mutator for array_size member in a bl_fasta_index_t structure.
+ *      Use this function to set array_size in a bl_fasta_index_t object
+ *      from non-member functions.  This function performs a direct
+ *      assignment for scalar or pointer structure members.  If
+ *      array_size is a pointer, data previously pointed to should
+ *      be freed before calling this function to avoid memory
+ *      leaks.
+ *
+ *  Arguments:
+ *      bl_fasta_index_ptr Pointer to the structure to set
+ *      new_array_size  The new value for array_size
+ *
+ *  Returns:
+ *      BL_FASTA_INDEX_DATA_OK if the new value is acceptable and assigned
+ *      BL_FASTA_INDEX_DATA_OUT_OF_RANGE otherwise
+ *
+ *  Examples:
+ *      bl_fasta_index_t bl_fasta_index;
+ *      size_t          new_array_size;
+ *
+ *      if ( bl_fasta_index_set_array_size(&bl_fasta_index, new_array_size)
+ *              == BL_FASTA_INDEX_DATA_OK )
+ *      {
+ *      }
+ *
+ *  See also:
+ *      (3)
+ *
+ *  History: 
+ *  Date        Name        Modification
+ *  2026-10-17  gen-get-set Auto-generated from fasta-index.h
+ ***************************************************************************/
+
+int     bl_fasta_index_set_array_size(
+	    bl_fasta_index_t *bl_fasta_index_ptr,
+	    size_t new_array_size
+	)
+
+{
+    if ( false )
+	return BL_FASTA_INDEX_DATA_OUT_OF_RANGE;
+    else
+    {
+	bl_fasta_index_ptr->array_size = new_array_size;
+	return BL_FASTA_INDEX_DATA_OK;
+    }
+}
+
+
+/***************************************************************************
+ *  Library:
+ *      #include <biolibc/fasta-index.h>
+ *      -lbiolibc -lxtend
+ *
+ *  Description:
+ *      Mutator for count member in a bl_fasta_index_t structure.
+ *      Use this function to set count in a bl_fasta_index_t object
+ *      from non-member functions.  This function performs a direct
+ *      assignment for scalar or pointer structure members.  If
+ *      count is a pointer, data previously pointed to should
+ *      be freed before calling this function to avoid memory
+ *      leaks.
+ *
+ *  Arguments:
+ *      bl_fasta_index_ptr Pointer to the structure to set
+ *      new_count       The new value for count
+ *
+ *  Returns:
+ *      BL_FASTA_INDEX_DATA_OK if the new value is acceptable and assigned
+ *      BL_FASTA_INDEX_DATA_OUT_OF_RANGE otherwise
+ *
+ *  Examples:
+ *      bl_fasta_index_t bl_fasta_index;
+ *      size_t          new_count;
+ *
+ *      if ( bl_fasta_index_set_count(&bl_fasta_index, new_count)
+ *              == BL_FASTA_INDEX_DATA_OK )
+ *      {
+ *      }
+ *
+ *  See also:
+ *      (3)
+ *
+ *  History: 
+ *  Date        Name        Modification
+ *  2026-10-17  gen-get-set Auto-generated from fasta-index.h
+ ***************************************************************************/
+
+int     bl_fasta_index_set_count(
+	    bl_fasta_index_t *bl_fasta_index_ptr,
+	    size_t new_count
+	)
+
+{
+    if ( false )
+	return BL_FASTA_INDEX_DATA_OUT_OF_RANGE;
+    else
+    {
+	bl_fasta_index_ptr->count = new_count;
+	return BL_FASTA_INDEX_DATA_OK;
+    }
+}
+
+
+/***************************************************************************
+ *  Library:
+ *      #include <biolibc/fasta-index.h>
+ *      -lbiolibc -lxtend
+ *
+ *  Description:
+ *      Mutator for names member in a bl_fasta_index_t structure.
+ *      Use this function to set names in a bl_fasta_index_t object
+ *      from non-member functions.  This function performs a direct
+ *      assignment for scalar or pointer structure members.  If
+ *      names is a pointer, data previously pointed to should
+ *      be freed before calling this function to avoid memory
+ *      leaks.
+ *
+ *  Arguments:
+ *      bl_fasta_index_ptr Pointer to the structure to set
+ *      new_names       The new value for names
+ *
+ *  Returns:
+ *      BL_FASTA_INDEX_DATA_OK if the new value is acceptable and assigned
+ *      BL_FASTA_INDEX_DATA_OUT_OF_RANGE otherwise
+ *
+ *  Examples:
+ *      bl_fasta_index_t bl_fasta_index;
+ *      char **         new_names;
+ *
+ *      if ( bl_fasta_index_set_names(&bl_fasta_index, new_names)
+ *              == BL_FASTA_INDEX_DATA_OK )
+ *      {
+ *      }
+ *
+ *  See also:
+ *      (3)
+ *
+ *  History: 
+ *  Date        Name        Modification
+ *  2026-10-17  gen-get-set Auto-generated from fasta-index.h
+ ***************************************************************************/
+
+int     bl_fasta_index_set_names(
+	    bl_fasta_index_t *bl_fasta_index_ptr,
+	    char **new_names
+	)
+
+{
+    if ( new_names == NULL )
+	return BL_FASTA_INDEX_DATA_OUT_OF_RANGE;
+    else
+    {
+	bl_fasta_index_ptr->names = new_names;
+	return BL_FASTA_INDEX_DATA_OK;
+    }
+}
+
+
+/***************************************************************************
+ *  Library:
+ *      #include <biolibc/fasta-index.h>
+ *      -lbiolibc -lxtend
+ *
+ *  Description:
+ *      Mutator for an array element of names member in a bl_fasta_index_t
+ *      structure. Use this function to set bl_fasta_index_ptr->names[c]
+ *      in a bl_fasta_index_t object from non-member functions.
+ *
+ *  Arguments:
+ *      bl_fasta_index_ptr Pointer to the structure to set
+ *      c               Subscript to the names array
+ *      new_names_element The new value for names[c]
+ *
+ *  Returns:
+ *      BL_FASTA_INDEX_DATA_OK if the new value is acceptable and assigned
+ *      BL_FASTA_INDEX_DATA_OUT_OF_RANGE otherwise
+ *
+ *  Examples:
+ *      bl_fasta_index_t bl_fasta_index;
+ *      size_t          c;
+ *      char *          new_names_element;
+ *
+ *      if ( bl_fasta_index_set_names_ae(&bl_fasta_index, c, new_names_element)
+ *              == BL_FASTA_INDEX_DATA_OK )
+ *      {
+ *      }
+ *
+ *  See also:
+ *      BL_FASTA_INDEX_SET_NAMES_AE(3)
+ *
+ *  History: 
+ *  Date        Name        Modification
+ *  2026-10-17  gen-get-set Auto-generated from fasta-index.h
+ ***************************************************************************/
+
+int     bl_fasta_index_set_names_ae(
+	    bl_fasta_index_t *bl_fasta_index_ptr,
+	    size_t c,
+	    char *new_names_element
+	)
+
+{
+    if ( false )
+	return BL_FASTA_INDEX_DATA_OUT_OF_RANGE;
+    else
+    {
+	bl_fasta_index_ptr->names[c] = new_names_element;
+	return BL_FASTA_INDEX_DATA_OK;
+    }
+}
+
+
+/***************************************************************************
+ *  Library:
+ *      #include <biolibc/fasta-index.h>
+ *      -lbiolibc -lxtend
+ *
+ *  Description:
+ *      Mutator for names member in a bl_fasta_index_t structure.
+ *      Use this function to set names in a bl_fasta_index_t object
+ *      from non-member functions.  This function copies the array pointed to
+ *      by new_names to bl_fasta_index_ptr->names.
+ *
+ *  Arguments:
+ *      bl_fasta_index_ptr Pointer to the structure to set
+ *      new_names       The new value for names
+ *      array_size      Size of the names array.
+ *
+ *  Returns:
+ *      BL_FASTA_INDEX_DATA_OK if the new value is acceptable and assigned
+ *      BL_FASTA_INDEX_DATA_OUT_OF_RANGE otherwise
+ *
+ *  Examples:
+ *      bl_fasta_index_t bl_fasta_index;
+ *      char **         new_names;
+ *      size_t          array_size;
+ *
+ *      if ( bl_fasta_index_set_names_cpy(&bl_fasta_index, new_names, array_size)
+ *              == BL_FASTA_INDEX_DATA_OK )
+ *      {
+ *      }
+ *
+ *  See also:
+ *      BL_FASTA_INDEX_SET_NAMES(3)
+ *
+ *  History: 
+ *  Date        Name        Modification
+ *  2026-10-17  gen-get-set Auto-generated from fasta-index.h
+ ***************************************************************************/
+
+int     bl_fasta_index_set_names_cpy(
+	    bl_fasta_index_t *bl_fasta_index_ptr,
+	    char **new_names,
+	    size_t array_size
+	)
+
+{
+    if ( new_names == NULL )
+	return BL_FASTA_INDEX_DATA_OUT_OF_RANGE;
+    else
+    {
+	size_t  c;
+	
+	// FIXME: Assuming all elements should be copied
+	for (c = 0; c < array_size; ++c)
+	    bl_fasta_index_ptr->names[c] = new_names[c];
+	return BL_FASTA_INDEX_DATA_OK;
+    }
+}
+
+
+/***************************************************************************
+ *  Library:
+ *      #include <biolibc/fasta-index.h>
+ *      -lbiolibc -lxtend
+ *
+ *  Description:
+ *      Mutator for lengths member in a bl_fasta_index_t structure.
+ *      Use this function to set lengths in a bl_fasta_index_t object
+ *      from non-member functions.  This function performs a direct
+ *      assignment for scalar or pointer structure members.  If
+ *      lengths is a pointer, data previously pointed to should
+ *      be freed before calling this function to avoid memory
+ *      leaks.
+ *
+ *  Arguments:
+ *      bl_fasta_index_ptr Pointer to the structure to set
+ *      new_lengths     The new value for lengths
+ *
+ *  Returns:
+ *      BL_FASTA_INDEX_DATA_OK if the new value is acceptable and assigned
+ *      BL_FASTA_INDEX_DATA_OUT_OF_RANGE otherwise
+ *
+ *  Examples:
+ *      bl_fasta_index_t bl_fasta_index;
+ *      int64_t *       new_lengths;
+ *
+ *      if ( bl_fasta_index_set_lengths(&bl_fasta_index, new_lengths)
+ *              == BL_FASTA_INDEX_DATA_OK )
+ *      {
+ *      }
+ *
+ *  See also:
+ *      (3)
+ *
+ *  History: 
+ *  Date        Name        Modification
+ *  2026-10-17  gen-get-set Auto-generated from fasta-index.h
+ ***************************************************************************/
+
+int     bl_fasta_index_set_lengths(
+	    bl_fasta_index_t *bl_fasta_index_ptr,
+	    int64_t *new_lengths
+	)
+
+{
+    if ( new_lengths == NULL )
+	return BL_FASTA_INDEX_DATA_OUT_OF_RANGE;
+    else
+    {
+	bl_fasta_index_ptr->lengths = new_lengths;
+	return BL_FASTA_INDEX_DATA_OK;
+    }
+}
+
+
+/***************************************************************************
+ *  Library:
+ *      #include <biolibc/fasta-index.h>
+ *      -lbiolibc -lxtend
+ *
+ *  Description:
+ *      Mutator for an array element of lengths member in a bl_fasta_index_t
+ *      structure. Use this function to set bl_fasta_index_ptr->lengths[c]
+ *      in a bl_fasta_index_t object from non-member functions.
+ *
+ *  Arguments:
+ *      bl_fasta_index_ptr Pointer to the structure to set
+ *      c               Subscript to the lengths array
+ *      new_lengths_element The new value for lengths[c]
+ *
+ *  Returns:
+ *      BL_FASTA_INDEX_DATA_OK if the new value is acceptable and assigned
+ *      BL_FASTA_INDEX_DATA_OUT_OF_RANGE otherwise
+ *
+ *  Examples:
+ *      bl_fasta_index_t bl_fasta_index;
+ *      size_t          c;
+ *      int64_t         new_lengths_element;
+ *
+ *      if ( bl_fasta_index_set_lengths_ae(&bl_fasta_index, c, new_lengths_element)
+ *              == BL_FASTA_INDEX_DATA_OK )
+ *      {
+ *      }
+ *
+ *  See also:
+ *      BL_FASTA_INDEX_SET_LENGTHS_AE(3)
+ *
+ *  History: 
+ *  Date        Name        Modification
+ *  2026-10-17  gen-get-set Auto-generated from fasta-index.h
+ ***************************************************************************/
+
+int     bl_fasta_index_set_lengths_ae(
+	    bl_fasta_index_t *bl_fasta_index_ptr,
+	    size_t c,
+	    int64_t new_lengths_element
+	)
+
+{
+    if ( false )
+	return BL_FASTA_INDEX_DATA_OUT_OF_RANGE;
+    else
+    {
+	bl_fasta_index_ptr->lengths[c] = new_lengths_element;
+	return BL_FASTA_INDEX_DATA_OK;
+    }
+}
+
+
+/***************************************************************************
+ *  Library:
+ *      #include <biolibc/fasta-index.h>
+ *      -lbiolibc -lxtend
+ *
+ *  Description:
+ *      Mutator for lengths member in a bl_fasta_index_t structure.
+ *      Use this function to set lengths in a bl_fasta_index_t object
+ *      from non-member functions.  This function copies the array pointed to
+ *      by new_lengths to bl_fasta_index_ptr->lengths.
+ *
+ *  Arguments:
+ *      bl_fasta_index_ptr Pointer to the structure to set
+ *      new_lengths     The new value for lengths
+ *      array_size      Size of the lengths array.
+ *
+ *  Returns:
+ *      BL_FASTA_INDEX_DATA_OK if the new value is acceptable and assigned
+ *      BL_FASTA_INDEX_DATA_OUT_OF_RANGE otherwise
+ *
+ *  Examples:
+ *      bl_fasta_index_t bl_fasta_index;
+ *      int64_t *       new_lengths;
+ *      size_t          array_size;
+ *
+ *      if ( bl_fasta_index_set_lengths_cpy(&bl_fasta_index, new_lengths, array_size)
+ *              == BL_FASTA_INDEX_DATA_OK )
+ *      {
+ *      }
+ *
+ *  See also:
+ *      BL_FASTA_INDEX_SET_LENGTHS(3)
+ *
+ *  History: 
+ *  Date        Name        Modification
+ *  2026-10-17  gen-get-set Auto-generated from fasta-index.h
+ ***************************************************************************/
+
+int     bl_fasta_index_set_lengths_cpy(
+	    bl_fasta_index_t *bl_fasta_index_ptr,
+	    int64_t *new_lengths,
+	    size_t array_size
+	)
+
+{
+    if ( new_lengths == NULL )
+	return BL_FASTA_INDEX_DATA_OUT_OF_RANGE;
+    else
+    {
+	size_t  c;
+	
+	// FIXME: Assuming all elements should be copied
+	for (c = 0; c < array_size; ++c)
+	    bl_fasta_index_ptr->lengths[c] = new_lengths[c];
+	return BL_FASTA_INDEX_DATA_OK;
+    }
+}
+
+
+/***************************************************************************
+ *  Library:
+ *      #include <biolibc/fasta-index.h>
+ *      -lbiolibc -lxtend
+ *
+ *  Description:
+ *      Mutator for offsets member in a bl_fasta_index_t structure.
+ *      Use this function to set offsets in a bl_fasta_index_t object
+ *      from non-member functions.  This function performs a direct
+ *      assignment for scalar or pointer structure members.  If
+ *      offsets is a pointer, data previously pointed to should
+ *      be freed before calling this function to avoid memory
+ *      leaks.
+ *
+ *  Arguments:
+ *      bl_fasta_index_ptr Pointer to the structure to set
+ *      new_offsets     The new value for offsets
+ *
+ *  Returns:
+ *      BL_FASTA_INDEX_DATA_OK if the new value is acceptable and assigned
+ *      BL_FASTA_INDEX_DATA_OUT_OF_RANGE otherwise
+ *
+ *  Examples:
+ *      bl_fasta_index_t bl_fasta_index;
+ *      int64_t *       new_offsets;
+ *
+ *      if ( bl_fasta_index_set_offsets(&bl_fasta_index, new_offsets)
+ *              == BL_FASTA_INDEX_DATA_OK )
+ *      {
+ *      }
+ *
+ *  See also:
+ *      (3)
+ *
+ *  History: 
+ *  Date        Name        Modification
+ *  2026-10-17  gen-get-set Auto-generated from fasta-index.h
+ ***************************************************************************/
+
+int     bl_fasta_index_set_offsets(
+	    bl_fasta_index_t *bl_fasta_index_ptr,
+	    int64_t *new_offsets
+	)
+
+{
+    if ( new_offsets == NULL )
+	return BL_FASTA_INDEX_DATA_OUT_OF_RANGE;
+    else
+    {
+	bl_fasta_index_ptr->offsets = new_offsets;
+	return BL_FASTA_INDEX_DATA_OK;
+    }
+}
+
+
+/***************************************************************************
+ *  Library:
+ *      #include <biolibc/fasta-index.h>
+ *      -lbiolibc -lxtend
+ *
+ *  Description:
+ *      Mutator for an array element of offsets member in a bl_fasta_index_t
+ *      structure. Use this function to set bl_fasta_index_ptr->offsets[c]
+ *      in a bl_fasta_index_t object from non-member functions.
+ *
+ *  Arguments:
+ *      bl_fasta_index_ptr Pointer to the structure to set
+ *      c               Subscript to the offsets array
+ *      new_offsets_element The new value for offsets[c]
+ *
+ *  Returns:
+ *      BL_FASTA_INDEX_DATA_OK if the new value is acceptable and assigned
+ *      BL_FASTA_INDEX_DATA_OUT_OF_RANGE otherwise
+ *
+ *  Examples:
+ *      bl_fasta_index_t bl_fasta_index;
+ *      size_t          c;
+ *      int64_t         new_offsets_element;
+ *
+ *      if ( bl_fasta_index_set_offsets_ae(&bl_fasta_index, c, new_offsets_element)
+ *              == BL_FASTA_INDEX_DATA_OK )
+ *      {
+ *      }
+ *
+ *  See also:
+ *      BL_FASTA_INDEX_SET_OFFSETS_AE(3)
+ *
+ *  History: 
+ *  Date        Name        Modification
+ *  2026-10-17  gen-get-set Auto-generated from fasta-index.h
+ ***************************************************************************/
+
+int     bl_fasta_index_set_offsets_ae(
+	    bl_fasta_index_t *bl_fasta_index_ptr,
+	    size_t c,
+	    int64_t new_offsets_element
+	)
+
+{
+    if ( false )
+	return BL_FASTA_INDEX_DATA_OUT_OF_RANGE;
+    else
+    {
+	bl_fasta_index_ptr->offsets[c] = new_offsets_element;
+	return BL_FASTA_INDEX_DATA_OK;
+    }
+}
+
+
+/***************************************************************************
+ *  Library:
+ *      #include <biolibc/fasta-index.h>
+ *      -lbiolibc -lxtend
+ *
+ *  Description:
+ *      Mutator for offsets member in a bl_fasta_index_t structure.
+ *      Use this function to set offsets in a bl_fasta_index_t object
+ *      from non-member functions.  This function copies the array pointed to
+ *      by new_offsets to bl_fasta_index_ptr->offsets.
+ *
+ *  Arguments:
+ *      bl_fasta_index_ptr Pointer to the structure to set
+ *      new_offsets     The new value for offsets
+ *      array_size      Size of the offsets array.
+ *
+ *  Returns:
+ *      BL_FASTA_INDEX_DATA_OK if the new value is acceptable and assigned
+ *      BL_FASTA_INDEX_DATA_OUT_OF_RANGE otherwise
+ *
+ *  Examples:
+ *      bl_fasta_index_t bl_fasta_index;
+ *      int64_t *       new_offsets;
+ *      size_t          array_size;
+ *
+ *      if ( bl_fasta_index_set_offsets_cpy(&bl_fasta_index, new_offsets, array_size)
+ *              == BL_FASTA_INDEX_DATA_OK )
+ *      {
+ *      }
+ *
+ *  See also:
+ *      BL_FASTA_INDEX_SET_OFFSETS(3)
+ *
+ *  History: 
+ *  Date        Name        Modification
+ *  2026-10-17  gen-get-set Auto-generated from fasta-index.h
+ ***************************************************************************/
+
+int     bl_fasta_index_set_offsets_cpy(
+	    bl_fasta_index_t *bl_fasta_index_ptr,
+	    int64_t *new_offsets,
+	    size_t array_size
+	)
+
+{
+    if ( new_offsets == NULL )
+	return BL_FASTA_INDEX_DATA_OUT_OF_RANGE;
+    else
+    {
+	size_t  c;
+	
+	// FIXME: Assuming all elements should be copied
+	for (c = 0; c < array_size; ++c)
+	    bl_fasta_index_ptr->offsets[c] = new_offsets[c];
+	return BL_FASTA_INDEX_DATA_OK;
+    }
+}
+
+
+/***************************************************************************
+ *  Library:
+ *      #include <biolibc/fasta-index.h>
+ *      -lbiolibc -lxtend
+ *
+ *  Description:
+ *      Mutator for line_bases member in a bl_fasta_index_t structure.
+ *      Use this function to set line_bases in a bl_fasta_index_t object
+ *      from non-member functions.  This function performs a direct
+ *      assignment for scalar or pointer structure members.  If
+ *      line_bases is a pointer, data previously pointed to should
+ *      be freed before calling this function to avoid memory
+ *      leaks.
+ *
+ *  Arguments:
+ *      bl_fasta_index_ptr Pointer to the structure to set
+ *      new_line_bases  The new value for line_bases
+ *
+ *  Returns:
+ *      BL_FASTA_INDEX_DATA_OK if the new value is acceptable and assigned
+ *      BL_FASTA_INDEX_DATA_OUT_OF_RANGE otherwise
+ *
+ *  Examples:
+ *      bl_fasta_index_t bl_fasta_index;
+ *      int64_t *       new_line_bases;
+ *
+ *      if ( bl_fasta_index_set_line_bases(&bl_fasta_index, new_line_bases)
+ *              == BL_FASTA_INDEX_DATA_OK )
+ *      {
+ *      }
+ *
+ *  See also:
+ *      (3)
+ *
+ *  History: 
+ *  Date        Name        Modification
+ *  2026-10-17  gen-get-set Auto-generated from fasta-index.h
+ ***************************************************************************/
+
+int     bl_fasta_index_set_line_bases(
+	    bl_fasta_index_t *bl_fasta_index_ptr,
+	    int64_t *new_line_bases
+	)
+
+{
+    if ( new_line_bases == NULL )
+	return BL_FASTA_INDEX_DATA_OUT_OF_RANGE;
+    else
+    {
+	bl_fasta_index_ptr->line_bases = new_line_bases;
+	return BL_FASTA_INDEX_DATA_OK;
+    }
+}
+
+
+/***************************************************************************
+ *  Library:
+ *      #include <biolibc/fasta-index.h>
+ *      -lbiolibc -lxtend
+ *
+ *  Description:
+ *      Mutator for an array element of line_bases member in a bl_fasta_index_t
+ *      structure. Use this function to set bl_fasta_index_ptr->line_bases[c]
+ *      in a bl_fasta_index_t object from non-member functions.
+ *
+ *  Arguments:
+ *      bl_fasta_index_ptr Pointer to the structure to set
+ *      c               Subscript to the line_bases array
+ *      new_line_bases_element The new value for line_bases[c]
+ *
+ *  Returns:
+ *      BL_FASTA_INDEX_DATA_OK if the new value is acceptable and assigned
+ *      BL_FASTA_INDEX_DATA_OUT_OF_RANGE otherwise
+ *
+ *  Examples:
+ *      bl_fasta_index_t bl_fasta_index;
+ *      size_t          c;
+ *      int64_t         new_line_bases_element;
+ *
+ *      if ( bl_fasta_index_set_line_bases_ae(&bl_fasta_index, c, new_line_bases_element)
+ *              == BL_FASTA_INDEX_DATA_OK )
+ *      {
+ *      }
+ *
+ *  See also:
+ *      BL_FASTA_INDEX_SET_LINE_BASES_AE(3)
+ *
+ *  History: 
+ *  Date        Name        Modification
+ *  2026-10-17  gen-get-set Auto-generated from fasta-index.h
+ ***************************************************************************/
+
+int     bl_fasta_index_set_line_bases_ae(
+	    bl_fasta_index_t *bl_fasta_index_ptr,
+	    size_t c,
+	    int64_t new_line_bases_element
+	)
+
+{
+    if ( false )
+	return BL_FASTA_INDEX_DATA_OUT_OF_RANGE;
+    else
+    {
+	bl_fasta_index_ptr->line_bases[c] = new_line_bases_element;
+	return BL_FASTA_INDEX_DATA_OK;
+    }
+}
+
+
+/***************************************************************************
+ *  Library:
+ *      #include <biolibc/fasta-index.h>
+ *      -lbiolibc -lxtend
+ *
+ *  Description:
+ *      Mutator for line_bases member in a bl_fasta_index_t structure.
+ *      Use this function to set line_bases in a bl_fasta_index_t object
+ *      from non-member functions.  This function copies the array pointed to
+ *      by new_line_bases to bl_fasta_index_ptr->line_bases.
+ *
+ *  Arguments:
+ *      bl_fasta_index_ptr Pointer to the structure to set
+ *      new_line_bases  The new value for line_bases
+ *      array_size      Size of the line_bases array.
+ *
+ *  Returns:
+ *      BL_FASTA_INDEX_DATA_OK if the new value is acceptable and assigned
+ *      BL_FASTA_INDEX_DATA_OUT_OF_RANGE otherwise
+ *
+ *  Examples:
+ *      bl_fasta_index_t bl_fasta_index;
+ *      int64_t *       new_line_bases;
+ *      size_t          array_size;
+ *
+ *      if ( bl_fasta_index_set_line_bases_cpy(&bl_fasta_index, new_line_bases, array_size)
+ *              == BL_FASTA_INDEX_DATA_OK )
+ *      {
+ *      }
+ *
+ *  See also:
+ *      BL_FASTA_INDEX_SET_LINE_BASES(3)
+ *
+ *  History: 
+ *  Date        Name        Modification
+ *  2026-10-17  gen-get-set Auto-generated from fasta-index.h
+ ***************************************************************************/
+
+int     bl_fasta_index_set_line_bases_cpy(
+	    bl_fasta_index_t *bl_fasta_index_ptr,
+	    int64_t *new_line_bases,
+	    size_t array_size
+	)
+
+{
+    if ( new_line_bases == NULL )
+	return BL_FASTA_INDEX_DATA_OUT_OF_RANGE;
+    else
+    {
+	size_t  c;
+	
+	// FIXME: Assuming all elements should be copied
+	for (c = 0; c < array_size; ++c)
+	    bl_fasta_index_ptr->line_bases[c] = new_line_bases[c];
+	return BL_FASTA_INDEX_DATA_OK;
+    }
+}
+
+
+/***************************************************************************
+ *  Library:
+ *      #include <biolibc/fasta-index.h>
+ *      -lbiolibc -lxtend
+ *
+ *  Description:
+ *      Mutator for line_bytes member in a bl_fasta_index_t structure.
+ *      Use this function to set line_bytes in a bl_fasta_index_t object
+ *      from non-member functions.  This function performs a direct
+ *      assignment for scalar or pointer structure members.  If
+ *      line_bytes is a pointer, data previously pointed to should
+ *      be freed before calling this function to avoid memory
+ *      leaks.
+ *
+ *  Arguments:
+ *      bl_fasta_index_ptr Pointer to the structure to set
+ *      new_line_bytes  The new value for line_bytes
+ *
+ *  Returns:
+ *      BL_FASTA_INDEX_DATA_OK if the new value is acceptable and assigned
+ *      BL_FASTA_INDEX_DATA_OUT_OF_RANGE otherwise
+ *
+ *  Examples:
+ *      bl_fasta_index_t bl_fasta_index;
+ *      int64_t *       new_line_bytes;
+ *
+ *      if ( bl_fasta_index_set_line_bytes(&bl_fasta_index, new_line_bytes)
+ *              == BL_FASTA_INDEX_DATA_OK )
+ *      {
+ *      }
+ *
+ *  See also:
+ *      (3)
+ *
+ *  History: 
+ *  Date        Name        Modification
+ *  2026-10-17  gen-get-set Auto-generated from fasta-index.h
+ ***************************************************************************/
+
+int     bl_fasta_index_set_line_bytes(
+	    bl_fasta_index_t *bl_fasta_index_ptr,
+	    int64_t *new_line_bytes
+	)
+
+{
+    if ( new_line_bytes == NULL )
+	return BL_FASTA_INDEX_DATA_OUT_OF_RANGE;
+    else
+    {
+	bl_fasta_index_ptr->line_bytes = new_line_bytes;
+	return BL_FASTA_INDEX_DATA_OK;
+    }
+}
+
+
+/***************************************************************************
+ *  Library:
+ *      #include <biolibc/fasta-index.h>
+ *      -lbiolibc -lxtend
+ *
+ *  Description:
+ *      Mutator for an array element of line_bytes member in a bl_fasta_index_t
+ *      structure. Use this function to set bl_fasta_index_ptr->line_bytes[c]
+ *      in a bl_fasta_index_t object from non-member functions.
+ *
+ *  Arguments:
+ *      bl_fasta_index_ptr Pointer to the structure to set
+ *      c               Subscript to the line_bytes array
+ *      new_line_bytes_element The new value for line_bytes[c]
+ *
+ *  Returns:
+ *      BL_FASTA_INDEX_DATA_OK if the new value is acceptable and assigned
+ *      BL_FASTA_INDEX_DATA_OUT_OF_RANGE otherwise
+ *
+ *  Examples:
+ *      bl_fasta_index_t bl_fasta_index;
+ *      size_t          c;
+ *      int64_t         new_line_bytes_element;
+ *
+ *      if ( bl_fasta_index_set_line_bytes_ae(&bl_fasta_index, c, new_line_bytes_element)
+ *              == BL_FASTA_INDEX_DATA_OK )
+ *      {
+ *      }
+ *
+ *  See also:
+ *      BL_FASTA_INDEX_SET_LINE_BYTES_AE(3)
+ *
+ *  History: 
+ *  Date        Name        Modification
+ *  2026-10-17  gen-get-set Auto-generated from fasta-index.h
+ ***************************************************************************/
+
+int     bl_fasta_index_set_line_bytes_ae(
+	    bl_fasta_index_t *bl_fasta_index_ptr,
+	    size_t c,
+	    int64_t new_line_bytes_element
+	)
+
+{
+    if ( false )
+	return BL_FASTA_INDEX_DATA_OUT_OF_RANGE;
+    else
+    {
+	bl_fasta_index_ptr->line_bytes[c] = new_line_bytes_element;
+	return BL_FASTA_INDEX_DATA_OK;
+    }
+}
+
+
+/***************************************************************************
+ *  Library:
+ *      #include <biolibc/fasta-index.h>
+ *      -lbiolibc -lxtend
+ *
+ *  Description:
+ *      Mutator for line_bytes member in a bl_fasta_index_t structure.
+ *      Use this function to set line_bytes in a bl_fasta_index_t object
+ *      from non-member functions.  This function copies the array pointed to
+ *      by new_line_bytes to bl_fasta_index_ptr->line_bytes.
+ *
+ *  Arguments:
+ *      bl_fasta_index_ptr Pointer to the structure to set
+ *      new_line_bytes  The new value for line_bytes
+ *      array_size      Size of the line_bytes array.
+ *
+ *  Returns:
+ *      BL_FASTA_INDEX_DATA_OK if the new value is acceptable and assigned
+ *      BL_FASTA_INDEX_DATA_OUT_OF_RANGE otherwise
+ *
+ *  Examples:
+ *      bl_fasta_index_t bl_fasta_index;
+ *      int64_t *       new_line_bytes;
+ *      size_t          array_size;
+ *
+ *      if ( bl_fasta_index_set_line_bytes_cpy(&bl_fasta_index, new_line_bytes, array_size)
+ *              == BL_FASTA_INDEX_DATA_OK )
+ *      {
+ *      }
+ *
+ *  See also:
+ *      BL_FASTA_INDEX_SET_LINE_BYTES(3)
+ *
+ *  History: 
+ *  Date        Name        Modification
+ *  2026-10-17  gen-get-set Auto-generated from fasta-index.h
+ ***************************************************************************/
+
+int     bl_fasta_index_set_line_bytes_cpy(
+	    bl_fasta_index_t *bl_fasta_index_ptr,
+	    int64_t *new_line_bytes,
+	    size_t array_size
+	)
+
+{
+    if ( new_line_bytes == NULL )
+	return BL_FASTA_INDEX_DATA_OUT_OF_RANGE;
+    else
+    {
+	size_t  c;
+	
+	// FIXME: Assuming all elements should be copied
+	for (c = 0; c < array_size; ++c)
+	    bl_fasta_index_ptr->line_bytes[c] = new_line_bytes[c];
+	return BL_FASTA_INDEX_DATA_OK;
+    }
+}
+
+
+/***************************************************************************
+ *  Library:
+ *      #include <biolibc/fasta-index.h>
+ *      -lbiolibc -lxtend
+ *
+ *  Description:
+ *      Mutator for fasta_fd member in a bl_fasta_index_t structure.
+ *      Use this function to set fasta_fd in a bl_fasta_index_t object
+ *      from non-member functions.  This function performs a direct
+ *      assignment for scalar or pointer structure members.  If
+ *      fasta_fd is a pointer, data previously pointed to should
+ *      be freed before calling this function to avoid memory
+ *      leaks.
+ *
+ *  Arguments:
+ *      bl_fasta_index_ptr Pointer to the structure to set
+ *      new_fasta_fd    The new value for fasta_fd
+ *
+ *  Returns:
+ *      BL_FASTA_INDEX_DATA_OK if the new value is acceptable and assigned
+ *      BL_FASTA_INDEX_DATA_OUT_OF_RANGE otherwise
+ *
+ *  Examples:
+ *      bl_fasta_index_t bl_fasta_index;
+ *      int             new_fasta_fd;
+ *
+ *      if ( bl_fasta_index_set_fasta_fd(&bl_fasta_index, new_fasta_fd)
+ *              == BL_FASTA_INDEX_DATA_OK )
+ *      {
+ *      }
+ *
+ *  See also:
+ *      (3)
+ *
+ *  History: 
+ *  Date        Name        Modification
+ *  2026-10-17  gen-get-set Auto-generated from fasta-index.h
+ ***************************************************************************/
+
+int     bl_fasta_index_set_fasta_fd(
+	    bl_fasta_index_t *bl_fasta_index_ptr,
+	    int new_fasta_fd
+	)
+
+{
+    if ( false )
+	return BL_FASTA_INDEX_DATA_OUT_OF_RANGE;
+    else
+    {
+	bl_fasta_index_ptr->fasta_fd = new_fasta_fd;
+	return BL_FASTA_INDEX_DATA_OK;
+    }
+}
@@ -0,0 +1,34 @@
+
+/*
+ *  Generated by /usr/local/bin/auto-gen-get-set
+ *
+ *  Mutator functions for setting with no sanity checking.  Use these to
+ *  set structure members from functions outside the bl_fasta_index_t
+ *  class.  These macros perform no data validation.  Hence, they achieve
+ *  maximum performance where data are guaranteed correct by other means.
+ *  Use the mutator functions (same name as the macro, but lower case)
+ *  for more robust code with a small performance penalty.
+ *
+ *  These generated macros are not expected to be perfect.  Check and edit
+ *  as needed before adding to your code.
+ */
+
+/* temp-fasta-index-mutators.c */
+int bl_fasta_index_set_array_size(bl_fasta_index_t *bl_fasta_index_ptr, size_t new_array_size);
+int bl_fasta_index_set_count(bl_fasta_index_t *bl_fasta_index_ptr, size_t new_count);
+int bl_fasta_index_set_names(bl_fasta_index_t *bl_fasta_index_ptr, char **new_names);
+int bl_fasta_index_set_names_ae(bl_fasta_index_t *bl_fasta_index_ptr, size_t c, char *new_names_element);
+int bl_fasta_index_set_names_cpy(bl_fasta_index_t *bl_fasta_index_ptr, char **new_names, size_t array_size);
+int bl_fasta_index_set_lengths(bl_fasta_index_t *bl_fasta_index_ptr, int64_t *new_lengths);
+int bl_fasta_index_set_lengths_ae(bl_fasta_index_t *bl_fasta_index_ptr, size_t c, int64_t new_lengths_element);
+int bl_fasta_index_set_lengths_cpy(bl_fasta_index_t *bl_fasta_index_ptr, int64_t *new_lengths, size_t array_size);
+int bl_fasta_index_set_offsets(bl_fasta_index_t *bl_fasta_index_ptr, int64_t *new_offsets);
+int bl_fasta_index_set_offsets_ae(bl_fasta_index_t *bl_fasta_index_ptr, size_t c, int64_t new_offsets_element);
+int bl_fasta_index_set_offsets_cpy(bl_fasta_index_t *bl_fasta_index_ptr, int64_t *new_offsets, size_t array_size);
+int bl_fasta_index_set_line_bases(bl_fasta_index_t *bl_fasta_index_ptr, int64_t *new_line_bases);
+int bl_fasta_index_set_line_bases_ae(bl_fasta_index_t *bl_fasta_index_ptr, size_t c, int64_t new_line_bases_element);
+int bl_fasta_index_set_line_bases_cpy(bl_fasta_index_t *bl_fasta_index_ptr, int64_t *new_line_bases, size_t array_size);
+int bl_fasta_index_set_line_bytes(bl_fasta_index_t *bl_fasta_index_ptr, int64_t *new_line_bytes);
+int bl_fasta_index_set_line_bytes_ae(bl_fasta_index_t *bl_fasta_index_ptr, size_t c, int64_t new_line_bytes_element);
+int bl_fasta_index_set_line_bytes_cpy(bl_fasta_index_t *bl_fasta_index_ptr, int64_t *new_line_bytes, size_t array_size);
+int bl_fasta_index_set_fasta_fd(bl_fasta_index_t *bl_fasta_index_ptr, int new_fasta_fd);
@@ -0,0 +1,6 @@
+
+/* Return values for mutator functions */
+#define BL_FASTA_INDEX_DATA_OK              0
+#define BL_FASTA_INDEX_DATA_INVALID         -1      // Catch-all for non-specific error
+#define BL_FASTA_INDEX_DATA_OUT_OF_RANGE    -2
+
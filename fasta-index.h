@@ -0,0 +1,67 @@
+#ifndef _BIOLIBC_FASTA_INDEX_H_
+#define _BIOLIBC_FASTA_INDEX_H_
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+#ifndef _BIOLIBC_H_
+#include "biolibc.h"
+#endif
+
+#ifndef _BIOLIBC_FASTA_H_
+#include "fasta.h"
+#endif
+
+#ifndef _BIOLIBC_CHROM_DICT_H_
+#include "chrom-dict.h"
+#endif
+
+/*
+ *  In-memory copy of a samtools-compatible FASTA index (.fai), plus an
+ *  open descriptor for the FASTA file for random access region fetches.
+ *  One entry per sequence, stored as parallel arrays.  Names are also
+ *  hashed in a chromosome dictionary, whose IDs match the entry
+ *  positions, so lookups by name take constant time.
+ */
+
+typedef struct
+{
+    size_t  array_size,
+	    count;
+    char    **names;        // Sequence name, up to first whitespace
+    int64_t *lengths,       // Number of bases
+	    *offsets,       // File offset of first base
+	    *line_bases,    // Bases per full line
+	    *line_bytes;    // Bytes per full line, including newline
+    int     fasta_fd;       // FASTA file for bl_fasta_index_fetch()
+    bl_chrom_dict_t dict;   // Name to entry, for bl_fasta_index_find()
+}   bl_fasta_index_t;
+
+#define BL_FASTA_INDEX_INIT \
+	{ 0, 0, NULL, NULL, NULL, NULL, NULL, -1, BL_CHROM_DICT_INIT }
+
+#define BL_FASTA_INDEX_OK               0
+#define BL_FASTA_INDEX_MALLOC_FAILED    -1
+#define BL_FASTA_INDEX_BAD_DATA         -2
+#define BL_FASTA_INDEX_OPEN_FAILED      -3
+
+#include "fasta-index-rvs.h"
+#include "fasta-index-accessors.h"
+#include "fasta-index-mutators.h"
+
+/* fasta-index.c */
+int bl_fasta_index_add(bl_fasta_index_t *index, const char *name, int64_t length, int64_t offset, int64_t line_bases, int64_t line_bytes);
+int bl_fasta_index_build(bl_fasta_index_t *index, FILE *fasta_stream);
+int bl_fasta_index_load(bl_fasta_index_t *index, FILE *fai_stream);
+int bl_fasta_index_write(bl_fasta_index_t *index, FILE *fai_stream);
+int bl_fasta_index_open(bl_fasta_index_t *index, const char *fasta_filename);
+ssize_t bl_fasta_index_find(bl_fasta_index_t *index, const char *name);
+int bl_fasta_index_fetch(bl_fasta_index_t *index, bl_fasta_t *record, const char *name, int64_t start, int64_t end);
+void bl_fasta_index_free(bl_fasta_index_t *index);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif // _BIOLIBC_FASTA_INDEX_H_
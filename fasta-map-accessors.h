@@ -0,0 +1,14 @@
+    
+/*
+ *  Generated by /usr/local/bin/auto-gen-get-set
+ *
+ *  Accessor macros.  Use these to access structure members from functions
+ *  outside the bl_fasta_map_t class.
+ *
+ *  These generated macros are not expected to be perfect.  Check and edit
+ *  as needed before adding to your code.
+ */
+
+#define BL_FASTA_MAP_BASE(ptr)          ((ptr)->base)
+#define BL_FASTA_MAP_SIZE(ptr)          ((ptr)->size)
+#define BL_FASTA_MAP_POS(ptr)           ((ptr)->pos)
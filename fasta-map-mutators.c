@@ -0,0 +1,179 @@
+/***************************************************************************
+ *  This file is automatically generated by gen-get-set.  Be sure to keep
+ *  track of any manual changes.
+ *
+ *  These generated functions are not expected to be perfect.  Check and
+ *  edit as needed before adding to your code.
+ ***************************************************************************/
+
+#include <string.h>
+#include <ctype.h>
+#include <stdbool.h>        // In case of bool
+#include <stdint.h>         // In case of int64_t, etc
+#include <xtend/string.h>   // strlcpy() on Linux
+#include "fasta-map.h"
+
+
+/***************************************************************************
+ *  Library:
+ *      #include <biolibc/fasta-map.h>
+ *      -lbiolibc -lxtend
+ *
+ *  Description:
+ *      Mutator for base member in a bl_fasta_map_t structure.
+ *      Use this function to set base in a bl_fasta_map_t object
+ *      from non-member functions.  This function performs a direct
+ *      assignment for scalar or pointer structure members.  If
+ *      base is a pointer, data previously pointed to should
+ *      be freed before calling this function to avoid memory
+ *      leaks.
+ *
+ *  Arguments:
+ *      bl_fasta_map_ptr Pointer to the structure to set
+ *      new_base        The new value for base
+ *
+ *  Returns:
+ *      BL_FASTA_MAP_DATA_OK if the new value is acceptable and assigned
+ *      BL_FASTA_MAP_DATA_OUT_OF_RANGE otherwise
+ *
+ *  Examples:
+ *      bl_fasta_map_t  bl_fasta_map;
+ *      char *          new_base;
+ *
+ *      if ( bl_fasta_map_set_base(&bl_fasta_map, new_base)
+ *              == BL_FASTA_MAP_DATA_OK )
+ *      {
+ *      }
+ *
+ *  See also:
+ *      (3)
+ *
+ *  History: 
+ *  Date        Name        Modification
+ *  2026-10-17  gen-get-set Auto-generated from fasta-map.h
+ ***************************************************************************/
+
+int     bl_fasta_map_set_base(
+	    bl_fasta_map_t *bl_fasta_map_ptr,
+	    char *new_base
+	)
+
+{
+    if ( new_base == NULL )
+	return BL_FASTA_MAP_DATA_OUT_OF_RANGE;
+    else
+    {
+	bl_fasta_map_ptr->base = new_base;
+	return BL_FASTA_MAP_DATA_OK;
+    }
+}
+
+
+/***************************************************************************
+ *  Library:
+ *      #include <biolibc/fasta-map.h>
+ *      -lbiolibc -lxtend
+ *
+ *  Description:
+ *      Mutator for size member in a bl_fasta_map_t structure.
+ *      Use this function to set size in a bl_fasta_map_t object
+ *      from non-member functions.  This function performs a direct
+ *      assignment for scalar or pointer structure members.  If
+ *      size is a pointer, data previously pointed to should
+ *      be freed before calling this function to avoid memory
+ *      leaks.
+ *
+ *  Arguments:
+ *      bl_fasta_map_ptr Pointer to the structure to set
+ *      new_size        The new value for size
+ *
+ *  Returns:
+ *      BL_FASTA_MAP_DATA_OK if the new value is acceptable and assigned
+ *      BL_FASTA_MAP_DATA_OUT_OF_RANGE otherwise
+ *
+ *  Examples:
+ *      bl_fasta_map_t  bl_fasta_map;
+ *      size_t          new_size;
+ *
+ *      if ( bl_fasta_map_set_size(&bl_fasta_map, new_size)
+ *              == BL_FASTA_MAP_DATA_OK )
+ *      {
+ *      }
+ *
+ *  See also:
+ *      (3)
+ *
+ *  History: 
+ *  Date        Name        Modification
+ *  2026-10-17  gen-get-set Auto-generated from fasta-map.h
+ ***************************************************************************/
+
+int     bl_fasta_map_set_size(
+	    bl_fasta_map_t *bl_fasta_map_ptr,
+	    size_t new_size
+	)
+
+{
+    if ( false )
+	return BL_FASTA_MAP_DATA_OUT_OF_RANGE;
+    else
+    {
+	bl_fasta_map_ptr->size = new_size;
+	return BL_FASTA_MAP_DATA_OK;
+    }
+}
+
+
+/***************************************************************************
+ *  Library:
+ *      #include <biolibc/fasta-map.h>
+ *      -lbiolibc -lxtend
+ *
+ *  Description:
+ *      Mutator for pos member in a bl_fasta_map_t structure.
+ *      Use this function to set pos in a bl_fasta_map_t object
+ *      from non-member functions.  This function performs a direct
+ *      assignment for scalar or pointer structure members.  If
+ *      pos is a pointer, data previously pointed to should
+ *      be freed before calling this function to avoid memory
+ *      leaks.
+ *
+ *  Arguments:
+ *      bl_fasta_map_ptr Pointer to the structure to set
+ *      new_pos         The new value for pos
+ *
+ *  Returns:
+ *      BL_FASTA_MAP_DATA_OK if the new value is acceptable and assigned
+ *      BL_FASTA_MAP_DATA_OUT_OF_RANGE otherwise
+ *
+ *  Examples:
+ *      bl_fasta_map_t  bl_fasta_map;
+ *      size_t          new_pos;
+ *
+ *      if ( bl_fasta_map_set_pos(&bl_fasta_map, new_pos)
+ *              == BL_FASTA_MAP_DATA_OK )
+ *      {
+ *      }
+ *
+ *  See also:
+ *      (3)
+ *
+ *  History: 
+ *  Date        Name        Modification
+ *  2026-10-17  gen-get-set Auto-generated from fasta-map.h
+ ***************************************************************************/
+
+int     bl_fasta_map_set_pos(
+	    bl_fasta_map_t *bl_fasta_map_ptr,
+	    size_t new_pos
+	)
+
+{
+    if ( false )
+	return BL_FASTA_MAP_DATA_OUT_OF_RANGE;
+    else
+    {
+	bl_fasta_map_ptr->pos = new_pos;
+	return BL_FASTA_MAP_DATA_OK;
+    }
+}
@@ -0,0 +1,19 @@
+
+/*
+ *  Generated by /usr/local/bin/auto-gen-get-set
+ *
+ *  Mutator functions for setting with no sanity checking.  Use these to
+ *  set structure members from functions outside the bl_fasta_map_t
+ *  class.  These macros perform no data validation.  Hence, they achieve
+ *  maximum performance where data are guaranteed correct by other means.
+ *  Use the mutator functions (same name as the macro, but lower case)
+ *  for more robust code with a small performance penalty.
+ *
+ *  These generated macros are not expected to be perfect.  Check and edit
+ *  as needed before adding to your code.
+ */
+
+/* temp-fasta-map-mutators.c */
+int bl_fasta_map_set_base(bl_fasta_map_t *bl_fasta_map_ptr, char *new_base);
+int bl_fasta_map_set_size(bl_fasta_map_t *bl_fasta_map_ptr, size_t new_size);
+int bl_fasta_map_set_pos(bl_fasta_map_t *bl_fasta_map_ptr, size_t new_pos);
@@ -0,0 +1,296 @@
+#include <stdio.h>
+#include <string.h>
+#include <stdbool.h>
+#include <fcntl.h>
+#include <unistd.h>
+#include <sys/types.h>
+#include <sys/stat.h>
+#include <sys/mman.h>
+#include "fasta-map.h"
+
+/***************************************************************************
+ *  Name:
+ *      bl_fasta_map_open() - Memory map a FASTA file
+ *
+ *  Library:
+ *      #include <biolibc/fasta-map.h>
+ *      -lbiolibc -lxtend
+ *
+ *  Description:
+ *      Map a FASTA file read-only into memory for use with
+ *      bl_fasta_map_read(3).  The mapping is shared, so any number of
+ *      processes mapping the same file use one copy of it in the page
+ *      cache rather than each holding a private copy of the sequence
+ *      data on the heap.  filename must be a regular file, not a pipe
+ *      or a compressed file.
+ *
+ *      The map should be released with bl_fasta_map_close(3) when
+ *      no longer needed.
+ *
+ *  Arguments:
+ *      map         Pointer to a bl_fasta_map_t object
+ *      filename    Name of the FASTA file to map
+ *
+ *  Returns:
+ *      BL_FASTA_MAP_OK on success
+ *      BL_FASTA_MAP_OPEN_FAILED if the file cannot be opened or
+ *      mapped, with errno set by open(2), fstat(2) or mmap(2)
+ *
+ *  Examples:
+ *      bl_fasta_map_t  map = BL_FASTA_MAP_INIT;
+ *
+ *      if ( bl_fasta_map_open(&map, "genome.fa") != BL_FASTA_MAP_OK )
+ *      {
+ *          perror("genome.fa");
+ *          exit(EX_NOINPUT);
+ *      }
+ *
+ *  See also:
+ *      bl_fasta_map_read(3), bl_fasta_map_close(3), mmap(2)
+ *
+ *  History: 
+ *  Date        Name        Modification
+ *  2026-10-17  agent       Begin
+ ***************************************************************************/
+
+int     bl_fasta_map_open(bl_fasta_map_t *map, const char *filename)
+
+{
+    struct stat st;
+    int         fd;
+    
+    if ( (fd = open(filename, O_RDONLY)) == -1 )
+	return BL_FASTA_MAP_OPEN_FAILED;
+    if ( fstat(fd, &st) == -1 )
+    {
+	close(fd);
+	return BL_FASTA_MAP_OPEN_FAILED;
+    }
+    
+    map->size = st.st_size;
+    map->pos = 0;
+    if ( map->size == 0 )
+	map->base = NULL;   // mmap() rejects 0 length, reads just see EOF
+    else
+    {
+	map->base = mmap(NULL, map->size, PROT_READ, MAP_SHARED, fd, 0);
+	if ( map->base == MAP_FAILED )
+	{
+	    map->base = NULL;
+	    map->size = 0;
+	    close(fd);
+	    return BL_FASTA_MAP_OPEN_FAILED;
+	}
+    }
+    
+    /* The mapping remains valid after the descriptor is closed */
+    close(fd);
+    return BL_FASTA_MAP_OK;
+}
+
+
+/***************************************************************************
+ *  Name:
+ *      bl_fasta_map_read() - Return a view of the next mapped FASTA record
+ *
+ *  Library:
+ *      #include <biolibc/fasta-map.h>
+ *      -lbiolibc -lxtend
+ *
+ *  Description:
+ *      Fill in a bl_fasta_view_t object describing the next record in a
+ *      FASTA file mapped by bl_fasta_map_open(3).  No data are copied:
+ *      desc and seq point into the map and remain valid until
+ *      bl_fasta_map_close(3) is called.  Neither is null-terminated, and
+ *      seq still contains newlines.  Use bl_fasta_view_base(3) to access
+ *      individual bases or bl_fasta_view_copy(3) to extract a
+ *      contiguous window of sequence.
+ *
+ *      The sequence lines are scanned once to count bases and record
+ *      line geometry.  If every line except the last contains the same
+ *      number of bases, as samtools faidx requires, line_bases and
+ *      line_bytes are set so that any base can be located in constant
+ *      time.  Otherwise line_bases is set to 0.
+ *
+ *  Arguments:
+ *      map     Pointer to a bl_fasta_map_t object
+ *      view    Pointer to a bl_fasta_view_t object to receive the record
+ *
+ *  Returns:
+ *      BL_READ_OK upon successful read of description and sequence
+ *      BL_READ_BAD_DATA if the record does not begin with '>'
+ *      BL_READ_TRUNCATED if the file ends in the description line
+ *      BL_READ_EOF if no more data are available
+ *
+ *  Examples:
+ *      bl_fasta_map_t  map = BL_FASTA_MAP_INIT;
+ *      bl_fasta_view_t view = BL_FASTA_VIEW_INIT;
+ *
+ *      bl_fasta_map_open(&map, "genome.fa");
+ *      while ( bl_fasta_map_read(&map, &view) == BL_READ_OK )
+ *          printf("%.*s %zu\n", (int)BL_FASTA_VIEW_DESC_LEN(&view),
+ *                 BL_FASTA_VIEW_DESC(&view), BL_FASTA_VIEW_SEQ_LEN(&view));
+ *      bl_fasta_map_close(&map);
+ *
+ *  See also:
+ *      bl_fasta_map_open(3), bl_fasta_view_base(3), bl_fasta_view_copy(3)
+ *
+ *  History: 
+ *  Date        Name        Modification
+ *  2026-10-17  agent       Begin
+ ***************************************************************************/
+
+int     bl_fasta_map_read(bl_fasta_map_t *map, bl_fasta_view_t *view)
+
+{
+    const char  *p, *end, *nl, *line_end;
+    size_t      bases, bytes, line_bases, line_bytes, seq_len;
+    bool        uniform, short_line;
+    
+    p = map->base + map->pos;
+    end = map->base + map->size;
+    
+    /* Skip comment lines */
+    while ( (p < end) && (*p == ';') )
+    {
+	nl = memchr(p, '\n', end - p);
+	p = (nl == NULL) ? end : nl + 1;
+    }
+    
+    if ( p == end )
+    {
+	map->pos = map->size;
+	return BL_READ_EOF;
+    }
+    
+    /* Every record should begin with a '>' */
+    if ( *p != '>' )
+	return BL_READ_BAD_DATA;
+    
+    /* Every description should be followed by at least one seq line */
+    if ( (nl = memchr(p, '\n', end - p)) == NULL )
+    {
+	fprintf(stderr, "bl_fasta_map_read(): Record truncated in desc %.*s.\n",
+		(int)(end - p), p);
+	map->pos = map->size;
+	return BL_READ_TRUNCATED;
+    }
+    view->desc = p;
+    view->desc_len = nl - p;
+    if ( (view->desc_len > 0) && (p[view->desc_len - 1] == '\r') )
+	--view->desc_len;
+    view->seq = p = nl + 1;
+    
+    /*
+     *  Scan sequence lines up to the next '>' at the start of a line.
+     *  Lines are uniform if all but the last have the same length.
+     */
+    
+    seq_len = line_bases = line_bytes = 0;
+    uniform = true;
+    short_line = false;
+    while ( (p < end) && (*p != '>') )
+    {
+	nl = memchr(p, '\n', end - p);
+	line_end = (nl == NULL) ? end : nl;
+	bytes = line_end - p;
+	bases = bytes;
+	if ( (bases > 0) && (p[bases - 1] == '\r') )
+	    --bases;
+	if ( nl != NULL )
+	    ++bytes;
+	
+	if ( p == view->seq )
+	{
+	    line_bases = bases;
+	    line_bytes = bytes;
+	}
+	else if ( short_line || (bases > line_bases) ||
+		  ((nl != NULL) && (bases == line_bases) &&
+		   (bytes != line_bytes)) )
+	    uniform = false;
+	if ( bases < line_bases )
+	    short_line = true;
+	
+	seq_len += bases;
+	p = line_end + (nl != NULL);
+    }
+    
+    view->seq_bytes = p - view->seq;
+    view->seq_len = seq_len;
+    if ( uniform && (line_bases != 0) )
+    {
+	view->line_bases = line_bases;
+	view->line_bytes = line_bytes;
+    }
+    else
+	view->line_bases = view->line_bytes = 0;
+    
+    map->pos = p - map->base;
+    return BL_READ_OK;
+}
+
+
+/***************************************************************************
+ *  Name:
+ *      bl_fasta_map_rewind() - Return to the first record of a FASTA map
+ *
+ *  Library:
+ *      #include <biolibc/fasta-map.h>
+ *      -lbiolibc -lxtend
+ *
+ *  Description:
+ *      Reset a bl_fasta_map_t object so that the next call to
+ *      bl_fasta_map_read(3) returns the first record in the file.
+ *      Views returned previously remain valid.
+ *
+ *  Arguments:
+ *      map     Pointer to a bl_fasta_map_t object
+ *
+ *  See also:
+ *      bl_fasta_map_read(3)
+ *
+ *  History: 
+ *  Date        Name        Modification
+ *  2026-10-17  agent       Begin
+ ***************************************************************************/
+
+void    bl_fasta_map_rewind(bl_fasta_map_t *map)
+
+{
+    map->pos = 0;
+}
+
+
+/***************************************************************************
+ *  Name:
+ *      bl_fasta_map_close() - Unmap a FASTA file
+ *
+ *  Library:
+ *      #include <biolibc/fasta-map.h>
+ *      -lbiolibc -lxtend
+ *
+ *  Description:
+ *      Release a mapping created by bl_fasta_map_open(3).  All views
+ *      obtained from the map by bl_fasta_map_read(3) become invalid.
+ *
+ *  Arguments:
+ *      map     Pointer to a bl_fasta_map_t object
+ *
+ *  See also:
+ *      bl_fasta_map_open(3)
+ *
+ *  History: 
+ *  Date        Name        Modification
+ *  2026-10-17  agent       Begin
+ ***************************************************************************/
+
+void    bl_fasta_map_close(bl_fasta_map_t *map)
+
+{
+    if ( map->base != NULL )
+	munmap(map->base, map->size);
+    map->base = NULL;
+    map->size = 0;
+    map->pos = 0;
+}
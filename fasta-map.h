@@ -0,0 +1,49 @@
+#ifndef _BIOLIBC_FASTA_MAP_H_
+#define _BIOLIBC_FASTA_MAP_H_
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+#ifndef _BIOLIBC_H_
+#include "biolibc.h"
+#endif
+
+#ifndef _BIOLIBC_FASTA_VIEW_H_
+#include "fasta-view.h"
+#endif
+
+/*
+ *  Read-only memory map of a FASTA file.  Records are returned as
+ *  bl_fasta_view_t objects pointing into the map, so no sequence data
+ *  are copied and processes mapping the same file share one copy in
+ *  the page cache.
+ */
+
+typedef struct
+{
+    char    *base;      // Start of mapped file
+    size_t  size,       // Size of file and mapping
+	    pos;        // Offset of next record in map
+}   bl_fasta_map_t;
+
+#define BL_FASTA_MAP_INIT           { NULL, 0, 0 }
+
+#define BL_FASTA_MAP_OK             0
+#define BL_FASTA_MAP_OPEN_FAILED    -1
+
+#include "fasta-map-rvs.h"
+#include "fasta-map-accessors.h"
+#include "fasta-map-mutators.h"
+
+/* fasta-map.c */
+int bl_fasta_map_open(bl_fasta_map_t *map, const char *filename);
+int bl_fasta_map_read(bl_fasta_map_t *map, bl_fasta_view_t *view);
+void bl_fasta_map_rewind(bl_fasta_map_t *map);
+void bl_fasta_map_close(bl_fasta_map_t *map);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif // _BIOLIBC_FASTA_MAP_H_
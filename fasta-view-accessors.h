@@ -0,0 +1,18 @@
+    
+/*
+ *  Generated by /usr/local/bin/auto-gen-get-set
+ *
+ *  Accessor macros.  Use these to access structure members from functions
+ *  outside the bl_fasta_view_t class.
+ *
+ *  These generated macros are not expected to be perfect.  Check and edit
+ *  as needed before adding to your code.
+ */
+
+#define BL_FASTA_VIEW_DESC(ptr)         ((ptr)->desc)
+#define BL_FASTA_VIEW_SEQ(ptr)          ((ptr)->seq)
+#define BL_FASTA_VIEW_DESC_LEN(ptr)     ((ptr)->desc_len)
+#define BL_FASTA_VIEW_SEQ_BYTES(ptr)    ((ptr)->seq_bytes)
+#define BL_FASTA_VIEW_SEQ_LEN(ptr)      ((ptr)->seq_len)
+#define BL_FASTA_VIEW_LINE_BASES(ptr)   ((ptr)->line_bases)
+#define BL_FASTA_VIEW_LINE_BYTES(ptr)   ((ptr)->line_bytes)
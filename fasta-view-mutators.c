@@ -0,0 +1,399 @@
+/***************************************************************************
+ *  This file is automatically generated by gen-get-set.  Be sure to keep
+ *  track of any manual changes.
+ *
+ *  These generated functions are not expected to be perfect.  Check and
+ *  edit as needed before adding to your code.
+ ***************************************************************************/
+
+#include <string.h>
+#include <ctype.h>
+#include <stdbool.h>        // In case of bool
+#include <stdint.h>         // In case of int64_t, etc
+#include <xtend/string.h>   // strlcpy() on Linux
+#include "fasta-view.h"
+
+
+/***************************************************************************
+ *  Library:
+ *      #include <biolibc/fasta-view.h>
+ *      -lbiolibc -lxtend
+ *
+ *  Description:
+ *      Mutator for desc member in a bl_fasta_view_t structure.
+ *      Use this function to set desc in a bl_fasta_view_t object
+ *      from non-member functions.  This function performs a direct
+ *      assignment for scalar or pointer structure members.  If
+ *      desc is a pointer, data previously pointed to should
+ *      be freed before calling this function to avoid memory
+ *      leaks.
+ *
+ *  Arguments:
+ *      bl_fasta_view_ptr Pointer to the structure to set
+ *      new_desc        The new value for desc
+ *
+ *  Returns:
+ *      BL_FASTA_VIEW_DATA_OK if the new value is acceptable and assigned
+ *      BL_FASTA_VIEW_DATA_OUT_OF_RANGE otherwise
+ *
+ *  Examples:
+ *      bl_fasta_view_t bl_fasta_view;
+ *      const char *      new_desc;
+ *
+ *      if ( bl_fasta_view_set_desc(&bl_fasta_view, new_desc)
+ *              == BL_FASTA_VIEW_DATA_OK )
+ *      {
+ *      }
+ *
+ *  See also:
+ *      (3)
+ *
+ *  History: 
+ *  Date        Name        Modification
+ *  2026-10-17  gen-get-set Auto-generated from fasta-view.h
+ ***************************************************************************/
+
+int     bl_fasta_view_set_desc(
+	    bl_fasta_view_t *bl_fasta_view_ptr,
+	    const char *new_desc
+	)
+
+{
+    if ( new_desc == NULL )
+	return BL_FASTA_VIEW_DATA_OUT_OF_RANGE;
+    else
+    {
+	bl_fasta_view_ptr->desc = new_desc;
+	return BL_FASTA_VIEW_DATA_OK;
+    }
+}
+
+
+/***************************************************************************
+ *  Library:
+ *      #include <biolibc/fasta-view.h>
+ *      -lbiolibc -lxtend
+ *
+ *  Description:
+ *      Mutator for seq member in a bl_fasta_view_t structure.
+ *      Use this function to set seq in a bl_fasta_view_t object
+ *      from non-member functions.  This function performs a direct
+ *      assignment for scalar or pointer structure members.  If
+ *      seq is a pointer, data previously pointed to should
+ *      be freed before calling this function to avoid memory
+ *      leaks.
+ *
+ *  Arguments:
+ *      bl_fasta_view_ptr Pointer to the structure to set
+ *      new_seq         The new value for seq
+ *
+ *  Returns:
+ *      BL_FASTA_VIEW_DATA_OK if the new value is acceptable and assigned
+ *      BL_FASTA_VIEW_DATA_OUT_OF_RANGE otherwise
+ *
+ *  Examples:
+ *      bl_fasta_view_t bl_fasta_view;
+ *      const char *      new_seq;
+ *
+ *      if ( bl_fasta_view_set_seq(&bl_fasta_view, new_seq)
+ *              == BL_FASTA_VIEW_DATA_OK )
+ *      {
+ *      }
+ *
+ *  See also:
+ *      (3)
+ *
+ *  History: 
+ *  Date        Name        Modification
+ *  2026-10-17  gen-get-set Auto-generated from fasta-view.h
+ ***************************************************************************/
+
+int     bl_fasta_view_set_seq(
+	    bl_fasta_view_t *bl_fasta_view_ptr,
+	    const char *new_seq
+	)
+
+{
+    if ( new_seq == NULL )
+	return BL_FASTA_VIEW_DATA_OUT_OF_RANGE;
+    else
+    {
+	bl_fasta_view_ptr->seq = new_seq;
+	return BL_FASTA_VIEW_DATA_OK;
+    }
+}
+
+
+/***************************************************************************
+ *  Library:
+ *      #include <biolibc/fasta-view.h>
+ *      -lbiolibc -lxtend
+ *
+ *  Description:
+ *      Mutator for desc_len member in a bl_fasta_view_t structure.
+ *      Use this function to set desc_len in a bl_fasta_view_t object
+ *      from non-member functions.  This function performs a direct
+ *      assignment for scalar or pointer structure members.  If
+ *      desc_len is a pointer, data previously pointed to should
+ *      be freed before calling this function to avoid memory
+ *      leaks.
+ *
+ *  Arguments:
+ *      bl_fasta_view_ptr Pointer to the structure to set
+ *      new_desc_len    The new value for desc_len
+ *
+ *  Returns:
+ *      BL_FASTA_VIEW_DATA_OK if the new value is acceptable and assigned
+ *      BL_FASTA_VIEW_DATA_OUT_OF_RANGE otherwise
+ *
+ *  Examples:
+ *      bl_fasta_view_t bl_fasta_view;
+ *      size_t          new_desc_len;
+ *
+ *      if ( bl_fasta_view_set_desc_len(&bl_fasta_view, new_desc_len)
+ *              == BL_FASTA_VIEW_DATA_OK )
+ *      {
+ *      }
+ *
+ *  See also:
+ *      (3)
+ *
+ *  History: 
+ *  Date        Name        Modification
+ *  2026-10-17  gen-get-set Auto-generated from fasta-view.h
+ ***************************************************************************/
+
+int     bl_fasta_view_set_desc_len(
+	    bl_fasta_view_t *bl_fasta_view_ptr,
+	    size_t new_desc_len
+	)
+
+{
+    if ( false )
+	return BL_FASTA_VIEW_DATA_OUT_OF_RANGE;
+    else
+    {
+	bl_fasta_view_ptr->desc_len = new_desc_len;
+	return BL_FASTA_VIEW_DATA_OK;
+    }
+}
+
+
+/***************************************************************************
+ *  Library:
+ *      #include <biolibc/fasta-view.h>
+ *      -lbiolibc -lxtend
+ *
+ *  Description:
+ *      Mutator for seq_bytes member in a bl_fasta_view_t structure.
+ *      Use this function to set seq_bytes in a bl_fasta_view_t object
+ *      from non-member functions.  This function performs a direct
+ *      assignment for scalar or pointer structure members.  If
+ *      seq_bytes is a pointer, data previously pointed to should
+ *      be freed before calling this function to avoid memory
+ *      leaks.
+ *
+ *  Arguments:
+ *      bl_fasta_view_ptr Pointer to the structure to set
+ *      new_seq_bytes   The new value for seq_bytes
+ *
+ *  Returns:
+ *      BL_FASTA_VIEW_DATA_OK if the new value is acceptable and assigned
+ *      BL_FASTA_VIEW_DATA_OUT_OF_RANGE otherwise
+ *
+ *  Examples:
+ *      bl_fasta_view_t bl_fasta_view;
+ *      size_t          new_seq_bytes;
+ *
+ *      if ( bl_fasta_view_set_seq_bytes(&bl_fasta_view, new_seq_bytes)
+ *              == BL_FASTA_VIEW_DATA_OK )
+ *      {
+ *      }
+ *
+ *  See also:
+ *      (3)
+ *
+ *  History: 
+ *  Date        Name        Modification
+ *  2026-10-17  gen-get-set Auto-generated from fasta-view.h
+ ***************************************************************************/
+
+int     bl_fasta_view_set_seq_bytes(
+	    bl_fasta_view_t *bl_fasta_view_ptr,
+	    size_t new_seq_bytes
+	)
+
+{
+    if ( false )
+	return BL_FASTA_VIEW_DATA_OUT_OF_RANGE;
+    else
+    {
+	bl_fasta_view_ptr->seq_bytes = new_seq_bytes;
+	return BL_FASTA_VIEW_DATA_OK;
+    }
+}
+
+
+/***************************************************************************
+ *  Library:
+ *      #include <biolibc/fasta-view.h>
+ *      -lbiolibc -lxtend
+ *
+ *  Description:
+ *      Mutator for seq_len member in a bl_fasta_view_t structure.
+ *      Use this function to set seq_len in a bl_fasta_view_t object
+ *      from non-member functions.  This function performs a direct
+ *      assignment for scalar or pointer structure members.  If
+ *      seq_len is a pointer, data previously pointed to should
+ *      be freed before calling this function to avoid memory
+ *      leaks.
+ *
+ *  Arguments:
+ *      bl_fasta_view_ptr Pointer to the structure to set
+ *      new_seq_len     The new value for seq_len
+ *
+ *  Returns:
+ *      BL_FASTA_VIEW_DATA_OK if the new value is acceptable and assigned
+ *      BL_FASTA_VIEW_DATA_OUT_OF_RANGE otherwise
+ *
+ *  Examples:
+ *      bl_fasta_view_t bl_fasta_view;
+ *      size_t          new_seq_len;
+ *
+ *      if ( bl_fasta_view_set_seq_len(&bl_fasta_view, new_seq_len)
+ *              == BL_FASTA_VIEW_DATA_OK )
+ *      {
+ *      }
+ *
+ *  See also:
+ *      (3)
+ *
+ *  History: 
+ *  Date        Name        Modification
+ *  2026-10-17  gen-get-set Auto-generated from fasta-view.h
+ ***************************************************************************/
+
+int     bl_fasta_view_set_seq_len(
+	    bl_fasta_view_t *bl_fasta_view_ptr,
+	    size_t new_seq_len
+	)
+
+{
+    if ( false )
+	return BL_FASTA_VIEW_DATA_OUT_OF_RANGE;
+    else
+    {
+	bl_fasta_view_ptr->seq_len = new_seq_len;
+	return BL_FASTA_VIEW_DATA_OK;
+    }
+}
+
+
+/***************************************************************************
+ *  Library:
+ *      #include <biolibc/fasta-view.h>
+ *      -lbiolibc -lxtend
+ *
+ *  Description:
+ *      Mutator for line_bases member in a bl_fasta_view_t structure.
+ *      Use this function to set line_bases in a bl_fasta_view_t object
+ *      from non-member functions.  This function performs a direct
+ *      assignment for scalar or pointer structure members.  If
+ *      line_bases is a pointer, data previously pointed to should
+ *      be freed before calling this function to avoid memory
+ *      leaks.
+ *
+ *  Arguments:
+ *      bl_fasta_view_ptr Pointer to the structure to set
+ *      new_line_bases  The new value for line_bases
+ *
+ *  Returns:
+ *      BL_FASTA_VIEW_DATA_OK if the new value is acceptable and assigned
+ *      BL_FASTA_VIEW_DATA_OUT_OF_RANGE otherwise
+ *
+ *  Examples:
+ *      bl_fasta_view_t bl_fasta_view;
+ *      size_t          new_line_bases;
+ *
+ *      if ( bl_fasta_view_set_line_bases(&bl_fasta_view, new_line_bases)
+ *              == BL_FASTA_VIEW_DATA_OK )
+ *      {
+ *      }
+ *
+ *  See also:
+ *      (3)
+ *
+ *  History: 
+ *  Date        Name        Modification
+ *  2026-10-17  gen-get-set Auto-generated from fasta-view.h
+ ***************************************************************************/
+
+int     bl_fasta_view_set_line_bases(
+	    bl_fasta_view_t *bl_fasta_view_ptr,
+	    size_t new_line_bases
+	)
+
+{
+    if ( false )
+	return BL_FASTA_VIEW_DATA_OUT_OF_RANGE;
+    else
+    {
+	bl_fasta_view_ptr->line_bases = new_line_bases;
+	return BL_FASTA_VIEW_DATA_OK;
+    }
+}
+
+
+/***************************************************************************
+ *  Library:
+ *      #include <biolibc/fasta-view.h>
+ *      -lbiolibc -lxtend
+ *
+ *  Description:
+ *      Mutator for line_bytes member in a bl_fasta_view_t structure.
+ *      Use this function to set line_bytes in a bl_fasta_view_t object
+ *      from non-member functions.  This function performs a direct
+ *      assignment for scalar or pointer structure members.  If
+ *      line_bytes is a pointer, data previously pointed to should
+ *      be freed before calling this function to avoid memory
+ *      leaks.
+ *
+ *  Arguments:
+ *      bl_fasta_view_ptr Pointer to the structure to set
+ *      new_line_bytes  The new value for line_bytes
+ *
+ *  Returns:
+ *      BL_FASTA_VIEW_DATA_OK if the new value is acceptable and assigned
+ *      BL_FASTA_VIEW_DATA_OUT_OF_RANGE otherwise
+ *
+ *  Examples:
+ *      bl_fasta_view_t bl_fasta_view;
+ *      size_t          new_line_bytes;
+ *
+ *      if ( bl_fasta_view_set_line_bytes(&bl_fasta_view, new_line_bytes)
+ *              == BL_FASTA_VIEW_DATA_OK )
+ *      {
+ *      }
+ *
+ *  See also:
+ *      (3)
+ *
+ *  History: 
+ *  Date        Name        Modification
+ *  2026-10-17  gen-get-set Auto-generated from fasta-view.h
+ ***************************************************************************/
+
+int     bl_fasta_view_set_line_bytes(
+	    bl_fasta_view_t *bl_fasta_view_ptr,
+	    size_t new_line_bytes
+	)
+
+{
+    if ( false )
+	return BL_FASTA_VIEW_DATA_OUT_OF_RANGE;
+    else
+    {
+	bl_fasta_view_ptr->line_bytes = new_line_bytes;
+	return BL_FASTA_VIEW_DATA_OK;
+    }
+}
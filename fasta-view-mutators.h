@@ -0,0 +1,23 @@
+
+/*
+ *  Generated by /usr/local/bin/auto-gen-get-set
+ *
+ *  Mutator functions for setting with no sanity checking.  Use these to
+ *  set structure members from functions outside the bl_fasta_view_t
+ *  class.  These macros perform no data validation.  Hence, they achieve
+ *  maximum performance where data are guaranteed correct by other means.
+ *  Use the mutator functions (same name as the macro, but lower case)
+ *  for more robust code with a small performance penalty.
+ *
+ *  These generated macros are not expected to be perfect.  Check and edit
+ *  as needed before adding to your code.
+ */
+
+/* temp-fasta-view-mutators.c */
+int bl_fasta_view_set_desc(bl_fasta_view_t *bl_fasta_view_ptr, const char *new_desc);
+int bl_fasta_view_set_seq(bl_fasta_view_t *bl_fasta_view_ptr, const char *new_seq);
+int bl_fasta_view_set_desc_len(bl_fasta_view_t *bl_fasta_view_ptr, size_t new_desc_len);
+int bl_fasta_view_set_seq_bytes(bl_fasta_view_t *bl_fasta_view_ptr, size_t new_seq_bytes);
+int bl_fasta_view_set_seq_len(bl_fasta_view_t *bl_fasta_view_ptr, size_t new_seq_len);
+int bl_fasta_view_set_line_bases(bl_fasta_view_t *bl_fasta_view_ptr, size_t new_line_bases);
+int bl_fasta_view_set_line_bytes(bl_fasta_view_t *bl_fasta_view_ptr, size_t new_line_bytes);
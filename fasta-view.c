@@ -0,0 +1,190 @@
+#include <stdio.h>
+#include <string.h>
+#include "fasta-view.h"
+
+/***************************************************************************
+ *  Name:
+ *      bl_fasta_view_base() - Return one base from a FASTA view
+ *
+ *  Library:
+ *      #include <biolibc/fasta-view.h>
+ *      -lbiolibc -lxtend
+ *
+ *  Description:
+ *      Return the base at 0-based position pos in the sequence of a
+ *      bl_fasta_view_t object, skipping newlines in the underlying data.
+ *      If all lines in the record have the same length, as in most
+ *      genome FASTA files, the byte is located by arithmetic in constant
+ *      time.  Otherwise (line_bases == 0) the lines are scanned from the
+ *      beginning of the sequence.
+ *
+ *  Arguments:
+ *      view    Pointer to a bl_fasta_view_t object
+ *      pos     0-based position of the base within the sequence
+ *
+ *  Returns:
+ *      The base as an unsigned char cast to int, or EOF if pos is not
+ *      less than seq_len
+ *
+ *  Examples:
+ *      bl_fasta_map_t  map = BL_FASTA_MAP_INIT;
+ *      bl_fasta_view_t view = BL_FASTA_VIEW_INIT;
+ *      size_t          c, gc = 0;
+ *      int             base;
+ *
+ *      bl_fasta_map_open(&map, "genome.fa");
+ *      while ( bl_fasta_map_read(&map, &view) == BL_READ_OK )
+ *      {
+ *          for (c = 0; c < BL_FASTA_VIEW_SEQ_LEN(&view); ++c)
+ *          {
+ *              base = bl_fasta_view_base(&view, c);
+ *              if ( (base == 'G') || (base == 'C') )
+ *                  ++gc;
+ *          }
+ *      }
+ *      bl_fasta_map_close(&map);
+ *
+ *  See also:
+ *      bl_fasta_view_copy(3), bl_fasta_map_read(3)
+ *
+ *  History: 
+ *  Date        Name        Modification
+ *  2026-10-17  agent       Begin
+ ***************************************************************************/
+
+int     bl_fasta_view_base(const bl_fasta_view_t *view, size_t pos)
+
+{
+    char    base[2];
+    
+    if ( pos >= view->seq_len )
+	return EOF;
+    
+    if ( view->line_bases != 0 )
+	return (unsigned char)view->seq[pos / view->line_bases *
+			view->line_bytes + pos % view->line_bases];
+    
+    bl_fasta_view_copy(view, base, pos, 1);
+    return (unsigned char)*base;
+}
+
+
+/***************************************************************************
+ *  Name:
+ *      bl_fasta_view_copy() - Copy a window of bases from a FASTA view
+ *
+ *  Library:
+ *      #include <biolibc/fasta-view.h>
+ *      -lbiolibc -lxtend
+ *
+ *  Description:
+ *      Copy up to len bases, starting at 0-based position start, from
+ *      the sequence of a bl_fasta_view_t object to dest, stripping
+ *      newlines (and carriage returns).  dest is null-terminated, so it
+ *      must have room for len + 1 characters.
+ *
+ *      This allows a contiguous sequence to be produced one window at a
+ *      time, so that only the region of interest is copied rather than
+ *      an entire chromosome.  If all lines in the record have the same
+ *      length, the first line of the window is located by arithmetic
+ *      and each line segment is copied with one memcpy(3).  Otherwise
+ *      (line_bases == 0) lines are scanned from the beginning of the
+ *      sequence.
+ *
+ *  Arguments:
+ *      view    Pointer to a bl_fasta_view_t object
+ *      dest    Array of at least len + 1 characters to receive bases
+ *      start   0-based position of the first base to copy
+ *      len     Maximum number of bases to copy
+ *
+ *  Returns:
+ *      The number of bases copied, which is less than len if the window
+ *      extends past the end of the sequence
+ *
+ *  Examples:
+ *      bl_fasta_map_t  map = BL_FASTA_MAP_INIT;
+ *      bl_fasta_view_t view = BL_FASTA_VIEW_INIT;
+ *      char            window[1025];
+ *      size_t          start;
+ *
+ *      bl_fasta_map_open(&map, "genome.fa");
+ *      while ( bl_fasta_map_read(&map, &view) == BL_READ_OK )
+ *      {
+ *          for (start = 0; start < BL_FASTA_VIEW_SEQ_LEN(&view); start += 1024)
+ *          {
+ *              bl_fasta_view_copy(&view, window, start, 1024);
+ *              ...
+ *          }
+ *      }
+ *      bl_fasta_map_close(&map);
+ *
+ *  See also:
+ *      bl_fasta_view_base(3), bl_fasta_map_read(3)
+ *
+ *  History: 
+ *  Date        Name        Modification
+ *  2026-10-17  agent       Begin
+ ***************************************************************************/
+
+size_t  bl_fasta_view_copy(const bl_fasta_view_t *view, char *dest,
+			   size_t start, size_t len)
+
+{
+    const char  *p, *end, *nl;
+    size_t      copied, line, offset, chunk, line_len, base_pos;
+    
+    if ( start >= view->seq_len )
+    {
+	*dest = '\0';
+	return 0;
+    }
+    if ( len > view->seq_len - start )
+	len = view->seq_len - start;
+    
+    copied = 0;
+    if ( view->line_bases != 0 )
+    {
+	/* Uniform lines: Compute location of first base directly */
+	line = start / view->line_bases;
+	offset = start % view->line_bases;
+	while ( copied < len )
+	{
+	    chunk = view->line_bases - offset;
+	    if ( chunk > len - copied )
+		chunk = len - copied;
+	    memcpy(dest + copied, view->seq + line * view->line_bytes + offset,
+		   chunk);
+	    copied += chunk;
+	    ++line;
+	    offset = 0;
+	}
+    }
+    else
+    {
+	/* Irregular lines: Scan from the start of the sequence */
+	p = view->seq;
+	end = view->seq + view->seq_bytes;
+	base_pos = 0;
+	while ( (p < end) && (copied < len) )
+	{
+	    if ( (nl = memchr(p, '\n', end - p)) == NULL )
+		nl = end;
+	    line_len = nl - p;
+	    if ( (line_len > 0) && (p[line_len - 1] == '\r') )
+		--line_len;
+	    if ( base_pos + line_len > start )
+	    {
+		offset = (start > base_pos) ? start - base_pos : 0;
+		chunk = line_len - offset;
+		if ( chunk > len - copied )
+		    chunk = len - copied;
+		memcpy(dest + copied, p + offset, chunk);
+		copied += chunk;
+	    }
+	    base_pos += line_len;
+	    p = nl + 1;
+	}
+    }
+    dest[copied] = '\0';
+    return copied;
+}
@@ -0,0 +1,44 @@
+#ifndef _BIOLIBC_FASTA_VIEW_H_
+#define _BIOLIBC_FASTA_VIEW_H_
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+#ifndef _BIOLIBC_H_
+#include "biolibc.h"
+#endif
+
+/*
+ *  Read-only view of a FASTA record in memory that is not owned by the
+ *  view, such as a file mapped by bl_fasta_map_open(3).  Sequence data
+ *  are left in place with their newlines.  Line geometry is recorded so
+ *  that bases can be located without a copy.
+ */
+
+typedef struct
+{
+    const char  *desc,          // Description line, including '>'
+		*seq;           // First byte of sequence data
+    size_t      desc_len,       // Bytes in desc, excluding newline
+		seq_bytes,      // Bytes spanned by seq, including newlines
+		seq_len,        // Number of bases in seq
+		line_bases,     // Bases per full line, 0 if lines vary
+		line_bytes;     // Bytes per full line, including newline
+}   bl_fasta_view_t;
+
+#define BL_FASTA_VIEW_INIT  { NULL, NULL, 0, 0, 0, 0, 0 }
+
+#include "fasta-view-rvs.h"
+#include "fasta-view-accessors.h"
+#include "fasta-view-mutators.h"
+
+/* fasta-view.c */
+int bl_fasta_view_base(const bl_fasta_view_t *view, size_t pos);
+size_t bl_fasta_view_copy(const bl_fasta_view_t *view, char *dest, size_t start, size_t len);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif // _BIOLIBC_FASTA_VIEW_H_
@@ -152,6 +152,116 @@ int     bl_fasta_read(bl_fasta_t *record, FILE *fasta_stream)
 }
 
 
+/***************************************************************************
+ *  Name:
+ *      bl_fasta_read_buffered() - Read a FASTA record using a block buffer
+ *
+ *  Library:
+ *      #include <biolibc/fasta.h>
+ *      -lbiolibc -lxtend
+ *
+ *  Description:
+ *      Read a FASTA record through a bl_fastx_reader_t block buffer
+ *      attached to a stream by bl_fastx_reader_open(3).  The record
+ *      format and the contents of the bl_fasta_t structure are the same
+ *      as for bl_fasta_read(3), but input is read in large blocks and
+ *      sequence lines are located with memchr(3) and copied with
+ *      memcpy(3), rather than processed one character at a time with
+ *      getc(3).  This is several times faster on large inputs.
+ *
+ *      Existing buffers in the record are reused and enlarged as needed,
+ *      but not trimmed, so reading many records of varying length causes
+ *      few reallocations.  Buffer memory should be freed as soon as
+ *      possible by calling bl_fasta_free(3).
+ *  
+ *  Arguments:
+ *      record          Pointer to a bl_fasta_t structure to receive data
+ *      reader          Pointer to a bl_fastx_reader_t block buffer
+ *
+ *  Returns:
+ *      BL_READ_OK upon successful read of description and sequence
+ *      BL_READ_BAD_DATA if something is amiss with input format
+ *      BL_READ_TRUNCATED if EOF is reached within the description
+ *      BL_READ_EOF if no more data are available
+ *
+ *  Examples:
+ *      bl_fastx_reader_t   reader = BL_FASTX_READER_INIT;
+ *      bl_fasta_t          rec = BL_FASTA_INIT;
+ *
+ *      bl_fastx_reader_open(&reader, stdin, 0);
+ *      while ( bl_fasta_read_buffered(&rec, &reader) != BL_READ_EOF )
+ *          bl_fasta_write(&rec, stdout, BL_FASTA_LINE_UNLIMITED);
+ *      bl_fasta_free(&rec);
+ *      bl_fastx_reader_close(&reader);
+ *
+ *  See also:
+ *      bl_fasta_read(3), bl_fastx_reader_open(3), bl_fasta_write(3),
+ *      bl_fasta_free(3)
+ *
+ *  History: 
+ *  Date        Name        Modification
+ *  2026-10-17  agent       Begin
+ ***************************************************************************/
+
+int     bl_fasta_read_buffered(bl_fasta_t *record, bl_fastx_reader_t *reader)
+
+{
+    int     ch;
+    
+    /* Skip comment lines */
+    while ( (ch = bl_fastx_reader_peek(reader)) == ';' )
+	bl_fastx_reader_skip_line(reader);
+    
+    if ( ch == EOF )
+	return BL_READ_EOF;
+    
+    /* Every record should begin with a '>' */
+    if ( ch != '>' )
+	return BL_READ_BAD_DATA;
+    
+    /* Description includes the '>', as with bl_fasta_read() */
+    ch = bl_fastx_reader_read_line(reader, &record->desc,
+				   &record->desc_array_size, &record->desc_len);
+    
+    /* Should not encounter EOF while reading description line */
+    /* Every description should be followed by at least one seq line */
+    if ( ch == EOF )
+    {
+	fprintf(stderr, "bl_fasta_read_buffered(): Record truncated in desc %s.\n",
+		record->desc);
+	return BL_READ_TRUNCATED;
+    }
+    
+    /*
+     *  Read sequence lines.  Each line is appended to seq with one
+     *  memcpy() (one per block if a line spans blocks).
+     */
+    
+    record->seq_len = 0;
+    while ( ((ch = bl_fastx_reader_peek(reader)) != '>') && (ch != EOF) )
+    {
+	if ( bl_fastx_reader_append_line(reader, &record->seq,
+		&record->seq_array_size, &record->seq_len) == EOF )
+	    fprintf(stderr, "bl_fasta_read_buffered(): Missing newline at end of seq %s.\n",
+		    record->desc);
+    }
+    
+    /* Description with no sequence lines */
+    if ( record->seq_array_size == 0 )
+    {
+	record->seq_array_size = 1024;
+	record->seq = xt_malloc(record->seq_array_size, sizeof(*record->seq));
+	if ( record->seq == NULL )
+	{
+	    fprintf(stderr, "bl_fasta_read_buffered(): Could not allocate seq.\n");
+	    exit(EX_UNAVAILABLE);
+	}
+    }
+    record->seq[record->seq_len] = '\0';
+    return BL_READ_OK;
+}
+
+
 /***************************************************************************
  *  Name:
  *      bl_fasta_write() - Write a FASTA object
@@ -9,6 +9,10 @@ extern "C" {
 #include "biolibc.h"
 #endif
 
+#ifndef _BIOLIBC_FASTX_READER_H_
+#include "fastx-reader.h"
+#endif
+
 typedef struct
 {
     char    *desc;
@@ -28,6 +32,7 @@ typedef struct
 
 /* fasta.c */
 int bl_fasta_read(bl_fasta_t *record, FILE *fasta_stream);
+int bl_fasta_read_buffered(bl_fasta_t *record, bl_fastx_reader_t *reader);
 int bl_fasta_write(bl_fasta_t *record, FILE *fasta_stream, size_t chars_per_line);
 void bl_fasta_free(bl_fasta_t *record);
 void bl_fasta_init(bl_fasta_t *record);
@@ -265,6 +265,164 @@ int     bl_fastq_read(bl_fastq_t *record, FILE *fastq_stream)
 }
 
 
+/***************************************************************************
+ *  Name:
+ *      bl_fastq_read_buffered() - Read a FASTQ record using a block buffer
+ *
+ *  Library:
+ *      #include <biolibc/fastq.h>
+ *      -lbiolibc -lxtend
+ *
+ *  Description:
+ *      Read a FASTQ record through a bl_fastx_reader_t block buffer
+ *      attached to a stream by bl_fastx_reader_open(3).  The record
+ *      format and the contents of the bl_fastq_t structure are the same
+ *      as for bl_fastq_read(3), but input is read in large blocks and
+ *      each line is located with memchr(3) and copied with memcpy(3),
+ *      rather than processed one character at a time with getc(3).
+ *
+ *      Quality lines are read until the quality string is at least as
+ *      long as the sequence, so multiline quality strings containing
+ *      lines that begin with '@' are handled correctly.
+ *
+ *      Existing buffers in the record are reused and enlarged as needed,
+ *      but not trimmed.  Buffer memory should be freed as soon as
+ *      possible by calling bl_fastq_free(3).
+ *  
+ *  Arguments:
+ *      record          Pointer to a bl_fastq_t structure to receive data
+ *      reader          Pointer to a bl_fastx_reader_t block buffer
+ *
+ *  Returns:
+ *      BL_READ_OK upon successful read of description and sequence
+ *      BL_READ_BAD_DATA if something is amiss with input format
+ *      BL_READ_TRUNCATED if EOF is reached before the quality string
+ *      is as long as the sequence
+ *      BL_READ_EOF if no more data are available
+ *
+ *  Examples:
+ *      bl_fastx_reader_t   reader = BL_FASTX_READER_INIT;
+ *      bl_fastq_t          rec = BL_FASTQ_INIT;
+ *
+ *      bl_fastx_reader_open(&reader, stdin, 0);
+ *      while ( bl_fastq_read_buffered(&rec, &reader) != BL_READ_EOF )
+ *          bl_fastq_write(&rec, stdout, BL_FASTQ_LINE_UNLIMITED);
+ *      bl_fastq_free(&rec);
+ *      bl_fastx_reader_close(&reader);
+ *
+ *  See also:
+ *      bl_fastq_read(3), bl_fastx_reader_open(3), bl_fastq_write(3),
+ *      bl_fastq_free(3)
+ *
+ *  History: 
+ *  Date        Name        Modification
+ *  2026-10-17  agent       Begin
+ ***************************************************************************/
+
+int     bl_fastq_read_buffered(bl_fastq_t *record, bl_fastx_reader_t *reader)
+
+{
+    int     ch;
+    
+    /* Skip comment lines */
+    while ( (ch = bl_fastx_reader_peek(reader)) == ';' )
+	bl_fastx_reader_skip_line(reader);
+    
+    if ( ch == EOF )
+	return BL_READ_EOF;
+    
+    /* Every record should begin with a '@' */
+    if ( ch != '@' )
+	return BL_READ_BAD_DATA;
+
+    /*
+     *  Read description, including the '@', as with bl_fastq_read()
+     */
+    
+    ch = bl_fastx_reader_read_line(reader, &record->desc,
+				   &record->desc_array_size, &record->desc_len);
+    
+    /* Should not encounter EOF while reading description line */
+    /* Every description should be followed by at least one seq line */
+    if ( ch == EOF )
+    {
+	fprintf(stderr, "bl_fastq_read_buffered(): Record truncated in desc %s.\n",
+		record->desc);
+	return BL_READ_TRUNCATED;
+    }
+    
+    /*
+     *  Read sequence lines up to the + separator
+     */
+    
+    record->seq_len = 0;
+    while ( ((ch = bl_fastx_reader_peek(reader)) != '+') && (ch != EOF) )
+	bl_fastx_reader_append_line(reader, &record->seq,
+				    &record->seq_array_size, &record->seq_len);
+    
+    /* Should not encounter EOF while reading sequence lines */
+    /* Every sequence should be followed by a + separator line */
+    if ( ch == EOF )
+    {
+	fprintf(stderr, "bl_fastq_read_buffered(): Record truncated in seq %s.\n",
+		record->desc);
+	return BL_READ_TRUNCATED;
+    }
+    
+    /*
+     *  Read + separator
+     */
+    
+    ch = bl_fastx_reader_read_line(reader, &record->plus,
+				   &record->plus_array_size, &record->plus_len);
+    
+    /* Should not encounter EOF while reading plus line */
+    /* Every plus should be followed by at least one qual line */
+    if ( ch == EOF )
+    {
+	fprintf(stderr, "bl_fastq_read_buffered(): Record truncated in plus %s.\n",
+		record->plus);
+	return BL_READ_TRUNCATED;
+    }
+    
+    /*
+     *  Read quality string.  Read at least one full line, since '@' can
+     *  be a quality score, and continue until qual is as long as seq.
+     */
+    
+    record->qual_len = 0;
+    do
+    {
+	ch = bl_fastx_reader_append_line(reader, &record->qual,
+				    &record->qual_array_size, &record->qual_len);
+    }   while ( (ch != EOF) && (record->qual_len < record->seq_len) );
+    
+    if ( record->qual_len < record->seq_len )
+    {
+	fprintf(stderr, "bl_fastq_read_buffered(): Record truncated in qual %s.\n",
+		record->desc);
+	return BL_READ_TRUNCATED;
+    }
+    if ( ch == EOF )
+	fprintf(stderr, "bl_fastq_read_buffered(): Missing newline at end of qual %s.\n",
+		record->desc);
+    
+    /* Record with an empty sequence */
+    if ( record->seq_array_size == 0 )
+    {
+	record->seq_array_size = 1024;
+	record->seq = xt_malloc(record->seq_array_size, sizeof(*record->seq));
+	if ( record->seq == NULL )
+	{
+	    fprintf(stderr, "bl_fastq_read_buffered(): Could not allocate seq.\n");
+	    exit(EX_UNAVAILABLE);
+	}
+    }
+    record->seq[record->seq_len] = '\0';
+    return BL_READ_OK;
+}
+
+
 /***************************************************************************
  *  Name:
  *      bl_fastq_write() - Write a FASTQ record
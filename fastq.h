@@ -9,6 +9,10 @@ extern "C" {
 #include "biolibc.h"
 #endif
 
+#ifndef _BIOLIBC_FASTX_READER_H_
+#include "fastx-reader.h"
+#endif
+
 typedef struct
 {
     char    *desc,
@@ -36,6 +40,7 @@ typedef struct
 
 /* fastq.c */
 int bl_fastq_read(bl_fastq_t *record, FILE *fastq_stream);
+int bl_fastq_read_buffered(bl_fastq_t *record, bl_fastx_reader_t *reader);
 int bl_fastq_write(bl_fastq_t *record, FILE *fastq_stream, size_t max_line_len);
 void bl_fastq_free(bl_fastq_t *record);
 void bl_fastq_init(bl_fastq_t *record);
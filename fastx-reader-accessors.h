@@ -0,0 +1,17 @@
+    
+/*
+ *  Generated by /usr/local/bin/auto-gen-get-set
+ *
+ *  Accessor macros.  Use these to access structure members from functions
+ *  outside the bl_fastx_reader_t class.
+ *
+ *  These generated macros are not expected to be perfect.  Check and edit
+ *  as needed before adding to your code.
+ */
+
+#define BL_FASTX_READER_STREAM(ptr)     ((ptr)->stream)
+#define BL_FASTX_READER_BUFF(ptr)       ((ptr)->buff)
+#define BL_FASTX_READER_BUFF_SIZE(ptr)  ((ptr)->buff_size)
+#define BL_FASTX_READER_BUFF_LEN(ptr)   ((ptr)->buff_len)
+#define BL_FASTX_READER_BUFF_POS(ptr)   ((ptr)->buff_pos)
+#define BL_FASTX_READER_BUFF_OFFSET(ptr) ((ptr)->buff_offset)
@@ -0,0 +1,344 @@
+/***************************************************************************
+ *  This file is automatically generated by gen-get-set.  Be sure to keep
+ *  track of any manual changes.
+ *
+ *  These generated functions are not expected to be perfect.  Check and
+ *  edit as needed before adding to your code.
+ ***************************************************************************/
+
+#include <string.h>
+#include <ctype.h>
+#include <stdbool.h>        // In case of bool
+#include <stdint.h>         // In case of int64_t, etc
+#include <xtend/string.h>   // strlcpy() on Linux
+#include "fastx-reader.h"
+
+
+/***************************************************************************
+ *  Library:
+ *      #include <biolibc/fastx-reader.h>
+ *      -lbiolibc -lxtend
+ *
+ *  Description:
+ *      Mutator for stream member in a bl_fastx_reader_t structure.
+ *      Use this function to set stream in a bl_fastx_reader_t object
+ *      from non-member functions.  This function performs a direct
+ *      assignment for scalar or pointer structure members.  If
+ *      stream is a pointer, data previously pointed to should
+ *      be freed before calling this function to avoid memory
+ *      leaks.
+ *
+ *  Arguments:
+ *      bl_fastx_reader_ptr Pointer to the structure to set
+ *      new_stream      The new value for stream
+ *
+ *  Returns:
+ *      BL_FASTX_READER_DATA_OK if the new value is acceptable and assigned
+ *      BL_FASTX_READER_DATA_OUT_OF_RANGE otherwise
+ *
+ *  Examples:
+ *      bl_fastx_reader_t bl_fastx_reader;
+ *      FILE *          new_stream;
+ *
+ *      if ( bl_fastx_reader_set_stream(&bl_fastx_reader, new_stream)
+ *              == BL_FASTX_READER_DATA_OK )
+ *      {
+ *      }
+ *
+ *  See also:
+ *      (3)
+ *
+ *  History: 
+ *  Date        Name        Modification
+ *  2026-10-17  gen-get-set Auto-generated from fastx-reader.h
+ ***************************************************************************/
+
+int     bl_fastx_reader_set_stream(
+	    bl_fastx_reader_t *bl_fastx_reader_ptr,
+	    FILE *new_stream
+	)
+
+{
+    if ( new_stream == NULL )
+	return BL_FASTX_READER_DATA_OUT_OF_RANGE;
+    else
+    {
+	bl_fastx_reader_ptr->stream = new_stream;
+	return BL_FASTX_READER_DATA_OK;
+    }
+}
+
+
+/***************************************************************************
+ *  Library:
+ *      #include <biolibc/fastx-reader.h>
+ *      -lbiolibc -lxtend
+ *
+ *  Description:
+ *      Mutator for buff member in a bl_fastx_reader_t structure.
+ *      Use this function to set buff in a bl_fastx_reader_t object
+ *      from non-member functions.  This function performs a direct
+ *      assignment for scalar or pointer structure members.  If
+ *      buff is a pointer, data previously pointed to should
+ *      be freed before calling this function to avoid memory
+ *      leaks.
+ *
+ *  Arguments:
+ *      bl_fastx_reader_ptr Pointer to the structure to set
+ *      new_buff        The new value for buff
+ *
+ *  Returns:
+ *      BL_FASTX_READER_DATA_OK if the new value is acceptable and assigned
+ *      BL_FASTX_READER_DATA_OUT_OF_RANGE otherwise
+ *
+ *  Examples:
+ *      bl_fastx_reader_t bl_fastx_reader;
+ *      char *          new_buff;
+ *
+ *      if ( bl_fastx_reader_set_buff(&bl_fastx_reader, new_buff)
+ *              == BL_FASTX_READER_DATA_OK )
+ *      {
+ *      }
+ *
+ *  See also:
+ *      (3)
+ *
+ *  History: 
+ *  Date        Name        Modification
+ *  2026-10-17  gen-get-set Auto-generated from fastx-reader.h
+ ***************************************************************************/
+
+int     bl_fastx_reader_set_buff(
+	    bl_fastx_reader_t *bl_fastx_reader_ptr,
+	    char *new_buff
+	)
+
+{
+    if ( new_buff == NULL )
+	return BL_FASTX_READER_DATA_OUT_OF_RANGE;
+    else
+    {
+	bl_fastx_reader_ptr->buff = new_buff;
+	return BL_FASTX_READER_DATA_OK;
+    }
+}
+
+
+/***************************************************************************
+ *  Library:
+ *      #include <biolibc/fastx-reader.h>
+ *      -lbiolibc -lxtend
+ *
+ *  Description:
+ *      Mutator for buff_size member in a bl_fastx_reader_t structure.
+ *      Use this function to set buff_size in a bl_fastx_reader_t object
+ *      from non-member functions.  This function performs a direct
+ *      assignment for scalar or pointer structure members.  If
+ *      buff_size is a pointer, data previously pointed to should
+ *      be freed before calling this function to avoid memory
+ *      leaks.
+ *
+ *  Arguments:
+ *      bl_fastx_reader_ptr Pointer to the structure to set
+ *      new_buff_size   The new value for buff_size
+ *
+ *  Returns:
+ *      BL_FASTX_READER_DATA_OK if the new value is acceptable and assigned
+ *      BL_FASTX_READER_DATA_OUT_OF_RANGE otherwise
+ *
+ *  Examples:
+ *      bl_fastx_reader_t bl_fastx_reader;
+ *      size_t          new_buff_size;
+ *
+ *      if ( bl_fastx_reader_set_buff_size(&bl_fastx_reader, new_buff_size)
+ *              == BL_FASTX_READER_DATA_OK )
+ *      {
+ *      }
+ *
+ *  See also:
+ *      (3)
+ *
+ *  History: 
+ *  Date        Name        Modification
+ *  2026-10-17  gen-get-set Auto-generated from fastx-reader.h
+ ***************************************************************************/
+
+int     bl_fastx_reader_set_buff_size(
+	    bl_fastx_reader_t *bl_fastx_reader_ptr,
+	    size_t new_buff_size
+	)
+
+{
+    if ( false )
+	return BL_FASTX_READER_DATA_OUT_OF_RANGE;
+    else
+    {
+	bl_fastx_reader_ptr->buff_size = new_buff_size;
+	return BL_FASTX_READER_DATA_OK;
+    }
+}
+
+
+/***************************************************************************
+ *  Library:
+ *      #include <biolibc/fastx-reader.h>
+ *      -lbiolibc -lxtend
+ *
+ *  Description:
+ *      Mutator for buff_len member in a bl_fastx_reader_t structure.
+ *      Use this function to set buff_len in a bl_fastx_reader_t object
+ *      from non-member functions.  This function performs a direct
+ *      assignment for scalar or pointer structure members.  If
+ *      buff_len is a pointer, data previously pointed to should
+ *      be freed before calling this function to avoid memory
+ *      leaks.
+ *
+ *  Arguments:
+ *      bl_fastx_reader_ptr Pointer to the structure to set
+ *      new_buff_len    The new value for buff_len
+ *
+ *  Returns:
+ *      BL_FASTX_READER_DATA_OK if the new value is acceptable and assigned
+ *      BL_FASTX_READER_DATA_OUT_OF_RANGE otherwise
+ *
+ *  Examples:
+ *      bl_fastx_reader_t bl_fastx_reader;
+ *      size_t          new_buff_len;
+ *
+ *      if ( bl_fastx_reader_set_buff_len(&bl_fastx_reader, new_buff_len)
+ *              == BL_FASTX_READER_DATA_OK )
+ *      {
+ *      }
+ *
+ *  See also:
+ *      (3)
+ *
+ *  History: 
+ *  Date        Name        Modification
+ *  2026-10-17  gen-get-set Auto-generated from fastx-reader.h
+ ***************************************************************************/
+
+int     bl_fastx_reader_set_buff_len(
+	    bl_fastx_reader_t *bl_fastx_reader_ptr,
+	    size_t new_buff_len
+	)
+
+{
+    if ( false )
+	return BL_FASTX_READER_DATA_OUT_OF_RANGE;
+    else
+    {
+	bl_fastx_reader_ptr->buff_len = new_buff_len;
+	return BL_FASTX_READER_DATA_OK;
+    }
+}
+
+
+/***************************************************************************
+ *  Library:
+ *      #include <biolibc/fastx-reader.h>
+ *      -lbiolibc -lxtend
+ *
+ *  Description:
+ *      Mutator for buff_pos member in a bl_fastx_reader_t structure.
+ *      Use this function to set buff_pos in a bl_fastx_reader_t object
+ *      from non-member functions.  This function performs a direct
+ *      assignment for scalar or pointer structure members.  If
+ *      buff_pos is a pointer, data previously pointed to should
+ *      be freed before calling this function to avoid memory
+ *      leaks.
+ *
+ *  Arguments:
+ *      bl_fastx_reader_ptr Pointer to the structure to set
+ *      new_buff_pos    The new value for buff_pos
+ *
+ *  Returns:
+ *      BL_FASTX_READER_DATA_OK if the new value is acceptable and assigned
+ *      BL_FASTX_READER_DATA_OUT_OF_RANGE otherwise
+ *
+ *  Examples:
+ *      bl_fastx_reader_t bl_fastx_reader;
+ *      size_t          new_buff_pos;
+ *
+ *      if ( bl_fastx_reader_set_buff_pos(&bl_fastx_reader, new_buff_pos)
+ *              == BL_FASTX_READER_DATA_OK )
+ *      {
+ *      }
+ *
+ *  See also:
+ *      (3)
+ *
+ *  History: 
+ *  Date        Name        Modification
+ *  2026-10-17  gen-get-set Auto-generated from fastx-reader.h
+ ***************************************************************************/
+
+int     bl_fastx_reader_set_buff_pos(
+	    bl_fastx_reader_t *bl_fastx_reader_ptr,
+	    size_t new_buff_pos
+	)
+
+{
+    if ( false )
+	return BL_FASTX_READER_DATA_OUT_OF_RANGE;
+    else
+    {
+	bl_fastx_reader_ptr->buff_pos = new_buff_pos;
+	return BL_FASTX_READER_DATA_OK;
+    }
+}
+
+
+/***************************************************************************
+ *  Library:
+ *      #include <biolibc/fastx-reader.h>
+ *      -lbiolibc -lxtend
+ *
+ *  Description:
+ *      Mutator for buff_offset member in a bl_fastx_reader_t structure.
+ *      Use this function to set buff_offset in a bl_fastx_reader_t object
+ *      from non-member functions.  This function performs a direct
+ *      assignment for scalar or pointer structure members.  If
+ *      buff_offset is a pointer, data previously pointed to should
+ *      be freed before calling this function to avoid memory
+ *      leaks.
+ *
+ *  Arguments:
+ *      bl_fastx_reader_ptr Pointer to the structure to set
+ *      new_buff_offset The new value for buff_offset
+ *
+ *  Returns:
+ *      BL_FASTX_READER_DATA_OK if the new value is acceptable and assigned
+ *      BL_FASTX_READER_DATA_OUT_OF_RANGE otherwise
+ *
+ *  Examples:
+ *      bl_fastx_reader_t bl_fastx_reader;
+ *      int64_t         new_buff_offset;
+ *
+ *      if ( bl_fastx_reader_set_buff_offset(&bl_fastx_reader, new_buff_offset)
+ *              == BL_FASTX_READER_DATA_OK )
+ *      {
+ *      }
+ *
+ *  See also:
+ *      (3)
+ *
+ *  History: 
+ *  Date        Name        Modification
+ *  2026-10-17  gen-get-set Auto-generated from fastx-reader.h
+ ***************************************************************************/
+
+int     bl_fastx_reader_set_buff_offset(
+	    bl_fastx_reader_t *bl_fastx_reader_ptr,
+	    int64_t new_buff_offset
+	)
+
+{
+    if ( false )
+	return BL_FASTX_READER_DATA_OUT_OF_RANGE;
+    else
+    {
+	bl_fastx_reader_ptr->buff_offset = new_buff_offset;
+	return BL_FASTX_READER_DATA_OK;
+    }
+}
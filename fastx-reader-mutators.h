@@ -0,0 +1,22 @@
+
+/*
+ *  Generated by /usr/local/bin/auto-gen-get-set
+ *
+ *  Mutator functions for setting with no sanity checking.  Use these to
+ *  set structure members from functions outside the bl_fastx_reader_t
+ *  class.  These macros perform no data validation.  Hence, they achieve
+ *  maximum performance where data are guaranteed correct by other means.
+ *  Use the mutator functions (same name as the macro, but lower case)
+ *  for more robust code with a small performance penalty.
+ *
+ *  These generated macros are not expected to be perfect.  Check and edit
+ *  as needed before adding to your code.
+ */
+
+/* temp-fastx-reader-mutators.c */
+int bl_fastx_reader_set_stream(bl_fastx_reader_t *bl_fastx_reader_ptr, FILE *new_stream);
+int bl_fastx_reader_set_buff(bl_fastx_reader_t *bl_fastx_reader_ptr, char *new_buff);
+int bl_fastx_reader_set_buff_size(bl_fastx_reader_t *bl_fastx_reader_ptr, size_t new_buff_size);
+int bl_fastx_reader_set_buff_len(bl_fastx_reader_t *bl_fastx_reader_ptr, size_t new_buff_len);
+int bl_fastx_reader_set_buff_pos(bl_fastx_reader_t *bl_fastx_reader_ptr, size_t new_buff_pos);
+int bl_fastx_reader_set_buff_offset(bl_fastx_reader_t *bl_fastx_reader_ptr, int64_t new_buff_offset);
@@ -0,0 +1,417 @@
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <sysexits.h>
+#include <xtend/mem.h>
+#include "fastx-reader.h"
+
+/***************************************************************************
+ *  Name:
+ *      bl_fastx_reader_open() - Attach a block buffer to a FASTX stream
+ *
+ *  Library:
+ *      #include <biolibc/fastx-reader.h>
+ *      -lbiolibc -lxtend
+ *
+ *  Description:
+ *      Prepare a bl_fastx_reader_t object for block-buffered reading of
+ *      FASTA or FASTQ data from stream.  Input is read in blocks of
+ *      buff_size bytes using fread(3) and scanned for newlines with
+ *      memchr(3), which is much faster than reading one character at
+ *      a time with getc(3).  A buff_size of 0 selects the default,
+ *      BL_FASTX_READER_BLOCK_SIZE.
+ *
+ *      Once a stream is attached to a reader, it should only be read
+ *      through the reader, e.g. using bl_fasta_read_buffered(3) or
+ *      bl_fastq_read_buffered(3), since the reader may have consumed
+ *      data beyond the current record.
+ *
+ *      The buffer should be released with bl_fastx_reader_close(3) when
+ *      no longer needed.  The stream itself is not closed.
+ *
+ *  Arguments:
+ *      reader      Pointer to a bl_fastx_reader_t object
+ *      stream      FILE stream from which FASTA or FASTQ data are read
+ *      buff_size   Size of input blocks, 0 for default
+ *
+ *  Examples:
+ *      bl_fastx_reader_t   reader = BL_FASTX_READER_INIT;
+ *      bl_fasta_t          rec = BL_FASTA_INIT;
+ *
+ *      bl_fastx_reader_open(&reader, stdin, 0);
+ *      while ( bl_fasta_read_buffered(&rec, &reader) != BL_READ_EOF )
+ *          bl_fasta_write(&rec, stdout, BL_FASTA_LINE_UNLIMITED);
+ *      bl_fasta_free(&rec);
+ *      bl_fastx_reader_close(&reader);
+ *
+ *  See also:
+ *      bl_fastx_reader_close(3), bl_fasta_read_buffered(3),
+ *      bl_fastq_read_buffered(3)
+ *
+ *  History: 
+ *  Date        Name        Modification
+ *  2026-10-17  agent       Begin
+ ***************************************************************************/
+
+void    bl_fastx_reader_open(bl_fastx_reader_t *reader, FILE *stream,
+			     size_t buff_size)
+
+{
+    if ( buff_size == 0 )
+	buff_size = BL_FASTX_READER_BLOCK_SIZE;
+    
+    reader->stream = stream;
+    reader->buff_size = buff_size;
+    reader->buff = xt_malloc(reader->buff_size, sizeof(*reader->buff));
+    if ( reader->buff == NULL )
+    {
+	fprintf(stderr, "bl_fastx_reader_open(): Could not allocate buff.\n");
+	exit(EX_UNAVAILABLE);
+    }
+    reader->buff_len = 0;
+    reader->buff_pos = 0;
+    reader->buff_offset = 0;
+}
+
+
+/***************************************************************************
+ *  Name:
+ *      bl_fastx_reader_close() - Release a FASTX block buffer
+ *
+ *  Library:
+ *      #include <biolibc/fastx-reader.h>
+ *      -lbiolibc -lxtend
+ *
+ *  Description:
+ *      Free the block buffer attached by bl_fastx_reader_open(3) and
+ *      reinitialize the reader.  The underlying FILE stream is not closed.
+ *
+ *  Arguments:
+ *      reader      Pointer to a bl_fastx_reader_t object
+ *
+ *  Examples:
+ *      bl_fastx_reader_t   reader = BL_FASTX_READER_INIT;
+ *
+ *      bl_fastx_reader_open(&reader, stdin, 0);
+ *      ...
+ *      bl_fastx_reader_close(&reader);
+ *
+ *  See also:
+ *      bl_fastx_reader_open(3)
+ *
+ *  History: 
+ *  Date        Name        Modification
+ *  2026-10-17  agent       Begin
+ ***************************************************************************/
+
+void    bl_fastx_reader_close(bl_fastx_reader_t *reader)
+
+{
+    if ( reader->buff != NULL )
+	free(reader->buff);
+    reader->stream = NULL;
+    reader->buff = NULL;
+    reader->buff_size = 0;
+    reader->buff_len = 0;
+    reader->buff_pos = 0;
+    reader->buff_offset = 0;
+}
+
+
+/***************************************************************************
+ *  Name:
+ *      bl_fastx_reader_fill() - Read the next block into a FASTX reader
+ *
+ *  Library:
+ *      #include <biolibc/fastx-reader.h>
+ *      -lbiolibc -lxtend
+ *
+ *  Description:
+ *      Move any unparsed data to the front of the reader's buffer and
+ *      fill the remainder from the stream.  This is called automatically
+ *      by the other bl_fastx_reader_*() functions when the buffer is
+ *      exhausted and is rarely needed by applications.
+ *
+ *  Arguments:
+ *      reader      Pointer to a bl_fastx_reader_t object
+ *
+ *  Returns:
+ *      The number of new bytes read, 0 at EOF or upon read error
+ *
+ *  See also:
+ *      bl_fastx_reader_open(3), bl_fastx_reader_peek(3)
+ *
+ *  History: 
+ *  Date        Name        Modification
+ *  2026-10-17  agent       Begin
+ ***************************************************************************/
+
+size_t  bl_fastx_reader_fill(bl_fastx_reader_t *reader)
+
+{
+    size_t  remaining, count;
+    
+    remaining = reader->buff_len - reader->buff_pos;
+    if ( (remaining != 0) && (reader->buff_pos != 0) )
+	memmove(reader->buff, reader->buff + reader->buff_pos, remaining);
+    reader->buff_offset += reader->buff_pos;
+    reader->buff_pos = 0;
+    reader->buff_len = remaining;
+    
+    count = fread(reader->buff + remaining, 1,
+		  reader->buff_size - remaining, reader->stream);
+    reader->buff_len += count;
+    return count;
+}
+
+
+/***************************************************************************
+ *  Name:
+ *      bl_fastx_reader_peek() - Return next character without consuming it
+ *
+ *  Library:
+ *      #include <biolibc/fastx-reader.h>
+ *      -lbiolibc -lxtend
+ *
+ *  Description:
+ *      Return the next unparsed character from a FASTX reader, refilling
+ *      the buffer if necessary.  The character is not consumed, so
+ *      no ungetc(3) is needed when it turns out to begin the next record.
+ *
+ *  Arguments:
+ *      reader      Pointer to a bl_fastx_reader_t object
+ *
+ *  Returns:
+ *      The next character as an unsigned char cast to int, or EOF
+ *
+ *  See also:
+ *      bl_fastx_reader_open(3), bl_fastx_reader_read_line(3)
+ *
+ *  History: 
+ *  Date        Name        Modification
+ *  2026-10-17  agent       Begin
+ ***************************************************************************/
+
+int     bl_fastx_reader_peek(bl_fastx_reader_t *reader)
+
+{
+    if ( (reader->buff_pos == reader->buff_len) &&
+	 (bl_fastx_reader_fill(reader) == 0) )
+	return EOF;
+    return (unsigned char)reader->buff[reader->buff_pos];
+}
+
+
+/***************************************************************************
+ *  Name:
+ *      bl_fastx_reader_skip_line() - Discard the rest of the current line
+ *
+ *  Library:
+ *      #include <biolibc/fastx-reader.h>
+ *      -lbiolibc -lxtend
+ *
+ *  Description:
+ *      Consume input up to and including the next newline.
+ *
+ *  Arguments:
+ *      reader      Pointer to a bl_fastx_reader_t object
+ *
+ *  Returns:
+ *      '\n' if a newline was found, EOF otherwise
+ *
+ *  See also:
+ *      bl_fastx_reader_read_line(3)
+ *
+ *  History: 
+ *  Date        Name        Modification
+ *  2026-10-17  agent       Begin
+ ***************************************************************************/
+
+int     bl_fastx_reader_skip_line(bl_fastx_reader_t *reader)
+
+{
+    char    *start, *nl;
+    
+    while ( bl_fastx_reader_peek(reader) != EOF )
+    {
+	start = reader->buff + reader->buff_pos;
+	nl = memchr(start, '\n', reader->buff_len - reader->buff_pos);
+	if ( nl != NULL )
+	{
+	    reader->buff_pos += nl - start + 1;
+	    return '\n';
+	}
+	reader->buff_pos = reader->buff_len;
+    }
+    return EOF;
+}
+
+
+/***************************************************************************
+ *  Name:
+ *      bl_fastx_reader_read_line() - Read a line into a malloc()ed buffer
+ *
+ *  Library:
+ *      #include <biolibc/fastx-reader.h>
+ *      -lbiolibc -lxtend
+ *
+ *  Description:
+ *      Read the remainder of the current line into *buff, replacing
+ *      its previous contents.  The newline is consumed but not stored.
+ *      *buff is allocated or enlarged as needed and *array_size and *len
+ *      are updated accordingly.  See bl_fastx_reader_append_line(3).
+ *
+ *  Arguments:
+ *      reader      Pointer to a bl_fastx_reader_t object
+ *      buff        Address of a char pointer, NULL or malloc()ed
+ *      array_size  Address of the allocated size of *buff
+ *      len         Address of the string length of *buff
+ *
+ *  Returns:
+ *      '\n' if the line was terminated by a newline, EOF otherwise
+ *
+ *  See also:
+ *      bl_fastx_reader_append_line(3), bl_fastx_reader_skip_line(3)
+ *
+ *  History: 
+ *  Date        Name        Modification
+ *  2026-10-17  agent       Begin
+ ***************************************************************************/
+
+int     bl_fastx_reader_read_line(bl_fastx_reader_t *reader, char **buff,
+				  size_t *array_size, size_t *len)
+
+{
+    *len = 0;
+    return bl_fastx_reader_append_line(reader, buff, array_size, len);
+}
+
+
+/***************************************************************************
+ *  Name:
+ *      bl_fastx_reader_append_line() - Append a line to a malloc()ed buffer
+ *
+ *  Library:
+ *      #include <biolibc/fastx-reader.h>
+ *      -lbiolibc -lxtend
+ *
+ *  Description:
+ *      Append the remainder of the current line to *buff, starting at
+ *      (*buff)[*len].  The newline is consumed but not stored, so
+ *      repeated calls concatenate a multiline sequence.  Each line is
+ *      located with memchr(3) and copied with a single memcpy(3) per
+ *      buffer block.  *buff is enlarged as needed by doubling, so the
+ *      amortized cost per character is constant.
+ *
+ *  Arguments:
+ *      reader      Pointer to a bl_fastx_reader_t object
+ *      buff        Address of a char pointer, NULL or malloc()ed
+ *      array_size  Address of the allocated size of *buff
+ *      len         Address of the string length of *buff
+ *
+ *  Returns:
+ *      '\n' if the line was terminated by a newline, EOF otherwise
+ *
+ *  Examples:
+ *      // Concatenate sequence lines up to the next FASTA description
+ *      while ( ((ch = bl_fastx_reader_peek(&reader)) != '>') && (ch != EOF) )
+ *          bl_fastx_reader_append_line(&reader, &seq, &seq_array_size,
+ *                                      &seq_len);
+ *
+ *  See also:
+ *      bl_fastx_reader_read_line(3), bl_fastx_reader_peek(3)
+ *
+ *  History: 
+ *  Date        Name        Modification
+ *  2026-10-17  agent       Begin
+ ***************************************************************************/
+
+int     bl_fastx_reader_append_line(bl_fastx_reader_t *reader, char **buff,
+				    size_t *array_size, size_t *len)
+
+{
+    char    *start, *nl;
+    size_t  chunk;
+    
+    while ( bl_fastx_reader_peek(reader) != EOF )
+    {
+	start = reader->buff + reader->buff_pos;
+	nl = memchr(start, '\n', reader->buff_len - reader->buff_pos);
+	chunk = (nl == NULL) ? reader->buff_len - reader->buff_pos :
+			       (size_t)(nl - start);
+	
+	if ( *len + chunk + 1 > *array_size )
+	{
+	    if ( *array_size == 0 )
+		*array_size = 1024;
+	    while ( *len + chunk + 1 > *array_size )
+		*array_size *= 2;
+	    *buff = xt_realloc(*buff, *array_size, sizeof(**buff));
+	    if ( *buff == NULL )
+	    {
+		fprintf(stderr, "bl_fastx_reader_append_line(): Could not allocate buff.\n");
+		exit(EX_UNAVAILABLE);
+	    }
+	}
+	memcpy(*buff + *len, start, chunk);
+	*len += chunk;
+	(*buff)[*len] = '\0';
+	
+	if ( nl != NULL )
+	{
+	    reader->buff_pos += chunk + 1;
+	    return '\n';
+	}
+	reader->buff_pos = reader->buff_len;
+    }
+    
+    /* Make sure caller gets a valid string even if nothing was read */
+    if ( *array_size == 0 )
+    {
+	*array_size = 1024;
+	*buff = xt_malloc(*array_size, sizeof(**buff));
+	if ( *buff == NULL )
+	{
+	    fprintf(stderr, "bl_fastx_reader_append_line(): Could not allocate buff.\n");
+	    exit(EX_UNAVAILABLE);
+	}
+    }
+    (*buff)[*len] = '\0';
+    return EOF;
+}
+
+
+/***************************************************************************
+ *  Name:
+ *      bl_fastx_reader_tell() - Report stream offset of a FASTX reader
+ *
+ *  Library:
+ *      #include <biolibc/fastx-reader.h>
+ *      -lbiolibc -lxtend
+ *
+ *  Description:
+ *      Return the offset of the next unparsed byte, relative to the
+ *      position of the stream when bl_fastx_reader_open(3) was called.
+ *      This is the equivalent of ftell(3) for a stream read through
+ *      a reader, since ftell(3) on the stream itself reflects data
+ *      read ahead into the buffer.
+ *
+ *  Arguments:
+ *      reader      Pointer to a bl_fastx_reader_t object
+ *
+ *  Returns:
+ *      Offset of the next byte to be parsed
+ *
+ *  See also:
+ *      bl_fastx_reader_open(3), bl_fasta_index_build(3)
+ *
+ *  History: 
+ *  Date        Name        Modification
+ *  2026-10-17  agent       Begin
+ ***************************************************************************/
+
+int64_t bl_fastx_reader_tell(bl_fastx_reader_t *reader)
+
+{
+    return reader->buff_offset + reader->buff_pos;
+}
@@ -0,0 +1,51 @@
+#ifndef _BIOLIBC_FASTX_READER_H_
+#define _BIOLIBC_FASTX_READER_H_
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+#ifndef _BIOLIBC_H_
+#include "biolibc.h"
+#endif
+
+/*
+ *  Block-buffered input for FASTA and FASTQ parsers.  Data are read from
+ *  the stream in large blocks with fread() and scanned with memchr()
+ *  instead of one getc() call per character.
+ */
+
+typedef struct
+{
+    FILE    *stream;
+    char    *buff;
+    size_t  buff_size,      // Allocated size of buff
+	    buff_len,       // Bytes of valid data in buff
+	    buff_pos;       // Index of next unparsed byte in buff
+    int64_t buff_offset;    // Stream offset of buff[0]
+}   bl_fastx_reader_t;
+
+#define BL_FASTX_READER_INIT        { NULL, NULL, 0, 0, 0, 0 }
+
+// Large enough to amortize read(2) overhead, small enough to stay in L2/L3
+#define BL_FASTX_READER_BLOCK_SIZE  (4 * 1024 * 1024)
+
+#include "fastx-reader-rvs.h"
+#include "fastx-reader-accessors.h"
+#include "fastx-reader-mutators.h"
+
+/* fastx-reader.c */
+void bl_fastx_reader_open(bl_fastx_reader_t *reader, FILE *stream, size_t buff_size);
+void bl_fastx_reader_close(bl_fastx_reader_t *reader);
+size_t bl_fastx_reader_fill(bl_fastx_reader_t *reader);
+int bl_fastx_reader_peek(bl_fastx_reader_t *reader);
+int bl_fastx_reader_skip_line(bl_fastx_reader_t *reader);
+int bl_fastx_reader_read_line(bl_fastx_reader_t *reader, char **buff, size_t *array_size, size_t *len);
+int bl_fastx_reader_append_line(bl_fastx_reader_t *reader, char **buff, size_t *array_size, size_t *len);
+int64_t bl_fastx_reader_tell(bl_fastx_reader_t *reader);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif // _BIOLIBC_FASTX_READER_H_
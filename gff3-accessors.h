@@ -31,3 +31,9 @@
 #define BL_GFF3_FEATURE_PARENT(ptr)      ((ptr)->feature_parent)
 #define BL_GFF3_FEATURE_PARENT_AE(ptr,c) ((ptr)->feature_parent[c])
 #define BL_GFF3_FILE_POS(ptr)            ((ptr)->file_pos)
+#define BL_GFF3_CHROM_DICT(ptr)          ((ptr)->chrom_dict)
+#define BL_GFF3_SEQID_ID(ptr)            ((ptr)->seqid_id)
+#define BL_GFF3_ATTRIBUTE_TABLE(ptr)     ((ptr)->attribute_table)
+#define BL_GFF3_ATTRIBUTE_TABLE_AE(ptr,c) ((ptr)->attribute_table[c])
+#define BL_GFF3_ATTRIBUTE_COUNT(ptr)     ((ptr)->attribute_count)
+#define BL_GFF3_ATTRIBUTES_INDEXED(ptr)  ((ptr)->attributes_indexed)
@@ -0,0 +1,15 @@
+    
+/*
+ *  Generated by /usr/local/bin/auto-gen-get-set
+ *
+ *  Accessor macros.  Use these to access structure members from functions
+ *  outside the bl_gff3_graph_t class.
+ *
+ *  These generated macros are not expected to be perfect.  Check and edit
+ *  as needed before adding to your code.
+ */
+
+#define BL_GFF3_GRAPH_NODES(ptr)        ((ptr)->nodes)
+#define BL_GFF3_GRAPH_NODES_AE(ptr,c)   ((ptr)->nodes[c])
+#define BL_GFF3_GRAPH_COUNT(ptr)        ((ptr)->count)
+#define BL_GFF3_GRAPH_BUILT(ptr)        ((ptr)->built)
@@ -0,0 +1,292 @@
+/***************************************************************************
+ *  This file is automatically generated by gen-get-set.  Be sure to keep
+ *  track of any manual changes.
+ *
+ *  These generated functions are not expected to be perfect.  Check and
+ *  edit as needed before adding to your code.
+ ***************************************************************************/
+
+#include <string.h>
+#include <ctype.h>
+#include <stdbool.h>        // In case of bool
+#include <stdint.h>         // In case of int64_t, etc
+#include <xtend/string.h>   // strlcpy() on Linux
+#include "gff3-graph.h"
+
+
+/***************************************************************************
+ *  Library:
+ *      #include <biolibc/gff3-graph.h>
+ *      -lbiolibc -lxtend
+ *
+ *  Description:
+ *      Mutator for nodes member in a bl_gff3_graph_t structure.
+ *      Use this function to set nodes in a bl_gff3_graph_t object
+ *      from non-member functions.  This function performs a direct
+ *      assignment for scalar or pointer structure members.  If
+ *      nodes is a pointer, data previously pointed to should
+ *      be freed before calling this function to avoid memory
+ *      leaks.
+ *
+ *  Arguments:
+ *      bl_gff3_graph_ptr Pointer to the structure to set
+ *      new_nodes       The new value for nodes
+ *
+ *  Returns:
+ *      BL_GFF3_GRAPH_DATA_OK if the new value is acceptable and assigned
+ *      BL_GFF3_GRAPH_DATA_OUT_OF_RANGE otherwise
+ *
+ *  Examples:
+ *      bl_gff3_graph_t bl_gff3_graph;
+ *      bl_gff3_graph_node_t *      new_nodes;
+ *
+ *      if ( bl_gff3_graph_set_nodes(&bl_gff3_graph, new_nodes)
+ *              == BL_GFF3_GRAPH_DATA_OK )
+ *      {
+ *      }
+ *
+ *  See also:
+ *      (3)
+ *
+ *  History: 
+ *  Date        Name        Modification
+ *  2026-10-17  gen-get-set Auto-generated from gff3-graph.h
+ ***************************************************************************/
+
+int     bl_gff3_graph_set_nodes(
+	    bl_gff3_graph_t *bl_gff3_graph_ptr,
+	    bl_gff3_graph_node_t *new_nodes
+	)
+
+{
+    if ( new_nodes == NULL )
+	return BL_GFF3_GRAPH_DATA_OUT_OF_RANGE;
+    else
+    {
+	bl_gff3_graph_ptr->nodes = new_nodes;
+	return BL_GFF3_GRAPH_DATA_OK;
+    }
+}
+
+
+/***************************************************************************
+ *  Library:
+ *      #include <biolibc/gff3-graph.h>
+ *      -lbiolibc -lxtend
+ *
+ *  Description:
+ *      Mutator for an array element of nodes member in a bl_gff3_graph_t
+ *      structure. Use this function to set bl_gff3_graph_ptr->nodes[c]
+ *      in a bl_gff3_graph_t object from non-member functions.
+ *
+ *  Arguments:
+ *      bl_gff3_graph_ptr Pointer to the structure to set
+ *      c               Subscript to the nodes array
+ *      new_nodes_element The new value for nodes[c]
+ *
+ *  Returns:
+ *      BL_GFF3_GRAPH_DATA_OK if the new value is acceptable and assigned
+ *      BL_GFF3_GRAPH_DATA_OUT_OF_RANGE otherwise
+ *
+ *  Examples:
+ *      bl_gff3_graph_t bl_gff3_graph;
+ *      size_t          c;
+ *      bl_gff3_graph_node_t new_nodes_element;
+ *
+ *      if ( bl_gff3_graph_set_nodes_ae(&bl_gff3_graph, c, new_nodes_element)
+ *              == BL_GFF3_GRAPH_DATA_OK )
+ *      {
+ *      }
+ *
+ *  See also:
+ *      BL_GFF3_GRAPH_SET_NODES_AE(3)
+ *
+ *  History: 
+ *  Date        Name        Modification
+ *  2026-10-17  gen-get-set Auto-generated from gff3-graph.h
+ ***************************************************************************/
+
+int     bl_gff3_graph_set_nodes_ae(
+	    bl_gff3_graph_t *bl_gff3_graph_ptr,
+	    size_t c,
+	    bl_gff3_graph_node_t new_nodes_element
+	)
+
+{
+    if ( false )
+	return BL_GFF3_GRAPH_DATA_OUT_OF_RANGE;
+    else
+    {
+	bl_gff3_graph_ptr->nodes[c] = new_nodes_element;
+	return BL_GFF3_GRAPH_DATA_OK;
+    }
+}
+
+
+/***************************************************************************
+ *  Library:
+ *      #include <biolibc/gff3-graph.h>
+ *      -lbiolibc -lxtend
+ *
+ *  Description:
+ *      Mutator for nodes member in a bl_gff3_graph_t structure.
+ *      Use this function to set nodes in a bl_gff3_graph_t object
+ *      from non-member functions.  This function copies the array pointed to
+ *      by new_nodes to bl_gff3_graph_ptr->nodes.
+ *
+ *  Arguments:
+ *      bl_gff3_graph_ptr Pointer to the structure to set
+ *      new_nodes       The new value for nodes
+ *      array_size      Size of the nodes array.
+ *
+ *  Returns:
+ *      BL_GFF3_GRAPH_DATA_OK if the new value is acceptable and assigned
+ *      BL_GFF3_GRAPH_DATA_OUT_OF_RANGE otherwise
+ *
+ *  Examples:
+ *      bl_gff3_graph_t bl_gff3_graph;
+ *      bl_gff3_graph_node_t *      new_nodes;
+ *      size_t          array_size;
+ *
+ *      if ( bl_gff3_graph_set_nodes_cpy(&bl_gff3_graph, new_nodes, array_size)
+ *              == BL_GFF3_GRAPH_DATA_OK )
+ *      {
+ *      }
+ *
+ *  See also:
+ *      BL_GFF3_GRAPH_SET_NODES(3)
+ *
+ *  History: 
+ *  Date        Name        Modification
+ *  2026-10-17  gen-get-set Auto-generated from gff3-graph.h
+ ***************************************************************************/
+
+int     bl_gff3_graph_set_nodes_cpy(
+	    bl_gff3_graph_t *bl_gff3_graph_ptr,
+	    bl_gff3_graph_node_t *new_nodes,
+	    size_t array_size
+	)
+
+{
+    if ( new_nodes == NULL )
+	return BL_GFF3_GRAPH_DATA_OUT_OF_RANGE;
+    else
+    {
+	size_t  c;
+	
+	// FIXME: Assuming all elements should be copied
+	for (c = 0; c < array_size; ++c)
+	    bl_gff3_graph_ptr->nodes[c] = new_nodes[c];
+	return BL_GFF3_GRAPH_DATA_OK;
+    }
+}
+
+
+/***************************************************************************
+ *  Library:
+ *      #include <biolibc/gff3-graph.h>
+ *      -lbiolibc -lxtend
+ *
+ *  Description:
+ *      Mutator for count member in a bl_gff3_graph_t structure.
+ *      Use this function to set count in a bl_gff3_graph_t object
+ *      from non-member functions.  This function performs a direct
+ *      assignment for scalar or pointer structure members.  If
+ *      count is a pointer, data previously pointed to should
+ *      be freed before calling this function to avoid memory
+ *      leaks.
+ *
+ *  Arguments:
+ *      bl_gff3_graph_ptr Pointer to the structure to set
+ *      new_count       The new value for count
+ *
+ *  Returns:
+ *      BL_GFF3_GRAPH_DATA_OK if the new value is acceptable and assigned
+ *      BL_GFF3_GRAPH_DATA_OUT_OF_RANGE otherwise
+ *
+ *  Examples:
+ *      bl_gff3_graph_t bl_gff3_graph;
+ *      size_t          new_count;
+ *
+ *      if ( bl_gff3_graph_set_count(&bl_gff3_graph, new_count)
+ *              == BL_GFF3_GRAPH_DATA_OK )
+ *      {
+ *      }
+ *
+ *  See also:
+ *      (3)
+ *
+ *  History: 
+ *  Date        Name        Modification
+ *  2026-10-17  gen-get-set Auto-generated from gff3-graph.h
+ ***************************************************************************/
+
+int     bl_gff3_graph_set_count(
+	    bl_gff3_graph_t *bl_gff3_graph_ptr,
+	    size_t new_count
+	)
+
+{
+    if ( false )
+	return BL_GFF3_GRAPH_DATA_OUT_OF_RANGE;
+    else
+    {
+	bl_gff3_graph_ptr->count = new_count;
+	return BL_GFF3_GRAPH_DATA_OK;
+    }
+}
+
+
+/***************************************************************************
+ *  Library:
+ *      #include <biolibc/gff3-graph.h>
+ *      -lbiolibc -lxtend
+ *
+ *  Description:
+ *      Mutator for built member in a bl_gff3_graph_t structure.
+ *      Use this function to set built in a bl_gff3_graph_t object
+ *      from non-member functions.  This function performs a direct
+ *      assignment for scalar or pointer structure members.  If
+ *      built is a pointer, data previously pointed to should
+ *      be freed before calling this function to avoid memory
+ *      leaks.
+ *
+ *  Arguments:
+ *      bl_gff3_graph_ptr Pointer to the structure to set
+ *      new_built       The new value for built
+ *
+ *  Returns:
+ *      BL_GFF3_GRAPH_DATA_OK if the new value is acceptable and assigned
+ *      BL_GFF3_GRAPH_DATA_OUT_OF_RANGE otherwise
+ *
+ *  Examples:
+ *      bl_gff3_graph_t bl_gff3_graph;
+ *      bool            new_built;
+ *
+ *      if ( bl_gff3_graph_set_built(&bl_gff3_graph, new_built)
+ *              == BL_GFF3_GRAPH_DATA_OK )
+ *      {
+ *      }
+ *
+ *  See also:
+ *      (3)
+ *
+ *  History: 
+ *  Date        Name        Modification
+ *  2026-10-17  gen-get-set Auto-generated from gff3-graph.h
+ ***************************************************************************/
+
+int     bl_gff3_graph_set_built(
+	    bl_gff3_graph_t *bl_gff3_graph_ptr,
+	    bool new_built
+	)
+
+{
+    if ( false )
+	return BL_GFF3_GRAPH_DATA_OUT_OF_RANGE;
+    else
+    {
+	bl_gff3_graph_ptr->built = new_built;
+	return BL_GFF3_GRAPH_DATA_OK;
+    }
+}
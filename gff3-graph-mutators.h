@@ -0,0 +1,21 @@
+
+/*
+ *  Generated by /usr/local/bin/auto-gen-get-set
+ *
+ *  Mutator functions for setting with no sanity checking.  Use these to
+ *  set structure members from functions outside the bl_gff3_graph_t
+ *  class.  These macros perform no data validation.  Hence, they achieve
+ *  maximum performance where data are guaranteed correct by other means.
+ *  Use the mutator functions (same name as the macro, but lower case)
+ *  for more robust code with a small performance penalty.
+ *
+ *  These generated macros are not expected to be perfect.  Check and edit
+ *  as needed before adding to your code.
+ */
+
+/* temp-gff3-graph-mutators.c */
+int bl_gff3_graph_set_nodes(bl_gff3_graph_t *bl_gff3_graph_ptr, bl_gff3_graph_node_t *new_nodes);
+int bl_gff3_graph_set_nodes_ae(bl_gff3_graph_t *bl_gff3_graph_ptr, size_t c, bl_gff3_graph_node_t new_nodes_element);
+int bl_gff3_graph_set_nodes_cpy(bl_gff3_graph_t *bl_gff3_graph_ptr, bl_gff3_graph_node_t *new_nodes, size_t array_size);
+int bl_gff3_graph_set_count(bl_gff3_graph_t *bl_gff3_graph_ptr, size_t new_count);
+int bl_gff3_graph_set_built(bl_gff3_graph_t *bl_gff3_graph_ptr, bool new_built);
@@ -0,0 +1,768 @@
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <sysexits.h>
+#include <xtend/mem.h>
+#include "gff3-graph.h"
+
+/***************************************************************************
+ *  Name:
+ *      bl_gff3_graph_init() - Initialize a GFF3 feature graph
+ *
+ *  Library:
+ *      #include <biolibc/gff3-graph.h>
+ *      -lbiolibc -lxtend
+ *
+ *  Description:
+ *      Initialize an empty bl_gff3_graph_t object.  This is equivalent
+ *      to assigning BL_GFF3_GRAPH_INIT.
+ *
+ *  Arguments:
+ *      graph   Pointer to the bl_gff3_graph_t object to initialize
+ *
+ *  See also:
+ *      bl_gff3_graph_free(3), bl_gff3_graph_load(3)
+ *
+ *  History:
+ *  Date        Name        Modification
+ *  2026-10-17  agent       Begin
+ ***************************************************************************/
+
+void    bl_gff3_graph_init(bl_gff3_graph_t *graph)
+
+{
+    graph->nodes = NULL;
+    graph->count = 0;
+    graph->array_size = 0;
+    bl_chrom_dict_init(&graph->seqids);
+    bl_chrom_dict_init(&graph->types);
+    bl_chrom_dict_init(&graph->ids);
+    graph->id_nodes = NULL;
+    graph->child_offsets = NULL;
+    graph->children = NULL;
+    graph->parent_offsets = NULL;
+    graph->parents = NULL;
+    graph->built = false;
+    graph->visit_marks = NULL;
+    graph->visit_mark = 0;
+    graph->edges = NULL;
+    graph->edge_count = 0;
+    graph->edge_array_size = 0;
+    graph->parent_names = NULL;
+    graph->parent_names_len = 0;
+    graph->parent_names_size = 0;
+}
+
+
+/***************************************************************************
+ *  Name:
+ *      bl_gff3_graph_free() - Free memory held by a GFF3 feature graph
+ *
+ *  Library:
+ *      #include <biolibc/gff3-graph.h>
+ *      -lbiolibc -lxtend
+ *
+ *  Description:
+ *      Free all memory held by a bl_gff3_graph_t object and leave it
+ *      empty, ready for reuse.
+ *
+ *  Arguments:
+ *      graph   Pointer to the bl_gff3_graph_t object
+ *
+ *  See also:
+ *      bl_gff3_graph_init(3)
+ *
+ *  History:
+ *  Date        Name        Modification
+ *  2026-10-17  agent       Begin
+ ***************************************************************************/
+
+void    bl_gff3_graph_free(bl_gff3_graph_t *graph)
+
+{
+    free(graph->nodes);
+    bl_chrom_dict_free(&graph->seqids);
+    bl_chrom_dict_free(&graph->types);
+    bl_chrom_dict_free(&graph->ids);
+    free(graph->id_nodes);
+    free(graph->child_offsets);
+    free(graph->children);
+    free(graph->parent_offsets);
+    free(graph->parents);
+    free(graph->visit_marks);
+    free(graph->edges);
+    free(graph->parent_names);
+    bl_gff3_graph_init(graph);
+}
+
+
+/***************************************************************************
+ *  Name:
+ *      bl_gff3_graph_add() - Add a GFF3 feature to a feature graph
+ *
+ *  Library:
+ *      #include <biolibc/gff3-graph.h>
+ *      -lbiolibc -lxtend
+ *
+ *  Description:
+ *      Append feature to graph as a new node.  Its seqid, type, and ID are
+ *      interned, and the IDs listed in its Parent attribute, separated by
+ *      commas, are saved until bl_gff3_graph_build(3) links them.  If
+ *      several features share an ID, as the lines of a discontinuous CDS
+ *      do, the ID refers to the first.  Group terminators ("###") are
+ *      ignored.
+ *
+ *      Most applications will use bl_gff3_graph_load(3) instead.
+ *
+ *  Arguments:
+ *      graph   Pointer to a bl_gff3_graph_t object
+ *      feature Pointer to a feature read by bl_gff3_read(3)
+ *
+ *  Returns:
+ *      BL_GFF3_GRAPH_OK on success, BL_GFF3_GRAPH_MALLOC_FAILED otherwise
+ *
+ *  See also:
+ *      bl_gff3_graph_build(3), bl_gff3_graph_load(3)
+ *
+ *  History:
+ *  Date        Name        Modification
+ *  2026-10-17  agent       Begin
+ ***************************************************************************/
+
+int     bl_gff3_graph_add(bl_gff3_graph_t *graph, bl_gff3_t *feature)
+
+{
+    bl_gff3_graph_node_t    *node;
+    bl_gff3_graph_edge_t    *edge;
+    const char  *parents,
+		*name,
+		*end,
+		*limit;
+    size_t      len,
+		name_len;
+    int32_t     id,
+		previous_seqid = BL_CHROM_ID_NONE,
+		previous_type = BL_CHROM_ID_NONE;
+
+    if ( strcmp(BL_GFF3_TYPE(feature), "###") == 0 )
+	return BL_GFF3_GRAPH_OK;
+
+    if ( graph->count == graph->array_size )
+    {
+	graph->array_size = graph->array_size == 0 ?
+	    BL_GFF3_GRAPH_START_SIZE : graph->array_size * 2;
+	graph->nodes = xt_realloc(graph->nodes, graph->array_size,
+				  sizeof(*graph->nodes));
+	if ( graph->nodes == NULL )
+	    return BL_GFF3_GRAPH_MALLOC_FAILED;
+	// There are no more IDs than nodes
+	graph->id_nodes = xt_realloc(graph->id_nodes, graph->array_size,
+				     sizeof(*graph->id_nodes));
+	if ( graph->id_nodes == NULL )
+	    return BL_GFF3_GRAPH_MALLOC_FAILED;
+    }
+    if ( graph->count > 0 )
+    {
+	previous_seqid = graph->nodes[graph->count - 1].seqid_id;
+	previous_type = graph->nodes[graph->count - 1].type_id;
+    }
+    node = &graph->nodes[graph->count];
+    node->start = BL_GFF3_START(feature);
+    node->end = BL_GFF3_END(feature);
+    node->file_pos = BL_GFF3_FILE_POS(feature);
+    node->strand = BL_GFF3_STRAND(feature);
+    node->seqid_id = bl_chrom_dict_intern(&graph->seqids, previous_seqid,
+					  BL_GFF3_SEQID(feature));
+    node->type_id = bl_chrom_dict_intern(&graph->types, previous_type,
+					 BL_GFF3_TYPE(feature));
+
+    node->id = BL_CHROM_ID_NONE;
+    if ( (BL_GFF3_FEATURE_ID(feature) != NULL) &&
+	 (*BL_GFF3_FEATURE_ID(feature) != '\0') )
+    {
+	if ( (id = bl_chrom_dict_add(&graph->ids, BL_GFF3_FEATURE_ID(feature),
+				     0)) < 0 )
+	    return BL_GFF3_GRAPH_MALLOC_FAILED;
+	if ( (size_t)id == BL_CHROM_DICT_COUNT(&graph->ids) - 1 )
+	    graph->id_nodes[id] = graph->count;     // New ID
+	node->id = id;
+    }
+
+    // Save parent IDs for bl_gff3_graph_build()
+    if ( (parents = bl_gff3_find_attribute(feature, "Parent", &len)) != NULL )
+    {
+	limit = parents + len;
+	for (name = parents; name < limit; name = end + 1)
+	{
+	    for (end = name; (end < limit) && (*end != ','); ++end)
+		;
+	    if ( (name_len = end - name) == 0 )
+		continue;
+	    
+	    if ( graph->edge_count == graph->edge_array_size )
+	    {
+		graph->edge_array_size = graph->edge_array_size == 0 ?
+		    BL_GFF3_GRAPH_START_SIZE : graph->edge_array_size * 2;
+		graph->edges = xt_realloc(graph->edges, graph->edge_array_size,
+					  sizeof(*graph->edges));
+		if ( graph->edges == NULL )
+		    return BL_GFF3_GRAPH_MALLOC_FAILED;
+	    }
+	    while ( graph->parent_names_len + name_len + 1 >
+		    graph->parent_names_size )
+	    {
+		graph->parent_names_size = graph->parent_names_size == 0 ?
+		    BL_GFF3_GRAPH_START_SIZE * 16 :
+		    graph->parent_names_size * 2;
+		graph->parent_names = xt_realloc(graph->parent_names,
+		    graph->parent_names_size, sizeof(*graph->parent_names));
+		if ( graph->parent_names == NULL )
+		    return BL_GFF3_GRAPH_MALLOC_FAILED;
+	    }
+	    edge = &graph->edges[graph->edge_count++];
+	    edge->child = graph->count;
+	    edge->name_offset = graph->parent_names_len;
+	    memcpy(graph->parent_names + graph->parent_names_len, name,
+		   name_len);
+	    graph->parent_names_len += name_len;
+	    graph->parent_names[graph->parent_names_len++] = '\0';
+	}
+    }
+    ++graph->count;
+    graph->built = false;
+    return BL_GFF3_GRAPH_OK;
+}
+
+
+/***************************************************************************
+ *  Name:
+ *      bl_gff3_graph_load() - Load the feature hierarchy of a GFF3 file
+ *
+ *  Library:
+ *      #include <biolibc/gff3-graph.h>
+ *      -lbiolibc -lxtend
+ *
+ *  Description:
+ *      Read all features from gff3_stream, which must be positioned
+ *      after the header, e.g. by bl_gff3_skip_header(3), add them to
+ *      graph with bl_gff3_graph_add(3), and link them with
+ *      bl_gff3_graph_build(3).  The whole hierarchy is built in one pass
+ *      over the file, and the graph is then ready for queries.
+ *
+ *  Arguments:
+ *      graph       Pointer to an empty bl_gff3_graph_t object
+ *      gff3_stream FILE stream positioned at the first feature
+ *
+ *  Returns:
+ *      BL_GFF3_GRAPH_OK on success,
+ *      BL_GFF3_GRAPH_MALLOC_FAILED if memory could not be allocated,
+ *      BL_GFF3_GRAPH_BAD_DATA if a parent is not found or parent links
+ *      form a cycle
+ *
+ *  Examples:
+ *      bl_gff3_graph_t graph = BL_GFF3_GRAPH_INIT;
+ *      size_t          gene, *exons = NULL, exons_array_size = 0, count;
+ *
+ *      fclose(bl_gff3_skip_header(stream));
+ *      if ( bl_gff3_graph_load(&graph, stream) == BL_GFF3_GRAPH_OK )
+ *      {
+ *          gene = bl_gff3_graph_find(&graph, "gene:ENSDARG00000070713");
+ *          count = bl_gff3_graph_descendants(&graph, gene, "exon",
+ *                                            &exons, &exons_array_size);
+ *      }
+ *
+ *  See also:
+ *      bl_gff3_graph_find(3), bl_gff3_graph_descendants(3),
+ *      bl_gff3_graph_ancestor(3), bl_gff3_graph_free(3)
+ *
+ *  History:
+ *  Date        Name        Modification
+ *  2026-10-17  agent       Begin
+ ***************************************************************************/
+
+int     bl_gff3_graph_load(bl_gff3_graph_t *graph, FILE *gff3_stream)
+
+{
+    bl_gff3_t   feature;
+    int         status = BL_GFF3_GRAPH_OK;
+
+    bl_gff3_init(&feature);
+    while ( (status == BL_GFF3_GRAPH_OK) &&
+	    (bl_gff3_read(&feature, gff3_stream, BL_GFF3_FIELD_ALL)
+		== BL_READ_OK) )
+	status = bl_gff3_graph_add(graph, &feature);
+    bl_gff3_free(&feature);
+    if ( status != BL_GFF3_GRAPH_OK )
+	return status;
+    return bl_gff3_graph_build(graph);
+}
+
+
+/***************************************************************************
+ *  Name:
+ *      bl_gff3_graph_build() - Link the nodes of a GFF3 feature graph
+ *
+ *  Library:
+ *      #include <biolibc/gff3-graph.h>
+ *      -lbiolibc -lxtend
+ *
+ *  Description:
+ *      Resolve the parent IDs saved by bl_gff3_graph_add(3) and store
+ *      the links as CSR child and parent lists, each in node order.
+ *      Links are also checked for cycles, which GFF3 forbids, so that
+ *      queries always terminate.
+ *
+ *      This is called by bl_gff3_graph_load(3) and need only be called
+ *      by applications that add features with bl_gff3_graph_add(3),
+ *      after adding them.  It must be called again if more are added.
+ *
+ *  Arguments:
+ *      graph   Pointer to a bl_gff3_graph_t object
+ *
+ *  Returns:
+ *      BL_GFF3_GRAPH_OK on success,
+ *      BL_GFF3_GRAPH_MALLOC_FAILED if memory could not be allocated,
+ *      BL_GFF3_GRAPH_BAD_DATA if a parent is not found or parent links
+ *      form a cycle
+ *
+ *  See also:
+ *      bl_gff3_graph_add(3), bl_gff3_graph_load(3)
+ *
+ *  History:
+ *  Date        Name        Modification
+ *  2026-10-17  agent       Begin
+ ***************************************************************************/
+
+int     bl_gff3_graph_build(bl_gff3_graph_t *graph)
+
+{
+    size_t  c,
+	    n,
+	    parent,
+	    *fill,
+	    *queue,
+	    queued,
+	    *pending;
+    int32_t id;
+    const char  *name;
+
+    if ( graph->built )
+	return BL_GFF3_GRAPH_OK;
+
+    graph->child_offsets = xt_realloc(graph->child_offsets, graph->count + 1,
+				      sizeof(*graph->child_offsets));
+    graph->parent_offsets = xt_realloc(graph->parent_offsets,
+				       graph->count + 1,
+				       sizeof(*graph->parent_offsets));
+    graph->children = xt_realloc(graph->children, graph->edge_count + 1,
+				 sizeof(*graph->children));
+    graph->parents = xt_realloc(graph->parents, graph->edge_count + 1,
+				sizeof(*graph->parents));
+    graph->visit_marks = xt_realloc(graph->visit_marks, graph->count + 1,
+				    sizeof(*graph->visit_marks));
+    fill = xt_malloc(graph->count + 1, sizeof(*fill));
+    if ( (graph->child_offsets == NULL) || (graph->parent_offsets == NULL) ||
+	 (graph->children == NULL) || (graph->parents == NULL) ||
+	 (graph->visit_marks == NULL) || (fill == NULL) )
+    {
+	free(fill);
+	return BL_GFF3_GRAPH_MALLOC_FAILED;
+    }
+
+    // Replace each edge's parent name offset with the parent node
+    for (c = 0; c < graph->edge_count; ++c)
+    {
+	name = graph->parent_names + graph->edges[c].name_offset;
+	if ( (id = bl_chrom_dict_lookup(&graph->ids, name))
+		== BL_CHROM_ID_NONE )
+	{
+	    fprintf(stderr, "bl_gff3_graph_build(): Parent %s not found.\n",
+		    name);
+	    free(fill);
+	    return BL_GFF3_GRAPH_BAD_DATA;
+	}
+	graph->edges[c].parent = graph->id_nodes[id];
+    }
+
+    // Counting sort of edges by parent and by child.  Edges are added
+    // in child order, so both lists end up in node order.
+    for (n = 0; n <= graph->count; ++n)
+	graph->child_offsets[n] = graph->parent_offsets[n] = 0;
+    for (c = 0; c < graph->edge_count; ++c)
+    {
+	++graph->child_offsets[graph->edges[c].parent + 1];
+	++graph->parent_offsets[graph->edges[c].child + 1];
+    }
+    for (n = 0; n < graph->count; ++n)
+    {
+	graph->child_offsets[n + 1] += graph->child_offsets[n];
+	graph->parent_offsets[n + 1] += graph->parent_offsets[n];
+    }
+    for (n = 0; n < graph->count; ++n)
+	fill[n] = graph->child_offsets[n];
+    for (c = 0; c < graph->edge_count; ++c)
+    {
+	parent = graph->edges[c].parent;
+	graph->children[fill[parent]++] = graph->edges[c].child;
+	graph->parents[c] = parent;
+    }
+
+    // Kahn's algorithm: every node is reached only if there is no cycle
+    pending = fill;
+    for (n = 0; n < graph->count; ++n)
+	pending[n] = BL_GFF3_GRAPH_PARENT_COUNT(graph, n);
+    if ( (queue = xt_malloc(graph->count + 1, sizeof(*queue))) == NULL )
+    {
+	free(fill);
+	return BL_GFF3_GRAPH_MALLOC_FAILED;
+    }
+    for (n = 0, queued = 0; n < graph->count; ++n)
+	if ( pending[n] == 0 )
+	    queue[queued++] = n;
+    for (c = 0; c < queued; ++c)
+	for (n = graph->child_offsets[queue[c]];
+	     n < graph->child_offsets[queue[c] + 1]; ++n)
+	    if ( --pending[graph->children[n]] == 0 )
+		queue[queued++] = graph->children[n];
+    free(queue);
+    free(fill);
+    if ( queued != graph->count )
+    {
+	fprintf(stderr, "bl_gff3_graph_build(): Parent links form a cycle.\n");
+	return BL_GFF3_GRAPH_BAD_DATA;
+    }
+
+    memset(graph->visit_marks, 0, graph->count * sizeof(*graph->visit_marks));
+    graph->visit_mark = 0;
+    graph->built = true;
+    return BL_GFF3_GRAPH_OK;
+}
+
+
+/***************************************************************************
+ *  Name:
+ *      bl_gff3_graph_find() - Find a GFF3 graph node by ID
+ *
+ *  Library:
+ *      #include <biolibc/gff3-graph.h>
+ *      -lbiolibc -lxtend
+ *
+ *  Description:
+ *      Return the node of the feature whose ID attribute is id, using
+ *      the hash table of the ID dictionary.  If several features share
+ *      the ID, the first is returned.
+ *
+ *  Arguments:
+ *      graph   Pointer to a bl_gff3_graph_t object
+ *      id      Feature ID, e.g. "gene:ENSDARG00000070713"
+ *
+ *  Returns:
+ *      Node index, or BL_GFF3_GRAPH_NONE if id is not found
+ *
+ *  See also:
+ *      bl_gff3_graph_load(3), bl_gff3_graph_descendants(3)
+ *
+ *  History:
+ *  Date        Name        Modification
+ *  2026-10-17  agent       Begin
+ ***************************************************************************/
+
+size_t  bl_gff3_graph_find(bl_gff3_graph_t *graph, const char *id)
+
+{
+    int32_t dict_id;
+
+    if ( (dict_id = bl_chrom_dict_lookup(&graph->ids, id))
+	    == BL_CHROM_ID_NONE )
+	return BL_GFF3_GRAPH_NONE;
+    return graph->id_nodes[dict_id];
+}
+
+
+/***************************************************************************
+ *  Name:
+ *      bl_gff3_graph_children() - Get the children of a GFF3 graph node
+ *
+ *  Library:
+ *      #include <biolibc/gff3-graph.h>
+ *      -lbiolibc -lxtend
+ *
+ *  Description:
+ *      Return the nodes whose Parent attribute lists node, in node (file)
+ *      order.  The list points into graph and must not be modified.
+ *      The graph must have been built by bl_gff3_graph_load(3) or
+ *      bl_gff3_graph_build(3).
+ *
+ *  Arguments:
+ *      graph   Pointer to a bl_gff3_graph_t object
+ *      node    Index of a node in graph
+ *      count   Address of a size_t to receive the number of children
+ *
+ *  Returns:
+ *      Pointer to the first of count child node indexes
+ *
+ *  Examples:
+ *      const size_t    *transcripts;
+ *      size_t          count, c;
+ *
+ *      transcripts = bl_gff3_graph_children(&graph, gene, &count);
+ *      for (c = 0; c < count; ++c)
+ *          puts(BL_GFF3_GRAPH_ID(&graph, transcripts[c]));
+ *
+ *  See also:
+ *      bl_gff3_graph_parents(3), bl_gff3_graph_descendants(3)
+ *
+ *  History:
+ *  Date        Name        Modification
+ *  2026-10-17  agent       Begin
+ ***************************************************************************/
+
+const size_t *bl_gff3_graph_children(bl_gff3_graph_t *graph, size_t node,
+				     size_t *count)
+
+{
+    *count = BL_GFF3_GRAPH_CHILD_COUNT(graph, node);
+    return graph->children + graph->child_offsets[node];
+}
+
+
+/***************************************************************************
+ *  Name:
+ *      bl_gff3_graph_parents() - Get the parents of a GFF3 graph node
+ *
+ *  Library:
+ *      #include <biolibc/gff3-graph.h>
+ *      -lbiolibc -lxtend
+ *
+ *  Description:
+ *      Return the nodes listed in the Parent attribute of node, in the
+ *      order listed.  The list points into graph and must not be
+ *      modified.  The graph must have been built by bl_gff3_graph_load(3)
+ *      or bl_gff3_graph_build(3).
+ *
+ *  Arguments:
+ *      graph   Pointer to a bl_gff3_graph_t object
+ *      node    Index of a node in graph
+ *      count   Address of a size_t to receive the number of parents
+ *
+ *  Returns:
+ *      Pointer to the first of count parent node indexes
+ *
+ *  See also:
+ *      bl_gff3_graph_children(3), bl_gff3_graph_ancestor(3)
+ *
+ *  History:
+ *  Date        Name        Modification
+ *  2026-10-17  agent       Begin
+ ***************************************************************************/
+
+const size_t *bl_gff3_graph_parents(bl_gff3_graph_t *graph, size_t node,
+				    size_t *count)
+
+{
+    *count = BL_GFF3_GRAPH_PARENT_COUNT(graph, node);
+    return graph->parents + graph->parent_offsets[node];
+}
+
+
+/***************************************************************************
+ *  Name:
+ *      bl_gff3_graph_descendants() - Find descendants of a given type
+ *
+ *  Library:
+ *      #include <biolibc/gff3-graph.h>
+ *      -lbiolibc -lxtend
+ *
+ *  Description:
+ *      Find all nodes of the given type, such as "exon", below node in
+ *      the hierarchy, e.g. all exons of a gene, through any number of
+ *      levels.  A node reached by more than one path, such as an exon
+ *      shared by two transcripts, is reported once.  Hits are stored in
+ *      node (file) order in *hits, which is extended as needed, so it
+ *      can be reused across calls to avoid repeated allocation.
+ *
+ *      Nodes are marked as they are found, so each descendant and its
+ *      subtree are visited once however many paths lead to it.  The marks
+ *      are kept in graph, so concurrent calls on the same graph are not
+ *      safe.
+ *
+ *  Arguments:
+ *      graph           Pointer to a bl_gff3_graph_t object
+ *      node            Index of the node whose descendants are wanted
+ *      type            Feature type to report, or NULL for all
+ *      hits            Address of a size_t array, initially NULL
+ *      hits_array_size Address of the allocated size of *hits,
+ *                      initially 0
+ *
+ *  Returns:
+ *      The number of hits stored in *hits
+ *
+ *  Examples:
+ *      size_t  *exons = NULL, exons_array_size = 0, count, c, gene;
+ *
+ *      gene = bl_gff3_graph_find(&graph, "gene:ENSDARG00000070713");
+ *      count = bl_gff3_graph_descendants(&graph, gene, "exon",
+ *                                        &exons, &exons_array_size);
+ *      for (c = 0; c < count; ++c)
+ *          printf("%" PRId64 "\n", graph.nodes[exons[c]].start);
+ *      free(exons);
+ *
+ *  See also:
+ *      bl_gff3_graph_ancestor(3), bl_gff3_graph_children(3)
+ *
+ *  History:
+ *  Date        Name        Modification
+ *  2026-10-17  agent       Begin
+ *  2026-10-17  agent       Visit nodes reached by several paths once
+ ***************************************************************************/
+
+size_t  bl_gff3_graph_descendants(bl_gff3_graph_t *graph, size_t node,
+				  const char *type, size_t **hits,
+				  size_t *hits_array_size)
+
+{
+    size_t  visited,
+	    count,
+	    child,
+	    c,
+	    n;
+    int32_t type_id = BL_CHROM_ID_NONE;
+
+    if ( (type != NULL) &&
+	 ((type_id = bl_chrom_dict_lookup(&graph->types, type))
+	    == BL_CHROM_ID_NONE) )
+	return 0;
+
+    // A new stamp marks this search's nodes without clearing old marks
+    if ( ++graph->visit_mark == 0 )
+    {
+	memset(graph->visit_marks, 0,
+	       graph->count * sizeof(*graph->visit_marks));
+	graph->visit_mark = 1;
+    }
+    graph->visit_marks[node] = graph->visit_mark;
+
+    // Breadth-first, using *hits as the queue
+    count = 0;
+    for (visited = 0, n = node; ; n = (*hits)[visited++])
+    {
+	for (c = graph->child_offsets[n]; c < graph->child_offsets[n + 1]; ++c)
+	{
+	    child = graph->children[c];
+	    if ( graph->visit_marks[child] == graph->visit_mark )
+		continue;
+	    graph->visit_marks[child] = graph->visit_mark;
+	    if ( count == *hits_array_size )
+	    {
+		*hits_array_size = *hits_array_size == 0 ? 64 :
+				   *hits_array_size * 2;
+		if ( (*hits = xt_realloc(*hits, *hits_array_size,
+					 sizeof(**hits))) == NULL )
+		{
+		    fprintf(stderr, "bl_gff3_graph_descendants(): Could not allocate hits.\n");
+		    exit(EX_UNAVAILABLE);
+		}
+	    }
+	    (*hits)[count++] = child;
+	}
+	if ( visited == count )
+	    break;
+    }
+
+    // Keep matching types, in node order
+    for (c = 0, n = 0; c < count; ++c)
+	if ( (type == NULL) || (graph->nodes[(*hits)[c]].type_id == type_id) )
+	    (*hits)[n++] = (*hits)[c];
+    qsort(*hits, n, sizeof(**hits),
+	  (int (*)(const void *,const void *))bl_gff3_graph_node_cmp);
+    return n;
+}
+
+
+/***************************************************************************
+ *  Name:
+ *      bl_gff3_graph_ancestor() - Find the ancestor of a given type
+ *
+ *  Library:
+ *      #include <biolibc/gff3-graph.h>
+ *      -lbiolibc -lxtend
+ *
+ *  Description:
+ *      Follow first parents up from node until a node of the given type,
+ *      such as "gene", is found, e.g. to find the gene of an exon.  Where
+ *      a feature has several parents, they normally share the ancestor
+ *      sought, so only the first is followed.
+ *
+ *  Arguments:
+ *      graph   Pointer to a bl_gff3_graph_t object
+ *      node    Index of the node whose ancestor is wanted
+ *      type    Feature type to find
+ *
+ *  Returns:
+ *      Index of the nearest ancestor of type, or BL_GFF3_GRAPH_NONE
+ *
+ *  Examples:
+ *      size_t  gene;
+ *
+ *      if ( (gene = bl_gff3_graph_ancestor(&graph, exon, "gene"))
+ *              != BL_GFF3_GRAPH_NONE )
+ *          puts(BL_GFF3_GRAPH_ID(&graph, gene));
+ *
+ *  See also:
+ *      bl_gff3_graph_descendants(3), bl_gff3_graph_parents(3)
+ *
+ *  History:
+ *  Date        Name        Modification
+ *  2026-10-17  agent       Begin
+ ***************************************************************************/
+
+size_t  bl_gff3_graph_ancestor(bl_gff3_graph_t *graph, size_t node,
+			       const char *type)
+
+{
+    int32_t type_id;
+
+    if ( (type_id = bl_chrom_dict_lookup(&graph->types, type))
+	    == BL_CHROM_ID_NONE )
+	return BL_GFF3_GRAPH_NONE;
+    while ( BL_GFF3_GRAPH_PARENT_COUNT(graph, node) > 0 )
+    {
+	node = graph->parents[graph->parent_offsets[node]];
+	if ( graph->nodes[node].type_id == type_id )
+	    return node;
+    }
+    return BL_GFF3_GRAPH_NONE;
+}
+
+
+/***************************************************************************
+ *  Name:
+ *      bl_gff3_graph_node_cmp() - Compare GFF3 graph node indexes
+ *
+ *  Library:
+ *      #include <biolibc/gff3-graph.h>
+ *      -lbiolibc -lxtend
+ *
+ *  Description:
+ *      qsort(3) comparison function for node indexes, used to put the
+ *      results of bl_gff3_graph_descendants(3) in file order.
+ *
+ *  Arguments:
+ *      node1, node2    Pointers to node indexes
+ *
+ *  Returns:
+ *      A value < 0 if *node1 < *node2, > 0 if greater, 0 otherwise
+ *
+ *  See also:
+ *      bl_gff3_graph_descendants(3)
+ *
+ *  History:
+ *  Date        Name        Modification
+ *  2026-10-17  agent       Begin
+ ***************************************************************************/
+
+int     bl_gff3_graph_node_cmp(const size_t *node1, const size_t *node2)
+
+{
+    return *node1 < *node2 ? -1 : *node1 > *node2 ? 1 : 0;
+}
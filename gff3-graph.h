@@ -0,0 +1,130 @@
+#ifndef _BIOLIBC_GFF3_GRAPH_H_
+#define _BIOLIBC_GFF3_GRAPH_H_
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+#ifndef _STDIO_H_
+#include <stdio.h>
+#endif
+
+#ifndef _BIOLIBC_GFF3_H_
+#include "gff3.h"
+#endif
+
+#ifndef _BIOLIBC_CHROM_DICT_H_
+#include "chrom-dict.h"
+#endif
+
+/*
+ *  Feature hierarchy of a GFF3 file (gene -> transcript -> exon, etc.)
+ *  Each feature is a node in one contiguous array, in file order, holding
+ *  only position data.  The full feature can be reread via file_pos.
+ *  Seqids, types, and IDs are interned in chromosome dictionaries, the
+ *  ID dictionary serving as the hash map from ID to node.  Parent links
+ *  are stored in both directions as CSR (compressed sparse row) lists:
+ *  the children of node n are children[child_offsets[n]] through
+ *  children[child_offsets[n + 1] - 1], and likewise for parents.
+ *
+ *  Parents are resolved by bl_gff3_graph_build() after all features are
+ *  added, so a parent may follow its children in the file.
+ */
+
+#define BL_GFF3_GRAPH_START_SIZE    1024
+
+#define BL_GFF3_GRAPH_NONE          ((size_t)-1)
+
+#define BL_GFF3_GRAPH_OK            0
+#define BL_GFF3_GRAPH_MALLOC_FAILED -1
+#define BL_GFF3_GRAPH_BAD_DATA      -2  // Unknown parent or cycle
+
+typedef struct
+{
+    int64_t     start,
+		end;
+    long        file_pos;   // Return type of ftell()
+    int32_t     seqid_id,   // Index into seqids dictionary
+		type_id,    // Index into types dictionary
+		id;         // Index into ids, or BL_CHROM_ID_NONE
+    char        strand;
+}   bl_gff3_graph_node_t;
+
+// Parent reference, resolved by bl_gff3_graph_build()
+typedef struct
+{
+    size_t      child,
+		name_offset,    // Into parent_names
+		parent;
+}   bl_gff3_graph_edge_t;
+
+typedef struct
+{
+    bl_gff3_graph_node_t    *nodes;
+    size_t          count,
+		    array_size;
+    bl_chrom_dict_t seqids,
+		    types,
+		    ids;
+    size_t          *id_nodes;  // First node with each ID
+
+    // CSR adjacency, set by bl_gff3_graph_build()
+    size_t          *child_offsets,
+		    *children,
+		    *parent_offsets,
+		    *parents;
+    bool            built;
+    
+    // Nodes stamped with visit_mark were seen by the current search
+    unsigned        *visit_marks;
+    unsigned        visit_mark;
+
+    // One per parent listed by each node, in node order
+    bl_gff3_graph_edge_t    *edges;
+    size_t          edge_count,
+		    edge_array_size;
+    char            *parent_names;  // NUL-separated
+    size_t          parent_names_len,
+		    parent_names_size;
+}   bl_gff3_graph_t;
+
+#define BL_GFF3_GRAPH_INIT \
+	{ NULL, 0, 0, BL_CHROM_DICT_INIT, BL_CHROM_DICT_INIT, \
+	  BL_CHROM_DICT_INIT, NULL, NULL, NULL, NULL, NULL, false, \
+	  NULL, 0, NULL, 0, 0, NULL, 0, 0 }
+
+// Names of node n's fields, and its ID or NULL
+#define BL_GFF3_GRAPH_SEQID(ptr,n) \
+	(BL_CHROM_DICT_NAMES_AE(&(ptr)->seqids, (ptr)->nodes[n].seqid_id))
+#define BL_GFF3_GRAPH_TYPE(ptr,n) \
+	(BL_CHROM_DICT_NAMES_AE(&(ptr)->types, (ptr)->nodes[n].type_id))
+#define BL_GFF3_GRAPH_ID(ptr,n) \
+	((ptr)->nodes[n].id == BL_CHROM_ID_NONE ? NULL : \
+	 BL_CHROM_DICT_NAMES_AE(&(ptr)->ids, (ptr)->nodes[n].id))
+#define BL_GFF3_GRAPH_CHILD_COUNT(ptr,n) \
+	((ptr)->child_offsets[(n) + 1] - (ptr)->child_offsets[n])
+#define BL_GFF3_GRAPH_PARENT_COUNT(ptr,n) \
+	((ptr)->parent_offsets[(n) + 1] - (ptr)->parent_offsets[n])
+
+#include "gff3-graph-rvs.h"
+#include "gff3-graph-accessors.h"
+#include "gff3-graph-mutators.h"
+
+/* gff3-graph.c */
+void bl_gff3_graph_init(bl_gff3_graph_t *graph);
+void bl_gff3_graph_free(bl_gff3_graph_t *graph);
+int bl_gff3_graph_add(bl_gff3_graph_t *graph, bl_gff3_t *feature);
+int bl_gff3_graph_load(bl_gff3_graph_t *graph, FILE *gff3_stream);
+int bl_gff3_graph_build(bl_gff3_graph_t *graph);
+size_t bl_gff3_graph_find(bl_gff3_graph_t *graph, const char *id);
+const size_t *bl_gff3_graph_children(bl_gff3_graph_t *graph, size_t node, size_t *count);
+const size_t *bl_gff3_graph_parents(bl_gff3_graph_t *graph, size_t node, size_t *count);
+size_t bl_gff3_graph_descendants(bl_gff3_graph_t *graph, size_t node, const char *type, size_t **hits, size_t *hits_array_size);
+size_t bl_gff3_graph_ancestor(bl_gff3_graph_t *graph, size_t node, const char *type);
+int bl_gff3_graph_node_cmp(const size_t *node1, const size_t *node2);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif // _BIOLIBC_GFF3_GRAPH_H_
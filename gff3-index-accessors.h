@@ -13,8 +13,8 @@
 #define BL_GFF3_INDEX_COUNT(ptr)         ((ptr)->count)
 #define BL_GFF3_INDEX_FILE_POS(ptr)      ((ptr)->file_pos)
 #define BL_GFF3_INDEX_FILE_POS_AE(ptr,c) ((ptr)->file_pos[c])
-#define BL_GFF3_INDEX_SEQID(ptr)         ((ptr)->seqid)
-#define BL_GFF3_INDEX_SEQID_AE(ptr,c)    ((ptr)->seqid[c])
+#define BL_GFF3_INDEX_SEQID_IDS(ptr)     ((ptr)->seqid_ids)
+#define BL_GFF3_INDEX_SEQID_IDS_AE(ptr,c) ((ptr)->seqid_ids[c])
 #define BL_GFF3_INDEX_START(ptr)         ((ptr)->start)
 #define BL_GFF3_INDEX_START_AE(ptr,c)    ((ptr)->start[c])
 #define BL_GFF3_INDEX_END(ptr)           ((ptr)->end)
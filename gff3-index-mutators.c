@@ -298,27 +298,27 @@ int     bl_gff3_index_set_file_pos_cpy(
  *      -lbiolibc -lxtend
  *
  *  Description:
- *      Mutator for seqid member in a bl_gff3_index_t structure.
- *      Use this function to set seqid in a bl_gff3_index_t object
+ *      Mutator for seqid_ids member in a bl_gff3_index_t structure.
+ *      Use this function to set seqid_ids in a bl_gff3_index_t object
  *      from non-member functions.  This function performs a direct
  *      assignment for scalar or pointer structure members.  If
- *      seqid is a pointer, data previously pointed to should
+ *      seqid_ids is a pointer, data previously pointed to should
  *      be freed before calling this function to avoid memory
  *      leaks.
  *
  *  Arguments:
  *      bl_gff3_index_ptr Pointer to the structure to set
- *      new_seqid       The new value for seqid
+ *      new_seqid_ids   The new value for seqid_ids
  *
  *  Returns:
  *      BL_GFF3_INDEX_DATA_OK if the new value is acceptable and assigned
  *      BL_GFF3_INDEX_DATA_OUT_OF_RANGE otherwise
  *
  *  Examples:
- *      bl_gff3_index_t  bl_gff3_index;
- *      char **         new_seqid;
+ *      bl_gff3_index_t bl_gff3_index;
+ *      int32_t *       new_seqid_ids;
  *
- *      if ( bl_gff3_index_set_seqid(&bl_gff3_index, new_seqid)
+ *      if ( bl_gff3_index_set_seqid_ids(&bl_gff3_index, new_seqid_ids)
  *              == BL_GFF3_INDEX_DATA_OK )
  *      {
  *      }
@@ -328,20 +328,20 @@ int     bl_gff3_index_set_file_pos_cpy(
  *
  *  History: 
  *  Date        Name        Modification
- *  2022-02-07  gen-get-set Auto-generated from gff3-index.h
+ *  2026-10-17  gen-get-set Auto-generated from gff3-index.h
  ***************************************************************************/
 
-int     bl_gff3_index_set_seqid(
+int     bl_gff3_index_set_seqid_ids(
 	    bl_gff3_index_t *bl_gff3_index_ptr,
-	    char ** new_seqid
+	    int32_t *new_seqid_ids
 	)
 
 {
-    if ( new_seqid == NULL )
+    if ( new_seqid_ids == NULL )
 	return BL_GFF3_INDEX_DATA_OUT_OF_RANGE;
     else
     {
-	bl_gff3_index_ptr->seqid = new_seqid;
+	bl_gff3_index_ptr->seqid_ids = new_seqid_ids;
 	return BL_GFF3_INDEX_DATA_OK;
     }
 }
@@ -353,49 +353,49 @@ int     bl_gff3_index_set_seqid(
  *      -lbiolibc -lxtend
  *
  *  Description:
- *      Mutator for an array element of seqid member in a bl_gff3_index_t
- *      structure. Use this function to set bl_gff3_index_ptr->seqid[c]
+ *      Mutator for an array element of seqid_ids member in a bl_gff3_index_t
+ *      structure. Use this function to set bl_gff3_index_ptr->seqid_ids[c]
  *      in a bl_gff3_index_t object from non-member functions.
  *
  *  Arguments:
  *      bl_gff3_index_ptr Pointer to the structure to set
- *      c               Subscript to the seqid array
- *      new_seqid_element The new value for seqid[c]
+ *      c               Subscript to the seqid_ids array
+ *      new_seqid_ids_element The new value for seqid_ids[c]
  *
  *  Returns:
  *      BL_GFF3_INDEX_DATA_OK if the new value is acceptable and assigned
  *      BL_GFF3_INDEX_DATA_OUT_OF_RANGE otherwise
  *
  *  Examples:
- *      bl_gff3_index_t  bl_gff3_index;
+ *      bl_gff3_index_t bl_gff3_index;
  *      size_t          c;
- *      char **         new_seqid_element;
+ *      int32_t         new_seqid_ids_element;
  *
- *      if ( bl_gff3_index_set_seqid_ae(&bl_gff3_index, c, new_seqid_element)
+ *      if ( bl_gff3_index_set_seqid_ids_ae(&bl_gff3_index, c, new_seqid_ids_element)
  *              == BL_GFF3_INDEX_DATA_OK )
  *      {
  *      }
  *
  *  See also:
- *      BL_GFF3_INDEX_SET_SEQID_AE(3)
+ *      BL_GFF3_INDEX_SET_SEQID_IDS_AE(3)
  *
  *  History: 
  *  Date        Name        Modification
- *  2022-02-07  gen-get-set Auto-generated from gff3-index.h
+ *  2026-10-17  gen-get-set Auto-generated from gff3-index.h
  ***************************************************************************/
 
-int     bl_gff3_index_set_seqid_ae(
+int     bl_gff3_index_set_seqid_ids_ae(
 	    bl_gff3_index_t *bl_gff3_index_ptr,
 	    size_t c,
-	    char * new_seqid_element
+	    int32_t new_seqid_ids_element
 	)
 
 {
-    if ( new_seqid_element == NULL )
+    if ( false )
 	return BL_GFF3_INDEX_DATA_OUT_OF_RANGE;
     else
     {
-	bl_gff3_index_ptr->seqid[c] = new_seqid_element;
+	bl_gff3_index_ptr->seqid_ids[c] = new_seqid_ids_element;
 	return BL_GFF3_INDEX_DATA_OK;
     }
 }
@@ -407,46 +407,46 @@ int     bl_gff3_index_set_seqid_ae(
  *      -lbiolibc -lxtend
  *
  *  Description:
- *      Mutator for seqid member in a bl_gff3_index_t structure.
- *      Use this function to set seqid in a bl_gff3_index_t object
+ *      Mutator for seqid_ids member in a bl_gff3_index_t structure.
+ *      Use this function to set seqid_ids in a bl_gff3_index_t object
  *      from non-member functions.  This function copies the array pointed to
- *      by new_seqid to bl_gff3_index_ptr->seqid.
+ *      by new_seqid_ids to bl_gff3_index_ptr->seqid_ids.
  *
  *  Arguments:
  *      bl_gff3_index_ptr Pointer to the structure to set
- *      new_seqid       The new value for seqid
- *      array_size      Size of the seqid array.
+ *      new_seqid_ids   The new value for seqid_ids
+ *      array_size      Size of the seqid_ids array.
  *
  *  Returns:
  *      BL_GFF3_INDEX_DATA_OK if the new value is acceptable and assigned
  *      BL_GFF3_INDEX_DATA_OUT_OF_RANGE otherwise
  *
  *  Examples:
- *      bl_gff3_index_t  bl_gff3_index;
- *      char **         new_seqid;
+ *      bl_gff3_index_t bl_gff3_index;
+ *      int32_t *       new_seqid_ids;
  *      size_t          array_size;
  *
- *      if ( bl_gff3_index_set_seqid_cpy(&bl_gff3_index, new_seqid, array_size)
+ *      if ( bl_gff3_index_set_seqid_ids_cpy(&bl_gff3_index, new_seqid_ids, array_size)
  *              == BL_GFF3_INDEX_DATA_OK )
  *      {
  *      }
  *
  *  See also:
- *      BL_GFF3_INDEX_SET_SEQID(3)
+ *      BL_GFF3_INDEX_SET_SEQID_IDS(3)
  *
  *  History: 
  *  Date        Name        Modification
- *  2022-02-07  gen-get-set Auto-generated from gff3-index.h
+ *  2026-10-17  gen-get-set Auto-generated from gff3-index.h
  ***************************************************************************/
 
-int     bl_gff3_index_set_seqid_cpy(
+int     bl_gff3_index_set_seqid_ids_cpy(
 	    bl_gff3_index_t *bl_gff3_index_ptr,
-	    char ** new_seqid,
+	    int32_t *new_seqid_ids,
 	    size_t array_size
 	)
 
 {
-    if ( new_seqid == NULL )
+    if ( new_seqid_ids == NULL )
 	return BL_GFF3_INDEX_DATA_OUT_OF_RANGE;
     else
     {
@@ -454,7 +454,7 @@ int     bl_gff3_index_set_seqid_cpy(
 	
 	// FIXME: Assuming all elements should be copied
 	for (c = 0; c < array_size; ++c)
-	    bl_gff3_index_ptr->seqid[c] = new_seqid[c];
+	    bl_gff3_index_ptr->seqid_ids[c] = new_seqid_ids[c];
 	return BL_GFF3_INDEX_DATA_OK;
     }
 }
@@ -19,9 +19,9 @@ int bl_gff3_index_set_count(bl_gff3_index_t *bl_gff3_index_ptr, size_t new_count
 int bl_gff3_index_set_file_pos(bl_gff3_index_t *bl_gff3_index_ptr, long *new_file_pos);
 int bl_gff3_index_set_file_pos_ae(bl_gff3_index_t *bl_gff3_index_ptr, size_t c, long new_file_pos_element);
 int bl_gff3_index_set_file_pos_cpy(bl_gff3_index_t *bl_gff3_index_ptr, long *new_file_pos, size_t array_size);
-int bl_gff3_index_set_seqid(bl_gff3_index_t *bl_gff3_index_ptr, char **new_seqid);
-int bl_gff3_index_set_seqid_ae(bl_gff3_index_t *bl_gff3_index_ptr, size_t c, char *new_seqid_element);
-int bl_gff3_index_set_seqid_cpy(bl_gff3_index_t *bl_gff3_index_ptr, char **new_seqid, size_t array_size);
+int bl_gff3_index_set_seqid_ids(bl_gff3_index_t *bl_gff3_index_ptr, int32_t *new_seqid_ids);
+int bl_gff3_index_set_seqid_ids_ae(bl_gff3_index_t *bl_gff3_index_ptr, size_t c, int32_t new_seqid_ids_element);
+int bl_gff3_index_set_seqid_ids_cpy(bl_gff3_index_t *bl_gff3_index_ptr, int32_t *new_seqid_ids, size_t array_size);
 int bl_gff3_index_set_start(bl_gff3_index_t *bl_gff3_index_ptr, int64_t *new_start);
 int bl_gff3_index_set_start_ae(bl_gff3_index_t *bl_gff3_index_ptr, size_t c, int64_t new_start_element);
 int bl_gff3_index_set_start_cpy(bl_gff3_index_t *bl_gff3_index_ptr, int64_t *new_start, size_t array_size);
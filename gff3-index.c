@@ -1,6 +1,12 @@
 #include <stdio.h>
 #include <stdlib.h>
 #include <string.h>
+#include <limits.h>
+#include <fcntl.h>
+#include <unistd.h>
+#include <sys/stat.h>
+#include <sys/mman.h>
+#include <zlib.h>
 #include <xtend/mem.h>
 #include <xtend/math.h>
 #include "gff3-index.h"
@@ -26,7 +32,8 @@
  *      adds a GFF feature with file position file_pos to the index.
  *      Features of interest, perhaps only genes or only exons, can
  *      be added to the index on-the fly while reading through a GFF
- *      file with bl_gff3_read(3).
+ *      file with bl_gff3_read(3).  Seqids are interned in a chromosome
+ *      dictionary rather than copied for each feature.
  *
  *      The index can later be searched or traversed forward or backward
  *      to quickly find
@@ -40,10 +47,11 @@
  *
  *  Returns:
  *      BL_GFF3_INDEX_OK on success, BL_GFF3_MALLOC_FAILED if memory could
- *      not be allocated
+ *      not be allocated, BL_GFF3_INDEX_BAD_ARG if the seqid is empty or "."
+ *      or gi was loaded read-only by bl_gff3_index_map(3)
  *
  *  Examples:
- *      bl_gff3_index_t  gi;
+ *      bl_gff3_index_t  gi = BL_GFF3_INDEX_INIT;
  *      bl_gff3_t        feature;
  *
  *      if ( bl_gff3_read(&feature, gff3_stream, BL_GFF3_FIELD_ALL) == BL_READ_OK )
@@ -58,11 +66,18 @@
  *  History: 
  *  Date        Name        Modification
  *  2022-02-01  Jason Bacon Begin
+ *  2026-10-17  agent       Intern seqids instead of strdup()ing them
+ *  2026-10-17  agent       Reject additions to a mapped index
  ***************************************************************************/
 
 int     bl_gff3_index_add(bl_gff3_index_t *gi, bl_gff3_t *feature)
 
 {
+    int32_t previous_id;
+    
+    if ( gi->map_base != NULL )
+	return BL_GFF3_INDEX_BAD_ARG;
+    
     if ( gi->count == gi->array_size )
     {
 	gi->array_size += 65536;
@@ -75,18 +90,25 @@ int     bl_gff3_index_add(bl_gff3_index_t *gi, bl_gff3_t *feature)
 	gi->end = xt_realloc(gi->end, gi->array_size, sizeof(*gi->end));
 	if ( gi->end == NULL )
 	    return BL_GFF3_INDEX_MALLOC_FAILED;
-	gi->seqid = xt_realloc(gi->seqid, gi->array_size, sizeof(*gi->seqid));
-	if ( gi->seqid == NULL )
+	gi->seqid_ids = xt_realloc(gi->seqid_ids, gi->array_size, sizeof(*gi->seqid_ids));
+	if ( gi->seqid_ids == NULL )
+	    return BL_GFF3_INDEX_MALLOC_FAILED;
+	gi->max_ends = xt_realloc(gi->max_ends, gi->array_size, sizeof(*gi->max_ends));
+	if ( gi->max_ends == NULL )
 	    return BL_GFF3_INDEX_MALLOC_FAILED;
     }
     gi->file_pos[gi->count] = BL_GFF3_FILE_POS(feature);
     gi->start[gi->count] = BL_GFF3_START(feature);
     gi->end[gi->count] = BL_GFF3_END(feature);
     
-    // Hash chr to a 64-bit integer, padding with 0s beyond the end
-    if ( (gi->seqid[gi->count] = strdup(BL_GFF3_SEQID(feature))) == NULL )
-	return BL_GFF3_INDEX_MALLOC_FAILED;
+    // Intern seqid, checking the previous entry's first
+    previous_id = gi->count > 0 ? gi->seqid_ids[gi->count - 1] :
+		  BL_CHROM_ID_NONE;
+    if ( (gi->seqid_ids[gi->count] = bl_chrom_dict_intern(&gi->dict,
+		previous_id, BL_GFF3_SEQID(feature))) == BL_CHROM_ID_NONE )
+	return BL_GFF3_INDEX_BAD_ARG;
     ++gi->count;
+    gi->partitioned = false;
     return BL_GFF3_INDEX_OK;
 }
 
@@ -126,6 +148,12 @@ int     bl_gff3_index_add(bl_gff3_index_t *gi, bl_gff3_t *feature)
  *      added to gi by bl_gff3_index_add(3), not all features in the GFF
  *      file.  An application may only add genes to the index, for example,
  *      ignoring exons, etc.
+ *
+ *      Features are counted in start order among those on the same
+ *      seqid.  The entries are partitioned by seqid and sorted by
+ *      bl_gff3_index_partition(3) after any additions, and the reference
+ *      feature and the max_nt limit are both found by binary search, so
+ *      each call takes O(log n) time for n features on the seqid.
  *  
  *  Arguments:
  *      gi              Pointer to the gff3_index_t object used to search
@@ -134,14 +162,17 @@ int     bl_gff3_index_add(bl_gff3_index_t *gi, bl_gff3_t *feature)
  *      max_nt          Maximum number of nucleotides to back up
  *
  *  Returns:
- *      The return value of fseek(), i.e. 0 upon success, -1 on error
+ *      The return value of fseek(), i.e. 0 upon success, -1 on error,
+ *      BL_GFF3_INDEX_BAD_ARG if no features on the seqid of feature are
+ *      indexed, or BL_GFF3_INDEX_MALLOC_FAILED
  *
  *  Examples:
  *      bl_gff3_index_t  gi;
  *      bl_gff3_t        feature;
- *      long            new_pos;
  *
- *      new_pos = bl_gff3_index_seek_reverse(&gi, &feature, 4, 200000);
+ *      if ( bl_gff3_index_seek_reverse(&gi, gff3_stream, &feature, 4, 200000)
+ *           == 0 )
+ *          bl_gff3_read(&feature, gff3_stream, BL_GFF3_FIELD_ALL);
  *
  *  See also:
  *      bl_gff3_index_add(3), fseek(3), bl_gff3_read(3)
@@ -149,34 +180,881 @@ int     bl_gff3_index_add(bl_gff3_index_t *gi, bl_gff3_t *feature)
  *  History: 
  *  Date        Name        Modification
  *  2022-02-01  Jason Bacon Begin
+ *  2026-10-17  agent       Partition by seqid and use binary search
  ***************************************************************************/
 
 int     bl_gff3_index_seek_reverse(bl_gff3_index_t *gi, FILE *stream,
 	    bl_gff3_t *feature, int64_t feature_count, int64_t max_nt)
 
 {
-    ssize_t     c;
-    char        *ref_seqid = BL_GFF3_SEQID(feature);
-    int64_t     ref_start = BL_GFF3_START(feature),
-		end = XT_MAX(ref_start - max_nt, 0),
-		f;
-
-    // First find the reference feature where the search begins
-    for (c = gi->count - 1; (c >= 0) &&
-			    (gi->start[c] != ref_start) &&
-			    (strcmp(gi->seqid[c], ref_seqid) != 0); --c)
-	;
+    size_t      first,
+		last,
+		ref,
+		lowest,
+		c;
+    int64_t     ref_start = BL_GFF3_START(feature);
+    int32_t     id;
+    int         status;
+
+    if ( (status = bl_gff3_index_partition(gi)) != BL_GFF3_INDEX_OK )
+	return status;
+    if ( (id = bl_chrom_dict_lookup(&gi->dict, BL_GFF3_SEQID(feature)))
+	    == BL_CHROM_ID_NONE )
+	return BL_GFF3_INDEX_BAD_ARG;
+    first = gi->seqid_offsets[id];
+    last = first + gi->seqid_counts[id];
+
+    // First find the reference feature where the search begins: the
+    // last one on this seqid starting at or before feature
+    ref = bl_gff3_index_upper_bound(gi->start, first, last, ref_start);
+    if ( ref > first )
+	--ref;
     
     // Now back up feature_count features or to the leftmost feature
     // overlapping with the ref feature start - max_nt
-    for (f = feature_count; (f > 0) &&
-			    (c > 0) &&
-			    (strcmp(gi->seqid[c], ref_seqid) == 0) &&
-			    (gi->end[c] > end); --f, --c)
-	;
-    if ( gi->end[c] < end )
-	++c;
+    c = ref;
+    if ( feature_count > 0 )
+	c = ref - first > (uint64_t)feature_count ? ref - feature_count : first;
+    if ( max_nt > 0 )
+    {
+	lowest = bl_gff3_index_upper_bound(gi->max_ends, first, ref,
+					   ref_start - max_nt);
+	if ( c < lowest )
+	    c = lowest;
+    }
 
     return fseek(stream, gi->file_pos[c], SEEK_SET);
 }
 
+
+/***************************************************************************
+ *  Name:
+ *      bl_gff3_index_init() - Initialize a GFF3 index
+ *
+ *  Library:
+ *      #include <biolibc/gff3-index.h>
+ *      -lbiolibc -lxtend
+ *
+ *  Description:
+ *      Initialize an empty bl_gff3_index_t object.  This is equivalent
+ *      to assigning BL_GFF3_INDEX_INIT.
+ *
+ *  Arguments:
+ *      gi      Pointer to the bl_gff3_index_t object to initialize
+ *
+ *  See also:
+ *      bl_gff3_index_free(3), bl_gff3_index_add(3)
+ *
+ *  History: 
+ *  Date        Name        Modification
+ *  2026-10-17  agent       Begin
+ ***************************************************************************/
+
+void    bl_gff3_index_init(bl_gff3_index_t *gi)
+
+{
+    gi->array_size = 0;
+    gi->count = 0;
+    gi->file_pos = NULL;
+    gi->seqid_ids = NULL;
+    gi->start = NULL;
+    gi->end = NULL;
+    bl_chrom_dict_init(&gi->dict);
+    gi->max_ends = NULL;
+    gi->seqid_offsets = NULL;
+    gi->seqid_counts = NULL;
+    gi->seqid_array_size = 0;
+    gi->partitioned = false;
+    gi->map_base = NULL;
+    gi->map_size = 0;
+    gi->source_crc = 0;
+}
+
+
+/***************************************************************************
+ *  Name:
+ *      bl_gff3_index_free() - Free memory held by a GFF3 index
+ *
+ *  Library:
+ *      #include <biolibc/gff3-index.h>
+ *      -lbiolibc -lxtend
+ *
+ *  Description:
+ *      Free all memory held by a bl_gff3_index_t object and leave it
+ *      empty, ready for reuse.  An index file mapped by
+ *      bl_gff3_index_map(3) is unmapped.
+ *
+ *  Arguments:
+ *      gi      Pointer to the bl_gff3_index_t object
+ *
+ *  See also:
+ *      bl_gff3_index_init(3)
+ *
+ *  History: 
+ *  Date        Name        Modification
+ *  2026-10-17  agent       Begin
+ ***************************************************************************/
+
+void    bl_gff3_index_free(bl_gff3_index_t *gi)
+
+{
+    if ( gi->map_base != NULL )
+    {
+	// Only file_pos is copied out of the map, and only if long is
+	// not 64 bits
+	if ( sizeof(*gi->file_pos) != sizeof(int64_t) )
+	    free(gi->file_pos);
+	munmap(gi->map_base, gi->map_size);
+    }
+    else
+    {
+	free(gi->file_pos);
+	free(gi->seqid_ids);
+	free(gi->start);
+	free(gi->end);
+	free(gi->max_ends);
+    }
+    bl_chrom_dict_free(&gi->dict);
+    free(gi->seqid_offsets);
+    free(gi->seqid_counts);
+    bl_gff3_index_init(gi);
+}
+
+
+/***************************************************************************
+ *  Name:
+ *      bl_gff3_index_entry_cmp() - Compare GFF3 index entries by start
+ *
+ *  Library:
+ *      #include <biolibc/gff3-index.h>
+ *      -lbiolibc -lxtend
+ *
+ *  Description:
+ *      qsort(3) comparison function for bl_gff3_index_entry_t objects,
+ *      ordering by start and then file position, so that features with
+ *      the same start stay in file order.
+ *
+ *  Arguments:
+ *      entry1, entry2  Pointers to bl_gff3_index_entry_t objects
+ *
+ *  Returns:
+ *      A value < 0 if entry1 sorts before entry2, > 0 if after,
+ *      0 otherwise
+ *
+ *  See also:
+ *      bl_gff3_index_partition(3)
+ *
+ *  History: 
+ *  Date        Name        Modification
+ *  2026-10-17  agent       Begin
+ ***************************************************************************/
+
+int     bl_gff3_index_entry_cmp(const bl_gff3_index_entry_t *entry1,
+				const bl_gff3_index_entry_t *entry2)
+
+{
+    if ( entry1->start != entry2->start )
+	return entry1->start < entry2->start ? -1 : 1;
+    if ( entry1->file_pos != entry2->file_pos )
+	return entry1->file_pos < entry2->file_pos ? -1 : 1;
+    return 0;
+}
+
+
+/***************************************************************************
+ *  Name:
+ *      bl_gff3_index_partition() - Group GFF3 index entries by seqid
+ *
+ *  Library:
+ *      #include <biolibc/gff3-index.h>
+ *      -lbiolibc -lxtend
+ *
+ *  Description:
+ *      Reorder the entries of a bl_gff3_index_t object so that each
+ *      seqid's entries are contiguous, in order of the seqid's first
+ *      appearance, and sorted by start, and compute the running
+ *      max_ends of each partition.  Entries already sorted, as from a
+ *      sorted GFF3 file, are grouped in one linear pass without sorting.
+ *
+ *      This is called automatically by bl_gff3_index_seek_reverse(3)
+ *      after entries have been added, and is rarely needed by
+ *      applications.
+ *
+ *  Arguments:
+ *      gi      Pointer to a bl_gff3_index_t object
+ *
+ *  Returns:
+ *      BL_GFF3_INDEX_OK on success, BL_GFF3_INDEX_MALLOC_FAILED otherwise
+ *
+ *  See also:
+ *      bl_gff3_index_add(3), bl_gff3_index_seek_reverse(3)
+ *
+ *  History: 
+ *  Date        Name        Modification
+ *  2026-10-17  agent       Begin
+ ***************************************************************************/
+
+int     bl_gff3_index_partition(bl_gff3_index_t *gi)
+
+{
+    bl_gff3_index_entry_t   *entries;
+    size_t  *fill,
+	    seqids = BL_CHROM_DICT_COUNT(&gi->dict),
+	    id,
+	    c,
+	    pos,
+	    first,
+	    last;
+    bool    sorted;
+    
+    if ( gi->partitioned )
+	return BL_GFF3_INDEX_OK;
+    
+    if ( seqids > gi->seqid_array_size )
+    {
+	gi->seqid_offsets = xt_realloc(gi->seqid_offsets, seqids,
+				       sizeof(*gi->seqid_offsets));
+	gi->seqid_counts = xt_realloc(gi->seqid_counts, seqids,
+				      sizeof(*gi->seqid_counts));
+	if ( (gi->seqid_offsets == NULL) || (gi->seqid_counts == NULL) )
+	    return BL_GFF3_INDEX_MALLOC_FAILED;
+	gi->seqid_array_size = seqids;
+    }
+    
+    // Counting sort by seqid
+    for (id = 0; id < seqids; ++id)
+	gi->seqid_counts[id] = 0;
+    for (c = 0; c < gi->count; ++c)
+	++gi->seqid_counts[gi->seqid_ids[c]];
+    for (id = 0, pos = 0; id < seqids; ++id)
+    {
+	gi->seqid_offsets[id] = pos;
+	pos += gi->seqid_counts[id];
+    }
+    
+    if ( (entries = xt_malloc(gi->count, sizeof(*entries))) == NULL )
+	return BL_GFF3_INDEX_MALLOC_FAILED;
+    if ( (fill = xt_malloc(seqids, sizeof(*fill))) == NULL )
+    {
+	free(entries);
+	return BL_GFF3_INDEX_MALLOC_FAILED;
+    }
+    for (id = 0; id < seqids; ++id)
+	fill[id] = gi->seqid_offsets[id];
+    for (c = 0; c < gi->count; ++c)
+    {
+	pos = fill[gi->seqid_ids[c]]++;
+	entries[pos].start = gi->start[c];
+	entries[pos].end = gi->end[c];
+	entries[pos].file_pos = gi->file_pos[c];
+    }
+    free(fill);
+    
+    for (id = 0; id < seqids; ++id)
+    {
+	first = gi->seqid_offsets[id];
+	last = first + gi->seqid_counts[id];
+	for (c = first + 1, sorted = true; sorted && (c < last); ++c)
+	    sorted = entries[c - 1].start <= entries[c].start;
+	if ( ! sorted )
+	    qsort(entries + first, last - first, sizeof(*entries),
+		  (int (*)(const void *,const void *))bl_gff3_index_entry_cmp);
+	
+	for (c = first; c < last; ++c)
+	{
+	    gi->seqid_ids[c] = id;
+	    gi->start[c] = entries[c].start;
+	    gi->end[c] = entries[c].end;
+	    gi->file_pos[c] = entries[c].file_pos;
+	    gi->max_ends[c] = (c > first) && (gi->max_ends[c - 1] > gi->end[c]) ?
+			      gi->max_ends[c - 1] : gi->end[c];
+	}
+    }
+    free(entries);
+    gi->partitioned = true;
+    return BL_GFF3_INDEX_OK;
+}
+
+
+/***************************************************************************
+ *  Name:
+ *      bl_gff3_index_upper_bound() - Binary search a sorted array
+ *
+ *  Library:
+ *      #include <biolibc/gff3-index.h>
+ *      -lbiolibc -lxtend
+ *
+ *  Description:
+ *      Find the first element of array[first] .. array[last - 1], which
+ *      must be nondecreasing, that is greater than value.  This is used
+ *      internally by bl_gff3_index_seek_reverse(3) on the start and
+ *      max_ends arrays of a partition.
+ *
+ *  Arguments:
+ *      array   Nondecreasing array
+ *      first   Index of first element to search
+ *      last    Index one past last element to search
+ *      value   Value to search for
+ *
+ *  Returns:
+ *      Index of the first element > value, or last if there is none
+ *
+ *  See also:
+ *      bl_gff3_index_seek_reverse(3)
+ *
+ *  History: 
+ *  Date        Name        Modification
+ *  2026-10-17  agent       Begin
+ ***************************************************************************/
+
+size_t  bl_gff3_index_upper_bound(int64_t *array, size_t first, size_t last,
+				  int64_t value)
+
+{
+    size_t  mid;
+    
+    while ( first < last )
+    {
+	mid = first + (last - first) / 2;
+	if ( array[mid] <= value )
+	    first = mid + 1;
+	else
+	    last = mid;
+    }
+    return first;
+}
+
+
+/***************************************************************************
+ *  Name:
+ *      bl_gff3_index_checksum() - Compute the checksum of a GFF3 file
+ *
+ *  Library:
+ *      #include <biolibc/gff3-index.h>
+ *      -lbiolibc -lxtend
+ *
+ *  Description:
+ *      Compute the zlib crc32(3) of the entire contents of filename,
+ *      as recorded in index files by bl_gff3_index_write(3).  This reads
+ *      the whole file, so it is used only for explicit verification by
+ *      bl_gff3_index_verify(3), not when an index is mapped.
+ *
+ *  Arguments:
+ *      filename    Name of the file
+ *      crc         Address of a uint32_t to receive the checksum
+ *
+ *  Returns:
+ *      BL_GFF3_INDEX_OK on success, BL_GFF3_INDEX_OPEN_FAILED if the
+ *      file cannot be opened or read
+ *
+ *  See also:
+ *      bl_gff3_index_verify(3), bl_gff3_index_write(3)
+ *
+ *  History: 
+ *  Date        Name        Modification
+ *  2026-10-17  agent       Begin
+ ***************************************************************************/
+
+int     bl_gff3_index_checksum(const char *filename, uint32_t *crc)
+
+{
+    unsigned char   buff[65536];
+    size_t          bytes;
+    uLong           sum;
+    FILE            *stream;
+    int             status;
+    
+    if ( (stream = fopen(filename, "r")) == NULL )
+	return BL_GFF3_INDEX_OPEN_FAILED;
+    sum = crc32(0L, Z_NULL, 0);
+    while ( (bytes = fread(buff, 1, sizeof(buff), stream)) > 0 )
+	sum = crc32(sum, buff, bytes);
+    status = ferror(stream) ? BL_GFF3_INDEX_OPEN_FAILED : BL_GFF3_INDEX_OK;
+    fclose(stream);
+    *crc = sum;
+    return status;
+}
+
+
+/***************************************************************************
+ *  Name:
+ *      bl_gff3_index_write() - Save a GFF3 index to a file
+ *
+ *  Library:
+ *      #include <biolibc/gff3-index.h>
+ *      -lbiolibc -lxtend
+ *
+ *  Description:
+ *      Write gi to index_stream in the binary format described in
+ *      gff3-index.h, for later use with bl_gff3_index_map(3).  The
+ *      entries are partitioned first if necessary.  The size, modification
+ *      time, and checksum of gff3_filename, the file that was indexed,
+ *      are recorded so that a stale index can be detected.
+ *
+ *      The format is in host byte order and is not portable between
+ *      architectures with different endianness.  Such files are rejected
+ *      by bl_gff3_index_map(3).
+ *
+ *  Arguments:
+ *      gi              Pointer to the bl_gff3_index_t object to save
+ *      index_stream    FILE stream opened for writing in binary mode
+ *      gff3_filename   Name of the GFF3 file indexed by gi
+ *
+ *  Returns:
+ *      BL_WRITE_OK on success, BL_WRITE_FAILURE if gff3_filename cannot
+ *      be read, memory cannot be allocated, or a write error occurs
+ *
+ *  Examples:
+ *      FILE    *stream;
+ *
+ *      if ( (stream = fopen("genes.gff3.gix", "w")) != NULL )
+ *      {
+ *          bl_gff3_index_write(&gi, stream, "genes.gff3");
+ *          fclose(stream);
+ *      }
+ *
+ *  See also:
+ *      bl_gff3_index_map(3), bl_gff3_index_open(3)
+ *
+ *  History: 
+ *  Date        Name        Modification
+ *  2026-10-17  agent       Begin
+ ***************************************************************************/
+
+int     bl_gff3_index_write(bl_gff3_index_t *gi, FILE *index_stream,
+			    const char *gff3_filename)
+
+{
+    bl_gff3_index_file_t    header;
+    struct stat st;
+    size_t      seqids = BL_CHROM_DICT_COUNT(&gi->dict),
+		id,
+		c;
+    int64_t     pos;
+    uint64_t    seqid_count;
+    uint32_t    crc;
+    static const char pad[8] = "";
+    
+    if ( (bl_gff3_index_partition(gi) != BL_GFF3_INDEX_OK) ||
+	 (stat(gff3_filename, &st) != 0) ||
+	 (bl_gff3_index_checksum(gff3_filename, &crc) != BL_GFF3_INDEX_OK) )
+	return BL_WRITE_FAILURE;
+    
+    memset(&header, 0, sizeof(header));
+    memcpy(header.magic, BL_GFF3_INDEX_MAGIC, sizeof(header.magic));
+    header.version = BL_GFF3_INDEX_VERSION;
+    header.byte_order = BL_GFF3_INDEX_BYTE_ORDER;
+    header.source_size = st.st_size;
+    header.source_mtime = st.st_mtime;
+    header.source_crc = crc;
+    header.count = gi->count;
+    header.seqid_count = seqids;
+    for (id = 0; id < seqids; ++id)
+	header.names_size += strlen(BL_CHROM_DICT_NAMES_AE(&gi->dict, id)) + 1;
+    
+    if ( (fwrite(&header, sizeof(header), 1, index_stream) != 1) ||
+	 (fwrite(gi->start, sizeof(*gi->start), gi->count, index_stream)
+	    != gi->count) ||
+	 (fwrite(gi->end, sizeof(*gi->end), gi->count, index_stream)
+	    != gi->count) ||
+	 (fwrite(gi->max_ends, sizeof(*gi->max_ends), gi->count, index_stream)
+	    != gi->count) )
+	return BL_WRITE_FAILURE;
+    for (c = 0; c < gi->count; ++c)
+    {
+	pos = gi->file_pos[c];
+	if ( fwrite(&pos, sizeof(pos), 1, index_stream) != 1 )
+	    return BL_WRITE_FAILURE;
+    }
+    if ( (fwrite(gi->seqid_ids, sizeof(*gi->seqid_ids), gi->count,
+		 index_stream) != gi->count) ||
+	 (fwrite(pad, 1, (gi->count % 2) * sizeof(*gi->seqid_ids),
+		 index_stream) != (gi->count % 2) * sizeof(*gi->seqid_ids)) )
+	return BL_WRITE_FAILURE;
+    for (id = 0; id < seqids; ++id)
+    {
+	seqid_count = gi->seqid_counts[id];
+	if ( fwrite(&seqid_count, sizeof(seqid_count), 1, index_stream) != 1 )
+	    return BL_WRITE_FAILURE;
+    }
+    for (id = 0; id < seqids; ++id)
+	if ( fputs(BL_CHROM_DICT_NAMES_AE(&gi->dict, id), index_stream) == EOF ||
+	     (putc('\0', index_stream) == EOF) )
+	    return BL_WRITE_FAILURE;
+    return BL_WRITE_OK;
+}
+
+
+/***************************************************************************
+ *  Name:
+ *      bl_gff3_index_map() - Memory map a saved GFF3 index
+ *
+ *  Library:
+ *      #include <biolibc/gff3-index.h>
+ *      -lbiolibc -lxtend
+ *
+ *  Description:
+ *      Load an index saved by bl_gff3_index_write(3) into the empty
+ *      object gi by mapping index_filename with mmap(2).  The per-feature
+ *      arrays are used in place, so only the seqid table is copied.  The
+ *      seqid ID of each feature is checked against the seqid table, which
+ *      is one sequential pass over 4 bytes per feature.  Other pages of
+ *      the index are read by the kernel only as searches touch them.
+ *
+ *      The index is rejected as stale unless the size and modification
+ *      time of gff3_filename match those recorded when the index was
+ *      written, which costs one stat(2).  The recorded checksum can be
+ *      checked as well with bl_gff3_index_verify(3), which reads the
+ *      whole GFF3 file.
+ *
+ *      A mapped index is read-only: bl_gff3_index_add(3) will fail.
+ *      It must be released with bl_gff3_index_free(3).
+ *
+ *  Arguments:
+ *      gi              Pointer to an empty bl_gff3_index_t object
+ *      index_filename  Name of the index file
+ *      gff3_filename   Name of the GFF3 file that was indexed
+ *
+ *  Returns:
+ *      BL_GFF3_INDEX_OK on success,
+ *      BL_GFF3_INDEX_OPEN_FAILED if either file cannot be opened or mapped,
+ *      BL_GFF3_INDEX_STALE if gff3_filename has changed,
+ *      BL_GFF3_INDEX_BAD_FORMAT if the index file is not valid,
+ *      BL_GFF3_INDEX_MALLOC_FAILED if the seqid table cannot be allocated,
+ *      BL_GFF3_INDEX_BAD_ARG if gi is not empty
+ *
+ *  Examples:
+ *      bl_gff3_index_t gi = BL_GFF3_INDEX_INIT;
+ *
+ *      if ( bl_gff3_index_map(&gi, "genes.gff3.gix", "genes.gff3")
+ *              == BL_GFF3_INDEX_OK )
+ *      {
+ *          ...
+ *          bl_gff3_index_free(&gi);
+ *      }
+ *
+ *  See also:
+ *      bl_gff3_index_write(3), bl_gff3_index_open(3),
+ *      bl_gff3_index_verify(3), mmap(2)
+ *
+ *  History: 
+ *  Date        Name        Modification
+ *  2026-10-17  agent       Begin
+ *  2026-10-17  agent       Validate seqid_ids
+ ***************************************************************************/
+
+int     bl_gff3_index_map(bl_gff3_index_t *gi, const char *index_filename,
+			  const char *gff3_filename)
+
+{
+    bl_gff3_index_file_t    *header;
+    struct stat gff3_st, index_st;
+    char        *base, *name, *names_end;
+    uint64_t    *counts;
+    size_t      id, c, pos, size;
+    int64_t     *file_pos;
+    int         fd;
+    
+    if ( (gi->count != 0) || (gi->map_base != NULL) )
+	return BL_GFF3_INDEX_BAD_ARG;
+    if ( stat(gff3_filename, &gff3_st) != 0 )
+	return BL_GFF3_INDEX_OPEN_FAILED;
+    if ( (fd = open(index_filename, O_RDONLY)) == -1 )
+	return BL_GFF3_INDEX_OPEN_FAILED;
+    if ( fstat(fd, &index_st) == -1 )
+    {
+	close(fd);
+	return BL_GFF3_INDEX_OPEN_FAILED;
+    }
+    if ( (size_t)index_st.st_size < sizeof(*header) )
+    {
+	close(fd);
+	return BL_GFF3_INDEX_BAD_FORMAT;
+    }
+    base = mmap(NULL, index_st.st_size, PROT_READ, MAP_SHARED, fd, 0);
+    close(fd);  // Mapping remains valid
+    if ( base == MAP_FAILED )
+	return BL_GFF3_INDEX_OPEN_FAILED;
+    gi->map_base = base;
+    gi->map_size = index_st.st_size;
+    
+    header = (bl_gff3_index_file_t *)base;
+    if ( (memcmp(header->magic, BL_GFF3_INDEX_MAGIC, sizeof(header->magic))
+	    != 0) ||
+	 (header->version != BL_GFF3_INDEX_VERSION) ||
+	 (header->byte_order != BL_GFF3_INDEX_BYTE_ORDER) ||
+	 (header->count > gi->map_size) ||
+	 (header->seqid_count > gi->map_size) )
+    {
+	bl_gff3_index_free(gi);
+	return BL_GFF3_INDEX_BAD_FORMAT;
+    }
+    if ( (header->source_size != (uint64_t)gff3_st.st_size) ||
+	 (header->source_mtime != (int64_t)gff3_st.st_mtime) )
+    {
+	bl_gff3_index_free(gi);
+	return BL_GFF3_INDEX_STALE;
+    }
+    
+    // Sections must exactly fill the file
+    size = sizeof(*header) + header->count * 4 * sizeof(int64_t) +
+	   (header->count + header->count % 2) * sizeof(int32_t) +
+	   header->seqid_count * sizeof(uint64_t) + header->names_size;
+    if ( size != gi->map_size )
+    {
+	bl_gff3_index_free(gi);
+	return BL_GFF3_INDEX_BAD_FORMAT;
+    }
+    
+    gi->count = header->count;
+    gi->source_crc = header->source_crc;
+    pos = sizeof(*header);
+    gi->start = (int64_t *)(base + pos);
+    pos += gi->count * sizeof(int64_t);
+    gi->end = (int64_t *)(base + pos);
+    pos += gi->count * sizeof(int64_t);
+    gi->max_ends = (int64_t *)(base + pos);
+    pos += gi->count * sizeof(int64_t);
+    file_pos = (int64_t *)(base + pos);
+    pos += gi->count * sizeof(int64_t);
+    gi->seqid_ids = (int32_t *)(base + pos);
+    pos += (gi->count + gi->count % 2) * sizeof(int32_t);
+    counts = (uint64_t *)(base + pos);
+    pos += header->seqid_count * sizeof(uint64_t);
+    name = base + pos;
+    names_end = base + gi->map_size;
+    
+    if ( sizeof(*gi->file_pos) == sizeof(*file_pos) )
+	gi->file_pos = (long *)file_pos;
+    else
+    {
+	if ( (gi->file_pos = xt_malloc(gi->count, sizeof(*gi->file_pos)))
+		== NULL )
+	{
+	    bl_gff3_index_free(gi);
+	    return BL_GFF3_INDEX_MALLOC_FAILED;
+	}
+	for (c = 0; c < gi->count; ++c)
+	    gi->file_pos[c] = file_pos[c];
+    }
+    
+    // Rebuild the seqid table, which is small
+    gi->seqid_array_size = header->seqid_count;
+    gi->seqid_offsets = xt_malloc(gi->seqid_array_size,
+				  sizeof(*gi->seqid_offsets));
+    gi->seqid_counts = xt_malloc(gi->seqid_array_size,
+				 sizeof(*gi->seqid_counts));
+    if ( (gi->seqid_offsets == NULL) || (gi->seqid_counts == NULL) )
+    {
+	bl_gff3_index_free(gi);
+	return BL_GFF3_INDEX_MALLOC_FAILED;
+    }
+    for (id = 0, pos = 0; id < gi->seqid_array_size; ++id)
+    {
+	if ( (memchr(name, '\0', names_end - name) == NULL) ||
+	     (counts[id] > gi->count - pos) ||
+	     (bl_chrom_dict_add(&gi->dict, name, 0) != (int32_t)id) )
+	{
+	    bl_gff3_index_free(gi);
+	    return BL_GFF3_INDEX_BAD_FORMAT;
+	}
+	gi->seqid_offsets[id] = pos;
+	gi->seqid_counts[id] = counts[id];
+	pos += counts[id];
+	name += strlen(name) + 1;
+    }
+    if ( pos != gi->count )
+    {
+	bl_gff3_index_free(gi);
+	return BL_GFF3_INDEX_BAD_FORMAT;
+    }
+    
+    // Each feature's seqid must be the one whose partition it lies in
+    for (id = 0; id < gi->seqid_array_size; ++id)
+    {
+	for (c = gi->seqid_offsets[id];
+	     c < gi->seqid_offsets[id] + gi->seqid_counts[id]; ++c)
+	{
+	    if ( gi->seqid_ids[c] != (int32_t)id )
+	    {
+		bl_gff3_index_free(gi);
+		return BL_GFF3_INDEX_BAD_FORMAT;
+	    }
+	}
+    }
+    gi->partitioned = true;
+    return BL_GFF3_INDEX_OK;
+}
+
+
+/***************************************************************************
+ *  Name:
+ *      bl_gff3_index_verify() - Check a mapped GFF3 index against its source
+ *
+ *  Library:
+ *      #include <biolibc/gff3-index.h>
+ *      -lbiolibc -lxtend
+ *
+ *  Description:
+ *      Compare the checksum of gff3_filename with the one recorded in
+ *      the index file loaded by bl_gff3_index_map(3).  This detects
+ *      changes that preserve the size and modification time of the
+ *      GFF3 file, at the cost of reading it in full.
+ *
+ *  Arguments:
+ *      gi              Pointer to a bl_gff3_index_t object loaded by
+ *                      bl_gff3_index_map(3)
+ *      gff3_filename   Name of the GFF3 file that was indexed
+ *
+ *  Returns:
+ *      BL_GFF3_INDEX_OK if the checksums match, BL_GFF3_INDEX_STALE if
+ *      not, BL_GFF3_INDEX_OPEN_FAILED if gff3_filename cannot be read,
+ *      BL_GFF3_INDEX_BAD_ARG if gi was not loaded from a file
+ *
+ *  See also:
+ *      bl_gff3_index_map(3), bl_gff3_index_checksum(3)
+ *
+ *  History: 
+ *  Date        Name        Modification
+ *  2026-10-17  agent       Begin
+ ***************************************************************************/
+
+int     bl_gff3_index_verify(bl_gff3_index_t *gi, const char *gff3_filename)
+
+{
+    uint32_t    crc;
+    int         status;
+    
+    if ( gi->map_base == NULL )
+	return BL_GFF3_INDEX_BAD_ARG;
+    if ( (status = bl_gff3_index_checksum(gff3_filename, &crc))
+	    != BL_GFF3_INDEX_OK )
+	return status;
+    return crc == gi->source_crc ? BL_GFF3_INDEX_OK : BL_GFF3_INDEX_STALE;
+}
+
+
+/***************************************************************************
+ *  Name:
+ *      bl_gff3_index_open() - Load or build a persistent GFF3 index
+ *
+ *  Library:
+ *      #include <biolibc/gff3-index.h>
+ *      -lbiolibc -lxtend
+ *
+ *  Description:
+ *      Load an index of gff3_filename into the empty object gi, building
+ *      and saving it first if necessary.  If type is NULL, all features
+ *      are indexed and the index file is gff3_filename.gix.  Otherwise
+ *      only features of the given type, such as "gene", are indexed and
+ *      the index file is gff3_filename.type.gix.
+ *
+ *      If a current index file exists, it is loaded instantly with
+ *      bl_gff3_index_map(3).  Otherwise the GFF3 file is read and indexed
+ *      and an attempt is made to save the index with
+ *      bl_gff3_index_write(3) for future use, as bl_fasta_index_open(3)
+ *      does for FASTA files.  Failure to save the index is not an error.
+ *
+ *      The new index is written to a temporary file in the same directory
+ *      and renamed into place, so that other processes that have mapped
+ *      a stale index file are not affected, and never see a partial one.
+ *
+ *  Arguments:
+ *      gi              Pointer to an empty bl_gff3_index_t object
+ *      gff3_filename   Name of the GFF3 file
+ *      type            Feature type to index, or NULL for all
+ *
+ *  Returns:
+ *      BL_GFF3_INDEX_OK on success,
+ *      BL_GFF3_INDEX_OPEN_FAILED if gff3_filename cannot be opened,
+ *      Any other value returned by bl_gff3_index_add(3)
+ *
+ *  Examples:
+ *      bl_gff3_index_t gi = BL_GFF3_INDEX_INIT;
+ *
+ *      if ( bl_gff3_index_open(&gi, "genes.gff3", "gene")
+ *              == BL_GFF3_INDEX_OK )
+ *      {
+ *          bl_gff3_index_seek_reverse(&gi, stream, &feature, 4, 200000);
+ *          ...
+ *          bl_gff3_index_free(&gi);
+ *      }
+ *
+ *  See also:
+ *      bl_gff3_index_map(3), bl_gff3_index_write(3),
+ *      bl_gff3_index_seek_reverse(3)
+ *
+ *  History: 
+ *  Date        Name        Modification
+ *  2026-10-17  agent       Begin
+ *  2026-10-17  agent       Replace index files atomically
+ ***************************************************************************/
+
+int     bl_gff3_index_open(bl_gff3_index_t *gi, const char *gff3_filename,
+			   const char *type)
+
+{
+    char        index_filename[PATH_MAX + 1],
+		temp_filename[PATH_MAX + 1];
+    bl_gff3_t   feature;
+    struct stat gff3_st;
+    FILE        *stream;
+    int         status,
+		write_status,
+		fd;
+    
+    if ( type == NULL )
+	snprintf(index_filename, PATH_MAX + 1, "%s.gix", gff3_filename);
+    else
+	snprintf(index_filename, PATH_MAX + 1, "%s.%s.gix", gff3_filename,
+		 type);
+    if ( (status = bl_gff3_index_map(gi, index_filename, gff3_filename))
+	    == BL_GFF3_INDEX_OK )
+	return status;
+    if ( status == BL_GFF3_INDEX_BAD_ARG )
+	return status;
+    
+    if ( (stream = fopen(gff3_filename, "r")) == NULL )
+	return BL_GFF3_INDEX_OPEN_FAILED;
+    bl_gff3_init(&feature);
+    fclose(bl_gff3_skip_header(stream));
+    status = BL_GFF3_INDEX_OK;
+    while ( (status == BL_GFF3_INDEX_OK) &&
+	    (bl_gff3_read(&feature, stream, BL_GFF3_FIELD_ALL) == BL_READ_OK) )
+    {
+	// Group terminators carry no position
+	if ( (strcmp(BL_GFF3_TYPE(&feature), "###") != 0) &&
+	     ((type == NULL) || (strcmp(BL_GFF3_TYPE(&feature), type) == 0)) )
+	    status = bl_gff3_index_add(gi, &feature);
+    }
+    bl_gff3_free(&feature);
+    fclose(stream);
+    if ( status == BL_GFF3_INDEX_OK )
+	status = bl_gff3_index_partition(gi);
+    
+    /*
+     *  Other processes may have the old index mapped, and truncating it
+     *  would crash them with SIGBUS.  Write a new file beside it and
+     *  rename() it into place instead.
+     */
+    if ( (status == BL_GFF3_INDEX_OK) &&
+	 (stat(gff3_filename, &gff3_st) == 0) &&
+	 (snprintf(temp_filename, PATH_MAX + 1, "%s.XXXXXX", index_filename)
+	    <= PATH_MAX) &&
+	 ((fd = mkstemp(temp_filename)) != -1) )
+    {
+	// mkstemp() creates mode 0600, so share it like the GFF3 file
+	if ( (fchmod(fd, gff3_st.st_mode & 0666) != 0) ||
+	     ((stream = fdopen(fd, "w")) == NULL) )
+	{
+	    close(fd);
+	    unlink(temp_filename);
+	    return status;
+	}
+	write_status = bl_gff3_index_write(gi, stream, gff3_filename);
+	if ( (fclose(stream) != 0) || (write_status != BL_WRITE_OK) ||
+	     (rename(temp_filename, index_filename) != 0) )
+	    unlink(temp_filename);
+    }
+    return status;
+}
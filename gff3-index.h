@@ -13,32 +13,116 @@ extern "C" {
 #include <inttypes.h>
 #endif
 
+#ifndef __bool_true_false_are_defined
+#include <stdbool.h>
+#endif
+
 #ifndef _BIOLIBC_GFF3_H_
 #include "gff3.h"
 #endif
 
-#define BL_GFF3_INDEX_INIT { 0, 0, NULL, NULL }
+#ifndef _BIOLIBC_CHROM_DICT_H_
+#include "chrom-dict.h"
+#endif
+
+#define BL_GFF3_INDEX_INIT \
+	{ 0, 0, NULL, NULL, NULL, NULL, BL_CHROM_DICT_INIT, NULL, NULL, \
+	  NULL, 0, false, NULL, 0, 0 }
 
 #define BL_GFF3_INDEX_OK             0
 #define BL_GFF3_INDEX_MALLOC_FAILED  -1
 #define BL_GFF3_INDEX_BAD_ARG        -2
+#define BL_GFF3_INDEX_OPEN_FAILED    -3
+#define BL_GFF3_INDEX_STALE          -4  // Source changed since index written
+#define BL_GFF3_INDEX_BAD_FORMAT     -5
+
+/*
+ *  Index file format, in host byte order.  A bl_gff3_index_file_t header
+ *  is followed by the partitioned arrays start, end, max_ends and
+ *  file_pos (int64_t[count]), seqid_ids (int32_t[count], padded to 8
+ *  bytes), seqid_counts (uint64_t[seqid_count]), and the seqid names,
+ *  each NUL-terminated, in ID order.  Per-feature arrays are used in
+ *  place in a read-only memory map, so loading costs O(seqids).
+ */
+#define BL_GFF3_INDEX_MAGIC         "BLGFF3X"
+#define BL_GFF3_INDEX_VERSION       1
+#define BL_GFF3_INDEX_BYTE_ORDER    0x01020304
+
+typedef struct
+{
+    char        magic[8];
+    uint32_t    version,
+		byte_order;     // Detects files from other architectures
+    uint64_t    source_size;
+    int64_t     source_mtime;
+    uint32_t    source_crc,     // zlib crc32() of the entire source
+		reserved;
+    uint64_t    count,
+		seqid_count,
+		names_size;
+}   bl_gff3_index_file_t;
+
+/*
+ *  Entries are appended in input order.  Before searching, they are
+ *  partitioned by interned seqid (in order of first appearance) and
+ *  sorted by start within each partition, so a seqid's features are
+ *  the contiguous range seqid_offsets[id] .. + seqid_counts[id] and can
+ *  be binary searched.  max_ends[c] is the largest end of entries in the
+ *  partition up to and including c, which is nondecreasing and so can
+ *  also be binary searched.
+ */
 
 typedef struct
 {
     size_t      array_size;
     size_t      count;
     long        *file_pos;  // Return type of ftell()
-    char        **seqid;
+    int32_t     *seqid_ids;
     int64_t     *start;
     int64_t     *end;
+    
+    bl_chrom_dict_t dict;   // Interned seqids
+    int64_t     *max_ends;
+    size_t      *seqid_offsets,
+		*seqid_counts;
+    size_t      seqid_array_size;
+    bool        partitioned;
+    
+    // Set by bl_gff3_index_map(), which makes the index read-only
+    char        *map_base;
+    size_t      map_size;
+    uint32_t    source_crc;
 }   bl_gff3_index_t;
 
+// Temporary record for sorting the parallel arrays of a partition
+typedef struct
+{
+    int64_t     start,
+		end;
+    long        file_pos;
+}   bl_gff3_index_entry_t;
+
+// Seqid of entry c, by name
+#define BL_GFF3_INDEX_SEQID_AE(ptr,c) \
+	(BL_CHROM_DICT_NAMES_AE(&(ptr)->dict, (ptr)->seqid_ids[c]))
+
 #include "gff3-index-rvs.h"
 #include "gff3-index-accessors.h"
 #include "gff3-index-mutators.h"
 
+/* gff3-index.c */
+void bl_gff3_index_init(bl_gff3_index_t *gi);
+void bl_gff3_index_free(bl_gff3_index_t *gi);
 int bl_gff3_index_add(bl_gff3_index_t *gi, bl_gff3_t *feature);
-int bl_gff3_index_seek_reverse(bl_gff3_index_t *gi, FILE *stream, bl_gff3_t *feature, int64_t gene_count, int64_t max_nt);
+int bl_gff3_index_entry_cmp(const bl_gff3_index_entry_t *entry1, const bl_gff3_index_entry_t *entry2);
+int bl_gff3_index_partition(bl_gff3_index_t *gi);
+size_t bl_gff3_index_upper_bound(int64_t *array, size_t first, size_t last, int64_t value);
+int bl_gff3_index_seek_reverse(bl_gff3_index_t *gi, FILE *stream, bl_gff3_t *feature, int64_t feature_count, int64_t max_nt);
+int bl_gff3_index_checksum(const char *filename, uint32_t *crc);
+int bl_gff3_index_write(bl_gff3_index_t *gi, FILE *index_stream, const char *gff3_filename);
+int bl_gff3_index_map(bl_gff3_index_t *gi, const char *index_filename, const char *gff3_filename);
+int bl_gff3_index_verify(bl_gff3_index_t *gi, const char *gff3_filename);
+int bl_gff3_index_open(bl_gff3_index_t *gi, const char *gff3_filename, const char *type);
 
 #ifdef __cplusplus
 }
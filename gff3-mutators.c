@@ -1350,3 +1350,49 @@ int     bl_gff3_set_file_pos(bl_gff3_t *bl_gff3_ptr, long new_file_pos)
 	return BL_GFF3_DATA_OK;
     }
 }
+
+
+/***************************************************************************
+ *  Library:
+ *      #include <biolibc/gff3.h>
+ *      -lbiolibc -lxtend
+ *
+ *  Description:
+ *      Mutator for chrom_dict member in a bl_gff3_t structure.
+ *      Use this function to set chrom_dict in a bl_gff3_t object
+ *      from non-member functions.  The dictionary is shared, not
+ *      copied, and seqid_id is updated for the current SEQID.  Pass
+ *      NULL to stop interning names.
+ *
+ *  Arguments:
+ *      bl_gff3_ptr     Pointer to the structure to set
+ *      new_chrom_dict  The new value for chrom_dict
+ *
+ *  Returns:
+ *      BL_GFF3_DATA_OK
+ *
+ *  Examples:
+ *      bl_gff3_t       bl_gff3;
+ *      bl_chrom_dict_t *new_chrom_dict;
+ *
+ *      if ( bl_gff3_set_chrom_dict(&bl_gff3, new_chrom_dict)
+ *              == BL_GFF3_DATA_OK )
+ *      {
+ *      }
+ *
+ *  See also:
+ *      bl_chrom_dict_intern(3)
+ *
+ *  History: 
+ *  Date        Name        Modification
+ *  2026-10-17  agent       Begin
+ ***************************************************************************/
+
+int     bl_gff3_set_chrom_dict(bl_gff3_t *bl_gff3_ptr, bl_chrom_dict_t *new_chrom_dict)
+
+{
+    bl_gff3_ptr->chrom_dict = new_chrom_dict;
+    bl_gff3_ptr->seqid_id = bl_chrom_dict_intern(new_chrom_dict,
+			    BL_CHROM_ID_NONE, BL_GFF3_SEQID(bl_gff3_ptr));
+    return BL_GFF3_DATA_OK;
+}
@@ -40,3 +40,4 @@ int bl_gff3_set_feature_parent(bl_gff3_t *bl_gff3_ptr, char *new_feature_parent)
 int bl_gff3_set_feature_parent_ae(bl_gff3_t *bl_gff3_ptr, size_t c, char new_feature_parent_element);
 int bl_gff3_set_feature_parent_cpy(bl_gff3_t *bl_gff3_ptr, char *new_feature_parent, size_t array_size);
 int bl_gff3_set_file_pos(bl_gff3_t *bl_gff3_ptr, long new_file_pos);
+int bl_gff3_set_chrom_dict(bl_gff3_t *bl_gff3_ptr, bl_chrom_dict_t *new_chrom_dict);
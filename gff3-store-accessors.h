@@ -0,0 +1,30 @@
+    
+/*
+ *  Generated by /usr/local/bin/auto-gen-get-set
+ *
+ *  Accessor macros.  Use these to access structure members from functions
+ *  outside the bl_gff3_store_t class.
+ *
+ *  These generated macros are not expected to be perfect.  Check and edit
+ *  as needed before adding to your code.
+ */
+
+#define BL_GFF3_STORE_COUNT(ptr)        ((ptr)->count)
+#define BL_GFF3_STORE_STARTS(ptr)       ((ptr)->starts)
+#define BL_GFF3_STORE_STARTS_AE(ptr,c)  ((ptr)->starts[c])
+#define BL_GFF3_STORE_ENDS(ptr)         ((ptr)->ends)
+#define BL_GFF3_STORE_ENDS_AE(ptr,c)    ((ptr)->ends[c])
+#define BL_GFF3_STORE_SEQID_IDS(ptr)    ((ptr)->seqid_ids)
+#define BL_GFF3_STORE_SEQID_IDS_AE(ptr,c) ((ptr)->seqid_ids[c])
+#define BL_GFF3_STORE_SOURCE_IDS(ptr)   ((ptr)->source_ids)
+#define BL_GFF3_STORE_SOURCE_IDS_AE(ptr,c) ((ptr)->source_ids[c])
+#define BL_GFF3_STORE_TYPE_IDS(ptr)     ((ptr)->type_ids)
+#define BL_GFF3_STORE_TYPE_IDS_AE(ptr,c) ((ptr)->type_ids[c])
+#define BL_GFF3_STORE_SCORES(ptr)       ((ptr)->scores)
+#define BL_GFF3_STORE_SCORES_AE(ptr,c)  ((ptr)->scores[c])
+#define BL_GFF3_STORE_STRANDS(ptr)      ((ptr)->strands)
+#define BL_GFF3_STORE_STRANDS_AE(ptr,c) ((ptr)->strands[c])
+#define BL_GFF3_STORE_PHASES(ptr)       ((ptr)->phases)
+#define BL_GFF3_STORE_PHASES_AE(ptr,c)  ((ptr)->phases[c])
+#define BL_GFF3_STORE_FILE_POS(ptr)     ((ptr)->file_pos)
+#define BL_GFF3_STORE_FILE_POS_AE(ptr,c) ((ptr)->file_pos[c])
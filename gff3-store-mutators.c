@@ -0,0 +1,1581 @@
+/***************************************************************************
+ *  This file is automatically generated by gen-get-set.  Be sure to keep
+ *  track of any manual changes.
+ *
+ *  These generated functions are not expected to be perfect.  Check and
+ *  edit as needed before adding to your code.
+ ***************************************************************************/
+
+#include <string.h>
+#include <ctype.h>
+#include <stdbool.h>        // In case of bool
+#include <stdint.h>         // In case of int64_t, etc
+#include <xtend/string.h>   // strlcpy() on Linux
+#include "gff3-store.h"
+
+
+/***************************************************************************
+ *  Library:
+ *      #include <biolibc/gff3-store.h>
+ *      -lbiolibc -lxtend
+ *
+ *  Description:
+ *      Mutator for count member in a bl_gff3_store_t structure.
+ *      Use this function to set count in a bl_gff3_store_t object
+ *      from non-member functions.  This function performs a direct
+ *      assignment for scalar or pointer structure members.  If
+ *      count is a pointer, data previously pointed to should
+ *      be freed before calling this function to avoid memory
+ *      leaks.
+ *
+ *  Arguments:
+ *      bl_gff3_store_ptr Pointer to the structure to set
+ *      new_count       The new value for count
+ *
+ *  Returns:
+ *      BL_GFF3_STORE_DATA_OK if the new value is acceptable and assigned
+ *      BL_GFF3_STORE_DATA_OUT_OF_RANGE otherwise
+ *
+ *  Examples:
+ *      bl_gff3_store_t bl_gff3_store;
+ *      size_t          new_count;
+ *
+ *      if ( bl_gff3_store_set_count(&bl_gff3_store, new_count)
+ *              == BL_GFF3_STORE_DATA_OK )
+ *      {
+ *      }
+ *
+ *  See also:
+ *      (3)
+ *
+ *  History: 
+ *  Date        Name        Modification
+ *  2026-10-17  gen-get-set Auto-generated from gff3-store.h
+ ***************************************************************************/
+
+int     bl_gff3_store_set_count(
+	    bl_gff3_store_t *bl_gff3_store_ptr,
+	    size_t new_count
+	)
+
+{
+    if ( false )
+	return BL_GFF3_STORE_DATA_OUT_OF_RANGE;
+    else
+    {
+	bl_gff3_store_ptr->count = new_count;
+	return BL_GFF3_STORE_DATA_OK;
+    }
+}
+
+
+/***************************************************************************
+ *  Library:
+ *      #include <biolibc/gff3-store.h>
+ *      -lbiolibc -lxtend
+ *
+ *  Description:
+ *      Mutator for starts member in a bl_gff3_store_t structure.
+ *      Use this function to set starts in a bl_gff3_store_t object
+ *      from non-member functions.  This function performs a direct
+ *      assignment for scalar or pointer structure members.  If
+ *      starts is a pointer, data previously pointed to should
+ *      be freed before calling this function to avoid memory
+ *      leaks.
+ *
+ *  Arguments:
+ *      bl_gff3_store_ptr Pointer to the structure to set
+ *      new_starts      The new value for starts
+ *
+ *  Returns:
+ *      BL_GFF3_STORE_DATA_OK if the new value is acceptable and assigned
+ *      BL_GFF3_STORE_DATA_OUT_OF_RANGE otherwise
+ *
+ *  Examples:
+ *      bl_gff3_store_t bl_gff3_store;
+ *      int64_t *       new_starts;
+ *
+ *      if ( bl_gff3_store_set_starts(&bl_gff3_store, new_starts)
+ *              == BL_GFF3_STORE_DATA_OK )
+ *      {
+ *      }
+ *
+ *  See also:
+ *      (3)
+ *
+ *  History: 
+ *  Date        Name        Modification
+ *  2026-10-17  gen-get-set Auto-generated from gff3-store.h
+ ***************************************************************************/
+
+int     bl_gff3_store_set_starts(
+	    bl_gff3_store_t *bl_gff3_store_ptr,
+	    int64_t *new_starts
+	)
+
+{
+    if ( new_starts == NULL )
+	return BL_GFF3_STORE_DATA_OUT_OF_RANGE;
+    else
+    {
+	bl_gff3_store_ptr->starts = new_starts;
+	return BL_GFF3_STORE_DATA_OK;
+    }
+}
+
+
+/***************************************************************************
+ *  Library:
+ *      #include <biolibc/gff3-store.h>
+ *      -lbiolibc -lxtend
+ *
+ *  Description:
+ *      Mutator for an array element of starts member in a bl_gff3_store_t
+ *      structure. Use this function to set bl_gff3_store_ptr->starts[c]
+ *      in a bl_gff3_store_t object from non-member functions.
+ *
+ *  Arguments:
+ *      bl_gff3_store_ptr Pointer to the structure to set
+ *      c               Subscript to the starts array
+ *      new_starts_element The new value for starts[c]
+ *
+ *  Returns:
+ *      BL_GFF3_STORE_DATA_OK if the new value is acceptable and assigned
+ *      BL_GFF3_STORE_DATA_OUT_OF_RANGE otherwise
+ *
+ *  Examples:
+ *      bl_gff3_store_t bl_gff3_store;
+ *      size_t          c;
+ *      int64_t         new_starts_element;
+ *
+ *      if ( bl_gff3_store_set_starts_ae(&bl_gff3_store, c, new_starts_element)
+ *              == BL_GFF3_STORE_DATA_OK )
+ *      {
+ *      }
+ *
+ *  See also:
+ *      BL_GFF3_STORE_SET_STARTS_AE(3)
+ *
+ *  History: 
+ *  Date        Name        Modification
+ *  2026-10-17  gen-get-set Auto-generated from gff3-store.h
+ ***************************************************************************/
+
+int     bl_gff3_store_set_starts_ae(
+	    bl_gff3_store_t *bl_gff3_store_ptr,
+	    size_t c,
+	    int64_t new_starts_element
+	)
+
+{
+    if ( false )
+	return BL_GFF3_STORE_DATA_OUT_OF_RANGE;
+    else
+    {
+	bl_gff3_store_ptr->starts[c] = new_starts_element;
+	return BL_GFF3_STORE_DATA_OK;
+    }
+}
+
+
+/***************************************************************************
+ *  Library:
+ *      #include <biolibc/gff3-store.h>
+ *      -lbiolibc -lxtend
+ *
+ *  Description:
+ *      Mutator for starts member in a bl_gff3_store_t structure.
+ *      Use this function to set starts in a bl_gff3_store_t object
+ *      from non-member functions.  This function copies the array pointed to
+ *      by new_starts to bl_gff3_store_ptr->starts.
+ *
+ *  Arguments:
+ *      bl_gff3_store_ptr Pointer to the structure to set
+ *      new_starts      The new value for starts
+ *      array_size      Size of the starts array.
+ *
+ *  Returns:
+ *      BL_GFF3_STORE_DATA_OK if the new value is acceptable and assigned
+ *      BL_GFF3_STORE_DATA_OUT_OF_RANGE otherwise
+ *
+ *  Examples:
+ *      bl_gff3_store_t bl_gff3_store;
+ *      int64_t *       new_starts;
+ *      size_t          array_size;
+ *
+ *      if ( bl_gff3_store_set_starts_cpy(&bl_gff3_store, new_starts, array_size)
+ *              == BL_GFF3_STORE_DATA_OK )
+ *      {
+ *      }
+ *
+ *  See also:
+ *      BL_GFF3_STORE_SET_STARTS(3)
+ *
+ *  History: 
+ *  Date        Name        Modification
+ *  2026-10-17  gen-get-set Auto-generated from gff3-store.h
+ ***************************************************************************/
+
+int     bl_gff3_store_set_starts_cpy(
+	    bl_gff3_store_t *bl_gff3_store_ptr,
+	    int64_t *new_starts,
+	    size_t array_size
+	)
+
+{
+    if ( new_starts == NULL )
+	return BL_GFF3_STORE_DATA_OUT_OF_RANGE;
+    else
+    {
+	size_t  c;
+	
+	// FIXME: Assuming all elements should be copied
+	for (c = 0; c < array_size; ++c)
+	    bl_gff3_store_ptr->starts[c] = new_starts[c];
+	return BL_GFF3_STORE_DATA_OK;
+    }
+}
+
+
+/***************************************************************************
+ *  Library:
+ *      #include <biolibc/gff3-store.h>
+ *      -lbiolibc -lxtend
+ *
+ *  Description:
+ *      Mutator for ends member in a bl_gff3_store_t structure.
+ *      Use this function to set ends in a bl_gff3_store_t object
+ *      from non-member functions.  This function performs a direct
+ *      assignment for scalar or pointer structure members.  If
+ *      ends is a pointer, data previously pointed to should
+ *      be freed before calling this function to avoid memory
+ *      leaks.
+ *
+ *  Arguments:
+ *      bl_gff3_store_ptr Pointer to the structure to set
+ *      new_ends        The new value for ends
+ *
+ *  Returns:
+ *      BL_GFF3_STORE_DATA_OK if the new value is acceptable and assigned
+ *      BL_GFF3_STORE_DATA_OUT_OF_RANGE otherwise
+ *
+ *  Examples:
+ *      bl_gff3_store_t bl_gff3_store;
+ *      int64_t *       new_ends;
+ *
+ *      if ( bl_gff3_store_set_ends(&bl_gff3_store, new_ends)
+ *              == BL_GFF3_STORE_DATA_OK )
+ *      {
+ *      }
+ *
+ *  See also:
+ *      (3)
+ *
+ *  History: 
+ *  Date        Name        Modification
+ *  2026-10-17  gen-get-set Auto-generated from gff3-store.h
+ ***************************************************************************/
+
+int     bl_gff3_store_set_ends(
+	    bl_gff3_store_t *bl_gff3_store_ptr,
+	    int64_t *new_ends
+	)
+
+{
+    if ( new_ends == NULL )
+	return BL_GFF3_STORE_DATA_OUT_OF_RANGE;
+    else
+    {
+	bl_gff3_store_ptr->ends = new_ends;
+	return BL_GFF3_STORE_DATA_OK;
+    }
+}
+
+
+/***************************************************************************
+ *  Library:
+ *      #include <biolibc/gff3-store.h>
+ *      -lbiolibc -lxtend
+ *
+ *  Description:
+ *      Mutator for an array element of ends member in a bl_gff3_store_t
+ *      structure. Use this function to set bl_gff3_store_ptr->ends[c]
+ *      in a bl_gff3_store_t object from non-member functions.
+ *
+ *  Arguments:
+ *      bl_gff3_store_ptr Pointer to the structure to set
+ *      c               Subscript to the ends array
+ *      new_ends_element The new value for ends[c]
+ *
+ *  Returns:
+ *      BL_GFF3_STORE_DATA_OK if the new value is acceptable and assigned
+ *      BL_GFF3_STORE_DATA_OUT_OF_RANGE otherwise
+ *
+ *  Examples:
+ *      bl_gff3_store_t bl_gff3_store;
+ *      size_t          c;
+ *      int64_t         new_ends_element;
+ *
+ *      if ( bl_gff3_store_set_ends_ae(&bl_gff3_store, c, new_ends_element)
+ *              == BL_GFF3_STORE_DATA_OK )
+ *      {
+ *      }
+ *
+ *  See also:
+ *      BL_GFF3_STORE_SET_ENDS_AE(3)
+ *
+ *  History: 
+ *  Date        Name        Modification
+ *  2026-10-17  gen-get-set Auto-generated from gff3-store.h
+ ***************************************************************************/
+
+int     bl_gff3_store_set_ends_ae(
+	    bl_gff3_store_t *bl_gff3_store_ptr,
+	    size_t c,
+	    int64_t new_ends_element
+	)
+
+{
+    if ( false )
+	return BL_GFF3_STORE_DATA_OUT_OF_RANGE;
+    else
+    {
+	bl_gff3_store_ptr->ends[c] = new_ends_element;
+	return BL_GFF3_STORE_DATA_OK;
+    }
+}
+
+
+/***************************************************************************
+ *  Library:
+ *      #include <biolibc/gff3-store.h>
+ *      -lbiolibc -lxtend
+ *
+ *  Description:
+ *      Mutator for ends member in a bl_gff3_store_t structure.
+ *      Use this function to set ends in a bl_gff3_store_t object
+ *      from non-member functions.  This function copies the array pointed to
+ *      by new_ends to bl_gff3_store_ptr->ends.
+ *
+ *  Arguments:
+ *      bl_gff3_store_ptr Pointer to the structure to set
+ *      new_ends        The new value for ends
+ *      array_size      Size of the ends array.
+ *
+ *  Returns:
+ *      BL_GFF3_STORE_DATA_OK if the new value is acceptable and assigned
+ *      BL_GFF3_STORE_DATA_OUT_OF_RANGE otherwise
+ *
+ *  Examples:
+ *      bl_gff3_store_t bl_gff3_store;
+ *      int64_t *       new_ends;
+ *      size_t          array_size;
+ *
+ *      if ( bl_gff3_store_set_ends_cpy(&bl_gff3_store, new_ends, array_size)
+ *              == BL_GFF3_STORE_DATA_OK )
+ *      {
+ *      }
+ *
+ *  See also:
+ *      BL_GFF3_STORE_SET_ENDS(3)
+ *
+ *  History: 
+ *  Date        Name        Modification
+ *  2026-10-17  gen-get-set Auto-generated from gff3-store.h
+ ***************************************************************************/
+
+int     bl_gff3_store_set_ends_cpy(
+	    bl_gff3_store_t *bl_gff3_store_ptr,
+	    int64_t *new_ends,
+	    size_t array_size
+	)
+
+{
+    if ( new_ends == NULL )
+	return BL_GFF3_STORE_DATA_OUT_OF_RANGE;
+    else
+    {
+	size_t  c;
+	
+	// FIXME: Assuming all elements should be copied
+	for (c = 0; c < array_size; ++c)
+	    bl_gff3_store_ptr->ends[c] = new_ends[c];
+	return BL_GFF3_STORE_DATA_OK;
+    }
+}
+
+
+/***************************************************************************
+ *  Library:
+ *      #include <biolibc/gff3-store.h>
+ *      -lbiolibc -lxtend
+ *
+ *  Description:
+ *      Mutator for seqid_ids member in a bl_gff3_store_t structure.
+ *      Use this function to set seqid_ids in a bl_gff3_store_t object
+ *      from non-member functions.  This function performs a direct
+ *      assignment for scalar or pointer structure members.  If
+ *      seqid_ids is a pointer, data previously pointed to should
+ *      be freed before calling this function to avoid memory
+ *      leaks.
+ *
+ *  Arguments:
+ *      bl_gff3_store_ptr Pointer to the structure to set
+ *      new_seqid_ids   The new value for seqid_ids
+ *
+ *  Returns:
+ *      BL_GFF3_STORE_DATA_OK if the new value is acceptable and assigned
+ *      BL_GFF3_STORE_DATA_OUT_OF_RANGE otherwise
+ *
+ *  Examples:
+ *      bl_gff3_store_t bl_gff3_store;
+ *      int32_t *       new_seqid_ids;
+ *
+ *      if ( bl_gff3_store_set_seqid_ids(&bl_gff3_store, new_seqid_ids)
+ *              == BL_GFF3_STORE_DATA_OK )
+ *      {
+ *      }
+ *
+ *  See also:
+ *      (3)
+ *
+ *  History: 
+ *  Date        Name        Modification
+ *  2026-10-17  gen-get-set Auto-generated from gff3-store.h
+ ***************************************************************************/
+
+int     bl_gff3_store_set_seqid_ids(
+	    bl_gff3_store_t *bl_gff3_store_ptr,
+	    int32_t *new_seqid_ids
+	)
+
+{
+    if ( new_seqid_ids == NULL )
+	return BL_GFF3_STORE_DATA_OUT_OF_RANGE;
+    else
+    {
+	bl_gff3_store_ptr->seqid_ids = new_seqid_ids;
+	return BL_GFF3_STORE_DATA_OK;
+    }
+}
+
+
+/***************************************************************************
+ *  Library:
+ *      #include <biolibc/gff3-store.h>
+ *      -lbiolibc -lxtend
+ *
+ *  Description:
+ *      Mutator for an array element of seqid_ids member in a bl_gff3_store_t
+ *      structure. Use this function to set bl_gff3_store_ptr->seqid_ids[c]
+ *      in a bl_gff3_store_t object from non-member functions.
+ *
+ *  Arguments:
+ *      bl_gff3_store_ptr Pointer to the structure to set
+ *      c               Subscript to the seqid_ids array
+ *      new_seqid_ids_element The new value for seqid_ids[c]
+ *
+ *  Returns:
+ *      BL_GFF3_STORE_DATA_OK if the new value is acceptable and assigned
+ *      BL_GFF3_STORE_DATA_OUT_OF_RANGE otherwise
+ *
+ *  Examples:
+ *      bl_gff3_store_t bl_gff3_store;
+ *      size_t          c;
+ *      int32_t         new_seqid_ids_element;
+ *
+ *      if ( bl_gff3_store_set_seqid_ids_ae(&bl_gff3_store, c, new_seqid_ids_element)
+ *              == BL_GFF3_STORE_DATA_OK )
+ *      {
+ *      }
+ *
+ *  See also:
+ *      BL_GFF3_STORE_SET_SEQID_IDS_AE(3)
+ *
+ *  History: 
+ *  Date        Name        Modification
+ *  2026-10-17  gen-get-set Auto-generated from gff3-store.h
+ ***************************************************************************/
+
+int     bl_gff3_store_set_seqid_ids_ae(
+	    bl_gff3_store_t *bl_gff3_store_ptr,
+	    size_t c,
+	    int32_t new_seqid_ids_element
+	)
+
+{
+    if ( false )
+	return BL_GFF3_STORE_DATA_OUT_OF_RANGE;
+    else
+    {
+	bl_gff3_store_ptr->seqid_ids[c] = new_seqid_ids_element;
+	return BL_GFF3_STORE_DATA_OK;
+    }
+}
+
+
+/***************************************************************************
+ *  Library:
+ *      #include <biolibc/gff3-store.h>
+ *      -lbiolibc -lxtend
+ *
+ *  Description:
+ *      Mutator for seqid_ids member in a bl_gff3_store_t structure.
+ *      Use this function to set seqid_ids in a bl_gff3_store_t object
+ *      from non-member functions.  This function copies the array pointed to
+ *      by new_seqid_ids to bl_gff3_store_ptr->seqid_ids.
+ *
+ *  Arguments:
+ *      bl_gff3_store_ptr Pointer to the structure to set
+ *      new_seqid_ids   The new value for seqid_ids
+ *      array_size      Size of the seqid_ids array.
+ *
+ *  Returns:
+ *      BL_GFF3_STORE_DATA_OK if the new value is acceptable and assigned
+ *      BL_GFF3_STORE_DATA_OUT_OF_RANGE otherwise
+ *
+ *  Examples:
+ *      bl_gff3_store_t bl_gff3_store;
+ *      int32_t *       new_seqid_ids;
+ *      size_t          array_size;
+ *
+ *      if ( bl_gff3_store_set_seqid_ids_cpy(&bl_gff3_store, new_seqid_ids, array_size)
+ *              == BL_GFF3_STORE_DATA_OK )
+ *      {
+ *      }
+ *
+ *  See also:
+ *      BL_GFF3_STORE_SET_SEQID_IDS(3)
+ *
+ *  History: 
+ *  Date        Name        Modification
+ *  2026-10-17  gen-get-set Auto-generated from gff3-store.h
+ ***************************************************************************/
+
+int     bl_gff3_store_set_seqid_ids_cpy(
+	    bl_gff3_store_t *bl_gff3_store_ptr,
+	    int32_t *new_seqid_ids,
+	    size_t array_size
+	)
+
+{
+    if ( new_seqid_ids == NULL )
+	return BL_GFF3_STORE_DATA_OUT_OF_RANGE;
+    else
+    {
+	size_t  c;
+	
+	// FIXME: Assuming all elements should be copied
+	for (c = 0; c < array_size; ++c)
+	    bl_gff3_store_ptr->seqid_ids[c] = new_seqid_ids[c];
+	return BL_GFF3_STORE_DATA_OK;
+    }
+}
+
+
+/***************************************************************************
+ *  Library:
+ *      #include <biolibc/gff3-store.h>
+ *      -lbiolibc -lxtend
+ *
+ *  Description:
+ *      Mutator for source_ids member in a bl_gff3_store_t structure.
+ *      Use this function to set source_ids in a bl_gff3_store_t object
+ *      from non-member functions.  This function performs a direct
+ *      assignment for scalar or pointer structure members.  If
+ *      source_ids is a pointer, data previously pointed to should
+ *      be freed before calling this function to avoid memory
+ *      leaks.
+ *
+ *  Arguments:
+ *      bl_gff3_store_ptr Pointer to the structure to set
+ *      new_source_ids  The new value for source_ids
+ *
+ *  Returns:
+ *      BL_GFF3_STORE_DATA_OK if the new value is acceptable and assigned
+ *      BL_GFF3_STORE_DATA_OUT_OF_RANGE otherwise
+ *
+ *  Examples:
+ *      bl_gff3_store_t bl_gff3_store;
+ *      int32_t *       new_source_ids;
+ *
+ *      if ( bl_gff3_store_set_source_ids(&bl_gff3_store, new_source_ids)
+ *              == BL_GFF3_STORE_DATA_OK )
+ *      {
+ *      }
+ *
+ *  See also:
+ *      (3)
+ *
+ *  History: 
+ *  Date        Name        Modification
+ *  2026-10-17  gen-get-set Auto-generated from gff3-store.h
+ ***************************************************************************/
+
+int     bl_gff3_store_set_source_ids(
+	    bl_gff3_store_t *bl_gff3_store_ptr,
+	    int32_t *new_source_ids
+	)
+
+{
+    if ( new_source_ids == NULL )
+	return BL_GFF3_STORE_DATA_OUT_OF_RANGE;
+    else
+    {
+	bl_gff3_store_ptr->source_ids = new_source_ids;
+	return BL_GFF3_STORE_DATA_OK;
+    }
+}
+
+
+/***************************************************************************
+ *  Library:
+ *      #include <biolibc/gff3-store.h>
+ *      -lbiolibc -lxtend
+ *
+ *  Description:
+ *      Mutator for an array element of source_ids member in a bl_gff3_store_t
+ *      structure. Use this function to set bl_gff3_store_ptr->source_ids[c]
+ *      in a bl_gff3_store_t object from non-member functions.
+ *
+ *  Arguments:
+ *      bl_gff3_store_ptr Pointer to the structure to set
+ *      c               Subscript to the source_ids array
+ *      new_source_ids_element The new value for source_ids[c]
+ *
+ *  Returns:
+ *      BL_GFF3_STORE_DATA_OK if the new value is acceptable and assigned
+ *      BL_GFF3_STORE_DATA_OUT_OF_RANGE otherwise
+ *
+ *  Examples:
+ *      bl_gff3_store_t bl_gff3_store;
+ *      size_t          c;
+ *      int32_t         new_source_ids_element;
+ *
+ *      if ( bl_gff3_store_set_source_ids_ae(&bl_gff3_store, c, new_source_ids_element)
+ *              == BL_GFF3_STORE_DATA_OK )
+ *      {
+ *      }
+ *
+ *  See also:
+ *      BL_GFF3_STORE_SET_SOURCE_IDS_AE(3)
+ *
+ *  History: 
+ *  Date        Name        Modification
+ *  2026-10-17  gen-get-set Auto-generated from gff3-store.h
+ ***************************************************************************/
+
+int     bl_gff3_store_set_source_ids_ae(
+	    bl_gff3_store_t *bl_gff3_store_ptr,
+	    size_t c,
+	    int32_t new_source_ids_element
+	)
+
+{
+    if ( false )
+	return BL_GFF3_STORE_DATA_OUT_OF_RANGE;
+    else
+    {
+	bl_gff3_store_ptr->source_ids[c] = new_source_ids_element;
+	return BL_GFF3_STORE_DATA_OK;
+    }
+}
+
+
+/***************************************************************************
+ *  Library:
+ *      #include <biolibc/gff3-store.h>
+ *      -lbiolibc -lxtend
+ *
+ *  Description:
+ *      Mutator for source_ids member in a bl_gff3_store_t structure.
+ *      Use this function to set source_ids in a bl_gff3_store_t object
+ *      from non-member functions.  This function copies the array pointed to
+ *      by new_source_ids to bl_gff3_store_ptr->source_ids.
+ *
+ *  Arguments:
+ *      bl_gff3_store_ptr Pointer to the structure to set
+ *      new_source_ids  The new value for source_ids
+ *      array_size      Size of the source_ids array.
+ *
+ *  Returns:
+ *      BL_GFF3_STORE_DATA_OK if the new value is acceptable and assigned
+ *      BL_GFF3_STORE_DATA_OUT_OF_RANGE otherwise
+ *
+ *  Examples:
+ *      bl_gff3_store_t bl_gff3_store;
+ *      int32_t *       new_source_ids;
+ *      size_t          array_size;
+ *
+ *      if ( bl_gff3_store_set_source_ids_cpy(&bl_gff3_store, new_source_ids, array_size)
+ *              == BL_GFF3_STORE_DATA_OK )
+ *      {
+ *      }
+ *
+ *  See also:
+ *      BL_GFF3_STORE_SET_SOURCE_IDS(3)
+ *
+ *  History: 
+ *  Date        Name        Modification
+ *  2026-10-17  gen-get-set Auto-generated from gff3-store.h
+ ***************************************************************************/
+
+int     bl_gff3_store_set_source_ids_cpy(
+	    bl_gff3_store_t *bl_gff3_store_ptr,
+	    int32_t *new_source_ids,
+	    size_t array_size
+	)
+
+{
+    if ( new_source_ids == NULL )
+	return BL_GFF3_STORE_DATA_OUT_OF_RANGE;
+    else
+    {
+	size_t  c;
+	
+	// FIXME: Assuming all elements should be copied
+	for (c = 0; c < array_size; ++c)
+	    bl_gff3_store_ptr->source_ids[c] = new_source_ids[c];
+	return BL_GFF3_STORE_DATA_OK;
+    }
+}
+
+
+/***************************************************************************
+ *  Library:
+ *      #include <biolibc/gff3-store.h>
+ *      -lbiolibc -lxtend
+ *
+ *  Description:
+ *      Mutator for type_ids member in a bl_gff3_store_t structure.
+ *      Use this function to set type_ids in a bl_gff3_store_t object
+ *      from non-member functions.  This function performs a direct
+ *      assignment for scalar or pointer structure members.  If
+ *      type_ids is a pointer, data previously pointed to should
+ *      be freed before calling this function to avoid memory
+ *      leaks.
+ *
+ *  Arguments:
+ *      bl_gff3_store_ptr Pointer to the structure to set
+ *      new_type_ids    The new value for type_ids
+ *
+ *  Returns:
+ *      BL_GFF3_STORE_DATA_OK if the new value is acceptable and assigned
+ *      BL_GFF3_STORE_DATA_OUT_OF_RANGE otherwise
+ *
+ *  Examples:
+ *      bl_gff3_store_t bl_gff3_store;
+ *      int32_t *       new_type_ids;
+ *
+ *      if ( bl_gff3_store_set_type_ids(&bl_gff3_store, new_type_ids)
+ *              == BL_GFF3_STORE_DATA_OK )
+ *      {
+ *      }
+ *
+ *  See also:
+ *      (3)
+ *
+ *  History: 
+ *  Date        Name        Modification
+ *  2026-10-17  gen-get-set Auto-generated from gff3-store.h
+ ***************************************************************************/
+
+int     bl_gff3_store_set_type_ids(
+	    bl_gff3_store_t *bl_gff3_store_ptr,
+	    int32_t *new_type_ids
+	)
+
+{
+    if ( new_type_ids == NULL )
+	return BL_GFF3_STORE_DATA_OUT_OF_RANGE;
+    else
+    {
+	bl_gff3_store_ptr->type_ids = new_type_ids;
+	return BL_GFF3_STORE_DATA_OK;
+    }
+}
+
+
+/***************************************************************************
+ *  Library:
+ *      #include <biolibc/gff3-store.h>
+ *      -lbiolibc -lxtend
+ *
+ *  Description:
+ *      Mutator for an array element of type_ids member in a bl_gff3_store_t
+ *      structure. Use this function to set bl_gff3_store_ptr->type_ids[c]
+ *      in a bl_gff3_store_t object from non-member functions.
+ *
+ *  Arguments:
+ *      bl_gff3_store_ptr Pointer to the structure to set
+ *      c               Subscript to the type_ids array
+ *      new_type_ids_element The new value for type_ids[c]
+ *
+ *  Returns:
+ *      BL_GFF3_STORE_DATA_OK if the new value is acceptable and assigned
+ *      BL_GFF3_STORE_DATA_OUT_OF_RANGE otherwise
+ *
+ *  Examples:
+ *      bl_gff3_store_t bl_gff3_store;
+ *      size_t          c;
+ *      int32_t         new_type_ids_element;
+ *
+ *      if ( bl_gff3_store_set_type_ids_ae(&bl_gff3_store, c, new_type_ids_element)
+ *              == BL_GFF3_STORE_DATA_OK )
+ *      {
+ *      }
+ *
+ *  See also:
+ *      BL_GFF3_STORE_SET_TYPE_IDS_AE(3)
+ *
+ *  History: 
+ *  Date        Name        Modification
+ *  2026-10-17  gen-get-set Auto-generated from gff3-store.h
+ ***************************************************************************/
+
+int     bl_gff3_store_set_type_ids_ae(
+	    bl_gff3_store_t *bl_gff3_store_ptr,
+	    size_t c,
+	    int32_t new_type_ids_element
+	)
+
+{
+    if ( false )
+	return BL_GFF3_STORE_DATA_OUT_OF_RANGE;
+    else
+    {
+	bl_gff3_store_ptr->type_ids[c] = new_type_ids_element;
+	return BL_GFF3_STORE_DATA_OK;
+    }
+}
+
+
+/***************************************************************************
+ *  Library:
+ *      #include <biolibc/gff3-store.h>
+ *      -lbiolibc -lxtend
+ *
+ *  Description:
+ *      Mutator for type_ids member in a bl_gff3_store_t structure.
+ *      Use this function to set type_ids in a bl_gff3_store_t object
+ *      from non-member functions.  This function copies the array pointed to
+ *      by new_type_ids to bl_gff3_store_ptr->type_ids.
+ *
+ *  Arguments:
+ *      bl_gff3_store_ptr Pointer to the structure to set
+ *      new_type_ids    The new value for type_ids
+ *      array_size      Size of the type_ids array.
+ *
+ *  Returns:
+ *      BL_GFF3_STORE_DATA_OK if the new value is acceptable and assigned
+ *      BL_GFF3_STORE_DATA_OUT_OF_RANGE otherwise
+ *
+ *  Examples:
+ *      bl_gff3_store_t bl_gff3_store;
+ *      int32_t *       new_type_ids;
+ *      size_t          array_size;
+ *
+ *      if ( bl_gff3_store_set_type_ids_cpy(&bl_gff3_store, new_type_ids, array_size)
+ *              == BL_GFF3_STORE_DATA_OK )
+ *      {
+ *      }
+ *
+ *  See also:
+ *      BL_GFF3_STORE_SET_TYPE_IDS(3)
+ *
+ *  History: 
+ *  Date        Name        Modification
+ *  2026-10-17  gen-get-set Auto-generated from gff3-store.h
+ ***************************************************************************/
+
+int     bl_gff3_store_set_type_ids_cpy(
+	    bl_gff3_store_t *bl_gff3_store_ptr,
+	    int32_t *new_type_ids,
+	    size_t array_size
+	)
+
+{
+    if ( new_type_ids == NULL )
+	return BL_GFF3_STORE_DATA_OUT_OF_RANGE;
+    else
+    {
+	size_t  c;
+	
+	// FIXME: Assuming all elements should be copied
+	for (c = 0; c < array_size; ++c)
+	    bl_gff3_store_ptr->type_ids[c] = new_type_ids[c];
+	return BL_GFF3_STORE_DATA_OK;
+    }
+}
+
+
+/***************************************************************************
+ *  Library:
+ *      #include <biolibc/gff3-store.h>
+ *      -lbiolibc -lxtend
+ *
+ *  Description:
+ *      Mutator for scores member in a bl_gff3_store_t structure.
+ *      Use this function to set scores in a bl_gff3_store_t object
+ *      from non-member functions.  This function performs a direct
+ *      assignment for scalar or pointer structure members.  If
+ *      scores is a pointer, data previously pointed to should
+ *      be freed before calling this function to avoid memory
+ *      leaks.
+ *
+ *  Arguments:
+ *      bl_gff3_store_ptr Pointer to the structure to set
+ *      new_scores      The new value for scores
+ *
+ *  Returns:
+ *      BL_GFF3_STORE_DATA_OK if the new value is acceptable and assigned
+ *      BL_GFF3_STORE_DATA_OUT_OF_RANGE otherwise
+ *
+ *  Examples:
+ *      bl_gff3_store_t bl_gff3_store;
+ *      double *        new_scores;
+ *
+ *      if ( bl_gff3_store_set_scores(&bl_gff3_store, new_scores)
+ *              == BL_GFF3_STORE_DATA_OK )
+ *      {
+ *      }
+ *
+ *  See also:
+ *      (3)
+ *
+ *  History: 
+ *  Date        Name        Modification
+ *  2026-10-17  gen-get-set Auto-generated from gff3-store.h
+ ***************************************************************************/
+
+int     bl_gff3_store_set_scores(
+	    bl_gff3_store_t *bl_gff3_store_ptr,
+	    double *new_scores
+	)
+
+{
+    if ( new_scores == NULL )
+	return BL_GFF3_STORE_DATA_OUT_OF_RANGE;
+    else
+    {
+	bl_gff3_store_ptr->scores = new_scores;
+	return BL_GFF3_STORE_DATA_OK;
+    }
+}
+
+
+/***************************************************************************
+ *  Library:
+ *      #include <biolibc/gff3-store.h>
+ *      -lbiolibc -lxtend
+ *
+ *  Description:
+ *      Mutator for an array element of scores member in a bl_gff3_store_t
+ *      structure. Use this function to set bl_gff3_store_ptr->scores[c]
+ *      in a bl_gff3_store_t object from non-member functions.
+ *
+ *  Arguments:
+ *      bl_gff3_store_ptr Pointer to the structure to set
+ *      c               Subscript to the scores array
+ *      new_scores_element The new value for scores[c]
+ *
+ *  Returns:
+ *      BL_GFF3_STORE_DATA_OK if the new value is acceptable and assigned
+ *      BL_GFF3_STORE_DATA_OUT_OF_RANGE otherwise
+ *
+ *  Examples:
+ *      bl_gff3_store_t bl_gff3_store;
+ *      size_t          c;
+ *      double          new_scores_element;
+ *
+ *      if ( bl_gff3_store_set_scores_ae(&bl_gff3_store, c, new_scores_element)
+ *              == BL_GFF3_STORE_DATA_OK )
+ *      {
+ *      }
+ *
+ *  See also:
+ *      BL_GFF3_STORE_SET_SCORES_AE(3)
+ *
+ *  History: 
+ *  Date        Name        Modification
+ *  2026-10-17  gen-get-set Auto-generated from gff3-store.h
+ ***************************************************************************/
+
+int     bl_gff3_store_set_scores_ae(
+	    bl_gff3_store_t *bl_gff3_store_ptr,
+	    size_t c,
+	    double new_scores_element
+	)
+
+{
+    if ( false )
+	return BL_GFF3_STORE_DATA_OUT_OF_RANGE;
+    else
+    {
+	bl_gff3_store_ptr->scores[c] = new_scores_element;
+	return BL_GFF3_STORE_DATA_OK;
+    }
+}
+
+
+/***************************************************************************
+ *  Library:
+ *      #include <biolibc/gff3-store.h>
+ *      -lbiolibc -lxtend
+ *
+ *  Description:
+ *      Mutator for scores member in a bl_gff3_store_t structure.
+ *      Use this function to set scores in a bl_gff3_store_t object
+ *      from non-member functions.  This function copies the array pointed to
+ *      by new_scores to bl_gff3_store_ptr->scores.
+ *
+ *  Arguments:
+ *      bl_gff3_store_ptr Pointer to the structure to set
+ *      new_scores      The new value for scores
+ *      array_size      Size of the scores array.
+ *
+ *  Returns:
+ *      BL_GFF3_STORE_DATA_OK if the new value is acceptable and assigned
+ *      BL_GFF3_STORE_DATA_OUT_OF_RANGE otherwise
+ *
+ *  Examples:
+ *      bl_gff3_store_t bl_gff3_store;
+ *      double *        new_scores;
+ *      size_t          array_size;
+ *
+ *      if ( bl_gff3_store_set_scores_cpy(&bl_gff3_store, new_scores, array_size)
+ *              == BL_GFF3_STORE_DATA_OK )
+ *      {
+ *      }
+ *
+ *  See also:
+ *      BL_GFF3_STORE_SET_SCORES(3)
+ *
+ *  History: 
+ *  Date        Name        Modification
+ *  2026-10-17  gen-get-set Auto-generated from gff3-store.h
+ ***************************************************************************/
+
+int     bl_gff3_store_set_scores_cpy(
+	    bl_gff3_store_t *bl_gff3_store_ptr,
+	    double *new_scores,
+	    size_t array_size
+	)
+
+{
+    if ( new_scores == NULL )
+	return BL_GFF3_STORE_DATA_OUT_OF_RANGE;
+    else
+    {
+	size_t  c;
+	
+	// FIXME: Assuming all elements should be copied
+	for (c = 0; c < array_size; ++c)
+	    bl_gff3_store_ptr->scores[c] = new_scores[c];
+	return BL_GFF3_STORE_DATA_OK;
+    }
+}
+
+
+/***************************************************************************
+ *  Library:
+ *      #include <biolibc/gff3-store.h>
+ *      -lbiolibc -lxtend
+ *
+ *  Description:
+ *      Mutator for strands member in a bl_gff3_store_t structure.
+ *      Use this function to set strands in a bl_gff3_store_t object
+ *      from non-member functions.  This function performs a direct
+ *      assignment for scalar or pointer structure members.  If
+ *      strands is a pointer, data previously pointed to should
+ *      be freed before calling this function to avoid memory
+ *      leaks.
+ *
+ *  Arguments:
+ *      bl_gff3_store_ptr Pointer to the structure to set
+ *      new_strands     The new value for strands
+ *
+ *  Returns:
+ *      BL_GFF3_STORE_DATA_OK if the new value is acceptable and assigned
+ *      BL_GFF3_STORE_DATA_OUT_OF_RANGE otherwise
+ *
+ *  Examples:
+ *      bl_gff3_store_t bl_gff3_store;
+ *      char *          new_strands;
+ *
+ *      if ( bl_gff3_store_set_strands(&bl_gff3_store, new_strands)
+ *              == BL_GFF3_STORE_DATA_OK )
+ *      {
+ *      }
+ *
+ *  See also:
+ *      (3)
+ *
+ *  History: 
+ *  Date        Name        Modification
+ *  2026-10-17  gen-get-set Auto-generated from gff3-store.h
+ ***************************************************************************/
+
+int     bl_gff3_store_set_strands(
+	    bl_gff3_store_t *bl_gff3_store_ptr,
+	    char *new_strands
+	)
+
+{
+    if ( new_strands == NULL )
+	return BL_GFF3_STORE_DATA_OUT_OF_RANGE;
+    else
+    {
+	bl_gff3_store_ptr->strands = new_strands;
+	return BL_GFF3_STORE_DATA_OK;
+    }
+}
+
+
+/***************************************************************************
+ *  Library:
+ *      #include <biolibc/gff3-store.h>
+ *      -lbiolibc -lxtend
+ *
+ *  Description:
+ *      Mutator for an array element of strands member in a bl_gff3_store_t
+ *      structure. Use this function to set bl_gff3_store_ptr->strands[c]
+ *      in a bl_gff3_store_t object from non-member functions.
+ *
+ *  Arguments:
+ *      bl_gff3_store_ptr Pointer to the structure to set
+ *      c               Subscript to the strands array
+ *      new_strands_element The new value for strands[c]
+ *
+ *  Returns:
+ *      BL_GFF3_STORE_DATA_OK if the new value is acceptable and assigned
+ *      BL_GFF3_STORE_DATA_OUT_OF_RANGE otherwise
+ *
+ *  Examples:
+ *      bl_gff3_store_t bl_gff3_store;
+ *      size_t          c;
+ *      char            new_strands_element;
+ *
+ *      if ( bl_gff3_store_set_strands_ae(&bl_gff3_store, c, new_strands_element)
+ *              == BL_GFF3_STORE_DATA_OK )
+ *      {
+ *      }
+ *
+ *  See also:
+ *      BL_GFF3_STORE_SET_STRANDS_AE(3)
+ *
+ *  History: 
+ *  Date        Name        Modification
+ *  2026-10-17  gen-get-set Auto-generated from gff3-store.h
+ ***************************************************************************/
+
+int     bl_gff3_store_set_strands_ae(
+	    bl_gff3_store_t *bl_gff3_store_ptr,
+	    size_t c,
+	    char new_strands_element
+	)
+
+{
+    if ( false )
+	return BL_GFF3_STORE_DATA_OUT_OF_RANGE;
+    else
+    {
+	bl_gff3_store_ptr->strands[c] = new_strands_element;
+	return BL_GFF3_STORE_DATA_OK;
+    }
+}
+
+
+/***************************************************************************
+ *  Library:
+ *      #include <biolibc/gff3-store.h>
+ *      -lbiolibc -lxtend
+ *
+ *  Description:
+ *      Mutator for strands member in a bl_gff3_store_t structure.
+ *      Use this function to set strands in a bl_gff3_store_t object
+ *      from non-member functions.  This function copies the array pointed to
+ *      by new_strands to bl_gff3_store_ptr->strands.
+ *
+ *  Arguments:
+ *      bl_gff3_store_ptr Pointer to the structure to set
+ *      new_strands     The new value for strands
+ *      array_size      Size of the strands array.
+ *
+ *  Returns:
+ *      BL_GFF3_STORE_DATA_OK if the new value is acceptable and assigned
+ *      BL_GFF3_STORE_DATA_OUT_OF_RANGE otherwise
+ *
+ *  Examples:
+ *      bl_gff3_store_t bl_gff3_store;
+ *      char *          new_strands;
+ *      size_t          array_size;
+ *
+ *      if ( bl_gff3_store_set_strands_cpy(&bl_gff3_store, new_strands, array_size)
+ *              == BL_GFF3_STORE_DATA_OK )
+ *      {
+ *      }
+ *
+ *  See also:
+ *      BL_GFF3_STORE_SET_STRANDS(3)
+ *
+ *  History: 
+ *  Date        Name        Modification
+ *  2026-10-17  gen-get-set Auto-generated from gff3-store.h
+ ***************************************************************************/
+
+int     bl_gff3_store_set_strands_cpy(
+	    bl_gff3_store_t *bl_gff3_store_ptr,
+	    char *new_strands,
+	    size_t array_size
+	)
+
+{
+    if ( new_strands == NULL )
+	return BL_GFF3_STORE_DATA_OUT_OF_RANGE;
+    else
+    {
+	size_t  c;
+	
+	// FIXME: Assuming all elements should be copied
+	for (c = 0; c < array_size; ++c)
+	    bl_gff3_store_ptr->strands[c] = new_strands[c];
+	return BL_GFF3_STORE_DATA_OK;
+    }
+}
+
+
+/***************************************************************************
+ *  Library:
+ *      #include <biolibc/gff3-store.h>
+ *      -lbiolibc -lxtend
+ *
+ *  Description:
+ *      Mutator for phases member in a bl_gff3_store_t structure.
+ *      Use this function to set phases in a bl_gff3_store_t object
+ *      from non-member functions.  This function performs a direct
+ *      assignment for scalar or pointer structure members.  If
+ *      phases is a pointer, data previously pointed to should
+ *      be freed before calling this function to avoid memory
+ *      leaks.
+ *
+ *  Arguments:
+ *      bl_gff3_store_ptr Pointer to the structure to set
+ *      new_phases      The new value for phases
+ *
+ *  Returns:
+ *      BL_GFF3_STORE_DATA_OK if the new value is acceptable and assigned
+ *      BL_GFF3_STORE_DATA_OUT_OF_RANGE otherwise
+ *
+ *  Examples:
+ *      bl_gff3_store_t bl_gff3_store;
+ *      char *          new_phases;
+ *
+ *      if ( bl_gff3_store_set_phases(&bl_gff3_store, new_phases)
+ *              == BL_GFF3_STORE_DATA_OK )
+ *      {
+ *      }
+ *
+ *  See also:
+ *      (3)
+ *
+ *  History: 
+ *  Date        Name        Modification
+ *  2026-10-17  gen-get-set Auto-generated from gff3-store.h
+ ***************************************************************************/
+
+int     bl_gff3_store_set_phases(
+	    bl_gff3_store_t *bl_gff3_store_ptr,
+	    char *new_phases
+	)
+
+{
+    if ( new_phases == NULL )
+	return BL_GFF3_STORE_DATA_OUT_OF_RANGE;
+    else
+    {
+	bl_gff3_store_ptr->phases = new_phases;
+	return BL_GFF3_STORE_DATA_OK;
+    }
+}
+
+
+/***************************************************************************
+ *  Library:
+ *      #include <biolibc/gff3-store.h>
+ *      -lbiolibc -lxtend
+ *
+ *  Description:
+ *      Mutator for an array element of phases member in a bl_gff3_store_t
+ *      structure. Use this function to set bl_gff3_store_ptr->phases[c]
+ *      in a bl_gff3_store_t object from non-member functions.
+ *
+ *  Arguments:
+ *      bl_gff3_store_ptr Pointer to the structure to set
+ *      c               Subscript to the phases array
+ *      new_phases_element The new value for phases[c]
+ *
+ *  Returns:
+ *      BL_GFF3_STORE_DATA_OK if the new value is acceptable and assigned
+ *      BL_GFF3_STORE_DATA_OUT_OF_RANGE otherwise
+ *
+ *  Examples:
+ *      bl_gff3_store_t bl_gff3_store;
+ *      size_t          c;
+ *      char            new_phases_element;
+ *
+ *      if ( bl_gff3_store_set_phases_ae(&bl_gff3_store, c, new_phases_element)
+ *              == BL_GFF3_STORE_DATA_OK )
+ *      {
+ *      }
+ *
+ *  See also:
+ *      BL_GFF3_STORE_SET_PHASES_AE(3)
+ *
+ *  History: 
+ *  Date        Name        Modification
+ *  2026-10-17  gen-get-set Auto-generated from gff3-store.h
+ ***************************************************************************/
+
+int     bl_gff3_store_set_phases_ae(
+	    bl_gff3_store_t *bl_gff3_store_ptr,
+	    size_t c,
+	    char new_phases_element
+	)
+
+{
+    if ( false )
+	return BL_GFF3_STORE_DATA_OUT_OF_RANGE;
+    else
+    {
+	bl_gff3_store_ptr->phases[c] = new_phases_element;
+	return BL_GFF3_STORE_DATA_OK;
+    }
+}
+
+
+/***************************************************************************
+ *  Library:
+ *      #include <biolibc/gff3-store.h>
+ *      -lbiolibc -lxtend
+ *
+ *  Description:
+ *      Mutator for phases member in a bl_gff3_store_t structure.
+ *      Use this function to set phases in a bl_gff3_store_t object
+ *      from non-member functions.  This function copies the array pointed to
+ *      by new_phases to bl_gff3_store_ptr->phases.
+ *
+ *  Arguments:
+ *      bl_gff3_store_ptr Pointer to the structure to set
+ *      new_phases      The new value for phases
+ *      array_size      Size of the phases array.
+ *
+ *  Returns:
+ *      BL_GFF3_STORE_DATA_OK if the new value is acceptable and assigned
+ *      BL_GFF3_STORE_DATA_OUT_OF_RANGE otherwise
+ *
+ *  Examples:
+ *      bl_gff3_store_t bl_gff3_store;
+ *      char *          new_phases;
+ *      size_t          array_size;
+ *
+ *      if ( bl_gff3_store_set_phases_cpy(&bl_gff3_store, new_phases, array_size)
+ *              == BL_GFF3_STORE_DATA_OK )
+ *      {
+ *      }
+ *
+ *  See also:
+ *      BL_GFF3_STORE_SET_PHASES(3)
+ *
+ *  History: 
+ *  Date        Name        Modification
+ *  2026-10-17  gen-get-set Auto-generated from gff3-store.h
+ ***************************************************************************/
+
+int     bl_gff3_store_set_phases_cpy(
+	    bl_gff3_store_t *bl_gff3_store_ptr,
+	    char *new_phases,
+	    size_t array_size
+	)
+
+{
+    if ( new_phases == NULL )
+	return BL_GFF3_STORE_DATA_OUT_OF_RANGE;
+    else
+    {
+	size_t  c;
+	
+	// FIXME: Assuming all elements should be copied
+	for (c = 0; c < array_size; ++c)
+	    bl_gff3_store_ptr->phases[c] = new_phases[c];
+	return BL_GFF3_STORE_DATA_OK;
+    }
+}
+
+
+/***************************************************************************
+ *  Library:
+ *      #include <biolibc/gff3-store.h>
+ *      -lbiolibc -lxtend
+ *
+ *  Description:
+ *      Mutator for file_pos member in a bl_gff3_store_t structure.
+ *      Use this function to set file_pos in a bl_gff3_store_t object
+ *      from non-member functions.  This function performs a direct
+ *      assignment for scalar or pointer structure members.  If
+ *      file_pos is a pointer, data previously pointed to should
+ *      be freed before calling this function to avoid memory
+ *      leaks.
+ *
+ *  Arguments:
+ *      bl_gff3_store_ptr Pointer to the structure to set
+ *      new_file_pos    The new value for file_pos
+ *
+ *  Returns:
+ *      BL_GFF3_STORE_DATA_OK if the new value is acceptable and assigned
+ *      BL_GFF3_STORE_DATA_OUT_OF_RANGE otherwise
+ *
+ *  Examples:
+ *      bl_gff3_store_t bl_gff3_store;
+ *      long *          new_file_pos;
+ *
+ *      if ( bl_gff3_store_set_file_pos(&bl_gff3_store, new_file_pos)
+ *              == BL_GFF3_STORE_DATA_OK )
+ *      {
+ *      }
+ *
+ *  See also:
+ *      (3)
+ *
+ *  History: 
+ *  Date        Name        Modification
+ *  2026-10-17  gen-get-set Auto-generated from gff3-store.h
+ ***************************************************************************/
+
+int     bl_gff3_store_set_file_pos(
+	    bl_gff3_store_t *bl_gff3_store_ptr,
+	    long *new_file_pos
+	)
+
+{
+    if ( new_file_pos == NULL )
+	return BL_GFF3_STORE_DATA_OUT_OF_RANGE;
+    else
+    {
+	bl_gff3_store_ptr->file_pos = new_file_pos;
+	return BL_GFF3_STORE_DATA_OK;
+    }
+}
+
+
+/***************************************************************************
+ *  Library:
+ *      #include <biolibc/gff3-store.h>
+ *      -lbiolibc -lxtend
+ *
+ *  Description:
+ *      Mutator for an array element of file_pos member in a bl_gff3_store_t
+ *      structure. Use this function to set bl_gff3_store_ptr->file_pos[c]
+ *      in a bl_gff3_store_t object from non-member functions.
+ *
+ *  Arguments:
+ *      bl_gff3_store_ptr Pointer to the structure to set
+ *      c               Subscript to the file_pos array
+ *      new_file_pos_element The new value for file_pos[c]
+ *
+ *  Returns:
+ *      BL_GFF3_STORE_DATA_OK if the new value is acceptable and assigned
+ *      BL_GFF3_STORE_DATA_OUT_OF_RANGE otherwise
+ *
+ *  Examples:
+ *      bl_gff3_store_t bl_gff3_store;
+ *      size_t          c;
+ *      long            new_file_pos_element;
+ *
+ *      if ( bl_gff3_store_set_file_pos_ae(&bl_gff3_store, c, new_file_pos_element)
+ *              == BL_GFF3_STORE_DATA_OK )
+ *      {
+ *      }
+ *
+ *  See also:
+ *      BL_GFF3_STORE_SET_FILE_POS_AE(3)
+ *
+ *  History: 
+ *  Date        Name        Modification
+ *  2026-10-17  gen-get-set Auto-generated from gff3-store.h
+ ***************************************************************************/
+
+int     bl_gff3_store_set_file_pos_ae(
+	    bl_gff3_store_t *bl_gff3_store_ptr,
+	    size_t c,
+	    long new_file_pos_element
+	)
+
+{
+    if ( false )
+	return BL_GFF3_STORE_DATA_OUT_OF_RANGE;
+    else
+    {
+	bl_gff3_store_ptr->file_pos[c] = new_file_pos_element;
+	return BL_GFF3_STORE_DATA_OK;
+    }
+}
+
+
+/***************************************************************************
+ *  Library:
+ *      #include <biolibc/gff3-store.h>
+ *      -lbiolibc -lxtend
+ *
+ *  Description:
+ *      Mutator for file_pos member in a bl_gff3_store_t structure.
+ *      Use this function to set file_pos in a bl_gff3_store_t object
+ *      from non-member functions.  This function copies the array pointed to
+ *      by new_file_pos to bl_gff3_store_ptr->file_pos.
+ *
+ *  Arguments:
+ *      bl_gff3_store_ptr Pointer to the structure to set
+ *      new_file_pos    The new value for file_pos
+ *      array_size      Size of the file_pos array.
+ *
+ *  Returns:
+ *      BL_GFF3_STORE_DATA_OK if the new value is acceptable and assigned
+ *      BL_GFF3_STORE_DATA_OUT_OF_RANGE otherwise
+ *
+ *  Examples:
+ *      bl_gff3_store_t bl_gff3_store;
+ *      long *          new_file_pos;
+ *      size_t          array_size;
+ *
+ *      if ( bl_gff3_store_set_file_pos_cpy(&bl_gff3_store, new_file_pos, array_size)
+ *              == BL_GFF3_STORE_DATA_OK )
+ *      {
+ *      }
+ *
+ *  See also:
+ *      BL_GFF3_STORE_SET_FILE_POS(3)
+ *
+ *  History: 
+ *  Date        Name        Modification
+ *  2026-10-17  gen-get-set Auto-generated from gff3-store.h
+ ***************************************************************************/
+
+int     bl_gff3_store_set_file_pos_cpy(
+	    bl_gff3_store_t *bl_gff3_store_ptr,
+	    long *new_file_pos,
+	    size_t array_size
+	)
+
+{
+    if ( new_file_pos == NULL )
+	return BL_GFF3_STORE_DATA_OUT_OF_RANGE;
+    else
+    {
+	size_t  c;
+	
+	// FIXME: Assuming all elements should be copied
+	for (c = 0; c < array_size; ++c)
+	    bl_gff3_store_ptr->file_pos[c] = new_file_pos[c];
+	return BL_GFF3_STORE_DATA_OK;
+    }
+}
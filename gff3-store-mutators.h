@@ -0,0 +1,44 @@
+
+/*
+ *  Generated by /usr/local/bin/auto-gen-get-set
+ *
+ *  Mutator functions for setting with no sanity checking.  Use these to
+ *  set structure members from functions outside the bl_gff3_store_t
+ *  class.  These macros perform no data validation.  Hence, they achieve
+ *  maximum performance where data are guaranteed correct by other means.
+ *  Use the mutator functions (same name as the macro, but lower case)
+ *  for more robust code with a small performance penalty.
+ *
+ *  These generated macros are not expected to be perfect.  Check and edit
+ *  as needed before adding to your code.
+ */
+
+/* temp-gff3-store-mutators.c */
+int bl_gff3_store_set_count(bl_gff3_store_t *bl_gff3_store_ptr, size_t new_count);
+int bl_gff3_store_set_starts(bl_gff3_store_t *bl_gff3_store_ptr, int64_t *new_starts);
+int bl_gff3_store_set_starts_ae(bl_gff3_store_t *bl_gff3_store_ptr, size_t c, int64_t new_starts_element);
+int bl_gff3_store_set_starts_cpy(bl_gff3_store_t *bl_gff3_store_ptr, int64_t *new_starts, size_t array_size);
+int bl_gff3_store_set_ends(bl_gff3_store_t *bl_gff3_store_ptr, int64_t *new_ends);
+int bl_gff3_store_set_ends_ae(bl_gff3_store_t *bl_gff3_store_ptr, size_t c, int64_t new_ends_element);
+int bl_gff3_store_set_ends_cpy(bl_gff3_store_t *bl_gff3_store_ptr, int64_t *new_ends, size_t array_size);
+int bl_gff3_store_set_seqid_ids(bl_gff3_store_t *bl_gff3_store_ptr, int32_t *new_seqid_ids);
+int bl_gff3_store_set_seqid_ids_ae(bl_gff3_store_t *bl_gff3_store_ptr, size_t c, int32_t new_seqid_ids_element);
+int bl_gff3_store_set_seqid_ids_cpy(bl_gff3_store_t *bl_gff3_store_ptr, int32_t *new_seqid_ids, size_t array_size);
+int bl_gff3_store_set_source_ids(bl_gff3_store_t *bl_gff3_store_ptr, int32_t *new_source_ids);
+int bl_gff3_store_set_source_ids_ae(bl_gff3_store_t *bl_gff3_store_ptr, size_t c, int32_t new_source_ids_element);
+int bl_gff3_store_set_source_ids_cpy(bl_gff3_store_t *bl_gff3_store_ptr, int32_t *new_source_ids, size_t array_size);
+int bl_gff3_store_set_type_ids(bl_gff3_store_t *bl_gff3_store_ptr, int32_t *new_type_ids);
+int bl_gff3_store_set_type_ids_ae(bl_gff3_store_t *bl_gff3_store_ptr, size_t c, int32_t new_type_ids_element);
+int bl_gff3_store_set_type_ids_cpy(bl_gff3_store_t *bl_gff3_store_ptr, int32_t *new_type_ids, size_t array_size);
+int bl_gff3_store_set_scores(bl_gff3_store_t *bl_gff3_store_ptr, double *new_scores);
+int bl_gff3_store_set_scores_ae(bl_gff3_store_t *bl_gff3_store_ptr, size_t c, double new_scores_element);
+int bl_gff3_store_set_scores_cpy(bl_gff3_store_t *bl_gff3_store_ptr, double *new_scores, size_t array_size);
+int bl_gff3_store_set_strands(bl_gff3_store_t *bl_gff3_store_ptr, char *new_strands);
+int bl_gff3_store_set_strands_ae(bl_gff3_store_t *bl_gff3_store_ptr, size_t c, char new_strands_element);
+int bl_gff3_store_set_strands_cpy(bl_gff3_store_t *bl_gff3_store_ptr, char *new_strands, size_t array_size);
+int bl_gff3_store_set_phases(bl_gff3_store_t *bl_gff3_store_ptr, char *new_phases);
+int bl_gff3_store_set_phases_ae(bl_gff3_store_t *bl_gff3_store_ptr, size_t c, char new_phases_element);
+int bl_gff3_store_set_phases_cpy(bl_gff3_store_t *bl_gff3_store_ptr, char *new_phases, size_t array_size);
+int bl_gff3_store_set_file_pos(bl_gff3_store_t *bl_gff3_store_ptr, long *new_file_pos);
+int bl_gff3_store_set_file_pos_ae(bl_gff3_store_t *bl_gff3_store_ptr, size_t c, long new_file_pos_element);
+int bl_gff3_store_set_file_pos_cpy(bl_gff3_store_t *bl_gff3_store_ptr, long *new_file_pos, size_t array_size);
@@ -0,0 +1,413 @@
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <inttypes.h>
+#include <xtend/mem.h>
+#include "gff3-store.h"
+
+/***************************************************************************
+ *  Name:
+ *      bl_gff3_store_init() - Initialize a compact GFF3 feature store
+ *
+ *  Library:
+ *      #include <biolibc/gff3-store.h>
+ *      -lbiolibc -lxtend
+ *
+ *  Description:
+ *      Initialize an empty bl_gff3_store_t object.  This is equivalent
+ *      to assigning BL_GFF3_STORE_INIT.
+ *
+ *  Arguments:
+ *      store   Pointer to the bl_gff3_store_t object to initialize
+ *
+ *  See also:
+ *      bl_gff3_store_free(3), bl_gff3_store_load(3)
+ *
+ *  History:
+ *  Date        Name        Modification
+ *  2026-10-17  agent       Begin
+ ***************************************************************************/
+
+void    bl_gff3_store_init(bl_gff3_store_t *store)
+
+{
+    store->count = 0;
+    store->array_size = 0;
+    store->starts = NULL;
+    store->ends = NULL;
+    store->seqid_ids = NULL;
+    store->source_ids = NULL;
+    store->type_ids = NULL;
+    store->scores = NULL;
+    store->strands = NULL;
+    store->phases = NULL;
+    store->file_pos = NULL;
+    store->attribute_offsets = NULL;
+    bl_chrom_dict_init(&store->seqids);
+    bl_chrom_dict_init(&store->sources);
+    bl_chrom_dict_init(&store->types);
+    store->arena = NULL;
+    store->arena_len = 0;
+    store->arena_size = 0;
+}
+
+
+/***************************************************************************
+ *  Name:
+ *      bl_gff3_store_free() - Free memory held by a GFF3 feature store
+ *
+ *  Library:
+ *      #include <biolibc/gff3-store.h>
+ *      -lbiolibc -lxtend
+ *
+ *  Description:
+ *      Free all memory held by a bl_gff3_store_t object and leave it
+ *      empty, ready for reuse.
+ *
+ *  Arguments:
+ *      store   Pointer to the bl_gff3_store_t object
+ *
+ *  See also:
+ *      bl_gff3_store_init(3)
+ *
+ *  History:
+ *  Date        Name        Modification
+ *  2026-10-17  agent       Begin
+ ***************************************************************************/
+
+void    bl_gff3_store_free(bl_gff3_store_t *store)
+
+{
+    free(store->starts);
+    free(store->ends);
+    free(store->seqid_ids);
+    free(store->source_ids);
+    free(store->type_ids);
+    free(store->scores);
+    free(store->strands);
+    free(store->phases);
+    free(store->file_pos);
+    free(store->attribute_offsets);
+    bl_chrom_dict_free(&store->seqids);
+    bl_chrom_dict_free(&store->sources);
+    bl_chrom_dict_free(&store->types);
+    free(store->arena);
+    bl_gff3_store_init(store);
+}
+
+
+/***************************************************************************
+ *  Name:
+ *      bl_gff3_store_intern() - Get the ID of a GFF3 store string
+ *
+ *  Library:
+ *      #include <biolibc/gff3-store.h>
+ *      -lbiolibc -lxtend
+ *
+ *  Description:
+ *      Return the ID of name in dict, adding it if necessary.  Sorted
+ *      input nearly always repeats the previous feature's seqid, source,
+ *      and type, so previous_id is checked with a single strcmp(3) before
+ *      the dictionary is searched.  Unlike bl_chrom_dict_intern(3),
+ *      "." is interned like any other name, as it is a common source.
+ *
+ *      This is used by bl_gff3_store_add(3) and is rarely needed by
+ *      applications.
+ *
+ *  Arguments:
+ *      dict        Pointer to a bl_chrom_dict_t object
+ *      previous_id ID of the same field in the previous feature
+ *      name        String to intern
+ *
+ *  Returns:
+ *      The ID of name (>= 0), or BL_CHROM_DICT_MALLOC_FAILED
+ *
+ *  See also:
+ *      bl_gff3_store_add(3), bl_chrom_dict_add(3)
+ *
+ *  History:
+ *  Date        Name        Modification
+ *  2026-10-17  agent       Begin
+ ***************************************************************************/
+
+int32_t bl_gff3_store_intern(bl_chrom_dict_t *dict, int32_t previous_id,
+			     const char *name)
+
+{
+    if ( (previous_id >= 0) &&
+	 (strcmp(BL_CHROM_DICT_NAMES_AE(dict, previous_id), name) == 0) )
+	return previous_id;
+    return bl_chrom_dict_add(dict, name, 0);
+}
+
+
+/***************************************************************************
+ *  Name:
+ *      bl_gff3_store_add() - Add a GFF3 feature to a compact store
+ *
+ *  Library:
+ *      #include <biolibc/gff3-store.h>
+ *      -lbiolibc -lxtend
+ *
+ *  Description:
+ *      Append the fields of feature to store.  Seqid, source, and type
+ *      are interned, and ATTRIBUTES is copied into the store's arena.
+ *      feature may be reused for the next bl_gff3_read(3) afterward.
+ *
+ *      Arrays and the arena may be moved by this function, so pointers
+ *      obtained from the store before adding are invalidated.  Indexes
+ *      remain valid.
+ *
+ *  Arguments:
+ *      store   Pointer to a bl_gff3_store_t object
+ *      feature Pointer to a feature read by bl_gff3_read(3)
+ *
+ *  Returns:
+ *      BL_GFF3_STORE_OK on success, BL_GFF3_STORE_MALLOC_FAILED otherwise
+ *
+ *  See also:
+ *      bl_gff3_store_load(3)
+ *
+ *  History:
+ *  Date        Name        Modification
+ *  2026-10-17  agent       Begin
+ ***************************************************************************/
+
+int     bl_gff3_store_add(bl_gff3_store_t *store, bl_gff3_t *feature)
+
+{
+    size_t  c = store->count,
+	    len;
+    int32_t previous_seqid = BL_CHROM_ID_NONE,
+	    previous_source = BL_CHROM_ID_NONE,
+	    previous_type = BL_CHROM_ID_NONE;
+    const char  *attributes;
+
+    if ( store->count == store->array_size )
+    {
+	store->array_size = store->array_size == 0 ?
+	    BL_GFF3_STORE_START_SIZE : store->array_size * 2;
+	store->starts = xt_realloc(store->starts, store->array_size,
+				   sizeof(*store->starts));
+	store->ends = xt_realloc(store->ends, store->array_size,
+				 sizeof(*store->ends));
+	store->seqid_ids = xt_realloc(store->seqid_ids, store->array_size,
+				      sizeof(*store->seqid_ids));
+	store->source_ids = xt_realloc(store->source_ids, store->array_size,
+				       sizeof(*store->source_ids));
+	store->type_ids = xt_realloc(store->type_ids, store->array_size,
+				     sizeof(*store->type_ids));
+	store->scores = xt_realloc(store->scores, store->array_size,
+				   sizeof(*store->scores));
+	store->strands = xt_realloc(store->strands, store->array_size,
+				    sizeof(*store->strands));
+	store->phases = xt_realloc(store->phases, store->array_size,
+				   sizeof(*store->phases));
+	store->file_pos = xt_realloc(store->file_pos, store->array_size,
+				     sizeof(*store->file_pos));
+	store->attribute_offsets = xt_realloc(store->attribute_offsets,
+					      store->array_size,
+					      sizeof(*store->attribute_offsets));
+	if ( (store->starts == NULL) || (store->ends == NULL) ||
+	     (store->seqid_ids == NULL) || (store->source_ids == NULL) ||
+	     (store->type_ids == NULL) || (store->scores == NULL) ||
+	     (store->strands == NULL) || (store->phases == NULL) ||
+	     (store->file_pos == NULL) || (store->attribute_offsets == NULL) )
+	    return BL_GFF3_STORE_MALLOC_FAILED;
+    }
+
+    attributes = BL_GFF3_ATTRIBUTES(feature) == NULL ? "" :
+		 BL_GFF3_ATTRIBUTES(feature);
+    len = strlen(attributes) + 1;
+    while ( store->arena_len + len > store->arena_size )
+    {
+	store->arena_size = store->arena_size == 0 ?
+	    BL_GFF3_STORE_ARENA_START_SIZE : store->arena_size * 2;
+	if ( (store->arena = xt_realloc(store->arena, store->arena_size,
+					sizeof(*store->arena))) == NULL )
+	    return BL_GFF3_STORE_MALLOC_FAILED;
+    }
+
+    if ( c > 0 )
+    {
+	previous_seqid = store->seqid_ids[c - 1];
+	previous_source = store->source_ids[c - 1];
+	previous_type = store->type_ids[c - 1];
+    }
+    if ( ((store->seqid_ids[c] = bl_gff3_store_intern(&store->seqids,
+		previous_seqid, BL_GFF3_SEQID(feature))) < 0) ||
+	 ((store->source_ids[c] = bl_gff3_store_intern(&store->sources,
+		previous_source, BL_GFF3_SOURCE(feature))) < 0) ||
+	 ((store->type_ids[c] = bl_gff3_store_intern(&store->types,
+		previous_type, BL_GFF3_TYPE(feature))) < 0) )
+	return BL_GFF3_STORE_MALLOC_FAILED;
+
+    store->starts[c] = BL_GFF3_START(feature);
+    store->ends[c] = BL_GFF3_END(feature);
+    store->scores[c] = BL_GFF3_SCORE(feature);
+    store->strands[c] = BL_GFF3_STRAND(feature);
+    store->phases[c] = BL_GFF3_PHASE(feature);
+    store->file_pos[c] = BL_GFF3_FILE_POS(feature);
+    store->attribute_offsets[c] = store->arena_len;
+    memcpy(store->arena + store->arena_len, attributes, len);
+    store->arena_len += len;
+    ++store->count;
+    return BL_GFF3_STORE_OK;
+}
+
+
+/***************************************************************************
+ *  Name:
+ *      bl_gff3_store_load() - Load all features of a GFF3 stream
+ *
+ *  Library:
+ *      #include <biolibc/gff3-store.h>
+ *      -lbiolibc -lxtend
+ *
+ *  Description:
+ *      Read all features from gff3_stream, which must be positioned
+ *      after the header, e.g. by bl_gff3_skip_header(3), and append them
+ *      to store with bl_gff3_store_add(3).  Group terminators ("###")
+ *      are skipped.  A single bl_gff3_t is reused for reading, so memory
+ *      use is that of the compact store alone.
+ *
+ *  Arguments:
+ *      store       Pointer to a bl_gff3_store_t object
+ *      gff3_stream FILE stream positioned at the first feature
+ *
+ *  Returns:
+ *      BL_GFF3_STORE_OK on success, BL_GFF3_STORE_MALLOC_FAILED otherwise
+ *
+ *  Examples:
+ *      bl_gff3_store_t store = BL_GFF3_STORE_INIT;
+ *      size_t          c;
+ *
+ *      fclose(bl_gff3_skip_header(stream));
+ *      if ( bl_gff3_store_load(&store, stream) == BL_GFF3_STORE_OK )
+ *      {
+ *          for (c = 0; c < BL_GFF3_STORE_COUNT(&store); ++c)
+ *              if ( strcmp(BL_GFF3_STORE_TYPE(&store, c), "gene") == 0 )
+ *                  printf("%s\t%" PRId64 "\n", BL_GFF3_STORE_SEQID(&store, c),
+ *                         BL_GFF3_STORE_STARTS_AE(&store, c));
+ *      }
+ *      bl_gff3_store_free(&store);
+ *
+ *  See also:
+ *      bl_gff3_store_add(3), bl_gff3_store_write(3),
+ *      bl_gff3_store_find_attribute(3)
+ *
+ *  History:
+ *  Date        Name        Modification
+ *  2026-10-17  agent       Begin
+ ***************************************************************************/
+
+int     bl_gff3_store_load(bl_gff3_store_t *store, FILE *gff3_stream)
+
+{
+    bl_gff3_t   feature;
+    int         status = BL_GFF3_STORE_OK;
+
+    bl_gff3_init(&feature);
+    while ( (status == BL_GFF3_STORE_OK) &&
+	    (bl_gff3_read(&feature, gff3_stream,
+		BL_GFF3_FIELD_ALL & ~BL_GFF3_FIELD_ATTRIBUTE_TABLE)
+		== BL_READ_OK) )
+	if ( strcmp(BL_GFF3_TYPE(&feature), "###") != 0 )
+	    status = bl_gff3_store_add(store, &feature);
+    bl_gff3_free(&feature);
+    return status;
+}
+
+
+/***************************************************************************
+ *  Name:
+ *      bl_gff3_store_find_attribute() - Find attribute of a stored feature
+ *
+ *  Library:
+ *      #include <biolibc/gff3-store.h>
+ *      -lbiolibc -lxtend
+ *
+ *  Description:
+ *      Find the value of attribute attr_name of feature c in store,
+ *      returning a pointer into the store's arena and the value's length,
+ *      as bl_gff3_find_attribute(3) does for a bl_gff3_t.  The value is
+ *      not NUL-terminated and nothing is copied or modified.
+ *
+ *  Arguments:
+ *      store       Pointer to a bl_gff3_store_t object
+ *      c           Index of the feature
+ *      attr_name   Attribute name, such as "ID" or "Parent"
+ *      value_len   Address of a size_t to receive the value length
+ *
+ *  Returns:
+ *      Pointer to the first character of the value, or NULL if attr_name
+ *      is not found
+ *
+ *  Examples:
+ *      const char  *name;
+ *      size_t      len;
+ *
+ *      if ( (name = bl_gff3_store_find_attribute(&store, c, "Name", &len))
+ *              != NULL )
+ *          printf("%.*s\n", (int)len, name);
+ *
+ *  See also:
+ *      bl_gff3_attributes_find(3), bl_gff3_find_attribute(3)
+ *
+ *  History:
+ *  Date        Name        Modification
+ *  2026-10-17  agent       Begin
+ ***************************************************************************/
+
+const char  *bl_gff3_store_find_attribute(bl_gff3_store_t *store, size_t c,
+					  const char *attr_name,
+					  size_t *value_len)
+
+{
+    return bl_gff3_attributes_find(BL_GFF3_STORE_ATTRIBUTES(store, c),
+				   attr_name, value_len);
+}
+
+
+/***************************************************************************
+ *  Name:
+ *      bl_gff3_store_write() - Write a stored GFF3 feature
+ *
+ *  Library:
+ *      #include <biolibc/gff3-store.h>
+ *      -lbiolibc -lxtend
+ *
+ *  Description:
+ *      Write feature c of store to gff3_stream as a GFF3 line, in the
+ *      same format as bl_gff3_write(3), directly from the store without
+ *      constructing a bl_gff3_t.
+ *
+ *  Arguments:
+ *      store       Pointer to a bl_gff3_store_t object
+ *      c           Index of the feature
+ *      gff3_stream FILE stream to which the line is written
+ *
+ *  Returns:
+ *      BL_WRITE_OK on success, BL_WRITE_FAILURE on error
+ *
+ *  See also:
+ *      bl_gff3_write(3), bl_gff3_store_load(3)
+ *
+ *  History:
+ *  Date        Name        Modification
+ *  2026-10-17  agent       Begin
+ ***************************************************************************/
+
+int     bl_gff3_store_write(bl_gff3_store_t *store, size_t c,
+			    FILE *gff3_stream)
+
+{
+    if ( fprintf(gff3_stream,
+	    "%s\t%s\t%s\t%" PRId64 "\t%" PRId64 "\t%f\t%c\t%c\t%s\n",
+	    BL_GFF3_STORE_SEQID(store, c), BL_GFF3_STORE_SOURCE(store, c),
+	    BL_GFF3_STORE_TYPE(store, c), store->starts[c], store->ends[c],
+	    store->scores[c], store->strands[c], store->phases[c],
+	    BL_GFF3_STORE_ATTRIBUTES(store, c)) < 0 )
+	return BL_WRITE_FAILURE;
+    return BL_WRITE_OK;
+}
@@ -0,0 +1,96 @@
+#ifndef _BIOLIBC_GFF3_STORE_H_
+#define _BIOLIBC_GFF3_STORE_H_
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+#ifndef _STDIO_H_
+#include <stdio.h>
+#endif
+
+#ifndef _BIOLIBC_GFF3_H_
+#include "gff3.h"
+#endif
+
+#ifndef _BIOLIBC_CHROM_DICT_H_
+#include "chrom-dict.h"
+#endif
+
+/*
+ *  Compact in-memory set of GFF3 features.  A bl_gff3_t carries fixed
+ *  seqid, source, and type buffers of well over 1 KiB, so holding
+ *  millions of them is impractical.  Here each column is a separate
+ *  array (struct of arrays), seqid, source, and type are interned in
+ *  dictionaries and stored as small IDs, and all ATTRIBUTES strings are
+ *  packed NUL-terminated into one arena.  A feature costs about 60
+ *  bytes plus its attributes, and scanning one column touches only that
+ *  column's memory.  Features are read in place by index, with no
+ *  copying.
+ */
+
+#define BL_GFF3_STORE_START_SIZE        1024
+#define BL_GFF3_STORE_ARENA_START_SIZE  65536
+
+#define BL_GFF3_STORE_OK                0
+#define BL_GFF3_STORE_MALLOC_FAILED     -1
+
+typedef struct
+{
+    size_t          count,
+		    array_size;
+    int64_t         *starts,
+		    *ends;
+    int32_t         *seqid_ids,
+		    *source_ids,
+		    *type_ids;
+    double          *scores;
+    char            *strands,
+		    *phases;
+    long            *file_pos;      // Return type of ftell()
+    size_t          *attribute_offsets; // Into arena
+
+    bl_chrom_dict_t seqids,
+		    sources,
+		    types;
+
+    // NUL-terminated attributes of all features
+    char            *arena;
+    size_t          arena_len,
+		    arena_size;
+}   bl_gff3_store_t;
+
+#define BL_GFF3_STORE_INIT \
+	{ 0, 0, NULL, NULL, NULL, NULL, NULL, NULL, NULL, NULL, NULL, \
+	  NULL, BL_CHROM_DICT_INIT, BL_CHROM_DICT_INIT, BL_CHROM_DICT_INIT, \
+	  NULL, 0, 0 }
+
+// Fields of feature c.  Pointers into the store are invalidated by
+// bl_gff3_store_add().
+#define BL_GFF3_STORE_SEQID(ptr,c) \
+	(BL_CHROM_DICT_NAMES_AE(&(ptr)->seqids, (ptr)->seqid_ids[c]))
+#define BL_GFF3_STORE_SOURCE(ptr,c) \
+	(BL_CHROM_DICT_NAMES_AE(&(ptr)->sources, (ptr)->source_ids[c]))
+#define BL_GFF3_STORE_TYPE(ptr,c) \
+	(BL_CHROM_DICT_NAMES_AE(&(ptr)->types, (ptr)->type_ids[c]))
+#define BL_GFF3_STORE_ATTRIBUTES(ptr,c) \
+	((ptr)->arena + (ptr)->attribute_offsets[c])
+
+#include "gff3-store-rvs.h"
+#include "gff3-store-accessors.h"
+#include "gff3-store-mutators.h"
+
+/* gff3-store.c */
+void bl_gff3_store_init(bl_gff3_store_t *store);
+void bl_gff3_store_free(bl_gff3_store_t *store);
+int32_t bl_gff3_store_intern(bl_chrom_dict_t *dict, int32_t previous_id, const char *name);
+int bl_gff3_store_add(bl_gff3_store_t *store, bl_gff3_t *feature);
+int bl_gff3_store_load(bl_gff3_store_t *store, FILE *gff3_stream);
+const char *bl_gff3_store_find_attribute(bl_gff3_store_t *store, size_t c, const char *attr_name, size_t *value_len);
+int bl_gff3_store_write(bl_gff3_store_t *store, size_t c, FILE *gff3_stream);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif // _BIOLIBC_GFF3_STORE_H_
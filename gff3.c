@@ -130,8 +130,9 @@ int     bl_gff3_copy_header(FILE *header_stream, FILE *gff3_stream)
  *      after the data are no longer needed.
  *
  *      If passed an object that is not in an initialized state,
- *      bl_gff3_read() will free and initialize it before repopulating it
- *      with a new feature.
+ *      bl_gff3_read() will reuse its attributes buffer and attribute
+ *      table, and free the ID, name, and parent strings before
+ *      repopulating it with a new feature.
  *
  *      If field_mask is not BL_GFF3_FIELD_ALL, fields not indicated by a 1
  *      in the bit mask are discarded rather than stored in feature.
@@ -148,6 +149,17 @@ int     bl_gff3_copy_header(FILE *header_stream, FILE *gff3_stream)
  *      BL_GFF3_FIELD_STRAND
  *      BL_GFF3_FIELD_PHASE
  *      BL_GFF3_FIELD_ATTRIBUTES
+ *      BL_GFF3_FIELD_ATTRIBUTE_TABLE
+ *
+ *      If BL_GFF3_FIELD_ATTRIBUTE_TABLE is set, as it is in
+ *      BL_GFF3_FIELD_ALL, the tag=value pairs in ATTRIBUTES are located
+ *      in one pass by bl_gff3_index_attributes(3), so that later lookups
+ *      with bl_gff3_find_attribute(3), including those for ID, Name, and
+ *      Parent here, do not rescan the string.
+ *
+ *      If feature has a chromosome dictionary set with
+ *      bl_gff3_set_chrom_dict(3), SEQID is interned and its ID stored
+ *      in seqid_id.
  *
  *  Arguments:
  *      feature         Pointer to a bl_gff3_t structure
@@ -168,11 +180,14 @@ int     bl_gff3_copy_header(FILE *header_stream, FILE *gff3_stream)
  *          BL_GFF3_FIELD_SEQID|BL_GFF3_FIELD_START|BL_GFF3_FIELD_END);
  *
  *  See also:
- *      bl_gff3_write(3)
+ *      bl_gff3_write(3), bl_gff3_set_chrom_dict(3),
+ *      bl_gff3_find_attribute(3)
  *
  *  History: 
  *  Date        Name        Modification
  *  2021-04-05  Jason Bacon Begin
+ *  2026-10-17  agent       Set seqid_id from chrom_dict
+ *  2026-10-17  agent       Build attribute table, reuse buffers
  ***************************************************************************/
 
 int     bl_gff3_read(bl_gff3_t *feature, FILE *gff3_stream,
@@ -186,14 +201,24 @@ int     bl_gff3_read(bl_gff3_t *feature, FILE *gff3_stream,
 	    start_str[BL_POSITION_MAX_DIGITS + 1],
 	    end_str[BL_POSITION_MAX_DIGITS + 1],
 	    score_str[BL_GFF3_SCORE_MAX_DIGITS + 1];
+    const char  *value;
     size_t  len;
     int     delim,
 	    ch;
     
-    // Use this as a model for other _read() functions?
-    // Makes reusing a structure easy without risk of memory leaks
+    // Makes reusing a structure easy without risk of memory leaks.
+    // The attributes buffer and table are kept to avoid reallocating
+    // them for every feature.
+    free(feature->feature_id);
+    free(feature->feature_name);
+    free(feature->feature_parent);
+    feature->feature_id = feature->feature_name =
+	feature->feature_parent = NULL;
+    feature->attribute_count = 0;
+    feature->attributes_indexed = false;
     if ( feature->attributes != NULL )
-	bl_gff3_free(feature);
+	*feature->attributes = '\0';
+    feature->attributes_len = 0;
     
     // Check for group terminators (Line with just ###)
     // FIXME: Rely on parent ID instead of ###?
@@ -219,6 +244,8 @@ int     bl_gff3_read(bl_gff3_t *feature, FILE *gff3_stream,
     if ( xt_tsv_read_field(gff3_stream, feature->seqid,
 			BL_CHROM_MAX_CHARS, &len) == EOF )
 	return BL_READ_EOF;
+    feature->seqid_id = bl_chrom_dict_intern(feature->chrom_dict,
+					     feature->seqid_id, feature->seqid);
     
     // 2 Source
     if ( xt_tsv_read_field(gff3_stream, feature->source,
@@ -332,24 +359,24 @@ int     bl_gff3_read(bl_gff3_t *feature, FILE *gff3_stream,
     if ( delim != '\n' )
 	xt_dsv_skip_rest_of_line(gff3_stream);
 
+    if ( field_mask & BL_GFF3_FIELD_ATTRIBUTE_TABLE )
+	bl_gff3_index_attributes(feature);
+    
     // Extract feature ID from attributes
-    feature->feature_id = bl_gff3_extract_attribute(feature, "ID");
+    if ( (value = bl_gff3_find_attribute(feature, "ID", &len)) != NULL )
+	feature->feature_id = bl_gff3_attribute_dup(value, len);
 
     // Extract feature name from attributes
-    feature->feature_name = bl_gff3_extract_attribute(feature, "Name");
-    if ( feature->feature_name == NULL )
-    {
-	if ( (feature->feature_name = strdup("unnamed")) == NULL )
-	    fprintf(stderr, "bl_gff3_read(): Could not strdup() feature_name.\n");
-    }
+    if ( (value = bl_gff3_find_attribute(feature, "Name", &len)) != NULL )
+	feature->feature_name = bl_gff3_attribute_dup(value, len);
+    else if ( (feature->feature_name = strdup("unnamed")) == NULL )
+	fprintf(stderr, "bl_gff3_read(): Could not strdup() feature_name.\n");
 
     // Extract feature parent from attributes
-    feature->feature_parent = bl_gff3_extract_attribute(feature, "Parent");
-    if ( feature->feature_parent == NULL )
-    {
-	if ( (feature->feature_parent = strdup("noparent")) == NULL )
-	    fprintf(stderr, "bl_gff3_read(): Could not strdup() feature_parent.\n");
-    }
+    if ( (value = bl_gff3_find_attribute(feature, "Parent", &len)) != NULL )
+	feature->feature_parent = bl_gff3_attribute_dup(value, len);
+    else if ( (feature->feature_parent = strdup("noparent")) == NULL )
+	fprintf(stderr, "bl_gff3_read(): Could not strdup() feature_parent.\n");
     return BL_READ_OK;
 }
 
@@ -478,6 +505,8 @@ int     bl_gff3_write(bl_gff3_t *feature, FILE *gff3_stream,
  *      Copy GFF fields to a BED structure to the extent possible.  Since
  *      GFF and BED files do not necessarily contain the same information,
  *      some information may be lost or filled in with appropriate markers.
+ *      The chromosome dictionary and ID of gff3_feature are copied, so
+ *      bed_feature need not be initialized.
  *
  *  Arguments:
  *      gff3_feature  Pointer to the bl_gff3_t structure to copy
@@ -489,6 +518,8 @@ int     bl_gff3_write(bl_gff3_t *feature, FILE *gff3_stream,
  *  History: 
  *  Date        Name        Modification
  *  2021-04-19  Jason Bacon Begin
+ *  2026-10-17  agent       Update chrom_id of bed_feature
+ *  2026-10-17  agent       Take chrom_dict and chrom_id from gff3_feature
  ***************************************************************************/
 
 void    bl_gff3_to_bed(bl_gff3_t *gff3_feature, bl_bed_t *bed_feature)
@@ -502,6 +533,9 @@ void    bl_gff3_to_bed(bl_gff3_t *gff3_feature, bl_bed_t *bed_feature)
     bl_bed_set_score(bed_feature, 0);
     
     bl_bed_set_chrom_cpy(bed_feature, BL_GFF3_SEQID(gff3_feature), BL_CHROM_MAX_CHARS + 1);
+    // Same chromosome, so same ID, and bed_feature may be uninitialized
+    bed_feature->chrom_dict = gff3_feature->chrom_dict;
+    bed_feature->chrom_id = gff3_feature->seqid_id;
     /*
      *  BED start is 0-based and inclusive
      *  GFF is 1-based and inclusive
@@ -550,6 +584,7 @@ void    bl_gff3_to_bed(bl_gff3_t *gff3_feature, bl_bed_t *bed_feature)
  *  History: 
  *  Date        Name        Modification
  *  2022-02-01  Jason Bacon Begin
+ *  2026-10-17  agent       Free feature_parent and attribute table
  ***************************************************************************/
 
 void    bl_gff3_free(bl_gff3_t *feature)
@@ -568,6 +603,8 @@ void    bl_gff3_free(bl_gff3_t *feature)
 	free(feature->feature_id);
     if ( feature->feature_name != NULL )
 	free(feature->feature_name);
+    free(feature->feature_parent);
+    free(feature->attribute_table);
     bl_gff3_init(feature);
 }
 
@@ -587,81 +624,311 @@ void    bl_gff3_free(bl_gff3_t *feature)
  *      Common attribute names include "ID" and "Name".  Attributes are
  *      embedded in the GFF attributes field in the form name=value;, e.g.
  *      ID=gene:ENSDARG00000029944;Name=parpbp.
+ *
+ *      The value is returned as a newly allocated string, which the
+ *      caller must free.  bl_gff3_find_attribute(3) returns the value
+ *      in place without allocating memory.  Neither modifies feature,
+ *      so features may be searched by multiple threads at once.
  *  
  *  Arguments:
- *      Attribute name, such as "ID" or "Name"
+ *      feature     Pointer to a bl_gff3_t object
+ *      attr_name   Attribute name, such as "ID" or "Name"
  *
  *  Returns:
  *      Attribute value (text after '='), or NULL if name is not found
  *
  *  Examples:
  *      bl_gff3_t    feature;
+ *      char         *name;
  *
- *      if ( bl_gff3_extract_attribute(&feature, "Name") != NULL )
+ *      if ( (name = bl_gff3_extract_attribute(&feature, "Name")) != NULL )
  *      {
+ *          ...
+ *          free(name);
  *      }
  *
  *  See also:
- *      bl_gff3_read(3)
+ *      bl_gff3_read(3), bl_gff3_find_attribute(3)
  *
  *  History: 
  *  Date        Name        Modification
  *  2022-02-05  Jason Bacon Begin
+ *  2026-10-17  agent       Use bl_gff3_find_attribute(), don't modify feature
  ***************************************************************************/
 
 char    *bl_gff3_extract_attribute(bl_gff3_t *feature, const char *attr_name)
 
 {
-    char    *attribute = NULL,
-	    *start,
-	    *val_start,
-	    *end;
-    size_t  len = strlen(attr_name);
-
-    //fprintf(stderr, "bl_gff3_extract_attribute: Finding %s\n", attr_name);
-    // Find attribute beginning with "attr_name="
-    for (start = feature->attributes; (*start != '\0'); )
+    const char  *value;
+    size_t      value_len;
+    
+    if ( (value = bl_gff3_find_attribute(feature, attr_name, &value_len))
+	    == NULL )
+	return NULL;
+    return bl_gff3_attribute_dup(value, value_len);
+}
+
+
+/***************************************************************************
+ *  Name:
+ *      bl_gff3_index_attributes() - Locate tag=value pairs in a feature
+ *
+ *  Library:
+ *      #include <biolibc/gff3.h>
+ *      -lbiolibc -lxtend
+ *
+ *  Description:
+ *      Scan the ATTRIBUTES field of feature once, recording the offset
+ *      and length of each key and value in feature's attribute table,
+ *      so that bl_gff3_find_attribute(3) can compare keys by length
+ *      and memcmp(3) without rescanning the string.  Empty pairs are
+ *      skipped and a pair with no '=' gets an empty value.
+ *
+ *      This is done by bl_gff3_read(3) when BL_GFF3_FIELD_ATTRIBUTE_TABLE
+ *      is in its field mask, and need only be called after ATTRIBUTES is
+ *      otherwise modified.  The table is reused by subsequent reads.
+ *
+ *  Arguments:
+ *      feature     Pointer to a bl_gff3_t object
+ *
+ *  Examples:
+ *      bl_gff3_set_attributes_cpy(&feature, "ID=gene:X;Name=abc", 19);
+ *      bl_gff3_index_attributes(&feature);
+ *
+ *  See also:
+ *      bl_gff3_find_attribute(3), bl_gff3_read(3)
+ *
+ *  History: 
+ *  Date        Name        Modification
+ *  2026-10-17  agent       Begin
+ ***************************************************************************/
+
+void    bl_gff3_index_attributes(bl_gff3_t *feature)
+
+{
+    const char  *start,
+		*end,
+		*eq;
+    bl_gff3_attribute_t *attr;
+    
+    feature->attribute_count = 0;
+    feature->attributes_indexed = true;
+    if ( feature->attributes == NULL )
+	return;
+    
+    for (start = feature->attributes; *start != '\0'; start = end + 1)
     {
-	// Need this whether or not there's a match
-	val_start = start + len + 1;
-	end = strchr(val_start, ';');
+	// ';' separates attributes, last one terminated by null byte
+	for (end = start, eq = NULL; (*end != ';') && (*end != '\0'); ++end)
+	    if ( (*end == '=') && (eq == NULL) )
+		eq = end;
 	
-	//fprintf(stderr, "bl_gff3_extract_attribute: %s %c %s %zu\n",
-	//        start, start[len], attr_name, len);
-	if ( (memcmp(start, attr_name, len) == 0) && (start[len] == '=') )
+	if ( end > start )
 	{
-	    //fprintf(stderr, "bl_gff3_extract_attribute: match at %s\n", start);
-	    // ';' separates attributes, last one terminated by null byte
-	    // Temporarily null-terminate for strdup()
-	    // FIXME: Maybe add strdup_delim() to libxtend?
-	    if ( end != NULL )
-		*end = '\0';        // FIXME: Not thread safe
-
-	    if ( (attribute = strdup(val_start)) == NULL )
+	    if ( feature->attribute_count == feature->attribute_table_size )
 	    {
-		fprintf(stderr, "%s: strdup() failed.\n", __FUNCTION__);
-		exit(EX_UNAVAILABLE);
+		feature->attribute_table_size =
+		    feature->attribute_table_size == 0 ?
+		    BL_GFF3_ATTRIBUTE_TABLE_START_SIZE :
+		    feature->attribute_table_size * 2;
+		feature->attribute_table = xt_realloc(feature->attribute_table,
+		    feature->attribute_table_size,
+		    sizeof(*feature->attribute_table));
+		if ( feature->attribute_table == NULL )
+		{
+		    fprintf(stderr, "%s: Could not allocate attribute table.\n",
+			    __FUNCTION__);
+		    exit(EX_UNAVAILABLE);
+		}
 	    }
-	    
-	    // Restore clobbered ';'
-	    if ( end != NULL )
-		*end = ';';
-	    
-	    // Only 1 match should be found
+	    attr = &feature->attribute_table[feature->attribute_count++];
+	    attr->key_offset = start - feature->attributes;
+	    if ( eq == NULL )
+		eq = end;
+	    attr->key_len = eq - start;
+	    attr->value_offset = (eq == end ? end : eq + 1) - feature->attributes;
+	    attr->value_len = end - feature->attributes - attr->value_offset;
+	}
+	if ( *end == '\0' )
 	    break;
+    }
+}
+
+
+/***************************************************************************
+ *  Name:
+ *      bl_gff3_find_attribute() - Find GFF3 attribute value in place
+ *
+ *  Library:
+ *      #include <biolibc/gff3.h>
+ *      -lbiolibc -lxtend
+ *
+ *  Description:
+ *      Find the value of the attribute attr_name in feature, returning
+ *      a pointer into the ATTRIBUTES field and the value's length.  The
+ *      value is not NUL-terminated, and no memory is allocated or
+ *      modified, so the same feature may be searched by multiple threads.
+ *
+ *      If the attribute table has been built by bl_gff3_read(3) or
+ *      bl_gff3_index_attributes(3), only the table is searched.  Features
+ *      have few attributes, so this amounts to a handful of length
+ *      comparisons.  Otherwise the ATTRIBUTES string is scanned.
+ *  
+ *  Arguments:
+ *      feature     Pointer to a bl_gff3_t object
+ *      attr_name   Attribute name, such as "ID" or "Parent"
+ *      value_len   Address of a size_t to receive the value length
+ *
+ *  Returns:
+ *      Pointer to the first character of the value, or NULL if attr_name
+ *      is not found
+ *
+ *  Examples:
+ *      const char  *parent;
+ *      size_t      len;
+ *
+ *      if ( (parent = bl_gff3_find_attribute(&feature, "Parent", &len))
+ *              != NULL )
+ *          printf("%.*s\n", (int)len, parent);
+ *
+ *  See also:
+ *      bl_gff3_index_attributes(3), bl_gff3_extract_attribute(3),
+ *      bl_gff3_attribute_dup(3)
+ *
+ *  History: 
+ *  Date        Name        Modification
+ *  2026-10-17  agent       Begin
+ ***************************************************************************/
+
+const char  *bl_gff3_find_attribute(const bl_gff3_t *feature,
+				    const char *attr_name, size_t *value_len)
+
+{
+    const bl_gff3_attribute_t   *attr;
+    size_t      len = strlen(attr_name),
+		c;
+    
+    if ( feature->attributes == NULL )
+	return NULL;
+    
+    if ( feature->attributes_indexed )
+    {
+	for (c = 0; c < feature->attribute_count; ++c)
+	{
+	    attr = &feature->attribute_table[c];
+	    if ( (attr->key_len == len) &&
+		 (memcmp(feature->attributes + attr->key_offset, attr_name,
+			 len) == 0) )
+	    {
+		*value_len = attr->value_len;
+		return feature->attributes + attr->value_offset;
+	    }
 	}
-	
-	// ; separates attributes, last one terminated by null byte
-	if ( end != NULL )
-	    start = end + 1;    // Next attribute starts after ';'
-	else
-	    break;              // Last attribute, no ';'
+	return NULL;
     }
+    return bl_gff3_attributes_find(feature->attributes, attr_name, value_len);
+}
+
+
+/***************************************************************************
+ *  Name:
+ *      bl_gff3_attributes_find() - Find attribute value in a GFF3 string
+ *
+ *  Library:
+ *      #include <biolibc/gff3.h>
+ *      -lbiolibc -lxtend
+ *
+ *  Description:
+ *      Scan attributes, a GFF3 ATTRIBUTES field such as
+ *      "ID=gene:X;Name=abc", for attr_name and return a pointer to its
+ *      value and the value's length.  The string is not modified.
+ *
+ *      This is used by bl_gff3_find_attribute(3) on features with no
+ *      attribute table and by bl_gff3_store_find_attribute(3).
+ *  
+ *  Arguments:
+ *      attributes  NUL-terminated GFF3 attributes string
+ *      attr_name   Attribute name, such as "ID" or "Parent"
+ *      value_len   Address of a size_t to receive the value length
+ *
+ *  Returns:
+ *      Pointer to the first character of the value, or NULL if attr_name
+ *      is not found
+ *
+ *  See also:
+ *      bl_gff3_find_attribute(3)
+ *
+ *  History: 
+ *  Date        Name        Modification
+ *  2026-10-17  agent       Begin
+ ***************************************************************************/
+
+const char  *bl_gff3_attributes_find(const char *attributes,
+				     const char *attr_name, size_t *value_len)
+
+{
+    const char  *start,
+		*end;
+    size_t      len = strlen(attr_name);
     
-    //fprintf(stderr, "bl_gff3_extract_attribute: %s = %s\n",
-    //        attr_name, attribute);
+    for (start = attributes; *start != '\0'; start = end + 1)
+    {
+	end = start + strcspn(start, ";");
+	if ( ((size_t)(end - start) > len) && (start[len] == '=') &&
+	     (memcmp(start, attr_name, len) == 0) )
+	{
+	    *value_len = end - start - len - 1;
+	    return start + len + 1;
+	}
+	if ( *end == '\0' )
+	    break;
+    }
+    return NULL;
+}
+
+
+/***************************************************************************
+ *  Name:
+ *      bl_gff3_attribute_dup() - Copy an attribute value to a new string
+ *
+ *  Library:
+ *      #include <biolibc/gff3.h>
+ *      -lbiolibc -lxtend
+ *
+ *  Description:
+ *      Return a newly allocated, NUL-terminated copy of the value_len
+ *      characters at value, as returned by bl_gff3_find_attribute(3).
+ *      The program is terminated if memory cannot be allocated, as by
+ *      bl_gff3_extract_attribute(3).
+ *
+ *  Arguments:
+ *      value       Attribute value, not necessarily NUL-terminated
+ *      value_len   Length of value
+ *
+ *  Returns:
+ *      Pointer to the copy, which the caller must free
+ *
+ *  See also:
+ *      bl_gff3_find_attribute(3)
+ *
+ *  History: 
+ *  Date        Name        Modification
+ *  2026-10-17  agent       Begin
+ ***************************************************************************/
+
+char    *bl_gff3_attribute_dup(const char *value, size_t value_len)
+
+{
+    char    *copy;
     
-    return attribute;
+    if ( (copy = xt_malloc(value_len + 1, sizeof(*copy))) == NULL )
+    {
+	fprintf(stderr, "%s: Could not allocate attribute.\n", __FUNCTION__);
+	exit(EX_UNAVAILABLE);
+    }
+    memcpy(copy, value, value_len);
+    copy[value_len] = '\0';
+    return copy;
 }
 
 
@@ -697,6 +964,8 @@ char    *bl_gff3_extract_attribute(bl_gff3_t *feature, const char *attr_name)
  *  History: 
  *  Date        Name        Modification
  *  2022-02-16  Jason Bacon Begin
+ *  2026-10-17  agent       Initialize chrom_dict and seqid_id
+ *  2026-10-17  agent       Initialize feature_parent and attribute table
  ***************************************************************************/
 
 void    bl_gff3_init(bl_gff3_t *feature)
@@ -707,9 +976,15 @@ void    bl_gff3_init(bl_gff3_t *feature)
     feature->start = feature->end = 0;
     feature->score = 0.0;
     feature->strand = feature->phase = '.';
-    feature->attributes = feature->feature_id = feature->feature_name = NULL;
+    feature->attributes = feature->feature_id = feature->feature_name =
+	feature->feature_parent = NULL;
     feature->attributes_array_size = feature->attributes_len = 0;
     feature->file_pos = 0;
+    feature->chrom_dict = NULL;
+    feature->seqid_id = BL_CHROM_ID_NONE;
+    feature->attribute_table = NULL;
+    feature->attribute_count = feature->attribute_table_size = 0;
+    feature->attributes_indexed = false;
 }
 
 
@@ -738,6 +1013,7 @@ void    bl_gff3_init(bl_gff3_t *feature)
  *  History: 
  *  Date        Name        Modification
  *  2022-02-23  Jason Bacon Begin
+ *  2026-10-17  agent       Free the duplicate if bl_gff3_copy() fails
  ***************************************************************************/
 
 bl_gff3_t    *bl_gff3_dup(bl_gff3_t *feature)
@@ -752,7 +1028,13 @@ bl_gff3_t    *bl_gff3_dup(bl_gff3_t *feature)
 	return NULL;
     }
     bl_gff3_init(copy);
-    return bl_gff3_copy(copy, feature);
+    if ( bl_gff3_copy(copy, feature) == NULL )
+    {
+	bl_gff3_free(copy);
+	free(copy);
+	return NULL;
+    }
+    return copy;
 }
 
 
@@ -767,14 +1049,17 @@ bl_gff3_t    *bl_gff3_dup(bl_gff3_t *feature)
  *      -lbiolibc
  *
  *  Description:
- *      Copy a GFF3 object to another that it already initilized.
+ *      Copy a GFF3 object to another that is already initialized.
+ *      Buffers already held by copy are reused or freed, so copy may
+ *      be the target of earlier copies or bl_gff3_read(3) calls.
  *  
  *  Arguments:
  *      copy    Target GFF3 object
  *      feature Source GFF3 object
  *
  *  Returns:
- *      Address of copy
+ *      Address of copy, or NULL if memory could not be allocated, in
+ *      which case copy is still valid for bl_gff3_free(3)
  *
  *  See also:
  *      bl_gff3_read(3), bl_gff3_dup(3)
@@ -782,11 +1067,17 @@ bl_gff3_t    *bl_gff3_dup(bl_gff3_t *feature)
  *  History: 
  *  Date        Name        Modification
  *  2022-02-23  Jason Bacon Begin
+ *  2026-10-17  agent       Copy chrom_dict and seqid_id
+ *  2026-10-17  agent       Rebuild attribute table
+ *  2026-10-17  agent       Reuse buffers of copy, copy feature_parent
  ***************************************************************************/
 
 bl_gff3_t    *bl_gff3_copy(bl_gff3_t *copy, bl_gff3_t *feature)
 
 {
+    size_t  len;
+    char    *attributes;
+    
     strlcpy(copy->seqid, feature->seqid, BL_CHROM_MAX_CHARS + 1);
     strlcpy(copy->source, feature->source, BL_GFF3_SOURCE_MAX_CHARS + 1);
     strlcpy(copy->type, feature->type, BL_GFF3_TYPE_MAX_CHARS + 1);
@@ -794,37 +1085,47 @@ bl_gff3_t    *bl_gff3_copy(bl_gff3_t *copy, bl_gff3_t *feature)
     copy->end = feature->end;
     copy->score = feature->score;
     copy->strand = feature->strand;
-    copy->phase = feature->phase = '.';
+    copy->phase = feature->phase;
     
-    if ( (copy->attributes = strdup(feature->attributes)) == NULL )
+    // Reuse the attributes buffer of copy, as bl_gff3_read() does
+    len = feature->attributes == NULL ? 0 : feature->attributes_len;
+    if ( copy->attributes_array_size < len + 1 )
     {
-	fprintf(stderr, "%s: Could not allocate attributes.\n", __FUNCTION__);
-	free(copy);
-	return NULL;
+	if ( (attributes = xt_realloc(copy->attributes, len + 1, 1)) == NULL )
+	{
+	    fprintf(stderr, "%s: Could not allocate attributes.\n", __FUNCTION__);
+	    return NULL;
+	}
+	copy->attributes = attributes;
+	copy->attributes_array_size = len + 1;
     }
+    memcpy(copy->attributes, feature->attributes == NULL ? "" :
+	   feature->attributes, len + 1);
+    copy->attributes_len = len;
     
-    if ( feature->feature_id == NULL )
-	copy->feature_id = NULL;
-    else if ( (copy->feature_id = strdup(feature->feature_id)) == NULL )
+    free(copy->feature_id);
+    free(copy->feature_name);
+    free(copy->feature_parent);
+    copy->feature_id = copy->feature_name = copy->feature_parent = NULL;
+    if ( ((feature->feature_id != NULL) &&
+	  ((copy->feature_id = strdup(feature->feature_id)) == NULL)) ||
+	 ((feature->feature_name != NULL) &&
+	  ((copy->feature_name = strdup(feature->feature_name)) == NULL)) ||
+	 ((feature->feature_parent != NULL) &&
+	  ((copy->feature_parent = strdup(feature->feature_parent)) == NULL)) )
     {
 	fprintf(stderr, "%s: Could not allocate attributes.\n", __FUNCTION__);
-	free(copy->attributes);
-	free(copy);
-	return NULL;
-    }
-
-    if ( feature->feature_name == NULL )
-	copy->feature_name = NULL;
-    else if ( (copy->feature_name = strdup(feature->feature_name)) == NULL )
-    {
-	fprintf(stderr, "%s: Could not allocate attributes.\n", __FUNCTION__);
-	free(copy->attributes);
-	free(copy->feature_id);
-	free(copy);
 	return NULL;
     }
     
     copy->file_pos = feature->file_pos;
+    copy->chrom_dict = feature->chrom_dict;
+    copy->seqid_id = feature->seqid_id;
+    
+    copy->attribute_count = 0;
+    copy->attributes_indexed = false;
+    if ( feature->attributes_indexed )
+	bl_gff3_index_attributes(copy);
     
     return copy;
 }
@@ -892,7 +1193,9 @@ int     bl_gff3_sam_cmp(bl_gff3_t *feature, bl_sam_t *alignment)
  *
  *  Description:
  *      Return the amount of overlap between a GFF feature and a SAM
- *      alignment.
+ *      alignment.  The alignment spans pos .. BL_SAM_REF_END(3), as
+ *      determined by its CIGAR, so reads with deletions or introns are
+ *      measured by their full reference span.
  *  
  *  Arguments:
  *      feature     Pointer to a bl_gff3_t object
@@ -908,12 +1211,13 @@ int     bl_gff3_sam_cmp(bl_gff3_t *feature, bl_sam_t *alignment)
  *  History: 
  *  Date        Name        Modification
  *  2022-04-07  Jason Bacon Begin
+ *  2026-10-17  agent       Use CIGAR reference end instead of seq_len
  ***************************************************************************/
 
 int64_t bl_gff3_sam_overlap(bl_gff3_t *feature, bl_sam_t *alignment)
 
 {
-    int64_t alignment_end = BL_SAM_POS(alignment) + BL_SAM_SEQ_LEN(alignment),
+    int64_t alignment_end = BL_SAM_REF_END(alignment),
 	    overlap_start = XT_MAX(BL_GFF3_START(feature), BL_SAM_POS(alignment)),
 	    overlap_end = XT_MIN(BL_GFF3_END(feature), alignment_end);
     
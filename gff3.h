@@ -5,10 +5,18 @@
 extern "C" {
 #endif
 
+#ifndef __bool_true_false_are_defined
+#include <stdbool.h>
+#endif
+
 #ifndef _BIOLIBC_H_
 #include "biolibc.h"
 #endif
 
+#ifndef _BIOLIBC_CHROM_DICT_H_
+#include "chrom-dict.h"
+#endif
+
 #define BL_GFF3_SOURCE_MAX_CHARS     1024     // Guess
 #define BL_GFF3_TYPE_MAX_CHARS       256      // Guess
 #define BL_GFF3_SCORE_MAX_DIGITS     64       // Floating point
@@ -19,6 +27,20 @@ extern "C" {
 #define BL_GFF3_SCORE_UNAVAILABLE    -1.0
 #define BL_GFF3_PHASE_UNAVAILABLE    '.'
 
+#define BL_GFF3_ATTRIBUTE_TABLE_START_SIZE  16
+
+/*
+ *  Location of one tag=value pair within the attributes string.  Neither
+ *  key nor value is NUL-terminated in place.
+ */
+typedef struct
+{
+    uint32_t    key_offset,
+		key_len,
+		value_offset,
+		value_len;
+}   bl_gff3_attribute_t;
+
 typedef struct
 {
     char            seqid[BL_CHROM_MAX_CHARS + 1];
@@ -44,6 +66,16 @@ typedef struct
     
     // Offset of the feature in the GFF3 file for indexing
     long            file_pos;
+    
+    // Optional shared chromosome dictionary, see bl_sam_t
+    bl_chrom_dict_t *chrom_dict;
+    int32_t         seqid_id;
+    
+    // Tag=value pairs in attributes, see bl_gff3_index_attributes()
+    bl_gff3_attribute_t *attribute_table;
+    size_t          attribute_count,
+		    attribute_table_size;
+    bool            attributes_indexed;
 }   bl_gff3_t;
 
 typedef unsigned int            gff3_field_mask_t;
@@ -57,6 +89,7 @@ typedef unsigned int            gff3_field_mask_t;
 #define BL_GFF3_FIELD_STRAND     0x040
 #define BL_GFF3_FIELD_PHASE      0x080
 #define BL_GFF3_FIELD_ATTRIBUTES 0x100
+#define BL_GFF3_FIELD_ATTRIBUTE_TABLE 0x200 // Index tag=value pairs
 #define BL_GFF3_FIELD_ALL        0xfff
 
 // After bl_gff3_t for prototypes
@@ -81,6 +114,10 @@ int bl_gff3_write(bl_gff3_t *gff3_feature, FILE *gff3_stream, gff3_field_mask_t
 void bl_gff3_to_bed(bl_gff3_t *gff3_feature, bl_bed_t *bed_feature);
 void bl_gff3_free(bl_gff3_t *gff3_feature);
 char *bl_gff3_extract_attribute(bl_gff3_t *feature, const char *attr_name);
+void bl_gff3_index_attributes(bl_gff3_t *feature);
+const char *bl_gff3_find_attribute(const bl_gff3_t *feature, const char *attr_name, size_t *value_len);
+const char *bl_gff3_attributes_find(const char *attributes, const char *attr_name, size_t *value_len);
+char *bl_gff3_attribute_dup(const char *value, size_t value_len);
 void bl_gff3_init(bl_gff3_t *feature);
 bl_gff3_t *bl_gff3_dup(bl_gff3_t *feature);
 bl_gff3_t *bl_gff3_copy(bl_gff3_t *copy, bl_gff3_t *feature);
@@ -0,0 +1,15 @@
+    
+/*
+ *  Generated by /usr/local/bin/auto-gen-get-set
+ *
+ *  Accessor macros.  Use these to access structure members from functions
+ *  outside the bl_interval_index_t class.
+ *
+ *  These generated macros are not expected to be perfect.  Check and edit
+ *  as needed before adding to your code.
+ */
+
+#define BL_INTERVAL_INDEX_INTERVALS(ptr) ((ptr)->intervals)
+#define BL_INTERVAL_INDEX_INTERVALS_AE(ptr,c) ((ptr)->intervals[c])
+#define BL_INTERVAL_INDEX_COUNT(ptr)    ((ptr)->count)
+#define BL_INTERVAL_INDEX_BUILT(ptr)    ((ptr)->built)
@@ -0,0 +1,292 @@
+/***************************************************************************
+ *  This file is automatically generated by gen-get-set.  Be sure to keep
+ *  track of any manual changes.
+ *
+ *  These generated functions are not expected to be perfect.  Check and
+ *  edit as needed before adding to your code.
+ ***************************************************************************/
+
+#include <string.h>
+#include <ctype.h>
+#include <stdbool.h>        // In case of bool
+#include <stdint.h>         // In case of int64_t, etc
+#include <xtend/string.h>   // strlcpy() on Linux
+#include "interval-index.h"
+
+
+/***************************************************************************
+ *  Library:
+ *      #include <biolibc/interval-index.h>
+ *      -lbiolibc -lxtend
+ *
+ *  Description:
+ *      Mutator for intervals member in a bl_interval_index_t structure.
+ *      Use this function to set intervals in a bl_interval_index_t object
+ *      from non-member functions.  This function performs a direct
+ *      assignment for scalar or pointer structure members.  If
+ *      intervals is a pointer, data previously pointed to should
+ *      be freed before calling this function to avoid memory
+ *      leaks.
+ *
+ *  Arguments:
+ *      bl_interval_index_ptr Pointer to the structure to set
+ *      new_intervals   The new value for intervals
+ *
+ *  Returns:
+ *      BL_INTERVAL_INDEX_DATA_OK if the new value is acceptable and assigned
+ *      BL_INTERVAL_INDEX_DATA_OUT_OF_RANGE otherwise
+ *
+ *  Examples:
+ *      bl_interval_index_t bl_interval_index;
+ *      bl_interval_t *      new_intervals;
+ *
+ *      if ( bl_interval_index_set_intervals(&bl_interval_index, new_intervals)
+ *              == BL_INTERVAL_INDEX_DATA_OK )
+ *      {
+ *      }
+ *
+ *  See also:
+ *      (3)
+ *
+ *  History: 
+ *  Date        Name        Modification
+ *  2026-10-17  gen-get-set Auto-generated from interval-index.h
+ ***************************************************************************/
+
+int     bl_interval_index_set_intervals(
+	    bl_interval_index_t *bl_interval_index_ptr,
+	    bl_interval_t *new_intervals
+	)
+
+{
+    if ( new_intervals == NULL )
+	return BL_INTERVAL_INDEX_DATA_OUT_OF_RANGE;
+    else
+    {
+	bl_interval_index_ptr->intervals = new_intervals;
+	return BL_INTERVAL_INDEX_DATA_OK;
+    }
+}
+
+
+/***************************************************************************
+ *  Library:
+ *      #include <biolibc/interval-index.h>
+ *      -lbiolibc -lxtend
+ *
+ *  Description:
+ *      Mutator for an array element of intervals member in a bl_interval_index_t
+ *      structure. Use this function to set bl_interval_index_ptr->intervals[c]
+ *      in a bl_interval_index_t object from non-member functions.
+ *
+ *  Arguments:
+ *      bl_interval_index_ptr Pointer to the structure to set
+ *      c               Subscript to the intervals array
+ *      new_intervals_element The new value for intervals[c]
+ *
+ *  Returns:
+ *      BL_INTERVAL_INDEX_DATA_OK if the new value is acceptable and assigned
+ *      BL_INTERVAL_INDEX_DATA_OUT_OF_RANGE otherwise
+ *
+ *  Examples:
+ *      bl_interval_index_t bl_interval_index;
+ *      size_t          c;
+ *      bl_interval_t   new_intervals_element;
+ *
+ *      if ( bl_interval_index_set_intervals_ae(&bl_interval_index, c, new_intervals_element)
+ *              == BL_INTERVAL_INDEX_DATA_OK )
+ *      {
+ *      }
+ *
+ *  See also:
+ *      BL_INTERVAL_INDEX_SET_INTERVALS_AE(3)
+ *
+ *  History: 
+ *  Date        Name        Modification
+ *  2026-10-17  gen-get-set Auto-generated from interval-index.h
+ ***************************************************************************/
+
+int     bl_interval_index_set_intervals_ae(
+	    bl_interval_index_t *bl_interval_index_ptr,
+	    size_t c,
+	    bl_interval_t new_intervals_element
+	)
+
+{
+    if ( false )
+	return BL_INTERVAL_INDEX_DATA_OUT_OF_RANGE;
+    else
+    {
+	bl_interval_index_ptr->intervals[c] = new_intervals_element;
+	return BL_INTERVAL_INDEX_DATA_OK;
+    }
+}
+
+
+/***************************************************************************
+ *  Library:
+ *      #include <biolibc/interval-index.h>
+ *      -lbiolibc -lxtend
+ *
+ *  Description:
+ *      Mutator for intervals member in a bl_interval_index_t structure.
+ *      Use this function to set intervals in a bl_interval_index_t object
+ *      from non-member functions.  This function copies the array pointed to
+ *      by new_intervals to bl_interval_index_ptr->intervals.
+ *
+ *  Arguments:
+ *      bl_interval_index_ptr Pointer to the structure to set
+ *      new_intervals   The new value for intervals
+ *      array_size      Size of the intervals array.
+ *
+ *  Returns:
+ *      BL_INTERVAL_INDEX_DATA_OK if the new value is acceptable and assigned
+ *      BL_INTERVAL_INDEX_DATA_OUT_OF_RANGE otherwise
+ *
+ *  Examples:
+ *      bl_interval_index_t bl_interval_index;
+ *      bl_interval_t *      new_intervals;
+ *      size_t          array_size;
+ *
+ *      if ( bl_interval_index_set_intervals_cpy(&bl_interval_index, new_intervals, array_size)
+ *              == BL_INTERVAL_INDEX_DATA_OK )
+ *      {
+ *      }
+ *
+ *  See also:
+ *      BL_INTERVAL_INDEX_SET_INTERVALS(3)
+ *
+ *  History: 
+ *  Date        Name        Modification
+ *  2026-10-17  gen-get-set Auto-generated from interval-index.h
+ ***************************************************************************/
+
+int     bl_interval_index_set_intervals_cpy(
+	    bl_interval_index_t *bl_interval_index_ptr,
+	    bl_interval_t *new_intervals,
+	    size_t array_size
+	)
+
+{
+    if ( new_intervals == NULL )
+	return BL_INTERVAL_INDEX_DATA_OUT_OF_RANGE;
+    else
+    {
+	size_t  c;
+	
+	// FIXME: Assuming all elements should be copied
+	for (c = 0; c < array_size; ++c)
+	    bl_interval_index_ptr->intervals[c] = new_intervals[c];
+	return BL_INTERVAL_INDEX_DATA_OK;
+    }
+}
+
+
+/***************************************************************************
+ *  Library:
+ *      #include <biolibc/interval-index.h>
+ *      -lbiolibc -lxtend
+ *
+ *  Description:
+ *      Mutator for count member in a bl_interval_index_t structure.
+ *      Use this function to set count in a bl_interval_index_t object
+ *      from non-member functions.  This function performs a direct
+ *      assignment for scalar or pointer structure members.  If
+ *      count is a pointer, data previously pointed to should
+ *      be freed before calling this function to avoid memory
+ *      leaks.
+ *
+ *  Arguments:
+ *      bl_interval_index_ptr Pointer to the structure to set
+ *      new_count       The new value for count
+ *
+ *  Returns:
+ *      BL_INTERVAL_INDEX_DATA_OK if the new value is acceptable and assigned
+ *      BL_INTERVAL_INDEX_DATA_OUT_OF_RANGE otherwise
+ *
+ *  Examples:
+ *      bl_interval_index_t bl_interval_index;
+ *      size_t          new_count;
+ *
+ *      if ( bl_interval_index_set_count(&bl_interval_index, new_count)
+ *              == BL_INTERVAL_INDEX_DATA_OK )
+ *      {
+ *      }
+ *
+ *  See also:
+ *      (3)
+ *
+ *  History: 
+ *  Date        Name        Modification
+ *  2026-10-17  gen-get-set Auto-generated from interval-index.h
+ ***************************************************************************/
+
+int     bl_interval_index_set_count(
+	    bl_interval_index_t *bl_interval_index_ptr,
+	    size_t new_count
+	)
+
+{
+    if ( false )
+	return BL_INTERVAL_INDEX_DATA_OUT_OF_RANGE;
+    else
+    {
+	bl_interval_index_ptr->count = new_count;
+	return BL_INTERVAL_INDEX_DATA_OK;
+    }
+}
+
+
+/***************************************************************************
+ *  Library:
+ *      #include <biolibc/interval-index.h>
+ *      -lbiolibc -lxtend
+ *
+ *  Description:
+ *      Mutator for built member in a bl_interval_index_t structure.
+ *      Use this function to set built in a bl_interval_index_t object
+ *      from non-member functions.  This function performs a direct
+ *      assignment for scalar or pointer structure members.  If
+ *      built is a pointer, data previously pointed to should
+ *      be freed before calling this function to avoid memory
+ *      leaks.
+ *
+ *  Arguments:
+ *      bl_interval_index_ptr Pointer to the structure to set
+ *      new_built       The new value for built
+ *
+ *  Returns:
+ *      BL_INTERVAL_INDEX_DATA_OK if the new value is acceptable and assigned
+ *      BL_INTERVAL_INDEX_DATA_OUT_OF_RANGE otherwise
+ *
+ *  Examples:
+ *      bl_interval_index_t bl_interval_index;
+ *      bool            new_built;
+ *
+ *      if ( bl_interval_index_set_built(&bl_interval_index, new_built)
+ *              == BL_INTERVAL_INDEX_DATA_OK )
+ *      {
+ *      }
+ *
+ *  See also:
+ *      (3)
+ *
+ *  History: 
+ *  Date        Name        Modification
+ *  2026-10-17  gen-get-set Auto-generated from interval-index.h
+ ***************************************************************************/
+
+int     bl_interval_index_set_built(
+	    bl_interval_index_t *bl_interval_index_ptr,
+	    bool new_built
+	)
+
+{
+    if ( false )
+	return BL_INTERVAL_INDEX_DATA_OUT_OF_RANGE;
+    else
+    {
+	bl_interval_index_ptr->built = new_built;
+	return BL_INTERVAL_INDEX_DATA_OK;
+    }
+}
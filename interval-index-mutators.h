@@ -0,0 +1,21 @@
+
+/*
+ *  Generated by /usr/local/bin/auto-gen-get-set
+ *
+ *  Mutator functions for setting with no sanity checking.  Use these to
+ *  set structure members from functions outside the bl_interval_index_t
+ *  class.  These macros perform no data validation.  Hence, they achieve
+ *  maximum performance where data are guaranteed correct by other means.
+ *  Use the mutator functions (same name as the macro, but lower case)
+ *  for more robust code with a small performance penalty.
+ *
+ *  These generated macros are not expected to be perfect.  Check and edit
+ *  as needed before adding to your code.
+ */
+
+/* temp-interval-index-mutators.c */
+int bl_interval_index_set_intervals(bl_interval_index_t *bl_interval_index_ptr, bl_interval_t *new_intervals);
+int bl_interval_index_set_intervals_ae(bl_interval_index_t *bl_interval_index_ptr, size_t c, bl_interval_t new_intervals_element);
+int bl_interval_index_set_intervals_cpy(bl_interval_index_t *bl_interval_index_ptr, bl_interval_t *new_intervals, size_t array_size);
+int bl_interval_index_set_count(bl_interval_index_t *bl_interval_index_ptr, size_t new_count);
+int bl_interval_index_set_built(bl_interval_index_t *bl_interval_index_ptr, bool new_built);
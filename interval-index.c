@@ -0,0 +1,621 @@
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <sysexits.h>
+#include <inttypes.h>
+#include <xtend/mem.h>
+#include "interval-index.h"
+
+/***************************************************************************
+ *  Name:
+ *      bl_interval_index_init() - Initialize an interval index
+ *
+ *  Library:
+ *      #include <biolibc/interval-index.h>
+ *      -lbiolibc -lxtend
+ *
+ *  Description:
+ *      Initialize an empty bl_interval_index_t object.  Add intervals
+ *      with bl_interval_index_add(3), bl_interval_index_add_bed(3) or
+ *      bl_interval_index_add_gff3(3), call bl_interval_index_build(3)
+ *      once, and then run any number of bl_interval_index_query(3)
+ *      calls.  The built index is read-only, so queries may run
+ *      concurrently in multiple threads, each with its own hits array.
+ *
+ *  Arguments:
+ *      index   Pointer to the bl_interval_index_t object to initialize
+ *
+ *  Examples:
+ *      bl_interval_index_t index;
+ *      size_t              *hits = NULL, hits_array_size = 0, count, c;
+ *
+ *      bl_interval_index_init(&index);
+ *      while ( bl_gff3_read(&feature, gff3_stream, BL_GFF3_FIELD_ALL)
+ *              == BL_READ_OK )
+ *          bl_interval_index_add_gff3(&index, &feature, feature_count++);
+ *      bl_interval_index_build(&index);
+ *      count = bl_interval_index_query(&index, "chr1", 1000, 2000,
+ *                                      &hits, &hits_array_size);
+ *      for (c = 0; c < count; ++c)
+ *          printf("%zu\n", BL_INTERVAL_VALUE(
+ *                 &BL_INTERVAL_INDEX_INTERVALS_AE(&index, hits[c])));
+ *      free(hits);
+ *      bl_interval_index_free(&index);
+ *
+ *  See also:
+ *      bl_interval_index_build(3), bl_interval_index_query(3)
+ *
+ *  History:
+ *  Date        Name        Modification
+ *  2026-10-17  agent       Begin
+ ***************************************************************************/
+
+void    bl_interval_index_init(bl_interval_index_t *index)
+
+{
+    bl_chrom_dict_init(&index->dict);
+    index->intervals = NULL;
+    index->count = 0;
+    index->array_size = 0;
+    index->last_chrom_id = BL_CHROM_ID_NONE;
+    index->chrom_offsets = NULL;
+    index->chrom_counts = NULL;
+    index->chrom_levels = NULL;
+    index->chrom_array_size = 0;
+    index->built = false;
+}
+
+
+/***************************************************************************
+ *  Name:
+ *      bl_interval_index_free() - Free memory held by an interval index
+ *
+ *  Library:
+ *      #include <biolibc/interval-index.h>
+ *      -lbiolibc -lxtend
+ *
+ *  Description:
+ *      Free all memory held by a bl_interval_index_t object and leave it
+ *      empty, ready for reuse.
+ *
+ *  Arguments:
+ *      index   Pointer to the bl_interval_index_t object
+ *
+ *  See also:
+ *      bl_interval_index_init(3)
+ *
+ *  History:
+ *  Date        Name        Modification
+ *  2026-10-17  agent       Begin
+ ***************************************************************************/
+
+void    bl_interval_index_free(bl_interval_index_t *index)
+
+{
+    bl_chrom_dict_free(&index->dict);
+    free(index->intervals);
+    free(index->chrom_offsets);
+    free(index->chrom_counts);
+    free(index->chrom_levels);
+    bl_interval_index_init(index);
+}
+
+
+/***************************************************************************
+ *  Name:
+ *      bl_interval_index_add() - Add an interval to an index
+ *
+ *  Library:
+ *      #include <biolibc/interval-index.h>
+ *      -lbiolibc -lxtend
+ *
+ *  Description:
+ *      Add an interval to a bl_interval_index_t object, with a value for
+ *      the caller's use, typically the index of the feature in an array.
+ *      Intervals may be added in any order.  The index must be rebuilt
+ *      with bl_interval_index_build(3) before the next query.
+ *
+ *  Arguments:
+ *      index   Pointer to a bl_interval_index_t object
+ *      chrom   Chromosome name
+ *      start   First position, 1-based
+ *      end     Last position, inclusive
+ *      value   Caller's data for the interval
+ *
+ *  Returns:
+ *      BL_INTERVAL_INDEX_OK on success
+ *      BL_INTERVAL_INDEX_BAD_DATA if end < start or chrom is "." or "*"
+ *      BL_INTERVAL_INDEX_MALLOC_FAILED if the array could not be extended
+ *
+ *  See also:
+ *      bl_interval_index_add_bed(3), bl_interval_index_add_gff3(3),
+ *      bl_interval_index_build(3)
+ *
+ *  History:
+ *  Date        Name        Modification
+ *  2026-10-17  agent       Begin
+ ***************************************************************************/
+
+int     bl_interval_index_add(bl_interval_index_t *index, const char *chrom,
+			      int64_t start, int64_t end, size_t value)
+
+{
+    bl_interval_t   *interval;
+    int32_t         chrom_id;
+
+    chrom_id = bl_chrom_dict_intern(&index->dict, index->last_chrom_id, chrom);
+    if ( (end < start) || (chrom_id == BL_CHROM_ID_NONE) )
+    {
+	fprintf(stderr, "bl_interval_index_add(): Invalid interval %s:%"
+		PRId64 "-%" PRId64 ".\n", chrom, start, end);
+	return BL_INTERVAL_INDEX_BAD_DATA;
+    }
+    index->last_chrom_id = chrom_id;
+
+    if ( index->count == index->array_size )
+    {
+	index->array_size = index->array_size == 0 ?
+	    BL_INTERVAL_INDEX_START_SIZE : index->array_size * 2;
+	index->intervals = xt_realloc(index->intervals, index->array_size,
+				      sizeof(*index->intervals));
+	if ( index->intervals == NULL )
+	    return BL_INTERVAL_INDEX_MALLOC_FAILED;
+    }
+    interval = &index->intervals[index->count++];
+    interval->start = start;
+    interval->end = end;
+    interval->max_end = end;
+    interval->chrom_id = chrom_id;
+    interval->value = value;
+    index->built = false;
+    return BL_INTERVAL_INDEX_OK;
+}
+
+
+/***************************************************************************
+ *  Name:
+ *      bl_interval_index_add_bed() - Add a BED feature to an interval index
+ *
+ *  Library:
+ *      #include <biolibc/interval-index.h>
+ *      -lbiolibc -lxtend
+ *
+ *  Description:
+ *      Add the span of a BED feature to a bl_interval_index_t object,
+ *      converting its 0-based, half-open coordinates to the 1-based,
+ *      inclusive coordinates used by the index.
+ *
+ *      A zero-length feature (chrom_start == chrom_end) marks a point
+ *      between two bases, such as an insertion site.  As in bedtools, it
+ *      is indexed as the single base following that point, so it is found
+ *      by queries covering that base.
+ *
+ *  Arguments:
+ *      index       Pointer to a bl_interval_index_t object
+ *      bed_feature Pointer to a bl_bed_t object
+ *      value       Caller's data for the interval
+ *
+ *  Returns:
+ *      As bl_interval_index_add(3)
+ *
+ *  See also:
+ *      bl_interval_index_add(3)
+ *
+ *  History:
+ *  Date        Name        Modification
+ *  2026-10-17  agent       Begin
+ *  2026-10-17  agent       Accept zero-length features
+ ***************************************************************************/
+
+int     bl_interval_index_add_bed(bl_interval_index_t *index,
+				  bl_bed_t *bed_feature, size_t value)
+
+{
+    int64_t start = BL_BED_CHROM_START(bed_feature) + 1,
+	    end = BL_BED_CHROM_END(bed_feature);
+    
+    // Zero-length: end would be start - 1, which add() rejects
+    if ( end == start - 1 )
+	end = start;
+    return bl_interval_index_add(index, BL_BED_CHROM(bed_feature),
+				 start, end, value);
+}
+
+
+/***************************************************************************
+ *  Name:
+ *      bl_interval_index_add_gff3() - Add a GFF3 feature to an interval index
+ *
+ *  Library:
+ *      #include <biolibc/interval-index.h>
+ *      -lbiolibc -lxtend
+ *
+ *  Description:
+ *      Add the span of a GFF3 feature to a bl_interval_index_t object.
+ *
+ *  Arguments:
+ *      index           Pointer to a bl_interval_index_t object
+ *      gff3_feature    Pointer to a bl_gff3_t object
+ *      value           Caller's data for the interval
+ *
+ *  Returns:
+ *      As bl_interval_index_add(3)
+ *
+ *  See also:
+ *      bl_interval_index_add(3)
+ *
+ *  History:
+ *  Date        Name        Modification
+ *  2026-10-17  agent       Begin
+ ***************************************************************************/
+
+int     bl_interval_index_add_gff3(bl_interval_index_t *index,
+				   bl_gff3_t *gff3_feature, size_t value)
+
+{
+    return bl_interval_index_add(index, BL_GFF3_SEQID(gff3_feature),
+				 BL_GFF3_START(gff3_feature),
+				 BL_GFF3_END(gff3_feature), value);
+}
+
+
+/***************************************************************************
+ *  Name:
+ *      bl_interval_cmp() - Compare intervals by chromosome and start
+ *
+ *  Library:
+ *      #include <biolibc/interval-index.h>
+ *      -lbiolibc -lxtend
+ *
+ *  Description:
+ *      qsort(3) comparison function for bl_interval_t objects, ordering
+ *      by chromosome ID and then start position.  Ties are broken by end
+ *      and then value, so that the order of hits does not depend on the
+ *      qsort(3) implementation.
+ *
+ *  Arguments:
+ *      interval1, interval2    Pointers to bl_interval_t objects
+ *
+ *  Returns:
+ *      A value < 0 if interval1 sorts before interval2, > 0 if after,
+ *      0 otherwise
+ *
+ *  See also:
+ *      bl_interval_index_build(3)
+ *
+ *  History:
+ *  Date        Name        Modification
+ *  2026-10-17  agent       Begin
+ ***************************************************************************/
+
+int     bl_interval_cmp(const bl_interval_t *interval1,
+			const bl_interval_t *interval2)
+
+{
+    if ( interval1->chrom_id != interval2->chrom_id )
+	return interval1->chrom_id < interval2->chrom_id ? -1 : 1;
+    if ( interval1->start != interval2->start )
+	return interval1->start < interval2->start ? -1 : 1;
+    if ( interval1->end != interval2->end )
+	return interval1->end < interval2->end ? -1 : 1;
+    if ( interval1->value != interval2->value )
+	return interval1->value < interval2->value ? -1 : 1;
+    return 0;
+}
+
+
+/***************************************************************************
+ *  Name:
+ *      bl_interval_index_build() - Sort and augment an interval index
+ *
+ *  Library:
+ *      #include <biolibc/interval-index.h>
+ *      -lbiolibc -lxtend
+ *
+ *  Description:
+ *      Prepare a bl_interval_index_t object for queries, by sorting the
+ *      intervals by chromosome and start, locating the run of each
+ *      chromosome, and computing the subtree max_end of every node of
+ *      each run's implicit tree with bl_interval_index_augment(3).
+ *      Building takes O(n log n) time and no memory beyond a few words
+ *      per chromosome.
+ *
+ *  Arguments:
+ *      index   Pointer to a bl_interval_index_t object
+ *
+ *  Returns:
+ *      BL_INTERVAL_INDEX_OK on success
+ *      BL_INTERVAL_INDEX_MALLOC_FAILED otherwise
+ *
+ *  See also:
+ *      bl_interval_index_add(3), bl_interval_index_query(3)
+ *
+ *  History:
+ *  Date        Name        Modification
+ *  2026-10-17  agent       Begin
+ ***************************************************************************/
+
+int     bl_interval_index_build(bl_interval_index_t *index)
+
+{
+    size_t  c,
+	    chroms = BL_CHROM_DICT_COUNT(&index->dict);
+    int32_t id;
+
+    qsort(index->intervals, index->count, sizeof(*index->intervals),
+	  (int (*)(const void *,const void *))bl_interval_cmp);
+
+    if ( chroms > index->chrom_array_size )
+    {
+	index->chrom_offsets = xt_realloc(index->chrom_offsets, chroms,
+					  sizeof(*index->chrom_offsets));
+	index->chrom_counts = xt_realloc(index->chrom_counts, chroms,
+					 sizeof(*index->chrom_counts));
+	index->chrom_levels = xt_realloc(index->chrom_levels, chroms,
+					 sizeof(*index->chrom_levels));
+	if ( (index->chrom_offsets == NULL) || (index->chrom_counts == NULL) ||
+	     (index->chrom_levels == NULL) )
+	    return BL_INTERVAL_INDEX_MALLOC_FAILED;
+	index->chrom_array_size = chroms;
+    }
+    for (c = 0; c < chroms; ++c)
+    {
+	index->chrom_offsets[c] = 0;
+	index->chrom_counts[c] = 0;
+	index->chrom_levels[c] = -1;
+    }
+
+    for (c = 0; c < index->count; ++c)
+    {
+	id = index->intervals[c].chrom_id;
+	if ( index->chrom_counts[id]++ == 0 )
+	    index->chrom_offsets[id] = c;
+    }
+
+    for (c = 0; c < chroms; ++c)
+	index->chrom_levels[c] = bl_interval_index_augment(
+	    index->intervals + index->chrom_offsets[c], index->chrom_counts[c]);
+    index->built = true;
+    return BL_INTERVAL_INDEX_OK;
+}
+
+
+/***************************************************************************
+ *  Name:
+ *      bl_interval_index_augment() - Compute subtree max ends of an implicit tree
+ *
+ *  Library:
+ *      #include <biolibc/interval-index.h>
+ *      -lbiolibc -lxtend
+ *
+ *  Description:
+ *      Set max_end of every node in the implicit binary tree over an
+ *      array of intervals sorted by start.  Leaves are the even indices
+ *      (level 0) and the nodes of level k are at indices with the low k
+ *      bits set and bit k clear.  When n is not one less than a power
+ *      of 2, the missing right subtrees are represented by the max_end
+ *      of the last existing node at each level.  This is used internally
+ *      by bl_interval_index_build(3).
+ *
+ *  Arguments:
+ *      intervals   Array of intervals on one chromosome, sorted by start
+ *      n           Number of intervals
+ *
+ *  Returns:
+ *      Level of the root, or -1 if n is 0
+ *
+ *  See also:
+ *      bl_interval_index_build(3), bl_interval_index_query(3)
+ *
+ *  History:
+ *  Date        Name        Modification
+ *  2026-10-17  agent       Begin
+ ***************************************************************************/
+
+int     bl_interval_index_augment(bl_interval_t *intervals, size_t n)
+
+{
+    int64_t i,
+	    last_i = 0,
+	    last = 0,
+	    x,
+	    step,
+	    left_max,
+	    right_max,
+	    max_end;
+    int     k;
+
+    if ( n == 0 )
+	return -1;
+
+    for (i = 0; i < (int64_t)n; i += 2)
+    {
+	last_i = i;
+	last = intervals[i].max_end = intervals[i].end;
+    }
+    for (k = 1; (int64_t)1 << k <= (int64_t)n; ++k)
+    {
+	x = (int64_t)1 << (k - 1);
+	step = x << 2;
+	for (i = (x << 1) - 1; i < (int64_t)n; i += step)
+	{
+	    left_max = intervals[i - x].max_end;
+	    right_max = i + x < (int64_t)n ? intervals[i + x].max_end : last;
+	    max_end = intervals[i].end;
+	    if ( left_max > max_end )
+		max_end = left_max;
+	    if ( right_max > max_end )
+		max_end = right_max;
+	    intervals[i].max_end = max_end;
+	}
+	// Move last_i to the last node of level k
+	last_i = (last_i >> k) & 1 ? last_i - x : last_i + x;
+	if ( (last_i < (int64_t)n) && (intervals[last_i].max_end > last) )
+	    last = intervals[last_i].max_end;
+    }
+    return k - 1;
+}
+
+
+/***************************************************************************
+ *  Name:
+ *      bl_interval_index_query() - Find intervals overlapping a region
+ *
+ *  Library:
+ *      #include <biolibc/interval-index.h>
+ *      -lbiolibc -lxtend
+ *
+ *  Description:
+ *      Find all intervals in a built bl_interval_index_t object that
+ *      overlap chrom:start-end, storing their positions in the sorted
+ *      interval array in *hits, in order of start position.  Use
+ *      BL_INTERVAL_INDEX_INTERVALS_AE(3) with each hit to access the
+ *      interval and its value.
+ *
+ *      *hits is extended as needed and should be reused across queries
+ *      to avoid repeated allocation.  Initialize *hits to NULL and
+ *      *hits_array_size to 0 before the first query and free(3) *hits
+ *      when done.
+ *
+ *      The implicit tree is descended with a small fixed stack,
+ *      skipping every subtree whose max_end precedes start, and
+ *      subtrees of at most 2^(BL_INTERVAL_INDEX_SCAN_LEVEL + 1) - 1
+ *      intervals are scanned linearly, which is faster than descending
+ *      them on modern CPUs.
+ *
+ *  Arguments:
+ *      index           Pointer to a built bl_interval_index_t object
+ *      chrom           Chromosome name
+ *      start           First position of region, 1-based
+ *      end             Last position of region, inclusive
+ *      hits            Address of a pointer to an array of hits
+ *      hits_array_size Address of the allocated size of *hits
+ *
+ *  Returns:
+ *      The number of overlapping intervals
+ *
+ *  See also:
+ *      bl_interval_index_build(3), bl_interval_index_augment(3)
+ *
+ *  History:
+ *  Date        Name        Modification
+ *  2026-10-17  agent       Begin
+ ***************************************************************************/
+
+size_t  bl_interval_index_query(bl_interval_index_t *index, const char *chrom,
+				int64_t start, int64_t end, size_t **hits,
+				size_t *hits_array_size)
+
+{
+    bl_interval_frame_t stack[BL_INTERVAL_INDEX_STACK_MAX],
+			frame;
+    bl_interval_t       *intervals;
+    int64_t             n,
+			i,
+			i_end,
+			left;
+    size_t              count = 0,
+			offset;
+    int                 top = 0;
+    int32_t             id;
+
+    if ( ! index->built )
+    {
+	fputs("bl_interval_index_query(): Index not built.\n", stderr);
+	return 0;
+    }
+    id = bl_chrom_dict_lookup(&index->dict, chrom);
+    if ( (id == BL_CHROM_ID_NONE) || (index->chrom_levels[id] < 0) )
+	return 0;
+    offset = index->chrom_offsets[id];
+    intervals = index->intervals + offset;
+    n = index->chrom_counts[id];
+
+    stack[top].k = index->chrom_levels[id];
+    stack[top].x = ((int64_t)1 << stack[top].k) - 1;
+    stack[top++].w = 0;
+    while ( top > 0 )
+    {
+	frame = stack[--top];
+	if ( frame.k <= BL_INTERVAL_INDEX_SCAN_LEVEL )
+	{
+	    // Scan the whole subtree in order
+	    i = frame.x >> frame.k << frame.k;
+	    i_end = i + ((int64_t)1 << (frame.k + 1)) - 1;
+	    if ( i_end > n )
+		i_end = n;
+	    for (; (i < i_end) && (intervals[i].start <= end); ++i)
+		if ( start <= intervals[i].end )
+		    bl_interval_index_add_hit(hits, hits_array_size, count++,
+					      offset + i);
+	}
+	else if ( frame.w == 0 )
+	{
+	    // Revisit this node after its left subtree, if needed
+	    left = frame.x - ((int64_t)1 << (frame.k - 1));
+	    stack[top].k = frame.k;
+	    stack[top].x = frame.x;
+	    stack[top++].w = 1;
+	    if ( (left >= n) || (intervals[left].max_end >= start) )
+	    {
+		stack[top].k = frame.k - 1;
+		stack[top].x = left;
+		stack[top++].w = 0;
+	    }
+	}
+	else if ( (frame.x < n) && (intervals[frame.x].start <= end) )
+	{
+	    if ( start <= intervals[frame.x].end )
+		bl_interval_index_add_hit(hits, hits_array_size, count++,
+					  offset + frame.x);
+	    stack[top].k = frame.k - 1;
+	    stack[top].x = frame.x + ((int64_t)1 << (frame.k - 1));
+	    stack[top++].w = 0;
+	}
+    }
+    return count;
+}
+
+
+/***************************************************************************
+ *  Name:
+ *      bl_interval_index_add_hit() - Append to a query result array
+ *
+ *  Library:
+ *      #include <biolibc/interval-index.h>
+ *      -lbiolibc -lxtend
+ *
+ *  Description:
+ *      Store hit at position c of *hits, doubling the array if it is
+ *      full.  This is used internally by bl_interval_index_query(3).
+ *
+ *  Arguments:
+ *      hits            Address of a pointer to an array of hits
+ *      hits_array_size Address of the allocated size of *hits
+ *      c               Position to store hit
+ *      hit             Value to store
+ *
+ *  See also:
+ *      bl_interval_index_query(3)
+ *
+ *  History:
+ *  Date        Name        Modification
+ *  2026-10-17  agent       Begin
+ ***************************************************************************/
+
+void    bl_interval_index_add_hit(size_t **hits, size_t *hits_array_size,
+				  size_t c, size_t hit)
+
+{
+    if ( c == *hits_array_size )
+    {
+	*hits_array_size = *hits_array_size == 0 ? 64 : *hits_array_size * 2;
+	if ( (*hits = xt_realloc(*hits, *hits_array_size,
+				 sizeof(**hits))) == NULL )
+	{
+	    fprintf(stderr, "bl_interval_index_add_hit(): Could not allocate hits.\n");
+	    exit(EX_UNAVAILABLE);
+	}
+    }
+    (*hits)[c] = hit;
+}
@@ -0,0 +1,110 @@
+#ifndef _BIOLIBC_INTERVAL_INDEX_H_
+#define _BIOLIBC_INTERVAL_INDEX_H_
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+#ifndef __bool_true_false_are_defined
+#include <stdbool.h>
+#endif
+
+#ifndef _BIOLIBC_H_
+#include "biolibc.h"
+#endif
+
+#ifndef _BIOLIBC_CHROM_DICT_H_
+#include "chrom-dict.h"
+#endif
+
+#ifndef _BIOLIBC_BED_H_
+#include "bed.h"
+#endif
+
+#ifndef _BIOLIBC_GFF3_H_
+#include "gff3.h"
+#endif
+
+/*
+ *  Static overlap index over features of any number of chromosomes.
+ *  Intervals are sorted by chromosome and start into one flat array and
+ *  each chromosome's run is treated as an implicit binary tree in
+ *  in-order layout: the node at index i of level k has children at
+ *  i -/+ 2^(k-1), so no pointers are stored.  max_end holds the largest
+ *  end in each node's subtree, letting queries skip subtrees ending
+ *  before the query starts.  A query costs O(log n + hits).
+ *
+ *  Coordinates are 1-based and inclusive, as in GFF3 and SAM.  BED
+ *  features are converted when added.
+ */
+
+#define BL_INTERVAL_INDEX_START_SIZE    1024
+
+// Subtrees of at most 2^(k+1) - 1 nodes are scanned linearly
+#define BL_INTERVAL_INDEX_SCAN_LEVEL    3
+
+// Deeper than any tree over 2^63 intervals
+#define BL_INTERVAL_INDEX_STACK_MAX     64
+
+#define BL_INTERVAL_INDEX_OK            0
+#define BL_INTERVAL_INDEX_MALLOC_FAILED -1
+#define BL_INTERVAL_INDEX_BAD_DATA      -2
+
+typedef struct
+{
+    int64_t     start,
+		end,
+		max_end;        // Largest end in subtree
+    int32_t     chrom_id;
+    size_t      value;          // Caller's data, e.g. a feature array index
+}   bl_interval_t;
+
+#define BL_INTERVAL_START(ptr)  ((ptr)->start)
+#define BL_INTERVAL_END(ptr)    ((ptr)->end)
+#define BL_INTERVAL_VALUE(ptr)  ((ptr)->value)
+
+// Query stack frame: node x at level k, left child visited if w
+typedef struct
+{
+    int64_t     x;
+    int         k,
+		w;
+}   bl_interval_frame_t;
+
+typedef struct
+{
+    bl_chrom_dict_t dict;
+    bl_interval_t   *intervals;
+    size_t          count,
+		    array_size;
+    int32_t         last_chrom_id;
+
+    // Per chromosome ID, set by bl_interval_index_build()
+    size_t          *chrom_offsets,
+		    *chrom_counts;
+    int             *chrom_levels;  // Level of root, -1 if empty
+    size_t          chrom_array_size;
+    bool            built;
+}   bl_interval_index_t;
+
+#include "interval-index-rvs.h"
+#include "interval-index-accessors.h"
+#include "interval-index-mutators.h"
+
+/* interval-index.c */
+void bl_interval_index_init(bl_interval_index_t *index);
+void bl_interval_index_free(bl_interval_index_t *index);
+int bl_interval_index_add(bl_interval_index_t *index, const char *chrom, int64_t start, int64_t end, size_t value);
+int bl_interval_index_add_bed(bl_interval_index_t *index, bl_bed_t *bed_feature, size_t value);
+int bl_interval_index_add_gff3(bl_interval_index_t *index, bl_gff3_t *gff3_feature, size_t value);
+int bl_interval_cmp(const bl_interval_t *interval1, const bl_interval_t *interval2);
+int bl_interval_index_build(bl_interval_index_t *index);
+int bl_interval_index_augment(bl_interval_t *intervals, size_t n);
+size_t bl_interval_index_query(bl_interval_index_t *index, const char *chrom, int64_t start, int64_t end, size_t **hits, size_t *hits_array_size);
+void bl_interval_index_add_hit(size_t **hits, size_t *hits_array_size, size_t c, size_t hit);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif // _BIOLIBC_INTERVAL_INDEX_H_
@@ -0,0 +1,27 @@
+    
+/*
+ *  Generated by /usr/local/bin/auto-gen-get-set
+ *
+ *  Accessor macros.  Use these to access structure members from functions
+ *  outside the bl_pileup_t class.
+ *
+ *  These generated macros are not expected to be perfect.  Check and edit
+ *  as needed before adding to your code.
+ */
+
+#define BL_PILEUP_CHROM_DICT(ptr)       ((ptr)->chrom_dict)
+#define BL_PILEUP_CHROM(ptr)            ((ptr)->chrom)
+#define BL_PILEUP_CHROM_AE(ptr,c)       ((ptr)->chrom[c])
+#define BL_PILEUP_CHROM_ID(ptr)         ((ptr)->chrom_id)
+#define BL_PILEUP_POS(ptr)              ((ptr)->pos)
+#define BL_PILEUP_READ_COUNT(ptr)       ((ptr)->read_count)
+#define BL_PILEUP_BASES(ptr)            ((ptr)->bases)
+#define BL_PILEUP_BASES_AE(ptr,c)       ((ptr)->bases[c])
+#define BL_PILEUP_QUALS(ptr)            ((ptr)->quals)
+#define BL_PILEUP_QUALS_AE(ptr,c)       ((ptr)->quals[c])
+#define BL_PILEUP_ALIGNMENTS(ptr)       ((ptr)->alignments)
+#define BL_PILEUP_ALIGNMENTS_AE(ptr,c)  ((ptr)->alignments[c])
+#define BL_PILEUP_QUERY_POSITIONS(ptr)  ((ptr)->query_positions)
+#define BL_PILEUP_QUERY_POSITIONS_AE(ptr,c) ((ptr)->query_positions[c])
+#define BL_PILEUP_DEPTH(ptr)            ((ptr)->depth)
+#define BL_PILEUP_DELETIONS(ptr)        ((ptr)->deletions)
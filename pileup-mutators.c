@@ -0,0 +1,1126 @@
+/***************************************************************************
+ *  This file is automatically generated by gen-get-set.  Be sure to keep
+ *  track of any manual changes.
+ *
+ *  These generated functions are not expected to be perfect.  Check and
+ *  edit as needed before adding to your code.
+ ***************************************************************************/
+
+#include <string.h>
+#include <ctype.h>
+#include <stdbool.h>        // In case of bool
+#include <stdint.h>         // In case of int64_t, etc
+#include <xtend/string.h>   // strlcpy() on Linux
+#include "pileup.h"
+
+
+/***************************************************************************
+ *  Library:
+ *      #include <biolibc/pileup.h>
+ *      -lbiolibc -lxtend
+ *
+ *  Description:
+ *      Mutator for chrom_dict member in a bl_pileup_t structure.
+ *      Use this function to set chrom_dict in a bl_pileup_t object
+ *      from non-member functions.  This function performs a direct
+ *      assignment for scalar or pointer structure members.  If
+ *      chrom_dict is a pointer, data previously pointed to should
+ *      be freed before calling this function to avoid memory
+ *      leaks.
+ *
+ *  Arguments:
+ *      bl_pileup_ptr   Pointer to the structure to set
+ *      new_chrom_dict  The new value for chrom_dict
+ *
+ *  Returns:
+ *      BL_PILEUP_DATA_OK if the new value is acceptable and assigned
+ *      BL_PILEUP_DATA_OUT_OF_RANGE otherwise
+ *
+ *  Examples:
+ *      bl_pileup_t     bl_pileup;
+ *      bl_chrom_dict_t *      new_chrom_dict;
+ *
+ *      if ( bl_pileup_set_chrom_dict(&bl_pileup, new_chrom_dict)
+ *              == BL_PILEUP_DATA_OK )
+ *      {
+ *      }
+ *
+ *  See also:
+ *      (3)
+ *
+ *  History: 
+ *  Date        Name        Modification
+ *  2026-10-17  gen-get-set Auto-generated from pileup.h
+ ***************************************************************************/
+
+int     bl_pileup_set_chrom_dict(
+	    bl_pileup_t *bl_pileup_ptr,
+	    bl_chrom_dict_t *new_chrom_dict
+	)
+
+{
+    if ( new_chrom_dict == NULL )
+	return BL_PILEUP_DATA_OUT_OF_RANGE;
+    else
+    {
+	bl_pileup_ptr->chrom_dict = new_chrom_dict;
+	return BL_PILEUP_DATA_OK;
+    }
+}
+
+
+/***************************************************************************
+ *  Library:
+ *      #include <biolibc/pileup.h>
+ *      -lbiolibc -lxtend
+ *
+ *  Description:
+ *      Mutator for an array element of chrom member in a bl_pileup_t
+ *      structure. Use this function to set bl_pileup_ptr->chrom[c]
+ *      in a bl_pileup_t object from non-member functions.
+ *
+ *  Arguments:
+ *      bl_pileup_ptr   Pointer to the structure to set
+ *      c               Subscript to the chrom array
+ *      new_chrom_element The new value for chrom[c]
+ *
+ *  Returns:
+ *      BL_PILEUP_DATA_OK if the new value is acceptable and assigned
+ *      BL_PILEUP_DATA_OUT_OF_RANGE otherwise
+ *
+ *  Examples:
+ *      bl_pileup_t     bl_pileup;
+ *      size_t          c;
+ *      char            new_chrom_element;
+ *
+ *      if ( bl_pileup_set_chrom_ae(&bl_pileup, c, new_chrom_element)
+ *              == BL_PILEUP_DATA_OK )
+ *      {
+ *      }
+ *
+ *  See also:
+ *      BL_PILEUP_SET_CHROM_AE(3)
+ *
+ *  History: 
+ *  Date        Name        Modification
+ *  2026-10-17  gen-get-set Auto-generated from pileup.h
+ ***************************************************************************/
+
+int     bl_pileup_set_chrom_ae(
+	    bl_pileup_t *bl_pileup_ptr,
+	    size_t c,
+	    char new_chrom_element
+	)
+
+{
+    if ( false )
+	return BL_PILEUP_DATA_OUT_OF_RANGE;
+    else
+    {
+	bl_pileup_ptr->chrom[c] = new_chrom_element;
+	return BL_PILEUP_DATA_OK;
+    }
+}
+
+
+/***************************************************************************
+ *  Library:
+ *      #include <biolibc/pileup.h>
+ *      -lbiolibc -lxtend
+ *
+ *  Description:
+ *      Mutator for chrom member in a bl_pileup_t structure.
+ *      Use this function to set chrom in a bl_pileup_t object
+ *      from non-member functions.  This function copies the array pointed to
+ *      by new_chrom to bl_pileup_ptr->chrom.
+ *
+ *  Arguments:
+ *      bl_pileup_ptr   Pointer to the structure to set
+ *      new_chrom       The new value for chrom
+ *      array_size      Size of the chrom array.
+ *
+ *  Returns:
+ *      BL_PILEUP_DATA_OK if the new value is acceptable and assigned
+ *      BL_PILEUP_DATA_OUT_OF_RANGE otherwise
+ *
+ *  Examples:
+ *      bl_pileup_t     bl_pileup;
+ *      char *          new_chrom;
+ *      size_t          array_size;
+ *
+ *      if ( bl_pileup_set_chrom_cpy(&bl_pileup, new_chrom, array_size)
+ *              == BL_PILEUP_DATA_OK )
+ *      {
+ *      }
+ *
+ *  See also:
+ *      BL_PILEUP_SET_CHROM(3)
+ *
+ *  History: 
+ *  Date        Name        Modification
+ *  2026-10-17  gen-get-set Auto-generated from pileup.h
+ ***************************************************************************/
+
+int     bl_pileup_set_chrom_cpy(
+	    bl_pileup_t *bl_pileup_ptr,
+	    char *new_chrom,
+	    size_t array_size
+	)
+
+{
+    if ( new_chrom == NULL )
+	return BL_PILEUP_DATA_OUT_OF_RANGE;
+    else
+    {
+	// FIXME: Assuming char array is a null-terminated string
+	strlcpy(bl_pileup_ptr->chrom, new_chrom, array_size);
+	return BL_PILEUP_DATA_OK;
+    }
+}
+
+
+/***************************************************************************
+ *  Library:
+ *      #include <biolibc/pileup.h>
+ *      -lbiolibc -lxtend
+ *
+ *  Description:
+ *      Mutator for chrom_id member in a bl_pileup_t structure.
+ *      Use this function to set chrom_id in a bl_pileup_t object
+ *      from non-member functions.  This function performs a direct
+ *      assignment for scalar or pointer structure members.  If
+ *      chrom_id is a pointer, data previously pointed to should
+ *      be freed before calling this function to avoid memory
+ *      leaks.
+ *
+ *  Arguments:
+ *      bl_pileup_ptr   Pointer to the structure to set
+ *      new_chrom_id    The new value for chrom_id
+ *
+ *  Returns:
+ *      BL_PILEUP_DATA_OK if the new value is acceptable and assigned
+ *      BL_PILEUP_DATA_OUT_OF_RANGE otherwise
+ *
+ *  Examples:
+ *      bl_pileup_t     bl_pileup;
+ *      int32_t         new_chrom_id;
+ *
+ *      if ( bl_pileup_set_chrom_id(&bl_pileup, new_chrom_id)
+ *              == BL_PILEUP_DATA_OK )
+ *      {
+ *      }
+ *
+ *  See also:
+ *      (3)
+ *
+ *  History: 
+ *  Date        Name        Modification
+ *  2026-10-17  gen-get-set Auto-generated from pileup.h
+ ***************************************************************************/
+
+int     bl_pileup_set_chrom_id(
+	    bl_pileup_t *bl_pileup_ptr,
+	    int32_t new_chrom_id
+	)
+
+{
+    if ( false )
+	return BL_PILEUP_DATA_OUT_OF_RANGE;
+    else
+    {
+	bl_pileup_ptr->chrom_id = new_chrom_id;
+	return BL_PILEUP_DATA_OK;
+    }
+}
+
+
+/***************************************************************************
+ *  Library:
+ *      #include <biolibc/pileup.h>
+ *      -lbiolibc -lxtend
+ *
+ *  Description:
+ *      Mutator for pos member in a bl_pileup_t structure.
+ *      Use this function to set pos in a bl_pileup_t object
+ *      from non-member functions.  This function performs a direct
+ *      assignment for scalar or pointer structure members.  If
+ *      pos is a pointer, data previously pointed to should
+ *      be freed before calling this function to avoid memory
+ *      leaks.
+ *
+ *  Arguments:
+ *      bl_pileup_ptr   Pointer to the structure to set
+ *      new_pos         The new value for pos
+ *
+ *  Returns:
+ *      BL_PILEUP_DATA_OK if the new value is acceptable and assigned
+ *      BL_PILEUP_DATA_OUT_OF_RANGE otherwise
+ *
+ *  Examples:
+ *      bl_pileup_t     bl_pileup;
+ *      int64_t         new_pos;
+ *
+ *      if ( bl_pileup_set_pos(&bl_pileup, new_pos)
+ *              == BL_PILEUP_DATA_OK )
+ *      {
+ *      }
+ *
+ *  See also:
+ *      (3)
+ *
+ *  History: 
+ *  Date        Name        Modification
+ *  2026-10-17  gen-get-set Auto-generated from pileup.h
+ ***************************************************************************/
+
+int     bl_pileup_set_pos(
+	    bl_pileup_t *bl_pileup_ptr,
+	    int64_t new_pos
+	)
+
+{
+    if ( false )
+	return BL_PILEUP_DATA_OUT_OF_RANGE;
+    else
+    {
+	bl_pileup_ptr->pos = new_pos;
+	return BL_PILEUP_DATA_OK;
+    }
+}
+
+
+/***************************************************************************
+ *  Library:
+ *      #include <biolibc/pileup.h>
+ *      -lbiolibc -lxtend
+ *
+ *  Description:
+ *      Mutator for read_count member in a bl_pileup_t structure.
+ *      Use this function to set read_count in a bl_pileup_t object
+ *      from non-member functions.  This function performs a direct
+ *      assignment for scalar or pointer structure members.  If
+ *      read_count is a pointer, data previously pointed to should
+ *      be freed before calling this function to avoid memory
+ *      leaks.
+ *
+ *  Arguments:
+ *      bl_pileup_ptr   Pointer to the structure to set
+ *      new_read_count  The new value for read_count
+ *
+ *  Returns:
+ *      BL_PILEUP_DATA_OK if the new value is acceptable and assigned
+ *      BL_PILEUP_DATA_OUT_OF_RANGE otherwise
+ *
+ *  Examples:
+ *      bl_pileup_t     bl_pileup;
+ *      size_t          new_read_count;
+ *
+ *      if ( bl_pileup_set_read_count(&bl_pileup, new_read_count)
+ *              == BL_PILEUP_DATA_OK )
+ *      {
+ *      }
+ *
+ *  See also:
+ *      (3)
+ *
+ *  History: 
+ *  Date        Name        Modification
+ *  2026-10-17  gen-get-set Auto-generated from pileup.h
+ ***************************************************************************/
+
+int     bl_pileup_set_read_count(
+	    bl_pileup_t *bl_pileup_ptr,
+	    size_t new_read_count
+	)
+
+{
+    if ( false )
+	return BL_PILEUP_DATA_OUT_OF_RANGE;
+    else
+    {
+	bl_pileup_ptr->read_count = new_read_count;
+	return BL_PILEUP_DATA_OK;
+    }
+}
+
+
+/***************************************************************************
+ *  Library:
+ *      #include <biolibc/pileup.h>
+ *      -lbiolibc -lxtend
+ *
+ *  Description:
+ *      Mutator for bases member in a bl_pileup_t structure.
+ *      Use this function to set bases in a bl_pileup_t object
+ *      from non-member functions.  This function performs a direct
+ *      assignment for scalar or pointer structure members.  If
+ *      bases is a pointer, data previously pointed to should
+ *      be freed before calling this function to avoid memory
+ *      leaks.
+ *
+ *  Arguments:
+ *      bl_pileup_ptr   Pointer to the structure to set
+ *      new_bases       The new value for bases
+ *
+ *  Returns:
+ *      BL_PILEUP_DATA_OK if the new value is acceptable and assigned
+ *      BL_PILEUP_DATA_OUT_OF_RANGE otherwise
+ *
+ *  Examples:
+ *      bl_pileup_t     bl_pileup;
+ *      char *          new_bases;
+ *
+ *      if ( bl_pileup_set_bases(&bl_pileup, new_bases)
+ *              == BL_PILEUP_DATA_OK )
+ *      {
+ *      }
+ *
+ *  See also:
+ *      (3)
+ *
+ *  History: 
+ *  Date        Name        Modification
+ *  2026-10-17  gen-get-set Auto-generated from pileup.h
+ ***************************************************************************/
+
+int     bl_pileup_set_bases(
+	    bl_pileup_t *bl_pileup_ptr,
+	    char *new_bases
+	)
+
+{
+    if ( new_bases == NULL )
+	return BL_PILEUP_DATA_OUT_OF_RANGE;
+    else
+    {
+	bl_pileup_ptr->bases = new_bases;
+	return BL_PILEUP_DATA_OK;
+    }
+}
+
+
+/***************************************************************************
+ *  Library:
+ *      #include <biolibc/pileup.h>
+ *      -lbiolibc -lxtend
+ *
+ *  Description:
+ *      Mutator for an array element of bases member in a bl_pileup_t
+ *      structure. Use this function to set bl_pileup_ptr->bases[c]
+ *      in a bl_pileup_t object from non-member functions.
+ *
+ *  Arguments:
+ *      bl_pileup_ptr   Pointer to the structure to set
+ *      c               Subscript to the bases array
+ *      new_bases_element The new value for bases[c]
+ *
+ *  Returns:
+ *      BL_PILEUP_DATA_OK if the new value is acceptable and assigned
+ *      BL_PILEUP_DATA_OUT_OF_RANGE otherwise
+ *
+ *  Examples:
+ *      bl_pileup_t     bl_pileup;
+ *      size_t          c;
+ *      char            new_bases_element;
+ *
+ *      if ( bl_pileup_set_bases_ae(&bl_pileup, c, new_bases_element)
+ *              == BL_PILEUP_DATA_OK )
+ *      {
+ *      }
+ *
+ *  See also:
+ *      BL_PILEUP_SET_BASES_AE(3)
+ *
+ *  History: 
+ *  Date        Name        Modification
+ *  2026-10-17  gen-get-set Auto-generated from pileup.h
+ ***************************************************************************/
+
+int     bl_pileup_set_bases_ae(
+	    bl_pileup_t *bl_pileup_ptr,
+	    size_t c,
+	    char new_bases_element
+	)
+
+{
+    if ( false )
+	return BL_PILEUP_DATA_OUT_OF_RANGE;
+    else
+    {
+	bl_pileup_ptr->bases[c] = new_bases_element;
+	return BL_PILEUP_DATA_OK;
+    }
+}
+
+
+/***************************************************************************
+ *  Library:
+ *      #include <biolibc/pileup.h>
+ *      -lbiolibc -lxtend
+ *
+ *  Description:
+ *      Mutator for bases member in a bl_pileup_t structure.
+ *      Use this function to set bases in a bl_pileup_t object
+ *      from non-member functions.  This function copies the array pointed to
+ *      by new_bases to bl_pileup_ptr->bases.
+ *
+ *  Arguments:
+ *      bl_pileup_ptr   Pointer to the structure to set
+ *      new_bases       The new value for bases
+ *      array_size      Size of the bases array.
+ *
+ *  Returns:
+ *      BL_PILEUP_DATA_OK if the new value is acceptable and assigned
+ *      BL_PILEUP_DATA_OUT_OF_RANGE otherwise
+ *
+ *  Examples:
+ *      bl_pileup_t     bl_pileup;
+ *      char *          new_bases;
+ *      size_t          array_size;
+ *
+ *      if ( bl_pileup_set_bases_cpy(&bl_pileup, new_bases, array_size)
+ *              == BL_PILEUP_DATA_OK )
+ *      {
+ *      }
+ *
+ *  See also:
+ *      BL_PILEUP_SET_BASES(3)
+ *
+ *  History: 
+ *  Date        Name        Modification
+ *  2026-10-17  gen-get-set Auto-generated from pileup.h
+ ***************************************************************************/
+
+int     bl_pileup_set_bases_cpy(
+	    bl_pileup_t *bl_pileup_ptr,
+	    char *new_bases,
+	    size_t array_size
+	)
+
+{
+    if ( new_bases == NULL )
+	return BL_PILEUP_DATA_OUT_OF_RANGE;
+    else
+    {
+	size_t  c;
+	
+	// FIXME: Assuming all elements should be copied
+	for (c = 0; c < array_size; ++c)
+	    bl_pileup_ptr->bases[c] = new_bases[c];
+	return BL_PILEUP_DATA_OK;
+    }
+}
+
+
+/***************************************************************************
+ *  Library:
+ *      #include <biolibc/pileup.h>
+ *      -lbiolibc -lxtend
+ *
+ *  Description:
+ *      Mutator for quals member in a bl_pileup_t structure.
+ *      Use this function to set quals in a bl_pileup_t object
+ *      from non-member functions.  This function performs a direct
+ *      assignment for scalar or pointer structure members.  If
+ *      quals is a pointer, data previously pointed to should
+ *      be freed before calling this function to avoid memory
+ *      leaks.
+ *
+ *  Arguments:
+ *      bl_pileup_ptr   Pointer to the structure to set
+ *      new_quals       The new value for quals
+ *
+ *  Returns:
+ *      BL_PILEUP_DATA_OK if the new value is acceptable and assigned
+ *      BL_PILEUP_DATA_OUT_OF_RANGE otherwise
+ *
+ *  Examples:
+ *      bl_pileup_t     bl_pileup;
+ *      unsigned char *      new_quals;
+ *
+ *      if ( bl_pileup_set_quals(&bl_pileup, new_quals)
+ *              == BL_PILEUP_DATA_OK )
+ *      {
+ *      }
+ *
+ *  See also:
+ *      (3)
+ *
+ *  History: 
+ *  Date        Name        Modification
+ *  2026-10-17  gen-get-set Auto-generated from pileup.h
+ ***************************************************************************/
+
+int     bl_pileup_set_quals(
+	    bl_pileup_t *bl_pileup_ptr,
+	    unsigned char *new_quals
+	)
+
+{
+    if ( new_quals == NULL )
+	return BL_PILEUP_DATA_OUT_OF_RANGE;
+    else
+    {
+	bl_pileup_ptr->quals = new_quals;
+	return BL_PILEUP_DATA_OK;
+    }
+}
+
+
+/***************************************************************************
+ *  Library:
+ *      #include <biolibc/pileup.h>
+ *      -lbiolibc -lxtend
+ *
+ *  Description:
+ *      Mutator for an array element of quals member in a bl_pileup_t
+ *      structure. Use this function to set bl_pileup_ptr->quals[c]
+ *      in a bl_pileup_t object from non-member functions.
+ *
+ *  Arguments:
+ *      bl_pileup_ptr   Pointer to the structure to set
+ *      c               Subscript to the quals array
+ *      new_quals_element The new value for quals[c]
+ *
+ *  Returns:
+ *      BL_PILEUP_DATA_OK if the new value is acceptable and assigned
+ *      BL_PILEUP_DATA_OUT_OF_RANGE otherwise
+ *
+ *  Examples:
+ *      bl_pileup_t     bl_pileup;
+ *      size_t          c;
+ *      unsigned char   new_quals_element;
+ *
+ *      if ( bl_pileup_set_quals_ae(&bl_pileup, c, new_quals_element)
+ *              == BL_PILEUP_DATA_OK )
+ *      {
+ *      }
+ *
+ *  See also:
+ *      BL_PILEUP_SET_QUALS_AE(3)
+ *
+ *  History: 
+ *  Date        Name        Modification
+ *  2026-10-17  gen-get-set Auto-generated from pileup.h
+ ***************************************************************************/
+
+int     bl_pileup_set_quals_ae(
+	    bl_pileup_t *bl_pileup_ptr,
+	    size_t c,
+	    unsigned char new_quals_element
+	)
+
+{
+    if ( false )
+	return BL_PILEUP_DATA_OUT_OF_RANGE;
+    else
+    {
+	bl_pileup_ptr->quals[c] = new_quals_element;
+	return BL_PILEUP_DATA_OK;
+    }
+}
+
+
+/***************************************************************************
+ *  Library:
+ *      #include <biolibc/pileup.h>
+ *      -lbiolibc -lxtend
+ *
+ *  Description:
+ *      Mutator for quals member in a bl_pileup_t structure.
+ *      Use this function to set quals in a bl_pileup_t object
+ *      from non-member functions.  This function copies the array pointed to
+ *      by new_quals to bl_pileup_ptr->quals.
+ *
+ *  Arguments:
+ *      bl_pileup_ptr   Pointer to the structure to set
+ *      new_quals       The new value for quals
+ *      array_size      Size of the quals array.
+ *
+ *  Returns:
+ *      BL_PILEUP_DATA_OK if the new value is acceptable and assigned
+ *      BL_PILEUP_DATA_OUT_OF_RANGE otherwise
+ *
+ *  Examples:
+ *      bl_pileup_t     bl_pileup;
+ *      unsigned char *      new_quals;
+ *      size_t          array_size;
+ *
+ *      if ( bl_pileup_set_quals_cpy(&bl_pileup, new_quals, array_size)
+ *              == BL_PILEUP_DATA_OK )
+ *      {
+ *      }
+ *
+ *  See also:
+ *      BL_PILEUP_SET_QUALS(3)
+ *
+ *  History: 
+ *  Date        Name        Modification
+ *  2026-10-17  gen-get-set Auto-generated from pileup.h
+ ***************************************************************************/
+
+int     bl_pileup_set_quals_cpy(
+	    bl_pileup_t *bl_pileup_ptr,
+	    unsigned char *new_quals,
+	    size_t array_size
+	)
+
+{
+    if ( new_quals == NULL )
+	return BL_PILEUP_DATA_OUT_OF_RANGE;
+    else
+    {
+	size_t  c;
+	
+	// FIXME: Assuming all elements should be copied
+	for (c = 0; c < array_size; ++c)
+	    bl_pileup_ptr->quals[c] = new_quals[c];
+	return BL_PILEUP_DATA_OK;
+    }
+}
+
+
+/***************************************************************************
+ *  Library:
+ *      #include <biolibc/pileup.h>
+ *      -lbiolibc -lxtend
+ *
+ *  Description:
+ *      Mutator for alignments member in a bl_pileup_t structure.
+ *      Use this function to set alignments in a bl_pileup_t object
+ *      from non-member functions.  This function performs a direct
+ *      assignment for scalar or pointer structure members.  If
+ *      alignments is a pointer, data previously pointed to should
+ *      be freed before calling this function to avoid memory
+ *      leaks.
+ *
+ *  Arguments:
+ *      bl_pileup_ptr   Pointer to the structure to set
+ *      new_alignments  The new value for alignments
+ *
+ *  Returns:
+ *      BL_PILEUP_DATA_OK if the new value is acceptable and assigned
+ *      BL_PILEUP_DATA_OUT_OF_RANGE otherwise
+ *
+ *  Examples:
+ *      bl_pileup_t     bl_pileup;
+ *      bl_sam_t **      new_alignments;
+ *
+ *      if ( bl_pileup_set_alignments(&bl_pileup, new_alignments)
+ *              == BL_PILEUP_DATA_OK )
+ *      {
+ *      }
+ *
+ *  See also:
+ *      (3)
+ *
+ *  History: 
+ *  Date        Name        Modification
+ *  2026-10-17  gen-get-set Auto-generated from pileup.h
+ ***************************************************************************/
+
+int     bl_pileup_set_alignments(
+	    bl_pileup_t *bl_pileup_ptr,
+	    bl_sam_t **new_alignments
+	)
+
+{
+    if ( new_alignments == NULL )
+	return BL_PILEUP_DATA_OUT_OF_RANGE;
+    else
+    {
+	bl_pileup_ptr->alignments = new_alignments;
+	return BL_PILEUP_DATA_OK;
+    }
+}
+
+
+/***************************************************************************
+ *  Library:
+ *      #include <biolibc/pileup.h>
+ *      -lbiolibc -lxtend
+ *
+ *  Description:
+ *      Mutator for an array element of alignments member in a bl_pileup_t
+ *      structure. Use this function to set bl_pileup_ptr->alignments[c]
+ *      in a bl_pileup_t object from non-member functions.
+ *
+ *  Arguments:
+ *      bl_pileup_ptr   Pointer to the structure to set
+ *      c               Subscript to the alignments array
+ *      new_alignments_element The new value for alignments[c]
+ *
+ *  Returns:
+ *      BL_PILEUP_DATA_OK if the new value is acceptable and assigned
+ *      BL_PILEUP_DATA_OUT_OF_RANGE otherwise
+ *
+ *  Examples:
+ *      bl_pileup_t     bl_pileup;
+ *      size_t          c;
+ *      bl_sam_t *      new_alignments_element;
+ *
+ *      if ( bl_pileup_set_alignments_ae(&bl_pileup, c, new_alignments_element)
+ *              == BL_PILEUP_DATA_OK )
+ *      {
+ *      }
+ *
+ *  See also:
+ *      BL_PILEUP_SET_ALIGNMENTS_AE(3)
+ *
+ *  History: 
+ *  Date        Name        Modification
+ *  2026-10-17  gen-get-set Auto-generated from pileup.h
+ ***************************************************************************/
+
+int     bl_pileup_set_alignments_ae(
+	    bl_pileup_t *bl_pileup_ptr,
+	    size_t c,
+	    bl_sam_t *new_alignments_element
+	)
+
+{
+    if ( false )
+	return BL_PILEUP_DATA_OUT_OF_RANGE;
+    else
+    {
+	bl_pileup_ptr->alignments[c] = new_alignments_element;
+	return BL_PILEUP_DATA_OK;
+    }
+}
+
+
+/***************************************************************************
+ *  Library:
+ *      #include <biolibc/pileup.h>
+ *      -lbiolibc -lxtend
+ *
+ *  Description:
+ *      Mutator for alignments member in a bl_pileup_t structure.
+ *      Use this function to set alignments in a bl_pileup_t object
+ *      from non-member functions.  This function copies the array pointed to
+ *      by new_alignments to bl_pileup_ptr->alignments.
+ *
+ *  Arguments:
+ *      bl_pileup_ptr   Pointer to the structure to set
+ *      new_alignments  The new value for alignments
+ *      array_size      Size of the alignments array.
+ *
+ *  Returns:
+ *      BL_PILEUP_DATA_OK if the new value is acceptable and assigned
+ *      BL_PILEUP_DATA_OUT_OF_RANGE otherwise
+ *
+ *  Examples:
+ *      bl_pileup_t     bl_pileup;
+ *      bl_sam_t **      new_alignments;
+ *      size_t          array_size;
+ *
+ *      if ( bl_pileup_set_alignments_cpy(&bl_pileup, new_alignments, array_size)
+ *              == BL_PILEUP_DATA_OK )
+ *      {
+ *      }
+ *
+ *  See also:
+ *      BL_PILEUP_SET_ALIGNMENTS(3)
+ *
+ *  History: 
+ *  Date        Name        Modification
+ *  2026-10-17  gen-get-set Auto-generated from pileup.h
+ ***************************************************************************/
+
+int     bl_pileup_set_alignments_cpy(
+	    bl_pileup_t *bl_pileup_ptr,
+	    bl_sam_t **new_alignments,
+	    size_t array_size
+	)
+
+{
+    if ( new_alignments == NULL )
+	return BL_PILEUP_DATA_OUT_OF_RANGE;
+    else
+    {
+	size_t  c;
+	
+	// FIXME: Assuming all elements should be copied
+	for (c = 0; c < array_size; ++c)
+	    bl_pileup_ptr->alignments[c] = new_alignments[c];
+	return BL_PILEUP_DATA_OK;
+    }
+}
+
+
+/***************************************************************************
+ *  Library:
+ *      #include <biolibc/pileup.h>
+ *      -lbiolibc -lxtend
+ *
+ *  Description:
+ *      Mutator for query_positions member in a bl_pileup_t structure.
+ *      Use this function to set query_positions in a bl_pileup_t object
+ *      from non-member functions.  This function performs a direct
+ *      assignment for scalar or pointer structure members.  If
+ *      query_positions is a pointer, data previously pointed to should
+ *      be freed before calling this function to avoid memory
+ *      leaks.
+ *
+ *  Arguments:
+ *      bl_pileup_ptr   Pointer to the structure to set
+ *      new_query_positions The new value for query_positions
+ *
+ *  Returns:
+ *      BL_PILEUP_DATA_OK if the new value is acceptable and assigned
+ *      BL_PILEUP_DATA_OUT_OF_RANGE otherwise
+ *
+ *  Examples:
+ *      bl_pileup_t     bl_pileup;
+ *      int64_t *       new_query_positions;
+ *
+ *      if ( bl_pileup_set_query_positions(&bl_pileup, new_query_positions)
+ *              == BL_PILEUP_DATA_OK )
+ *      {
+ *      }
+ *
+ *  See also:
+ *      (3)
+ *
+ *  History: 
+ *  Date        Name        Modification
+ *  2026-10-17  gen-get-set Auto-generated from pileup.h
+ ***************************************************************************/
+
+int     bl_pileup_set_query_positions(
+	    bl_pileup_t *bl_pileup_ptr,
+	    int64_t *new_query_positions
+	)
+
+{
+    if ( new_query_positions == NULL )
+	return BL_PILEUP_DATA_OUT_OF_RANGE;
+    else
+    {
+	bl_pileup_ptr->query_positions = new_query_positions;
+	return BL_PILEUP_DATA_OK;
+    }
+}
+
+
+/***************************************************************************
+ *  Library:
+ *      #include <biolibc/pileup.h>
+ *      -lbiolibc -lxtend
+ *
+ *  Description:
+ *      Mutator for an array element of query_positions member in a bl_pileup_t
+ *      structure. Use this function to set bl_pileup_ptr->query_positions[c]
+ *      in a bl_pileup_t object from non-member functions.
+ *
+ *  Arguments:
+ *      bl_pileup_ptr   Pointer to the structure to set
+ *      c               Subscript to the query_positions array
+ *      new_query_positions_element The new value for query_positions[c]
+ *
+ *  Returns:
+ *      BL_PILEUP_DATA_OK if the new value is acceptable and assigned
+ *      BL_PILEUP_DATA_OUT_OF_RANGE otherwise
+ *
+ *  Examples:
+ *      bl_pileup_t     bl_pileup;
+ *      size_t          c;
+ *      int64_t         new_query_positions_element;
+ *
+ *      if ( bl_pileup_set_query_positions_ae(&bl_pileup, c, new_query_positions_element)
+ *              == BL_PILEUP_DATA_OK )
+ *      {
+ *      }
+ *
+ *  See also:
+ *      BL_PILEUP_SET_QUERY_POSITIONS_AE(3)
+ *
+ *  History: 
+ *  Date        Name        Modification
+ *  2026-10-17  gen-get-set Auto-generated from pileup.h
+ ***************************************************************************/
+
+int     bl_pileup_set_query_positions_ae(
+	    bl_pileup_t *bl_pileup_ptr,
+	    size_t c,
+	    int64_t new_query_positions_element
+	)
+
+{
+    if ( false )
+	return BL_PILEUP_DATA_OUT_OF_RANGE;
+    else
+    {
+	bl_pileup_ptr->query_positions[c] = new_query_positions_element;
+	return BL_PILEUP_DATA_OK;
+    }
+}
+
+
+/***************************************************************************
+ *  Library:
+ *      #include <biolibc/pileup.h>
+ *      -lbiolibc -lxtend
+ *
+ *  Description:
+ *      Mutator for query_positions member in a bl_pileup_t structure.
+ *      Use this function to set query_positions in a bl_pileup_t object
+ *      from non-member functions.  This function copies the array pointed to
+ *      by new_query_positions to bl_pileup_ptr->query_positions.
+ *
+ *  Arguments:
+ *      bl_pileup_ptr   Pointer to the structure to set
+ *      new_query_positions The new value for query_positions
+ *      array_size      Size of the query_positions array.
+ *
+ *  Returns:
+ *      BL_PILEUP_DATA_OK if the new value is acceptable and assigned
+ *      BL_PILEUP_DATA_OUT_OF_RANGE otherwise
+ *
+ *  Examples:
+ *      bl_pileup_t     bl_pileup;
+ *      int64_t *       new_query_positions;
+ *      size_t          array_size;
+ *
+ *      if ( bl_pileup_set_query_positions_cpy(&bl_pileup, new_query_positions, array_size)
+ *              == BL_PILEUP_DATA_OK )
+ *      {
+ *      }
+ *
+ *  See also:
+ *      BL_PILEUP_SET_QUERY_POSITIONS(3)
+ *
+ *  History: 
+ *  Date        Name        Modification
+ *  2026-10-17  gen-get-set Auto-generated from pileup.h
+ ***************************************************************************/
+
+int     bl_pileup_set_query_positions_cpy(
+	    bl_pileup_t *bl_pileup_ptr,
+	    int64_t *new_query_positions,
+	    size_t array_size
+	)
+
+{
+    if ( new_query_positions == NULL )
+	return BL_PILEUP_DATA_OUT_OF_RANGE;
+    else
+    {
+	size_t  c;
+	
+	// FIXME: Assuming all elements should be copied
+	for (c = 0; c < array_size; ++c)
+	    bl_pileup_ptr->query_positions[c] = new_query_positions[c];
+	return BL_PILEUP_DATA_OK;
+    }
+}
+
+
+/***************************************************************************
+ *  Library:
+ *      #include <biolibc/pileup.h>
+ *      -lbiolibc -lxtend
+ *
+ *  Description:
+ *      Mutator for depth member in a bl_pileup_t structure.
+ *      Use this function to set depth in a bl_pileup_t object
+ *      from non-member functions.  This function performs a direct
+ *      assignment for scalar or pointer structure members.  If
+ *      depth is a pointer, data previously pointed to should
+ *      be freed before calling this function to avoid memory
+ *      leaks.
+ *
+ *  Arguments:
+ *      bl_pileup_ptr   Pointer to the structure to set
+ *      new_depth       The new value for depth
+ *
+ *  Returns:
+ *      BL_PILEUP_DATA_OK if the new value is acceptable and assigned
+ *      BL_PILEUP_DATA_OUT_OF_RANGE otherwise
+ *
+ *  Examples:
+ *      bl_pileup_t     bl_pileup;
+ *      size_t          new_depth;
+ *
+ *      if ( bl_pileup_set_depth(&bl_pileup, new_depth)
+ *              == BL_PILEUP_DATA_OK )
+ *      {
+ *      }
+ *
+ *  See also:
+ *      (3)
+ *
+ *  History: 
+ *  Date        Name        Modification
+ *  2026-10-17  gen-get-set Auto-generated from pileup.h
+ ***************************************************************************/
+
+int     bl_pileup_set_depth(
+	    bl_pileup_t *bl_pileup_ptr,
+	    size_t new_depth
+	)
+
+{
+    if ( false )
+	return BL_PILEUP_DATA_OUT_OF_RANGE;
+    else
+    {
+	bl_pileup_ptr->depth = new_depth;
+	return BL_PILEUP_DATA_OK;
+    }
+}
+
+
+/***************************************************************************
+ *  Library:
+ *      #include <biolibc/pileup.h>
+ *      -lbiolibc -lxtend
+ *
+ *  Description:
+ *      Mutator for deletions member in a bl_pileup_t structure.
+ *      Use this function to set deletions in a bl_pileup_t object
+ *      from non-member functions.  This function performs a direct
+ *      assignment for scalar or pointer structure members.  If
+ *      deletions is a pointer, data previously pointed to should
+ *      be freed before calling this function to avoid memory
+ *      leaks.
+ *
+ *  Arguments:
+ *      bl_pileup_ptr   Pointer to the structure to set
+ *      new_deletions   The new value for deletions
+ *
+ *  Returns:
+ *      BL_PILEUP_DATA_OK if the new value is acceptable and assigned
+ *      BL_PILEUP_DATA_OUT_OF_RANGE otherwise
+ *
+ *  Examples:
+ *      bl_pileup_t     bl_pileup;
+ *      size_t          new_deletions;
+ *
+ *      if ( bl_pileup_set_deletions(&bl_pileup, new_deletions)
+ *              == BL_PILEUP_DATA_OK )
+ *      {
+ *      }
+ *
+ *  See also:
+ *      (3)
+ *
+ *  History: 
+ *  Date        Name        Modification
+ *  2026-10-17  gen-get-set Auto-generated from pileup.h
+ ***************************************************************************/
+
+int     bl_pileup_set_deletions(
+	    bl_pileup_t *bl_pileup_ptr,
+	    size_t new_deletions
+	)
+
+{
+    if ( false )
+	return BL_PILEUP_DATA_OUT_OF_RANGE;
+    else
+    {
+	bl_pileup_ptr->deletions = new_deletions;
+	return BL_PILEUP_DATA_OK;
+    }
+}
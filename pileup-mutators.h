@@ -0,0 +1,36 @@
+
+/*
+ *  Generated by /usr/local/bin/auto-gen-get-set
+ *
+ *  Mutator functions for setting with no sanity checking.  Use these to
+ *  set structure members from functions outside the bl_pileup_t
+ *  class.  These macros perform no data validation.  Hence, they achieve
+ *  maximum performance where data are guaranteed correct by other means.
+ *  Use the mutator functions (same name as the macro, but lower case)
+ *  for more robust code with a small performance penalty.
+ *
+ *  These generated macros are not expected to be perfect.  Check and edit
+ *  as needed before adding to your code.
+ */
+
+/* temp-pileup-mutators.c */
+int bl_pileup_set_chrom_dict(bl_pileup_t *bl_pileup_ptr, bl_chrom_dict_t *new_chrom_dict);
+int bl_pileup_set_chrom_ae(bl_pileup_t *bl_pileup_ptr, size_t c, char new_chrom_element);
+int bl_pileup_set_chrom_cpy(bl_pileup_t *bl_pileup_ptr, char *new_chrom, size_t array_size);
+int bl_pileup_set_chrom_id(bl_pileup_t *bl_pileup_ptr, int32_t new_chrom_id);
+int bl_pileup_set_pos(bl_pileup_t *bl_pileup_ptr, int64_t new_pos);
+int bl_pileup_set_read_count(bl_pileup_t *bl_pileup_ptr, size_t new_read_count);
+int bl_pileup_set_bases(bl_pileup_t *bl_pileup_ptr, char *new_bases);
+int bl_pileup_set_bases_ae(bl_pileup_t *bl_pileup_ptr, size_t c, char new_bases_element);
+int bl_pileup_set_bases_cpy(bl_pileup_t *bl_pileup_ptr, char *new_bases, size_t array_size);
+int bl_pileup_set_quals(bl_pileup_t *bl_pileup_ptr, unsigned char *new_quals);
+int bl_pileup_set_quals_ae(bl_pileup_t *bl_pileup_ptr, size_t c, unsigned char new_quals_element);
+int bl_pileup_set_quals_cpy(bl_pileup_t *bl_pileup_ptr, unsigned char *new_quals, size_t array_size);
+int bl_pileup_set_alignments(bl_pileup_t *bl_pileup_ptr, bl_sam_t **new_alignments);
+int bl_pileup_set_alignments_ae(bl_pileup_t *bl_pileup_ptr, size_t c, bl_sam_t *new_alignments_element);
+int bl_pileup_set_alignments_cpy(bl_pileup_t *bl_pileup_ptr, bl_sam_t **new_alignments, size_t array_size);
+int bl_pileup_set_query_positions(bl_pileup_t *bl_pileup_ptr, int64_t *new_query_positions);
+int bl_pileup_set_query_positions_ae(bl_pileup_t *bl_pileup_ptr, size_t c, int64_t new_query_positions_element);
+int bl_pileup_set_query_positions_cpy(bl_pileup_t *bl_pileup_ptr, int64_t *new_query_positions, size_t array_size);
+int bl_pileup_set_depth(bl_pileup_t *bl_pileup_ptr, size_t new_depth);
+int bl_pileup_set_deletions(bl_pileup_t *bl_pileup_ptr, size_t new_deletions);
@@ -0,0 +1,529 @@
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <sysexits.h>
+#include <inttypes.h>
+#include <xtend/string.h>   // strlcpy() on Linux
+#include <xtend/mem.h>
+#include "pileup.h"
+
+/***************************************************************************
+ *  Name:
+ *      bl_pileup_init() - Initialize a pileup iterator
+ *
+ *  Library:
+ *      #include <biolibc/pileup.h>
+ *      -lbiolibc -lxtend
+ *
+ *  Description:
+ *      Initialize a bl_pileup_t iterator over the alignments of a SAM
+ *      stream sorted by chrom and position, positioned after the
+ *      header.  Alignments are held in sam_buff, which must have been
+ *      initialized by bl_sam_buff_init(3) and is used for nothing else
+ *      while the pileup is in use.  Unmapped alignments and those below
+ *      the MAPQ minimum of sam_buff are skipped, and counted in its
+ *      statistics.  sam_buff must be in the default
+ *      BL_SAM_BUFF_OVERFLOW_FAIL mode.
+ *
+ *      To give alignments a chromosome dictionary, set one with
+ *      bl_pileup_set_chrom_dict(3) before the first bl_pileup_next(3).
+ *
+ *  Arguments:
+ *      pileup      Pointer to the bl_pileup_t object to initialize
+ *      sam_buff    SAM buffer to hold alignments
+ *      sam_stream  Sorted SAM stream
+ *
+ *  Examples:
+ *      bl_pileup_t     pileup;
+ *      bl_sam_buff_t   sam_buff;
+ *
+ *      bl_sam_buff_init(&sam_buff, mapq_min, max_alignments);
+ *      bl_pileup_init(&pileup, &sam_buff, sam_stream);
+ *      while ( bl_pileup_next(&pileup) == BL_READ_OK )
+ *          printf("%s\t%" PRId64 "\t%zu\t%.*s\n", BL_PILEUP_CHROM(&pileup),
+ *                 BL_PILEUP_POS(&pileup), BL_PILEUP_DEPTH(&pileup),
+ *                 (int)BL_PILEUP_DEPTH(&pileup), BL_PILEUP_BASES(&pileup));
+ *      bl_pileup_free(&pileup);
+ *      bl_sam_buff_free(&sam_buff);
+ *
+ *  See also:
+ *      bl_pileup_next(3), bl_pileup_free(3), bl_sam_buff_init(3)
+ *
+ *  History:
+ *  Date        Name        Modification
+ *  2026-10-17  agent       Begin
+ ***************************************************************************/
+
+void    bl_pileup_init(bl_pileup_t *pileup, bl_sam_buff_t *sam_buff,
+		       FILE *sam_stream)
+
+{
+    pileup->sam_buff = sam_buff;
+    pileup->sam_stream = sam_stream;
+    pileup->chrom_dict = NULL;
+    pileup->next_alignment = NULL;
+    *pileup->chrom = '\0';
+    pileup->chrom_id = BL_CHROM_ID_NONE;
+    pileup->pos = 0;
+    pileup->started = false;
+    pileup->reads = NULL;
+    pileup->read_count = 0;
+    pileup->read_array_size = 0;
+    pileup->bases = NULL;
+    pileup->quals = NULL;
+    pileup->alignments = NULL;
+    pileup->query_positions = NULL;
+    pileup->depth = 0;
+    pileup->vector_array_size = 0;
+    pileup->deletions = 0;
+}
+
+
+/***************************************************************************
+ *  Name:
+ *      bl_pileup_free() - Free memory held by a pileup iterator
+ *
+ *  Library:
+ *      #include <biolibc/pileup.h>
+ *      -lbiolibc -lxtend
+ *
+ *  Description:
+ *      Free the cursors and vectors of a bl_pileup_t object.  The SAM
+ *      buffer and stream given to bl_pileup_init(3) are not freed.
+ *
+ *  Arguments:
+ *      pileup  Pointer to the bl_pileup_t object to free
+ *
+ *  See also:
+ *      bl_pileup_init(3)
+ *
+ *  History:
+ *  Date        Name        Modification
+ *  2026-10-17  agent       Begin
+ ***************************************************************************/
+
+void    bl_pileup_free(bl_pileup_t *pileup)
+
+{
+    free(pileup->reads);
+    free(pileup->bases);
+    free(pileup->quals);
+    free(pileup->alignments);
+    free(pileup->query_positions);
+    bl_pileup_init(pileup, pileup->sam_buff, pileup->sam_stream);
+}
+
+
+/***************************************************************************
+ *  Name:
+ *      bl_pileup_read_start() - Place a cursor at the start of an alignment
+ *
+ *  Library:
+ *      #include <biolibc/pileup.h>
+ *      -lbiolibc -lxtend
+ *
+ *  Description:
+ *      Initialize a pileup cursor at the first reference position of
+ *      an alignment, skipping leading clips and insertions.  An
+ *      alignment without a CIGAR is treated as an ungapped match of
+ *      its SEQ.  This is used internally by bl_pileup_next(3).
+ *
+ *  Arguments:
+ *      read        Pointer to the cursor to initialize
+ *      alignment   Alignment with CIGAR parsed by bl_sam_parse_cigar(3)
+ *
+ *  Returns:
+ *      true if the alignment covers at least one reference position
+ *      false otherwise
+ *
+ *  See also:
+ *      bl_pileup_read_advance(3), bl_pileup_read_seek(3)
+ *
+ *  History:
+ *  Date        Name        Modification
+ *  2026-10-17  agent       Begin
+ ***************************************************************************/
+
+bool    bl_pileup_read_start(bl_pileup_read_t *read, bl_sam_t *alignment)
+
+{
+    read->alignment = alignment;
+    read->op = 0;
+    read->query_pos = 0;
+    if ( BL_SAM_CIGAR_OP_COUNT(alignment) == 0 )
+    {
+	read->op_type = BL_SAM_CIGAR_MATCH;
+	read->op_left = BL_SAM_SEQ_LEN(alignment);
+	return read->op_left > 0;
+    }
+    return bl_pileup_read_seek(read);
+}
+
+
+/***************************************************************************
+ *  Name:
+ *      bl_pileup_read_seek() - Move a cursor to the next reference-consuming op
+ *
+ *  Library:
+ *      #include <biolibc/pileup.h>
+ *      -lbiolibc -lxtend
+ *
+ *  Description:
+ *      Starting with CIGAR op read->op, find the next op that consumes
+ *      reference bases (M, D, N, = or X), advancing the SEQ offset past
+ *      any insertions and soft clips on the way.  This is used
+ *      internally by bl_pileup_read_start(3) and bl_pileup_read_advance(3).
+ *
+ *  Arguments:
+ *      read    Pointer to the cursor
+ *
+ *  Returns:
+ *      true if such an op was found
+ *      false if the alignment has no more reference bases
+ *
+ *  See also:
+ *      bl_pileup_read_advance(3)
+ *
+ *  History:
+ *  Date        Name        Modification
+ *  2026-10-17  agent       Begin
+ ***************************************************************************/
+
+bool    bl_pileup_read_seek(bl_pileup_read_t *read)
+
+{
+    bl_sam_t    *alignment = read->alignment;
+    uint32_t    packed;
+
+    for (; read->op < BL_SAM_CIGAR_OP_COUNT(alignment); ++read->op)
+    {
+	packed = BL_SAM_CIGAR_OPS_AE(alignment, read->op);
+	read->op_type = BL_SAM_CIGAR_OP(packed);
+	read->op_left = BL_SAM_CIGAR_OP_LEN(packed);
+	if ( BL_SAM_CIGAR_CONSUMES_REF(read->op_type) )
+	{
+	    if ( read->op_left > 0 )
+		return true;
+	}
+	else if ( BL_SAM_CIGAR_CONSUMES_QUERY(read->op_type) )
+	    read->query_pos += read->op_left;
+    }
+    return false;
+}
+
+
+/***************************************************************************
+ *  Name:
+ *      bl_pileup_read_advance() - Move a cursor to the next reference position
+ *
+ *  Library:
+ *      #include <biolibc/pileup.h>
+ *      -lbiolibc -lxtend
+ *
+ *  Description:
+ *      Advance a pileup cursor by one reference position.  This takes
+ *      constant time except when crossing into a new CIGAR op.  This is
+ *      used internally by bl_pileup_next(3).
+ *
+ *  Arguments:
+ *      read    Pointer to the cursor
+ *
+ *  Returns:
+ *      true if the alignment covers the new position
+ *      false if the alignment ended at the previous position
+ *
+ *  See also:
+ *      bl_pileup_read_start(3), bl_pileup_next(3)
+ *
+ *  History:
+ *  Date        Name        Modification
+ *  2026-10-17  agent       Begin
+ ***************************************************************************/
+
+bool    bl_pileup_read_advance(bl_pileup_read_t *read)
+
+{
+    if ( BL_SAM_CIGAR_CONSUMES_QUERY(read->op_type) )
+	++read->query_pos;
+    if ( --read->op_left > 0 )
+	return true;
+    if ( BL_SAM_CIGAR_OP_COUNT(read->alignment) == 0 )
+	return false;
+    ++read->op;
+    return bl_pileup_read_seek(read);
+}
+
+
+/***************************************************************************
+ *  Name:
+ *      bl_pileup_fetch() - Read the next usable alignment for a pileup
+ *
+ *  Library:
+ *      #include <biolibc/pileup.h>
+ *      -lbiolibc -lxtend
+ *
+ *  Description:
+ *      Read alignments from the SAM stream of a pileup directly into
+ *      pooled SAM buffer slots until one passes
+ *      bl_sam_buff_alignment_ok(3), commit it to the buffer and make it
+ *      the next alignment to enter the pileup.  This is used internally
+ *      by bl_pileup_next(3).
+ *
+ *  Arguments:
+ *      pileup  Pointer to a bl_pileup_t object
+ *
+ *  Returns:
+ *      BL_READ_OK on success
+ *      BL_READ_EOF at the end of the SAM stream
+ *      BL_READ_OVERFLOW if the SAM buffer is full
+ *      Other errors from bl_sam_read(3)
+ *
+ *  See also:
+ *      bl_pileup_next(3)
+ *
+ *  History:
+ *  Date        Name        Modification
+ *  2026-10-17  agent       Begin
+ ***************************************************************************/
+
+int     bl_pileup_fetch(bl_pileup_t *pileup)
+
+{
+    bl_sam_buff_t   *sam_buff = pileup->sam_buff;
+    bl_sam_t        *alignment;
+    int             status;
+
+    do
+    {
+	alignment = bl_sam_buff_tail_slot(sam_buff);
+	alignment->chrom_dict = pileup->chrom_dict;
+	status = bl_sam_read(alignment, pileup->sam_stream, BL_SAM_FIELD_ALL);
+	if ( status != BL_READ_OK )
+	    return status;
+	BL_SAM_BUFF_INC_TOTAL_ALIGNMENTS(sam_buff);
+    }   while ( ! bl_sam_buff_alignment_ok(sam_buff, alignment) );
+
+    // Spilled alignments cannot be referenced by cursors
+    if ( (bl_sam_buff_commit_tail(sam_buff) != BL_SAM_BUFF_OK) ||
+	 (BL_SAM_BUFF_SPILL_COUNT(sam_buff) > 0) )
+    {
+	fprintf(stderr, "bl_pileup_fetch(): SAM buffer is full at %s:%" PRId64 ".\n",
+		BL_SAM_RNAME(alignment), BL_SAM_POS(alignment));
+	return BL_READ_OVERFLOW;
+    }
+    pileup->next_alignment = alignment;
+    return BL_READ_OK;
+}
+
+
+/***************************************************************************
+ *  Name:
+ *      bl_pileup_same_chrom() - Check whether an alignment is on the pileup chrom
+ *
+ *  Library:
+ *      #include <biolibc/pileup.h>
+ *      -lbiolibc -lxtend
+ *
+ *  Description:
+ *      Determine whether an alignment is on the current chromosome of
+ *      a pileup, comparing IDs if both use the pileup's chromosome
+ *      dictionary.  This is used internally by bl_pileup_next(3).
+ *
+ *  Arguments:
+ *      pileup      Pointer to a bl_pileup_t object
+ *      alignment   Pointer to an alignment
+ *
+ *  Returns:
+ *      true if alignment is on the current chromosome
+ *      false otherwise
+ *
+ *  See also:
+ *      bl_pileup_next(3)
+ *
+ *  History:
+ *  Date        Name        Modification
+ *  2026-10-17  agent       Begin
+ ***************************************************************************/
+
+bool    bl_pileup_same_chrom(bl_pileup_t *pileup, bl_sam_t *alignment)
+
+{
+    if ( BL_CHROM_IDS_COMPARABLE(pileup->chrom_dict, pileup->chrom_id,
+	    alignment->chrom_dict, alignment->rname_id) )
+	return pileup->chrom_id == alignment->rname_id;
+    else
+	return strcmp(pileup->chrom, BL_SAM_RNAME(alignment)) == 0;
+}
+
+
+/***************************************************************************
+ *  Name:
+ *      bl_pileup_next() - Advance a pileup to the next covered position
+ *
+ *  Library:
+ *      #include <biolibc/pileup.h>
+ *      -lbiolibc -lxtend
+ *
+ *  Description:
+ *      Move a pileup to the next reference position covered by at
+ *      least one usable alignment, skipping uncovered positions, and
+ *      fill in the per-position vectors.  For each alignment with a
+ *      base aligned to the position (CIGAR M, = or X), the vectors
+ *      hold:
+ *
+ *      bases[]             The SEQ character, or 'N' if SEQ is absent
+ *      quals[]             The QUAL character, or BL_PILEUP_QUAL_NONE
+ *      alignments[]        The alignment, for FLAG, MAPQ, etc.
+ *      query_positions[]   The 0-based offset of the base in SEQ
+ *
+ *      depth is the number of elements in each vector.  Alignments with
+ *      a deletion at the position are counted in deletions and have no
+ *      vector entry.  Those with a skipped region (N) are not reported.
+ *      Positions covered only by skipped regions are skipped.
+ *
+ *      Each active alignment keeps a cursor into its CIGAR, so advancing
+ *      costs O(1) per alignment instead of mapping each from its start.
+ *      Alignments enter the pileup at their start position and leave
+ *      after their last reference base, and their SAM buffer slots are
+ *      recycled once all older alignments have left.
+ *
+ *  Arguments:
+ *      pileup  Pointer to a bl_pileup_t object
+ *
+ *  Returns:
+ *      BL_READ_OK if a position was found
+ *      BL_READ_EOF when the SAM stream is exhausted
+ *      BL_READ_OVERFLOW or another error from bl_pileup_fetch(3)
+ *
+ *  See also:
+ *      bl_pileup_init(3), bl_pileup_read_advance(3)
+ *
+ *  History:
+ *  Date        Name        Modification
+ *  2026-10-17  agent       Begin
+ ***************************************************************************/
+
+int     bl_pileup_next(bl_pileup_t *pileup)
+
+{
+    bl_sam_buff_t       *sam_buff = pileup->sam_buff;
+    bl_sam_t            *alignment;
+    bl_pileup_read_t    *read;
+    size_t              c,
+			kept;
+    int                 status;
+
+    do
+    {
+	if ( pileup->started )
+	{
+	    // Move every cursor to the next position, dropping finished reads
+	    ++pileup->pos;
+	    for (c = kept = 0; c < pileup->read_count; ++c)
+		if ( bl_pileup_read_advance(&pileup->reads[c]) )
+		    pileup->reads[kept++] = pileup->reads[c];
+	    pileup->read_count = kept;
+
+	    // Recycle slots from the head of the buffer
+	    while ( (BL_SAM_BUFF_BUFFERED_COUNT(sam_buff) > 0) &&
+		    ((alignment = BL_SAM_BUFF_ALIGNMENTS_AE(sam_buff, 0))
+		     != pileup->next_alignment) &&
+		    ((BL_SAM_REF_END(alignment) < pileup->pos) ||
+		     ! bl_pileup_same_chrom(pileup, alignment)) )
+		bl_sam_buff_shift(sam_buff, 1);
+	}
+
+	// Jump over uncovered positions to the next alignment
+	if ( pileup->read_count == 0 )
+	{
+	    if ( (pileup->next_alignment == NULL) &&
+		 ((status = bl_pileup_fetch(pileup)) != BL_READ_OK) )
+		return status;
+	    alignment = pileup->next_alignment;
+	    strlcpy(pileup->chrom, BL_SAM_RNAME(alignment),
+		    BL_SAM_RNAME_MAX_CHARS + 1);
+	    pileup->chrom_id = BL_SAM_RNAME_ID(alignment);
+	    pileup->pos = BL_SAM_POS(alignment);
+	    pileup->started = true;
+	}
+
+	// Start cursors for alignments beginning here
+	for (;;)
+	{
+	    if ( pileup->next_alignment == NULL )
+	    {
+		status = bl_pileup_fetch(pileup);
+		if ( status == BL_READ_EOF )
+		    break;
+		else if ( status != BL_READ_OK )
+		    return status;
+	    }
+	    alignment = pileup->next_alignment;
+	    if ( (BL_SAM_POS(alignment) != pileup->pos) ||
+		 ! bl_pileup_same_chrom(pileup, alignment) )
+		break;
+
+	    if ( pileup->read_count == pileup->read_array_size )
+	    {
+		pileup->read_array_size = pileup->read_array_size == 0 ?
+		    BL_PILEUP_VECTOR_START_SIZE : pileup->read_array_size * 2;
+		pileup->reads = xt_realloc(pileup->reads,
+			pileup->read_array_size, sizeof(*pileup->reads));
+		if ( pileup->reads == NULL )
+		{
+		    fprintf(stderr, "bl_pileup_next(): Could not allocate reads.\n");
+		    exit(EX_UNAVAILABLE);
+		}
+	    }
+	    if ( bl_pileup_read_start(&pileup->reads[pileup->read_count],
+				      alignment) )
+		++pileup->read_count;
+	    pileup->next_alignment = NULL;
+	}
+
+	if ( pileup->vector_array_size < pileup->read_array_size )
+	{
+	    pileup->vector_array_size = pileup->read_array_size;
+	    pileup->bases = xt_realloc(pileup->bases,
+		    pileup->vector_array_size, sizeof(*pileup->bases));
+	    pileup->quals = xt_realloc(pileup->quals,
+		    pileup->vector_array_size, sizeof(*pileup->quals));
+	    pileup->alignments = xt_realloc(pileup->alignments,
+		    pileup->vector_array_size, sizeof(*pileup->alignments));
+	    pileup->query_positions = xt_realloc(pileup->query_positions,
+		    pileup->vector_array_size, sizeof(*pileup->query_positions));
+	    if ( (pileup->bases == NULL) || (pileup->quals == NULL) ||
+		 (pileup->alignments == NULL) ||
+		 (pileup->query_positions == NULL) )
+	    {
+		fprintf(stderr, "bl_pileup_next(): Could not allocate vectors.\n");
+		exit(EX_UNAVAILABLE);
+	    }
+	}
+
+	pileup->depth = 0;
+	pileup->deletions = 0;
+	for (c = 0; c < pileup->read_count; ++c)
+	{
+	    read = &pileup->reads[c];
+	    alignment = read->alignment;
+	    if ( BL_SAM_CIGAR_CONSUMES_QUERY(read->op_type) )
+	    {
+		pileup->bases[pileup->depth] =
+		    (size_t)read->query_pos < BL_SAM_SEQ_LEN(alignment) ?
+		    BL_SAM_SEQ_AE(alignment, read->query_pos) : 'N';
+		pileup->quals[pileup->depth] =
+		    (size_t)read->query_pos < BL_SAM_QUAL_LEN(alignment) ?
+		    BL_SAM_QUAL_AE(alignment, read->query_pos) :
+		    BL_PILEUP_QUAL_NONE;
+		pileup->alignments[pileup->depth] = alignment;
+		pileup->query_positions[pileup->depth] = read->query_pos;
+		++pileup->depth;
+	    }
+	    else if ( read->op_type == BL_SAM_CIGAR_DEL )
+		++pileup->deletions;
+	}
+    }   while ( (pileup->depth == 0) && (pileup->deletions == 0) );
+
+    return BL_READ_OK;
+}
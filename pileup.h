@@ -0,0 +1,89 @@
+#ifndef _BIOLIBC_PILEUP_H_
+#define _BIOLIBC_PILEUP_H_
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+#ifndef __bool_true_false_are_defined
+#include <stdbool.h>
+#endif
+
+#ifndef _BIOLIBC_H_
+#include "biolibc.h"
+#endif
+
+#ifndef _BIOLIBC_SAM_BUFF_H_
+#include "sam-buff.h"
+#endif
+
+/*
+ *  Per-position iteration over the read bases of a sorted SAM stream.
+ *  Alignments are read into the pooled slots of a bl_sam_buff_t, which
+ *  also applies its unmapped and MAPQ filters.  Each active alignment
+ *  has a cursor holding its current CIGAR operation and SEQ offset, so
+ *  moving to the next reference position costs O(1) per read rather
+ *  than a CIGAR walk.  The bases, quals, alignments and query_positions
+ *  vectors are parallel arrays of depth elements describing the
+ *  current position, rebuilt by each bl_pileup_next().
+ */
+
+// Quality reported for bases of alignments without QUAL
+#define BL_PILEUP_QUAL_NONE     0xff
+
+#define BL_PILEUP_VECTOR_START_SIZE 64
+
+typedef struct
+{
+    bl_sam_t    *alignment;
+    size_t      op;         // Index of current CIGAR op
+    uint32_t    op_left;    // Reference bases left in op, incl. current
+    unsigned    op_type;    // BL_SAM_CIGAR_* of current op
+    int64_t     query_pos;  // SEQ offset at current position, if consumed
+}   bl_pileup_read_t;
+
+typedef struct
+{
+    bl_sam_buff_t   *sam_buff;
+    FILE            *sam_stream;
+    bl_chrom_dict_t *chrom_dict;    // Optional, given to alignments read
+    bl_sam_t        *next_alignment;    // Read, but starts past pos
+    char            chrom[BL_SAM_RNAME_MAX_CHARS + 1];
+    int32_t         chrom_id;
+    int64_t         pos;
+    bool            started;
+
+    // Cursors of alignments covering pos, in order of start position
+    bl_pileup_read_t    *reads;
+    size_t          read_count,
+		    read_array_size;
+
+    // Parallel vectors for the current position
+    char            *bases;
+    unsigned char   *quals;
+    bl_sam_t        **alignments;
+    int64_t         *query_positions;
+    size_t          depth,
+		    vector_array_size,
+		    deletions;      // Alignments with a deletion at pos
+}   bl_pileup_t;
+
+#include "pileup-rvs.h"
+#include "pileup-accessors.h"
+#include "pileup-mutators.h"
+
+/* pileup.c */
+void bl_pileup_init(bl_pileup_t *pileup, bl_sam_buff_t *sam_buff, FILE *sam_stream);
+void bl_pileup_free(bl_pileup_t *pileup);
+bool bl_pileup_read_start(bl_pileup_read_t *read, bl_sam_t *alignment);
+bool bl_pileup_read_seek(bl_pileup_read_t *read);
+bool bl_pileup_read_advance(bl_pileup_read_t *read);
+int bl_pileup_fetch(bl_pileup_t *pileup);
+bool bl_pileup_same_chrom(bl_pileup_t *pileup, bl_sam_t *alignment);
+int bl_pileup_next(bl_pileup_t *pileup);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif // _BIOLIBC_PILEUP_H_
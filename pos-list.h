@@ -10,6 +10,10 @@
 #include <stdint.h>
 #endif
 
+#ifndef __bool_true_false_are_defined
+#include <stdbool.h>
+#endif
+
 #ifndef _BIOLIBC_H_
 #include "biolibc.h"
 #endif
@@ -28,6 +32,16 @@ typedef int bl_pos_list_sort_order_t;
 #define BL_POS_LIST_ASCENDING  0
 #define BL_POS_LIST_DESCENDING 1
 
+// Shorter lists are sorted by qsort(), which is faster for them
+#define BL_POS_LIST_RADIX_MIN   256
+
+// Map int64_t to uint64_t preserving order, for radix sort digits
+#define BL_POS_LIST_RADIX_KEY(p) \
+	((uint64_t)(p) ^ ((uint64_t)1 << 63))
+
+// Set operations gallop through a list this many times longer
+#define BL_POS_LIST_GALLOP_RATIO 16
+
 #include "pos-list-rvs.h"
 #include "pos-list-accessors.h"
 #include "pos-list-mutators.h"
@@ -40,5 +54,15 @@ int bl_pos_list_from_csv(bl_pos_list_t *pos_list, const char *bounds_str, size_t
 int position_cmp_ascending(const int64_t *pos1, const int64_t *pos2);
 int position_cmp_descending(const int64_t *pos1, const int64_t *pos2);
 void bl_pos_list_sort(bl_pos_list_t *pos_list, bl_pos_list_sort_order_t order);
+void bl_pos_list_radix_sort(bl_pos_list_t *pos_list, bl_pos_list_sort_order_t order);
+size_t bl_pos_list_dedup(bl_pos_list_t *pos_list);
+void bl_pos_list_reserve(bl_pos_list_t *pos_list, size_t array_size);
+size_t bl_pos_list_union(bl_pos_list_t *result, const bl_pos_list_t *list1, const bl_pos_list_t *list2);
+size_t bl_pos_list_intersect(bl_pos_list_t *result, const bl_pos_list_t *list1, const bl_pos_list_t *list2);
+size_t bl_pos_list_difference(bl_pos_list_t *result, const bl_pos_list_t *list1, const bl_pos_list_t *list2);
+size_t bl_pos_list_lower_bound(const bl_pos_list_t *pos_list, int64_t position);
+size_t bl_pos_list_gallop(const bl_pos_list_t *pos_list, size_t start, int64_t position);
+bool bl_pos_list_contains(const bl_pos_list_t *pos_list, int64_t position);
+bool bl_pos_list_contains_from(const bl_pos_list_t *pos_list, int64_t position, size_t *cursor);
 
 #endif  // _BIOLIBC_POS_LIST_H_
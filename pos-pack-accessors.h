@@ -0,0 +1,14 @@
+    
+/*
+ *  Generated by /usr/local/bin/auto-gen-get-set
+ *
+ *  Accessor macros.  Use these to access structure members from functions
+ *  outside the bl_pos_pack_t class.
+ *
+ *  These generated macros are not expected to be perfect.  Check and edit
+ *  as needed before adding to your code.
+ */
+
+#define BL_POS_PACK_COUNT(ptr)          ((ptr)->count)
+#define BL_POS_PACK_BLOCK_COUNT(ptr)    ((ptr)->block_count)
+#define BL_POS_PACK_DATA_LEN(ptr)       ((ptr)->data_len)
@@ -0,0 +1,179 @@
+/***************************************************************************
+ *  This file is automatically generated by gen-get-set.  Be sure to keep
+ *  track of any manual changes.
+ *
+ *  These generated functions are not expected to be perfect.  Check and
+ *  edit as needed before adding to your code.
+ ***************************************************************************/
+
+#include <string.h>
+#include <ctype.h>
+#include <stdbool.h>        // In case of bool
+#include <stdint.h>         // In case of int64_t, etc
+#include <xtend/string.h>   // strlcpy() on Linux
+#include "pos-pack.h"
+
+
+/***************************************************************************
+ *  Library:
+ *      #include <biolibc/pos-pack.h>
+ *      -lbiolibc -lxtend
+ *
+ *  Description:
+ *      Mutator for count member in a bl_pos_pack_t structure.
+ *      Use this function to set count in a bl_pos_pack_t object
+ *      from non-member functions.  This function performs a direct
+ *      assignment for scalar or pointer structure members.  If
+ *      count is a pointer, data previously pointed to should
+ *      be freed before calling this function to avoid memory
+ *      leaks.
+ *
+ *  Arguments:
+ *      bl_pos_pack_ptr Pointer to the structure to set
+ *      new_count       The new value for count
+ *
+ *  Returns:
+ *      BL_POS_PACK_DATA_OK if the new value is acceptable and assigned
+ *      BL_POS_PACK_DATA_OUT_OF_RANGE otherwise
+ *
+ *  Examples:
+ *      bl_pos_pack_t   bl_pos_pack;
+ *      size_t          new_count;
+ *
+ *      if ( bl_pos_pack_set_count(&bl_pos_pack, new_count)
+ *              == BL_POS_PACK_DATA_OK )
+ *      {
+ *      }
+ *
+ *  See also:
+ *      (3)
+ *
+ *  History: 
+ *  Date        Name        Modification
+ *  2026-10-17  gen-get-set Auto-generated from pos-pack.h
+ ***************************************************************************/
+
+int     bl_pos_pack_set_count(
+	    bl_pos_pack_t *bl_pos_pack_ptr,
+	    size_t new_count
+	)
+
+{
+    if ( false )
+	return BL_POS_PACK_DATA_OUT_OF_RANGE;
+    else
+    {
+	bl_pos_pack_ptr->count = new_count;
+	return BL_POS_PACK_DATA_OK;
+    }
+}
+
+
+/***************************************************************************
+ *  Library:
+ *      #include <biolibc/pos-pack.h>
+ *      -lbiolibc -lxtend
+ *
+ *  Description:
+ *      Mutator for block_count member in a bl_pos_pack_t structure.
+ *      Use this function to set block_count in a bl_pos_pack_t object
+ *      from non-member functions.  This function performs a direct
+ *      assignment for scalar or pointer structure members.  If
+ *      block_count is a pointer, data previously pointed to should
+ *      be freed before calling this function to avoid memory
+ *      leaks.
+ *
+ *  Arguments:
+ *      bl_pos_pack_ptr Pointer to the structure to set
+ *      new_block_count The new value for block_count
+ *
+ *  Returns:
+ *      BL_POS_PACK_DATA_OK if the new value is acceptable and assigned
+ *      BL_POS_PACK_DATA_OUT_OF_RANGE otherwise
+ *
+ *  Examples:
+ *      bl_pos_pack_t   bl_pos_pack;
+ *      size_t          new_block_count;
+ *
+ *      if ( bl_pos_pack_set_block_count(&bl_pos_pack, new_block_count)
+ *              == BL_POS_PACK_DATA_OK )
+ *      {
+ *      }
+ *
+ *  See also:
+ *      (3)
+ *
+ *  History: 
+ *  Date        Name        Modification
+ *  2026-10-17  gen-get-set Auto-generated from pos-pack.h
+ ***************************************************************************/
+
+int     bl_pos_pack_set_block_count(
+	    bl_pos_pack_t *bl_pos_pack_ptr,
+	    size_t new_block_count
+	)
+
+{
+    if ( false )
+	return BL_POS_PACK_DATA_OUT_OF_RANGE;
+    else
+    {
+	bl_pos_pack_ptr->block_count = new_block_count;
+	return BL_POS_PACK_DATA_OK;
+    }
+}
+
+
+/***************************************************************************
+ *  Library:
+ *      #include <biolibc/pos-pack.h>
+ *      -lbiolibc -lxtend
+ *
+ *  Description:
+ *      Mutator for data_len member in a bl_pos_pack_t structure.
+ *      Use this function to set data_len in a bl_pos_pack_t object
+ *      from non-member functions.  This function performs a direct
+ *      assignment for scalar or pointer structure members.  If
+ *      data_len is a pointer, data previously pointed to should
+ *      be freed before calling this function to avoid memory
+ *      leaks.
+ *
+ *  Arguments:
+ *      bl_pos_pack_ptr Pointer to the structure to set
+ *      new_data_len    The new value for data_len
+ *
+ *  Returns:
+ *      BL_POS_PACK_DATA_OK if the new value is acceptable and assigned
+ *      BL_POS_PACK_DATA_OUT_OF_RANGE otherwise
+ *
+ *  Examples:
+ *      bl_pos_pack_t   bl_pos_pack;
+ *      size_t          new_data_len;
+ *
+ *      if ( bl_pos_pack_set_data_len(&bl_pos_pack, new_data_len)
+ *              == BL_POS_PACK_DATA_OK )
+ *      {
+ *      }
+ *
+ *  See also:
+ *      (3)
+ *
+ *  History: 
+ *  Date        Name        Modification
+ *  2026-10-17  gen-get-set Auto-generated from pos-pack.h
+ ***************************************************************************/
+
+int     bl_pos_pack_set_data_len(
+	    bl_pos_pack_t *bl_pos_pack_ptr,
+	    size_t new_data_len
+	)
+
+{
+    if ( false )
+	return BL_POS_PACK_DATA_OUT_OF_RANGE;
+    else
+    {
+	bl_pos_pack_ptr->data_len = new_data_len;
+	return BL_POS_PACK_DATA_OK;
+    }
+}
@@ -0,0 +1,19 @@
+
+/*
+ *  Generated by /usr/local/bin/auto-gen-get-set
+ *
+ *  Mutator functions for setting with no sanity checking.  Use these to
+ *  set structure members from functions outside the bl_pos_pack_t
+ *  class.  These macros perform no data validation.  Hence, they achieve
+ *  maximum performance where data are guaranteed correct by other means.
+ *  Use the mutator functions (same name as the macro, but lower case)
+ *  for more robust code with a small performance penalty.
+ *
+ *  These generated macros are not expected to be perfect.  Check and edit
+ *  as needed before adding to your code.
+ */
+
+/* temp-pos-pack-mutators.c */
+int bl_pos_pack_set_count(bl_pos_pack_t *bl_pos_pack_ptr, size_t new_count);
+int bl_pos_pack_set_block_count(bl_pos_pack_t *bl_pos_pack_ptr, size_t new_block_count);
+int bl_pos_pack_set_data_len(bl_pos_pack_t *bl_pos_pack_ptr, size_t new_data_len);
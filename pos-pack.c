@@ -0,0 +1,663 @@
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <sysexits.h>
+#include <xtend/mem.h>
+#include "pos-pack.h"
+#include "biolibc.h"
+
+/***************************************************************************
+ *  Name:
+ *      bl_pos_pack_init() - Initialize a packed position list
+ *
+ *  Library:
+ *      #include <biolibc/pos-pack.h>
+ *      -lbiolibc -lxtend
+ *
+ *  Description:
+ *      Initialize an empty bl_pos_pack_t.  Arrays are allocated as
+ *      positions are added.
+ *
+ *  Arguments:
+ *      pack    Pointer to the bl_pos_pack_t to initialize
+ *
+ *  See also:
+ *      bl_pos_pack_add(3), bl_pos_pack_free(3)
+ *
+ *  History:
+ *  Date        Name        Modification
+ *  2026-10-17  agent       Begin
+ ***************************************************************************/
+
+void    bl_pos_pack_init(bl_pos_pack_t *pack)
+
+{
+    pack->count = 0;
+    pack->last = 0;
+    pack->block_firsts = NULL;
+    pack->block_offsets = NULL;
+    pack->block_count = 0;
+    pack->block_array_size = 0;
+    pack->data = NULL;
+    pack->data_len = 0;
+    pack->data_size = 0;
+}
+
+
+/***************************************************************************
+ *  Name:
+ *      bl_pos_pack_free() - Free a packed position list
+ *
+ *  Library:
+ *      #include <biolibc/pos-pack.h>
+ *      -lbiolibc -lxtend
+ *
+ *  Description:
+ *      Free all memory held by a bl_pos_pack_t and leave it empty, ready
+ *      for reuse.
+ *
+ *  Arguments:
+ *      pack    Pointer to the bl_pos_pack_t
+ *
+ *  See also:
+ *      bl_pos_pack_init(3)
+ *
+ *  History:
+ *  Date        Name        Modification
+ *  2026-10-17  agent       Begin
+ ***************************************************************************/
+
+void    bl_pos_pack_free(bl_pos_pack_t *pack)
+
+{
+    free(pack->block_firsts);
+    free(pack->block_offsets);
+    free(pack->data);
+    bl_pos_pack_init(pack);
+}
+
+
+/***************************************************************************
+ *  Name:
+ *      bl_pos_pack_add() - Append a position to a packed list
+ *
+ *  Library:
+ *      #include <biolibc/pos-pack.h>
+ *      -lbiolibc -lxtend
+ *
+ *  Description:
+ *      Append position to a packed list.  Positions must be added in
+ *      ascending order, since only differences are stored.  Every
+ *      BL_POS_PACK_BLOCK_SIZE positions a new block is started with the
+ *      position stored in full.
+ *
+ *  Arguments:
+ *      pack        Pointer to the bl_pos_pack_t
+ *      position    Position to append, not less than the last one
+ *
+ *  Returns:
+ *      BL_POS_PACK_OK on success, BL_POS_PACK_NOT_SORTED if position is
+ *      less than the last position, BL_POS_PACK_MALLOC_FAILED otherwise
+ *
+ *  Examples:
+ *      bl_pos_pack_t   pack;
+ *
+ *      bl_pos_pack_init(&pack);
+ *      while ( bl_vcf_read_ss_call(&call, vcf_stream, field_mask)
+ *              == BL_READ_OK )
+ *          if ( bl_pos_pack_add(&pack, BL_VCF_POS(&call)) != BL_POS_PACK_OK )
+ *              ...
+ *
+ *  See also:
+ *      bl_pos_pack_from_list(3), bl_pos_pack_iter_next(3)
+ *
+ *  History:
+ *  Date        Name        Modification
+ *  2026-10-17  agent       Begin
+ ***************************************************************************/
+
+int     bl_pos_pack_add(bl_pos_pack_t *pack, int64_t position)
+
+{
+    uint64_t    delta;
+
+    if ( (pack->count > 0) && (position < pack->last) )
+	return BL_POS_PACK_NOT_SORTED;
+
+    if ( pack->count % BL_POS_PACK_BLOCK_SIZE == 0 )
+    {
+	if ( pack->block_count == pack->block_array_size )
+	{
+	    pack->block_array_size = pack->block_array_size == 0 ?
+		BL_POS_PACK_START_BLOCKS : pack->block_array_size * 2;
+	    pack->block_firsts = xt_realloc(pack->block_firsts,
+		pack->block_array_size, sizeof(*pack->block_firsts));
+	    pack->block_offsets = xt_realloc(pack->block_offsets,
+		pack->block_array_size, sizeof(*pack->block_offsets));
+	    if ( (pack->block_firsts == NULL) || (pack->block_offsets == NULL) )
+		return BL_POS_PACK_MALLOC_FAILED;
+	}
+	pack->block_firsts[pack->block_count] = position;
+	pack->block_offsets[pack->block_count++] = pack->data_len;
+    }
+    else
+    {
+	if ( pack->data_len + BL_POS_PACK_VARINT_MAX > pack->data_size )
+	{
+	    pack->data_size = pack->data_size == 0 ?
+		BL_POS_PACK_START_BYTES : pack->data_size * 2;
+	    if ( (pack->data = xt_realloc(pack->data, pack->data_size,
+					  sizeof(*pack->data))) == NULL )
+		return BL_POS_PACK_MALLOC_FAILED;
+	}
+	for (delta = position - pack->last; delta >= 0x80; delta >>= 7)
+	    pack->data[pack->data_len++] = (delta & 0x7f) | 0x80;
+	pack->data[pack->data_len++] = delta;
+    }
+    pack->last = position;
+    ++pack->count;
+    return BL_POS_PACK_OK;
+}
+
+
+/***************************************************************************
+ *  Name:
+ *      bl_pos_pack_from_list() - Pack a sorted position list
+ *
+ *  Library:
+ *      #include <biolibc/pos-pack.h>
+ *      -lbiolibc -lxtend
+ *
+ *  Description:
+ *      Append all positions of pos_list to pack.  pos_list must be
+ *      sorted in ascending order, e.g. by bl_pos_list_sort(3).
+ *
+ *  Arguments:
+ *      pack        Pointer to the bl_pos_pack_t
+ *      pos_list    Pointer to a sorted bl_pos_list_t
+ *
+ *  Returns:
+ *      BL_POS_PACK_OK on success, or any error from bl_pos_pack_add(3)
+ *
+ *  See also:
+ *      bl_pos_pack_to_list(3), bl_pos_pack_add(3)
+ *
+ *  History:
+ *  Date        Name        Modification
+ *  2026-10-17  agent       Begin
+ ***************************************************************************/
+
+int     bl_pos_pack_from_list(bl_pos_pack_t *pack, const bl_pos_list_t *pos_list)
+
+{
+    size_t  c;
+    int     status;
+
+    for (c = 0; c < pos_list->count; ++c)
+	if ( (status = bl_pos_pack_add(pack, pos_list->positions[c]))
+		!= BL_POS_PACK_OK )
+	    return status;
+    return BL_POS_PACK_OK;
+}
+
+
+/***************************************************************************
+ *  Name:
+ *      bl_pos_pack_to_list() - Unpack a packed position list
+ *
+ *  Library:
+ *      #include <biolibc/pos-pack.h>
+ *      -lbiolibc -lxtend
+ *
+ *  Description:
+ *      Decode all positions in pack into pos_list, replacing its contents.
+ *      pos_list may be blank (BL_POS_LIST_INIT) or previously used.
+ *
+ *  Arguments:
+ *      pack        Pointer to the bl_pos_pack_t
+ *      pos_list    Pointer to the bl_pos_list_t to receive the positions
+ *
+ *  Returns:
+ *      The number of positions
+ *
+ *  See also:
+ *      bl_pos_pack_from_list(3), bl_pos_pack_iter_next(3)
+ *
+ *  History:
+ *  Date        Name        Modification
+ *  2026-10-17  agent       Begin
+ ***************************************************************************/
+
+size_t  bl_pos_pack_to_list(const bl_pos_pack_t *pack, bl_pos_list_t *pos_list)
+
+{
+    bl_pos_pack_iter_t  iter;
+    size_t  c = 0;
+
+    bl_pos_list_reserve(pos_list, pack->count);
+    bl_pos_pack_iter_init(&iter, pack);
+    while ( bl_pos_pack_iter_next(&iter, &pos_list->positions[c]) )
+	++c;
+    return pos_list->count = c;
+}
+
+
+/***************************************************************************
+ *  Name:
+ *      bl_pos_pack_iter_init() - Start reading a packed position list
+ *
+ *  Library:
+ *      #include <biolibc/pos-pack.h>
+ *      -lbiolibc -lxtend
+ *
+ *  Description:
+ *      Prepare iter to decode pack from the first position, using
+ *      bl_pos_pack_iter_next(3) and bl_pos_pack_iter_skip_to(3).  pack must
+ *      not be modified while iter is in use.
+ *
+ *  Arguments:
+ *      iter    Pointer to the bl_pos_pack_iter_t to initialize
+ *      pack    Pointer to the bl_pos_pack_t to read
+ *
+ *  See also:
+ *      bl_pos_pack_iter_next(3), bl_pos_pack_iter_skip_to(3)
+ *
+ *  History:
+ *  Date        Name        Modification
+ *  2026-10-17  agent       Begin
+ ***************************************************************************/
+
+void    bl_pos_pack_iter_init(bl_pos_pack_iter_t *iter, const bl_pos_pack_t *pack)
+
+{
+    iter->pack = pack;
+    iter->index = 0;
+    iter->offset = 0;
+    iter->position = 0;
+}
+
+
+/***************************************************************************
+ *  Name:
+ *      bl_pos_pack_iter_next() - Decode the next packed position
+ *
+ *  Library:
+ *      #include <biolibc/pos-pack.h>
+ *      -lbiolibc -lxtend
+ *
+ *  Description:
+ *      Decode the next position of a packed list.  The first position of
+ *      each block is read directly, and others by adding one varint delta
+ *      to the previous position.  A varint running past the end of its
+ *      block ends the iteration, so corrupt data are never over-read.
+ *
+ *  Arguments:
+ *      iter        Pointer to a bl_pos_pack_iter_t
+ *      position    Pointer to receive the position
+ *
+ *  Returns:
+ *      true if a position was decoded, false at the end of the list or
+ *      if the block is corrupt
+ *
+ *  Examples:
+ *      bl_pos_pack_iter_t  iter;
+ *      int64_t             pos;
+ *
+ *      bl_pos_pack_iter_init(&iter, &pack);
+ *      while ( bl_pos_pack_iter_next(&iter, &pos) )
+ *          printf("%" PRId64 "\n", pos);
+ *
+ *  See also:
+ *      bl_pos_pack_iter_init(3), bl_pos_pack_iter_skip_to(3)
+ *
+ *  History:
+ *  Date        Name        Modification
+ *  2026-10-17  agent       Begin
+ *  2026-10-17  agent       Stop at the end of the block
+ ***************************************************************************/
+
+bool    bl_pos_pack_iter_next(bl_pos_pack_iter_t *iter, int64_t *position)
+
+{
+    const bl_pos_pack_t *pack = iter->pack;
+    uint64_t    delta = 0;
+    unsigned    shift = 0;
+    size_t      block, end;
+    unsigned char   byte;
+
+    if ( iter->index >= pack->count )
+	return false;
+    block = iter->index / BL_POS_PACK_BLOCK_SIZE;
+    if ( iter->index % BL_POS_PACK_BLOCK_SIZE == 0 )
+    {
+	iter->position = pack->block_firsts[block];
+	iter->offset = pack->block_offsets[block];
+    }
+    else
+    {
+	// Never decode past the end of the block, even if data are corrupt
+	end = block + 1 < pack->block_count ?
+	      pack->block_offsets[block + 1] : pack->data_len;
+	do
+	{
+	    if ( (iter->offset == end) || (shift >= 64) )
+	    {
+		iter->index = pack->count;
+		return false;
+	    }
+	    byte = pack->data[iter->offset++];
+	    delta |= (uint64_t)(byte & 0x7f) << shift;
+	    shift += 7;
+	}   while ( byte & 0x80 );
+	iter->position += delta;
+    }
+    ++iter->index;
+    *position = iter->position;
+    return true;
+}
+
+
+/***************************************************************************
+ *  Name:
+ *      bl_pos_pack_iter_skip_to() - Skip ahead in a packed position list
+ *
+ *  Library:
+ *      #include <biolibc/pos-pack.h>
+ *      -lbiolibc -lxtend
+ *
+ *  Description:
+ *      Advance iter to the first remaining position not less than target,
+ *      and decode it.  Blocks that end before target are skipped by
+ *      binary search of their first positions, so at most one block is
+ *      decoded.  This allows merging a sorted stream of records against
+ *      a large packed list without decoding all of it.
+ *
+ *  Arguments:
+ *      iter        Pointer to a bl_pos_pack_iter_t
+ *      target      Position to skip to
+ *      position    Pointer to receive the first position >= target
+ *
+ *  Returns:
+ *      true if such a position exists, false otherwise
+ *
+ *  Examples:
+ *      // Report calls at positions in a packed SNP list
+ *      bl_pos_pack_iter_init(&iter, &snps);
+ *      have_snp = bl_pos_pack_iter_next(&iter, &snp);
+ *      while ( have_snp && (bl_vcf_read_ss_call(&call, vcf_stream,
+ *              field_mask) == BL_READ_OK) )
+ *      {
+ *          if ( snp < BL_VCF_POS(&call) )
+ *              have_snp = bl_pos_pack_iter_skip_to(&iter,
+ *                          BL_VCF_POS(&call), &snp);
+ *          if ( have_snp && (snp == BL_VCF_POS(&call)) )
+ *              bl_vcf_write_ss_call(&call, stdout, field_mask);
+ *      }
+ *
+ *  See also:
+ *      bl_pos_pack_iter_next(3), bl_pos_pack_contains(3)
+ *
+ *  History:
+ *  Date        Name        Modification
+ *  2026-10-17  agent       Begin
+ ***************************************************************************/
+
+bool    bl_pos_pack_iter_skip_to(bl_pos_pack_iter_t *iter, int64_t target,
+				 int64_t *position)
+
+{
+    const bl_pos_pack_t *pack = iter->pack;
+    size_t  low, high, mid;
+
+    // Last block starting before target, if past the current one
+    low = iter->index / BL_POS_PACK_BLOCK_SIZE + 1;
+    high = pack->block_count;
+    while ( low < high )
+    {
+	mid = low + (high - low) / 2;
+	if ( pack->block_firsts[mid] < target )
+	    low = mid + 1;
+	else
+	    high = mid;
+    }
+    if ( (low - 1) * BL_POS_PACK_BLOCK_SIZE > iter->index )
+	iter->index = (low - 1) * BL_POS_PACK_BLOCK_SIZE;
+
+    while ( bl_pos_pack_iter_next(iter, position) )
+	if ( *position >= target )
+	    return true;
+    return false;
+}
+
+
+/***************************************************************************
+ *  Name:
+ *      bl_pos_pack_contains() - Check membership in a packed position list
+ *
+ *  Library:
+ *      #include <biolibc/pos-pack.h>
+ *      -lbiolibc -lxtend
+ *
+ *  Description:
+ *      Determine whether position is in pack, decoding at most one
+ *      block.  For many positions in ascending order, use
+ *      bl_pos_pack_iter_skip_to(3) instead.
+ *
+ *  Arguments:
+ *      pack        Pointer to the bl_pos_pack_t
+ *      position    Position to look for
+ *
+ *  Returns:
+ *      true if position is in pack, false otherwise
+ *
+ *  See also:
+ *      bl_pos_pack_iter_skip_to(3), bl_pos_list_contains(3)
+ *
+ *  History:
+ *  Date        Name        Modification
+ *  2026-10-17  agent       Begin
+ ***************************************************************************/
+
+bool    bl_pos_pack_contains(const bl_pos_pack_t *pack, int64_t position)
+
+{
+    bl_pos_pack_iter_t  iter;
+    int64_t             found;
+
+    bl_pos_pack_iter_init(&iter, pack);
+    return bl_pos_pack_iter_skip_to(&iter, position, &found) &&
+	   (found == position);
+}
+
+
+/***************************************************************************
+ *  Name:
+ *      bl_pos_pack_write() - Save a packed position list
+ *
+ *  Library:
+ *      #include <biolibc/pos-pack.h>
+ *      -lbiolibc -lxtend
+ *
+ *  Description:
+ *      Write pack to stream in the binary format described in pos-pack.h,
+ *      so that it can be reloaded by bl_pos_pack_read(3) without parsing
+ *      or packing the source again.
+ *
+ *  Arguments:
+ *      pack    Pointer to the bl_pos_pack_t
+ *      stream  Output stream, opened in binary mode
+ *
+ *  Returns:
+ *      BL_WRITE_OK on success, BL_WRITE_FAILURE otherwise
+ *
+ *  See also:
+ *      bl_pos_pack_read(3)
+ *
+ *  History:
+ *  Date        Name        Modification
+ *  2026-10-17  agent       Begin
+ ***************************************************************************/
+
+int     bl_pos_pack_write(const bl_pos_pack_t *pack, FILE *stream)
+
+{
+    bl_pos_pack_file_t  header;
+    uint64_t            offset;
+    size_t              c;
+
+    memset(&header, 0, sizeof(header));
+    memcpy(header.magic, BL_POS_PACK_MAGIC, sizeof(header.magic));
+    header.version = BL_POS_PACK_VERSION;
+    header.byte_order = BL_POS_PACK_BYTE_ORDER;
+    header.count = pack->count;
+    header.block_count = pack->block_count;
+    header.data_len = pack->data_len;
+
+    if ( fwrite(&header, sizeof(header), 1, stream) != 1 )
+	return BL_WRITE_FAILURE;
+    if ( pack->count == 0 )
+	return BL_WRITE_OK;
+    if ( fwrite(pack->block_firsts, sizeof(*pack->block_firsts),
+		pack->block_count, stream) != pack->block_count )
+	return BL_WRITE_FAILURE;
+    for (c = 0; c < pack->block_count; ++c)
+    {
+	offset = pack->block_offsets[c];
+	if ( fwrite(&offset, sizeof(offset), 1, stream) != 1 )
+	    return BL_WRITE_FAILURE;
+    }
+    if ( (pack->data_len > 0) &&
+	 (fwrite(pack->data, 1, pack->data_len, stream) != pack->data_len) )
+	return BL_WRITE_FAILURE;
+    return BL_WRITE_OK;
+}
+
+
+/***************************************************************************
+ *  Name:
+ *      bl_pos_pack_read() - Load a saved packed position list
+ *
+ *  Library:
+ *      #include <biolibc/pos-pack.h>
+ *      -lbiolibc -lxtend
+ *
+ *  Description:
+ *      Read a packed list written by bl_pos_pack_write(3) into pack,
+ *      replacing its contents.  More positions may be added afterward
+ *      with bl_pos_pack_add(3).
+ *
+ *      The whole list is decoded once to validate it: each block must
+ *      hold exactly its share of count positions, with every varint
+ *      ending within the block's bytes, and positions must be in
+ *      ascending order.
+ *
+ *  Arguments:
+ *      pack    Pointer to an initialized bl_pos_pack_t
+ *      stream  Input stream, opened in binary mode
+ *
+ *  Returns:
+ *      BL_POS_PACK_OK on success, BL_POS_PACK_BAD_FORMAT if the stream
+ *      is not a valid packed list for this architecture, or is truncated
+ *      or corrupt, BL_POS_PACK_MALLOC_FAILED otherwise
+ *
+ *  See also:
+ *      bl_pos_pack_write(3)
+ *
+ *  History:
+ *  Date        Name        Modification
+ *  2026-10-17  agent       Begin
+ *  2026-10-17  agent       Validate blocks
+ ***************************************************************************/
+
+int     bl_pos_pack_read(bl_pos_pack_t *pack, FILE *stream)
+
+{
+    bl_pos_pack_file_t  header;
+    bl_pos_pack_iter_t  iter;
+    uint64_t            offset;
+    size_t              c, block, end;
+    int64_t             position, last = 0;
+
+    bl_pos_pack_free(pack);
+    if ( (fread(&header, sizeof(header), 1, stream) != 1) ||
+	 (memcmp(header.magic, BL_POS_PACK_MAGIC, sizeof(header.magic)) != 0) ||
+	 (header.version != BL_POS_PACK_VERSION) ||
+	 (header.byte_order != BL_POS_PACK_BYTE_ORDER) ||
+	 (header.block_count != (header.count + BL_POS_PACK_BLOCK_SIZE - 1)
+				/ BL_POS_PACK_BLOCK_SIZE) )
+	return BL_POS_PACK_BAD_FORMAT;
+
+    pack->block_array_size = header.block_count > 0 ? header.block_count : 1;
+    pack->data_size = header.data_len + BL_POS_PACK_VARINT_MAX;
+    pack->block_firsts = xt_malloc(pack->block_array_size,
+				   sizeof(*pack->block_firsts));
+    pack->block_offsets = xt_malloc(pack->block_array_size,
+				    sizeof(*pack->block_offsets));
+    pack->data = xt_malloc(pack->data_size, sizeof(*pack->data));
+    if ( (pack->block_firsts == NULL) || (pack->block_offsets == NULL) ||
+	 (pack->data == NULL) )
+    {
+	bl_pos_pack_free(pack);
+	return BL_POS_PACK_MALLOC_FAILED;
+    }
+
+    if ( fread(pack->block_firsts, sizeof(*pack->block_firsts),
+	       header.block_count, stream) != header.block_count )
+    {
+	bl_pos_pack_free(pack);
+	return BL_POS_PACK_BAD_FORMAT;
+    }
+    for (c = 0; c < header.block_count; ++c)
+    {
+	if ( (fread(&offset, sizeof(offset), 1, stream) != 1) ||
+	     (offset > header.data_len) ||
+	     ((c == 0) && (offset != 0)) ||
+	     ((c > 0) && (offset < pack->block_offsets[c - 1])) )
+	{
+	    bl_pos_pack_free(pack);
+	    return BL_POS_PACK_BAD_FORMAT;
+	}
+	pack->block_offsets[c] = offset;
+    }
+    if ( fread(pack->data, 1, header.data_len, stream) != header.data_len )
+    {
+	bl_pos_pack_free(pack);
+	return BL_POS_PACK_BAD_FORMAT;
+    }
+    pack->block_count = header.block_count;
+    pack->data_len = header.data_len;
+    pack->count = header.count;
+
+    /*
+     *  Each block must end exactly where the next begins.  This also
+     *  recovers the last position, so that more can be added.
+     */
+    if ( (pack->count == 0) && (pack->data_len != 0) )
+    {
+	bl_pos_pack_free(pack);
+	return BL_POS_PACK_BAD_FORMAT;
+    }
+    bl_pos_pack_iter_init(&iter, pack);
+    for (c = 0; bl_pos_pack_iter_next(&iter, &position); ++c)
+    {
+	if ( (c > 0) && (position < last) )
+	    break;
+	last = position;
+	if ( (iter.index % BL_POS_PACK_BLOCK_SIZE == 0) ||
+	     (iter.index == pack->count) )
+	{
+	    block = c / BL_POS_PACK_BLOCK_SIZE;
+	    end = block + 1 < pack->block_count ?
+		  pack->block_offsets[block + 1] : pack->data_len;
+	    if ( iter.offset != end )
+		break;
+	}
+    }
+    if ( c != pack->count )
+    {
+	bl_pos_pack_free(pack);
+	return BL_POS_PACK_BAD_FORMAT;
+    }
+    pack->last = last;
+    return BL_POS_PACK_OK;
+}
@@ -0,0 +1,113 @@
+#ifndef _BIOLIBC_POS_PACK_H_
+#define _BIOLIBC_POS_PACK_H_
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+#ifndef _STDIO_H_
+#include <stdio.h>
+#endif
+
+#ifndef _STDINT_H_
+#include <stdint.h>
+#endif
+
+#ifndef __bool_true_false_are_defined
+#include <stdbool.h>
+#endif
+
+#ifndef _BIOLIBC_POS_LIST_H_
+#include "pos-list.h"
+#endif
+
+/*
+ *  Compressed list of positions in ascending order.  Positions are
+ *  grouped in blocks of BL_POS_PACK_BLOCK_SIZE.  The first position of
+ *  each block is stored in full in block_firsts, and each later one as
+ *  a varint (LEB128: 7 bits per byte, high bit set on all but the last
+ *  byte) of its difference from the one before.  Nearby sorted positions,
+ *  such as SNPs on one chromosome, take 1 to 3 bytes each instead of 8.
+ *
+ *  block_offsets[b] is where block b's deltas start in data, so a search
+ *  can binary search block_firsts and decode only one block.
+ */
+
+#define BL_POS_PACK_BLOCK_SIZE      128
+#define BL_POS_PACK_START_BLOCKS    64
+#define BL_POS_PACK_START_BYTES     4096
+#define BL_POS_PACK_VARINT_MAX      10  // Bytes for a 64-bit delta
+
+#define BL_POS_PACK_OK              0
+#define BL_POS_PACK_MALLOC_FAILED   -1
+#define BL_POS_PACK_NOT_SORTED      -2
+#define BL_POS_PACK_BAD_FORMAT      -3
+
+/*
+ *  File format, in host byte order: a bl_pos_pack_file_t header followed
+ *  by block_firsts (int64_t[block_count]), block_offsets
+ *  (uint64_t[block_count]), and data (data_len bytes).
+ */
+#define BL_POS_PACK_MAGIC           "BLPOSPK"
+#define BL_POS_PACK_VERSION         1
+#define BL_POS_PACK_BYTE_ORDER      0x01020304
+
+typedef struct
+{
+    char        magic[8];
+    uint32_t    version,
+		byte_order;     // Detects files from other architectures
+    uint64_t    count,
+		block_count,
+		data_len;
+}   bl_pos_pack_file_t;
+
+typedef struct
+{
+    size_t      count;
+    int64_t     last;           // Most recently added position
+
+    int64_t     *block_firsts;
+    size_t      *block_offsets,
+		block_count,
+		block_array_size;
+
+    unsigned char   *data;      // Varint deltas
+    size_t      data_len,
+		data_size;
+}   bl_pos_pack_t;
+
+#define BL_POS_PACK_INIT \
+	{ 0, 0, NULL, NULL, 0, 0, NULL, 0, 0 }
+
+// Sequential reader, which can skip ahead without decoding every block
+typedef struct
+{
+    const bl_pos_pack_t *pack;
+    size_t      index,          // Of the next position
+		offset;         // Of its delta in data
+    int64_t     position;       // The previous position
+}   bl_pos_pack_iter_t;
+
+#include "pos-pack-rvs.h"
+#include "pos-pack-accessors.h"
+#include "pos-pack-mutators.h"
+
+/* pos-pack.c */
+void bl_pos_pack_init(bl_pos_pack_t *pack);
+void bl_pos_pack_free(bl_pos_pack_t *pack);
+int bl_pos_pack_add(bl_pos_pack_t *pack, int64_t position);
+int bl_pos_pack_from_list(bl_pos_pack_t *pack, const bl_pos_list_t *pos_list);
+size_t bl_pos_pack_to_list(const bl_pos_pack_t *pack, bl_pos_list_t *pos_list);
+void bl_pos_pack_iter_init(bl_pos_pack_iter_t *iter, const bl_pos_pack_t *pack);
+bool bl_pos_pack_iter_next(bl_pos_pack_iter_t *iter, int64_t *position);
+bool bl_pos_pack_iter_skip_to(bl_pos_pack_iter_t *iter, int64_t target, int64_t *position);
+bool bl_pos_pack_contains(const bl_pos_pack_t *pack, int64_t position);
+int bl_pos_pack_write(const bl_pos_pack_t *pack, FILE *stream);
+int bl_pos_pack_read(bl_pos_pack_t *pack, FILE *stream);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif // _BIOLIBC_POS_PACK_H_
@@ -9,17 +9,11 @@
  *  as needed before adding to your code.
  */
 
-#define BL_SAM_QNAME(ptr)               ((ptr)->qname)
-#define BL_SAM_QNAME_AE(ptr,c)          ((ptr)->qname[c])
 #define BL_SAM_FLAG(ptr)                ((ptr)->flag)
-#define BL_SAM_RNAME(ptr)               ((ptr)->rname)
-#define BL_SAM_RNAME_AE(ptr,c)          ((ptr)->rname[c])
 #define BL_SAM_POS(ptr)                 ((ptr)->pos)
 #define BL_SAM_MAPQ(ptr)                ((ptr)->mapq)
 #define BL_SAM_CIGAR(ptr)               ((ptr)->cigar)
 #define BL_SAM_CIGAR_AE(ptr,c)          ((ptr)->cigar[c])
-#define BL_SAM_RNEXT(ptr)               ((ptr)->rnext)
-#define BL_SAM_RNEXT_AE(ptr,c)          ((ptr)->rnext[c])
 #define BL_SAM_PNEXT(ptr)               ((ptr)->pnext)
 #define BL_SAM_TLEN(ptr)                ((ptr)->tlen)
 #define BL_SAM_SEQ(ptr)                 ((ptr)->seq)
@@ -32,3 +26,15 @@
 #define BL_SAM_SEQ_LEN(ptr)             ((ptr)->seq_len)
 #define BL_SAM_QUAL_ARRAY_SIZE(ptr)     ((ptr)->qual_array_size)
 #define BL_SAM_QUAL_LEN(ptr)            ((ptr)->qual_len)
+#define BL_SAM_LINE(ptr)                ((ptr)->line)
+#define BL_SAM_LINE_AE(ptr,c)           ((ptr)->line[c])
+#define BL_SAM_LINE_ARRAY_SIZE(ptr)     ((ptr)->line_array_size)
+#define BL_SAM_NAMES_ARRAY_SIZE(ptr)    ((ptr)->names_array_size)
+#define BL_SAM_NAMES_LEN(ptr)           ((ptr)->names_len)
+#define BL_SAM_CHROM_DICT(ptr)          ((ptr)->chrom_dict)
+#define BL_SAM_RNAME_ID(ptr)            ((ptr)->rname_id)
+#define BL_SAM_CIGAR_OPS(ptr)           ((ptr)->cigar_ops)
+#define BL_SAM_CIGAR_OPS_AE(ptr,c)      ((ptr)->cigar_ops[c])
+#define BL_SAM_CIGAR_OPS_ARRAY_SIZE(ptr) ((ptr)->cigar_ops_array_size)
+#define BL_SAM_CIGAR_OP_COUNT(ptr)      ((ptr)->cigar_op_count)
+#define BL_SAM_REF_END(ptr)             ((ptr)->ref_end)
@@ -12,12 +12,18 @@
 #define BL_SAM_BUFF_BUFF_SIZE(ptr)      ((ptr)->buff_size)
 #define BL_SAM_BUFF_MAX_ALIGNMENTS(ptr) ((ptr)->max_alignments)
 #define BL_SAM_BUFF_ALIGNMENTS(ptr)     ((ptr)->alignments)
-#define BL_SAM_BUFF_ALIGNMENTS_AE(ptr,c) ((ptr)->alignments[c])
+#define BL_SAM_BUFF_ALIGNMENTS_AE(ptr,c) \
+	((ptr)->alignments[((ptr)->head + (c)) & ((ptr)->buff_size - 1)])
+#define BL_SAM_BUFF_HEAD(ptr)           ((ptr)->head)
 #define BL_SAM_BUFF_BUFFERED_COUNT(ptr) ((ptr)->buffered_count)
 #define BL_SAM_BUFF_MAX_COUNT(ptr)      ((ptr)->max_count)
+#define BL_SAM_BUFF_OVERFLOW_MODE(ptr)  ((ptr)->overflow_mode)
+#define BL_SAM_BUFF_SPILL_COUNT(ptr)    ((ptr)->spill_count)
+#define BL_SAM_BUFF_MAX_SPILL_COUNT(ptr) ((ptr)->max_spill_count)
 #define BL_SAM_BUFF_PREVIOUS_POS(ptr)   ((ptr)->previous_pos)
 #define BL_SAM_BUFF_PREVIOUS_RNAME(ptr) ((ptr)->previous_rname)
 #define BL_SAM_BUFF_PREVIOUS_RNAME_AE(ptr,c) ((ptr)->previous_rname[c])
+#define BL_SAM_BUFF_PREVIOUS_RNAME_ID(ptr) ((ptr)->previous_rname_id)
 #define BL_SAM_BUFF_MAPQ_MIN(ptr)       ((ptr)->mapq_min)
 #define BL_SAM_BUFF_MAPQ_LOW(ptr)       ((ptr)->mapq_low)
 #define BL_SAM_BUFF_MAPQ_HIGH(ptr)      ((ptr)->mapq_high)
@@ -188,6 +188,8 @@ int     bl_sam_buff_set_alignments(
  *      Mutator for an array element of alignments member in a bl_sam_buff_t
  *      structure. Use this function to set bl_sam_buff_ptr->alignments[c]
  *      in a bl_sam_buff_t object from non-member functions.
+ *      c is counted from the head of the circular queue, as in
+ *      BL_SAM_BUFF_ALIGNMENTS_AE().
  *
  *  Arguments:
  *      bl_sam_buff_ptr Pointer to the structure to set
@@ -214,6 +216,7 @@ int     bl_sam_buff_set_alignments(
  *  History: 
  *  Date        Name        Modification
  *  2022-02-07  gen-get-set Auto-generated from sam-buff.h
+ *  2026-10-17  agent       Index from head of circular queue
  ***************************************************************************/
 
 int     bl_sam_buff_set_alignments_ae(
@@ -227,7 +230,7 @@ int     bl_sam_buff_set_alignments_ae(
 	return BL_SAM_BUFF_DATA_OUT_OF_RANGE;
     else
     {
-	bl_sam_buff_ptr->alignments[c] = new_alignments_element;
+	BL_SAM_BUFF_ALIGNMENTS_AE(bl_sam_buff_ptr, c) = new_alignments_element;
 	return BL_SAM_BUFF_DATA_OK;
     }
 }
@@ -402,6 +405,59 @@ int     bl_sam_buff_set_max_count(
 }
 
 
+/***************************************************************************
+ *  Library:
+ *      #include <biolibc/sam-buff.h>
+ *      -lbiolibc -lxtend
+ *
+ *  Description:
+ *      Mutator for overflow_mode member in a bl_sam_buff_t structure.
+ *      Use this function to set overflow_mode in a bl_sam_buff_t object
+ *      from non-member functions.  new_overflow_mode must be
+ *      BL_SAM_BUFF_OVERFLOW_FAIL or BL_SAM_BUFF_OVERFLOW_SPILL.
+ *
+ *  Arguments:
+ *      bl_sam_buff_ptr Pointer to the structure to set
+ *      new_overflow_mode The new value for overflow_mode
+ *
+ *  Returns:
+ *      BL_SAM_BUFF_DATA_OK if the new value is acceptable and assigned
+ *      BL_SAM_BUFF_DATA_OUT_OF_RANGE otherwise
+ *
+ *  Examples:
+ *      bl_sam_buff_t   bl_sam_buff;
+ *
+ *      if ( bl_sam_buff_set_overflow_mode(&bl_sam_buff,
+ *              BL_SAM_BUFF_OVERFLOW_SPILL)
+ *              == BL_SAM_BUFF_DATA_OK )
+ *      {
+ *      }
+ *
+ *  See also:
+ *      bl_sam_buff_spill(3)
+ *
+ *  History: 
+ *  Date        Name        Modification
+ *  2026-10-17  agent       Begin
+ ***************************************************************************/
+
+int     bl_sam_buff_set_overflow_mode(
+	    bl_sam_buff_t *bl_sam_buff_ptr,
+	    int new_overflow_mode
+	)
+
+{
+    if ( (new_overflow_mode != BL_SAM_BUFF_OVERFLOW_FAIL) &&
+	 (new_overflow_mode != BL_SAM_BUFF_OVERFLOW_SPILL) )
+	return BL_SAM_BUFF_DATA_OUT_OF_RANGE;
+    else
+    {
+	bl_sam_buff_ptr->overflow_mode = new_overflow_mode;
+	return BL_SAM_BUFF_DATA_OK;
+    }
+}
+
+
 /***************************************************************************
  *  Library:
  *      #include <biolibc/sam-buff.h>
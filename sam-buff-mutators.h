@@ -21,6 +21,7 @@ int bl_sam_buff_set_alignments_ae(bl_sam_buff_t *bl_sam_buff_ptr, size_t c, bl_s
 int bl_sam_buff_set_alignments_cpy(bl_sam_buff_t *bl_sam_buff_ptr, bl_sam_t **new_alignments, size_t array_size);
 int bl_sam_buff_set_buffered_count(bl_sam_buff_t *bl_sam_buff_ptr, size_t new_buffered_count);
 int bl_sam_buff_set_max_count(bl_sam_buff_t *bl_sam_buff_ptr, size_t new_max_count);
+int bl_sam_buff_set_overflow_mode(bl_sam_buff_t *bl_sam_buff_ptr, int new_overflow_mode);
 int bl_sam_buff_set_previous_pos(bl_sam_buff_t *bl_sam_buff_ptr, int64_t new_previous_pos);
 int bl_sam_buff_set_previous_rname_ae(bl_sam_buff_t *bl_sam_buff_ptr, size_t c, char new_previous_rname_element);
 int bl_sam_buff_set_previous_rname_cpy(bl_sam_buff_t *bl_sam_buff_ptr, char new_previous_rname[], size_t array_size);
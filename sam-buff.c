@@ -2,6 +2,7 @@
 #include <stdlib.h>
 #include <string.h>
 #include <inttypes.h>
+#include <unistd.h>         // ftruncate()
 #include <xtend/string.h>   // strlcpy() on Linux
 #include <xtend/mem.h>
 #include <xtend/math.h>     // XT_MIN()
@@ -21,7 +22,8 @@
  *      one, assuming the input is sorted first by chrom and then
  *      position.  The previous chrom and position are stored in
  *      sam_buff (and initialized so that the first SAM alignment read is
- *      always OK).
+ *      always OK).  If alignments share a chromosome dictionary, the
+ *      per-alignment check is an integer compare of rname_id.
  *  
  *  Arguments:
  *      sam_buff        Pointer to a SAM buffer with recent alignments
@@ -33,16 +35,31 @@
  *  History: 
  *  Date        Name        Modification
  *  2020-05-27  Jason Bacon Begin
+ *  2026-10-17  agent       Use BL_SAM_RNAME() for packed names
+ *  2026-10-17  agent       Compare chrom IDs if alignments have a chrom_dict
  ***************************************************************************/
 
 void    bl_sam_buff_check_order(bl_sam_buff_t *sam_buff,
 			     bl_sam_t *sam_alignment)
 
 {
+    int     chrom_cmp;
+    
     /*fprintf(stderr, "Previous SAM: %s %zu, Current SAM: %s %zu\n",
 	    sam_buff->previous_rname, sam_buff->previous_pos,
-	    sam_alignment->rname, sam_alignment->pos);*/
-    if ( strcmp(sam_alignment->rname, sam_buff->previous_rname) == 0 )
+	    BL_SAM_RNAME(sam_alignment), sam_alignment->pos);*/
+    if ( BL_CHROM_IDS_COMPARABLE(sam_alignment->chrom_dict,
+	    sam_alignment->rname_id, sam_alignment->chrom_dict,
+	    sam_buff->previous_rname_id) )
+	chrom_cmp = bl_chrom_dict_cmp(sam_alignment->chrom_dict,
+			sam_alignment->rname_id, sam_buff->previous_rname_id);
+    else if ( strcmp(BL_SAM_RNAME(sam_alignment), sam_buff->previous_rname) == 0 )
+	chrom_cmp = 0;
+    else
+	chrom_cmp = bl_chrom_name_cmp(BL_SAM_RNAME(sam_alignment),
+				      sam_buff->previous_rname) < 0 ? -1 : 1;
+    
+    if ( chrom_cmp == 0 )
     {
 	// Silly to assign when already ==, but sillier to add another check
 	if (sam_alignment->pos < sam_buff->previous_pos )
@@ -50,12 +67,12 @@ void    bl_sam_buff_check_order(bl_sam_buff_t *sam_buff,
 	else
 	    sam_buff->previous_pos = sam_alignment->pos;
     }
-    else if ( bl_chrom_name_cmp(sam_alignment->rname,
-				  sam_buff->previous_rname) < 0 )
+    else if ( chrom_cmp < 0 )
 	bl_sam_buff_out_of_order(sam_buff, sam_alignment);
     else
     {
-	strlcpy(sam_buff->previous_rname, sam_alignment->rname, BL_SAM_RNAME_MAX_CHARS);
+	strlcpy(sam_buff->previous_rname, BL_SAM_RNAME(sam_alignment), BL_SAM_RNAME_MAX_CHARS);
+	sam_buff->previous_rname_id = sam_alignment->rname_id;
 	sam_buff->previous_pos = sam_alignment->pos;
     }
 }
@@ -78,17 +95,27 @@ void    bl_sam_buff_check_order(bl_sam_buff_t *sam_buff,
  *      by bl_sam_buff_add_alignment(3) if needed.  A minimum MAPQ value
  *      is stored in the bl_sam_buff_t structure for filtering with
  *      bl_sam_buff_alignment_ok(3).
+ *
+ *      The buffer is a circular queue of reusable alignment slots.
+ *      Free it with bl_sam_buff_free(3) when done.
+ *
+ *      By default, adding an alignment fails when max_alignments are
+ *      buffered.  Use bl_sam_buff_set_overflow_mode(3) to spill the
+ *      excess to a temporary file instead.
  *  
  *  Arguments:
  *      sam_buff    Pointer to a the bl_sam_buff_t structure to initialize
  *      mapq_min    User-selected minimum MAPQ value
  *
  *  See also:
- *      bl_sam_buff_check_order(3), bl_sam_read(3)
+ *      bl_sam_buff_check_order(3), bl_sam_read(3), bl_sam_buff_free(3)
  *
  *  History: 
  *  Date        Name        Modification
  *  2020-05-27  Jason Bacon Begin
+ *  2026-10-17  agent       Initialize previous_rname_id
+ *  2026-10-17  agent       Initialize head of circular queue
+ *  2026-10-17  agent       Initialize overflow mode and spill state
  ***************************************************************************/
 
 void    bl_sam_buff_init(bl_sam_buff_t *sam_buff, unsigned int mapq_min,
@@ -97,6 +124,7 @@ void    bl_sam_buff_init(bl_sam_buff_t *sam_buff, unsigned int mapq_min,
 {
     size_t  c;
     
+    // Must be a power of 2 for BL_SAM_BUFF_ALIGNMENTS_AE()
     sam_buff->buff_size = BL_SAM_BUFF_START_SIZE;
     sam_buff->max_alignments = max_alignments;
     
@@ -114,10 +142,18 @@ void    bl_sam_buff_init(bl_sam_buff_t *sam_buff, unsigned int mapq_min,
     for (c = 0; c < sam_buff->buff_size; ++c)
 	sam_buff->alignments[c] = NULL;
 
+    sam_buff->head = 0;
     sam_buff->buffered_count = 0;
     sam_buff->max_count = 0;
+    sam_buff->overflow_mode = BL_SAM_BUFF_OVERFLOW_FAIL;
+    sam_buff->spill_stream = NULL;
+    sam_buff->spill_count = 0;
+    sam_buff->max_spill_count = 0;
+    sam_buff->spill_read_offset = 0;
+    sam_buff->spill_appending = true;
     sam_buff->previous_pos = 0;
     *sam_buff->previous_rname = '\0';
+    sam_buff->previous_rname_id = BL_CHROM_ID_NONE;
     
     sam_buff->mapq_min = mapq_min;
     sam_buff->mapq_low = UINT64_MAX;
@@ -145,56 +181,225 @@ void    bl_sam_buff_init(bl_sam_buff_t *sam_buff, unsigned int mapq_min,
  *      -lbiolibc -lxtend
  *
  *  Description:
- *      Add a new alignment to the buffer, expanding the array as needed
- *      up to BL_SAM_BUFF_MAX_SIZE.
+ *      Add a copy of a new alignment to the buffer, expanding the array
+ *      as needed up to BL_SAM_BUFF_MAX_SIZE.  The copy goes into a
+ *      pooled slot whose buffers are reused with bl_sam_copy_reuse(3),
+ *      so once the buffer has reached its working depth no memory is
+ *      allocated.  If sam_alignment is not needed after adding it, use
+ *      bl_sam_buff_move_alignment(3) to avoid copying sequence data.
  *  
  *  Arguments:
  *      sam_buff    Pointer to bl_sam_buff_t structure where alignments are buffered
  *      sam_alignment   New SAM alignment to add to buffer
  *
+ *  Returns:
+ *      BL_SAM_BUFF_OK on success
+ *      BL_SAM_BUFF_ADD_FAILED if max_alignments is reached
+ *
  *  See also:
- *      bl_sam_buff_init(3), bl_sam_buff_check_order(3)
+ *      bl_sam_buff_init(3), bl_sam_buff_check_order(3),
+ *      bl_sam_buff_move_alignment(3)
  *
  *  History: 
  *  Date        Name        Modification
  *  2020-05-27  Jason Bacon Begin
+ *  2026-10-17  agent       Copy into a pooled slot, reusing its buffers
  ***************************************************************************/
 
 int     bl_sam_buff_add_alignment(bl_sam_buff_t *sam_buff,
 			       bl_sam_t *sam_alignment)
 
 {
-    size_t  old_buff_size,
-	    c;
+    bl_sam_copy_reuse(bl_sam_buff_tail_slot(sam_buff), sam_alignment);
+    return bl_sam_buff_commit_tail(sam_buff);
+}
 
-    bl_sam_buff_check_order(sam_buff, sam_alignment);
-    
-    sam_buff->mapq_low = XT_MIN(sam_buff->mapq_low, BL_SAM_MAPQ(sam_alignment));
-    sam_buff->mapq_high = XT_MAX(sam_buff->mapq_high, BL_SAM_MAPQ(sam_alignment));
-    sam_buff->mapq_sum += BL_SAM_MAPQ(sam_alignment);
-    ++sam_buff->reads_used;
 
-    // Just allocate the static fields, bl_sam_copy() does the rest
-    if ( sam_buff->alignments[sam_buff->buffered_count] == NULL )
+/***************************************************************************
+ *  Name:
+ *      bl_sam_buff_move_alignment() - Move alignment into SAM buffer
+ *
+ *  Library:
+ *      #include <biolibc/sam-buff.h>
+ *      -lbiolibc -lxtend
+ *
+ *  Description:
+ *      Add a new alignment to the buffer by moving it into a pooled
+ *      slot with bl_sam_move(3) instead of copying it.  The buffers
+ *      of sam_alignment are handed to the slot, and the slot's old
+ *      buffers are handed back to sam_alignment, where the next
+ *      bl_sam_read(3) or bl_bam_read(3) reuses them.  No sequence data
+ *      is copied and, once the buffer has reached its working depth, no
+ *      memory is allocated.
+ *
+ *      After the move, sam_alignment has empty names and sequence and
+ *      should only be read into or freed.  The buffered copy is
+ *      accessed with BL_SAM_BUFF_ALIGNMENTS_AE(sam_buff,
+ *      BL_SAM_BUFF_BUFFERED_COUNT(sam_buff) - 1).
+ *  
+ *  Arguments:
+ *      sam_buff    Pointer to bl_sam_buff_t structure where alignments are buffered
+ *      sam_alignment   New SAM alignment to move into buffer
+ *
+ *  Returns:
+ *      BL_SAM_BUFF_OK on success
+ *      BL_SAM_BUFF_ADD_FAILED if max_alignments is reached
+ *
+ *  Examples:
+ *      bl_sam_buff_t   sam_buff;
+ *      bl_sam_t        alignment = BL_SAM_INIT;
+ *
+ *      bl_sam_buff_init(&sam_buff, 0, 500000);
+ *      while ( bl_sam_read(&alignment, stdin, BL_SAM_FIELD_ALL)
+ *              == BL_READ_OK )
+ *      {
+ *          if ( bl_sam_buff_alignment_ok(&sam_buff, &alignment) &&
+ *               (bl_sam_buff_move_alignment(&sam_buff, &alignment)
+ *                != BL_SAM_BUFF_OK) )
+ *              exit(EX_DATAERR);
+ *          ...
+ *      }
+ *      bl_sam_free(&alignment);
+ *      bl_sam_buff_free(&sam_buff);
+ *
+ *  See also:
+ *      bl_sam_buff_add_alignment(3), bl_sam_move(3), bl_sam_buff_shift(3)
+ *
+ *  History: 
+ *  Date        Name        Modification
+ *  2026-10-17  agent       Begin
+ ***************************************************************************/
+
+int     bl_sam_buff_move_alignment(bl_sam_buff_t *sam_buff,
+				   bl_sam_t *sam_alignment)
+
+{
+    bl_sam_move(bl_sam_buff_tail_slot(sam_buff), sam_alignment);
+    return bl_sam_buff_commit_tail(sam_buff);
+}
+
+
+/***************************************************************************
+ *  Name:
+ *      bl_sam_buff_tail_slot() - Get the free slot after the last alignment
+ *
+ *  Library:
+ *      #include <biolibc/sam-buff.h>
+ *      -lbiolibc -lxtend
+ *
+ *  Description:
+ *      Return the pooled slot following the last buffered alignment,
+ *      allocating and initializing it if it has not been used before.
+ *      The slot is not part of the buffer until bl_sam_buff_commit_tail(3)
+ *      is called, so an alignment can be read directly into it and
+ *      discarded by simply not committing it.
+ *
+ *      bl_sam_buff_add_alignment(3) and bl_sam_buff_move_alignment(3)
+ *      are built on this function and are sufficient for most uses.
+ *  
+ *  Arguments:
+ *      sam_buff    Pointer to bl_sam_buff_t structure where alignments are buffered
+ *
+ *  Returns:
+ *      Pointer to an initialized bl_sam_t structure owned by sam_buff
+ *
+ *  Examples:
+ *      bl_sam_t    *slot;
+ *
+ *      slot = bl_sam_buff_tail_slot(&sam_buff);
+ *      if ( (bl_sam_read(slot, stdin, BL_SAM_FIELD_ALL) == BL_READ_OK) &&
+ *           bl_sam_buff_alignment_ok(&sam_buff, slot) )
+ *          bl_sam_buff_commit_tail(&sam_buff);
+ *
+ *  See also:
+ *      bl_sam_buff_commit_tail(3), bl_sam_buff_add_alignment(3)
+ *
+ *  History: 
+ *  Date        Name        Modification
+ *  2026-10-17  agent       Begin
+ ***************************************************************************/
+
+bl_sam_t    *bl_sam_buff_tail_slot(bl_sam_buff_t *sam_buff)
+
+{
+    bl_sam_t    **slot;
+    
+    // buffered_count < buff_size is guaranteed by bl_sam_buff_commit_tail()
+    slot = &BL_SAM_BUFF_ALIGNMENTS_AE(sam_buff, sam_buff->buffered_count);
+    if ( *slot == NULL )
     {
 	//fprintf(stderr, "Allocating alignment #%zu\n", sam_buff->buffered_count);
-	sam_buff->alignments[sam_buff->buffered_count] = 
-	    xt_malloc(1, sizeof(bl_sam_t));
-	if ( sam_buff->alignments[sam_buff->buffered_count] == NULL )
+	if ( (*slot = xt_malloc(1, sizeof(bl_sam_t))) == NULL )
 	{
-	    fprintf(stderr, "bl_sam_buff_add_alignment(): Could not allocate alignments.\n");
+	    fprintf(stderr, "bl_sam_buff_tail_slot(): Could not allocate alignments.\n");
 	    exit(EX_UNAVAILABLE);
 	}
-	// FIXME: Should be redundant to bl_sam_copy()
-	// bl_sam_init(sam_buff->alignments[sam_buff->buffered_count]);
+	bl_sam_init(*slot);
     }
-    else
-	bl_sam_free(sam_buff->alignments[sam_buff->buffered_count]);
+    return *slot;
+}
+
+
+/***************************************************************************
+ *  Name:
+ *      bl_sam_buff_commit_tail() - Add the tail slot to a SAM buffer
+ *
+ *  Library:
+ *      #include <biolibc/sam-buff.h>
+ *      -lbiolibc -lxtend
+ *
+ *  Description:
+ *      Append the alignment stored in the slot returned by
+ *      bl_sam_buff_tail_slot(3) to the buffer.  The sort order is
+ *      checked, MAPQ statistics are updated, and the array is doubled
+ *      if it is now full, up to max_alignments.  Doubling moves the
+ *      wrapped part of the circular queue so that the order of buffered
+ *      alignments is preserved.
+ *
+ *      In BL_SAM_BUFF_OVERFLOW_SPILL mode, the alignment is passed to
+ *      bl_sam_buff_spill(3) instead if max_alignments are already
+ *      buffered or earlier alignments are still spilled.
+ *  
+ *  Arguments:
+ *      sam_buff    Pointer to bl_sam_buff_t structure where alignments are buffered
+ *
+ *  Returns:
+ *      BL_SAM_BUFF_OK on success
+ *      BL_SAM_BUFF_ADD_FAILED if max_alignments is reached in
+ *      BL_SAM_BUFF_OVERFLOW_FAIL mode, or spilling fails
+ *
+ *  See also:
+ *      bl_sam_buff_tail_slot(3), bl_sam_buff_add_alignment(3)
+ *
+ *  History: 
+ *  Date        Name        Modification
+ *  2026-10-17  agent       Begin
+ *  2026-10-17  agent       Spill past max_alignments in spill mode
+ ***************************************************************************/
+
+int     bl_sam_buff_commit_tail(bl_sam_buff_t *sam_buff)
+
+{
+    bl_sam_t    *sam_alignment;
+    size_t      old_buff_size,
+		c;
+
+    sam_alignment = BL_SAM_BUFF_ALIGNMENTS_AE(sam_buff, sam_buff->buffered_count);
+    bl_sam_buff_check_order(sam_buff, sam_alignment);
+    
+    sam_buff->mapq_low = XT_MIN(sam_buff->mapq_low, BL_SAM_MAPQ(sam_alignment));
+    sam_buff->mapq_high = XT_MAX(sam_buff->mapq_high, BL_SAM_MAPQ(sam_alignment));
+    sam_buff->mapq_sum += BL_SAM_MAPQ(sam_alignment);
+    ++sam_buff->reads_used;
 
+    // Once spilling, newer alignments must queue behind the spilled ones
+    if ( (sam_buff->overflow_mode == BL_SAM_BUFF_OVERFLOW_SPILL) &&
+	 ((sam_buff->spill_count > 0) ||
+	  (sam_buff->buffered_count == sam_buff->max_alignments)) )
+	return bl_sam_buff_spill(sam_buff, sam_alignment);
+    
     //fprintf(stderr, "Adding alignment #%zu...\n", sam_buff->buffered_count);
     //fprintf(stderr, "buff_size = %zu\n", sam_buff->buff_size);
-    bl_sam_copy(sam_buff->alignments[sam_buff->buffered_count], sam_alignment);
-    
     ++sam_buff->buffered_count;
 
     if ( sam_buff->buffered_count > sam_buff->max_count )
@@ -203,10 +408,11 @@ int     bl_sam_buff_add_alignment(bl_sam_buff_t *sam_buff,
 	// fprintf(stderr, "sam_buff->max_count = %zu\n", sam_buff->max_count);
     }
     
-    if ( sam_buff->buffered_count == sam_buff->max_alignments )
+    if ( (sam_buff->buffered_count == sam_buff->max_alignments) &&
+	 (sam_buff->overflow_mode == BL_SAM_BUFF_OVERFLOW_FAIL) )
     {
 	fprintf(stderr,
-		"bl_sam_buff_add_alignment(): Hit maximum alignments=%zu.\n",
+		"bl_sam_buff_commit_tail(): Hit maximum alignments=%zu.\n",
 		sam_buff->max_alignments);
 	fprintf(stderr, "Aborting add to prevent runaway memory use.\n");
 	fprintf(stderr, "Check your SAM input.\n");
@@ -216,7 +422,7 @@ int     bl_sam_buff_add_alignment(bl_sam_buff_t *sam_buff,
     if ( sam_buff->buffered_count == sam_buff->buff_size )
     {
 	fprintf(stderr,
-		"bl_sam_buff_add_alignment(): Hit buff_size=%zu, doubling buffer size.\n",
+		"bl_sam_buff_commit_tail(): Hit buff_size=%zu, doubling buffer size.\n",
 		sam_buff->buff_size);
 	fprintf(stderr, "RNAME: %s  POS: %" PRId64 " LEN: %zu\n",
 		BL_SAM_RNAME(sam_alignment), BL_SAM_POS(sam_alignment),
@@ -227,13 +433,170 @@ int     bl_sam_buff_add_alignment(bl_sam_buff_t *sam_buff,
 	    (bl_sam_t **)xt_realloc(sam_buff->alignments,
 					sam_buff->buff_size,
 					sizeof(bl_sam_t **));
-	for (c = old_buff_size; c < sam_buff->buff_size; ++c)
+	if ( sam_buff->alignments == NULL )
+	{
+	    fprintf(stderr, "bl_sam_buff_commit_tail(): Could not allocate alignments.\n");
+	    exit(EX_UNAVAILABLE);
+	}
+	
+	/*
+	 *  The queue was full, so it occupies the whole old array, from
+	 *  head to the end and then wrapping around to head - 1.  Move
+	 *  the wrapped part to just past the old end so that the queue is
+	 *  contiguous from head in the larger array.
+	 */
+	for (c = 0; c < sam_buff->head; ++c)
+	{
+	    sam_buff->alignments[old_buff_size + c] = sam_buff->alignments[c];
 	    sam_buff->alignments[c] = NULL;
+	}
+	for (c = old_buff_size + sam_buff->head; c < sam_buff->buff_size; ++c)
+	    sam_buff->alignments[c] = NULL;
+    }
+    return BL_SAM_BUFF_OK;
+}
+
+
+/***************************************************************************
+ *  Name:
+ *      bl_sam_buff_spill() - Append an alignment to the spill file
+ *
+ *  Library:
+ *      #include <biolibc/sam-buff.h>
+ *      -lbiolibc -lxtend
+ *
+ *  Description:
+ *      Append an alignment that does not fit within max_alignments to
+ *      the spill file of sam_buff, creating it with tmpfile(3) on first
+ *      use.  Alignments are written with bl_sam_write_raw(3) and paged
+ *      back in, in order, by bl_sam_buff_unspill(3) as
+ *      bl_sam_buff_shift(3) makes room.  Spilled alignments are not
+ *      included in buffered_count and cannot be accessed until paged in.
+ *
+ *      This is called by bl_sam_buff_commit_tail(3) in
+ *      BL_SAM_BUFF_OVERFLOW_SPILL mode and is rarely useful otherwise.
+ *  
+ *  Arguments:
+ *      sam_buff        Pointer to bl_sam_buff_t structure
+ *      sam_alignment   Alignment to spill
+ *
+ *  Returns:
+ *      BL_SAM_BUFF_OK on success
+ *      BL_SAM_BUFF_ADD_FAILED if the spill file cannot be created or written
+ *
+ *  See also:
+ *      bl_sam_buff_unspill(3), bl_sam_buff_set_overflow_mode(3)
+ *
+ *  History: 
+ *  Date        Name        Modification
+ *  2026-10-17  agent       Begin
+ ***************************************************************************/
+
+int     bl_sam_buff_spill(bl_sam_buff_t *sam_buff, bl_sam_t *sam_alignment)
+
+{
+    if ( sam_buff->spill_stream == NULL )
+    {
+	if ( (sam_buff->spill_stream = tmpfile()) == NULL )
+	{
+	    fprintf(stderr, "bl_sam_buff_spill(): Could not create spill file.\n");
+	    return BL_SAM_BUFF_ADD_FAILED;
+	}
+	fprintf(stderr,
+		"bl_sam_buff_spill(): Hit maximum alignments=%zu, spilling to disk.\n",
+		sam_buff->max_alignments);
+	fprintf(stderr, "RNAME: %s  POS: %" PRId64 "\n",
+		BL_SAM_RNAME(sam_alignment), BL_SAM_POS(sam_alignment));
+    }
+    
+    // Reads by bl_sam_buff_unspill() leave the stream mid-file
+    if ( ! sam_buff->spill_appending )
+    {
+	fseeko(sam_buff->spill_stream, 0, SEEK_END);
+	sam_buff->spill_appending = true;
+    }
+    
+    if ( bl_sam_write_raw(sam_alignment, sam_buff->spill_stream)
+	    != BL_WRITE_OK )
+    {
+	fprintf(stderr, "bl_sam_buff_spill(): Could not write spill file.\n");
+	return BL_SAM_BUFF_ADD_FAILED;
     }
+    if ( ++sam_buff->spill_count > sam_buff->max_spill_count )
+	sam_buff->max_spill_count = sam_buff->spill_count;
     return BL_SAM_BUFF_OK;
 }
 
 
+/***************************************************************************
+ *  Name:
+ *      bl_sam_buff_unspill() - Page spilled alignments back into buffer
+ *
+ *  Library:
+ *      #include <biolibc/sam-buff.h>
+ *      -lbiolibc -lxtend
+ *
+ *  Description:
+ *      Move the oldest spilled alignments from the spill file into the
+ *      buffer until max_alignments are buffered or none remain.  Order
+ *      and MAPQ statistics were handled when the alignments were first
+ *      added, so they are simply appended.  When the spill file is
+ *      empty, it is truncated so that disk use stays bounded by the
+ *      deepest overflow.
+ *
+ *      This is called by bl_sam_buff_shift(3) and is rarely useful
+ *      otherwise.  A read error on the spill file is fatal, since
+ *      alignments would otherwise be silently lost.
+ *  
+ *  Arguments:
+ *      sam_buff    Pointer to bl_sam_buff_t structure
+ *
+ *  See also:
+ *      bl_sam_buff_spill(3), bl_sam_buff_shift(3)
+ *
+ *  History: 
+ *  Date        Name        Modification
+ *  2026-10-17  agent       Begin
+ ***************************************************************************/
+
+void    bl_sam_buff_unspill(bl_sam_buff_t *sam_buff)
+
+{
+    // Writes by bl_sam_buff_spill() leave the stream at the end
+    if ( sam_buff->spill_appending )
+    {
+	fflush(sam_buff->spill_stream);
+	fseeko(sam_buff->spill_stream, sam_buff->spill_read_offset, SEEK_SET);
+	sam_buff->spill_appending = false;
+    }
+    
+    // buffered_count < max_alignments < buff_size, so tail slot exists
+    while ( (sam_buff->spill_count > 0) &&
+	    (sam_buff->buffered_count < sam_buff->max_alignments) )
+    {
+	if ( bl_sam_read_raw(bl_sam_buff_tail_slot(sam_buff),
+			     sam_buff->spill_stream) != BL_READ_OK )
+	{
+	    fprintf(stderr, "bl_sam_buff_unspill(): Could not read spill file.\n");
+	    exit(EX_IOERR);
+	}
+	++sam_buff->buffered_count;
+	--sam_buff->spill_count;
+    }
+    
+    if ( sam_buff->spill_count == 0 )
+    {
+	rewind(sam_buff->spill_stream);
+	if ( ftruncate(fileno(sam_buff->spill_stream), 0) != 0 )
+	    fprintf(stderr, "bl_sam_buff_unspill(): Warning: Could not truncate spill file.\n");
+	sam_buff->spill_read_offset = 0;
+	sam_buff->spill_appending = true;
+    }
+    else
+	sam_buff->spill_read_offset = ftello(sam_buff->spill_stream);
+}
+
+
 /***************************************************************************
  *  Name:
  *      bl_sam_buff_out_of_order() - Print sort order message and exit
@@ -282,11 +645,15 @@ void    bl_sam_buff_out_of_order(bl_sam_buff_t *sam_buff, bl_sam_t *sam_alignmen
  *  Description:
  *      Free an element of the SAM alignment array by first freeing all
  *      memory allocated by the bl_sam_t structure and then freeing
- *      memory allocated for the structure itself.
+ *      memory allocated for the structure itself.  The slot will be
+ *      reallocated if needed again.  This is not necessary for normal
+ *      use, since bl_sam_buff_shift(3) retains slots for reuse, but can
+ *      be used to release the memory held by an unusually large
+ *      alignment.
  *  
  *  Arguments:
  *      sam_buff    Pointer to the bl_sam_buff_t structure holding alignments
- *      c           Index of the alignment to be freed (0-based)
+ *      c           Index of the alignment to be freed (0-based, from head)
  *
  *  See also:
  *      bl_sam_buff_init(3), bl_sam_buff_add_alignment(3)
@@ -294,71 +661,144 @@ void    bl_sam_buff_out_of_order(bl_sam_buff_t *sam_buff, bl_sam_t *sam_alignmen
  *  History: 
  *  Date        Name        Modification
  *  2020-05-29  Jason Bacon Begin
+ *  2026-10-17  agent       Index from head of circular queue
  ***************************************************************************/
 
 void    bl_sam_buff_free_alignment(bl_sam_buff_t *sam_buff, size_t c)
 
 {
-    bl_sam_free(sam_buff->alignments[c]);
-    bl_sam_init(sam_buff->alignments[c]);
-    if ( sam_buff->alignments[c] != NULL )
+    bl_sam_t    **slot = &BL_SAM_BUFF_ALIGNMENTS_AE(sam_buff, c);
+    
+    if ( *slot != NULL )
     {
-	free(sam_buff->alignments[c]);
-	sam_buff->alignments[c] = NULL;
+	bl_sam_free(*slot);
+	free(*slot);
+	*slot = NULL;
     }
 }
 
 
 /***************************************************************************
  *  Name:
- *      bl_sam_buff_shift() - Close gap after removing a SAM alignment
+ *      bl_sam_buff_shift() - Remove alignments from head of SAM buffer
  *
  *  Library:
  *      #include <biolibc/sam-buff.h>
  *      -lbiolibc -lxtend
  *
  *  Description:
- *      Free nelem SAM alignments at the head of the queue and shift
- *      remaining elements forward nelem positions.
+ *      Remove nelem SAM alignments at the head of the queue.  Since the
+ *      buffer is a circular queue, this only advances the head, and does
+ *      not move any other alignments.  The removed slots keep their
+ *      buffers for reuse by later bl_sam_buff_add_alignment(3) or
+ *      bl_sam_buff_move_alignment(3) calls.  If alignments have been
+ *      spilled, as many as now fit are paged back in by
+ *      bl_sam_buff_unspill(3).
  *  
  *  Arguments:
  *      sam_buff    Pointer to bl_sam_buff_t structure holding alignments
- *      nelem       Number of alignments to free
+ *      nelem       Number of alignments to remove
  *
  *  See also:
- *      bl_sam_buff_free_alignment(3)
- *
- *  FIXME: Use circular queuing for better efficiency
+ *      bl_sam_buff_free_alignment(3), bl_sam_buff_free(3)
  *
  *  History: 
  *  Date        Name        Modification
  *  2020-05-29  Jason Bacon Begin
+ *  2026-10-17  agent       Advance head of circular queue instead of
+ *                          freeing and shifting
+ *  2026-10-17  agent       Page in spilled alignments
  ***************************************************************************/
 
 void    bl_sam_buff_shift(bl_sam_buff_t *sam_buff, size_t nelem)
 
 {
-    size_t  c;
+    sam_buff->head = (sam_buff->head + nelem) & (sam_buff->buff_size - 1);
+    sam_buff->buffered_count -= nelem;
+    if ( sam_buff->spill_count > 0 )
+	bl_sam_buff_unspill(sam_buff);
+}
 
-    /*
-     *  FIXME: A circular queue would be more efficient, but won't matter
-     *  much to the bottom line to avoid shifting a few pointers on top
-     *  of everything else going on here
-     */
-    
-    /* Make susre elements to be removed are freed */
-    for (c = 0; c < nelem; ++c)
-	bl_sam_buff_free_alignment(sam_buff, c);
 
-    /* Shift elements */
-    for (c = 0; c < sam_buff->buffered_count - nelem; ++c)
-	sam_buff->alignments[c] = sam_buff->alignments[c + nelem];
-    
-    /* Clear vacated elements */
-    while ( c < sam_buff->buffered_count )
-	sam_buff->alignments[c++] = NULL;
+/***************************************************************************
+ *  Name:
+ *      bl_sam_buff_release_behind() - Remove alignments ending before a position
+ *
+ *  Library:
+ *      #include <biolibc/sam-buff.h>
+ *      -lbiolibc -lxtend
+ *
+ *  Description:
+ *      Remove every buffered alignment whose reference end,
+ *      BL_SAM_REF_END(3), lies before pos on chrom, or that is on an
+ *      earlier chromosome.  This is meant for sweeping a sorted SAM
+ *      stream along sorted positions such as VCF calls: once a position
+ *      is past an alignment, all later positions are too, so the
+ *      alignment can be released immediately.
+ *
+ *      Alignments are sorted by start, not by end, so finished
+ *      alignments may be interleaved with long ones still in use.
+ *      Those that remain are packed toward the tail, preserving their
+ *      order, by swapping slot pointers, and the finished ones are then
+ *      removed from the head with bl_sam_buff_shift(3).  No alignment
+ *      data is copied.
+ *
+ *      If the alignments and chrom share a chromosome dictionary,
+ *      chromosomes are compared by ID.
+ *  
+ *  Arguments:
+ *      sam_buff    Pointer to bl_sam_buff_t structure holding alignments
+ *      dict        Chromosome dictionary for chrom_id, or NULL
+ *      chrom_id    ID of chrom in dict, or BL_CHROM_ID_NONE
+ *      chrom       Chromosome of the current position
+ *      pos         Current position
+ *
+ *  Returns:
+ *      The number of alignments removed
+ *
+ *  See also:
+ *      bl_sam_buff_shift(3), bl_vcf_allele_depths(3)
+ *
+ *  History: 
+ *  Date        Name        Modification
+ *  2026-10-17  agent       Begin
+ ***************************************************************************/
+
+size_t  bl_sam_buff_release_behind(bl_sam_buff_t *sam_buff,
+	    bl_chrom_dict_t *dict, int32_t chrom_id, const char *chrom,
+	    int64_t pos)
+
+{
+    bl_sam_t    *alignment;
+    size_t      c, keep, released;
+    int         chrom_cmp;
     
-    sam_buff->buffered_count -= nelem;
+    // Walk from the tail so kept alignments stay in order
+    keep = sam_buff->buffered_count;
+    for (c = sam_buff->buffered_count; c-- > 0; )
+    {
+	alignment = BL_SAM_BUFF_ALIGNMENTS_AE(sam_buff, c);
+	if ( BL_CHROM_IDS_COMPARABLE(alignment->chrom_dict,
+		alignment->rname_id, dict, chrom_id) )
+	    chrom_cmp = bl_chrom_dict_cmp(dict, alignment->rname_id, chrom_id);
+	else
+	    chrom_cmp = bl_chrom_name_cmp(BL_SAM_RNAME(alignment), chrom);
+	if ( (chrom_cmp > 0) ||
+	     ((chrom_cmp == 0) && (BL_SAM_REF_END(alignment) >= pos)) )
+	{
+	    --keep;
+	    if ( keep != c )
+	    {
+		BL_SAM_BUFF_ALIGNMENTS_AE(sam_buff, c) =
+		    BL_SAM_BUFF_ALIGNMENTS_AE(sam_buff, keep);
+		BL_SAM_BUFF_ALIGNMENTS_AE(sam_buff, keep) = alignment;
+	    }
+	}
+    }
+    released = keep;
+    if ( released > 0 )
+	bl_sam_buff_shift(sam_buff, released);
+    return released;
 }
 
 
@@ -427,3 +867,54 @@ bool    bl_sam_buff_alignment_ok(bl_sam_buff_t *sam_buff,
     else
 	return true;
 }
+
+
+/***************************************************************************
+ *  Name:
+ *      bl_sam_buff_free() - Free all memory held by a SAM buffer
+ *
+ *  Library:
+ *      #include <biolibc/sam-buff.h>
+ *      -lbiolibc -lxtend
+ *
+ *  Description:
+ *      Free all alignment slots, both buffered and pooled for reuse, and
+ *      the slot array of a SAM buffer initialized by bl_sam_buff_init(3).
+ *      The spill file, if any, is closed and thereby removed.
+ *  
+ *  Arguments:
+ *      sam_buff    Pointer to bl_sam_buff_t structure to free
+ *
+ *  See also:
+ *      bl_sam_buff_init(3), bl_sam_buff_free_alignment(3)
+ *
+ *  History: 
+ *  Date        Name        Modification
+ *  2026-10-17  agent       Begin
+ ***************************************************************************/
+
+void    bl_sam_buff_free(bl_sam_buff_t *sam_buff)
+
+{
+    size_t  c;
+    
+    for (c = 0; c < sam_buff->buff_size; ++c)
+    {
+	if ( sam_buff->alignments[c] != NULL )
+	{
+	    bl_sam_free(sam_buff->alignments[c]);
+	    free(sam_buff->alignments[c]);
+	}
+    }
+    free(sam_buff->alignments);
+    sam_buff->alignments = NULL;
+    if ( sam_buff->spill_stream != NULL )
+    {
+	fclose(sam_buff->spill_stream);
+	sam_buff->spill_stream = NULL;
+    }
+    sam_buff->spill_count = 0;
+    sam_buff->buff_size = 0;
+    sam_buff->head = 0;
+    sam_buff->buffered_count = 0;
+}
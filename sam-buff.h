@@ -2,6 +2,10 @@
 #ifndef _BIOLIBC_SAM_BUFF_H_
 #define _BIOLIBC_SAM_BUFF_H_
 
+#ifndef _SYS_TYPES_H_
+#include <sys/types.h>      // off_t
+#endif
+
 #ifndef __bool_true_false_are_defined
 #include <stdbool.h>
 #endif
@@ -38,6 +42,15 @@
 #define BL_SAM_BUFF_OK          0
 #define BL_SAM_BUFF_ADD_FAILED  1
 
+/*
+ *  What to do when max_alignments are buffered.  With
+ *  BL_SAM_BUFF_OVERFLOW_SPILL, newer alignments are appended to a
+ *  temporary file and paged back in by bl_sam_buff_shift() as room
+ *  frees up, so memory use stays bounded by max_alignments.
+ */
+#define BL_SAM_BUFF_OVERFLOW_FAIL   0
+#define BL_SAM_BUFF_OVERFLOW_SPILL  1
+
 /*
  *  Copied from htslib/sam.h to avoid an htslib dependency.  It should be
  *  safe to assume this will never change, since changing it would break
@@ -45,16 +58,37 @@
  */
 #define     BAM_FUNMAP  4
 
+/*
+ *  alignments is a circular queue of pooled slots.  The buffered
+ *  alignments are the buffered_count slots starting at head, wrapping
+ *  around the end of the array.  buff_size is always a power of 2 so
+ *  that wrapping is a mask.  Use BL_SAM_BUFF_ALIGNMENTS_AE(), which
+ *  takes a 0-based index from the head, rather than alignments[] directly.
+ *  Slots and their sequence buffers are reused after bl_sam_buff_shift()
+ *  and freed only by bl_sam_buff_free().
+ *
+ *  In spill mode, spill_count alignments newer than the last buffered
+ *  one wait in spill_stream, in order, starting at spill_read_offset.
+ */
+
 // FIXME: Move this to samio when complete?
 typedef struct
 {
     size_t      buff_size;
     size_t      max_alignments;
     bl_sam_t    **alignments;
+    size_t      head;           // Index in alignments of oldest alignment
     size_t      buffered_count;
     size_t      max_count;
+    int         overflow_mode;
+    FILE        *spill_stream;      // Created on first spill
+    size_t      spill_count,
+		max_spill_count;
+    off_t       spill_read_offset;
+    bool        spill_appending;    // spill_stream is positioned at end
     int64_t     previous_pos;
     char        previous_rname[BL_SAM_RNAME_MAX_CHARS + 1];
+    int32_t     previous_rname_id;  // If alignments have a chrom_dict
     
     // Use 64 bits to accommodate large sums
     int64_t     mapq_min,
@@ -85,9 +119,16 @@ typedef struct
 void bl_sam_buff_check_order(bl_sam_buff_t *sam_buff, bl_sam_t *sam_alignment);
 void bl_sam_buff_init(bl_sam_buff_t *sam_buff, unsigned int mapq_min, size_t max_alignments);
 int bl_sam_buff_add_alignment(bl_sam_buff_t *sam_buff, bl_sam_t *sam_alignment);
+int bl_sam_buff_move_alignment(bl_sam_buff_t *sam_buff, bl_sam_t *sam_alignment);
+bl_sam_t *bl_sam_buff_tail_slot(bl_sam_buff_t *sam_buff);
+int bl_sam_buff_commit_tail(bl_sam_buff_t *sam_buff);
+int bl_sam_buff_spill(bl_sam_buff_t *sam_buff, bl_sam_t *sam_alignment);
+void bl_sam_buff_unspill(bl_sam_buff_t *sam_buff);
 void bl_sam_buff_out_of_order(bl_sam_buff_t *sam_buff, bl_sam_t *sam_alignment);
 void bl_sam_buff_free_alignment(bl_sam_buff_t *sam_buff, size_t c);
 void bl_sam_buff_shift(bl_sam_buff_t *sam_buff, size_t nelem);
+size_t bl_sam_buff_release_behind(bl_sam_buff_t *sam_buff, bl_chrom_dict_t *dict, int32_t chrom_id, const char *chrom, int64_t pos);
 bool bl_sam_buff_alignment_ok(bl_sam_buff_t *sam_buff, bl_sam_t *sam_alignment);
+void bl_sam_buff_free(bl_sam_buff_t *sam_buff);
 
 #endif  // _BIOLIBC_SAM_BUFF_H_
@@ -14,108 +14,6 @@
 #include "sam.h"
 
 
-/***************************************************************************
- *  Library:
- *      #include <biolibc/sam.h>
- *      -lbiolibc -lxtend
- *
- *  Description:
- *      Mutator for an array element of qname member in a bl_sam_t
- *      structure. Use this function to set bl_sam_ptr->qname[c]
- *      in a bl_sam_t object from non-member functions.
- *
- *  Arguments:
- *      bl_sam_ptr      Pointer to the structure to set
- *      c               Subscript to the qname array
- *      new_qname_element The new value for qname[c]
- *
- *  Returns:
- *      BL_SAM_DATA_OK if the new value is acceptable and assigned
- *      BL_SAM_DATA_OUT_OF_RANGE otherwise
- *
- *  Examples:
- *      bl_sam_t        bl_sam;
- *      size_t          c;
- *      char            new_qname_element;
- *
- *      if ( bl_sam_set_qname_ae(&bl_sam, c, new_qname_element)
- *              == BL_SAM_DATA_OK )
- *      {
- *      }
- *
- *  See also:
- *      BL_SAM_SET_QNAME_AE(3)
- *
- *  History: 
- *  Date        Name        Modification
- *  2022-04-30  gen-get-set Auto-generated from sam.h
- ***************************************************************************/
-
-int     bl_sam_set_qname_ae(bl_sam_t *bl_sam_ptr, size_t c, char new_qname_element)
-
-{
-    if ( false )
-	return BL_SAM_DATA_OUT_OF_RANGE;
-    else
-    {
-	bl_sam_ptr->qname[c] = new_qname_element;
-	return BL_SAM_DATA_OK;
-    }
-}
-
-
-/***************************************************************************
- *  Library:
- *      #include <biolibc/sam.h>
- *      -lbiolibc -lxtend
- *
- *  Description:
- *      Mutator for qname member in a bl_sam_t structure.
- *      Use this function to set qname in a bl_sam_t object
- *      from non-member functions.  This function copies the array pointed to
- *      by new_qname to bl_sam_ptr->qname.
- *
- *  Arguments:
- *      bl_sam_ptr      Pointer to the structure to set
- *      new_qname       The new value for qname
- *      array_size      Size of the qname array.
- *
- *  Returns:
- *      BL_SAM_DATA_OK if the new value is acceptable and assigned
- *      BL_SAM_DATA_OUT_OF_RANGE otherwise
- *
- *  Examples:
- *      bl_sam_t        bl_sam;
- *      char            new_qname;
- *      size_t          array_size;
- *
- *      if ( bl_sam_set_qname_cpy(&bl_sam, new_qname, array_size)
- *              == BL_SAM_DATA_OK )
- *      {
- *      }
- *
- *  See also:
- *      BL_SAM_SET_QNAME(3)
- *
- *  History: 
- *  Date        Name        Modification
- *  2022-04-30  gen-get-set Auto-generated from sam.h
- ***************************************************************************/
-
-int     bl_sam_set_qname_cpy(bl_sam_t *bl_sam_ptr, char new_qname[], size_t array_size)
-
-{
-    if ( new_qname == NULL )
-	return BL_SAM_DATA_OUT_OF_RANGE;
-    else
-    {
-	// FIXME: Assuming char array is a null-terminated string
-	strlcpy(bl_sam_ptr->qname, new_qname, array_size);
-	return BL_SAM_DATA_OK;
-    }
-}
-
-
 /***************************************************************************
  *  Library:
  *      #include <biolibc/sam.h>
@@ -168,108 +66,6 @@ int     bl_sam_set_flag(bl_sam_t *bl_sam_ptr, unsigned new_flag)
 }
 
 
-/***************************************************************************
- *  Library:
- *      #include <biolibc/sam.h>
- *      -lbiolibc -lxtend
- *
- *  Description:
- *      Mutator for an array element of rname member in a bl_sam_t
- *      structure. Use this function to set bl_sam_ptr->rname[c]
- *      in a bl_sam_t object from non-member functions.
- *
- *  Arguments:
- *      bl_sam_ptr      Pointer to the structure to set
- *      c               Subscript to the rname array
- *      new_rname_element The new value for rname[c]
- *
- *  Returns:
- *      BL_SAM_DATA_OK if the new value is acceptable and assigned
- *      BL_SAM_DATA_OUT_OF_RANGE otherwise
- *
- *  Examples:
- *      bl_sam_t        bl_sam;
- *      size_t          c;
- *      char            new_rname_element;
- *
- *      if ( bl_sam_set_rname_ae(&bl_sam, c, new_rname_element)
- *              == BL_SAM_DATA_OK )
- *      {
- *      }
- *
- *  See also:
- *      BL_SAM_SET_RNAME_AE(3)
- *
- *  History: 
- *  Date        Name        Modification
- *  2022-04-30  gen-get-set Auto-generated from sam.h
- ***************************************************************************/
-
-int     bl_sam_set_rname_ae(bl_sam_t *bl_sam_ptr, size_t c, char new_rname_element)
-
-{
-    if ( false )
-	return BL_SAM_DATA_OUT_OF_RANGE;
-    else
-    {
-	bl_sam_ptr->rname[c] = new_rname_element;
-	return BL_SAM_DATA_OK;
-    }
-}
-
-
-/***************************************************************************
- *  Library:
- *      #include <biolibc/sam.h>
- *      -lbiolibc -lxtend
- *
- *  Description:
- *      Mutator for rname member in a bl_sam_t structure.
- *      Use this function to set rname in a bl_sam_t object
- *      from non-member functions.  This function copies the array pointed to
- *      by new_rname to bl_sam_ptr->rname.
- *
- *  Arguments:
- *      bl_sam_ptr      Pointer to the structure to set
- *      new_rname       The new value for rname
- *      array_size      Size of the rname array.
- *
- *  Returns:
- *      BL_SAM_DATA_OK if the new value is acceptable and assigned
- *      BL_SAM_DATA_OUT_OF_RANGE otherwise
- *
- *  Examples:
- *      bl_sam_t        bl_sam;
- *      char            new_rname;
- *      size_t          array_size;
- *
- *      if ( bl_sam_set_rname_cpy(&bl_sam, new_rname, array_size)
- *              == BL_SAM_DATA_OK )
- *      {
- *      }
- *
- *  See also:
- *      BL_SAM_SET_RNAME(3)
- *
- *  History: 
- *  Date        Name        Modification
- *  2022-04-30  gen-get-set Auto-generated from sam.h
- ***************************************************************************/
-
-int     bl_sam_set_rname_cpy(bl_sam_t *bl_sam_ptr, char new_rname[], size_t array_size)
-
-{
-    if ( new_rname == NULL )
-	return BL_SAM_DATA_OUT_OF_RANGE;
-    else
-    {
-	// FIXME: Assuming char array is a null-terminated string
-	strlcpy(bl_sam_ptr->rname, new_rname, array_size);
-	return BL_SAM_DATA_OK;
-    }
-}
-
-
 /***************************************************************************
  *  Library:
  *      #include <biolibc/sam.h>
@@ -528,108 +324,6 @@ int     bl_sam_set_cigar_cpy(bl_sam_t *bl_sam_ptr, char * new_cigar, size_t arra
 }
 
 
-/***************************************************************************
- *  Library:
- *      #include <biolibc/sam.h>
- *      -lbiolibc -lxtend
- *
- *  Description:
- *      Mutator for an array element of rnext member in a bl_sam_t
- *      structure. Use this function to set bl_sam_ptr->rnext[c]
- *      in a bl_sam_t object from non-member functions.
- *
- *  Arguments:
- *      bl_sam_ptr      Pointer to the structure to set
- *      c               Subscript to the rnext array
- *      new_rnext_element The new value for rnext[c]
- *
- *  Returns:
- *      BL_SAM_DATA_OK if the new value is acceptable and assigned
- *      BL_SAM_DATA_OUT_OF_RANGE otherwise
- *
- *  Examples:
- *      bl_sam_t        bl_sam;
- *      size_t          c;
- *      char            new_rnext_element;
- *
- *      if ( bl_sam_set_rnext_ae(&bl_sam, c, new_rnext_element)
- *              == BL_SAM_DATA_OK )
- *      {
- *      }
- *
- *  See also:
- *      BL_SAM_SET_RNEXT_AE(3)
- *
- *  History: 
- *  Date        Name        Modification
- *  2022-04-30  gen-get-set Auto-generated from sam.h
- ***************************************************************************/
-
-int     bl_sam_set_rnext_ae(bl_sam_t *bl_sam_ptr, size_t c, char new_rnext_element)
-
-{
-    if ( false )
-	return BL_SAM_DATA_OUT_OF_RANGE;
-    else
-    {
-	bl_sam_ptr->rnext[c] = new_rnext_element;
-	return BL_SAM_DATA_OK;
-    }
-}
-
-
-/***************************************************************************
- *  Library:
- *      #include <biolibc/sam.h>
- *      -lbiolibc -lxtend
- *
- *  Description:
- *      Mutator for rnext member in a bl_sam_t structure.
- *      Use this function to set rnext in a bl_sam_t object
- *      from non-member functions.  This function copies the array pointed to
- *      by new_rnext to bl_sam_ptr->rnext.
- *
- *  Arguments:
- *      bl_sam_ptr      Pointer to the structure to set
- *      new_rnext       The new value for rnext
- *      array_size      Size of the rnext array.
- *
- *  Returns:
- *      BL_SAM_DATA_OK if the new value is acceptable and assigned
- *      BL_SAM_DATA_OUT_OF_RANGE otherwise
- *
- *  Examples:
- *      bl_sam_t        bl_sam;
- *      char            new_rnext;
- *      size_t          array_size;
- *
- *      if ( bl_sam_set_rnext_cpy(&bl_sam, new_rnext, array_size)
- *              == BL_SAM_DATA_OK )
- *      {
- *      }
- *
- *  See also:
- *      BL_SAM_SET_RNEXT(3)
- *
- *  History: 
- *  Date        Name        Modification
- *  2022-04-30  gen-get-set Auto-generated from sam.h
- ***************************************************************************/
-
-int     bl_sam_set_rnext_cpy(bl_sam_t *bl_sam_ptr, char new_rnext[], size_t array_size)
-
-{
-    if ( new_rnext == NULL )
-	return BL_SAM_DATA_OUT_OF_RANGE;
-    else
-    {
-	// FIXME: Assuming char array is a null-terminated string
-	strlcpy(bl_sam_ptr->rnext, new_rnext, array_size);
-	return BL_SAM_DATA_OK;
-    }
-}
-
-
 /***************************************************************************
  *  Library:
  *      #include <biolibc/sam.h>
@@ -1352,3 +1046,4 @@ int     bl_sam_set_qual_len(bl_sam_t *bl_sam_ptr, size_t new_qual_len)
 	return BL_SAM_DATA_OK;
     }
 }
+
@@ -1,12 +1,15 @@
 #include <stdio.h>
 #include <stdlib.h>
 #include <string.h>
+#include <stdbool.h>
 #include <sysexits.h>
 #include <xtend/string.h>      // strlcpy() on Linux
 #include <xtend/dsv.h>
 #include <xtend/mem.h>
 #include <xtend/file.h>
+#include <xtend/math.h>     // XT_MIN()
 #include "sam.h"
+#include "bgzf.h"
 #include "biolibc.h"
 #include "biostring.h"
 
@@ -123,6 +126,12 @@ int     bl_sam_copy_header(FILE *header_stream, FILE *sam_stream)
  *  Description:
  *      Read next alignment (line) from a SAM stream.
  *
+ *      The whole line is read into a buffer in alignment that is reused
+ *      for subsequent reads, and all field boundaries are located in a
+ *      single pass.  Only the fields selected by field_mask are then
+ *      converted and copied into alignment, so masking off unneeded
+ *      fields such as SEQ and QUAL reduces CPU time.
+ *
  *      If field_mask is not BL_SAM_FIELD_ALL, fields not indicated by a 1
  *      in the bit mask are discarded rather than stored in alignment.
  *      That field in the structure is then populated with an appropriate
@@ -141,6 +150,11 @@ int     bl_sam_copy_header(FILE *header_stream, FILE *sam_stream)
  *      BL_SAM_FIELD_SEQ
  *      BL_SAM_FIELD_QUAL
  *
+ *      The CIGAR is also parsed into packed operations and ref_end is
+ *      set to the last reference position covered, as described in
+ *      bl_sam_parse_cigar(3).  If BL_SAM_FIELD_CIGAR is masked,
+ *      ref_end assumes an ungapped alignment.
+ *
  *  Arguments:
  *      sam_stream  A FILE stream from which to read the line
  *      alignment   Pointer to a bl_sam_t structure
@@ -162,300 +176,254 @@ int     bl_sam_copy_header(FILE *header_stream, FILE *sam_stream)
  *  History: 
  *  Date        Name        Modification
  *  2019-12-09  Jason Bacon Begin
+ *  2026-10-17  agent       Pack names into one buffer
+ *  2026-10-17  agent       Parse CIGAR into packed ops and set ref_end
+ *  2026-10-17  agent       Drop static previous_pos to make reentrant
  ***************************************************************************/
 
 int     bl_sam_read(bl_sam_t *alignment, FILE *sam_stream,
 			   sam_field_mask_t field_mask)
 
 {
-    char    mapq_str[BL_SAM_MAPQ_MAX_CHARS + 1],
-	    pos_str[BL_POSITION_MAX_DIGITS + 1],
-	    flag_str[BL_SAM_FLAG_MAX_DIGITS + 1],
-	    *end;
-    size_t  len;
-    static int64_t   previous_pos = 0;
-    int     delim;
+    char    *start[BL_SAM_MANDATORY_FIELDS],
+	    *end[BL_SAM_MANDATORY_FIELDS],
+	    *line_end,
+	    *tab,
+	    *p;
+    ssize_t line_len;
+    size_t  fields;
+    int64_t val;
+    int     sign;
     
-    if ( field_mask & BL_SAM_FIELD_QNAME )
-	delim = xt_tsv_read_field(sam_stream, alignment->qname,
-			BL_SAM_QNAME_MAX_CHARS, &len);
-    else
+    line_len = getdelim(&alignment->line, &alignment->line_array_size,
+			'\n', sam_stream);
+    if ( line_len == -1 )
+	return BL_READ_EOF;
+    line_end = alignment->line + line_len;
+    if ( line_end[-1] == '\n' )
+	--line_end;
+    
+    /*
+     *  Locate all field boundaries in a single pass over the line.
+     *  memchr() is vectorized in all mainstream libcs, so long SEQ and
+     *  QUAL fields are scanned many bytes at a time.  Some SRA CRAMs have
+     *  11 fields, most have 12.  Everything after the 11th is ignored.
+     */
+    for (p = alignment->line, fields = 0; fields < BL_SAM_MANDATORY_FIELDS;
+	 ++fields)
     {
-	delim = xt_tsv_skip_field(sam_stream, &len);
-	*alignment->qname = '\0';
+	start[fields] = p;
+	if ( (tab = memchr(p, '\t', line_end - p)) == NULL )
+	{
+	    end[fields++] = line_end;
+	    break;
+	}
+	end[fields] = tab;
+	p = tab + 1;
     }
-    if ( delim == EOF )
-	return BL_READ_EOF;
-
-    // 2 Flag
-    if ( field_mask & BL_SAM_FIELD_FLAG )
-	delim = xt_tsv_read_field(sam_stream, flag_str, BL_SAM_FLAG_MAX_DIGITS, &len);
-    else
-	delim = xt_tsv_skip_field(sam_stream, &len);
-    if ( delim == EOF )
+    if ( fields < BL_SAM_MANDATORY_FIELDS )
     {
-	fprintf(stderr, "bl_sam_read(): Got EOF reading flag: %s.\n",
-		flag_str);
+	fprintf(stderr, "bl_sam_read(): Found %zu fields, expected %d: %.*s\n",
+		fields, BL_SAM_MANDATORY_FIELDS,
+		(int)(line_end - alignment->line), alignment->line);
 	return BL_READ_TRUNCATED;
     }
+    
+    // 1 QNAME, 3 RNAME and 7 RNEXT, first so error messages can report them
+    bl_sam_set_names(alignment,
+		     start[0], field_mask & BL_SAM_FIELD_QNAME ? end[0] - start[0] : 0,
+		     start[2], field_mask & BL_SAM_FIELD_RNAME ? end[2] - start[2] : 0,
+		     start[6], field_mask & BL_SAM_FIELD_RNEXT ? end[6] - start[6] : 0);
+    
+    // 2 FLAG
     if ( field_mask & BL_SAM_FIELD_FLAG )
     {
-	alignment->flag = strtoul(flag_str, &end, 10);
-	if ( *end != '\0' )
+	for (p = start[1], val = 0; (p < end[1]) && (*p >= '0') && (*p <= '9');
+	     ++p)
+	    val = val * 10 + *p - '0';
+	if ( p != end[1] )
 	{
-	    fprintf(stderr, "bl_sam_read(): Invalid position: %s\n",
-		    flag_str);
+	    fprintf(stderr, "bl_sam_read(): Invalid flag: %.*s\n",
+		    (int)(end[1] - start[1]), start[1]);
 	    fprintf(stderr, "qname = %s rname = %s\n",
-		    alignment->qname, alignment->rname);
-	    fprintf(stderr, "previous_pos = %" PRId64 "\n", previous_pos);
+		    BL_SAM_QNAME(alignment), BL_SAM_RNAME(alignment));
 	    exit(EX_DATAERR);
 	}
+	alignment->flag = val;
     }
     else
 	alignment->flag = 0;    // FIXME: Is there a better choice?
     
-    // 3 RNAME
-    if ( field_mask & BL_SAM_FIELD_RNAME )
-	delim = xt_tsv_read_field(sam_stream, alignment->rname,
-			       BL_SAM_RNAME_MAX_CHARS, &len);
-    else
-    {
-	delim = xt_tsv_skip_field(sam_stream, &len);
-	*alignment->rname = '\0';
-    }
-    if ( delim == EOF )
-    {
-	fprintf(stderr, "bl_sam_read(): Got EOF reading rname: %s.\n",
-		alignment->rname);
-	return BL_READ_TRUNCATED;
-    }
-    
     // 4 POS
-    if ( field_mask & BL_SAM_FIELD_POS )
-	delim = xt_tsv_read_field(sam_stream, pos_str, BL_POSITION_MAX_DIGITS,
-			       &len);
-    else
-	delim = xt_tsv_skip_field(sam_stream, &len);
-    if ( delim == EOF )
-    {
-	fprintf(stderr, "bl_sam_read(): Got EOF reading pos: %s.\n",
-		pos_str);
-	return BL_READ_TRUNCATED;
-    }
     if ( field_mask & BL_SAM_FIELD_POS )
     {
-	alignment->pos = strtoul(pos_str, &end, 10);
-	if ( *end != '\0' )
+	for (p = start[3], val = 0; (p < end[3]) && (*p >= '0') && (*p <= '9');
+	     ++p)
+	    val = val * 10 + *p - '0';
+	if ( p != end[3] )
 	{
-	    fprintf(stderr, "bl_sam_read(): Invalid position: %s\n",
-		    pos_str);
+	    fprintf(stderr, "bl_sam_read(): Invalid position: %.*s\n",
+		    (int)(end[3] - start[3]), start[3]);
 	    fprintf(stderr, "qname = %s rname = %s\n",
-		    alignment->qname, alignment->rname);
-	    fprintf(stderr, "previous_pos = %" PRId64 "\n", previous_pos);
+		    BL_SAM_QNAME(alignment), BL_SAM_RNAME(alignment));
 	    exit(EX_DATAERR);
 	}
-	previous_pos = alignment->pos;
+	alignment->pos = val;
     }
     else
 	alignment->pos = 0;
     
     // 5 MAPQ
-    if ( field_mask & BL_SAM_FIELD_MAPQ )
-	delim = xt_tsv_read_field(sam_stream, mapq_str, BL_SAM_MAPQ_MAX_CHARS,
-			       &len);
-    else
-	delim = xt_tsv_skip_field(sam_stream, &len);
-    if ( delim == EOF )
-    {
-	fprintf(stderr, "bl_sam_read(): Got EOF reading mapq: %s.\n",
-		mapq_str);
-	return BL_READ_TRUNCATED;
-    }
-
     if ( field_mask & BL_SAM_FIELD_MAPQ )
     {
-	alignment->mapq = strtoul(mapq_str, &end, 10);
-	if ( *end != '\0' )
+	for (p = start[4], val = 0; (p < end[4]) && (*p >= '0') && (*p <= '9');
+	     ++p)
+	    val = val * 10 + *p - '0';
+	if ( p != end[4] )
 	{
-	    fprintf(stderr, "bl_sam_read(): Invalid mapq: %s\n",
-		    mapq_str);
+	    fprintf(stderr, "bl_sam_read(): Invalid mapq: %.*s\n",
+		    (int)(end[4] - start[4]), start[4]);
 	    fprintf(stderr, "qname = %s rname = %s\n",
-		    alignment->qname, alignment->rname);
-	    fprintf(stderr, "previous_pos = %" PRId64 "\n", previous_pos);
+		    BL_SAM_QNAME(alignment), BL_SAM_RNAME(alignment));
 	    exit(EX_DATAERR);
 	}
+	alignment->mapq = val;
     }
     else
 	alignment->mapq = 0;
     
     // 6 CIGAR
     if ( field_mask & BL_SAM_FIELD_CIGAR )
-	delim = xt_tsv_read_field_malloc(sam_stream, &alignment->cigar,
-			       &alignment->cigar_array_size,
-			       &alignment->cigar_len);
+    {
+	alignment->cigar_len = end[5] - start[5];
+	if ( alignment->cigar_array_size < alignment->cigar_len + 1 )
+	{
+	    alignment->cigar_array_size = alignment->cigar_len + 1;
+	    alignment->cigar = xt_realloc(alignment->cigar,
+		    alignment->cigar_array_size, sizeof(*alignment->cigar));
+	    if ( alignment->cigar == NULL )
+	    {
+		fprintf(stderr, "bl_sam_read(): Could not allocate cigar.\n");
+		exit(EX_UNAVAILABLE);
+	    }
+	}
+	memcpy(alignment->cigar, start[5], alignment->cigar_len);
+	alignment->cigar[alignment->cigar_len] = '\0';
+    }
     else
     {
-	delim = xt_tsv_skip_field(sam_stream, &len);
 	alignment->cigar_len = 0;
 	// Do not set to NULL or set array_size to 0.  Leave buffer
 	// allocated for reuse.
     }
-    if ( delim == EOF )
-    {
-	fprintf(stderr, "bl_sam_read(): Got EOF reading cigar: %s.\n",
-		alignment->cigar);
-	return BL_READ_TRUNCATED;
-    }
-    
-    // 7 RNEXT
-    if ( field_mask & BL_SAM_FIELD_RNEXT )
-	delim = xt_tsv_read_field(sam_stream, alignment->rnext,
-			       BL_SAM_RNAME_MAX_CHARS, &len);
-    else
-    {
-	delim = xt_tsv_skip_field(sam_stream, &len);
-	*alignment->rnext = '\0';
-    }
-    if ( delim == EOF )
-    {
-	fprintf(stderr, "bl_sam_read(): Got EOF reading rnext: %s.\n",
-		alignment->rnext);
-	return BL_READ_TRUNCATED;
-    }
     
     // 8 PNEXT
-    if ( field_mask & BL_SAM_FIELD_PNEXT )
-	delim = xt_tsv_read_field(sam_stream, pos_str, BL_POSITION_MAX_DIGITS,
-			       &len);
-    else
-	delim = xt_tsv_skip_field(sam_stream, &len);
-    if ( delim == EOF )
-    {
-	fprintf(stderr, "bl_sam_read(): Got EOF reading pnext: %s.\n",
-		pos_str);
-	return BL_READ_TRUNCATED;
-    }
     if ( field_mask & BL_SAM_FIELD_PNEXT )
     {
-	alignment->pnext = strtoul(pos_str, &end, 10);
-	if ( *end != '\0' )
+	for (p = start[7], val = 0; (p < end[7]) && (*p >= '0') && (*p <= '9');
+	     ++p)
+	    val = val * 10 + *p - '0';
+	if ( p != end[7] )
 	{
-	    fprintf(stderr, "bl_sam_read(): Invalid pnext: %s\n",
-		    pos_str);
+	    fprintf(stderr, "bl_sam_read(): Invalid pnext: %.*s\n",
+		    (int)(end[7] - start[7]), start[7]);
 	    fprintf(stderr, "qname = %s rname = %s\n",
-		    alignment->qname, alignment->rname);
-	    fprintf(stderr, "previous_pos = %" PRId64 "\n", previous_pos);
+		    BL_SAM_QNAME(alignment), BL_SAM_RNAME(alignment));
 	    exit(EX_DATAERR);
 	}
+	alignment->pnext = val;
     }
     else
 	alignment->pnext = 0;
     
-    // 9 TLEN
-    if ( field_mask & BL_SAM_FIELD_TLEN )
-	delim = xt_tsv_read_field(sam_stream, pos_str, BL_POSITION_MAX_DIGITS,
-			       &len);
-    else
-	delim = xt_tsv_skip_field(sam_stream, &len);
-    if ( delim == EOF )
-    {
-	fprintf(stderr, "bl_sam_read(): Got EOF reading tlen: %s.\n",
-		pos_str);
-	return BL_READ_TRUNCATED;
-    }
+    // 9 TLEN, negative for the rightmost read of a pair
     if ( field_mask & BL_SAM_FIELD_TLEN )
     {
-	alignment->tlen = strtoul(pos_str, &end, 10);
-	if ( *end != '\0' )
+	p = start[8];
+	sign = 1;
+	if ( (p < end[8]) && ((*p == '-') || (*p == '+')) )
+	    sign = *p++ == '-' ? -1 : 1;
+	for (val = 0; (p < end[8]) && (*p >= '0') && (*p <= '9'); ++p)
+	    val = val * 10 + *p - '0';
+	if ( p != end[8] )
 	{
-	    fprintf(stderr, "bl_sam_read(): Invalid tlen: %s\n",
-		    pos_str);
+	    fprintf(stderr, "bl_sam_read(): Invalid tlen: %.*s\n",
+		    (int)(end[8] - start[8]), start[8]);
 	    fprintf(stderr, "qname = %s rname = %s\n",
-		    alignment->qname, alignment->rname);
-	    fprintf(stderr, "previous_pos = %" PRId64 "\n", previous_pos);
+		    BL_SAM_QNAME(alignment), BL_SAM_RNAME(alignment));
 	    exit(EX_DATAERR);
 	}
+	alignment->tlen = sign * val;
     }
     else
 	alignment->tlen = 0;
     
     // 10 SEQ
-    if ( field_mask & BL_SAM_FIELD_SEQ )
-	delim = xt_tsv_read_field_malloc(sam_stream, &alignment->seq,
-		    &alignment->seq_array_size, &alignment->seq_len);
-    else
-    {
-	delim = xt_tsv_skip_field(sam_stream, &alignment->seq_len);
-	alignment->seq_len = 0;
-	// Do not set to NULL or set array_size to 0.  Leave buffer
-	// allocated for reuse.
-    }
-    if ( delim == EOF )
-    {
-	fprintf(stderr, "bl_sam_read(): Got EOF reading seq: %s.\n",
-		alignment->seq);
-	return BL_READ_TRUNCATED;
-    }
-
     if ( field_mask & BL_SAM_FIELD_SEQ )
     {
 	// May be allocated by bl_sam_init() or bl_sam_copy()
-	if ( alignment->seq == NULL )
+	alignment->seq_len = end[9] - start[9];
+	if ( alignment->seq_array_size < alignment->seq_len + 1 )
 	{
-	    if ( (alignment->seq = xt_malloc(alignment->seq_len + 1,
-		    sizeof(*alignment->seq))) == NULL )
+	    alignment->seq_array_size = alignment->seq_len + 1;
+	    alignment->seq = xt_realloc(alignment->seq,
+		    alignment->seq_array_size, sizeof(*alignment->seq));
+	    if ( alignment->seq == NULL )
 	    {
 		fprintf(stderr, "bl_sam_read(): Could not allocate seq.\n");
 		exit(EX_UNAVAILABLE);
 	    }
 	}
-    }
-    
-    // 11 QUAL, should be last field
-    if ( field_mask & BL_SAM_FIELD_QUAL )
-    {
-	delim = xt_tsv_read_field_malloc(sam_stream, &alignment->qual,
-		    &alignment->qual_array_size,
-		    &alignment->qual_len);
+	memcpy(alignment->seq, start[9], alignment->seq_len);
+	alignment->seq[alignment->seq_len] = '\0';
     }
     else
     {
-	delim = xt_tsv_skip_field(sam_stream, &alignment->qual_len);
-	alignment->qual_len = 0;
+	alignment->seq_len = 0;
 	// Do not set to NULL or set array_size to 0.  Leave buffer
 	// allocated for reuse.
     }
-    if ( delim == EOF )
-    {
-	fprintf(stderr, "bl_sam_read(): Got EOF reading qual: %s.\n",
-		alignment->qual);
-	return BL_READ_TRUNCATED;
-    }
-
+    
+    // 11 QUAL, should be last field
     if ( field_mask & BL_SAM_FIELD_QUAL )
     {
 	// May be allocated by bl_sam_init() or bl_sam_copy()
-	if ( alignment->qual == NULL )
+	alignment->qual_len = end[10] - start[10];
+	if ( alignment->qual_array_size < alignment->qual_len + 1 )
 	{
-	    if ( (alignment->qual = xt_malloc(alignment->qual_len + 1,
-		    sizeof(*alignment->qual))) == NULL )
+	    alignment->qual_array_size = alignment->qual_len + 1;
+	    alignment->qual = xt_realloc(alignment->qual,
+		    alignment->qual_array_size, sizeof(*alignment->qual));
+	    if ( alignment->qual == NULL )
 	    {
 		fprintf(stderr, "bl_sam_read(): Could not allocate qual.\n");
 		exit(EX_UNAVAILABLE);
 	    }
 	}
+	memcpy(alignment->qual, start[10], alignment->qual_len);
+	alignment->qual[alignment->qual_len] = '\0';
     
 	if ( (alignment->qual_len != 1) &&
 	     (alignment->seq_len != alignment->qual_len) )
 	    fprintf(stderr, "bl_sam_read(): Warning: qual_len != seq_len for %s,%" PRId64 "\n",
-		    alignment->rname, alignment->pos);
+		    BL_SAM_RNAME(alignment), alignment->pos);
+    }
+    else
+    {
+	alignment->qual_len = 0;
+	// Do not set to NULL or set array_size to 0.  Leave buffer
+	// allocated for reuse.
+    }
+
+    // Packed CIGAR ops and ref_end, after POS and SEQ are known
+    if ( bl_sam_parse_cigar(alignment) != BL_READ_OK )
+    {
+	fprintf(stderr, "bl_sam_read(): Invalid cigar: %.*s\n",
+		(int)alignment->cigar_len, alignment->cigar);
+	fprintf(stderr, "qname = %s rname = %s\n",
+		BL_SAM_QNAME(alignment), BL_SAM_RNAME(alignment));
+	exit(EX_DATAERR);
     }
-    
-    // Some SRA CRAMs have 11 fields, most have 12
-    // Discard everything after the 11th
-    if ( delim == '\t' )
-	while ( getc(sam_stream) != '\n' )
-	    ;
 
     /*fprintf(stderr,"bl_sam_read(): %s,%" PRId64 ",%zu\n",
 	    BL_SAM_RNAME(alignment), BL_SAM_POS(alignment),
@@ -487,14 +455,39 @@ int     bl_sam_read(bl_sam_t *alignment, FILE *sam_stream,
  *  History: 
  *  Date        Name        Modification
  *  2020-05-27  Jason Bacon Begin
+ *  2026-10-17  agent       Copy packed names with one memcpy()
+ *  2026-10-17  agent       Copy chrom_dict and rname_id
+ *  2026-10-17  agent       Copy packed CIGAR ops and ref_end
+ *  2026-10-17  agent       Size arrays for the strdup()ed lengths
  ***************************************************************************/
 
 void    bl_sam_copy(bl_sam_t *dest, bl_sam_t *src)
 
 {
-    strlcpy(dest->qname, src->qname, BL_SAM_QNAME_MAX_CHARS + 1);
+    // One allocation and copy for all three names, sized to fit
+    if ( src->names_len > 0 )
+    {
+	if ( (dest->names = xt_malloc(src->names_len,
+				      sizeof(*dest->names))) == NULL )
+	{
+	    fprintf(stderr, "bl_sam_copy(): Could not allocate names.\n");
+	    exit(EX_UNAVAILABLE);
+	}
+	memcpy(dest->names, src->names, src->names_len);
+	dest->names_array_size = src->names_len;
+    }
+    else
+    {
+	dest->names = "";
+	dest->names_array_size = 0;
+    }
+    dest->names_len = src->names_len;
+    dest->rname_offset = src->rname_offset;
+    dest->rnext_offset = src->rnext_offset;
+    dest->chrom_dict = src->chrom_dict;
+    dest->rname_id = src->rname_id;
+    
     dest->flag = src->flag;
-    strlcpy(dest->rname, src->rname, BL_SAM_RNAME_MAX_CHARS + 1);
     dest->pos = src->pos;
     dest->mapq = src->mapq;
 
@@ -510,9 +503,11 @@ void    bl_sam_copy(bl_sam_t *dest, bl_sam_t *src)
 	dest->cigar_len = src->cigar_len;
     }
     else
+    {
 	dest->cigar = NULL;
+	dest->cigar_array_size = 0;
+    }
     
-    strlcpy(dest->rnext, src->rnext, BL_SAM_RNAME_MAX_CHARS + 1);
     dest->pnext = src->pnext;
     dest->tlen = src->tlen;
 
@@ -528,7 +523,10 @@ void    bl_sam_copy(bl_sam_t *dest, bl_sam_t *src)
 	dest->seq_len = src->seq_len;
     }
     else
+    {
 	dest->seq = NULL;
+	dest->seq_array_size = 0;
+    }
     //fprintf(stderr, "src->seq = %s %zu\n", src->seq, src->seq_len);
     //fprintf(stderr, "src->qual = %s %zu\n", src->qual, src->qual_len);
     
@@ -547,14 +545,267 @@ void    bl_sam_copy(bl_sam_t *dest, bl_sam_t *src)
 	dest->qual_len = src->qual_len;
     }
     else
+    {
 	dest->qual = NULL;
+	dest->qual_array_size = 0;
+    }
 
-    dest->cigar_array_size = src->cigar_array_size;
+    // Lengths may be non-zero for skipped fields
     dest->cigar_len = src->cigar_len;
-    dest->seq_array_size = src->seq_array_size;
     dest->seq_len = src->seq_len;
-    dest->qual_array_size = src->qual_array_size;
     dest->qual_len = src->qual_len;
+    
+    if ( src->cigar_op_count > 0 )
+    {
+	dest->cigar_ops = xt_malloc(src->cigar_op_count,
+				    sizeof(*dest->cigar_ops));
+	if ( dest->cigar_ops == NULL )
+	{
+	    fprintf(stderr, "bl_sam_copy(): Could not allocate cigar_ops.\n");
+	    exit(EX_UNAVAILABLE);
+	}
+	memcpy(dest->cigar_ops, src->cigar_ops,
+	       src->cigar_op_count * sizeof(*dest->cigar_ops));
+    }
+    else
+	dest->cigar_ops = NULL;
+    dest->cigar_ops_array_size = src->cigar_op_count;
+    dest->cigar_op_count = src->cigar_op_count;
+    dest->ref_end = src->ref_end;
+    
+    // Input buffer is private to each object
+    dest->line = NULL;
+    dest->line_array_size = 0;
+}
+
+
+/***************************************************************************
+ *  Name:
+ *      bl_sam_copy_reuse() - Copy a SAM object into existing buffers
+ *
+ *  Library:
+ *      #include <biolibc/sam.h>
+ *      -lbiolibc -lxtend
+ *
+ *  Description:
+ *      Copy a SAM alignment into an initialized bl_sam_t structure,
+ *      reusing the names, cigar, seq, qual and cigar_ops buffers allocated
+ *      by dest and growing them only if they are too small.  Unlike
+ *      bl_sam_copy(3), dest must have been initialized with
+ *      bl_sam_init(3) or BL_SAM_INIT, and its old contents are not
+ *      leaked.  This is the copy used to fill pooled slots in a
+ *      bl_sam_buff_t, where after warm-up it performs no allocation.
+ *
+ *      The input line buffer of dest is left as is.
+ *
+ *  Arguments:
+ *      dest    Pointer to initialized bl_sam_t structure to receive copy
+ *      src     Pointer to bl_sam_t structure to be copied
+ *
+ *  Examples:
+ *      bl_sam_t    alignment = BL_SAM_INIT, saved = BL_SAM_INIT;
+ *
+ *      while ( bl_sam_read(&alignment, stdin, BL_SAM_FIELD_ALL)
+ *              == BL_READ_OK )
+ *      {
+ *          if ( BL_SAM_MAPQ(&alignment) > BL_SAM_MAPQ(&saved) )
+ *              bl_sam_copy_reuse(&saved, &alignment);
+ *      }
+ *      bl_sam_free(&saved);
+ *
+ *  See also:
+ *      bl_sam_copy(3), bl_sam_move(3), bl_sam_init(3), bl_sam_free(3)
+ *
+ *  History: 
+ *  Date        Name        Modification
+ *  2026-10-17  agent       Begin
+ ***************************************************************************/
+
+void    bl_sam_copy_reuse(bl_sam_t *dest, bl_sam_t *src)
+
+{
+    if ( dest->names_array_size < src->names_len )
+    {
+	// names_array_size 0 means names points to a static ""
+	if ( dest->names_array_size == 0 )
+	    dest->names = NULL;
+	dest->names_array_size = src->names_len;
+	if ( (dest->names = xt_realloc(dest->names, dest->names_array_size,
+				       sizeof(*dest->names))) == NULL )
+	{
+	    fprintf(stderr, "bl_sam_copy_reuse(): Could not allocate names.\n");
+	    exit(EX_UNAVAILABLE);
+	}
+    }
+    if ( src->names_len > 0 )
+	memcpy(dest->names, src->names, src->names_len);
+    else if ( dest->names_array_size > 0 )
+	*dest->names = '\0';
+    dest->names_len = src->names_len;
+    dest->rname_offset = src->rname_offset;
+    dest->rnext_offset = src->rnext_offset;
+    dest->chrom_dict = src->chrom_dict;
+    dest->rname_id = src->rname_id;
+    
+    dest->flag = src->flag;
+    dest->pos = src->pos;
+    dest->mapq = src->mapq;
+    dest->pnext = src->pnext;
+    dest->tlen = src->tlen;
+
+    // Masked fields have len 0 and possibly stale buffers in src
+    dest->cigar_len = src->cigar == NULL ? 0 : src->cigar_len;
+    if ( dest->cigar_array_size < dest->cigar_len + 1 )
+    {
+	dest->cigar_array_size = dest->cigar_len + 1;
+	dest->cigar = xt_realloc(dest->cigar, dest->cigar_array_size,
+				 sizeof(*dest->cigar));
+	if ( dest->cigar == NULL )
+	{
+	    fprintf(stderr, "bl_sam_copy_reuse(): Could not allocate cigar.\n");
+	    exit(EX_UNAVAILABLE);
+	}
+    }
+    if ( dest->cigar_len > 0 )
+	memcpy(dest->cigar, src->cigar, dest->cigar_len);
+    dest->cigar[dest->cigar_len] = '\0';
+    
+    dest->seq_len = src->seq == NULL ? 0 : src->seq_len;
+    if ( dest->seq_array_size < dest->seq_len + 1 )
+    {
+	dest->seq_array_size = dest->seq_len + 1;
+	dest->seq = xt_realloc(dest->seq, dest->seq_array_size,
+			       sizeof(*dest->seq));
+	if ( dest->seq == NULL )
+	{
+	    fprintf(stderr, "bl_sam_copy_reuse(): Could not allocate seq.\n");
+	    exit(EX_UNAVAILABLE);
+	}
+    }
+    if ( dest->seq_len > 0 )
+	memcpy(dest->seq, src->seq, dest->seq_len);
+    dest->seq[dest->seq_len] = '\0';
+    
+    dest->qual_len = src->qual == NULL ? 0 : src->qual_len;
+    if ( dest->qual_array_size < dest->qual_len + 1 )
+    {
+	dest->qual_array_size = dest->qual_len + 1;
+	dest->qual = xt_realloc(dest->qual, dest->qual_array_size,
+				sizeof(*dest->qual));
+	if ( dest->qual == NULL )
+	{
+	    fprintf(stderr, "bl_sam_copy_reuse(): Could not allocate qual.\n");
+	    exit(EX_UNAVAILABLE);
+	}
+    }
+    if ( dest->qual_len > 0 )
+	memcpy(dest->qual, src->qual, dest->qual_len);
+    dest->qual[dest->qual_len] = '\0';
+    
+    if ( dest->cigar_ops_array_size < src->cigar_op_count )
+    {
+	dest->cigar_ops_array_size = src->cigar_op_count;
+	dest->cigar_ops = xt_realloc(dest->cigar_ops,
+		dest->cigar_ops_array_size, sizeof(*dest->cigar_ops));
+	if ( dest->cigar_ops == NULL )
+	{
+	    fprintf(stderr, "bl_sam_copy_reuse(): Could not allocate cigar_ops.\n");
+	    exit(EX_UNAVAILABLE);
+	}
+    }
+    if ( src->cigar_op_count > 0 )
+	memcpy(dest->cigar_ops, src->cigar_ops,
+	       src->cigar_op_count * sizeof(*dest->cigar_ops));
+    dest->cigar_op_count = src->cigar_op_count;
+    dest->ref_end = src->ref_end;
+}
+
+
+/***************************************************************************
+ *  Name:
+ *      bl_sam_move() - Move a SAM object, trading buffers
+ *
+ *  Library:
+ *      #include <biolibc/sam.h>
+ *      -lbiolibc -lxtend
+ *
+ *  Description:
+ *      Move the contents of src into dest without copying sequence
+ *      data.  The names, cigar, seq, qual and cigar_ops buffers of src
+ *      are handed to dest, and the old buffers of dest are handed back
+ *      to src, so that the next bl_sam_read(3) or bl_bam_read(3) into
+ *      src reuses them.  Neither object allocates or frees anything.
+ *
+ *      Both objects must be initialized.  Each keeps its own input line
+ *      buffer, and src keeps its chromosome dictionary.  Afterward, src
+ *      holds empty names, cigar, seq and qual, and should only be read
+ *      into or freed.
+ *
+ *  Arguments:
+ *      dest    Pointer to initialized bl_sam_t structure to receive src
+ *      src     Pointer to bl_sam_t structure to be moved
+ *
+ *  Examples:
+ *      bl_sam_t    alignment = BL_SAM_INIT, saved = BL_SAM_INIT;
+ *
+ *      while ( bl_sam_read(&alignment, stdin, BL_SAM_FIELD_ALL)
+ *              == BL_READ_OK )
+ *      {
+ *          if ( BL_SAM_MAPQ(&alignment) > BL_SAM_MAPQ(&saved) )
+ *              bl_sam_move(&saved, &alignment);
+ *      }
+ *      bl_sam_free(&saved);
+ *
+ *  See also:
+ *      bl_sam_copy_reuse(3), bl_sam_buff_move_alignment(3)
+ *
+ *  History: 
+ *  Date        Name        Modification
+ *  2026-10-17  agent       Begin
+ ***************************************************************************/
+
+void    bl_sam_move(bl_sam_t *dest, bl_sam_t *src)
+
+{
+    bl_sam_t    spare;
+    
+    spare = *dest;
+    *dest = *src;
+    
+    // Input line buffer is private to each object
+    dest->line = spare.line;
+    dest->line_array_size = spare.line_array_size;
+    
+    src->names = spare.names;
+    src->names_array_size = spare.names_array_size;
+    if ( src->names_array_size > 0 )
+	*src->names = '\0';
+    src->names_len = 0;
+    src->rname_offset = 0;
+    src->rnext_offset = 0;
+    src->rname_id = BL_CHROM_ID_NONE;
+    
+    src->cigar = spare.cigar;
+    src->cigar_array_size = spare.cigar_array_size;
+    src->cigar_len = 0;
+    if ( src->cigar != NULL )
+	*src->cigar = '\0';
+    
+    src->seq = spare.seq;
+    src->seq_array_size = spare.seq_array_size;
+    src->seq_len = 0;
+    if ( src->seq != NULL )
+	*src->seq = '\0';
+    
+    src->qual = spare.qual;
+    src->qual_array_size = spare.qual_array_size;
+    src->qual_len = 0;
+    if ( src->qual != NULL )
+	*src->qual = '\0';
+    
+    src->cigar_ops = spare.cigar_ops;
+    src->cigar_ops_array_size = spare.cigar_ops_array_size;
+    src->cigar_op_count = 0;
 }
 
 
@@ -579,6 +830,8 @@ void    bl_sam_copy(bl_sam_t *dest, bl_sam_t *src)
  *  History: 
  *  Date        Name        Modification
  *  2020-05-29  Jason Bacon Begin
+ *  2026-10-17  agent       Free packed names
+ *  2026-10-17  agent       Free packed CIGAR ops
  ***************************************************************************/
 
 void    bl_sam_free(bl_sam_t *alignment)
@@ -590,6 +843,12 @@ void    bl_sam_free(bl_sam_t *alignment)
 	free(alignment->seq);
     if ( alignment->qual != NULL )
 	free(alignment->qual);
+    if ( alignment->line != NULL )
+	free(alignment->line);
+    if ( alignment->names_array_size > 0 )
+	free(alignment->names);
+    if ( alignment->cigar_ops != NULL )
+	free(alignment->cigar_ops);
 }
 
 
@@ -621,18 +880,21 @@ void    bl_sam_free(bl_sam_t *alignment)
  *  History: 
  *  Date        Name        Modification
  *  2020-05-29  Jason Bacon Begin
+ *  2026-10-17  agent       Initialize packed names
+ *  2026-10-17  agent       Initialize chrom_dict and rname_id
+ *  2026-10-17  agent       Initialize cigar_array_size and cigar_len
+ *  2026-10-17  agent       Initialize packed CIGAR ops and ref_end
  ***************************************************************************/
 
 void    bl_sam_init(bl_sam_t *alignment)
 
 {
-    *alignment->qname = '\0';
     alignment->flag = 0;
-    *alignment->rname = '\0';
     alignment->pos = 0;
     alignment->mapq = 0;
     alignment->cigar = NULL;
-    *alignment->rnext = '\0';
+    alignment->cigar_array_size = 0;
+    alignment->cigar_len = 0;
     alignment->pnext = 0;
     alignment->tlen = 0;
     alignment->seq = NULL;
@@ -641,69 +903,479 @@ void    bl_sam_init(bl_sam_t *alignment)
     alignment->seq_len = 0;
     alignment->qual_array_size = 0;
     alignment->qual_len = 0;
+    alignment->line = NULL;
+    alignment->line_array_size = 0;
+    alignment->names = "";
+    alignment->names_array_size = 0;
+    alignment->names_len = 0;
+    alignment->rname_offset = 0;
+    alignment->rnext_offset = 0;
+    alignment->chrom_dict = NULL;
+    alignment->rname_id = BL_CHROM_ID_NONE;
+    alignment->cigar_ops = NULL;
+    alignment->cigar_ops_array_size = 0;
+    alignment->cigar_op_count = 0;
+    alignment->ref_end = 0;
 }
 
 
 /***************************************************************************
  *  Name:
- *      bl_sam_write() - Write a SAM object to a file stream
+ *      bl_sam_set_names() - Set QNAME, RNAME and RNEXT of a SAM object
  *
  *  Library:
  *      #include <biolibc/sam.h>
  *      -lbiolibc -lxtend
  *
  *  Description:
- *      Write an alignment (line) to a SAM stream.
- *
- *      If field_mask is not BL_SAM_FIELD_ALL, fields not indicated by a 1
- *      in the bit mask are written as an appropriate placeholder such as '.'
- *      rather than stored in alignment.  Possible mask values are:
- *
- *      BL_SAM_FIELD_ALL
- *      BL_SAM_FIELD_QNAME
- *      BL_SAM_FIELD_FLAG
- *      BL_SAM_FIELD_RNAME
- *      BL_SAM_FIELD_POS
- *      BL_SAM_FIELD_MAPQ
- *      BL_SAM_FIELD_CIGAR
- *      BL_SAM_FIELD_RNEXT
- *      BL_SAM_FIELD_PNEXT
- *      BL_SAM_FIELD_TLEN
- *      BL_SAM_FIELD_SEQ
- *      BL_SAM_FIELD_QUAL
+ *      Store QNAME, RNAME and RNEXT in the packed name buffer of
+ *      alignment, one after another with null terminators.  The buffer
+ *      is reused and only grows when the combined names do not fit, so
+ *      bl_sam_read(3) normally sets all three with no allocation.  The
+ *      source strings need not be null-terminated, and may point into
+ *      the current names of alignment.  Names longer than
+ *      BL_SAM_QNAME_MAX_CHARS or BL_SAM_RNAME_MAX_CHARS are truncated.
+ *
+ *      The names are read back with BL_SAM_QNAME(3), BL_SAM_RNAME(3) and
+ *      BL_SAM_RNEXT(3).  To change only one of them, use
+ *      bl_sam_set_qname_cpy(3), bl_sam_set_rname_cpy(3) or
+ *      bl_sam_set_rnext_cpy(3).
+ *
+ *      If alignment has a chromosome dictionary, rname_id is updated
+ *      by bl_chrom_dict_intern(3).
  *
  *  Arguments:
- *      sam_stream  A FILE stream to which to write the line
  *      alignment   Pointer to a bl_sam_t structure
- *      field_mask  Bit mask indicating which fields to store in alignment
+ *      qname       Query template name
+ *      qname_len   Number of characters in qname, 0 for ""
+ *      rname       Reference sequence name
+ *      rname_len   Number of characters in rname, 0 for ""
+ *      rnext       Reference sequence name of the next read
+ *      rnext_len   Number of characters in rnext, 0 for ""
  *
- *  Returns:
- *      Number of items written (per fprintf() output)
+ *  Examples:
+ *      bl_sam_t    alignment = BL_SAM_INIT;
+ *
+ *      bl_sam_set_names(&alignment, "read1", 5, "chr1", 4, "=", 1);
  *
  *  See also:
- *      bl_sam_read(3)
+ *      bl_sam_read(3), bl_sam_copy(3), bl_chrom_dict_intern(3)
  *
  *  History: 
  *  Date        Name        Modification
- *  2019-12-09  Jason Bacon Begin
+ *  2026-10-17  agent       Begin
+ *  2026-10-17  agent       Update rname_id
  ***************************************************************************/
 
-int     bl_sam_write(bl_sam_t *alignment, FILE *sam_stream,
-			   sam_field_mask_t field_mask)
+void    bl_sam_set_names(bl_sam_t *alignment,
+			 const char *qname, size_t qname_len,
+			 const char *rname, size_t rname_len,
+			 const char *rnext, size_t rnext_len)
 
 {
-    int     count;
+    char    *names, *old = alignment->names;
+    size_t  len;
+    bool    aliased;
     
-    // FIXME: Respect field_mask
-    count = fprintf(sam_stream, "%s\t%u\t%s\t%" PRId64
-		    "\t%u\t%s\t%s\t%" PRId64 "zu\t%lu\t%s\t%s\t%zu\t%zu\n",
-		    alignment->qname,
-		    alignment->flag,
-		    alignment->rname,
-		    alignment->pos,
-		    alignment->mapq,
+    qname_len = XT_MIN(qname_len, BL_SAM_QNAME_MAX_CHARS);
+    rname_len = XT_MIN(rname_len, BL_SAM_RNAME_MAX_CHARS);
+    rnext_len = XT_MIN(rnext_len, BL_SAM_RNAME_MAX_CHARS);
+    len = qname_len + rname_len + rnext_len + 3;
+    
+    // Overlapping sources must be copied before the buffer is rewritten
+    aliased = (alignment->names_array_size > 0) &&
+	      (((qname >= old) && (qname < old + alignment->names_array_size)) ||
+	       ((rname >= old) && (rname < old + alignment->names_array_size)) ||
+	       ((rnext >= old) && (rnext < old + alignment->names_array_size)));
+    if ( aliased || (alignment->names_array_size < len) )
+    {
+	if ( (names = xt_malloc(len, sizeof(*names))) == NULL )
+	{
+	    fprintf(stderr, "bl_sam_set_names(): Could not allocate names.\n");
+	    exit(EX_UNAVAILABLE);
+	}
+    }
+    else
+	names = old;
+    
+    memcpy(names, qname, qname_len);
+    names[qname_len] = '\0';
+    alignment->rname_offset = qname_len + 1;
+    memcpy(names + alignment->rname_offset, rname, rname_len);
+    names[alignment->rname_offset + rname_len] = '\0';
+    alignment->rnext_offset = alignment->rname_offset + rname_len + 1;
+    memcpy(names + alignment->rnext_offset, rnext, rnext_len);
+    names[alignment->rnext_offset + rnext_len] = '\0';
+    alignment->names_len = len;
+    
+    if ( names != old )
+    {
+	if ( alignment->names_array_size > 0 )
+	    free(old);
+	alignment->names = names;
+	alignment->names_array_size = len;
+    }
+    
+    if ( alignment->chrom_dict != NULL )
+	alignment->rname_id = bl_chrom_dict_intern(alignment->chrom_dict,
+		    alignment->rname_id, BL_SAM_RNAME(alignment));
+}
+
+
+/***************************************************************************
+ *  Name:
+ *      bl_sam_parse_cigar() - Parse CIGAR string into packed operations
+ *
+ *  Library:
+ *      #include <biolibc/sam.h>
+ *      -lbiolibc -lxtend
+ *
+ *  Description:
+ *      Convert the CIGAR string of alignment into packed BAM-style
+ *      operations, (length << 4) | op, stored in cigar_ops, and update
+ *      ref_end with bl_sam_update_ref_end(3).  The cigar_ops array is
+ *      reused and grown only as needed.  A CIGAR of "*" or an empty
+ *      (masked) CIGAR produces no operations.
+ *
+ *      bl_sam_read(3) and bl_bam_read(3) do this for every alignment,
+ *      so this function is only needed after modifying the CIGAR
+ *      string of an alignment directly.
+ *
+ *      The operations are accessed with BL_SAM_CIGAR_OP_COUNT(3),
+ *      BL_SAM_CIGAR_OPS_AE(3), BL_SAM_CIGAR_OP() and BL_SAM_CIGAR_OP_LEN().
+ *
+ *  Arguments:
+ *      alignment   Pointer to a bl_sam_t structure
+ *
+ *  Returns:
+ *      BL_READ_OK on success
+ *      BL_READ_BAD_DATA if the CIGAR string is invalid
+ *
+ *  Examples:
+ *      bl_sam_t    alignment;
+ *      size_t      c;
+ *      uint32_t    op;
+ *
+ *      for (c = 0; c < BL_SAM_CIGAR_OP_COUNT(&alignment); ++c)
+ *      {
+ *          op = BL_SAM_CIGAR_OPS_AE(&alignment, c);
+ *          printf("%u%c\n", BL_SAM_CIGAR_OP_LEN(op),
+ *                 BL_SAM_CIGAR_OP_CHARS[BL_SAM_CIGAR_OP(op)]);
+ *      }
+ *
+ *  See also:
+ *      bl_sam_update_ref_end(3), bl_sam_ref_to_query(3),
+ *      bl_sam_query_to_ref(3)
+ *
+ *  History: 
+ *  Date        Name        Modification
+ *  2026-10-17  agent       Begin
+ ***************************************************************************/
+
+int     bl_sam_parse_cigar(bl_sam_t *alignment)
+
+{
+    const char  *p,
+		*end,
+		*op;
+    uint64_t    len;
+    size_t      max_ops;
+    
+    alignment->cigar_op_count = 0;
+    if ( (alignment->cigar != NULL) && (alignment->cigar_len > 0) &&
+	 (*alignment->cigar != '*') )
+    {
+	// Every operation takes at least 2 characters
+	max_ops = (alignment->cigar_len + 1) / 2;
+	if ( alignment->cigar_ops_array_size < max_ops )
+	{
+	    alignment->cigar_ops_array_size = max_ops;
+	    alignment->cigar_ops = xt_realloc(alignment->cigar_ops,
+		    alignment->cigar_ops_array_size,
+		    sizeof(*alignment->cigar_ops));
+	    if ( alignment->cigar_ops == NULL )
+	    {
+		fprintf(stderr, "bl_sam_parse_cigar(): Could not allocate cigar_ops.\n");
+		exit(EX_UNAVAILABLE);
+	    }
+	}
+	
+	end = alignment->cigar + alignment->cigar_len;
+	for (p = alignment->cigar; p < end; ++p)
+	{
+	    if ( (*p < '0') || (*p > '9') )
+		return BL_READ_BAD_DATA;
+	    // BAM allows 28 bits for the length
+	    for (len = 0; (p < end) && (*p >= '0') && (*p <= '9') &&
+		    (len <= 0x0fffffff); ++p)
+		len = len * 10 + *p - '0';
+	    if ( (p == end) || (len > 0x0fffffff) ||
+		 ((op = strchr(BL_SAM_CIGAR_OP_CHARS, *p)) == NULL) )
+		return BL_READ_BAD_DATA;
+	    alignment->cigar_ops[alignment->cigar_op_count++] =
+		len << 4 | (op - BL_SAM_CIGAR_OP_CHARS);
+	}
+    }
+    bl_sam_update_ref_end(alignment);
+    return BL_READ_OK;
+}
+
+
+/***************************************************************************
+ *  Name:
+ *      bl_sam_update_ref_end() - Compute last reference position covered
+ *
+ *  Library:
+ *      #include <biolibc/sam.h>
+ *      -lbiolibc -lxtend
+ *
+ *  Description:
+ *      Set ref_end to the last reference position covered by the
+ *      alignment, i.e. pos plus the lengths of all M, D, N, = and X
+ *      operations in cigar_ops, minus 1.  Insertions and clipping do
+ *      not advance along the reference, while deletions and skipped
+ *      regions (e.g. introns) do.  If there are no operations, the
+ *      alignment is assumed to be ungapped and ref_end is
+ *      pos + seq_len - 1.
+ *
+ *      This is called by bl_sam_parse_cigar(3), bl_sam_read(3) and
+ *      bl_bam_read(3), and is only needed after modifying pos or
+ *      cigar_ops directly.
+ *
+ *  Arguments:
+ *      alignment   Pointer to a bl_sam_t structure
+ *
+ *  See also:
+ *      bl_sam_parse_cigar(3), BL_SAM_REF_END(3)
+ *
+ *  History: 
+ *  Date        Name        Modification
+ *  2026-10-17  agent       Begin
+ ***************************************************************************/
+
+void    bl_sam_update_ref_end(bl_sam_t *alignment)
+
+{
+    int64_t     span;
+    size_t      c;
+    uint32_t    op;
+    
+    if ( alignment->cigar_op_count == 0 )
+	span = alignment->seq_len;
+    else
+    {
+	for (c = 0, span = 0; c < alignment->cigar_op_count; ++c)
+	{
+	    op = alignment->cigar_ops[c];
+	    if ( BL_SAM_CIGAR_CONSUMES_REF(BL_SAM_CIGAR_OP(op)) )
+		span += BL_SAM_CIGAR_OP_LEN(op);
+	}
+    }
+    alignment->ref_end = alignment->pos + span - 1;
+}
+
+
+/***************************************************************************
+ *  Name:
+ *      bl_sam_ref_to_query() - Map a reference position to a query offset
+ *
+ *  Library:
+ *      #include <biolibc/sam.h>
+ *      -lbiolibc -lxtend
+ *
+ *  Description:
+ *      Find the base of the read aligned to reference position ref_pos
+ *      by walking the packed CIGAR operations, in O(operations) time
+ *      with no string parsing.  The returned offset indexes seq and
+ *      qual directly, so soft-clipped bases are counted.
+ *
+ *      BL_SAM_POS_NONE is returned if ref_pos is outside pos .. ref_end
+ *      or falls within a deletion or skipped region, i.e. no read base
+ *      covers it.
+ *
+ *  Arguments:
+ *      alignment   Pointer to a bl_sam_t structure
+ *      ref_pos     1-based reference position
+ *
+ *  Returns:
+ *      0-based offset into seq of the base aligned to ref_pos, or
+ *      BL_SAM_POS_NONE
+ *
+ *  Examples:
+ *      int64_t     offset;
+ *
+ *      offset = bl_sam_ref_to_query(&alignment, BL_VCF_POS(&vcf_call));
+ *      if ( offset != BL_SAM_POS_NONE )
+ *          base = BL_SAM_SEQ_AE(&alignment, offset);
+ *
+ *  See also:
+ *      bl_sam_query_to_ref(3), bl_sam_parse_cigar(3)
+ *
+ *  History: 
+ *  Date        Name        Modification
+ *  2026-10-17  agent       Begin
+ ***************************************************************************/
+
+int64_t bl_sam_ref_to_query(bl_sam_t *alignment, int64_t ref_pos)
+
+{
+    int64_t     ref,
+		query,
+		len;
+    size_t      c;
+    unsigned    op;
+    
+    if ( (ref_pos < alignment->pos) || (ref_pos > alignment->ref_end) )
+	return BL_SAM_POS_NONE;
+    if ( alignment->cigar_op_count == 0 )
+	return ref_pos - alignment->pos;
+    
+    for (c = 0, ref = alignment->pos, query = 0;
+	 c < alignment->cigar_op_count; ++c)
+    {
+	op = BL_SAM_CIGAR_OP(alignment->cigar_ops[c]);
+	len = BL_SAM_CIGAR_OP_LEN(alignment->cigar_ops[c]);
+	if ( BL_SAM_CIGAR_CONSUMES_REF(op) )
+	{
+	    if ( ref_pos < ref + len )
+		return BL_SAM_CIGAR_CONSUMES_QUERY(op) ?
+		    query + ref_pos - ref : BL_SAM_POS_NONE;
+	    ref += len;
+	}
+	if ( BL_SAM_CIGAR_CONSUMES_QUERY(op) )
+	    query += len;
+    }
+    return BL_SAM_POS_NONE;
+}
+
+
+/***************************************************************************
+ *  Name:
+ *      bl_sam_query_to_ref() - Map a query offset to a reference position
+ *
+ *  Library:
+ *      #include <biolibc/sam.h>
+ *      -lbiolibc -lxtend
+ *
+ *  Description:
+ *      Find the reference position to which the read base at
+ *      query_offset is aligned, by walking the packed CIGAR operations
+ *      in O(operations) time.  This is the inverse of
+ *      bl_sam_ref_to_query(3).
+ *
+ *      BL_SAM_POS_NONE is returned if the base is inserted or soft
+ *      clipped, or query_offset is beyond the end of the read.
+ *
+ *  Arguments:
+ *      alignment       Pointer to a bl_sam_t structure
+ *      query_offset    0-based offset into seq
+ *
+ *  Returns:
+ *      1-based reference position, or BL_SAM_POS_NONE
+ *
+ *  See also:
+ *      bl_sam_ref_to_query(3), bl_sam_parse_cigar(3)
+ *
+ *  History: 
+ *  Date        Name        Modification
+ *  2026-10-17  agent       Begin
+ ***************************************************************************/
+
+int64_t bl_sam_query_to_ref(bl_sam_t *alignment, int64_t query_offset)
+
+{
+    int64_t     ref,
+		query,
+		len;
+    size_t      c;
+    unsigned    op;
+    
+    if ( query_offset < 0 )
+	return BL_SAM_POS_NONE;
+    if ( alignment->cigar_op_count == 0 )
+	return query_offset < (int64_t)alignment->seq_len ?
+	    alignment->pos + query_offset : BL_SAM_POS_NONE;
+    
+    for (c = 0, ref = alignment->pos, query = 0;
+	 c < alignment->cigar_op_count; ++c)
+    {
+	op = BL_SAM_CIGAR_OP(alignment->cigar_ops[c]);
+	len = BL_SAM_CIGAR_OP_LEN(alignment->cigar_ops[c]);
+	if ( BL_SAM_CIGAR_CONSUMES_QUERY(op) )
+	{
+	    if ( query_offset < query + len )
+		return BL_SAM_CIGAR_CONSUMES_REF(op) ?
+		    ref + query_offset - query : BL_SAM_POS_NONE;
+	    query += len;
+	}
+	if ( BL_SAM_CIGAR_CONSUMES_REF(op) )
+	    ref += len;
+    }
+    return BL_SAM_POS_NONE;
+}
+
+
+/***************************************************************************
+ *  Name:
+ *      bl_sam_write() - Write a SAM object to a file stream
+ *
+ *  Library:
+ *      #include <biolibc/sam.h>
+ *      -lbiolibc -lxtend
+ *
+ *  Description:
+ *      Write an alignment (line) to a SAM stream.
+ *
+ *      If field_mask is not BL_SAM_FIELD_ALL, fields not indicated by a 1
+ *      in the bit mask are written as an appropriate placeholder such as '.'
+ *      rather than stored in alignment.  Possible mask values are:
+ *
+ *      BL_SAM_FIELD_ALL
+ *      BL_SAM_FIELD_QNAME
+ *      BL_SAM_FIELD_FLAG
+ *      BL_SAM_FIELD_RNAME
+ *      BL_SAM_FIELD_POS
+ *      BL_SAM_FIELD_MAPQ
+ *      BL_SAM_FIELD_CIGAR
+ *      BL_SAM_FIELD_RNEXT
+ *      BL_SAM_FIELD_PNEXT
+ *      BL_SAM_FIELD_TLEN
+ *      BL_SAM_FIELD_SEQ
+ *      BL_SAM_FIELD_QUAL
+ *
+ *  Arguments:
+ *      sam_stream  A FILE stream to which to write the line
+ *      alignment   Pointer to a bl_sam_t structure
+ *      field_mask  Bit mask indicating which fields to store in alignment
+ *
+ *  Returns:
+ *      Number of items written (per fprintf() output)
+ *
+ *  See also:
+ *      bl_sam_read(3)
+ *
+ *  History: 
+ *  Date        Name        Modification
+ *  2019-12-09  Jason Bacon Begin
+ *  2026-10-17  agent       Use name accessors
+ ***************************************************************************/
+
+int     bl_sam_write(bl_sam_t *alignment, FILE *sam_stream,
+			   sam_field_mask_t field_mask)
+
+{
+    int     count;
+    
+    // FIXME: Respect field_mask
+    count = fprintf(sam_stream, "%s\t%u\t%s\t%" PRId64
+		    "\t%u\t%s\t%s\t%" PRId64 "zu\t%lu\t%s\t%s\t%zu\t%zu\n",
+		    BL_SAM_QNAME(alignment),
+		    alignment->flag,
+		    BL_SAM_RNAME(alignment),
+		    alignment->pos,
+		    alignment->mapq,
 		    alignment->cigar,
-		    alignment->rnext,
+		    BL_SAM_RNEXT(alignment),
 		    alignment->pnext,
 		    alignment->tlen,
 		    alignment->seq,
@@ -714,6 +1386,207 @@ int     bl_sam_write(bl_sam_t *alignment, FILE *sam_stream,
 }
 
 
+/***************************************************************************
+ *  Name:
+ *      bl_sam_write_raw() - Write a SAM object in raw binary form
+ *
+ *  Library:
+ *      #include <biolibc/sam.h>
+ *      -lbiolibc -lxtend
+ *
+ *  Description:
+ *      Write the fields of a SAM alignment to stream in a compact binary
+ *      form that bl_sam_read_raw(3) can read back with no parsing.  The
+ *      format uses native byte order and type sizes, and is meant only
+ *      for temporary files read back by the same process, such as the
+ *      overflow file of a bl_sam_buff_t.  Use bl_bam_write(3) for
+ *      portable binary output.
+ *
+ *      The chromosome dictionary pointer is not written.  rname_id is,
+ *      so the reader must use the same dictionary as the writer.
+ *
+ *  Arguments:
+ *      alignment   Pointer to bl_sam_t structure to write
+ *      stream      FILE stream open for writing
+ *
+ *  Returns:
+ *      BL_WRITE_OK on success
+ *      BL_WRITE_FAILURE if a write error occurs
+ *
+ *  See also:
+ *      bl_sam_read_raw(3), bl_sam_buff_set_overflow_mode(3)
+ *
+ *  History: 
+ *  Date        Name        Modification
+ *  2026-10-17  agent       Begin
+ ***************************************************************************/
+
+int     bl_sam_write_raw(bl_sam_t *alignment, FILE *stream)
+
+{
+    int64_t fixed[BL_SAM_RAW_FIXED_FIELDS];
+    size_t  lens[BL_SAM_RAW_LEN_FIELDS];
+    
+    fixed[0] = alignment->flag;
+    fixed[1] = alignment->pos;
+    fixed[2] = alignment->mapq;
+    fixed[3] = alignment->pnext;
+    fixed[4] = alignment->tlen;
+    fixed[5] = alignment->rname_id;
+    
+    // Masked fields may have stale buffers, so use 0 if len is 0
+    lens[0] = alignment->names_len;
+    lens[1] = alignment->rname_offset;
+    lens[2] = alignment->rnext_offset;
+    lens[3] = alignment->cigar == NULL ? 0 : alignment->cigar_len;
+    lens[4] = alignment->seq == NULL ? 0 : alignment->seq_len;
+    lens[5] = alignment->qual == NULL ? 0 : alignment->qual_len;
+    
+    if ( (fwrite(fixed, sizeof(*fixed), BL_SAM_RAW_FIXED_FIELDS, stream)
+	    != BL_SAM_RAW_FIXED_FIELDS) ||
+	 (fwrite(lens, sizeof(*lens), BL_SAM_RAW_LEN_FIELDS, stream)
+	    != BL_SAM_RAW_LEN_FIELDS) ||
+	 (fwrite(alignment->names, 1, lens[0], stream) != lens[0]) ||
+	 (fwrite(alignment->cigar, 1, lens[3], stream) != lens[3]) ||
+	 (fwrite(alignment->seq, 1, lens[4], stream) != lens[4]) ||
+	 (fwrite(alignment->qual, 1, lens[5], stream) != lens[5]) )
+	return BL_WRITE_FAILURE;
+    return BL_WRITE_OK;
+}
+
+
+/***************************************************************************
+ *  Name:
+ *      bl_sam_read_raw() - Read a SAM object in raw binary form
+ *
+ *  Library:
+ *      #include <biolibc/sam.h>
+ *      -lbiolibc -lxtend
+ *
+ *  Description:
+ *      Read an alignment written by bl_sam_write_raw(3) into an
+ *      initialized bl_sam_t structure.  The names, cigar, seq and qual
+ *      buffers of alignment are reused and grown only if too small, as
+ *      with bl_sam_read(3).  The chromosome dictionary of alignment is
+ *      left as is.  Packed CIGAR ops and ref_end are rebuilt from the
+ *      CIGAR string.
+ *
+ *  Arguments:
+ *      alignment   Pointer to initialized bl_sam_t structure
+ *      stream      FILE stream open for reading
+ *
+ *  Returns:
+ *      BL_READ_OK on success
+ *      BL_READ_EOF if there are no more alignments
+ *      BL_READ_TRUNCATED if EOF or an error occurs within an alignment
+ *      BL_READ_BAD_DATA if the CIGAR string is invalid
+ *
+ *  See also:
+ *      bl_sam_write_raw(3)
+ *
+ *  History: 
+ *  Date        Name        Modification
+ *  2026-10-17  agent       Begin
+ ***************************************************************************/
+
+int     bl_sam_read_raw(bl_sam_t *alignment, FILE *stream)
+
+{
+    int64_t fixed[BL_SAM_RAW_FIXED_FIELDS];
+    size_t  lens[BL_SAM_RAW_LEN_FIELDS],
+	    count;
+    
+    if ( (count = fread(fixed, sizeof(*fixed), BL_SAM_RAW_FIXED_FIELDS,
+			stream)) != BL_SAM_RAW_FIXED_FIELDS )
+	return count == 0 ? BL_READ_EOF : BL_READ_TRUNCATED;
+    if ( fread(lens, sizeof(*lens), BL_SAM_RAW_LEN_FIELDS, stream)
+	    != BL_SAM_RAW_LEN_FIELDS )
+	return BL_READ_TRUNCATED;
+    
+    alignment->flag = fixed[0];
+    alignment->pos = fixed[1];
+    alignment->mapq = fixed[2];
+    alignment->pnext = fixed[3];
+    alignment->tlen = fixed[4];
+    alignment->rname_id = fixed[5];
+    
+    if ( alignment->names_array_size < lens[0] )
+    {
+	// names_array_size 0 means names points to a static ""
+	if ( alignment->names_array_size == 0 )
+	    alignment->names = NULL;
+	alignment->names_array_size = lens[0];
+	alignment->names = xt_realloc(alignment->names,
+		alignment->names_array_size, sizeof(*alignment->names));
+	if ( alignment->names == NULL )
+	{
+	    fprintf(stderr, "bl_sam_read_raw(): Could not allocate names.\n");
+	    exit(EX_UNAVAILABLE);
+	}
+    }
+    else if ( (lens[0] == 0) && (alignment->names_array_size > 0) )
+	*alignment->names = '\0';
+    alignment->names_len = lens[0];
+    alignment->rname_offset = lens[1];
+    alignment->rnext_offset = lens[2];
+    if ( fread(alignment->names, 1, lens[0], stream) != lens[0] )
+	return BL_READ_TRUNCATED;
+    
+    alignment->cigar_len = lens[3];
+    if ( alignment->cigar_array_size < alignment->cigar_len + 1 )
+    {
+	alignment->cigar_array_size = alignment->cigar_len + 1;
+	alignment->cigar = xt_realloc(alignment->cigar,
+		alignment->cigar_array_size, sizeof(*alignment->cigar));
+	if ( alignment->cigar == NULL )
+	{
+	    fprintf(stderr, "bl_sam_read_raw(): Could not allocate cigar.\n");
+	    exit(EX_UNAVAILABLE);
+	}
+    }
+    if ( fread(alignment->cigar, 1, alignment->cigar_len, stream)
+	    != alignment->cigar_len )
+	return BL_READ_TRUNCATED;
+    alignment->cigar[alignment->cigar_len] = '\0';
+    
+    alignment->seq_len = lens[4];
+    if ( alignment->seq_array_size < alignment->seq_len + 1 )
+    {
+	alignment->seq_array_size = alignment->seq_len + 1;
+	alignment->seq = xt_realloc(alignment->seq,
+		alignment->seq_array_size, sizeof(*alignment->seq));
+	if ( alignment->seq == NULL )
+	{
+	    fprintf(stderr, "bl_sam_read_raw(): Could not allocate seq.\n");
+	    exit(EX_UNAVAILABLE);
+	}
+    }
+    if ( fread(alignment->seq, 1, alignment->seq_len, stream)
+	    != alignment->seq_len )
+	return BL_READ_TRUNCATED;
+    alignment->seq[alignment->seq_len] = '\0';
+    
+    alignment->qual_len = lens[5];
+    if ( alignment->qual_array_size < alignment->qual_len + 1 )
+    {
+	alignment->qual_array_size = alignment->qual_len + 1;
+	alignment->qual = xt_realloc(alignment->qual,
+		alignment->qual_array_size, sizeof(*alignment->qual));
+	if ( alignment->qual == NULL )
+	{
+	    fprintf(stderr, "bl_sam_read_raw(): Could not allocate qual.\n");
+	    exit(EX_UNAVAILABLE);
+	}
+    }
+    if ( fread(alignment->qual, 1, alignment->qual_len, stream)
+	    != alignment->qual_len )
+	return BL_READ_TRUNCATED;
+    alignment->qual[alignment->qual_len] = '\0';
+    
+    return bl_sam_parse_cigar(alignment);
+}
+
+
 /***************************************************************************
  *  Name:
  *      bl_sam_fopen() - Open a SAM/BAM/CRAM file
@@ -723,8 +1596,23 @@ int     bl_sam_write(bl_sam_t *alignment, FILE *sam_stream,
  *      -lxtend
  *
  *  Description:
- *      Open a raw SAM file using fopen() or a compressed
- *      SAM file, or BAM or CRAM file using popen().  If the
+ *      Open a raw SAM file using fopen(), a gzip or BGZF compressed
+ *      SAM file using bl_bgzf_fopen(), or a bzip2 or xz compressed SAM
+ *      file, or BAM or CRAM file using popen().  Gzip and BGZF input are
+ *      decompressed in-process, without running an external program.
+ *      BGZF blocks are inflated in parallel using one thread per
+ *      online CPU, up to BL_BGZF_AUTO_THREADS_MAX.  Use
+ *      bl_sam_fopen_threads(3) to choose the number of threads.
+ *      To decode BAM records directly into bl_sam_t objects without
+ *      samtools or a SAM text round trip, use bl_bam_open(3) and
+ *      bl_bam_read(3) instead.
+ *
+ *      When writing, .gz output is compressed in-process to BGZF,
+ *      which any gzip reader accepts, by parallel worker threads.
+ *      BAM output can be encoded natively with bl_bam_open_write(3)
+ *      and bl_bam_write(3).
+ *
+ *      If the
  *      file extension is .bam or .cram, or samtools_args is not
  *      NULL or "", data will be piped through "samtools view" with
  *      the given samtools_args as arguments.  The flag --with-header
@@ -746,16 +1634,60 @@ int     bl_sam_write(bl_sam_t *alignment, FILE *sam_stream,
  *      A pointer to the FILE structure or NULL if open failed
  *
  *  See also:
- *      fopen(3), popen(3), gzip(1), bzip2(1), xz(1)
+ *      bl_sam_fopen_threads(3), bl_bgzf_fopen(3), bl_bam_open(3),
+ *      bl_bgzf_fopen_write(3), bl_bam_open_write(3), fopen(3), popen(3), gzip(1), bzip2(1), xz(1)
  *
  *  History: 
  *  Date        Name        Modification
  *  2022-04-05  Jason Bacon Derived from xt_fclose()
+ *  2026-10-17  agent       Decompress gzip and BGZF in-process
+ *  2026-10-17  agent       Compress .gz output in-process
  ***************************************************************************/
 
 FILE    *bl_sam_fopen(const char *filename, const char *mode,
 		      char *samtools_args)
 
+{
+    return bl_sam_fopen_threads(filename, mode, samtools_args, 0);
+}
+
+
+/***************************************************************************
+ *  Name:
+ *      bl_sam_fopen_threads() - Open a SAM file with threaded decompression
+ *
+ *  Library:
+ *      #include <biolibc/sam.h>
+ *      -lbiolibc -lxtend -lz -lpthread
+ *
+ *  Description:
+ *      Same as bl_sam_fopen(3), but gzip or BGZF compressed SAM input
+ *      is inflated, and .gz output is deflated, using the given number
+ *      of worker threads.  A threads value of 0 uses one thread per
+ *      online CPU, up to BL_BGZF_AUTO_THREADS_MAX.
+ *
+ *  Arguments:
+ *      filename:       Name of the file to be opened
+ *      mode:           "r" or "w", passed to fopen() or popen()
+ *      samtools_args   Flags to pass to samtools view
+ *      threads         Number of BGZF worker threads, 0 for automatic
+ *
+ *  Returns:
+ *      A pointer to the FILE structure or NULL if open failed
+ *
+ *  See also:
+ *      bl_sam_fopen(3), bl_sam_fclose(3), bl_bgzf_fopen(3),
+ *      bl_bgzf_fopen_write(3)
+ *
+ *  History: 
+ *  Date        Name        Modification
+ *  2026-10-17  agent       Begin
+ *  2026-10-17  agent       Write .gz as BGZF in-process
+ ***************************************************************************/
+
+FILE    *bl_sam_fopen_threads(const char *filename, const char *mode,
+			      char *samtools_args, unsigned threads)
+
 {
     char    *ext = strrchr(filename, '.'),
 	    cmd[XT_CMD_MAX_CHARS + 1];
@@ -766,32 +1698,24 @@ FILE    *bl_sam_fopen(const char *filename, const char *mode,
     
     if ( (strcmp(mode, "r") != 0 ) && (strcmp(mode, "w") != 0) )
     {
-	fprintf(stderr, "bl_sam_fopen(): Only \"r\" and \"w\" modes supported.\n");
+	fprintf(stderr, "bl_sam_fopen_threads(): Only \"r\" and \"w\" modes supported.\n");
 	return NULL;
     }
     
     if ( ext == NULL )
     {
-	fprintf(stderr, "bl_sam_fopen(): No filename extension on %s.\n", filename);
+	fprintf(stderr, "bl_sam_fopen_threads(): No filename extension on %s.\n", filename);
 	return NULL;
     }
 
-    // popen() does not return NULL when the file does not exist
-    if ( stat(filename, &sb) != 0 )
-	return NULL;
-    
     if ( *mode == 'r' )
     {
+	// popen() does not return NULL when the file does not exist
+	if ( stat(filename, &sb) != 0 )
+	    return NULL;
+	
 	if ( strcmp(ext, ".gz") == 0 )
-	{
-// Big Sur zcat requires a .Z extension and CentOS 7 lacks gzcat
-#ifdef __APPLE__
-	    snprintf(cmd, XT_CMD_MAX_CHARS, "gzcat %s", filename);
-#else
-	    snprintf(cmd, XT_CMD_MAX_CHARS, "zcat %s", filename);
-#endif
-	    return popen(cmd, mode);
-	}
+	    return bl_bgzf_fopen(filename, threads);
 	else if ( strcmp(ext, ".bz2") == 0 )
 	{
 	    snprintf(cmd, XT_CMD_MAX_CHARS, "bzcat %s", filename);
@@ -814,11 +1738,9 @@ FILE    *bl_sam_fopen(const char *filename, const char *mode,
     }
     else    // "w"
     {
+	// BGZF is valid gzip, and indexable by tabix and samtools
 	if ( strcmp(ext, ".gz") == 0 )
-	{
-	    snprintf(cmd, XT_CMD_MAX_CHARS, "gzip -c > %s", filename);
-	    return popen(cmd, mode);
-	}
+	    return bl_bgzf_fopen_write(filename, threads);
 	else if ( strcmp(ext, ".bz2") == 0 )
 	{
 	    snprintf(cmd, XT_CMD_MAX_CHARS, "bzip2 -c > %s", filename);
@@ -858,7 +1780,9 @@ FILE    *bl_sam_fopen(const char *filename, const char *mode,
  *  Description:
  *      Close a FILE stream with fclose() or pclose() as appropriate.
  *      Automatically determines the proper close function to call using
- *      S_ISFIFO on the stream stat structure.
+ *      S_ISFIFO on the stream stat structure.  Streams returned by
+ *      bl_bgzf_fopen(3) have no file descriptor and are closed with
+ *      fclose(), which also stops their worker threads.
  *
  *  Arguments:
  *      stream: The FILE structure to be closed
@@ -877,6 +1801,8 @@ FILE    *bl_sam_fopen(const char *filename, const char *mode,
 int     bl_sam_fclose(FILE *stream)
 
 {
+    if ( fileno(stream) == -1 )
+	return fclose(stream);
     return xt_fclose(stream);
 }
 
@@ -941,6 +1867,8 @@ int64_t bl_sam_gff3_overlap(bl_sam_t *alignment, bl_gff3_t *feature)
  *
  *      This function is mainly intended for programs that sweep properly
  *      sorted GFF and SAM files locating overlaps in a single pass.
+ *      If both records share a chromosome dictionary, chromosome order
+ *      is taken from bl_chrom_dict_cmp(3), avoiding string comparisons.
  *  
  *      A converse function, bl_gff3_sam_cmp(3) is also provided so that
  *      the programmer can choose the more intuitive interface.
@@ -960,19 +1888,27 @@ int64_t bl_sam_gff3_overlap(bl_sam_t *alignment, bl_gff3_t *feature)
  *  History: 
  *  Date        Name        Modification
  *  2022-04-06  Jason Bacon Begin
+ *  2026-10-17  agent       Compare chrom IDs when both share a chrom_dict
+ *  2026-10-17  agent       Use CIGAR reference end instead of seq_len
  ***************************************************************************/
 
 int     bl_sam_gff3_cmp(bl_sam_t *alignment, bl_gff3_t *feature)
 
 {
-    int     status = bl_chrom_name_cmp(BL_SAM_RNAME(alignment),
-					    BL_GFF3_SEQID(feature));
+    int     status;
+    
+    if ( BL_CHROM_IDS_COMPARABLE(alignment->chrom_dict, alignment->rname_id,
+	    feature->chrom_dict, feature->seqid_id) )
+	status = bl_chrom_dict_cmp(alignment->chrom_dict, alignment->rname_id,
+				   feature->seqid_id);
+    else
+	status = bl_chrom_name_cmp(BL_SAM_RNAME(alignment),
+				   BL_GFF3_SEQID(feature));
     
     if ( status != 0 )
 	// Different chromosomes
 	return status;
-    else if ( BL_SAM_POS(alignment) + BL_SAM_SEQ_LEN(alignment) - 1
-		< BL_GFF3_START(feature) )
+    else if ( BL_SAM_REF_END(alignment) < BL_GFF3_START(feature) )
 	// Alignment ends before the start of feature
 	return -1;
     else if ( BL_SAM_POS(alignment) > BL_GFF3_END(feature) )
@@ -983,3 +1919,411 @@ int     bl_sam_gff3_cmp(bl_sam_t *alignment, bl_gff3_t *feature)
 	return 0;
 }
 
+
+/***************************************************************************
+ *  Name:
+ *      bl_sam_set_qname_ae() - Set one character of QNAME
+ *
+ *  Library:
+ *      #include <biolibc/sam.h>
+ *      -lbiolibc -lxtend
+ *
+ *  Description:
+ *      Set character c of the QNAME of a bl_sam_t object.  QNAME, RNAME and
+ *      RNEXT are packed into one buffer, so c must be within the current
+ *      QNAME.  Use bl_sam_set_qname_cpy(3) to change its length.
+ *
+ *  Arguments:
+ *      bl_sam_ptr      Pointer to the bl_sam_t object to modify
+ *      c               Subscript within QNAME
+ *      new_qname_element The new value for QNAME[c]
+ *
+ *  Returns:
+ *      BL_SAM_DATA_OK if the new value is acceptable and assigned
+ *      BL_SAM_DATA_OUT_OF_RANGE otherwise
+ *
+ *  Examples:
+ *      bl_sam_t        bl_sam;
+ *      size_t          c;
+ *      char            new_qname_element;
+ *
+ *      if ( bl_sam_set_qname_ae(&bl_sam, c, new_qname_element)
+ *              == BL_SAM_DATA_OK )
+ *      {
+ *      }
+ *
+ *  See also:
+ *      BL_SAM_QNAME(3), bl_sam_set_names(3)
+ *
+ *  History: 
+ *  Date        Name        Modification
+ *  2022-04-30  gen-get-set Auto-generated from sam.h
+ *  2026-10-17  agent       Store in packed name buffer
+ *  2026-10-17  agent       Move from generated sam-mutators.c
+ ***************************************************************************/
+
+int     bl_sam_set_qname_ae(bl_sam_t *bl_sam_ptr, size_t c, char new_qname_element)
+
+{
+    // Names are packed, so stay within the current string
+    if ( c >= strlen(BL_SAM_QNAME(bl_sam_ptr)) )
+	return BL_SAM_DATA_OUT_OF_RANGE;
+    else
+    {
+	BL_SAM_QNAME_AE(bl_sam_ptr, c) = new_qname_element;
+	return BL_SAM_DATA_OK;
+    }
+}
+
+
+/***************************************************************************
+ *  Name:
+ *      bl_sam_set_qname_cpy() - Copy a new QNAME
+ *
+ *  Library:
+ *      #include <biolibc/sam.h>
+ *      -lbiolibc -lxtend
+ *
+ *  Description:
+ *      Replace the QNAME of a bl_sam_t object with new_qname, truncated
+ *      like strlcpy(3) to array_size - 1 characters.  QNAME, RNAME and
+ *      RNEXT are packed into one buffer, which is rebuilt by
+ *      bl_sam_set_names(3).
+ *
+ *  Arguments:
+ *      bl_sam_ptr      Pointer to the bl_sam_t object to modify
+ *      new_qname       The new QNAME
+ *      array_size      Size of the new_qname array
+ *
+ *  Returns:
+ *      BL_SAM_DATA_OK if the new value is acceptable and assigned
+ *      BL_SAM_DATA_OUT_OF_RANGE otherwise
+ *
+ *  Examples:
+ *      bl_sam_t        bl_sam;
+ *      char            new_qname[BL_SAM_QNAME_MAX_CHARS + 1];
+ *      size_t          array_size;
+ *
+ *      if ( bl_sam_set_qname_cpy(&bl_sam, new_qname, array_size)
+ *              == BL_SAM_DATA_OK )
+ *      {
+ *      }
+ *
+ *  See also:
+ *      BL_SAM_QNAME(3), bl_sam_set_names(3)
+ *
+ *  History: 
+ *  Date        Name        Modification
+ *  2022-04-30  gen-get-set Auto-generated from sam.h
+ *  2026-10-17  agent       Store in packed name buffer
+ *  2026-10-17  agent       Move from generated sam-mutators.c
+ ***************************************************************************/
+
+int     bl_sam_set_qname_cpy(bl_sam_t *bl_sam_ptr, char new_qname[], size_t array_size)
+
+{
+    size_t  len;
+    
+    if ( (new_qname == NULL) || (array_size == 0) )
+	return BL_SAM_DATA_OUT_OF_RANGE;
+    else
+    {
+	// Same truncation as strlcpy(), into the packed name buffer
+	len = strnlen(new_qname, array_size - 1);
+	bl_sam_set_names(bl_sam_ptr, new_qname, len,
+			 BL_SAM_RNAME(bl_sam_ptr), strlen(BL_SAM_RNAME(bl_sam_ptr)),
+			 BL_SAM_RNEXT(bl_sam_ptr), strlen(BL_SAM_RNEXT(bl_sam_ptr)));
+	return BL_SAM_DATA_OK;
+    }
+}
+
+
+/***************************************************************************
+ *  Name:
+ *      bl_sam_set_rname_ae() - Set one character of RNAME
+ *
+ *  Library:
+ *      #include <biolibc/sam.h>
+ *      -lbiolibc -lxtend
+ *
+ *  Description:
+ *      Set character c of the RNAME of a bl_sam_t object.  QNAME, RNAME and
+ *      RNEXT are packed into one buffer, so c must be within the current
+ *      RNAME.  If a chromosome dictionary is attached, rname_id is updated.
+ *
+ *  Arguments:
+ *      bl_sam_ptr      Pointer to the bl_sam_t object to modify
+ *      c               Subscript within RNAME
+ *      new_rname_element The new value for RNAME[c]
+ *
+ *  Returns:
+ *      BL_SAM_DATA_OK if the new value is acceptable and assigned
+ *      BL_SAM_DATA_OUT_OF_RANGE otherwise
+ *
+ *  Examples:
+ *      bl_sam_t        bl_sam;
+ *      size_t          c;
+ *      char            new_rname_element;
+ *
+ *      if ( bl_sam_set_rname_ae(&bl_sam, c, new_rname_element)
+ *              == BL_SAM_DATA_OK )
+ *      {
+ *      }
+ *
+ *  See also:
+ *      BL_SAM_RNAME(3), bl_sam_set_names(3)
+ *
+ *  History: 
+ *  Date        Name        Modification
+ *  2022-04-30  gen-get-set Auto-generated from sam.h
+ *  2026-10-17  agent       Store in packed name buffer
+ *  2026-10-17  agent       Update rname_id
+ *  2026-10-17  agent       Move from generated sam-mutators.c
+ ***************************************************************************/
+
+int     bl_sam_set_rname_ae(bl_sam_t *bl_sam_ptr, size_t c, char new_rname_element)
+
+{
+    // Names are packed, so stay within the current string
+    if ( c >= strlen(BL_SAM_RNAME(bl_sam_ptr)) )
+	return BL_SAM_DATA_OUT_OF_RANGE;
+    else
+    {
+	BL_SAM_RNAME_AE(bl_sam_ptr, c) = new_rname_element;
+	bl_sam_ptr->rname_id = bl_chrom_dict_intern(bl_sam_ptr->chrom_dict,
+			    bl_sam_ptr->rname_id, BL_SAM_RNAME(bl_sam_ptr));
+	return BL_SAM_DATA_OK;
+    }
+}
+
+
+/***************************************************************************
+ *  Name:
+ *      bl_sam_set_rname_cpy() - Copy a new RNAME
+ *
+ *  Library:
+ *      #include <biolibc/sam.h>
+ *      -lbiolibc -lxtend
+ *
+ *  Description:
+ *      Replace the RNAME of a bl_sam_t object with new_rname, truncated
+ *      like strlcpy(3) to array_size - 1 characters.  QNAME, RNAME and
+ *      RNEXT are packed into one buffer, which is rebuilt by
+ *      bl_sam_set_names(3), which also updates rname_id.
+ *
+ *  Arguments:
+ *      bl_sam_ptr      Pointer to the bl_sam_t object to modify
+ *      new_rname       The new RNAME
+ *      array_size      Size of the new_rname array
+ *
+ *  Returns:
+ *      BL_SAM_DATA_OK if the new value is acceptable and assigned
+ *      BL_SAM_DATA_OUT_OF_RANGE otherwise
+ *
+ *  Examples:
+ *      bl_sam_t        bl_sam;
+ *      char            new_rname[BL_SAM_RNAME_MAX_CHARS + 1];
+ *      size_t          array_size;
+ *
+ *      if ( bl_sam_set_rname_cpy(&bl_sam, new_rname, array_size)
+ *              == BL_SAM_DATA_OK )
+ *      {
+ *      }
+ *
+ *  See also:
+ *      BL_SAM_RNAME(3), bl_sam_set_names(3)
+ *
+ *  History: 
+ *  Date        Name        Modification
+ *  2022-04-30  gen-get-set Auto-generated from sam.h
+ *  2026-10-17  agent       Store in packed name buffer
+ *  2026-10-17  agent       Move from generated sam-mutators.c
+ ***************************************************************************/
+
+int     bl_sam_set_rname_cpy(bl_sam_t *bl_sam_ptr, char new_rname[], size_t array_size)
+
+{
+    size_t  len;
+    
+    if ( (new_rname == NULL) || (array_size == 0) )
+	return BL_SAM_DATA_OUT_OF_RANGE;
+    else
+    {
+	// Same truncation as strlcpy(), into the packed name buffer
+	len = strnlen(new_rname, array_size - 1);
+	bl_sam_set_names(bl_sam_ptr,
+			 BL_SAM_QNAME(bl_sam_ptr), strlen(BL_SAM_QNAME(bl_sam_ptr)),
+			 new_rname, len,
+			 BL_SAM_RNEXT(bl_sam_ptr), strlen(BL_SAM_RNEXT(bl_sam_ptr)));
+	return BL_SAM_DATA_OK;
+    }
+}
+
+
+/***************************************************************************
+ *  Name:
+ *      bl_sam_set_rnext_ae() - Set one character of RNEXT
+ *
+ *  Library:
+ *      #include <biolibc/sam.h>
+ *      -lbiolibc -lxtend
+ *
+ *  Description:
+ *      Set character c of the RNEXT of a bl_sam_t object.  QNAME, RNAME and
+ *      RNEXT are packed into one buffer, so c must be within the current
+ *      RNEXT.  Use bl_sam_set_rnext_cpy(3) to change its length.
+ *
+ *  Arguments:
+ *      bl_sam_ptr      Pointer to the bl_sam_t object to modify
+ *      c               Subscript within RNEXT
+ *      new_rnext_element The new value for RNEXT[c]
+ *
+ *  Returns:
+ *      BL_SAM_DATA_OK if the new value is acceptable and assigned
+ *      BL_SAM_DATA_OUT_OF_RANGE otherwise
+ *
+ *  Examples:
+ *      bl_sam_t        bl_sam;
+ *      size_t          c;
+ *      char            new_rnext_element;
+ *
+ *      if ( bl_sam_set_rnext_ae(&bl_sam, c, new_rnext_element)
+ *              == BL_SAM_DATA_OK )
+ *      {
+ *      }
+ *
+ *  See also:
+ *      BL_SAM_RNEXT(3), bl_sam_set_names(3)
+ *
+ *  History: 
+ *  Date        Name        Modification
+ *  2022-04-30  gen-get-set Auto-generated from sam.h
+ *  2026-10-17  agent       Store in packed name buffer
+ *  2026-10-17  agent       Move from generated sam-mutators.c
+ ***************************************************************************/
+
+int     bl_sam_set_rnext_ae(bl_sam_t *bl_sam_ptr, size_t c, char new_rnext_element)
+
+{
+    // Names are packed, so stay within the current string
+    if ( c >= strlen(BL_SAM_RNEXT(bl_sam_ptr)) )
+	return BL_SAM_DATA_OUT_OF_RANGE;
+    else
+    {
+	BL_SAM_RNEXT_AE(bl_sam_ptr, c) = new_rnext_element;
+	return BL_SAM_DATA_OK;
+    }
+}
+
+
+/***************************************************************************
+ *  Name:
+ *      bl_sam_set_rnext_cpy() - Copy a new RNEXT
+ *
+ *  Library:
+ *      #include <biolibc/sam.h>
+ *      -lbiolibc -lxtend
+ *
+ *  Description:
+ *      Replace the RNEXT of a bl_sam_t object with new_rnext, truncated
+ *      like strlcpy(3) to array_size - 1 characters.  QNAME, RNAME and
+ *      RNEXT are packed into one buffer, which is rebuilt by
+ *      bl_sam_set_names(3).
+ *
+ *  Arguments:
+ *      bl_sam_ptr      Pointer to the bl_sam_t object to modify
+ *      new_rnext       The new RNEXT
+ *      array_size      Size of the new_rnext array
+ *
+ *  Returns:
+ *      BL_SAM_DATA_OK if the new value is acceptable and assigned
+ *      BL_SAM_DATA_OUT_OF_RANGE otherwise
+ *
+ *  Examples:
+ *      bl_sam_t        bl_sam;
+ *      char            new_rnext[BL_SAM_RNAME_MAX_CHARS + 1];
+ *      size_t          array_size;
+ *
+ *      if ( bl_sam_set_rnext_cpy(&bl_sam, new_rnext, array_size)
+ *              == BL_SAM_DATA_OK )
+ *      {
+ *      }
+ *
+ *  See also:
+ *      BL_SAM_RNEXT(3), bl_sam_set_names(3)
+ *
+ *  History: 
+ *  Date        Name        Modification
+ *  2022-04-30  gen-get-set Auto-generated from sam.h
+ *  2026-10-17  agent       Store in packed name buffer
+ *  2026-10-17  agent       Move from generated sam-mutators.c
+ ***************************************************************************/
+
+int     bl_sam_set_rnext_cpy(bl_sam_t *bl_sam_ptr, char new_rnext[], size_t array_size)
+
+{
+    size_t  len;
+    
+    if ( (new_rnext == NULL) || (array_size == 0) )
+	return BL_SAM_DATA_OUT_OF_RANGE;
+    else
+    {
+	// Same truncation as strlcpy(), into the packed name buffer
+	len = strnlen(new_rnext, array_size - 1);
+	bl_sam_set_names(bl_sam_ptr,
+			 BL_SAM_QNAME(bl_sam_ptr), strlen(BL_SAM_QNAME(bl_sam_ptr)),
+			 BL_SAM_RNAME(bl_sam_ptr), strlen(BL_SAM_RNAME(bl_sam_ptr)),
+			 new_rnext, len);
+	return BL_SAM_DATA_OK;
+    }
+}
+
+
+/***************************************************************************
+ *  Name:
+ *      bl_sam_set_chrom_dict() - Attach a chromosome dictionary
+ *
+ *  Library:
+ *      #include <biolibc/sam.h>
+ *      -lbiolibc -lxtend
+ *
+ *  Description:
+ *      Mutator for chrom_dict member in a bl_sam_t structure.
+ *      Use this function to set chrom_dict in a bl_sam_t object
+ *      from non-member functions.  The dictionary is shared, not
+ *      copied, and rname_id is updated for the current RNAME.  Pass
+ *      NULL to stop interning names.
+ *
+ *  Arguments:
+ *      bl_sam_ptr      Pointer to the bl_sam_t object to modify
+ *      new_chrom_dict  The new value for chrom_dict
+ *
+ *  Returns:
+ *      BL_SAM_DATA_OK
+ *
+ *  Examples:
+ *      bl_sam_t        bl_sam;
+ *      bl_chrom_dict_t *new_chrom_dict;
+ *
+ *      if ( bl_sam_set_chrom_dict(&bl_sam, new_chrom_dict)
+ *              == BL_SAM_DATA_OK )
+ *      {
+ *      }
+ *
+ *  See also:
+ *      bl_chrom_dict_intern(3)
+ *
+ *  History: 
+ *  Date        Name        Modification
+ *  2026-10-17  agent       Begin
+ *  2026-10-17  agent       Move from generated sam-mutators.c
+ ***************************************************************************/
+
+int     bl_sam_set_chrom_dict(bl_sam_t *bl_sam_ptr, bl_chrom_dict_t *new_chrom_dict)
+
+{
+    bl_sam_ptr->chrom_dict = new_chrom_dict;
+    bl_sam_ptr->rname_id = bl_chrom_dict_intern(new_chrom_dict,
+			    BL_CHROM_ID_NONE, BL_SAM_RNAME(bl_sam_ptr));
+    return BL_SAM_DATA_OK;
+}
@@ -9,27 +9,35 @@
 #include "biolibc.h"
 #endif
 
+#ifndef _BIOLIBC_CHROM_DICT_H_
+#include "chrom-dict.h"
+#endif
+
 #define BL_SAM_MAPQ_MAX_CHARS  5
 #define BL_SAM_QNAME_MAX_CHARS 4096
 #define BL_SAM_RNAME_MAX_CHARS 4096
 #define BL_SAM_FLAG_MAX_DIGITS 32    // What should this really be?
+#define BL_SAM_MANDATORY_FIELDS 11
+
+// Field counts of the bl_sam_write_raw() record header
+#define BL_SAM_RAW_FIXED_FIELDS 6
+#define BL_SAM_RAW_LEN_FIELDS   6
 
 // Keep this for initializing static objects, where we don't want to
 // call bl_sam_init() every time.
-#define BL_SAM_INIT { "", 0, "", 0, 0, NULL, "", 0, 0, NULL, NULL, 0, 0, 0, 0, 0, 0 }
+#define BL_SAM_INIT { 0, 0, 0, NULL, 0, 0, NULL, NULL, 0, 0, 0, 0, 0, 0, \
+		      NULL, 0, "", 0, 0, 0, 0, NULL, BL_CHROM_ID_NONE, \
+		      NULL, 0, 0, 0 }
 
 typedef struct
 {
     /* SAM specification fields.  Meet or exceed published ranges. */
-    // Query template (DNA fragment):
-    // Same name means likely from the same template
-    char            qname[BL_SAM_QNAME_MAX_CHARS + 1];
+    // QNAME, RNAME and RNEXT are packed into names below.  Use
+    // BL_SAM_QNAME(), BL_SAM_RNAME() and BL_SAM_RNEXT() to access them.
     
     // Bit flags indicating mapping results
     unsigned        flag;
     
-    // Sequence to which mapped (e.g. chromosome)
-    char            rname[BL_SAM_RNAME_MAX_CHARS + 1];
     int64_t         pos;
     
     // Mapping quality
@@ -39,9 +47,7 @@ typedef struct
     // Alignment report (more detailed info than flag)
     char            *cigar;
     
-    // Be sure to update bl_sam_free if changed to dynamic allocation
-    // Seq and pos of next read in the template
-    char            rnext[BL_SAM_RNAME_MAX_CHARS + 1];
+    // Pos of next read in the template
     int64_t         pnext;
     
     long            tlen;   // Template length.  FIXME: Max size?
@@ -56,8 +62,66 @@ typedef struct
 		    seq_len,
 		    qual_array_size,
 		    qual_len;
+    
+    // Whole input line, reused by bl_sam_read() to avoid per-field I/O
+    char            *line;
+    size_t          line_array_size;
+    
+    /*
+     *  QNAME, RNAME and RNEXT, each null-terminated, one after another.
+     *  A single small buffer instead of three fixed 4 KiB arrays keeps
+     *  the structure small enough that bl_sam_buff_t can hold deep
+     *  pileups, and bl_sam_copy() touches only the bytes in use.
+     *  names_array_size is 0 while names points to a static "".
+     */
+    char            *names;
+    size_t          names_array_size,
+		    names_len,          // Bytes in use, including nulls
+		    rname_offset,
+		    rnext_offset;
+    
+    /*
+     *  Optional shared chromosome dictionary.  If set, bl_sam_read() and
+     *  bl_bam_read() intern RNAME and store its ID in rname_id, so that
+     *  chromosome comparisons are integer compares.
+     */
+    bl_chrom_dict_t *chrom_dict;
+    int32_t         rname_id;
+    
+    /*
+     *  CIGAR parsed once by bl_sam_read() and bl_bam_read() into packed
+     *  BAM-style ops, (length << 4) | op.  ref_end is the last reference
+     *  position covered, which differs from pos + seq_len - 1 when the
+     *  alignment has indels, clipping or splicing.
+     */
+    uint32_t        *cigar_ops;
+    size_t          cigar_ops_array_size,
+		    cigar_op_count;
+    int64_t         ref_end;
 }   bl_sam_t;
 
+/* Packed CIGAR operations, same codes as BAM */
+#define BL_SAM_CIGAR_OP_CHARS       "MIDNSHP=X"
+#define BL_SAM_CIGAR_MATCH          0   // M
+#define BL_SAM_CIGAR_INS            1   // I
+#define BL_SAM_CIGAR_DEL            2   // D
+#define BL_SAM_CIGAR_REF_SKIP       3   // N
+#define BL_SAM_CIGAR_SOFT_CLIP      4   // S
+#define BL_SAM_CIGAR_HARD_CLIP      5   // H
+#define BL_SAM_CIGAR_PAD            6   // P
+#define BL_SAM_CIGAR_EQUAL          7   // =
+#define BL_SAM_CIGAR_DIFF           8   // X
+
+#define BL_SAM_CIGAR_OP(packed)     ((packed) & 0xf)
+#define BL_SAM_CIGAR_OP_LEN(packed) ((packed) >> 4)
+
+// Bit masks of ops: M I S = X consume query, M D N = X consume reference
+#define BL_SAM_CIGAR_CONSUMES_QUERY(op) ((0x193 >> (op)) & 1)
+#define BL_SAM_CIGAR_CONSUMES_REF(op)   ((0x18d >> (op)) & 1)
+
+// Returned by bl_sam_ref_to_query() and bl_sam_query_to_ref()
+#define BL_SAM_POS_NONE             -1
+
 typedef unsigned int        sam_field_mask_t;
 
 /* Bit flags to select fields in bl_sam_read() or bl_sam_write() */
@@ -88,6 +152,17 @@ typedef unsigned int        sam_field_mask_t;
 #define BL_SAM_FLAG_DUP             0x400
 #define BL_SAM_FLAG_SUPPLEMENTARY   0x800
 
+/*
+ *  Names are packed into one buffer, so these replace the generated
+ *  accessors.  Set them with bl_sam_set_names() or the *_cpy() functions.
+ */
+#define BL_SAM_QNAME(ptr)           ((ptr)->names)
+#define BL_SAM_QNAME_AE(ptr,c)      ((ptr)->names[c])
+#define BL_SAM_RNAME(ptr)           ((ptr)->names + (ptr)->rname_offset)
+#define BL_SAM_RNAME_AE(ptr,c)      (BL_SAM_RNAME(ptr)[c])
+#define BL_SAM_RNEXT(ptr)           ((ptr)->names + (ptr)->rnext_offset)
+#define BL_SAM_RNEXT_AE(ptr,c)      (BL_SAM_RNEXT(ptr)[c])
+
 #include "sam-rvs.h"
 #include "sam-accessors.h"
 #include "sam-mutators.h"
@@ -102,12 +177,29 @@ FILE *bl_sam_skip_header(FILE *sam_stream);
 int bl_sam_copy_header(FILE *header_stream, FILE *sam_stream);
 int bl_sam_read(bl_sam_t *sam_alignment, FILE *sam_stream, sam_field_mask_t field_mask);
 void bl_sam_copy(bl_sam_t *dest, bl_sam_t *src);
+void bl_sam_copy_reuse(bl_sam_t *dest, bl_sam_t *src);
+void bl_sam_move(bl_sam_t *dest, bl_sam_t *src);
 void bl_sam_free(bl_sam_t *sam_alignment);
 void bl_sam_init(bl_sam_t *sam_alignment);
+void bl_sam_set_names(bl_sam_t *alignment, const char *qname, size_t qname_len, const char *rname, size_t rname_len, const char *rnext, size_t rnext_len);
+int bl_sam_parse_cigar(bl_sam_t *alignment);
+void bl_sam_update_ref_end(bl_sam_t *alignment);
+int64_t bl_sam_ref_to_query(bl_sam_t *alignment, int64_t ref_pos);
+int64_t bl_sam_query_to_ref(bl_sam_t *alignment, int64_t query_offset);
 int bl_sam_write(bl_sam_t *sam_alignment, FILE *sam_stream, sam_field_mask_t field_mask);
+int bl_sam_write_raw(bl_sam_t *alignment, FILE *stream);
+int bl_sam_read_raw(bl_sam_t *alignment, FILE *stream);
 FILE *bl_sam_fopen(const char *filename, const char *mode, char *samtools_flags);
+FILE *bl_sam_fopen_threads(const char *filename, const char *mode, char *samtools_args, unsigned threads);
 int bl_sam_fclose(FILE *stream);
 int64_t bl_sam_gff3_overlap(bl_sam_t *alignment, bl_gff3_t *feature);
 int bl_sam_gff3_cmp(bl_sam_t *alignment, bl_gff3_t *feature);
+int bl_sam_set_qname_ae(bl_sam_t *bl_sam_ptr, size_t c, char new_qname_element);
+int bl_sam_set_qname_cpy(bl_sam_t *bl_sam_ptr, char new_qname[], size_t array_size);
+int bl_sam_set_rname_ae(bl_sam_t *bl_sam_ptr, size_t c, char new_rname_element);
+int bl_sam_set_rname_cpy(bl_sam_t *bl_sam_ptr, char new_rname[], size_t array_size);
+int bl_sam_set_rnext_ae(bl_sam_t *bl_sam_ptr, size_t c, char new_rnext_element);
+int bl_sam_set_rnext_cpy(bl_sam_t *bl_sam_ptr, char new_rnext[], size_t array_size);
+int bl_sam_set_chrom_dict(bl_sam_t *bl_sam_ptr, bl_chrom_dict_t *new_chrom_dict);
 
 #endif // _BIOLIBC_SAM_H_
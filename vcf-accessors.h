@@ -49,3 +49,5 @@
 #define BL_VCF_PHREDS_AE(ptr,c)         ((ptr)->phreds[c])
 #define BL_VCF_PHRED_COUNT(ptr)         ((ptr)->phred_count)
 #define BL_VCF_PHRED_BUFF_SIZE(ptr)     ((ptr)->phred_buff_size)
+#define BL_VCF_CHROM_DICT(ptr)          ((ptr)->chrom_dict)
+#define BL_VCF_CHROM_ID(ptr)            ((ptr)->chrom_id)
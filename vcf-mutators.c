@@ -2442,3 +2442,52 @@ int     bl_vcf_set_phred_buff_size(bl_vcf_t *bl_vcf_ptr, size_t new_phred_buff_s
 	return BL_VCF_DATA_OK;
     }
 }
+
+
+/***************************************************************************
+ *  Library:
+ *      #include <biolibc/vcf.h>
+ *      -lbiolibc -lxtend
+ *
+ *  Description:
+ *      Mutator for chrom_dict member in a bl_vcf_t structure.
+ *      Use this function to set chrom_dict in a bl_vcf_t object
+ *      from non-member functions.  The dictionary is shared, not
+ *      copied, and chrom_id is updated for the current CHROM.  Pass
+ *      NULL to stop interning names.
+ *
+ *  Arguments:
+ *      bl_vcf_ptr      Pointer to the structure to set
+ *      new_chrom_dict  The new value for chrom_dict
+ *
+ *  Returns:
+ *      BL_VCF_DATA_OK
+ *
+ *  Examples:
+ *      bl_vcf_t        bl_vcf;
+ *      bl_chrom_dict_t *new_chrom_dict;
+ *
+ *      if ( bl_vcf_set_chrom_dict(&bl_vcf, new_chrom_dict)
+ *              == BL_VCF_DATA_OK )
+ *      {
+ *      }
+ *
+ *  See also:
+ *      bl_chrom_dict_intern(3)
+ *
+ *  History: 
+ *  Date        Name        Modification
+ *  2026-10-17  agent       Begin
+ ***************************************************************************/
+
+int     bl_vcf_set_chrom_dict(bl_vcf_t *bl_vcf_ptr, bl_chrom_dict_t *new_chrom_dict)
+
+{
+    bl_vcf_ptr->chrom_dict = new_chrom_dict;
+    if ( bl_vcf_ptr->chrom == NULL )
+	bl_vcf_ptr->chrom_id = BL_CHROM_ID_NONE;
+    else
+	bl_vcf_ptr->chrom_id = bl_chrom_dict_intern(new_chrom_dict,
+				BL_CHROM_ID_NONE, BL_VCF_CHROM(bl_vcf_ptr));
+    return BL_VCF_DATA_OK;
+}
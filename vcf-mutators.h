@@ -61,3 +61,4 @@ int bl_vcf_set_phreds_ae(bl_vcf_t *bl_vcf_ptr, size_t c, unsigned char new_phred
 int bl_vcf_set_phreds_cpy(bl_vcf_t *bl_vcf_ptr, unsigned char *new_phreds, size_t array_size);
 int bl_vcf_set_phred_count(bl_vcf_t *bl_vcf_ptr, size_t new_phred_count);
 int bl_vcf_set_phred_buff_size(bl_vcf_t *bl_vcf_ptr, size_t new_phred_buff_size);
+int bl_vcf_set_chrom_dict(bl_vcf_t *bl_vcf_ptr, bl_chrom_dict_t *new_chrom_dict);
@@ -3,10 +3,12 @@
 #include <stdlib.h>
 #include <sysexits.h>
 #include <stdbool.h>
+#include <ctype.h>
 #include <xtend/dsv.h>
 #include <xtend/string.h>   // xt_ltostrn()
 #include <xtend/mem.h>
 #include "vcf.h"
+#include "sam-buff.h"
 #include "biostring.h"
 
 /***************************************************************************
@@ -255,6 +257,11 @@ void    bl_vcf_get_sample_ids(FILE *vcf_stream, char *sample_ids[],
  *      This function does not read any of the sample data in columns 10
  *      and on.  Samples can be read using a loop with xt_tsv_read_field(3).
  *
+ *      If vcf_call has a chromosome dictionary set with
+ *      bl_vcf_set_chrom_dict(3), CHROM is interned and its ID stored
+ *      in chrom_id, so that comparisons with SAM alignments sharing the
+ *      dictionary are integer compares.
+ *
  *      If field_mask is not BL_VCF_FIELD_ALL, fields not indicated by a 1
  *      in the bit mask are discarded rather than stored in bed_feature.
  *      Possible mask values are:
@@ -293,11 +300,13 @@ void    bl_vcf_get_sample_ids(FILE *vcf_stream, char *sample_ids[],
  *      }
  *
  *  See also:
- *      bl_vcf_write_static_fields(3), bl_vcf_read_ss_call(3), bl_vcf_write_ss_call(3)
+ *      bl_vcf_write_static_fields(3), bl_vcf_read_ss_call(3), bl_vcf_write_ss_call(3),
+ *      bl_vcf_set_chrom_dict(3)
  *
  *  History: 
  *  Date        Name        Modification
  *  2019-12-08  Jason Bacon Begin
+ *  2026-10-17  agent       Set chrom_id from chrom_dict
  ***************************************************************************/
 
 int     bl_vcf_read_static_fields(bl_vcf_t *vcf_call, FILE *vcf_stream, 
@@ -327,6 +336,8 @@ int     bl_vcf_read_static_fields(bl_vcf_t *vcf_call, FILE *vcf_stream,
 	// fputs("bl_vcf_read_static_fields(): Info: Got EOF reading CHROM, as expected.\n", stderr);
 	return BL_READ_EOF;
     }
+    vcf_call->chrom_id = bl_chrom_dict_intern(vcf_call->chrom_dict,
+					      vcf_call->chrom_id, vcf_call->chrom);
     
     // Call position
     if ( field_mask & BL_VCF_FIELD_POS )
@@ -713,77 +724,87 @@ char    **bl_vcf_sample_alloc(bl_vcf_t *vcf_call, size_t samples)
 
 
 /***************************************************************************
+ *  Name:
+ *      bl_vcf_phred_add() - Append a PHRED score to a VCF call
+ *
+ *  Library:
+ *      #include <biolibc/vcf.h>
+ *      -lbiolibc -lxtend
+ *
+ *  Description:
+ *      Append the PHRED score of a read base supporting a VCF call to
+ *      the phreds buffer of the call, growing it as needed.  Scores are
+ *      stored as in the SAM QUAL field, and the buffer is kept
+ *      null-terminated so it can be printed as a string.
+ *
+ *  Arguments:
+ *      vcf_call    Pointer to bl_vcf_t structure
+ *      score       PHRED score character
+ *
+ *  Returns:
+ *      BL_READ_OK
+ *
+ *  See also:
+ *      bl_vcf_phred_blank(3), bl_vcf_allele_depths(3)
+ *
  *  History: 
  *  Date        Name        Modification
  *  2020-01-22  Jason Bacon Begin
+ *  2026-10-17  agent       Enable, start from an empty buffer
  ***************************************************************************/
 
-#if 0
-int     vcf_phred_add(bl_vcf_t *vcf_call, unsigned char score)
+int     bl_vcf_phred_add(bl_vcf_t *vcf_call, unsigned char score)
 
 {
-    if ( vcf_call->phreds == NULL )
-    {
-	// fprintf(stderr, "vcf_phred_add(): Allocating initial buffer.\n");
-	if ( (vcf_call->phreds = xt_malloc(vcf_call->phred_buff_size,
-				    sizeof(*vcf_call->phreds))) == NULL )
-	{
-	    fprintf(stderr, "vcf_phred_add(): Could not allocate phreds.\n");
-	    exit(EX_UNAVAILABLE);
-	}
-    }
-    
-    // fprintf(stderr, "vcf_phred_add(): Adding '%c' at %zu\n", score, vcf_call->phred_count);
-    vcf_call->phreds[vcf_call->phred_count++] = score;
-    vcf_call->phreds[vcf_call->phred_count] = '\0';
-    
-    if ( vcf_call->phred_count == vcf_call->phred_buff_size )
+    if ( vcf_call->phred_count + 1 >= vcf_call->phred_buff_size )
     {
-	vcf_call->phred_buff_size *= 2;
+	vcf_call->phred_buff_size = vcf_call->phred_buff_size == 0 ?
+	    BL_VCF_PHRED_BUFF_START_SIZE : vcf_call->phred_buff_size * 2;
 	if ( (vcf_call->phreds = xt_realloc(vcf_call->phreds,
 		    vcf_call->phred_buff_size,
 		    sizeof(*vcf_call->phreds))) == NULL )
 	{
-	    fprintf(stderr, "vcf_phred_add(): Could not reallocate phreds.\n");
+	    fprintf(stderr, "bl_vcf_phred_add(): Could not allocate phreds.\n");
 	    exit(EX_UNAVAILABLE);
 	}
     }
+    vcf_call->phreds[vcf_call->phred_count++] = score;
+    vcf_call->phreds[vcf_call->phred_count] = '\0';
     return BL_READ_OK;
 }
 
 
 /***************************************************************************
+ *  Name:
+ *      bl_vcf_phred_blank() - Empty the PHRED scores of a VCF call
+ *
+ *  Library:
+ *      #include <biolibc/vcf.h>
+ *      -lbiolibc -lxtend
+ *
+ *  Description:
+ *      Discard the PHRED scores collected by bl_vcf_phred_add(3),
+ *      keeping the buffer for reuse with the next call.
+ *
+ *  Arguments:
+ *      vcf_call    Pointer to bl_vcf_t structure
+ *
+ *  See also:
+ *      bl_vcf_phred_add(3)
+ *
  *  History: 
  *  Date        Name        Modification
  *  2020-01-22  Jason Bacon Begin
+ *  2026-10-17  agent       Enable, keep buffer unallocated until needed
  ***************************************************************************/
 
-void    vcf_phred_blank(bl_vcf_t *vcf_call)
-
-{
-    memcpy(vcf_call->phreds, "z", 2);
-    vcf_call->phred_count = 0;
-}
-
-    
-/***************************************************************************
- *  History: 
- *  Date        Name        Modification
- *  2020-01-22  Jason Bacon Begin
- ***************************************************************************/
-
-void    vcf_phred_free(bl_vcf_t *vcf_call)
+void    bl_vcf_phred_blank(bl_vcf_t *vcf_call)
 
 {
     if ( vcf_call->phreds != NULL )
-    {
-	free(vcf_call->phreds);
-	vcf_call->phreds = NULL;
-	vcf_call->phred_buff_size = BL_VCF_PHRED_BUFF_SIZE;
-    }
-    vcf_phred_blank(vcf_call);
+	*vcf_call->phreds = '\0';
+    vcf_call->phred_count = 0;
 }
-#endif
 
 
 /***************************************************************************
@@ -806,6 +827,7 @@ void    vcf_phred_free(bl_vcf_t *vcf_call)
  *  History: 
  *  Date        Name        Modification
  *  2020-01-22  Jason Bacon Begin
+ *  2026-10-17  agent       Free phreds
  ***************************************************************************/
 
 void    bl_vcf_free(bl_vcf_t *vcf_call)
@@ -822,6 +844,7 @@ void    bl_vcf_free(bl_vcf_t *vcf_call)
     free(vcf_call->info);
     free(vcf_call->format);
     free(vcf_call->single_sample);
+    free(vcf_call->phreds);
     if ( vcf_call->multi_samples != NULL )
     {
 	for (c = 0; c < vcf_call->multi_sample_count; ++c)
@@ -860,6 +883,8 @@ void    bl_vcf_free(bl_vcf_t *vcf_call)
  *  History: 
  *  Date        Name        Modification
  *  2020-01-22  Jason Bacon Begin
+ *  2026-10-17  agent       Initialize chrom_dict and chrom_id
+ *  2026-10-17  agent       Initialize phreds
  ***************************************************************************/
 
 void    bl_vcf_init(bl_vcf_t *vcf_call)
@@ -895,6 +920,10 @@ void    bl_vcf_init(bl_vcf_t *vcf_call)
     vcf_call->alt_count = 0;
     vcf_call->other_count = 0;
     
+    vcf_call->phreds = NULL;
+    vcf_call->phred_count = 0;
+    vcf_call->phred_buff_size = 0;
+    
     vcf_call->info_array_size = 0;
     vcf_call->info_len = 0;
     vcf_call->info = NULL;
@@ -910,6 +939,9 @@ void    bl_vcf_init(bl_vcf_t *vcf_call)
     vcf_call->multi_samples = NULL;
     vcf_call->multi_sample_count = 0;
     vcf_call->multi_sample_pointer_array_size = 0;
+    
+    vcf_call->chrom_dict = NULL;
+    vcf_call->chrom_id = BL_CHROM_ID_NONE;
 }
 
 
@@ -990,7 +1022,13 @@ vcf_field_mask_t    bl_vcf_parse_field_spec(char *spec)
  *  Description:
  *      Determine if a VCF call is within a SAM alignment, i.e. on the
  *      same chrom and between the start and end positions of the
- *      alignment.
+ *      alignment.  The end position is the reference end from the
+ *      CIGAR, BL_SAM_REF_END(3), so deletions and spliced reads are
+ *      spanned correctly.  The call may still fall in a deletion or
+ *      intron; use bl_sam_ref_to_query(3) to find the read base.
+ *
+ *      If both records share a chromosome dictionary, chromosomes are
+ *      compared by ID rather than by name.
  *
  *  Arguments:
  *      vcf_call    Pointer to bl_vcf_t structure containing VCF call
@@ -1006,16 +1044,26 @@ vcf_field_mask_t    bl_vcf_parse_field_spec(char *spec)
  *  History: 
  *  Date        Name        Modification
  *  2020-05-26  Jason Bacon Begin
+ *  2026-10-17  agent       Compare chrom IDs when both share a chrom_dict
+ *  2026-10-17  agent       Use CIGAR reference end instead of seq_len
  ***************************************************************************/
 
 
 bool    bl_vcf_call_in_alignment(bl_vcf_t *vcf_call, bl_sam_t *sam_alignment)
 
 {
-    if ( (strcmp(BL_VCF_CHROM(vcf_call), BL_SAM_RNAME(sam_alignment)) == 0) &&
+    bool    same_chrom;
+    
+    if ( BL_CHROM_IDS_COMPARABLE(vcf_call->chrom_dict, vcf_call->chrom_id,
+	    sam_alignment->chrom_dict, sam_alignment->rname_id) )
+	same_chrom = vcf_call->chrom_id == sam_alignment->rname_id;
+    else
+	same_chrom = strcmp(BL_VCF_CHROM(vcf_call),
+			    BL_SAM_RNAME(sam_alignment)) == 0;
+    
+    if ( same_chrom &&
 	 (BL_VCF_POS(vcf_call) >= BL_SAM_POS(sam_alignment)) &&
-	 (BL_VCF_POS(vcf_call) <
-	    BL_SAM_POS(sam_alignment) + BL_SAM_SEQ_LEN(sam_alignment)) )
+	 (BL_VCF_POS(vcf_call) <= BL_SAM_REF_END(sam_alignment)) )
 	return true;
     else
 	return false;
@@ -1033,7 +1081,11 @@ bool    bl_vcf_call_in_alignment(bl_vcf_t *vcf_call, bl_sam_t *sam_alignment)
  *  Description:
  *      Determine if a VCF call is downstream of a SAM alignment.
  *      For the purpose of this function, this could mean on the same
- *      chrom and higher position, or on a later chrom.
+ *      chrom and past the reference end of the alignment, or on a
+ *      later chrom.
+ *
+ *      If both records share a chromosome dictionary, chromosome order
+ *      is taken from the precomputed ranks of bl_chrom_dict_cmp(3).
  *
  *  Arguments:
  *      vcf_call    Pointer to bl_vcf_t structure containing VCF call
@@ -1049,6 +1101,8 @@ bool    bl_vcf_call_in_alignment(bl_vcf_t *vcf_call, bl_sam_t *sam_alignment)
  *  History: 
  *  Date        Name        Modification
  *  2020-05-26  Jason Bacon Begin
+ *  2026-10-17  agent       Compare chrom IDs when both share a chrom_dict
+ *  2026-10-17  agent       Use CIGAR reference end instead of seq_len
  ***************************************************************************/
 
 bool    bl_vcf_call_downstream_of_alignment(bl_vcf_t *vcf_call,
@@ -1059,10 +1113,20 @@ bool    bl_vcf_call_downstream_of_alignment(bl_vcf_t *vcf_call,
 	    BL_SAM_RNAME(sam_alignment),BL_SAM_POS(sam_alignment),
 	    BL_SAM_SEQ_LEN(sam_alignment),
 	    BL_VCF_CHROM(vcf_call),BL_VCF_POS(vcf_call));*/
-    if ( (BL_SAM_POS(alignment) + BL_SAM_SEQ_LEN(alignment) <= BL_VCF_POS(vcf_call)) &&
-	  (strcmp(BL_SAM_RNAME(alignment), BL_VCF_CHROM(vcf_call)) == 0) )
+    int     chrom_cmp;
+    
+    if ( BL_CHROM_IDS_COMPARABLE(alignment->chrom_dict, alignment->rname_id,
+	    vcf_call->chrom_dict, vcf_call->chrom_id) )
+	chrom_cmp = bl_chrom_dict_cmp(alignment->chrom_dict,
+				      alignment->rname_id, vcf_call->chrom_id);
+    else
+	chrom_cmp = bl_chrom_name_cmp(BL_SAM_RNAME(alignment),
+				      BL_VCF_CHROM(vcf_call));
+    
+    if ( (chrom_cmp == 0) &&
+	 (BL_SAM_REF_END(alignment) < BL_VCF_POS(vcf_call)) )
 	return true;
-    else if ( bl_chrom_name_cmp(BL_SAM_RNAME(alignment), BL_VCF_CHROM(vcf_call)) < 0 )
+    else if ( chrom_cmp < 0 )
 	return true;
     else
 	return false;
@@ -1106,3 +1170,273 @@ void    bl_vcf_call_out_of_order(bl_vcf_t *vcf_call,
 	    previous_chrom, previous_pos);
     exit(EX_DATAERR);
 }
+
+
+/***************************************************************************
+ *  Name:
+ *      bl_vcf_call_upstream_of_alignment() - Return true if VCF call is upstream of alignment
+ *
+ *  Library:
+ *      #include <biolibc/vcf.h>
+ *      -lbiolibc -lxtend
+ *
+ *  Description:
+ *      Determine if a VCF call is upstream of a SAM alignment, i.e. the
+ *      alignment starts past the call on the same chrom, or is on a
+ *      later chrom.  In a SAM stream sorted by chrom and position, no
+ *      alignment following this one can contain the call either.
+ *
+ *      If both records share a chromosome dictionary, chromosome order
+ *      is taken from the precomputed ranks of bl_chrom_dict_cmp(3).
+ *
+ *  Arguments:
+ *      vcf_call    Pointer to bl_vcf_t structure containing VCF call
+ *      alignment   Pointer to bl_sam_t structure containing alignment
+ *
+ *  Returns:
+ *      true if the call is upstream of the alignment
+ *      false otherwise
+ *
+ *  See also:
+ *      bl_vcf_call_downstream_of_alignment(3), bl_vcf_call_in_alignment(3)
+ *
+ *  History: 
+ *  Date        Name        Modification
+ *  2026-10-17  agent       Begin
+ ***************************************************************************/
+
+bool    bl_vcf_call_upstream_of_alignment(bl_vcf_t *vcf_call,
+	    bl_sam_t *alignment)
+
+{
+    int     chrom_cmp;
+    
+    if ( BL_CHROM_IDS_COMPARABLE(alignment->chrom_dict, alignment->rname_id,
+	    vcf_call->chrom_dict, vcf_call->chrom_id) )
+	chrom_cmp = bl_chrom_dict_cmp(alignment->chrom_dict,
+				      alignment->rname_id, vcf_call->chrom_id);
+    else
+	chrom_cmp = bl_chrom_name_cmp(BL_SAM_RNAME(alignment),
+				      BL_VCF_CHROM(vcf_call));
+    
+    return (chrom_cmp > 0) ||
+	   ((chrom_cmp == 0) && (BL_SAM_POS(alignment) > BL_VCF_POS(vcf_call)));
+}
+
+
+/***************************************************************************
+ *  Name:
+ *      bl_vcf_count_allele() - Count the allele an alignment shows at a VCF call
+ *
+ *  Library:
+ *      #include <biolibc/vcf.h>
+ *      -lbiolibc -lxtend
+ *
+ *  Description:
+ *      Find the read base aligned to the position of a single-nucleotide
+ *      VCF call using bl_sam_ref_to_query(3), and add one to ref_count
+ *      if it matches REF, alt_count if it matches any of the
+ *      comma-separated ALT alleles, or other_count otherwise.
+ *      Comparison is case-insensitive.  The PHRED score of the base, if
+ *      the alignment has QUAL, is appended with bl_vcf_phred_add(3).
+ *
+ *      Nothing is counted if the call is not a SNV, if the alignment has
+ *      no SEQ, or if the call falls in a deletion or skipped region of
+ *      the alignment.  The caller must ensure the call is within the
+ *      alignment, e.g. with bl_vcf_call_in_alignment(3).
+ *
+ *  Arguments:
+ *      vcf_call    Pointer to bl_vcf_t structure containing VCF call
+ *      alignment   Pointer to bl_sam_t structure containing alignment
+ *
+ *  Returns:
+ *      true if a base was counted
+ *      false otherwise
+ *
+ *  See also:
+ *      bl_vcf_allele_depths(3), bl_sam_ref_to_query(3)
+ *
+ *  History: 
+ *  Date        Name        Modification
+ *  2026-10-17  agent       Begin
+ ***************************************************************************/
+
+bool    bl_vcf_count_allele(bl_vcf_t *vcf_call, bl_sam_t *alignment)
+
+{
+    int64_t offset;
+    size_t  c;
+    int     base;
+    
+    // ALT is one or more single bases separated by commas
+    if ( (vcf_call->ref_len != 1) || (vcf_call->alt_len % 2 == 0) )
+	return false;
+    for (c = 1; c < vcf_call->alt_len; c += 2)
+	if ( vcf_call->alt[c] != ',' )
+	    return false;
+    
+    offset = bl_sam_ref_to_query(alignment, BL_VCF_POS(vcf_call));
+    if ( (offset == BL_SAM_POS_NONE) ||
+	 ((size_t)offset >= BL_SAM_SEQ_LEN(alignment)) )
+	return false;
+    
+    base = toupper((unsigned char)BL_SAM_SEQ_AE(alignment, offset));
+    if ( base == toupper((unsigned char)*vcf_call->ref) )
+	++vcf_call->ref_count;
+    else
+    {
+	for (c = 0; c < vcf_call->alt_len; c += 2)
+	    if ( base == toupper((unsigned char)vcf_call->alt[c]) )
+		break;
+	if ( c < vcf_call->alt_len )
+	    ++vcf_call->alt_count;
+	else
+	    ++vcf_call->other_count;
+    }
+    
+    if ( (size_t)offset < BL_SAM_QUAL_LEN(alignment) )
+	bl_vcf_phred_add(vcf_call, BL_SAM_QUAL_AE(alignment, offset));
+    return true;
+}
+
+
+/***************************************************************************
+ *  Name:
+ *      bl_vcf_allele_depths() - Count alleles at a VCF call in a sorted SAM stream
+ *
+ *  Library:
+ *      #include <biolibc/vcf.h>
+ *      -lbiolibc -lxtend
+ *
+ *  Description:
+ *      Sweep a SAM stream along a stream of VCF calls, both sorted by
+ *      chrom and position, collecting allele depths for each call in
+ *      turn.  This is the core of ad2vcf-style tools: read each call
+ *      and pass it here with the same sam_buff and sam_stream.
+ *
+ *      sam_buff holds a sliding window of alignments.  For each call:
+ *
+ *      1.  Alignments ending before the call are released with
+ *          bl_sam_buff_release_behind(3).  Since calls are sorted, they
+ *          cannot contain any later call.
+ *      2.  Alignments are read from sam_stream and added to the window
+ *          until one starts past the call.  Unmapped alignments and
+ *          those failing the MAPQ minimum of sam_buff are discarded by
+ *          bl_sam_buff_alignment_ok(3).  Alignments are read directly
+ *          into pooled buffer slots, so no sequence data is copied.
+ *      3.  ref_count, alt_count, other_count and phreds of vcf_call are
+ *          reset and then filled in by bl_vcf_count_allele(3) from every
+ *          buffered alignment containing the call.
+ *
+ *      If vcf_call has a chromosome dictionary, alignments are read
+ *      with the same dictionary and all chromosome comparisons are
+ *      integer compares.
+ *
+ *      Spilled alignments cannot be counted, so with
+ *      BL_SAM_BUFF_OVERFLOW_SPILL mode, BL_READ_OVERFLOW is returned
+ *      rather than short depths if any are spilled when the call is
+ *      counted.  max_alignments should exceed the expected read depth.
+ *
+ *  Arguments:
+ *      vcf_call    Pointer to bl_vcf_t structure containing VCF call
+ *      sam_buff    SAM buffer initialized by bl_sam_buff_init(3)
+ *      sam_stream  SAM stream positioned after the header
+ *
+ *  Returns:
+ *      BL_READ_OK on success, including when sam_stream is exhausted
+ *      BL_READ_TRUNCATED or another error from bl_sam_read(3)
+ *      BL_SAM_BUFF_ADD_FAILED if the window cannot be extended
+ *      BL_READ_OVERFLOW if alignments were spilled from the window
+ *
+ *  Examples:
+ *      bl_sam_buff_init(&sam_buff, mapq_min, max_alignments);
+ *      while ( bl_vcf_read_ss_call(&vcf_call, vcf_stream,
+ *                                  BL_VCF_FIELD_ALL) == BL_READ_OK )
+ *      {
+ *          if ( bl_vcf_allele_depths(&vcf_call, &sam_buff, sam_stream)
+ *               != BL_READ_OK )
+ *              return EX_DATAERR;
+ *          printf("%s\t%" PRId64 "\t%u\t%u\n", BL_VCF_CHROM(&vcf_call),
+ *                 BL_VCF_POS(&vcf_call), BL_VCF_REF_COUNT(&vcf_call),
+ *                 BL_VCF_ALT_COUNT(&vcf_call));
+ *      }
+ *      bl_sam_buff_free(&sam_buff);
+ *
+ *  See also:
+ *      bl_vcf_count_allele(3), bl_sam_buff_release_behind(3),
+ *      bl_vcf_call_in_alignment(3)
+ *
+ *  History: 
+ *  Date        Name        Modification
+ *  2026-10-17  agent       Begin
+ *  2026-10-17  agent       Fail instead of skipping spilled alignments
+ ***************************************************************************/
+
+int     bl_vcf_allele_depths(bl_vcf_t *vcf_call, bl_sam_buff_t *sam_buff,
+	    FILE *sam_stream)
+
+{
+    bl_sam_t    *alignment;
+    size_t      c;
+    int         chrom_cmp,
+		status;
+    bool        read_ahead = true;
+    
+    bl_sam_buff_release_behind(sam_buff, vcf_call->chrom_dict,
+			       vcf_call->chrom_id, BL_VCF_CHROM(vcf_call),
+			       BL_VCF_POS(vcf_call));
+    
+    // No need to read if the newest alignment already starts past the call
+    if ( BL_SAM_BUFF_READS_USED(sam_buff) > 0 )
+    {
+	if ( BL_CHROM_IDS_COMPARABLE(vcf_call->chrom_dict,
+		sam_buff->previous_rname_id, vcf_call->chrom_dict,
+		vcf_call->chrom_id) )
+	    chrom_cmp = bl_chrom_dict_cmp(vcf_call->chrom_dict,
+			    sam_buff->previous_rname_id, vcf_call->chrom_id);
+	else
+	    chrom_cmp = bl_chrom_name_cmp(sam_buff->previous_rname,
+					  BL_VCF_CHROM(vcf_call));
+	read_ahead = (chrom_cmp < 0) || ((chrom_cmp == 0) &&
+		     (sam_buff->previous_pos <= BL_VCF_POS(vcf_call)));
+    }
+    
+    while ( read_ahead )
+    {
+	alignment = bl_sam_buff_tail_slot(sam_buff);
+	alignment->chrom_dict = vcf_call->chrom_dict;
+	status = bl_sam_read(alignment, sam_stream, BL_SAM_FIELD_ALL);
+	if ( status == BL_READ_EOF )
+	    break;
+	else if ( status != BL_READ_OK )
+	    return status;
+	BL_SAM_BUFF_INC_TOTAL_ALIGNMENTS(sam_buff);
+	
+	if ( bl_sam_buff_alignment_ok(sam_buff, alignment) &&
+	     (bl_sam_buff_commit_tail(sam_buff) != BL_SAM_BUFF_OK) )
+	    return BL_SAM_BUFF_ADD_FAILED;
+	read_ahead = ! bl_vcf_call_upstream_of_alignment(vcf_call, alignment);
+    }
+    
+    // Spilled alignments are not in the window and would be missed
+    if ( BL_SAM_BUFF_SPILL_COUNT(sam_buff) > 0 )
+    {
+	fprintf(stderr, "bl_vcf_allele_depths(): SAM buffer is full at %s:%" PRId64 ".\n",
+		BL_VCF_CHROM(vcf_call), BL_VCF_POS(vcf_call));
+	return BL_READ_OVERFLOW;
+    }
+    
+    vcf_call->ref_count = 0;
+    vcf_call->alt_count = 0;
+    vcf_call->other_count = 0;
+    bl_vcf_phred_blank(vcf_call);
+    for (c = 0; c < BL_SAM_BUFF_BUFFERED_COUNT(sam_buff); ++c)
+    {
+	alignment = BL_SAM_BUFF_ALIGNMENTS_AE(sam_buff, c);
+	if ( bl_vcf_call_in_alignment(vcf_call, alignment) )
+	    bl_vcf_count_allele(vcf_call, alignment);
+	else if ( bl_vcf_call_upstream_of_alignment(vcf_call, alignment) )
+	    break;
+    }
+    return BL_READ_OK;
+}
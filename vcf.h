@@ -5,6 +5,10 @@
 #include "sam.h"
 #endif
 
+#ifndef _BIOLIBC_SAM_BUFF_H_
+#include "sam-buff.h"
+#endif
+
 #ifndef _BIOLIBC_H_
 #include "biolibc.h"
 #endif
@@ -26,6 +30,9 @@
 // Only used for temp variables.  Replace with read_field_malloc().
 #define BL_VCF_SAMPLE_ID_MAX_CHARS    4096
 
+// Initial size of phreds, doubled by bl_vcf_phred_add() as needed
+#define BL_VCF_PHRED_BUFF_START_SIZE  64
+
 // Hack:
 // Use different sizes for each so xt_dsv_read_field() buffer overflow errors
 // will point to a specific field.  Eventually should have xt_dsv_read_field()
@@ -79,6 +86,10 @@ typedef struct
     unsigned char   *phreds;
     size_t          phred_count;
     size_t          phred_buff_size;
+    
+    // Optional shared chromosome dictionary, see bl_sam_t
+    bl_chrom_dict_t *chrom_dict;
+    int32_t         chrom_id;
 }   bl_vcf_t;
 
 typedef unsigned int vcf_field_mask_t;
@@ -108,11 +119,16 @@ int bl_vcf_read_ss_call(bl_vcf_t *vcf_call, FILE *vcf_stream, vcf_field_mask_t f
 int bl_vcf_write_static_fields(bl_vcf_t *vcf_call, FILE *vcf_stream, vcf_field_mask_t field_mask);
 int bl_vcf_write_ss_call(bl_vcf_t *vcf_call, FILE *vcf_stream, vcf_field_mask_t field_mask);
 char **bl_vcf_sample_alloc(bl_vcf_t *vcf_call, size_t samples);
+int bl_vcf_phred_add(bl_vcf_t *vcf_call, unsigned char score);
+void bl_vcf_phred_blank(bl_vcf_t *vcf_call);
 void bl_vcf_free(bl_vcf_t *vcf_call);
 void bl_vcf_init(bl_vcf_t *vcf_call);
 vcf_field_mask_t bl_vcf_parse_field_spec(char *spec);
 _Bool bl_vcf_call_in_alignment(bl_vcf_t *vcf_call, bl_sam_t *sam_alignment);
 _Bool bl_vcf_call_downstream_of_alignment(bl_vcf_t *vcf_call, bl_sam_t *alignment);
 void bl_vcf_call_out_of_order(bl_vcf_t *vcf_call, char *previous_chrom, int64_t previous_pos);
+_Bool bl_vcf_call_upstream_of_alignment(bl_vcf_t *vcf_call, bl_sam_t *alignment);
+_Bool bl_vcf_count_allele(bl_vcf_t *vcf_call, bl_sam_t *alignment);
+int bl_vcf_allele_depths(bl_vcf_t *vcf_call, bl_sam_buff_t *sam_buff, FILE *sam_stream);
 
 #endif // _BIOLIBC_VCF_H_